@@ -0,0 +1,137 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp4/client_handler.h>
+#include <dhcp4/dhcp4_log.h>
+#include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
+
+#include <boost/functional/hash.hpp>
+
+using namespace isc::util;
+
+namespace isc {
+namespace dhcp {
+
+ClientHandler::Stripe ClientHandler::stripes_[ClientHandler::STRIPES];
+
+ClientHandler::Client::Client(const Pkt4Ptr& query)
+    : query_(query) {
+}
+
+size_t
+ClientHandler::KeyHash::operator()(const Key& key) const {
+    return (boost::hash_range(key.begin(), key.end()));
+}
+
+ClientHandler::Stripe&
+ClientHandler::getStripe(const Key& key) {
+    return (stripes_[KeyHash()(key) % STRIPES]);
+}
+
+void
+ClientHandler::makeKey(const Pkt4Ptr& query, Key& key) {
+    key.clear();
+
+    // The first byte tells the kind of identifier so a client identifier
+    // can not match a hardware address.
+    OptionPtr opt = query->getOption(DHO_DHCP_CLIENT_IDENTIFIER);
+    if (opt && !opt->getData().empty()) {
+        const OptionBuffer& data = opt->getData();
+        key.reserve(data.size() + 1);
+        key.push_back(DHO_DHCP_CLIENT_IDENTIFIER);
+        key.insert(key.end(), data.begin(), data.end());
+        return;
+    }
+
+    HWAddrPtr hwaddr = query->getHWAddr();
+    if (hwaddr && !hwaddr->hwaddr_.empty()) {
+        key.reserve(hwaddr->hwaddr_.size() + 2);
+        key.push_back(0);
+        key.push_back(static_cast<uint8_t>(hwaddr->htype_));
+        key.insert(key.end(), hwaddr->hwaddr_.begin(), hwaddr->hwaddr_.end());
+    }
+}
+
+ClientHandler::ClientHandler() {
+}
+
+ClientHandler::~ClientHandler() {
+    if (key_.empty()) {
+        return;
+    }
+
+    ContinuationPtr cont;
+    Stripe& stripe = getStripe(key_);
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex_);
+        auto it = stripe.clients_.find(key_);
+        if (it == stripe.clients_.end()) {
+            return;
+        }
+        cont = it->second->cont_;
+        stripe.clients_.erase(it);
+    }
+
+    // Process the parked query now the client is free.
+    if (cont) {
+        MultiThreadingMgr::instance().getThreadPool().add(cont);
+    }
+}
+
+bool
+ClientHandler::tryLock(const Pkt4Ptr& query, const ContinuationPtr& cont) {
+    if (!key_.empty()) {
+        isc_throw(InvalidOperation, "client handler already holds a client");
+    }
+
+    Key key;
+    makeKey(query, key);
+    if (key.empty()) {
+        // Nothing to identify the client: process the query.
+        return (true);
+    }
+
+    Pkt4Ptr dropped;
+    Stripe& stripe = getStripe(key);
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex_);
+        auto it = stripe.clients_.find(key);
+        if (it == stripe.clients_.end()) {
+            stripe.clients_[key] = ClientPtr(new Client(query));
+            key_.swap(key);
+            return (true);
+        }
+
+        // The client is in progress: park the query, replacing the
+        // query parked before which is dropped.
+        const ClientPtr& client = it->second;
+        if (cont) {
+            dropped = client->next_query_;
+            client->next_query_ = query;
+            client->cont_ = cont;
+        } else {
+            dropped = query;
+        }
+    }
+
+    if (cont) {
+        LOG_DEBUG(packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_DEFERRED)
+            .arg(query->getLabel());
+    }
+    if (dropped) {
+        LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_DROP_0011)
+            .arg(dropped->getLabel());
+        stats::StatsMgr::instance().addValue("pkt4-receive-drop",
+                                             static_cast<int64_t>(1));
+    }
+    return (false);
+}
+
+} // namespace dhcp
+} // namespace isc
@@ -766,6 +766,15 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Build the allocation state of the pools from the leases.
+    try {
+        srv->alloc_engine_->
+            buildAllocatorStates(CfgMgr::instance().getStagingCfg());
+    } catch (const std::exception& ex) {
+        err << "Unable to build the allocator state: " << ex.what();
+        return (isc::config::createAnswer(1, err.str()));
+    }
+
     // Server will start DDNS communications if its enabled.
     try {
         srv->startD2();
@@ -800,6 +809,12 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Allocate the options of the received packets in an arena when
+    // configured.
+    data::ConstElementPtr option_arena =
+        CfgMgr::instance().getStagingCfg()->getConfiguredGlobal("option-arena");
+    Pkt::setDefaultOptionArena(option_arena && option_arena->boolValue());
+
     // Configuration may change active interfaces. Therefore, we have to reopen
     // sockets according to new configuration. It is possible that this
     // operation will fail for some interfaces but the openSockets function
@@ -1097,6 +1112,8 @@ ControlledDhcpv4Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
     try {
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getCurrentCfg()->getCfgDbAccess();
         cfg_db->createManagers();
+        server_->alloc_engine_->
+            buildAllocatorStates(CfgMgr::instance().getCurrentCfg());
         reopened = true;
     } catch (const std::exception& ex) {
         LOG_ERROR(dhcp4_logger, DHCP4_DB_RECONNECT_ATTEMPT_FAILED).arg(ex.what());
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 201
-#define YY_END_OF_BUFFER 202
+#define YY_NUM_RULES 208
+#define YY_END_OF_BUFFER 209
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,210 +700,217 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1839] =
+static const flex_int16_t yy_accept[1900] =
     {   0,
-      194,  194,    0,    0,    0,    0,    0,    0,    0,    0,
-      202,  200,   10,   11,  200,    1,  194,  191,  194,  194,
-      200,  193,  192,  200,  200,  200,  200,  200,  187,  188,
-      200,  200,  200,  189,  190,    5,    5,    5,  200,  200,
-      200,   10,   11,    0,    0,  183,    0,    0,    0,    0,
+      201,  201,    0,    0,    0,    0,    0,    0,    0,    0,
+      209,  207,   10,   11,  207,    1,  201,  198,  201,  201,
+      207,  200,  199,  207,  207,  207,  207,  207,  194,  195,
+      207,  207,  207,  196,  197,    5,    5,    5,  207,  207,
+      207,   10,   11,    0,    0,  190,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-      194,  194,    0,  193,  194,    3,    2,    6,    0,  194,
+      201,  201,    0,  200,  201,    3,    2,    6,    0,  201,
         0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
 
-        0,  184,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  186,    0,    0,    0,
+        0,  191,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  193,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    2,    0,    0,    0,
-        0,    0,    0,    0,    8,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    2,    0,    0,
+        0,    0,    0,    0,    0,    8,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  185,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      192,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   82,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   89,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,  199,  197,
-        0,  196,  195,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  163,    0,  162,    0,    0,   88,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   35,    0,    0,    0,    0,    0,    0,
+        0,  206,  204,    0,  203,  202,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  170,    0,  169,    0,
+        0,   95,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   35,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   85,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   17,
-
+        0,    0,    0,    0,    0,    0,    0,    0,   92,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,   17,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   18,    0,
-        0,    0,    0,  198,  195,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  164,    0,    0,  166,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   89,
-        0,    0,    0,    0,    0,    0,    0,   74,    0,    0,
-        0,    0,    0,    0,  110,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   38,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   18,    0,    0,    0,    0,  205,
+      202,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  171,    0,    0,  173,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   96,    0,    0,    0,
+        0,    0,    0,    0,   81,    0,    0,    0,    0,    0,
+        0,  117,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   38,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   73,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   77,    0,   39,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   80,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  107,    0,   31,    0,
-        0,   36,    0,    0,    0,    0,    0,    0,    0,    0,
-       12,  171,    0,  168,    0,  167,    0,    0,    0,  120,
+        0,    0,    0,    0,   84,    0,   39,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  114,    0,
+       31,    0,    0,   36,    0,    0,    0,    0,    0,    0,
+        0,    0,   12,  178,    0,  175,    0,  174,    0,    0,
+        0,    0,  127,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       99,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   33,    0,    0,
+        0,    0,    0,    0,  106,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   76,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  121,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  116,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    7,
-        0,    0,  169,    0,    0,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   33,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       83,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      128,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  123,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    7,    0,    0,
+      176,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   87,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  101,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   97,    0,    0,    0,    0,    0,    0,
+        0,    0,   94,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  108,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  104,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   80,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       94,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   79,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   87,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  114,    0,
+        0,    0,    0,    0,  101,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   86,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  126,   95,    0,    0,    0,    0,    0,
-        0,  100,   32,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  102,   40,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   68,    0,
+        0,    0,    0,    0,  121,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  172,    0,    0,    0,    0,    0,    0,  145,    0,
+        0,    0,    0,  133,  102,    0,    0,    0,    0,    0,
+
+        0,  107,   32,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  109,   40,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   84,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  115,    0,    0,    0,    0,    0,   43,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   72,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  179,    0,    0,    0,    0,    0,    0,    0,
+      152,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   91,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,   37,    0,    0,    0,    0,   30,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  103,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  122,    0,    0,
+        0,    0,    0,   43,    0,    0,    0,    0,   55,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  112,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  146,
+        0,   37,    0,    0,    0,    0,   30,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   81,    0,    0,
+        0,    0,    0,    0,    0,  110,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   74,    0,    0,    0,    0,
+        0,    0,  119,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,    0,  153,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   23,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  151,
-        0,    0,    0,  149,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   88,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  176,    0,    0,    0,    0,    0,    0,    0,  113,
-        0,    0,    0,    0,    0,    0,    0,    0,  117,    0,
-        0,    0,    0,    0,   98,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  111,   22,    0,  122,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,  155,    0,
-        0,    0,    0,   71,    0,    0,    0,    0,    0,    0,
-      125,   34,    0,  144,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   59,
-        0,    0,    0,    0,    0,   92,   93,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   75,    0,
-        0,    0,    0,    0,    0,    0,    0,   44,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  119,    0,    0,    0,    0,    0,    0,
+        0,   23,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  158,    0,    0,    0,  156,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,  180,    0,   72,   86,
+        0,    0,    0,    0,    0,  183,    0,    0,    0,    0,
+
+        0,    0,    0,  120,    0,    0,    0,    0,    0,    0,
+        0,    0,  124,    0,    0,    0,    0,    0,  105,    0,
+        0,    0,    0,   53,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  118,   22,
+        0,  129,    0,    0,    0,   54,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  162,    0,    0,    0,
+        0,    0,   78,    0,    0,    0,    0,    0,    0,  132,
+       34,    0,  151,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   63,    0,
+        0,    0,    0,    0,   99,  100,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   82,    0,    0,
+        0,    0,    0,    0,    0,    0,   44,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       56,    0,    0,    0,    0,    0,    0,    0,  152,    0,
-        0,  150,    0,  141,  140,    0,    0,    0,   49,    0,
-        0,   21,    0,    0,    0,    0,    0,  165,    0,    0,
-        0,  106,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  134,    0,    0,
-      143,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  123,   15,    0,   41,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  154,    0,    0,    0,    0,    0,
-
-        0,    0,   57,    0,    0,  118,    0,    0,    0,    0,
-      109,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   78,    0,  174,    0,  173,    0,  179,    0,    0,
+        0,    0,  126,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  187,    0,    0,
+       79,   93,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   60,    0,    0,    0,    0,    0,    0,    0,
+      159,    0,    0,  157,    0,  148,  147,    0,    0,    0,
+       49,    0,    0,   21,    0,    0,    0,    0,    0,  172,
+
+        0,    0,    0,  113,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  141,
+        0,    0,  150,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  130,   15,    0,   41,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  161,    0,
+       76,    0,    0,    0,    0,    0,    0,   61,    0,    0,
+      125,    0,    0,    0,    0,  116,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   85,    0,  181,    0,
+      180,    0,  186,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   14,    0,    0,    0,    0,    0,   48,    0,    0,
-        0,    0,    0,  182,    0,  104,   27,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   14,    0,
+        0,    0,    0,    0,   48,    0,    0,    0,    0,    0,
+      189,    0,  111,   27,    0,    0,    0,   50,  146,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  184,    0,
+      154,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       25,    0,    0,   24,   56,    0,  160,    0,    0,    0,
+       52,    0,    0,    0,    0,    0,  103,    0,    0,    0,
 
-       50,  139,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  177,    0,  147,    0,    0,    0,    0,    0,    0,
-        0,    0,   25,    0,    0,   24,    0,  153,    0,    0,
-        0,   52,    0,    0,    0,    0,    0,   96,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   53,    0,    0,    0,
-        0,    0,   42,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  124,    0,    0,
-        0,   26,    0,  178,    0,    0,    0,    0,    0,  135,
+        0,    0,    0,    0,    0,   57,    0,    0,    0,    0,
+        0,   42,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  131,    0,    0,
+        0,   26,    0,  185,    0,    0,    0,    0,    0,  142,
         0,    0,    0,    0,    0,    0,    0,    0,    0,   47,
-
-        0,    0,   20,    0,  181,   70,    0,    0,    0,    0,
-      175,  170,    0,   28,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   16,    0,    0,    0,  159,    0,    0,
-        0,    0,    0,    0,  132,    0,    0,    0,  108,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   83,    0,
-        0,    0,  137,    0,    0,    0,    0,    0,    0,    0,
-        0,   62,    0,    0,    0,    0,    0,    0,    0,    0,
-      160,   13,    0,    0,    0,    0,    0,    0,    0,  138,
-      148,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  142,    0,    0,
-
-        0,    0,    0,    0,  131,    0,   55,   54,   19,    0,
-      156,    0,    0,    0,    0,   45,    0,    0,    0,   91,
+        0,    0,   20,    0,  188,   77,    0,    0,    0,    0,
+      182,  177,    0,   28,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   16,    0,    0,    0,   75,  166,    0,
+        0,    0,    0,    0,    0,  139,    0,    0,    0,  115,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   90,
+        0,    0,    0,  144,    0,    0,    0,    0,    0,    0,
+        0,    0,   66,    0,    0,    0,    0,    0,    0,    0,
+        0,  167,   13,    0,    0,    0,    0,    0,    0,    0,
+      145,  155,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  149,    0,
+        0,    0,    0,    0,    0,  138,    0,   59,   58,   19,
+        0,  163,    0,    0,    0,    0,   45,    0,    0,    0,
+       98,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  137,    0,    0,   51,    0,    0,   46,  165,    0,
+
+        0,   73,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      130,    0,    0,   51,    0,    0,   46,  158,    0,    0,
-       69,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       66,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   29,    0,    0,   67,
-        0,    0,  136,    0,    0,    0,    0,  157,    0,  105,
-        0,    0,    0,   63,    0,    0,    0,    0,    0,    0,
-
-      128,    0,  133,    0,   65,   58,    0,    0,    0,    0,
-        0,    0,  127,    0,    0,  161,    0,    0,    0,    0,
-        0,    0,    0,   64,    0,    0,    0,    0,    0,   90,
-       61,    0,    0,    0,    0,   60,  129,    0
+        0,   70,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   29,    0,    0,
+       71,    0,    0,  143,    0,    0,    0,    0,  164,    0,
+      112,    0,    0,    0,   67,    0,    0,    0,    0,    0,
+        0,  135,    0,  140,    0,   69,   62,    0,    0,    0,
+        0,    0,    0,  134,    0,    0,  168,    0,    0,    0,
+        0,    0,    0,    0,   68,    0,    0,    0,    0,    0,
+       97,   65,    0,    0,    0,    0,   64,  136,    0
+
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -940,707 +947,777 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[74] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    5,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    5,    5,    5,    5,    5,
-        5,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1851] =
+static const flex_int16_t yy_base[1900] =
     {   0,
-        0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     2239, 2240,   34, 2235,  145,    0,  207, 2240,  214,  221,
-       13,  228, 2240, 2215,  118,   25,    2,    6, 2240, 2240,
-       73,   11,   17, 2240, 2240, 2240,  104, 2223, 2176,    0,
-     2213,  108, 2230,   24,  262, 2240, 2172,   67, 2171, 2177,
-       84,   75, 2169,   88,  226,   91,   89,  290,  196, 2168,
-      206,  285,  206,  210,  219,   60,  223, 2177,  247,  294,
-      315,  307,  231, 2160,  286,  325,  354,  328, 2179,    0,
-      366,  382,  397,  411,  404, 2240,    0, 2240,  419,  425,
-      216,  249,  220,  315,  319,  329, 2240, 2176, 2217, 2240,
-
-      404, 2240,  438, 2204,  390, 2162, 2172,  331,   10, 2167,
-      406,  414,  408,  415,  428, 2212,    0,  491,  412, 2154,
-     2151, 2155,  286, 2151, 2159,  246, 2155, 2144, 2145, 2150,
-       78, 2160, 2143, 2152, 2152,   95, 2143,  400, 2144, 2142,
-      396, 2190, 2194, 2134, 2187, 2127, 2150, 2147, 2147, 2141,
-      336, 2134, 2132, 2133, 2125, 2130, 2124,  423, 2135, 2128,
-     2119, 2118, 2132,  419, 2118,  408,  413, 2112,  487,  191,
-      428, 2133, 2130, 2131,  299, 2129, 2164, 2163,  452, 2109,
-     2109, 2110,  459, 2102, 2119, 2111,    0,  458,  439,  438,
-      463,  469,  452, 2110, 2240,    0, 2155,  501, 2100, 2103,
-
-      489,  491, 2111,  502, 2156,  504, 2155,  496, 2154, 2240,
-      542, 2153,  538, 2112, 2104, 2091, 2107, 2108, 2105, 2102,
-     2101, 2092,  512, 2143, 2137, 2101, 2082, 2079, 2087, 2082,
-     2096, 2092, 2080, 2092, 2092, 2083, 2067, 2071, 2084, 2086,
-     2083, 2075, 2065, 2083, 2240, 2078, 2081, 2062, 2061, 2113,
-     2060, 2070, 2073,  519, 2069, 2108, 2053, 2055, 2066, 2104,
-     2049, 2107, 2042, 2057,  534, 2047, 2053, 2062, 2043, 2041,
-     2041, 2047, 2038, 2037, 2044, 2034, 2093, 2049, 2048, 2042,
-      515, 2049, 2044, 2036, 2026, 2041, 2040, 2035, 2039,  410,
-     2037, 2023, 2029, 2036, 2018, 2019, 2022, 2019, 2018,  346,
-
-     2013, 2027, 2026, 2069, 2028,  499, 2019,  537, 2240, 2240,
-      546, 2240, 2240, 2006,    0,  457,  533, 2008,  580,  551,
-     2064, 2015,  544, 2240, 2062, 2240, 2056,  594, 2240,  544,
-     1996, 2005, 2053, 1997, 2014, 1995, 2001, 2053, 2008, 2003,
-     2006, 2001,  536, 2240, 2003, 2047, 2041, 1999, 1996,  583,
-     2002, 2042, 2036, 1989, 1984, 1981, 2032, 1989, 1978, 1994,
-     2028, 1974,  617, 1988, 1973, 1986, 1973, 1983, 1978, 1985,
-     1980, 1976,  562, 1974, 1977, 1972, 1958, 1970, 1966, 2016,
-      554, 2010, 2240, 2009, 1959, 1958, 1957, 1950, 1952, 1964,
-     1955, 1944, 1961, 1956,  574, 2003, 1956, 1953, 1956, 2240,
-
-     1955, 1944, 1944, 1956,  473, 1931, 1932, 1953,  576, 1935,
-     1986, 1931, 1945, 1948, 1943, 1929, 1941, 1940, 1939, 1934,
-     1937, 1936, 1935, 1934,  557, 1977, 1936, 1975, 2240, 1917,
-     1916,  621, 1929, 2240, 2240, 1928,    0, 1917, 1909,  595,
-     1914, 1967, 1966, 1922, 1964, 2240, 1910, 1962, 2240,  601,
-      668,  600, 1961, 1903, 1914, 1907, 1909, 1908, 1896, 2240,
-     1901, 1907, 1910, 1893, 1908, 1895, 1894, 2240,  587, 1896,
-     1893,  599, 1891, 1893, 2240, 1901, 1898, 1883, 1896, 1891,
-      646, 1898, 1886, 1879, 1930, 2240, 1877, 1893, 1927, 1888,
-     1885, 1886, 1888, 1922, 1873, 1868, 1867, 1918, 1862,  596,
-
-     1881, 1855, 1862, 1867, 1877, 1911, 1915, 2240, 1860, 1856,
-     1854, 1863, 1857, 1864, 1848, 1848, 1858, 1846, 1860, 1849,
-     1845, 1843, 2240, 1900, 2240, 1842, 1853, 1892, 1837, 1842,
-     1851, 1845, 1839, 1848, 1890, 1884, 1846, 1829, 1829, 1824,
-     1844, 1819, 1825, 1830, 1823, 1831, 1835, 1818, 1876, 1817,
-     1869, 1814, 1815, 1814, 1826, 1815, 2240, 1825, 2240, 1814,
-     1812, 2240, 1823, 1859, 1819,    0, 1803, 1820, 1860, 1808,
-     2240, 2240, 1805, 2240, 1811, 2240,  620,  602,  660, 2240,
-     1808, 1807, 1814, 1794, 1793, 1846, 1791, 1844, 1789, 1788,
-     1787, 1794, 1787, 1799, 1781, 1781, 1796, 1795, 1794, 1793,
-
-     1793, 1775, 1780, 1821, 1788, 1780, 1825, 1769, 1785, 1784,
-     2240, 1769, 1766, 1824, 1779, 1771, 1777, 1768, 1776, 1761,
-     1777, 1759, 1773,  606, 1755, 1749, 1754, 1769, 1766, 1767,
-     1746, 1756, 1762, 1805, 1760, 1752, 1743, 2240, 1744, 1746,
-     1755, 1753, 1792, 1791, 1742,   16, 1751, 1788, 1733, 1734,
-     1737, 1730, 2240, 1744, 1723, 1727, 1741, 1733, 1778, 1730,
-     1737, 1775, 2240, 1720, 1734, 1718, 1732, 1735, 1716, 1768,
-     1767, 1766, 1765, 1710, 1763, 1762, 2240, 1707, 1721,  652,
-     1722, 1721, 1718, 1718, 1755, 1715, 1698, 1703, 1705, 2240,
-     1711, 1701, 2240, 1748, 1694, 1751,  633,  640, 1692, 1690,
-
-     1697, 1688, 1682, 1740,  620, 1744,  624, 1738, 1698, 1736,
-     1735, 1687, 1685, 1693, 1696, 1680,  161,  216,  392,  398,
-      462,  495,  591,  555,  580,  639,  620,  667,  673,  637,
-      638, 2240,  641,  645,  636,  652,  657,  654,  658,  657,
-      658,  656,  664,  661,  706,  707,  663,  655,  665,  712,
-      670,  720, 2240,  721,  674,  676,  672,  666,  669,  722,
-      685,  674,  687, 2240,  677,  688,  677,  690,  692,  736,
-      737,  680,  691,  676,  699,  678,  684,  739,  703,  687,
-      699,  743,  744,  745,  692,  747,  711,  706,  713,  709,
-      694,  706,  707,  714,  700, 2240,  765,  723,  725,  715,
-
-      727,  717,  730,  715,  722,  728,  720,  734,  739,  780,
-     2240,  776,  752,  739,  744,  741,  742,  787,  740,  738,
-      747, 2240,  737,  752,  749,  735,  742,  741,  739,  758,
-      755,  743,  750,  751,  760,  760,  750,  748,  747,  758,
-      754,  811,  768,  753,  754,  760,  776,  766, 2240,  776,
-      776,  769,  780,  778,  823,  765,  767,  782,  769,  829,
-      786,  772,  775, 2240, 2240,  785,  790,  795,  783,  793,
-      795, 2240, 2240,  796,  783,  801,  788,  782,  787,  805,
-      792,  842,  793,  845,  791,  795,  853, 2240, 2240,  798,
-      802,  801,  798,  858,  811,  801,  802,  798,  811,  822,
-
-      806,  824,  819,  820,  822,  815,  817,  818,  819,  819,
-      821,  836,  877,  834,  839,  816,  839,  823, 2240,  830,
-      831,  845,  835,  833,  883,  841,  831,  846,  847,  834,
-      848, 2240,  867,  875,  844,  839,  894,  895, 2240,  858,
-      862,  903,  851,  846,  847,  859,  866,  855,  856,  852,
-      855,  856,  866,  875,  911,  866,  861,  920,  877,  879,
-      870, 2240,  872,  875,  883,  885,  870,  886,  880,  927,
-      893,  877,  878, 2240,  894,  897,  880,  939,  882, 2240,
-      899,  902,  882,  900,  940,  898,  894,  891,  944,  945,
-      907,  893,  911,  910,  911,  897,  912,  904,  911,  901,
-
-      919,  918,  905, 2240,  913,  919,  922,  967, 2240,  916,
-      921,  965,  916,  929,  923,  927,  925,  923,  925,  935,
-      980,  924,  929,  925,  984,  928,  940, 2240,  928,  936,
-      934,  985,  947,  933,  934,  943,  955,  942,  941,  946,
-      956,  957,  962, 1003,  960,  976,  981,  963,  960,  956,
-      951, 1011,  954, 2240,  954,  974,  973,  964,  953,  970,
-      977, 1020,  981,  974,  978,  982,  965, 1026,  973, 2240,
-     1023,  970,  973,  972,  973,  975,  996,  993,  998,  999,
-      985,  993, 1002,  982,  997, 1004, 1046, 2240, 1047, 1048,
-      999, 1009, 1011, 1000,  996, 1003, 1012, 1000, 1007, 1008,
-
-     1020, 1061, 1008, 1006, 1008, 1025, 1066, 1016, 1015, 1021,
-     1019, 1017, 1012, 1073, 1074, 1070, 1076, 2240, 1033, 1026,
-     1017, 1036, 1024, 1034, 1031, 1036, 1032, 1045, 1045, 2240,
-     1029, 1031, 1031, 2240, 1032, 1093, 1032, 1051, 1052, 1054,
-     1045, 1099, 1100, 1053, 1038, 1052, 1060, 1059, 1043, 1048,
-     1066, 2240, 1056, 1089, 1080, 1112, 1052, 1074, 1071, 2240,
-     1058, 1060, 1077, 1072, 1076, 1121, 1069, 1073, 2240, 1065,
-     1082, 1062, 1083, 1073, 2240, 1088, 1088, 1126, 1073, 1129,
-     1087, 1092, 1078, 1138, 1082, 1093, 1085, 1091, 1087, 1105,
-     1106, 1107, 2240, 2240, 1106, 2240, 1091, 1092, 1111, 1101,
-
-     1094, 1106, 1150, 1114, 1103, 1110, 1111, 1117, 2240, 1110,
-     1162, 1103, 1164, 2240, 1165, 1107, 1113, 1120, 1164, 1126,
-     2240, 2240, 1113, 2240, 1115, 1129, 1134, 1117, 1176, 1133,
-     1134, 1135, 1175, 1127, 1132, 1183, 1136, 1132, 1186, 2240,
-     1133, 1188, 1189, 1146, 1148, 2240, 2240, 1131, 1193, 1189,
-     1153, 1196, 1138, 1150, 1155, 1141, 1171, 1202, 2240, 1159,
-     1152, 1161, 1206, 1153, 1168, 1204, 1156, 2240, 1152, 1168,
-     1169, 1170, 1167, 1211, 1174, 1178, 1165, 1161, 1221, 1174,
-     1218, 1224, 1181, 2240, 1182, 1175, 1184, 1186, 1183, 1173,
-     1177, 1177, 1182, 1237, 1238, 1181, 1240, 1236, 1177, 1192,
-
-     1185, 1188, 1201, 1202, 1200, 1249, 2240, 1204, 2240, 2240,
-     1209, 1201, 1211, 1196, 1252, 1198, 1259, 1203, 1213, 1262,
-     2240, 1210, 1210, 1212, 1214, 1267, 1208, 1211, 2240, 1212,
-     1231, 2240, 1215, 2240, 2240, 1228, 1230, 1231, 2240, 1218,
-     1226, 2240, 1278, 1227, 1280, 1281, 1261, 2240, 1283, 1240,
-     1281, 2240, 1229, 1237, 1231, 1228, 1231, 1234, 1234, 1251,
-     1290, 1243, 1255, 1258, 1240, 1247, 1237, 2240, 1259, 1244,
-     2240, 1246, 1248, 1263, 1263, 1266, 1266, 1263, 1307, 1269,
-     1261, 2240, 2240, 1271, 2240, 1268, 1273, 1274, 1271, 1315,
-     1263, 1278, 1279, 1271, 2240, 1268, 1269, 1269, 1275, 1274,
-
-     1272, 1286, 2240, 1327, 1274, 2240, 1275, 1275, 1277, 1283,
-     2240, 1285, 1339, 1281, 1289, 1292, 1303, 1301, 1345, 1298,
-     1307, 2240, 1304, 2240, 1301, 2240, 1324, 2240, 1351, 1293,
-     1353, 1354, 1311, 1316, 1298, 1358, 1359, 1355, 1319, 1316,
-     1312, 1305, 1317, 1307, 1312, 1368, 1322, 1370, 1366, 1330,
-     1326, 1370, 1318, 1324, 1322, 1381, 1337, 1383, 1341, 1385,
-     1346, 1335, 1329, 1389, 1331, 1332, 1346, 1349, 1349, 1395,
-     1337, 1354, 1350, 1354, 1338, 1396, 1397, 1344, 1399, 1362,
-     1363, 2240, 1363, 1364, 1351, 1350, 1406, 2240, 1347, 1365,
-     1414, 1372, 1385, 2240, 1369, 2240, 2240, 1360, 1371, 1420,
-
-     2240, 2240, 1366, 1371, 1369, 1419, 1377, 1382, 1373, 1371,
-     1385, 2240, 1373, 2240, 1376, 1427, 1370, 1375, 1435, 1383,
-     1393, 1394, 2240, 1440, 1393, 2240, 1442, 2240, 1385, 1401,
-     1389, 2240, 1399, 1400, 1449, 1407, 1411, 2240, 1447, 1413,
-     1389, 1407, 1416, 1398, 1405, 1459, 1418, 1417, 1462, 1410,
-     1464, 1465, 1415, 1419, 1424, 1417, 2240, 1470, 1471, 1420,
-     1473, 1415, 2240, 1418, 1428, 1472, 1420, 1435, 1422, 1428,
-     1428, 1483, 1440, 1428, 1427, 1487, 1440, 2240, 1484, 1435,
-     1432, 2240, 1446, 2240, 1449, 1494, 1447, 1444, 1445, 2240,
-     1498, 1457, 1440, 1442, 1458, 1440, 1456, 1457, 1466, 2240,
-
-     1456, 1508, 2240, 1467, 2240, 2240, 1451, 1458, 1512, 1508,
-     2240, 2240, 1470, 2240, 1510, 1472, 1473, 1458, 1459, 1467,
-     1521, 1517, 1472, 2240, 1484, 1471, 1478, 2240, 1475, 1480,
-     1478, 1530, 1531, 1474, 2240, 1489, 1490, 1491, 2240, 1492,
-     1482, 1494, 1539, 1540, 1482, 1490, 1491, 1504, 2240, 1481,
-     1541, 1502, 2240, 1506, 1491, 1491, 1506, 1499, 1498, 1509,
-     1496, 2240, 1501, 1557, 1515, 1517, 1508, 1517, 1519, 1523,
-     2240, 2240, 1564, 1507, 1566, 1567, 1568, 1526, 1570, 2240,
-     2240, 1566, 1528, 1529, 1516, 1575, 1518, 1523, 1514, 1579,
-     1532, 1533, 1523, 1540, 1539, 1580, 1542, 2240, 1539, 1544,
-
-     1545, 1590, 1547, 1550, 2240, 1593, 2240, 2240, 2240, 1554,
-     2240, 1536, 1596, 1597, 1540, 2240, 1559, 1600, 1559, 2240,
-     1550, 1540, 1599, 1565, 1558, 1554, 1551, 1556, 1552, 1554,
-     2240, 1559, 1569, 2240, 1555, 1567, 2240, 2240, 1572, 1565,
-     2240, 1567, 1575, 1620, 1561, 1563, 1560, 1584, 1577, 1580,
-     1569, 1623, 1570, 1578, 1587, 1580, 1575, 1579, 1591, 1636,
-     2240, 1582, 1594, 1639, 1588, 1587, 1642, 1595, 1582, 1597,
-     1602, 1647, 1604, 1649, 1599, 1593, 2240, 1609, 1653, 2240,
-     1610, 1612, 2240, 1603, 1617, 1613, 1606, 2240, 1660, 2240,
-     1617, 1662, 1623, 2240, 1664, 1665, 1620, 1619, 1620, 1610,
-
-     2240, 1665, 2240, 1612, 2240, 2240, 1672, 1614, 1630, 1675,
-     1636, 1633, 2240, 1674, 1623, 2240, 1635, 1628, 1683, 1625,
-     1627, 1642, 1627, 2240, 1640, 1689, 1690, 1638, 1640, 2240,
-     2240, 1634, 1650, 1695, 1696, 2240, 2240, 2240, 1702, 1707,
-     1712, 1717, 1722, 1727, 1732, 1735, 1709, 1714, 1716, 1729
+       74,    0,  220,    0, 1048,    0,  775,    0,  872,    0,
+      223,    0,  870,  293,  147,  293,  739,    0,  716,  782,
+      728,    0,    0,  347,  953,  902,  745,  794,    0,    0,
+      980,  972, 1000,    0,    0,    0,    0, 1242, 1200,  439,
+     1243,    0,    0,  582,  712,    0, 1205,  834, 1207, 1216,
+     1059,  964, 1210, 1058,  863, 1067, 1065,  836,  682, 1211,
+      781,  827,  875, 1040,  967,  768,  938, 1222, 1011,  985,
+      899,  935,  850, 1207, 1018,  755,  893,  988, 1229,    0,
+        0,    0,    0,    0,    0,    0,  366,    0, 1042,    0,
+     1065, 1067, 1061, 1219, 1221, 1213,    0, 1232, 1275,    0,
+
+        0,    0,  824, 1265, 1060, 1226, 1238, 1073, 1073, 1236,
+     1062, 1073, 1071, 1077, 1085,  509,    0,  582, 1053, 1227,
+     1226, 1232, 1056, 1230, 1240,  797, 1238, 1229, 1232, 1239,
+      699, 1251, 1236,  870, 1248, 1077, 1241, 1065, 1253, 1245,
+     1245, 1012, 1295, 1301, 1243, 1298, 1240, 1266, 1265, 1267,
+     1263, 1067, 1258, 1258, 1261, 1255, 1262, 1258, 1253, 1272,
+     1267, 1260, 1261, 1277,  913, 1265, 1017, 1093, 1261,  968,
+     1061, 1016, 1284, 1283, 1286, 1080, 1286, 1323, 1324, 1275,
+     1273, 1275, 1278, 1279, 1273, 1292, 1286,    0, 1078, 1110,
+     1118, 1280, 1288, 1296, 1290,    0,  655, 1337, 1123, 1284,
+
+     1289, 1108, 1115, 1299, 1121, 1346, 1123, 1347, 1117,    0,
+        0,  889, 1145, 1308, 1309, 1303, 1292, 1310, 1313, 1312,
+     1311, 1312, 1305,  759, 1358, 1354, 1320, 1303, 1302, 1312,
+     1309, 1325, 1323, 1327, 1314, 1328, 1330, 1323, 1309, 1315,
+     1330, 1331, 1335, 1334, 1328, 1320, 1340,    0, 1337, 1342,
+     1325, 1326, 1380, 1329, 1341, 1346,  931, 1344, 1385, 1332,
+     1336, 1349, 1389, 1336, 1396, 1333, 1350, 1023, 1342, 1350,
+     1361, 1344, 1344, 1346, 1354, 1347, 1348, 1357, 1349, 1410,
+     1368, 1369, 1365,  385, 1374, 1371, 1365, 1357, 1374, 1375,
+     1372, 1378, 1098, 1378, 1366, 1374, 1383, 1367, 1370, 1375,
+
+     1374, 1375, 1426, 1373, 1389, 1390, 1435, 1396, 1143, 1389,
+     1128,    0,    0, 1394,    0,    0, 1379,  904, 1099, 1115,
+     1383,  796, 1130, 1441, 1394, 1123,    0, 1443,    0, 1439,
+      942,    0, 1403, 1382, 1383, 1394, 1444, 1390, 1409, 1392,
+     1400, 1454, 1411, 1408, 1413, 1410, 1114,    0, 1414, 1460,
+     1456, 1416, 1415, 1153, 1423, 1465, 1425, 1462, 1417, 1414,
+     1413, 1466, 1425, 1468, 1417, 1435, 1471, 1419,  833, 1435,
+     1422, 1437, 1426, 1438,  982, 1443, 1440, 1438,  986, 1438,
+     1443, 1440, 1428, 1442, 1440, 1492, 1128, 1488,    0, 1489,
+     1441, 1442, 1443, 1438, 1442, 1456, 1449, 1440, 1459, 1456,
+
+     1153, 1505, 1460, 1459, 1464,    0, 1465, 1456, 1458, 1472,
+     1103, 1449, 1452, 1475, 1133, 1459, 1512, 1459, 1475, 1480,
+     1477, 1465, 1479, 1480, 1481, 1478, 1483, 1484, 1485, 1486,
+     1125, 1531, 1492, 1533,    0, 1477, 1478, 1182, 1493,    0,
+        0, 1494,  957, 1485, 1479, 1139, 1486, 1541, 1542, 1500,
+     1544,    0, 1492, 1546,    0,  772,  655, 1507, 1490, 1549,
+     1493, 1506, 1501, 1505, 1506, 1496,    0, 1503, 1511, 1516,
+     1501, 1518, 1507, 1508,    0,  806, 1512, 1511, 1024, 1511,
+     1515,    0, 1519, 1526, 1525, 1512, 1527, 1524, 1184, 1522,
+     1534, 1524, 1519, 1572,    0, 1521, 1539, 1575, 1538, 1537,
+
+     1540, 1544, 1580, 1532, 1534, 1534, 1532, 1533, 1534, 1587,
+     1533, 1132, 1554, 1530, 1539, 1546, 1558, 1594, 1600,    0,
+     1547, 1545, 1545, 1556, 1552, 1561, 1547, 1549, 1561, 1551,
+     1567, 1558, 1556, 1556,    0, 1615,    0, 1559, 1572, 1613,
+     1560, 1567, 1578, 1574, 1570, 1581, 1625, 1621, 1585, 1570,
+     1572, 1569, 1591, 1568, 1576, 1583, 1578, 1588, 1594, 1579,
+     1639, 1582, 1636, 1583, 1586, 1587, 1601, 1592,    0, 1604,
+        0, 1595, 1595,    0, 1608, 1646, 1608,  995, 1594, 1613,
+     1655, 1605,    0,    0, 1604,    0, 1612,    0, 1158, 1159,
+     1600, 1655,    0, 1613, 1614, 1623, 1605, 1606, 1661, 1608,
+
+     1663, 1610, 1611, 1612, 1621, 1616, 1630, 1614, 1616, 1633,
+     1634, 1635, 1636, 1638, 1622, 1629, 1672, 1641, 1635, 1636,
+     1683, 1629, 1647, 1648,    0, 1635, 1649, 1635, 1695, 1652,
+     1646, 1654, 1647, 1657, 1644, 1662, 1646, 1662, 1148, 1648,
+     1647, 1664, 1660, 1645, 1652, 1669, 1668, 1671, 1652, 1664,
+     1672, 1717, 1674, 1668, 1661,    0, 1664, 1668, 1679, 1679,
+     1720, 1721, 1674, 1155, 1685, 1724, 1671, 1674, 1679, 1674,
+        0, 1690, 1671, 1677, 1693, 1687, 1734, 1688, 1697, 1737,
+        0, 1684, 1700, 1686, 1702, 1707, 1690, 1744, 1745, 1746,
+     1747, 1694, 1749, 1750,    0, 1697, 1713, 1192, 1716, 1717,
+
+     1716, 1718, 1757, 1719, 1704, 1711, 1715,    0, 1723, 1715,
+        0, 1764, 1712, 1771, 1162, 1174, 1718, 1715, 1715, 1724,
+     1717, 1713, 1773, 1154, 1779, 1041, 1775, 1737, 1777, 1778,
+     1732, 1732, 1742, 1747, 1733, 1736, 1729, 1786, 1739, 1749,
+     1752, 1790, 1753, 1749, 1750, 1029, 1748, 1795, 1801, 1758,
+     1763, 1760,    0, 1763, 1758, 1749, 1764, 1769, 1766, 1769,
+     1768, 1769, 1767, 1775, 1764, 1773, 1774, 1760, 1820, 1821,
+     1771, 1763, 1147, 1819, 1777, 1826,    0, 1827, 1780, 1782,
+     1778, 1772, 1775, 1828, 1164, 1779, 1792,    0, 1782, 1793,
+     1782, 1795, 1797, 1841, 1842, 1785, 1796, 1781, 1804, 1783,
+
+     1789, 1844, 1808, 1792, 1804, 1848, 1849, 1850, 1797, 1852,
+     1816, 1158, 1817, 1013, 1796, 1808, 1155, 1814, 1800,    0,
+     1864, 1821, 1822, 1812, 1824, 1814, 1827, 1812, 1819, 1825,
+     1817, 1831, 1836, 1877,    0, 1873, 1175, 1822, 1836, 1841,
+     1838, 1839, 1884, 1837, 1835, 1844,    0, 1834, 1849, 1846,
+     1832, 1839, 1838, 1836, 1855, 1852, 1840, 1847, 1848, 1857,
+     1857, 1847, 1845, 1844, 1855, 1851, 1907, 1849, 1865, 1850,
+     1851, 1857, 1873, 1863,    0, 1873, 1858, 1874, 1867, 1878,
+     1876, 1210, 1862, 1864, 1879, 1866, 1925, 1882, 1868, 1888,
+     1872, 1930, 1887,    0,    0, 1884, 1889, 1894, 1882, 1892,
+
+     1894,    0,    0, 1895, 1882, 1900, 1887, 1881, 1886, 1887,
+     1179, 1891, 1941, 1892, 1943, 1889, 1893, 1951,    0,    0,
+     1896, 1900, 1899, 1896, 1956, 1909, 1899, 1900, 1896, 1909,
+     1920, 1904, 1922, 1917, 1918, 1920, 1913, 1915, 1916, 1917,
+     1917, 1919, 1934, 1975, 1932, 1937, 1914, 1937, 1921,    0,
+     1928, 1929, 1943, 1933, 1931, 1981, 1939, 1929, 1944, 1945,
+     1932, 1946,    0, 1181, 1196, 1993, 1941, 1936, 1991, 1992,
+        0, 1955, 1959, 2000, 1948, 1943, 1944, 1956, 1963, 1952,
+     1953, 1949, 1952, 1953, 1963, 1972, 2008, 1963, 1958, 2016,
+     1973, 1974, 1965,    0, 1956, 1968, 1971, 1979, 1981, 1966,
+
+     1982, 1976, 1984, 2024, 1990, 1974, 1975,    0, 1991, 1994,
+     1977, 1220, 1978,    0, 1995, 1998, 1980, 1979,    0, 2036,
+     1998, 2038, 1996, 1992, 1989, 2042, 2043, 2005, 1991, 2009,
+     2008, 2009, 2010, 1996, 2011, 2003, 2010, 2000, 1182, 2016,
+     2003,    0, 2011, 2017, 2020, 2065,    0, 2014, 2019, 2063,
+     2014, 2026, 2020, 2024, 2022, 2020, 2022, 2032, 2077, 2021,
+     2026, 2022, 2081, 2025, 2037,    0, 2025, 2033, 2031, 2082,
+     2044, 2030, 2031, 2040, 2052, 2039, 2037, 2042, 2052, 2053,
+     2058, 2099, 2056, 1193, 1199,    0, 2058, 2054, 2050, 2045,
+     2105, 2048,    0, 2048, 2068, 2067, 2058, 2047, 2064, 2071,
+
+     2114, 2075, 2068, 2072, 2076, 2059, 2120, 2067,    0, 2117,
+     2064, 2067, 2125, 2067, 2068, 2068, 2089, 2086, 2091, 2092,
+     2128, 2079, 2087, 2096, 2076, 2091, 2098, 2140,    0, 1226,
+     1227, 2091, 2101, 2143, 2104, 2088, 2093, 2089, 2096, 2105,
+     2093, 2100, 2101, 2113, 2154, 2101, 2099, 2101, 2105, 2119,
+     2160, 2110, 2109, 2115, 2113, 2111, 2106, 2167, 2168, 2164,
+     2170,    0, 2127, 2120, 2111, 2130, 2118, 2128, 2125, 2130,
+     2126, 2139, 2139,    0, 2123, 2125, 2125,    0, 2126, 2186,
+     2125, 2144, 2145, 2147, 2138, 2192, 2193, 2146, 2131, 2145,
+     2153, 2152, 2136, 2141, 2159,    0, 2149, 1207, 1198, 2203,
+
+     2143, 2165, 2162,    0, 2149, 2151, 2168, 2163, 2167, 2212,
+     2160, 2164,    0, 2156, 2173, 2153, 2174, 2164,    0, 2179,
+     2179, 2217, 2164,    0, 2219, 2177, 2182, 2168, 2228, 2171,
+     2182, 2183, 2175, 2181, 2177, 2195, 2196, 2197,    0,    0,
+     2196,    0, 2181, 2182, 2201,    0, 2191, 2203, 2185, 2197,
+     2241, 2205, 2194, 2201, 2202, 2208,    0, 2201, 2253, 2194,
+     2215, 2256,    0, 2257, 2199, 2205, 2212, 2256, 2218,    0,
+        0, 2205,    0, 2207, 2221, 2226, 2209, 2268, 2225, 2226,
+     2227, 1225, 2218, 2223, 2274, 2227, 2223, 2277,    0, 2224,
+     2279, 2280, 2237, 2239,    0,    0, 2222, 2284, 2280, 2244,
+
+     2287, 2229, 2241, 2246, 2232, 1202, 2292,    0, 2249, 2242,
+     2251, 1237, 2242, 2257, 2293, 2245,    0, 2241, 2257, 2258,
+     2259, 2256, 2300, 2263, 2267, 2254, 2250, 2310, 2263, 2307,
+     2313, 2270,    0, 2271, 2264, 2264, 2274, 2275, 2272, 2262,
+     2265, 2265, 2270, 2325, 2326, 2269, 2328, 2270, 2325, 2266,
+     1183, 2273, 2276, 2289, 2290, 2288, 2337,    0, 2290, 2339,
+        0,    0, 2296, 2288, 2298, 2283, 2339, 2285, 2346, 2290,
+     2300, 2349,    0, 2297, 2297, 2299, 2301, 2354, 2295, 2298,
+        0, 2299, 2318,    0, 2302,    0,    0, 2315, 2317, 2318,
+        0, 2305, 2313,    0, 2365, 2314, 1238, 2367, 1218,    0,
+
+     2368, 2325, 2365,    0, 2313, 2321, 2315, 2312, 2315, 2318,
+     2318, 2335, 2374, 2327, 2339, 2342, 2324, 2331, 2321,    0,
+     2343, 2328,    0, 2330, 2331, 2346, 2348, 2347, 2350, 2350,
+     2347, 2391, 2353, 2345,    0,    0, 2355,    0, 2356, 2353,
+     2358, 2359, 2356, 2400, 2348, 2363, 2364, 2356,    0, 2353,
+        0, 2354, 2354, 2360, 2359, 2357, 2371,    0, 2412, 2359,
+        0, 2360, 2360, 2362, 2368,    0, 2370, 2424, 2366, 2374,
+     2377, 2388, 2386, 2430, 2383, 2392,    0, 2389,    0, 2386,
+        0, 1215,    0, 2435, 2377, 2437, 2438, 2395, 2400, 2382,
+     2442, 2443, 2439, 1202, 2399, 2395, 2388, 2400, 2390, 2395,
+
+     2451, 2405, 2453, 2449, 2412, 2412, 2409, 2453, 2401, 2406,
+     1188, 1247, 2416, 2462, 2463, 2421, 2465, 2426, 2415, 2409,
+     2469, 2411, 2412, 2426, 2429, 2429, 2475, 2417, 2434, 2430,
+     2434, 2418, 2476, 2477, 2424, 2479, 2442, 2443,    0, 2443,
+     2444, 2431, 2430, 2486,    0, 2427, 2445, 2494, 2452, 1217,
+        0, 2448,    0,    0, 2439, 2450, 2499,    0,    0, 2445,
+     2450, 2448, 2498, 2456, 2461, 2452, 2450, 2464,    0, 2452,
+        0, 2455, 2506, 2449, 2450, 2455, 2515, 2463, 2473, 2474,
+        0, 2519, 2472,    0,    0, 2521,    0, 2464, 2479, 2467,
+        0, 2477, 2478, 2527, 2485, 2489,    0, 2525, 2491, 2467,
+
+     2485, 2494, 2476, 2483, 2537, 2496, 2495, 2540, 2488, 2542,
+     2543, 2493, 2497, 2502, 2495,    0, 2548, 2549, 2498, 2551,
+     2493,    0, 2496, 2506, 2550, 2498, 2513, 2500, 2506, 2506,
+     2561, 2518, 2506, 2505, 2565, 2566, 2519,    0, 2563, 2514,
+     2511,    0, 2525,    0, 2528, 2573, 2526, 2523, 2524,    0,
+     2577, 2536, 2519, 2521, 2537, 2519, 2535, 2536, 2545,    0,
+     2535, 2587,    0, 2546,    0,    0, 2530, 2537, 2591, 2587,
+        0,    0, 2549,    0, 2589, 2551, 2552, 2537, 2538, 2546,
+     2600, 2596, 2551,    0, 2563, 2550, 2557,    0,    0, 2554,
+     2559, 2557, 2609, 2610, 2553,    0, 2568, 2569, 2570,    0,
+
+     2571, 2561, 2573, 2618, 2619, 2561, 2569, 2570, 2583,    0,
+     2560, 2620, 2581,    0, 2585, 2570, 2570, 2585, 2578, 2577,
+     2588, 2575,    0, 2580, 2636, 2594, 2596, 2587, 2596, 2598,
+     2602,    0,    0, 2643, 2586, 2645, 2646, 2647, 2605, 2649,
+        0,    0, 2645, 2607, 2608, 2595, 2654, 2597, 2602, 2593,
+     2658, 2611, 2612, 2602, 2619, 2618, 2659, 2621,    0, 2618,
+     2623, 2624, 2669, 2626, 2629,    0, 2672,    0,    0,    0,
+     2633,    0, 2615, 2675, 2676, 2619,    0, 2638, 2679, 2638,
+        0, 2629, 2619, 2678, 2644, 2637, 2633, 2630, 2635, 2631,
+     2633,    0, 2638, 2648,    0, 2634, 2646,    0,    0, 2651,
+
+     2644,    0, 2646, 2654, 2699, 2640, 2642, 2639, 2663, 2656,
+     2659, 2648, 2702, 2649, 2657, 2666, 2659, 2654, 2658, 2670,
+     2715,    0, 2661, 2673, 2718, 2667, 2666, 2721, 2674, 2661,
+     2676, 2681, 2726, 2683, 2728, 2678, 2672,    0, 2688, 2732,
+        0, 2689, 2691,    0, 2682, 2696, 2692, 2685,    0, 2739,
+        0, 2696, 2741, 2702,    0, 2743, 2744, 2699, 2698, 2699,
+     2689,    0, 2744,    0, 2691,    0,    0, 2751, 2693, 2709,
+     2754, 1214, 2711,    0, 2751, 2700,    0, 2712, 2705, 2760,
+     2702, 2704, 2719, 2704,    0, 2717, 2766, 2767, 2715, 2717,
+        0,    0, 2711, 2727, 2772, 2773,    0,    0,    1
+
     } ;
 
-static const flex_int16_t yy_def[1851] =
+static const flex_int16_t yy_def[1900] =
     {   0,
-     1839, 1839, 1840, 1840, 1839, 1839, 1839, 1839, 1839, 1839,
-     1838, 1838, 1838, 1838, 1838, 1841, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1842,
-     1838, 1838, 1838, 1843,   15, 1838,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1844,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1841,
-     1838, 1838, 1838, 1838, 1838, 1838, 1845, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1842, 1838,
-
-     1843, 1838, 1838,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1846,   45, 1844,   45,   45,
+     1899,    1,    1,    3,    7,    5,    1,    7,    7,    9,
+     1899, 1899, 1899, 1899, 1899, 1899,   20, 1899,   17, 1899,
+     1899,   19, 1899, 1899,   89, 1899, 1899, 1899, 1899, 1899,
+       26,   27,   28, 1899, 1899, 1899,   13, 1899, 1899, 1899,
+     1899,   13,   14,  578,   15, 1899,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,  457,   48,   45,
+       45,   45,   45,   51,   45,   45,   45,   45,   45,   45,
+       54,   45,   45,   45,   45,   45,   55,   56,   45,   16,
+       20,   17,   25,   19,   20, 1899, 1899, 1899, 1899,   89,
+     1899, 1899, 1899,   91,   92,   93, 1899, 1899,   40, 1899,
+
+       44, 1899, 1899,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1899,   45,  457,  105,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  111,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1845, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1847,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  112,
+       45,   45,   45,  114,   45,   45,   45,   87, 1899, 1899,
+     1899,  189,  190,  191, 1899, 1899, 1899,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   45, 1846, 1838,
-     1844,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  116,
+     1899,  457,   45,  199,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1838,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1848,   45,   45,   45,   45,   45,
-       45,   45,   45, 1838,   45, 1838,   45, 1844, 1838,   45,
+       45,   45,  206,   45,   45,   45,   45,   45,   45,   45,
+     1899, 1899, 1899,  311, 1899, 1899, 1899, 1899,   45,   45,
+       45,   45,   45,   45,   45,   45, 1899,   45, 1899,   45,
+      457, 1899,   45,  320,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1838,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1838,
 
+       45,   45,   45,   45,   45, 1899,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1838,   45,
-       45,   45,   45, 1838, 1838, 1838, 1849,   45,   45,   45,
-       45,   45,   45,   45,   45, 1838,   45,   45, 1838,   45,
-     1844,   45,   45,   45,   45,   45,   45,   45,   45, 1838,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
-       45,   45,   45,   45, 1838,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1838,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45, 1899,
+     1899, 1899, 1899,   45,   45,   45,   45,   45,   45,   45,
+       45, 1899,   45,   45, 1899,   45,   45,   45,  446,   45,
+       45,   45,   45,   45,   45,   45, 1899,   45,   45,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
+       45, 1899,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1838,   45, 1838,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1899,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1838,   45, 1838,   45,
-       45, 1838,   45,   45, 1838, 1850,   45,   45,   45,   45,
-     1838, 1838,   45, 1838,   45, 1838,   45,   45,   45, 1838,
+       45,   45,   45,   45, 1899,   45, 1899,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
+     1899,   45,   45, 1899,   45,   45, 1899, 1899,   45,   45,
+       45,   45, 1899, 1899,   45, 1899,   45, 1899,   45,   45,
+       45,  581, 1899,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1838,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1838,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1838,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1838,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1838,
-       45,   45, 1838,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1899,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1899,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1899,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
+     1899,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1838,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1838,   45,   45,   45,   45,
-
+       45,   45,   45,   45,   45,   45, 1899,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1838,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45,   45,   45,   45,
+
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1838,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1899,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1838, 1838,   45,   45,   45,   45,   45,
-       45, 1838, 1838,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838, 1838,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1899,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1838,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45,   45, 1838,   45,
+       45,   45,   45, 1899, 1899,   45,   45,   45,   45,   45,
+
+       45, 1899, 1899,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899, 1899,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45, 1838,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1899,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
+     1899,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1899,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45, 1838,   45,   45,   45,   45, 1838,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
+       45,   45,   45, 1899,   45,   45,   45,   45, 1899,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1838,
+       45, 1899,   45,   45,   45,   45, 1899,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
+       45,   45,   45,   45,   45, 1899,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1899,   45,   45,   45,   45,
+       45,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
 
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1838,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45,   45,   45, 1838,
-       45,   45,   45,   45,   45,   45,   45,   45, 1838,   45,
-       45,   45,   45,   45, 1838,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1838, 1838,   45, 1838,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45, 1838,   45,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45,   45,
-     1838, 1838,   45, 1838,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1838,
-       45,   45,   45,   45,   45, 1838, 1838,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1838,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45,   45,
+       45, 1899,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1899,   45,   45,   45, 1899,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45, 1838,   45, 1838, 1838,
+       45,   45,   45,   45,   45, 1899,   45,   45,   45,   45,
+
+       45,   45,   45, 1899,   45,   45,   45,   45,   45,   45,
+       45,   45, 1899,   45,   45,   45,   45,   45, 1899,   45,
+       45,   45,   45, 1899,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899, 1899,
+       45, 1899,   45,   45,   45, 1899,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1899,   45,   45,   45,
+       45,   45, 1899,   45,   45,   45,   45,   45,   45, 1899,
+     1899,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
+       45,   45,   45,   45, 1899, 1899,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
+       45,   45,   45,   45,   45,   45, 1899,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1838,   45,   45,   45,   45,   45,   45,   45, 1838,   45,
-       45, 1838,   45, 1838, 1838,   45,   45,   45, 1838,   45,
-       45, 1838,   45,   45,   45,   45,   45, 1838,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
-     1838,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838, 1838,   45, 1838,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1838,   45,   45,   45,   45,   45,
-
-       45,   45, 1838,   45,   45, 1838,   45,   45,   45,   45,
-     1838,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45, 1838,   45, 1838,   45, 1838,   45,   45,
+       45,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
+     1899, 1899,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
+     1899,   45,   45, 1899,   45, 1899, 1899,   45,   45,   45,
+     1899,   45,   45, 1899,   45,   45,   45,   45,   45, 1899,
+
+       45,   45,   45, 1899,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1899,
+       45,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1899, 1899,   45, 1899,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
+     1899,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
+     1899,   45,   45,   45,   45, 1899,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1899,   45, 1899,   45,
+     1899,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45, 1838,   45,   45,
-       45,   45,   45, 1838,   45, 1838, 1838,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
+     1899,   45, 1899, 1899,   45,   45,   45, 1899, 1899,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
+     1899,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1899,   45,   45, 1899, 1899,   45, 1899,   45,   45,   45,
+     1899,   45,   45,   45,   45,   45, 1899,   45,   45,   45,
 
-     1838, 1838,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45, 1838,   45,   45,   45,   45,   45,   45,
-       45,   45, 1838,   45,   45, 1838,   45, 1838,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45, 1838,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1838,   45,   45,   45,
-       45,   45, 1838,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
-       45, 1838,   45, 1838,   45,   45,   45,   45,   45, 1838,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1838,
-
-       45,   45, 1838,   45, 1838, 1838,   45,   45,   45,   45,
-     1838, 1838,   45, 1838,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1838,   45,   45,   45, 1838,   45,   45,
-       45,   45,   45,   45, 1838,   45,   45,   45, 1838,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1838,   45,
-       45,   45, 1838,   45,   45,   45,   45,   45,   45,   45,
-       45, 1838,   45,   45,   45,   45,   45,   45,   45,   45,
-     1838, 1838,   45,   45,   45,   45,   45,   45,   45, 1838,
-     1838,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1838,   45,   45,
-
-       45,   45,   45,   45, 1838,   45, 1838, 1838, 1838,   45,
-     1838,   45,   45,   45,   45, 1838,   45,   45,   45, 1838,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1838,   45,   45, 1838,   45,   45, 1838, 1838,   45,   45,
-     1838,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1899,   45,   45,   45,   45,
+       45, 1899,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
+       45, 1899,   45, 1899,   45,   45,   45,   45,   45, 1899,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1899,
+       45,   45, 1899,   45, 1899, 1899,   45,   45,   45,   45,
+     1899, 1899,   45, 1899,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1899,   45,   45,   45, 1899, 1899,   45,
+       45,   45,   45,   45,   45, 1899,   45,   45,   45, 1899,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1899,
+       45,   45,   45, 1899,   45,   45,   45,   45,   45,   45,
+       45,   45, 1899,   45,   45,   45,   45,   45,   45,   45,
+       45, 1899, 1899,   45,   45,   45,   45,   45,   45,   45,
+     1899, 1899,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1899,   45,
+       45,   45,   45,   45,   45, 1899,   45, 1899, 1899, 1899,
+       45, 1899,   45,   45,   45,   45, 1899,   45,   45,   45,
+     1899,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1899,   45,   45, 1899,   45,   45, 1899, 1899,   45,
+
+       45, 1899,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1838,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1838,   45,   45, 1838,
-       45,   45, 1838,   45,   45,   45,   45, 1838,   45, 1838,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45,   45,
-
-     1838,   45, 1838,   45, 1838, 1838,   45,   45,   45,   45,
-       45,   45, 1838,   45,   45, 1838,   45,   45,   45,   45,
-       45,   45,   45, 1838,   45,   45,   45,   45,   45, 1838,
-     1838,   45,   45,   45,   45, 1838, 1838,    0, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838
+       45, 1899,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1899,   45,   45,
+     1899,   45,   45, 1899,   45,   45,   45,   45, 1899,   45,
+     1899,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
+       45, 1899,   45, 1899,   45, 1899, 1899,   45,   45,   45,
+       45,   45,   45, 1899,   45,   45, 1899,   45,   45,   45,
+       45,   45,   45,   45, 1899,   45,   45,   45,   45,   45,
+     1899, 1899,   45,   45,   45,   45, 1899, 1899,    0
+
     } ;
 
-static const flex_int16_t yy_nxt[2314] =
+static const flex_int16_t yy_nxt[2847] =
     {   0,
-     1838,   13,   14,   13, 1838,   15,   16, 1838,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       86,  764,   37,   14,   37,   87,   25,   26,   38,  102,
-     1838,   27,   37,   14,   37,   42,   28,   42,   38,   92,
-       93,   29,  202,   30,   13,   14,   13,   91,   92,   25,
-       31,   93,   13,   14,   13,   13,   14,   13,   32,   40,
-      765,   13,   14,   13,   33,   40,  103,   92,   93,  202,
-       91,   34,   35,   13,   14,   13,   95,   15,   16,   96,
-       17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   91,   39,  105,   25,   26,
-
-       13,   14,   13,   27,   39,   42,  108,   42,   28,   42,
-      109,   42,   41,   29,  111,   30,  114,  115,   94,  141,
-       41,   25,   31,  105,  228,  229,   89,  142,   89,  108,
-       32,   90,   90,   90,   90,   90,   33,  111,  109,  114,
-      234,  115,  235,   34,   35,   44,   44,   44,   45,   45,
-       46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   45,   45,   45,   45,   48,   45,   49,
-       50,   45,   51,   45,   52,   53,   54,   45,   45,   45,
-       45,   55,   56,   45,   57,   45,   45,   58,   45,   45,
-       59,   60,   61,   62,   63,   64,   65,   66,   67,   52,
-
-       68,   69,   70,   71,   72,   73,   74,   75,   76,   77,
-       78,   79,   57,   45,   45,   45,   45,   45,   81,  835,
-       82,   82,   82,   82,   82,   81,  105,   84,   84,   84,
-       84,   84,  108,   83,   85,   85,   85,   85,   85,   81,
-       83,   84,   84,   84,   84,   84,  188,   83,  287,  288,
-      112,  123,  119,  135,   83,  108,   83,  190,  120,  124,
-      113,  121,  125,   83,  136,  126,  138,  127,  139,  128,
-       83,  143,  188,  112,  137,  140,  164,   83,   45,  189,
-      165,  144,  836,  145,   45,  190,   45,   45,  113,   45,
-      166,   45,   45,   45,  221,  117,  147,  148,   45,   45,
-
-      149,   45,   45,  222,  223,  189,  150,   45,   45,   45,
+       11, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899,   12,   13,   14,   13,   12,   15,
+       16,   12,   17,   18,   19,   20,   21,   22,   22,   22,
+       22,   22,   23,   24,   12,   12,   12,   12,   12,   12,
+
+       25,   26,   12,   12,   12,   27,   12,   12,   12,   12,
+       28,   12,   12,   12,   12,   29,   12,   30,   12,   12,
+       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
+       12,   12,   32,   12,   12,   12,   12,   12,   33,   12,
+       12,   12,   12,   12,   12,   34,   35,   44,   44,   44,
+       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   47,   45,   45,   45,   45,   45,   48,
+       45,   49,   50,   45,   51,   45,   52,   53,   54,   45,
+       45,   45,   45,   55,   56,   45,   57,   45,   45,   58,
+       45,   45,   59,   60,   61,   62,   63,   64,   65,   66,
+
+       67,   52,   68,   69,   70,   71,   72,   73,   74,   75,
+       76,   77,   78,   79,   57,   45,   45,   45,   45,   45,
+       36,   37, 1899,   37,   36,   36,   36,   38,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   80,   80,   43,   80,   80,   80,   80,
+
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,  188,  188,   88,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,  188,
+      188,  188,  188,  188,  188,  188,  188,  188,  188,   99,
+       99,  410,   99,   99,  411,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,  210,  210,  211,  210,  210,  210,  210,  210,
+      210,  210,  210,  210,  210,  210,  210,  210,  210,  210,
+      210,  210,  210,  210,  210,  210,  210,  210,  210,  210,
+      210,  210,  210,  210,  210,  210,  210,  210,  210,  210,
+      210,  210,  210,  210,  210,  210,  210,  210,  210,  210,
+      210,  210,  210,  210,  210,  210,  210,  210,  210,  210,
+      210,  210,  210,  210,  210,  210,  210,  210,  210,  210,
+      210,  210,  101,  101,  101,  101,  101,  102,  101,  101,
+      101,  101,  101,  101,  101,  212,  212,  212,  212,  212,
+
+      101,  101,  101,  101,  212,  212,  212,  212,  212,  212,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  103,  101,  101,  212,  212,  212,
+      212,  212,  212,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  318,  318,
+      318,  318,  318,  116,  116,  116,  116,  318,  318,  318,
+      318,  318,  318,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+
+      318,  318,  318,  318,  318,  318,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,   45,   84,
+       84,   84,   84,   84,   45,   86,   45,   45,  119,   45,
+       87,   45,   45,   45,  120,  229,  230,  121,   45,   45,
+       81,   45,   82,   82,   82,   82,   82,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-      129,  168,   45,  130,  131,  169,   45,  132,  133,  151,
-       45,  111,  217,  152,  295,  188,  218,  153,   45,  189,
-      134,  324,   45,  114,   45,  118,  425,  159,  296,  154,
-      156,  201,  157,  155,  158,  160,  190,  161,  177,  178,
-      170,  191,  162,  163,  171,  192,  183,  172,  112,   85,
-       85,   85,   85,   85,  173,  174,  184,  201,  113,  175,
-      176,  185,   83,   81,  193,   82,   82,   82,   82,   82,
-
-      253,  179,  837,  180,  254,   89,  181,   89,   83,  102,
-       90,   90,   90,   90,   90,   83,  113,   85,   85,   85,
-       85,   85,   81,  182,   84,   84,   84,   84,   84,  198,
-       83,   83,   90,   90,   90,   90,   90,   83,   90,   90,
-       90,   90,   90,  101,  204,  206,  103,  205,  207,  237,
-      101,  198,  241,   83,  208,  242,  838,  198,  275,  243,
-       83,  204,  276,  414,  310,  238,  267,  272,  212,  309,
-      273,  274,  204,  206,  205,  207,  415,  208,  310,  213,
-      101,  268,  269,  270,  101,  205,  289,  310,  101,  204,
-      290,  261,  207,  308,  291,  309,  101,  278,  308,  309,
-
-      101,  313,  101,  196,  211,  211,  211,  211,  211,  431,
-      438,  839,  300,  211,  211,  211,  211,  211,  211,  304,
-      439,  308,  321,  317,  320,  312,  311,  327,  323,  373,
-      325,  533,  279,  280,  281,  534,  211,  211,  211,  211,
-      211,  211,  840,  282,  386,  283,  317,  284,  285,  321,
-      286,  323,  320,  325,  327,  328,  328,  328,  328,  328,
-      317,  432,  340,  434,  328,  328,  328,  328,  328,  328,
-      341,  404,  434,  440,  405,  342,  343,  445,  448,  523,
-      387,  465,  374,  330,  440,  375,  434,  328,  328,  328,
-      328,  328,  328,  472,  388,  435,  442,  443,  466,  473,
-
-      445,  841,  440,  842,  509,  444,  448,  451,  451,  451,
-      451,  451,  555,  452,  510,  556,  451,  451,  451,  451,
-      451,  451,  486,  499,  500,  538,  562,  487,  501,  539,
-      569,  563,  577,  843,  578,  569,  698,  524,  594,  451,
-      451,  451,  451,  451,  451,  630,  595,  601,  596,  597,
-      598,  611,  697,  742,  743,  631,  612,  796,  569,  577,
-      602,  578,  603,  579,  698,  693,  813,  820,  797,  812,
-      699,  823,  824,  821,  825,  488,  847,  848,  849,  697,
-      489,   45,   45,   45,   45,   45,  850,  851,  852,  813,
-       45,   45,   45,   45,   45,   45,  844,  812,  853,  854,
-
-      845,  855,  856,  857,  846,  858,  859,  860,  861,  862,
-      863,  864,  865,   45,   45,   45,   45,   45,   45,  866,
-      867,  868,  870,  871,  869,  872,  873,  874,  875,  876,
-      877,  878,  879,  880,  881,  882,  883,  884,  885,  886,
-      887,  888,  889,  890,  891,  892,  893,  894,  895,  896,
-      897,  898,  899,  900,  901,  902,  903,  904,  905,  906,
-      908,  909,  910,  913,  914,  915,  907,  917,  918,  911,
-      919,  916,  920,  912,  921,  922,  923,  924,  925,  926,
-      927,  928,  929,  930,  931,  932,  933,  934,  935,  936,
-      937,  938,  939,  940,  941,  942,  943,  944,  945,  946,
-
-      947,  948,  949,  950,  951,  952,  953,  954,  955,  956,
-      957,  958,  959,  960,  961,  934,  962,  963,  964,  965,
-      966,  967,  968,  969,  970,  971,  972,  973,  974,  976,
-      977,  978,  979,  975,  980,  981,  982,  983,  984,  985,
-      986,  987,  988,  989,  990,  991,  992,  993,  994,  995,
-      996,  998,  999, 1000,  997, 1001, 1002, 1003, 1004, 1005,
-     1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
-     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
-     1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035,
+       40,   12,   92,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   85,   85,   85,   85,   85,
+
+      171,   12,   12,  589,  172,  590,   12,  173,   83,  344,
+       92,   12,  448,  449,  174,  175,   12,  345,   12,  176,
+      177,  450,  346,  347,   12,   12,  123,  142,   93,  101,
+      589,   83,  590,   12,  124,  143,  101,  125,  495,   12,
+      126,  117,  127,  496,  128,  222,   12,   12,   45,  116,
+      116,  116,  116,  116,  223,  224,   93,  607,  116,  116,
+      116,  116,  116,  116,  105,  608,  101,  609,  610,  611,
+      101,   42,  129,   42,  101,  130,  131,   12,   45,  132,
+      133,  116,  101,  116,  116,  116,  101,  112,  101,  197,
+      105,  497,  134,   41,   45,  165,  498,  113,   45,  166,
+
+       45,  118,  331,  331,  331,  331,  331,  178,  179,  167,
+      112,  331,  331,  331,  331,  331,  331,  443,  443,  443,
+      443,  443,  135,  233,   91,  113,  443,  443,  443,  443,
+      443,  443,  234,  136,  331,  331,  331,  331,  331,  331,
+      180,  379,  181,  137,  157,  182,  158,   91,  159,  443,
+      443,  443,  443,  443,  443,  457,  457,  457,  457,  457,
+      270,   89,  183,   89,  457,  457,  457,  457,  457,  457,
+      578,  578,  578,  578,  578,  271,  272,  273,  281,  578,
+      578,  578,  578,  578,  578,  160,  144,  457,  457,  457,
+      457,  457,  457,  161,  380,  162,  145,  381,  146,  109,
+
+      163,  164,  578,  578,  578,  578,  578,  578,  101,  101,
+      101,  101,  101,  282,  283,  284,  140,  101,  101,  101,
+      101,  101,  101,  141,  285,   94,  286,  109,  287,  288,
+      152,  289,  504,  392,  153,  505,  184,   95,  154,  506,
+      101,  101,  101,  101,  101,  101,  185,  511,  512,  507,
+      155,  186,  513,   12,  156,   90,   90,   90,   90,   90,
+      148,  149,   96,  169,  150,  940,  941,  170,  244,  393,
+      151,  245,  614,  942,  292,  246,  275,  943,  293,  276,
+      277,  108,  294,  394,  111,  615,  870,  616,  848,  849,
+      871,  850,  114,  115,  872,  189,  138,  190,  191,  199,
+
+      205,   39,  139,  202,  108,  203,  206,  111,  207,  213,
+      208,  209,  218,  311,  239,  114,  219,  115,  290,  291,
+      214,  189,  236,  190,  237,  298,  191,  199,  205,  202,
+      240,  256,  203,  206,  209,  257,  207,  208,  278,  299,
+      312,  311,  279,  323,  313,  320,  324,  326,  330,  328,
+      332,  420,  444,  437,  440,  446,  451,  454,  535,  472,
+      788,  545,  445,  479,  421,  546,  312,  313,  320,  480,
+      326,  323,  328,  324,  581,  330,  473,  440,  521,  451,
+      567,  648,  550,  568,  446,  454,  551,  574,  522,  625,
+      715,  649,  575,  716,  626,  763,  764,  820,  836,  789,
+
+      837,  845,  581,  898,  333,  438,  899,  846,  821,  910,
+      965,  937,  911,  946, 1084, 1008,  536,  715,  938,  947,
+     1009,  716, 1085,  837, 1034, 1129,  836, 1198, 1035, 1155,
+     1199, 1240, 1242, 1306, 1307, 1377, 1241, 1399,  965, 1442,
+     1156, 1084, 1404, 1479, 1482, 1085, 1550, 1443, 1480, 1561,
+     1579, 1580, 1581, 1618,   97, 1198, 1306, 1199,   98, 1878,
+     1562, 1879, 1307,  100,  104, 1399,  106, 1482,  107,  110,
+      122,  147,  168, 1550,  187,  192, 1243,  193,  194,  195,
+      196, 1618,  198, 1130,  200,  201, 1405,  204, 1378,  215,
+      216,  217,  220,  221,  225,  226,  227,  228,  231,  232,
+
+      235,  238,  241,  242,  243,  247,  248,  249,  250,  251,
+     1582,  252,  253,  254,  255,  258,  259,  260,  261,  262,
+      263,  264,  265,  266,  267,  268,  269,  274,  280,  295,
+      296,  297,  300,  301,  302,  303,  304,  305,  306,  307,
+      308,  309,  310,  314,  315,  316,  317,  319,  321,  322,
+      325,  327,  329,  334,  335,  336,  337,  338,  339,  340,
+      341,  342,  343,  348,  349,  350,  351,  352,  353,  354,
+      355,  356,  357,  358,  359,  360,  361,  362,  363,  364,
+      365,  366,  367,  368,  369,  370,  371,  372,  373,  374,
+      375,  376,  377,  378,  382,  383,  384,  385,  386,  387,
+
+      388,  389,  390,  391,  395,  396,  397,  398,  399,  400,
+      401,  402,  403,  404,  405,  406,  407,  408,  409,  412,
+      413,  414,  415,  416,  417,  418,  419,  422,  423,  424,
+      425,  426,  427,  428,  429,  430,  431,  432,  433,  434,
+      435,  436,  439,  441,  442,  447,  452,  453,  455,  456,
+      458,  459,  460,  461,  462,  463,  464,  465,  466,  467,
+      468,  469,  470,  471,  474,  475,  476,  477,  478,  481,
+      482,  483,  484,  485,  486,  487,  488,  489,  490,  491,
+      492,  493,  494,  499,  500,  501,  502,  503,  508,  509,
+      510,  514,  515,  516,  517,  518,  519,  520,  523,  524,
+
+      525,  526,  527,  528,  529,  530,  531,  532,  533,  534,
+      537,  538,  539,  540,  541,  542,  543,  544,  547,  548,
+      549,  552,  553,  554,  555,  556,  557,  558,  559,  560,
+      561,  562,  563,  564,  565,  566,  569,  570,  571,  572,
+      573,  576,  577,  579,  580,  582,  583,  584,  585,  586,
+      587,  588,  591,  592,  593,  594,  595,  596,  597,  598,
+      599,  600,  601,  602,  603,  604,  605,  606,  612,  613,
+      617,  618,  619,  620,  621,  622,  623,  624,  627,  628,
+      629,  630,  631,  632,  633,  634,  635,  636,  637,  638,
+      639,  640,  641,  642,  643,  644,  645,  646,  647,  650,
+
+      651,  652,  653,  654,  655,  656,  657,  658,  659,  660,
+      661,  662,  663,  664,  665,  666,  667,  668,  669,  670,
+      671,  672,  673,  674,  675,  676,  677,  678,  679,  680,
+      681,  682,  683,  684,  685,  686,  687,  688,  689,  690,
+      691,  692,  693,  694,  695,  696,  697,  698,  699,  700,
+      701,  702,  703,  704,  705,  706,  707,  708,  709,  710,
+      711,  712,  713,  714,  717,  718,  719,  720,  721,  722,
+      723,  724,  725,  726,  727,  728,  729,  730,  731,  732,
+      733,  734,  735,  736,  737,  738,  739,  740,  741,  742,
+      743,  744,  745,  746,  747,  748,  749,  750,  751,  752,
+
+      753,  754,  755,  756,  757,  758,  759,  760,  761,  762,
+      765,  766,  767,  768,  769,  770,  771,  772,  773,  774,
+      775,  776,  777,  778,  779,  780,  781,  782,  783,  784,
+      785,  786,  787,  790,  791,  792,  793,  794,  795,  796,
+      797,  798,  799,  800,  801,  802,  803,  804,  805,  806,
+      807,  808,  809,  810,  811,  812,  813,  814,  815,  816,
+      817,  818,  819,  822,  823,  824,  825,  826,  827,  828,
+      829,  830,  831,  832,  833,  834,  835,  838,  839,  840,
+      841,  842,  843,  844,  847,  851,  852,  853,  854,  855,
+      856,  857,  858,  859,  860,  861,  862,  863,  864,  865,
+
+      866,  867,  868,  869,  873,  874,  875,  876,  877,  878,
+      879,  880,  881,  882,  883,  884,  885,  886,  887,  888,
+      889,  890,  891,  892,  893,  894,  895,  896,  897,  900,
+      901,  902,  903,  904,  905,  906,  907,  908,  909,  912,
+      913,  914,  915,  916,  917,  918,  919,  920,  921,  922,
+      923,  924,  925,  926,  927,  928,  929,  930,  931,  932,
+      933,  934,  935,  936,  939,  944,  945,  948,  949,  950,
+      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
+      961,  962,  963,  964,  966,  967,  968,  969,  970,  971,
+      972,  973,  974,  975,  976,  977,  978,  979,  980,  981,
+
+      982,  983,  984,  985,  986,  987,  988,  989,  990,  991,
+      992,  993,  994,  995,  996,  997,  998,  999, 1000, 1001,
+     1002, 1003, 1004, 1005, 1006, 1007, 1010, 1011, 1012, 1013,
+     1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+     1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
      1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
-
      1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
      1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065,
-     1066, 1067, 1068, 1069, 1047, 1070, 1071, 1046, 1072, 1073,
-     1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083,
-     1084, 1085, 1086, 1087, 1088, 1090, 1091, 1092, 1093, 1094,
-     1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104,
-     1105, 1106, 1107, 1108, 1109, 1110, 1111, 1113, 1114, 1115,
-     1116, 1117, 1118, 1119, 1120, 1121, 1122, 1112, 1123, 1124,
-     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
-     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
-
-     1145, 1146, 1089, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
-     1154, 1156, 1155, 1157, 1158, 1159, 1160, 1161, 1162, 1163,
-     1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
-     1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1154, 1155,
+     1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075,
+     1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1086, 1087,
+
+     1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
+     1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
+     1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
+     1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127,
+     1128, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139,
+     1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+     1150, 1151, 1152, 1153, 1154, 1157, 1158, 1159, 1160, 1161,
+     1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171,
+     1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181,
      1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191,
-     1192, 1193, 1194, 1196, 1198, 1199, 1200, 1195, 1201, 1202,
-     1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,
-     1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222,
-     1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232,
-     1233, 1234, 1235, 1236, 1237, 1238, 1239, 1197, 1240, 1241,
-
-     1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251,
-     1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261,
-     1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271,
-     1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1257, 1280,
-     1281, 1282, 1283, 1284, 1258, 1285, 1286, 1287, 1288, 1289,
-     1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299,
-     1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+
+     1192, 1193, 1194, 1195, 1196, 1197, 1200, 1201, 1202, 1203,
+     1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
+     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+     1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+     1234, 1235, 1236, 1237, 1238, 1239, 1244, 1245, 1246, 1247,
+     1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
+     1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+     1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
+     1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
+     1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
+
+     1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1308, 1309,
      1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319,
-     1320, 1321, 1322, 1323, 1324, 1325, 1327, 1328, 1329, 1330,
-     1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
-
-     1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350,
-     1351, 1352, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,
-     1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
-     1372, 1373, 1374, 1375, 1347, 1376, 1377, 1378, 1326, 1379,
-     1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1390,
-     1391, 1392, 1393, 1394, 1395, 1353, 1389, 1396, 1397, 1398,
-     1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408,
-     1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418,
-     1419, 1420, 1421, 1422, 1423, 1424, 1426, 1427, 1428, 1429,
-     1425, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438,
-
-     1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448,
-     1427, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457,
-     1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467,
-     1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
-     1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
-     1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
-     1498, 1499, 1500, 1501, 1502, 1503, 1504, 1506, 1507, 1508,
-     1509, 1510, 1511, 1512, 1513, 1514, 1515, 1505, 1516, 1517,
-     1518, 1519, 1493, 1520, 1521, 1522, 1523, 1525, 1526, 1527,
-     1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537,
-
-     1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547,
-     1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557,
-     1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567,
-     1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577,
-     1578, 1579, 1580, 1581, 1524, 1582, 1583, 1584, 1585, 1559,
-     1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595,
-     1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605,
-     1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
-     1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625,
-     1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635,
-
-     1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645,
-     1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655,
-     1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665,
-     1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675,
-     1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
-     1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
-     1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705,
-     1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715,
-     1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725,
-     1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735,
-
-     1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
-     1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755,
-     1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765,
-     1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
-     1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
-     1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795,
-     1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805,
-     1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815,
-     1816, 1817, 1819, 1818, 1820, 1821, 1822, 1823, 1824, 1825,
-     1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835,
-
-     1836, 1837,   12,   12,   12,   12,   12,   36,   36,   36,
-       36,   36,   80,  315,   80,   80,   80,   99,  437,   99,
-      566,   99,  101,  101,  101,  101,  101,  116,  116,  116,
-      116,  116,  187,  101,  187,  187,  187,  209,  209,  209,
-      834,  833,  832,  831,  830,  829,  828,  827,  826,  822,
-      819,  818,  817,  816,  815,  814,  811,  810,  809,  808,
-      807,  806,  805,  804,  803,  802,  801,  800,  799,  798,
-      795,  794,  793,  792,  791,  790,  789,  788,  787,  786,
-      785,  784,  783,  782,  781,  780,  779,  778,  777,  776,
-      775,  774,  773,  772,  771,  770,  769,  768,  767,  766,
-
-      763,  762,  761,  760,  759,  758,  757,  756,  755,  754,
-      753,  752,  751,  750,  749,  748,  747,  746,  745,  744,
-      741,  740,  739,  738,  737,  736,  735,  734,  733,  732,
-      731,  730,  729,  728,  727,  726,  725,  724,  723,  722,
-      721,  720,  719,  718,  717,  716,  715,  714,  713,  712,
-      711,  710,  709,  708,  707,  706,  705,  704,  703,  702,
-      701,  700,  696,  695,  694,  693,  692,  691,  690,  689,
-      688,  687,  686,  685,  684,  683,  682,  681,  680,  679,
-      678,  677,  676,  675,  674,  673,  672,  671,  670,  669,
-      668,  667,  666,  665,  664,  663,  662,  661,  660,  659,
-
-      658,  657,  656,  655,  654,  653,  652,  651,  650,  649,
-      648,  647,  646,  645,  644,  643,  642,  641,  640,  639,
-      638,  637,  636,  635,  634,  633,  632,  629,  628,  627,
-      626,  625,  624,  623,  622,  621,  620,  619,  618,  617,
-      616,  615,  614,  613,  610,  609,  608,  607,  606,  605,
-      604,  600,  599,  593,  592,  591,  590,  589,  588,  587,
-      586,  585,  584,  583,  582,  581,  580,  576,  575,  574,
-      573,  572,  571,  570,  568,  567,  565,  564,  561,  560,
-      559,  558,  557,  554,  553,  552,  551,  550,  549,  548,
-      547,  546,  545,  544,  543,  542,  541,  540,  537,  536,
-
-      535,  532,  531,  530,  529,  528,  527,  526,  525,  522,
-      521,  520,  519,  518,  517,  516,  515,  514,  513,  512,
-      511,  508,  507,  506,  505,  504,  503,  502,  498,  497,
-      496,  495,  494,  493,  492,  491,  490,  485,  484,  483,
-      482,  481,  480,  479,  478,  477,  476,  475,  474,  471,
-      470,  469,  468,  467,  464,  463,  462,  461,  460,  459,
-      458,  457,  456,  455,  454,  453,  450,  449,  447,  446,
-      441,  436,  433,  430,  429,  428,  427,  426,  424,  423,
-      422,  421,  420,  419,  418,  417,  416,  413,  412,  411,
-      410,  409,  408,  407,  406,  403,  402,  401,  400,  399,
-
-      398,  397,  396,  395,  394,  393,  392,  391,  390,  389,
-      385,  384,  383,  382,  381,  380,  379,  378,  377,  376,
-      372,  371,  370,  369,  368,  367,  366,  365,  364,  363,
-      362,  361,  360,  359,  358,  357,  356,  355,  354,  353,
-      352,  351,  350,  349,  348,  347,  346,  345,  344,  339,
-      338,  337,  336,  335,  334,  333,  332,  331,  329,  210,
-      326,  324,  322,  319,  318,  316,  314,  307,  306,  305,
-      303,  302,  301,  299,  298,  297,  294,  293,  292,  277,
-      271,  266,  265,  264,  263,  262,  260,  259,  258,  257,
-      256,  255,  252,  251,  250,  249,  248,  247,  246,  245,
-
-      244,  240,  239,  236,  233,  232,  231,  230,  227,  226,
-      225,  224,  220,  219,  216,  215,  214,  210,  203,  200,
-      199,  197,  195,  194,  186,  167,  146,  122,  110,  107,
-      106,  104,   43,  100,   98,   97,   88,   43, 1838,   11,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838
+     1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329,
+     1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+     1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
+     1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+     1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369,
+     1370, 1371, 1372, 1373, 1374, 1375, 1376, 1379, 1380, 1381,
+     1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+     1392, 1393, 1394, 1395, 1396, 1397, 1398, 1400, 1401, 1402,
+
+     1403, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414,
+     1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+     1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
+     1435, 1436, 1437, 1438, 1439, 1440, 1441, 1444, 1445, 1446,
+     1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
+     1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466,
+     1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476,
+     1477, 1478, 1481, 1483, 1484, 1485, 1486, 1487, 1488, 1489,
+     1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499,
+     1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509,
+
+     1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+     1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529,
+     1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539,
+     1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549,
+     1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560,
+     1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572,
+     1573, 1574, 1575, 1576, 1577, 1578, 1583, 1584, 1585, 1586,
+     1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596,
+     1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606,
+     1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616,
+
+     1617, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627,
+     1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637,
+     1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647,
+     1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657,
+     1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667,
+     1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
+     1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687,
+     1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697,
+     1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707,
+     1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717,
+
+     1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+     1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+     1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747,
+     1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757,
+     1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767,
+     1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777,
+     1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787,
+     1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+     1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+     1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
+
+     1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827,
+     1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837,
+     1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847,
+     1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857,
+     1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867,
+     1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877,
+     1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889,
+     1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[2314] =
+static const flex_int16_t yy_chk[2847] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
+     1899, 1899, 1899, 1899,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  646,    3,    3,    3,   21,    1,    1,    3,   44,
-        0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  109,    1,    5,    5,    5,   26,   32,    1,
-        1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      646,    8,    8,    8,    1,    8,   44,   27,   28,  109,
-       26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    9,    9,    9,   31,    5,   48,    2,    2,
-
-       10,   10,   10,    2,    6,   37,   51,   37,    2,   42,
-       52,   42,    9,    2,   54,    2,   56,   57,   31,   66,
-       10,    2,    2,   48,  131,  131,   25,   66,   25,   51,
-        2,   25,   25,   25,   25,   25,    2,   54,   52,   56,
-      136,   57,  136,    2,    2,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -1648,238 +1725,296 @@ static const flex_int16_t yy_chk[2314] =
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
 
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,  717,
-       17,   17,   17,   17,   17,   19,   59,   19,   19,   19,
-       19,   19,   64,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   91,   20,  170,  170,
-       55,   61,   59,   63,   22,   64,   17,   93,   59,   61,
-       55,   59,   61,   19,   63,   61,   64,   61,   65,   61,
-       20,   67,   91,   55,   63,   65,   73,   22,   45,   92,
-       73,   67,  718,   67,   45,   93,   45,   45,   55,   45,
-       73,   45,   45,   45,  126,   58,   69,   69,   45,   45,
-
-       69,   45,   58,  126,  126,   92,   69,   45,   45,   45,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        3,    3,   11,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,   16,   16,   14,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   87,   87,   24,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   40,
+       40,  284,   40,   40,  284,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,  118,  118,  118,  118,  118,
+
+       44,   44,   44,   44,  118,  118,  118,  118,  118,  118,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,  118,  118,  118,
+      118,  118,  118,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,  457,  457,  457,  457,  457,
+      457,  457,  457,  457,  457,  457,  457,  457,  197,  197,
+      197,  197,  197,  457,  457,  457,  457,  197,  197,  197,
+      197,  197,  197,  457,  457,  457,  457,  457,  457,  457,
+      457,  457,  457,  457,  457,  457,  457,  457,  457,  457,
+
+      197,  197,  197,  197,  197,  197,  457,  457,  457,  457,
+      457,  457,  457,  457,  457,  457,  457,  457,  457,  457,
+      457,  457,  457,  457,  457,  457,  457,  457,   45,   19,
+       19,   19,   19,   19,   45,   21,   45,   45,   59,   45,
+       21,   45,   45,   45,   59,  131,  131,   59,   45,   45,
+       17,   45,   17,   17,   17,   17,   17,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       62,   75,   58,   62,   62,   75,   58,   62,   62,   70,
-       58,   71,  123,   70,  175,   94,  123,   70,   58,   95,
-       62,  300,   58,   78,   58,   58,  300,   72,  175,   70,
-       71,  108,   71,   70,   71,   72,   96,   72,   77,   77,
-       76,   94,   72,   72,   76,   95,   78,   76,   77,   81,
-       81,   81,   81,   81,   76,   76,   78,  108,   77,   76,
-       76,   78,   81,   82,   96,   82,   82,   82,   82,   82,
-
-      151,   77,  719,   77,  151,   83,   77,   83,   82,  101,
-       83,   83,   83,   83,   83,   81,   77,   85,   85,   85,
-       85,   85,   84,   77,   84,   84,   84,   84,   84,  105,
-       85,   82,   89,   89,   89,   89,   89,   84,   90,   90,
-       90,   90,   90,  103,  111,  113,  101,  112,  114,  138,
-      103,  119,  141,   85,  115,  141,  720,  105,  167,  141,
-       84,  158,  167,  290,  190,  138,  164,  166,  119,  189,
-      166,  166,  111,  113,  112,  114,  290,  115,  193,  119,
-      103,  164,  164,  164,  103,  179,  171,  190,  103,  158,
-      171,  158,  183,  188,  171,  189,  103,  169,  191,  192,
-
-      103,  193,  103,  103,  118,  118,  118,  118,  118,  306,
-      316,  721,  179,  118,  118,  118,  118,  118,  118,  183,
-      316,  188,  202,  198,  201,  192,  191,  208,  204,  254,
-      206,  405,  169,  169,  169,  405,  118,  118,  118,  118,
-      118,  118,  722,  169,  265,  169,  198,  169,  169,  202,
-      169,  204,  201,  206,  208,  211,  211,  211,  211,  211,
-      213,  306,  223,  308,  211,  211,  211,  211,  211,  211,
-      223,  281,  311,  317,  281,  223,  223,  320,  323,  395,
-      265,  343,  254,  213,  330,  254,  308,  211,  211,  211,
-      211,  211,  211,  350,  265,  311,  319,  319,  343,  350,
-
-      320,  723,  317,  724,  381,  319,  323,  328,  328,  328,
-      328,  328,  425,  330,  381,  425,  328,  328,  328,  328,
-      328,  328,  363,  373,  373,  409,  432,  363,  373,  409,
-      440,  432,  450,  725,  450,  452,  578,  395,  469,  328,
-      328,  328,  328,  328,  328,  500,  469,  472,  469,  469,
-      469,  481,  577,  624,  624,  500,  481,  680,  440,  450,
-      472,  450,  472,  452,  578,  579,  698,  705,  680,  697,
-      579,  707,  707,  705,  707,  363,  727,  728,  729,  577,
-      363,  451,  451,  451,  451,  451,  730,  731,  733,  698,
-      451,  451,  451,  451,  451,  451,  726,  697,  734,  735,
-
-      726,  736,  737,  738,  726,  739,  740,  741,  742,  743,
-      744,  745,  746,  451,  451,  451,  451,  451,  451,  747,
-      748,  749,  750,  751,  749,  752,  754,  755,  756,  757,
-      758,  759,  760,  761,  762,  763,  765,  766,  767,  768,
-      769,  770,  771,  772,  773,  774,  775,  776,  777,  778,
-      779,  780,  781,  782,  783,  784,  785,  786,  787,  788,
-      789,  790,  790,  791,  792,  793,  788,  794,  795,  790,
-      797,  793,  798,  790,  799,  800,  801,  802,  803,  804,
-      805,  806,  807,  808,  809,  810,  812,  813,  814,  815,
-      816,  817,  818,  819,  820,  821,  823,  824,  825,  826,
-
-      827,  828,  829,  830,  831,  832,  833,  834,  835,  836,
-      837,  838,  839,  840,  841,  813,  842,  843,  844,  845,
-      846,  847,  848,  850,  851,  852,  853,  854,  855,  856,
-      857,  858,  859,  855,  860,  861,  862,  863,  866,  867,
-      868,  869,  870,  871,  874,  875,  876,  877,  878,  879,
-      880,  881,  882,  883,  880,  884,  885,  886,  887,  890,
-      891,  892,  893,  894,  895,  896,  897,  898,  899,  900,
-      901,  902,  903,  904,  905,  906,  907,  908,  909,  910,
-      911,  912,  913,  914,  915,  916,  917,  918,  920,  921,
-      922,  923,  924,  925,  926,  927,  928,  929,  930,  931,
-
-      933,  934,  935,  936,  937,  938,  940,  941,  942,  943,
-      944,  945,  946,  947,  948,  949,  950,  951,  952,  953,
-      954,  955,  956,  957,  934,  958,  959,  933,  960,  961,
-      963,  964,  965,  966,  967,  968,  969,  970,  971,  972,
-      973,  975,  976,  977,  978,  979,  981,  982,  983,  984,
-      985,  986,  987,  988,  989,  990,  991,  992,  993,  994,
-      995,  996,  997,  998,  999, 1000, 1001, 1002, 1003, 1005,
-     1006, 1007, 1008, 1010, 1011, 1012, 1013, 1001, 1014, 1015,
-     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
-     1026, 1027, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
-
-     1037, 1038,  978, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
-     1046, 1048, 1047, 1049, 1050, 1051, 1052, 1053, 1055, 1056,
-     1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
-     1067, 1068, 1069, 1071, 1072, 1073, 1074, 1075, 1046, 1047,
-     1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085,
-     1086, 1087, 1089, 1090, 1091, 1092, 1093, 1089, 1094, 1095,
-     1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
-     1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
-     1116, 1117, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
-     1127, 1128, 1129, 1131, 1132, 1133, 1135, 1090, 1136, 1137,
-
-     1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147,
-     1148, 1149, 1150, 1151, 1153, 1154, 1155, 1156, 1157, 1158,
-     1159, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1170,
-     1171, 1172, 1173, 1174, 1176, 1177, 1178, 1179, 1154, 1180,
-     1181, 1182, 1183, 1184, 1155, 1185, 1186, 1187, 1188, 1189,
-     1190, 1191, 1192, 1195, 1197, 1198, 1199, 1200, 1201, 1202,
-     1203, 1204, 1205, 1206, 1207, 1208, 1210, 1211, 1212, 1213,
-     1215, 1216, 1217, 1218, 1219, 1220, 1223, 1225, 1226, 1227,
-     1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237,
-     1238, 1239, 1241, 1242, 1243, 1244, 1245, 1248, 1249, 1250,
-
-     1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1260, 1261,
-     1262, 1263, 1264, 1265, 1266, 1267, 1269, 1270, 1271, 1272,
-     1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282,
-     1283, 1285, 1286, 1287, 1257, 1288, 1289, 1290, 1233, 1291,
-     1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301,
-     1302, 1303, 1304, 1305, 1306, 1263, 1300, 1308, 1311, 1312,
-     1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1322, 1323,
-     1324, 1325, 1326, 1327, 1328, 1330, 1331, 1333, 1336, 1337,
-     1338, 1340, 1341, 1343, 1344, 1345, 1346, 1347, 1349, 1350,
-     1345, 1351, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
-
-     1361, 1362, 1363, 1364, 1365, 1366, 1367, 1369, 1370, 1372,
-     1347, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381,
-     1384, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
-     1396, 1397, 1398, 1399, 1400, 1401, 1402, 1404, 1405, 1407,
-     1408, 1409, 1410, 1412, 1413, 1414, 1415, 1416, 1417, 1418,
-     1419, 1420, 1421, 1423, 1425, 1427, 1429, 1430, 1431, 1432,
-     1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442,
-     1443, 1444, 1445, 1446, 1447, 1448, 1449, 1439, 1450, 1451,
-     1452, 1453, 1427, 1454, 1455, 1455, 1456, 1457, 1458, 1459,
-     1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
-
-     1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479,
-     1480, 1481, 1483, 1484, 1485, 1486, 1487, 1489, 1490, 1491,
-     1492, 1493, 1495, 1498, 1499, 1500, 1503, 1504, 1505, 1506,
-     1507, 1508, 1509, 1510, 1511, 1513, 1515, 1516, 1517, 1518,
-     1519, 1520, 1521, 1522, 1456, 1524, 1525, 1527, 1529, 1493,
-     1530, 1531, 1533, 1534, 1535, 1536, 1537, 1539, 1540, 1541,
-     1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
-     1552, 1553, 1554, 1555, 1556, 1558, 1559, 1560, 1561, 1562,
-     1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
-     1574, 1575, 1576, 1577, 1579, 1580, 1581, 1583, 1585, 1586,
-
-     1587, 1588, 1589, 1591, 1592, 1593, 1594, 1595, 1596, 1597,
-     1598, 1599, 1601, 1602, 1604, 1607, 1608, 1609, 1610, 1613,
-     1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1625,
-     1626, 1627, 1629, 1630, 1631, 1632, 1633, 1634, 1636, 1637,
-     1638, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648,
-     1650, 1651, 1652, 1654, 1655, 1656, 1657, 1658, 1659, 1660,
-     1661, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1673,
-     1674, 1675, 1676, 1677, 1678, 1679, 1682, 1683, 1684, 1685,
-     1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
-     1696, 1697, 1699, 1700, 1701, 1702, 1703, 1704, 1706, 1710,
-
-     1712, 1713, 1714, 1715, 1717, 1718, 1719, 1721, 1722, 1723,
-     1724, 1725, 1726, 1727, 1728, 1729, 1730, 1732, 1733, 1735,
-     1736, 1739, 1740, 1742, 1743, 1744, 1745, 1746, 1747, 1748,
-     1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758,
-     1759, 1760, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769,
-     1770, 1771, 1772, 1773, 1774, 1775, 1776, 1778, 1779, 1781,
-     1782, 1784, 1785, 1786, 1787, 1789, 1791, 1792, 1793, 1795,
-     1796, 1797, 1798, 1799, 1800, 1802, 1804, 1807, 1808, 1809,
-     1810, 1811, 1812, 1811, 1814, 1815, 1817, 1818, 1819, 1820,
-     1821, 1822, 1823, 1825, 1826, 1827, 1828, 1829, 1832, 1833,
-
-     1834, 1835, 1839, 1839, 1839, 1839, 1839, 1840, 1840, 1840,
-     1840, 1840, 1841, 1847, 1841, 1841, 1841, 1842, 1848, 1842,
-     1849, 1842, 1843, 1843, 1843, 1843, 1843, 1844, 1844, 1844,
-     1844, 1844, 1845, 1850, 1845, 1845, 1845, 1846, 1846, 1846,
-      716,  715,  714,  713,  712,  711,  710,  709,  708,  706,
-      704,  703,  702,  701,  700,  699,  696,  695,  694,  692,
-      691,  689,  688,  687,  686,  685,  684,  683,  682,  681,
-      679,  678,  676,  675,  674,  673,  672,  671,  670,  669,
-      668,  667,  666,  665,  664,  662,  661,  660,  659,  658,
-      657,  656,  655,  654,  652,  651,  650,  649,  648,  647,
-
-      645,  644,  643,  642,  641,  640,  639,  637,  636,  635,
-      634,  633,  632,  631,  630,  629,  628,  627,  626,  625,
-      623,  622,  621,  620,  619,  618,  617,  616,  615,  614,
-      613,  612,  610,  609,  608,  607,  606,  605,  604,  603,
-      602,  601,  600,  599,  598,  597,  596,  595,  594,  593,
-      592,  591,  590,  589,  588,  587,  586,  585,  584,  583,
-      582,  581,  575,  573,  570,  569,  568,  567,  565,  564,
-      563,  561,  560,  558,  556,  555,  554,  553,  552,  551,
-      550,  549,  548,  547,  546,  545,  544,  543,  542,  541,
-      540,  539,  538,  537,  536,  535,  534,  533,  532,  531,
-
-      530,  529,  528,  527,  526,  524,  522,  521,  520,  519,
-      518,  517,  516,  515,  514,  513,  512,  511,  510,  509,
-      507,  506,  505,  504,  503,  502,  501,  499,  498,  497,
-      496,  495,  494,  493,  492,  491,  490,  489,  488,  487,
-      485,  484,  483,  482,  480,  479,  478,  477,  476,  474,
-      473,  471,  470,  467,  466,  465,  464,  463,  462,  461,
-      459,  458,  457,  456,  455,  454,  453,  448,  447,  445,
-      444,  443,  442,  441,  439,  438,  436,  433,  431,  430,
-      428,  427,  426,  424,  423,  422,  421,  420,  419,  418,
-      417,  416,  415,  414,  413,  412,  411,  410,  408,  407,
-
-      406,  404,  403,  402,  401,  399,  398,  397,  396,  394,
-      393,  392,  391,  390,  389,  388,  387,  386,  385,  384,
-      382,  380,  379,  378,  377,  376,  375,  374,  372,  371,
-      370,  369,  368,  367,  366,  365,  364,  362,  361,  360,
-      359,  358,  357,  356,  355,  354,  353,  352,  351,  349,
-      348,  347,  346,  345,  342,  341,  340,  339,  338,  337,
-      336,  335,  334,  333,  332,  331,  327,  325,  322,  321,
-      318,  314,  307,  305,  304,  303,  302,  301,  299,  298,
-      297,  296,  295,  294,  293,  292,  291,  289,  288,  287,
-      286,  285,  284,  283,  282,  280,  279,  278,  277,  276,
-
-      275,  274,  273,  272,  271,  270,  269,  268,  267,  266,
-      264,  263,  262,  261,  260,  259,  258,  257,  256,  255,
-      253,  252,  251,  250,  249,  248,  247,  246,  244,  243,
-      242,  241,  240,  239,  238,  237,  236,  235,  234,  233,
-      232,  231,  230,  229,  228,  227,  226,  225,  224,  222,
-      221,  220,  219,  218,  217,  216,  215,  214,  212,  209,
-      207,  205,  203,  200,  199,  197,  194,  186,  185,  184,
-      182,  181,  180,  178,  177,  176,  174,  173,  172,  168,
-      165,  163,  162,  161,  160,  159,  157,  156,  155,  154,
-      153,  152,  150,  149,  148,  147,  146,  145,  144,  143,
-
-      142,  140,  139,  137,  135,  134,  133,  132,  130,  129,
-      128,  127,  125,  124,  122,  121,  120,  116,  110,  107,
-      106,  104,   99,   98,   79,   74,   68,   60,   53,   50,
-       49,   47,   43,   41,   39,   38,   24,   14,   11, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-
-     1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
-     1838, 1838, 1838
+        7,    7,   27,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,   20,   20,   20,   20,   20,
+
+       76,    7,    7,  456,   76,  456,    7,   76,   20,  224,
+       27,    7,  322,  322,   76,   76,    7,  224,    7,   76,
+       76,  322,  224,  224,    7,    7,   61,   66,   28,  103,
+      456,   20,  456,    7,   61,   66,  103,   61,  369,    7,
+       61,   58,   61,  369,   61,  126,    7,    7,   58,   58,
+       58,   58,   58,   58,  126,  126,   28,  476,   58,   58,
+       58,   58,   58,   58,   48,  476,  103,  476,  476,  476,
+      103,   13,   62,   13,  103,   62,   62,    9,   58,   62,
+       62,   58,  103,   58,   58,   58,  103,   55,  103,  103,
+       48,  369,   62,    9,   58,   73,  369,   55,   58,   73,
+
+       58,   58,  212,  212,  212,  212,  212,   77,   77,   73,
+       55,  212,  212,  212,  212,  212,  212,  318,  318,  318,
+      318,  318,   63,  134,   26,   55,  318,  318,  318,  318,
+      318,  318,  134,   63,  212,  212,  212,  212,  212,  212,
+       77,  257,   77,   63,   71,   77,   71,   26,   71,  318,
+      318,  318,  318,  318,  318,  331,  331,  331,  331,  331,
+      165,   25,   77,   25,  331,  331,  331,  331,  331,  331,
+      443,  443,  443,  443,  443,  165,  165,  165,  170,  443,
+      443,  443,  443,  443,  443,   72,   67,  331,  331,  331,
+      331,  331,  331,   72,  257,   72,   67,  257,   67,   52,
+
+       72,   72,  443,  443,  443,  443,  443,  443,  578,  578,
+      578,  578,  578,  170,  170,  170,   65,  578,  578,  578,
+      578,  578,  578,   65,  170,   31,  170,   52,  170,  170,
+       70,  170,  375,  268,   70,  375,   78,   32,   70,  375,
+      578,  578,  578,  578,  578,  578,   78,  379,  379,  375,
+       70,   78,  379,    5,   70,   89,   89,   89,   89,   89,
+       69,   69,   33,   75,   69,  814,  814,   75,  142,  268,
+       69,  142,  479,  814,  172,  142,  167,  814,  172,  167,
+      167,   51,  172,  268,   54,  479,  746,  479,  726,  726,
+      746,  726,   56,   57,  746,   91,   64,   92,   93,  105,
+
+      111,    5,   64,  108,   51,  109,  112,   54,  113,  119,
+      114,  115,  123,  189,  138,   56,  123,   57,  171,  171,
+      119,   91,  136,   92,  136,  176,   93,  105,  111,  108,
+      138,  152,  109,  112,  115,  152,  113,  114,  168,  176,
+      190,  189,  168,  202,  191,  199,  203,  205,  209,  207,
+      213,  293,  319,  309,  311,  320,  323,  326,  401,  347,
+      664,  411,  319,  354,  293,  411,  190,  191,  199,  354,
+      205,  202,  207,  203,  446,  209,  347,  311,  387,  323,
+      431,  512,  415,  431,  320,  326,  415,  438,  387,  489,
+      589,  512,  438,  590,  489,  639,  639,  698,  715,  664,
+
+      716,  724,  446,  773,  213,  309,  773,  724,  698,  785,
+      837,  812,  785,  817,  964,  882,  401,  589,  812,  817,
+      882,  590,  965,  716,  911, 1012,  715, 1084,  911, 1039,
+     1085, 1130, 1131, 1198, 1199, 1282, 1130, 1306,  837, 1351,
+     1039,  964, 1312, 1397, 1399,  965, 1482, 1351, 1397, 1494,
+     1511, 1511, 1512, 1550,   38, 1084, 1198, 1085,   39, 1872,
+     1494, 1872, 1199,   41,   47, 1306,   49, 1399,   50,   53,
+       60,   68,   74, 1482,   79,   94, 1131,   95,   96,   98,
+       99, 1550,  104, 1012,  106,  107, 1312,  110, 1282,  120,
+      121,  122,  124,  125,  127,  128,  129,  130,  132,  133,
+
+      135,  137,  139,  140,  141,  143,  144,  145,  146,  147,
+     1512,  148,  149,  150,  151,  153,  154,  155,  156,  157,
+      158,  159,  160,  161,  162,  163,  164,  166,  169,  173,
+      174,  175,  177,  178,  179,  180,  181,  182,  183,  184,
+      185,  186,  187,  192,  193,  194,  195,  198,  200,  201,
+      204,  206,  208,  214,  215,  216,  217,  218,  219,  220,
+      221,  222,  223,  225,  226,  227,  228,  229,  230,  231,
+      232,  233,  234,  235,  236,  237,  238,  239,  240,  241,
+      242,  243,  244,  245,  246,  247,  249,  250,  251,  252,
+      253,  254,  255,  256,  258,  259,  260,  261,  262,  263,
+
+      264,  265,  266,  267,  269,  270,  271,  272,  273,  274,
+      275,  276,  277,  278,  279,  280,  281,  282,  283,  285,
+      286,  287,  288,  289,  290,  291,  292,  294,  295,  296,
+      297,  298,  299,  300,  301,  302,  303,  304,  305,  306,
+      307,  308,  310,  314,  317,  321,  324,  325,  328,  330,
+      333,  334,  335,  336,  337,  338,  339,  340,  341,  342,
+      343,  344,  345,  346,  349,  350,  351,  352,  353,  355,
+      356,  357,  358,  359,  360,  361,  362,  363,  364,  365,
+      366,  367,  368,  370,  371,  372,  373,  374,  376,  377,
+      378,  380,  381,  382,  383,  384,  385,  386,  388,  390,
+
+      391,  392,  393,  394,  395,  396,  397,  398,  399,  400,
+      402,  403,  404,  405,  407,  408,  409,  410,  412,  413,
+      414,  416,  417,  418,  419,  420,  421,  422,  423,  424,
+      425,  426,  427,  428,  429,  430,  432,  433,  434,  436,
+      437,  439,  442,  444,  445,  447,  448,  449,  450,  451,
+      453,  454,  458,  459,  460,  461,  462,  463,  464,  465,
+      466,  468,  469,  470,  471,  472,  473,  474,  477,  478,
+      480,  481,  483,  484,  485,  486,  487,  488,  490,  491,
+      492,  493,  494,  496,  497,  498,  499,  500,  501,  502,
+      503,  504,  505,  506,  507,  508,  509,  510,  511,  513,
+
+      514,  515,  516,  517,  518,  519,  521,  522,  523,  524,
+      525,  526,  527,  528,  529,  530,  531,  532,  533,  534,
+      536,  538,  539,  540,  541,  542,  543,  544,  545,  546,
+      547,  548,  549,  550,  551,  552,  553,  554,  555,  556,
+      557,  558,  559,  560,  561,  562,  563,  564,  565,  566,
+      567,  568,  570,  572,  573,  575,  576,  577,  579,  580,
+      581,  582,  585,  587,  591,  592,  594,  595,  596,  597,
+      598,  599,  600,  601,  602,  603,  604,  605,  606,  607,
+      608,  609,  610,  611,  612,  613,  614,  615,  616,  617,
+      618,  619,  620,  621,  622,  623,  624,  626,  627,  628,
+
+      629,  630,  631,  632,  633,  634,  635,  636,  637,  638,
+      640,  641,  642,  643,  644,  645,  646,  647,  648,  649,
+      650,  651,  652,  653,  654,  655,  657,  658,  659,  660,
+      661,  662,  663,  665,  666,  667,  668,  669,  670,  672,
+      673,  674,  675,  676,  677,  678,  679,  680,  682,  683,
+      684,  685,  686,  687,  688,  689,  690,  691,  692,  693,
+      694,  696,  697,  699,  700,  701,  702,  703,  704,  705,
+      706,  707,  709,  710,  712,  713,  714,  717,  718,  719,
+      720,  721,  722,  723,  725,  727,  728,  729,  730,  731,
+      732,  733,  734,  735,  736,  737,  738,  739,  740,  741,
+
+      742,  743,  744,  745,  747,  748,  749,  750,  751,  752,
+      754,  755,  756,  757,  758,  759,  760,  761,  762,  763,
+      764,  765,  766,  767,  768,  769,  770,  771,  772,  774,
+      775,  776,  778,  779,  780,  781,  782,  783,  784,  786,
+      787,  789,  790,  791,  792,  793,  794,  795,  796,  797,
+      798,  799,  800,  801,  802,  803,  804,  805,  806,  807,
+      808,  809,  810,  811,  813,  815,  816,  818,  819,  821,
+      822,  823,  824,  825,  826,  827,  828,  829,  830,  831,
+      832,  833,  834,  836,  838,  839,  840,  841,  842,  843,
+      844,  845,  846,  848,  849,  850,  851,  852,  853,  854,
+
+      855,  856,  857,  858,  859,  860,  861,  862,  863,  864,
+      865,  866,  867,  868,  869,  870,  871,  872,  873,  874,
+      876,  877,  878,  879,  880,  881,  883,  884,  885,  886,
+      887,  888,  889,  890,  891,  892,  893,  896,  897,  898,
+      899,  900,  901,  904,  905,  906,  907,  908,  909,  910,
+      912,  913,  914,  915,  916,  917,  918,  921,  922,  923,
+      924,  925,  926,  927,  928,  929,  930,  931,  932,  933,
+      934,  935,  936,  937,  938,  939,  940,  941,  942,  943,
+      944,  945,  946,  947,  948,  949,  951,  952,  953,  954,
+      955,  956,  957,  958,  959,  960,  961,  962,  966,  967,
+
+      968,  969,  970,  972,  973,  974,  975,  976,  977,  978,
+      979,  980,  981,  982,  983,  984,  985,  986,  987,  988,
+      989,  990,  991,  992,  993,  995,  996,  997,  998,  999,
+     1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1009, 1010,
+     1011, 1013, 1015, 1016, 1017, 1018, 1020, 1021, 1022, 1023,
+     1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+     1034, 1035, 1036, 1037, 1038, 1040, 1041, 1043, 1044, 1045,
+     1046, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056,
+     1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1067,
+     1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+
+     1078, 1079, 1080, 1081, 1082, 1083, 1087, 1088, 1089, 1090,
+     1091, 1092, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
+     1102, 1103, 1104, 1105, 1106, 1107, 1108, 1110, 1111, 1112,
+     1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122,
+     1123, 1124, 1125, 1126, 1127, 1128, 1132, 1133, 1134, 1135,
+     1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145,
+     1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155,
+     1156, 1157, 1158, 1159, 1160, 1161, 1163, 1164, 1165, 1166,
+     1167, 1168, 1169, 1170, 1171, 1172, 1173, 1175, 1176, 1177,
+     1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,
+
+     1189, 1190, 1191, 1192, 1193, 1194, 1195, 1197, 1200, 1201,
+     1202, 1203, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,
+     1214, 1215, 1216, 1217, 1218, 1220, 1221, 1222, 1223, 1225,
+     1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235,
+     1236, 1237, 1238, 1241, 1243, 1244, 1245, 1247, 1248, 1249,
+     1250, 1251, 1252, 1253, 1254, 1255, 1256, 1258, 1259, 1260,
+     1261, 1262, 1264, 1265, 1266, 1267, 1268, 1269, 1272, 1274,
+     1275, 1276, 1277, 1278, 1279, 1280, 1281, 1283, 1284, 1285,
+     1286, 1287, 1288, 1290, 1291, 1292, 1293, 1294, 1297, 1298,
+     1299, 1300, 1301, 1302, 1303, 1304, 1305, 1307, 1309, 1310,
+
+     1311, 1313, 1314, 1315, 1316, 1318, 1319, 1320, 1321, 1322,
+     1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332,
+     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+     1344, 1345, 1346, 1347, 1348, 1349, 1350, 1352, 1353, 1354,
+     1355, 1356, 1357, 1359, 1360, 1363, 1364, 1365, 1366, 1367,
+     1368, 1369, 1370, 1371, 1372, 1374, 1375, 1376, 1377, 1378,
+     1379, 1380, 1382, 1383, 1385, 1388, 1389, 1390, 1392, 1393,
+     1395, 1396, 1398, 1401, 1402, 1403, 1405, 1406, 1407, 1408,
+     1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418,
+     1419, 1421, 1422, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
+
+     1431, 1432, 1433, 1434, 1437, 1439, 1440, 1441, 1442, 1443,
+     1444, 1445, 1446, 1447, 1448, 1450, 1452, 1453, 1454, 1455,
+     1456, 1457, 1459, 1460, 1462, 1463, 1464, 1465, 1467, 1468,
+     1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1478, 1480,
+     1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493,
+     1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+     1505, 1506, 1507, 1508, 1509, 1510, 1513, 1514, 1515, 1516,
+     1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526,
+     1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536,
+     1537, 1538, 1540, 1541, 1542, 1543, 1544, 1546, 1547, 1548,
+
+     1549, 1552, 1555, 1556, 1557, 1560, 1561, 1562, 1563, 1564,
+     1565, 1566, 1567, 1568, 1570, 1572, 1573, 1574, 1575, 1576,
+     1577, 1578, 1579, 1580, 1582, 1583, 1586, 1588, 1589, 1590,
+     1592, 1593, 1594, 1595, 1596, 1598, 1599, 1600, 1601, 1602,
+     1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612,
+     1613, 1614, 1615, 1617, 1618, 1619, 1620, 1621, 1623, 1624,
+     1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634,
+     1635, 1636, 1637, 1639, 1640, 1641, 1643, 1645, 1646, 1647,
+     1648, 1649, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658,
+     1659, 1661, 1662, 1664, 1667, 1668, 1669, 1670, 1673, 1675,
+
+     1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1685, 1686,
+     1687, 1690, 1691, 1692, 1693, 1694, 1695, 1697, 1698, 1699,
+     1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1711,
+     1712, 1713, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722,
+     1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1734, 1735,
+     1736, 1737, 1738, 1739, 1740, 1743, 1744, 1745, 1746, 1747,
+     1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757,
+     1758, 1760, 1761, 1762, 1763, 1764, 1765, 1767, 1771, 1773,
+     1774, 1775, 1776, 1778, 1779, 1780, 1782, 1783, 1784, 1785,
+     1786, 1787, 1788, 1789, 1790, 1791, 1793, 1794, 1796, 1797,
+
+     1800, 1801, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810,
+     1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820,
+     1821, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831,
+     1832, 1833, 1834, 1835, 1836, 1837, 1839, 1840, 1842, 1843,
+     1845, 1846, 1847, 1848, 1850, 1852, 1853, 1854, 1856, 1857,
+     1858, 1859, 1860, 1861, 1863, 1865, 1868, 1869, 1870, 1871,
+     1873, 1875, 1876, 1878, 1879, 1880, 1881, 1882, 1883, 1884,
+     1886, 1887, 1888, 1889, 1890, 1893, 1894, 1895, 1896,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1888,30 +2023,31 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[201] =
+static const flex_int16_t yy_rule_linenum[208] =
     {   0,
       147,  149,  151,  156,  157,  162,  163,  164,  176,  179,
       184,  191,  200,  209,  218,  227,  236,  245,  255,  264,
       273,  282,  291,  300,  309,  318,  327,  336,  345,  354,
       363,  375,  384,  393,  402,  411,  422,  433,  444,  455,
       465,  475,  486,  497,  508,  519,  530,  541,  552,  563,
-      574,  585,  594,  605,  616,  627,  638,  649,  658,  667,
-      676,  685,  696,  707,  718,  729,  740,  751,  761,  772,
-      781,  791,  805,  821,  830,  839,  848,  857,  879,  901,
-      910,  920,  929,  940,  949,  958,  967,  976,  985,  995,
-     1004, 1015, 1026, 1038, 1047, 1057, 1066, 1075, 1084, 1093,
-
-     1102, 1111, 1120, 1129, 1139, 1150, 1162, 1171, 1180, 1190,
-     1200, 1210, 1220, 1230, 1240, 1249, 1259, 1268, 1277, 1286,
-     1295, 1305, 1315, 1324, 1334, 1343, 1352, 1361, 1370, 1379,
-     1388, 1397, 1406, 1415, 1424, 1433, 1442, 1451, 1460, 1469,
-     1478, 1487, 1496, 1505, 1514, 1523, 1532, 1541, 1550, 1559,
-     1568, 1577, 1586, 1595, 1604, 1613, 1622, 1631, 1640, 1649,
-     1661, 1673, 1683, 1693, 1703, 1713, 1723, 1733, 1743, 1753,
-     1763, 1772, 1781, 1790, 1799, 1808, 1817, 1826, 1837, 1848,
-     1861, 1874, 1887, 1986, 1991, 1996, 2001, 2002, 2003, 2004,
-     2005, 2006, 2008, 2026, 2039, 2044, 2048, 2050, 2052, 2054
-
+      574,  585,  594,  603,  612,  621,  630,  641,  652,  663,
+      674,  685,  694,  703,  712,  721,  732,  743,  754,  765,
+      776,  787,  797,  808,  819,  828,  837,  846,  856,  870,
+      886,  895,  904,  913,  922,  944,  966,  975,  985,  994,
+     1005, 1014, 1023, 1032, 1041, 1050, 1060, 1069, 1080, 1091,
+
+     1103, 1112, 1122, 1131, 1140, 1149, 1158, 1167, 1176, 1185,
+     1194, 1204, 1215, 1227, 1236, 1245, 1255, 1265, 1275, 1285,
+     1295, 1305, 1314, 1324, 1333, 1342, 1351, 1360, 1370, 1380,
+     1389, 1399, 1408, 1417, 1426, 1435, 1444, 1453, 1462, 1471,
+     1480, 1489, 1498, 1507, 1516, 1525, 1534, 1543, 1552, 1561,
+     1570, 1579, 1588, 1597, 1606, 1615, 1624, 1633, 1642, 1651,
+     1660, 1669, 1678, 1687, 1696, 1705, 1714, 1726, 1738, 1748,
+     1758, 1768, 1778, 1788, 1798, 1808, 1818, 1828, 1837, 1846,
+     1855, 1864, 1873, 1882, 1891, 1902, 1913, 1926, 1939, 1952,
+     2051, 2056, 2061, 2066, 2067, 2068, 2069, 2070, 2071, 2073,
+
+     2091, 2104, 2109, 2113, 2115, 2117, 2119
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1964,7 +2100,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1968 "dhcp4_lexer.cc"
+#line 2104 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1990,8 +2126,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1994 "dhcp4_lexer.cc"
-#line 1995 "dhcp4_lexer.cc"
+#line 2130 "dhcp4_lexer.cc"
+#line 2131 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2321,7 +2457,7 @@ YY_DECL
     }
 
 
-#line 2325 "dhcp4_lexer.cc"
+#line 2461 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2350,13 +2486,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1839 )
+				if ( yy_current_state >= 1900 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1838 );
+		while ( yy_current_state != 1899 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2375,13 +2511,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 201 )
+			else if ( yy_act < 208 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 201 )
+			else if ( yy_act == 208 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 202 )
+			else if ( yy_act == 209 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -3014,6 +3150,54 @@ YY_RULE_SETUP
 case 53:
 YY_RULE_SETUP
 #line 594 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_DURABILITY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("durability", driver.loc_);
+    }
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+#line 603 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-format", driver.loc_);
+    }
+}
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+#line 612 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_MODE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-mode", driver.loc_);
+    }
+}
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+#line 621 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_WRITE_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-write-rate", driver.loc_);
+    }
+}
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+#line 630 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3025,9 +3209,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 58:
 YY_RULE_SETUP
-#line 605 "dhcp4_lexer.ll"
+#line 641 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3039,9 +3223,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 59:
 YY_RULE_SETUP
-#line 616 "dhcp4_lexer.ll"
+#line 652 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3053,9 +3237,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 60:
 YY_RULE_SETUP
-#line 627 "dhcp4_lexer.ll"
+#line 663 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3067,9 +3251,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 61:
 YY_RULE_SETUP
-#line 638 "dhcp4_lexer.ll"
+#line 674 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3081,9 +3265,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 62:
 YY_RULE_SETUP
-#line 649 "dhcp4_lexer.ll"
+#line 685 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3093,9 +3277,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 63:
 YY_RULE_SETUP
-#line 658 "dhcp4_lexer.ll"
+#line 694 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3105,9 +3289,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 64:
 YY_RULE_SETUP
-#line 667 "dhcp4_lexer.ll"
+#line 703 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3117,9 +3301,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 65:
 YY_RULE_SETUP
-#line 676 "dhcp4_lexer.ll"
+#line 712 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3129,9 +3313,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 66:
 YY_RULE_SETUP
-#line 685 "dhcp4_lexer.ll"
+#line 721 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3143,9 +3327,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 67:
 YY_RULE_SETUP
-#line 696 "dhcp4_lexer.ll"
+#line 732 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3157,9 +3341,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 68:
 YY_RULE_SETUP
-#line 707 "dhcp4_lexer.ll"
+#line 743 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3171,9 +3355,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 69:
 YY_RULE_SETUP
-#line 718 "dhcp4_lexer.ll"
+#line 754 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3185,9 +3369,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 70:
 YY_RULE_SETUP
-#line 729 "dhcp4_lexer.ll"
+#line 765 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3199,9 +3383,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 71:
 YY_RULE_SETUP
-#line 740 "dhcp4_lexer.ll"
+#line 776 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3213,9 +3397,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 72:
 YY_RULE_SETUP
-#line 751 "dhcp4_lexer.ll"
+#line 787 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3226,9 +3410,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 73:
 YY_RULE_SETUP
-#line 761 "dhcp4_lexer.ll"
+#line 797 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3240,9 +3424,47 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 74:
+YY_RULE_SETUP
+#line 808 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+    case isc::dhcp::Parser4Context::SUBNET4:
+    case isc::dhcp::Parser4Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp4Parser::make_ALLOCATOR(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("allocator", driver.loc_);
+    }
+}
+	YY_BREAK
+case 75:
+YY_RULE_SETUP
+#line 819 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_FREE_LEASE_INDEX(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("free-lease-index", driver.loc_);
+    }
+}
+	YY_BREAK
+case 76:
+YY_RULE_SETUP
+#line 828 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_OPTION_ARENA(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("option-arena", driver.loc_);
+    }
+}
+	YY_BREAK
+case 77:
 YY_RULE_SETUP
-#line 772 "dhcp4_lexer.ll"
+#line 837 "dhcp4_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3252,9 +3474,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 78:
 YY_RULE_SETUP
-#line 781 "dhcp4_lexer.ll"
+#line 846 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3265,9 +3487,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 79:
 YY_RULE_SETUP
-#line 791 "dhcp4_lexer.ll"
+#line 856 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3282,9 +3504,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 80:
 YY_RULE_SETUP
-#line 805 "dhcp4_lexer.ll"
+#line 870 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -3301,9 +3523,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 81:
 YY_RULE_SETUP
-#line 821 "dhcp4_lexer.ll"
+#line 886 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3313,9 +3535,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 82:
 YY_RULE_SETUP
-#line 830 "dhcp4_lexer.ll"
+#line 895 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3325,9 +3547,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 83:
 YY_RULE_SETUP
-#line 839 "dhcp4_lexer.ll"
+#line 904 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3337,9 +3559,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 84:
 YY_RULE_SETUP
-#line 848 "dhcp4_lexer.ll"
+#line 913 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -3349,9 +3571,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 85:
 YY_RULE_SETUP
-#line 857 "dhcp4_lexer.ll"
+#line 922 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3374,9 +3596,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 86:
 YY_RULE_SETUP
-#line 879 "dhcp4_lexer.ll"
+#line 944 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3399,9 +3621,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 87:
 YY_RULE_SETUP
-#line 901 "dhcp4_lexer.ll"
+#line 966 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3411,9 +3633,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 88:
 YY_RULE_SETUP
-#line 910 "dhcp4_lexer.ll"
+#line 975 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3424,9 +3646,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 89:
 YY_RULE_SETUP
-#line 920 "dhcp4_lexer.ll"
+#line 985 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3436,9 +3658,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 90:
 YY_RULE_SETUP
-#line 929 "dhcp4_lexer.ll"
+#line 994 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3450,9 +3672,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 91:
 YY_RULE_SETUP
-#line 940 "dhcp4_lexer.ll"
+#line 1005 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3462,9 +3684,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 92:
 YY_RULE_SETUP
-#line 949 "dhcp4_lexer.ll"
+#line 1014 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3474,9 +3696,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 93:
 YY_RULE_SETUP
-#line 958 "dhcp4_lexer.ll"
+#line 1023 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3486,9 +3708,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 94:
 YY_RULE_SETUP
-#line 967 "dhcp4_lexer.ll"
+#line 1032 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3498,9 +3720,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 95:
 YY_RULE_SETUP
-#line 976 "dhcp4_lexer.ll"
+#line 1041 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3510,9 +3732,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 96:
 YY_RULE_SETUP
-#line 985 "dhcp4_lexer.ll"
+#line 1050 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3523,9 +3745,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 97:
 YY_RULE_SETUP
-#line 995 "dhcp4_lexer.ll"
+#line 1060 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3535,9 +3757,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 98:
 YY_RULE_SETUP
-#line 1004 "dhcp4_lexer.ll"
+#line 1069 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3549,9 +3771,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 99:
 YY_RULE_SETUP
-#line 1015 "dhcp4_lexer.ll"
+#line 1080 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3563,9 +3785,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 100:
 YY_RULE_SETUP
-#line 1026 "dhcp4_lexer.ll"
+#line 1091 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3577,9 +3799,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 101:
 YY_RULE_SETUP
-#line 1038 "dhcp4_lexer.ll"
+#line 1103 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3589,9 +3811,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 102:
 YY_RULE_SETUP
-#line 1047 "dhcp4_lexer.ll"
+#line 1112 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3602,9 +3824,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 103:
 YY_RULE_SETUP
-#line 1057 "dhcp4_lexer.ll"
+#line 1122 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3614,9 +3836,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 104:
 YY_RULE_SETUP
-#line 1066 "dhcp4_lexer.ll"
+#line 1131 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3626,9 +3848,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 105:
 YY_RULE_SETUP
-#line 1075 "dhcp4_lexer.ll"
+#line 1140 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3638,9 +3860,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 106:
 YY_RULE_SETUP
-#line 1084 "dhcp4_lexer.ll"
+#line 1149 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3650,9 +3872,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 107:
 YY_RULE_SETUP
-#line 1093 "dhcp4_lexer.ll"
+#line 1158 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3662,9 +3884,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 108:
 YY_RULE_SETUP
-#line 1102 "dhcp4_lexer.ll"
+#line 1167 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3674,9 +3896,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 109:
 YY_RULE_SETUP
-#line 1111 "dhcp4_lexer.ll"
+#line 1176 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3686,9 +3908,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 110:
 YY_RULE_SETUP
-#line 1120 "dhcp4_lexer.ll"
+#line 1185 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3698,9 +3920,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 111:
 YY_RULE_SETUP
-#line 1129 "dhcp4_lexer.ll"
+#line 1194 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3711,9 +3933,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 112:
 YY_RULE_SETUP
-#line 1139 "dhcp4_lexer.ll"
+#line 1204 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3725,9 +3947,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 113:
 YY_RULE_SETUP
-#line 1150 "dhcp4_lexer.ll"
+#line 1215 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3740,9 +3962,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 114:
 YY_RULE_SETUP
-#line 1162 "dhcp4_lexer.ll"
+#line 1227 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3752,9 +3974,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 115:
 YY_RULE_SETUP
-#line 1171 "dhcp4_lexer.ll"
+#line 1236 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3764,9 +3986,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 116:
 YY_RULE_SETUP
-#line 1180 "dhcp4_lexer.ll"
+#line 1245 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3777,9 +3999,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 117:
 YY_RULE_SETUP
-#line 1190 "dhcp4_lexer.ll"
+#line 1255 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3790,9 +4012,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 118:
 YY_RULE_SETUP
-#line 1200 "dhcp4_lexer.ll"
+#line 1265 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3803,9 +4025,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 119:
 YY_RULE_SETUP
-#line 1210 "dhcp4_lexer.ll"
+#line 1275 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3816,9 +4038,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 120:
 YY_RULE_SETUP
-#line 1220 "dhcp4_lexer.ll"
+#line 1285 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3829,9 +4051,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 121:
 YY_RULE_SETUP
-#line 1230 "dhcp4_lexer.ll"
+#line 1295 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3842,9 +4064,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 122:
 YY_RULE_SETUP
-#line 1240 "dhcp4_lexer.ll"
+#line 1305 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -3854,9 +4076,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 123:
 YY_RULE_SETUP
-#line 1249 "dhcp4_lexer.ll"
+#line 1314 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3867,9 +4089,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 124:
 YY_RULE_SETUP
-#line 1259 "dhcp4_lexer.ll"
+#line 1324 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3879,9 +4101,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 125:
 YY_RULE_SETUP
-#line 1268 "dhcp4_lexer.ll"
+#line 1333 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3891,9 +4113,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 126:
 YY_RULE_SETUP
-#line 1277 "dhcp4_lexer.ll"
+#line 1342 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3903,9 +4125,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 127:
 YY_RULE_SETUP
-#line 1286 "dhcp4_lexer.ll"
+#line 1351 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3915,9 +4137,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 128:
 YY_RULE_SETUP
-#line 1295 "dhcp4_lexer.ll"
+#line 1360 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3928,9 +4150,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 129:
 YY_RULE_SETUP
-#line 1305 "dhcp4_lexer.ll"
+#line 1370 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3941,9 +4163,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 130:
 YY_RULE_SETUP
-#line 1315 "dhcp4_lexer.ll"
+#line 1380 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3953,9 +4175,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 131:
 YY_RULE_SETUP
-#line 1324 "dhcp4_lexer.ll"
+#line 1389 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3965,9 +4187,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 132:
 YY_RULE_SETUP
-#line 1334 "dhcp4_lexer.ll"
+#line 1399 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3977,9 +4199,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 133:
 YY_RULE_SETUP
-#line 1343 "dhcp4_lexer.ll"
+#line 1408 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3989,9 +4211,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 134:
 YY_RULE_SETUP
-#line 1352 "dhcp4_lexer.ll"
+#line 1417 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4001,9 +4223,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 135:
 YY_RULE_SETUP
-#line 1361 "dhcp4_lexer.ll"
+#line 1426 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4013,9 +4235,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 136:
 YY_RULE_SETUP
-#line 1370 "dhcp4_lexer.ll"
+#line 1435 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4025,9 +4247,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 137:
 YY_RULE_SETUP
-#line 1379 "dhcp4_lexer.ll"
+#line 1444 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4037,9 +4259,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 138:
 YY_RULE_SETUP
-#line 1388 "dhcp4_lexer.ll"
+#line 1453 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4049,9 +4271,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 139:
 YY_RULE_SETUP
-#line 1397 "dhcp4_lexer.ll"
+#line 1462 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4061,9 +4283,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 140:
 YY_RULE_SETUP
-#line 1406 "dhcp4_lexer.ll"
+#line 1471 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4073,9 +4295,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 141:
 YY_RULE_SETUP
-#line 1415 "dhcp4_lexer.ll"
+#line 1480 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4085,9 +4307,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 142:
 YY_RULE_SETUP
-#line 1424 "dhcp4_lexer.ll"
+#line 1489 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4097,9 +4319,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 143:
 YY_RULE_SETUP
-#line 1433 "dhcp4_lexer.ll"
+#line 1498 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_MULTI_THREADING:
@@ -4109,9 +4331,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 144:
 YY_RULE_SETUP
-#line 1442 "dhcp4_lexer.ll"
+#line 1507 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_MULTI_THREADING:
@@ -4121,9 +4343,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 145:
 YY_RULE_SETUP
-#line 1451 "dhcp4_lexer.ll"
+#line 1516 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_MULTI_THREADING:
@@ -4133,9 +4355,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 146:
 YY_RULE_SETUP
-#line 1460 "dhcp4_lexer.ll"
+#line 1525 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4145,9 +4367,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 147:
 YY_RULE_SETUP
-#line 1469 "dhcp4_lexer.ll"
+#line 1534 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -4157,9 +4379,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 148:
 YY_RULE_SETUP
-#line 1478 "dhcp4_lexer.ll"
+#line 1543 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -4169,9 +4391,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 149:
 YY_RULE_SETUP
-#line 1487 "dhcp4_lexer.ll"
+#line 1552 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4181,9 +4403,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 150:
 YY_RULE_SETUP
-#line 1496 "dhcp4_lexer.ll"
+#line 1561 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4193,9 +4415,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 151:
 YY_RULE_SETUP
-#line 1505 "dhcp4_lexer.ll"
+#line 1570 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4205,9 +4427,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 152:
 YY_RULE_SETUP
-#line 1514 "dhcp4_lexer.ll"
+#line 1579 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4217,9 +4439,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 153:
 YY_RULE_SETUP
-#line 1523 "dhcp4_lexer.ll"
+#line 1588 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4229,9 +4451,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 154:
 YY_RULE_SETUP
-#line 1532 "dhcp4_lexer.ll"
+#line 1597 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4241,9 +4463,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 155:
 YY_RULE_SETUP
-#line 1541 "dhcp4_lexer.ll"
+#line 1606 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4253,9 +4475,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 156:
 YY_RULE_SETUP
-#line 1550 "dhcp4_lexer.ll"
+#line 1615 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4265,9 +4487,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 157:
 YY_RULE_SETUP
-#line 1559 "dhcp4_lexer.ll"
+#line 1624 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4277,9 +4499,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 158:
 YY_RULE_SETUP
-#line 1568 "dhcp4_lexer.ll"
+#line 1633 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4289,9 +4511,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 159:
 YY_RULE_SETUP
-#line 1577 "dhcp4_lexer.ll"
+#line 1642 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4301,9 +4523,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 160:
 YY_RULE_SETUP
-#line 1586 "dhcp4_lexer.ll"
+#line 1651 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4313,9 +4535,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 161:
 YY_RULE_SETUP
-#line 1595 "dhcp4_lexer.ll"
+#line 1660 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4325,9 +4547,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 162:
 YY_RULE_SETUP
-#line 1604 "dhcp4_lexer.ll"
+#line 1669 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4337,9 +4559,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 163:
 YY_RULE_SETUP
-#line 1613 "dhcp4_lexer.ll"
+#line 1678 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4349,9 +4571,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 164:
 YY_RULE_SETUP
-#line 1622 "dhcp4_lexer.ll"
+#line 1687 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4361,9 +4583,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 165:
 YY_RULE_SETUP
-#line 1631 "dhcp4_lexer.ll"
+#line 1696 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4373,9 +4595,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 166:
 YY_RULE_SETUP
-#line 1640 "dhcp4_lexer.ll"
+#line 1705 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4385,9 +4607,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 167:
 YY_RULE_SETUP
-#line 1649 "dhcp4_lexer.ll"
+#line 1714 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4400,9 +4622,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 168:
 YY_RULE_SETUP
-#line 1661 "dhcp4_lexer.ll"
+#line 1726 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4415,9 +4637,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 169:
 YY_RULE_SETUP
-#line 1673 "dhcp4_lexer.ll"
+#line 1738 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4428,9 +4650,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 163:
+case 170:
 YY_RULE_SETUP
-#line 1683 "dhcp4_lexer.ll"
+#line 1748 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4441,9 +4663,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 164:
+case 171:
 YY_RULE_SETUP
-#line 1693 "dhcp4_lexer.ll"
+#line 1758 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -4454,9 +4676,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 165:
+case 172:
 YY_RULE_SETUP
-#line 1703 "dhcp4_lexer.ll"
+#line 1768 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4467,9 +4689,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 166:
+case 173:
 YY_RULE_SETUP
-#line 1713 "dhcp4_lexer.ll"
+#line 1778 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4480,9 +4702,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 167:
+case 174:
 YY_RULE_SETUP
-#line 1723 "dhcp4_lexer.ll"
+#line 1788 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4493,9 +4715,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 168:
+case 175:
 YY_RULE_SETUP
-#line 1733 "dhcp4_lexer.ll"
+#line 1798 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4506,9 +4728,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 169:
+case 176:
 YY_RULE_SETUP
-#line 1743 "dhcp4_lexer.ll"
+#line 1808 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4519,9 +4741,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 170:
+case 177:
 YY_RULE_SETUP
-#line 1753 "dhcp4_lexer.ll"
+#line 1818 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4532,9 +4754,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 171:
+case 178:
 YY_RULE_SETUP
-#line 1763 "dhcp4_lexer.ll"
+#line 1828 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4544,9 +4766,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 172:
+case 179:
 YY_RULE_SETUP
-#line 1772 "dhcp4_lexer.ll"
+#line 1837 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4556,9 +4778,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 173:
+case 180:
 YY_RULE_SETUP
-#line 1781 "dhcp4_lexer.ll"
+#line 1846 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4568,9 +4790,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 174:
+case 181:
 YY_RULE_SETUP
-#line 1790 "dhcp4_lexer.ll"
+#line 1855 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4580,9 +4802,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 175:
+case 182:
 YY_RULE_SETUP
-#line 1799 "dhcp4_lexer.ll"
+#line 1864 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4592,9 +4814,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 176:
+case 183:
 YY_RULE_SETUP
-#line 1808 "dhcp4_lexer.ll"
+#line 1873 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4604,9 +4826,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 177:
+case 184:
 YY_RULE_SETUP
-#line 1817 "dhcp4_lexer.ll"
+#line 1882 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4616,9 +4838,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 178:
+case 185:
 YY_RULE_SETUP
-#line 1826 "dhcp4_lexer.ll"
+#line 1891 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4630,9 +4852,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 179:
+case 186:
 YY_RULE_SETUP
-#line 1837 "dhcp4_lexer.ll"
+#line 1902 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4644,9 +4866,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 180:
+case 187:
 YY_RULE_SETUP
-#line 1848 "dhcp4_lexer.ll"
+#line 1913 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4660,9 +4882,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 181:
+case 188:
 YY_RULE_SETUP
-#line 1861 "dhcp4_lexer.ll"
+#line 1926 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4676,9 +4898,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 182:
+case 189:
 YY_RULE_SETUP
-#line 1874 "dhcp4_lexer.ll"
+#line 1939 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4692,9 +4914,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 183:
+case 190:
 YY_RULE_SETUP
-#line 1887 "dhcp4_lexer.ll"
+#line 1952 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4794,65 +5016,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 184:
-/* rule 184 can match eol */
+case 191:
+/* rule 191 can match eol */
 YY_RULE_SETUP
-#line 1986 "dhcp4_lexer.ll"
+#line 2051 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 185:
-/* rule 185 can match eol */
+case 192:
+/* rule 192 can match eol */
 YY_RULE_SETUP
-#line 1991 "dhcp4_lexer.ll"
+#line 2056 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 186:
+case 193:
 YY_RULE_SETUP
-#line 1996 "dhcp4_lexer.ll"
+#line 2061 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 187:
+case 194:
 YY_RULE_SETUP
-#line 2001 "dhcp4_lexer.ll"
+#line 2066 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 188:
+case 195:
 YY_RULE_SETUP
-#line 2002 "dhcp4_lexer.ll"
+#line 2067 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 189:
+case 196:
 YY_RULE_SETUP
-#line 2003 "dhcp4_lexer.ll"
+#line 2068 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 190:
+case 197:
 YY_RULE_SETUP
-#line 2004 "dhcp4_lexer.ll"
+#line 2069 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 191:
+case 198:
 YY_RULE_SETUP
-#line 2005 "dhcp4_lexer.ll"
+#line 2070 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 192:
+case 199:
 YY_RULE_SETUP
-#line 2006 "dhcp4_lexer.ll"
+#line 2071 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 193:
+case 200:
 YY_RULE_SETUP
-#line 2008 "dhcp4_lexer.ll"
+#line 2073 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4871,9 +5093,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 194:
+case 201:
 YY_RULE_SETUP
-#line 2026 "dhcp4_lexer.ll"
+#line 2091 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4887,43 +5109,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 195:
+case 202:
 YY_RULE_SETUP
-#line 2039 "dhcp4_lexer.ll"
+#line 2104 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 196:
+case 203:
 YY_RULE_SETUP
-#line 2044 "dhcp4_lexer.ll"
+#line 2109 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 197:
+case 204:
 YY_RULE_SETUP
-#line 2048 "dhcp4_lexer.ll"
+#line 2113 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 198:
+case 205:
 YY_RULE_SETUP
-#line 2050 "dhcp4_lexer.ll"
+#line 2115 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 199:
+case 206:
 YY_RULE_SETUP
-#line 2052 "dhcp4_lexer.ll"
+#line 2117 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 200:
+case 207:
 YY_RULE_SETUP
-#line 2054 "dhcp4_lexer.ll"
+#line 2119 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 2056 "dhcp4_lexer.ll"
+#line 2121 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -4947,12 +5169,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 201:
+case 208:
 YY_RULE_SETUP
-#line 2079 "dhcp4_lexer.ll"
+#line 2144 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4956 "dhcp4_lexer.cc"
+#line 5178 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -5271,7 +5493,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1839 )
+			if ( yy_current_state >= 1900 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5304,11 +5526,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1839 )
+		if ( yy_current_state >= 1900 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1838);
+	yy_is_jam = (yy_current_state == 1899);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -6057,8 +6279,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 2079 "dhcp4_lexer.ll"
-
+#line 2144 "dhcp4_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -6160,4 +6381,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
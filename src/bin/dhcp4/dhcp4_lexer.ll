@@ -590,6 +590,42 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"durability\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_DURABILITY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("durability", driver.loc_);
+    }
+}
+
+\"lfc-format\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-format", driver.loc_);
+    }
+}
+
+\"lfc-mode\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_MODE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-mode", driver.loc_);
+    }
+}
+
+\"lfc-write-rate\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_WRITE_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-write-rate", driver.loc_);
+    }
+}
+
 \"valid-lifetime\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -768,6 +804,35 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"allocator\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+    case isc::dhcp::Parser4Context::SUBNET4:
+    case isc::dhcp::Parser4Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp4Parser::make_ALLOCATOR(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("allocator", driver.loc_);
+    }
+}
+
+\"free-lease-index\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_FREE_LEASE_INDEX(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("free-lease-index", driver.loc_);
+    }
+}
+
+\"option-arena\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return isc::dhcp::Dhcp4Parser::make_OPTION_ARENA(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("option-arena", driver.loc_);
+    }
+}
+
 \"shared-networks\" {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -253,30 +253,30 @@ namespace isc { namespace dhcp {
   {
       switch (that.type_get ())
     {
-      case 211: // value
-      case 215: // map_value
-      case 256: // ddns_replace_client_name_value
-      case 278: // socket_type
-      case 281: // outbound_interface_value
-      case 303: // db_type
-      case 397: // hr_mode
-      case 552: // ncr_protocol_value
+      case 218: // value
+      case 222: // map_value
+      case 263: // ddns_replace_client_name_value
+      case 289: // socket_type
+      case 292: // outbound_interface_value
+      case 314: // db_type
+      case 415: // hr_mode
+      case 570: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 194: // "boolean"
+      case 201: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 193: // "floating point"
+      case 200: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 192: // "integer"
+      case 199: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 191: // "constant string"
+      case 198: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -295,30 +295,30 @@ namespace isc { namespace dhcp {
     state = that.state;
       switch (that.type_get ())
     {
-      case 211: // value
-      case 215: // map_value
-      case 256: // ddns_replace_client_name_value
-      case 278: // socket_type
-      case 281: // outbound_interface_value
-      case 303: // db_type
-      case 397: // hr_mode
-      case 552: // ncr_protocol_value
+      case 218: // value
+      case 222: // map_value
+      case 263: // ddns_replace_client_name_value
+      case 289: // socket_type
+      case 292: // outbound_interface_value
+      case 314: // db_type
+      case 415: // hr_mode
+      case 570: // ncr_protocol_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 194: // "boolean"
+      case 201: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 193: // "floating point"
+      case 200: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 192: // "integer"
+      case 199: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 191: // "constant string"
+      case 198: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -358,86 +358,86 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-            case 191: // "constant string"
+            case 198: // "constant string"
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< std::string > (); }
 #line 366 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 192: // "integer"
+      case 199: // "integer"
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< int64_t > (); }
 #line 373 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 193: // "floating point"
+      case 200: // "floating point"
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< double > (); }
 #line 380 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 194: // "boolean"
+      case 201: // "boolean"
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< bool > (); }
 #line 387 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 211: // value
+      case 218: // value
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 394 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 215: // map_value
+      case 222: // map_value
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 401 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 256: // ddns_replace_client_name_value
+      case 263: // ddns_replace_client_name_value
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 408 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 278: // socket_type
+      case 289: // socket_type
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 415 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 281: // outbound_interface_value
+      case 292: // outbound_interface_value
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 422 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 303: // db_type
+      case 314: // db_type
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 429 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 397: // hr_mode
+      case 415: // hr_mode
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 436 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 552: // ncr_protocol_value
+      case 570: // ncr_protocol_value
 
-#line 274 "dhcp4_parser.yy" // lalr1.cc:636
+#line 281 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 443 "dhcp4_parser.cc" // lalr1.cc:636
         break;
@@ -639,30 +639,30 @@ namespace isc { namespace dhcp {
          when using variants.  */
         switch (yyr1_[yyn])
     {
-      case 211: // value
-      case 215: // map_value
-      case 256: // ddns_replace_client_name_value
-      case 278: // socket_type
-      case 281: // outbound_interface_value
-      case 303: // db_type
-      case 397: // hr_mode
-      case 552: // ncr_protocol_value
+      case 218: // value
+      case 222: // map_value
+      case 263: // ddns_replace_client_name_value
+      case 289: // socket_type
+      case 292: // outbound_interface_value
+      case 314: // db_type
+      case 415: // hr_mode
+      case 570: // ncr_protocol_value
         yylhs.value.build< ElementPtr > ();
         break;
 
-      case 194: // "boolean"
+      case 201: // "boolean"
         yylhs.value.build< bool > ();
         break;
 
-      case 193: // "floating point"
+      case 200: // "floating point"
         yylhs.value.build< double > ();
         break;
 
-      case 192: // "integer"
+      case 199: // "integer"
         yylhs.value.build< int64_t > ();
         break;
 
-      case 191: // "constant string"
+      case 198: // "constant string"
         yylhs.value.build< std::string > ();
         break;
 
@@ -684,133 +684,133 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 283 "dhcp4_parser.yy" // lalr1.cc:859
+#line 290 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 690 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 4:
-#line 284 "dhcp4_parser.yy" // lalr1.cc:859
+#line 291 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG; }
 #line 696 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 6:
-#line 285 "dhcp4_parser.yy" // lalr1.cc:859
+#line 292 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP4; }
 #line 702 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 8:
-#line 286 "dhcp4_parser.yy" // lalr1.cc:859
+#line 293 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 708 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 10:
-#line 287 "dhcp4_parser.yy" // lalr1.cc:859
+#line 294 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.SUBNET4; }
 #line 714 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 12:
-#line 288 "dhcp4_parser.yy" // lalr1.cc:859
+#line 295 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.POOLS; }
 #line 720 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 14:
-#line 289 "dhcp4_parser.yy" // lalr1.cc:859
+#line 296 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 726 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 16:
-#line 290 "dhcp4_parser.yy" // lalr1.cc:859
+#line 297 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP4; }
 #line 732 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 18:
-#line 291 "dhcp4_parser.yy" // lalr1.cc:859
+#line 298 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 738 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 20:
-#line 292 "dhcp4_parser.yy" // lalr1.cc:859
+#line 299 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 744 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 22:
-#line 293 "dhcp4_parser.yy" // lalr1.cc:859
+#line 300 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 750 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 24:
-#line 294 "dhcp4_parser.yy" // lalr1.cc:859
+#line 301 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 756 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 26:
-#line 295 "dhcp4_parser.yy" // lalr1.cc:859
+#line 302 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.LOGGING; }
 #line 762 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 28:
-#line 296 "dhcp4_parser.yy" // lalr1.cc:859
+#line 303 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG_CONTROL; }
 #line 768 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 30:
-#line 304 "dhcp4_parser.yy" // lalr1.cc:859
+#line 311 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 774 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 31:
-#line 305 "dhcp4_parser.yy" // lalr1.cc:859
+#line 312 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 780 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 32:
-#line 306 "dhcp4_parser.yy" // lalr1.cc:859
+#line 313 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 786 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 33:
-#line 307 "dhcp4_parser.yy" // lalr1.cc:859
+#line 314 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 792 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 34:
-#line 308 "dhcp4_parser.yy" // lalr1.cc:859
+#line 315 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 798 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 35:
-#line 309 "dhcp4_parser.yy" // lalr1.cc:859
+#line 316 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 804 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 36:
-#line 310 "dhcp4_parser.yy" // lalr1.cc:859
+#line 317 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 810 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 37:
-#line 313 "dhcp4_parser.yy" // lalr1.cc:859
+#line 320 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
@@ -819,7 +819,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 38:
-#line 318 "dhcp4_parser.yy" // lalr1.cc:859
+#line 325 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -830,7 +830,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 39:
-#line 323 "dhcp4_parser.yy" // lalr1.cc:859
+#line 330 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -840,13 +840,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 40:
-#line 329 "dhcp4_parser.yy" // lalr1.cc:859
+#line 336 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 846 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 43:
-#line 336 "dhcp4_parser.yy" // lalr1.cc:859
+#line 343 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
@@ -855,7 +855,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 44:
-#line 340 "dhcp4_parser.yy" // lalr1.cc:859
+#line 347 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -865,7 +865,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 45:
-#line 347 "dhcp4_parser.yy" // lalr1.cc:859
+#line 354 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -874,7 +874,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 46:
-#line 350 "dhcp4_parser.yy" // lalr1.cc:859
+#line 357 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -882,7 +882,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 49:
-#line 358 "dhcp4_parser.yy" // lalr1.cc:859
+#line 365 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -891,7 +891,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 50:
-#line 362 "dhcp4_parser.yy" // lalr1.cc:859
+#line 369 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -900,7 +900,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 51:
-#line 369 "dhcp4_parser.yy" // lalr1.cc:859
+#line 376 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // List parsing about to start
 }
@@ -908,7 +908,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 52:
-#line 371 "dhcp4_parser.yy" // lalr1.cc:859
+#line 378 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -917,7 +917,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 380 "dhcp4_parser.yy" // lalr1.cc:859
+#line 387 "dhcp4_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -926,7 +926,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 56:
-#line 384 "dhcp4_parser.yy" // lalr1.cc:859
+#line 391 "dhcp4_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -935,7 +935,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 395 "dhcp4_parser.yy" // lalr1.cc:859
+#line 402 "dhcp4_parser.yy" // lalr1.cc:859
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as< std::string > ();
@@ -946,7 +946,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 58:
-#line 405 "dhcp4_parser.yy" // lalr1.cc:859
+#line 412 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -957,7 +957,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 59:
-#line 410 "dhcp4_parser.yy" // lalr1.cc:859
+#line 417 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -970,7 +970,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 68:
-#line 434 "dhcp4_parser.yy" // lalr1.cc:859
+#line 441 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -983,7 +983,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 69:
-#line 441 "dhcp4_parser.yy" // lalr1.cc:859
+#line 448 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -993,7 +993,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 70:
-#line 449 "dhcp4_parser.yy" // lalr1.cc:859
+#line 456 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1003,7 +1003,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 71:
-#line 453 "dhcp4_parser.yy" // lalr1.cc:859
+#line 460 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     // parsing completed
@@ -1011,8 +1011,8 @@ namespace isc { namespace dhcp {
 #line 1012 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 126:
-#line 518 "dhcp4_parser.yy" // lalr1.cc:859
+  case 129:
+#line 528 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1020,8 +1020,8 @@ namespace isc { namespace dhcp {
 #line 1021 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 127:
-#line 523 "dhcp4_parser.yy" // lalr1.cc:859
+  case 130:
+#line 533 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-valid-lifetime", prf);
@@ -1029,8 +1029,8 @@ namespace isc { namespace dhcp {
 #line 1030 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 128:
-#line 528 "dhcp4_parser.yy" // lalr1.cc:859
+  case 131:
+#line 538 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-valid-lifetime", prf);
@@ -1038,8 +1038,8 @@ namespace isc { namespace dhcp {
 #line 1039 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 129:
-#line 533 "dhcp4_parser.yy" // lalr1.cc:859
+  case 132:
+#line 543 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1047,8 +1047,8 @@ namespace isc { namespace dhcp {
 #line 1048 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 130:
-#line 538 "dhcp4_parser.yy" // lalr1.cc:859
+  case 133:
+#line 548 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1056,8 +1056,8 @@ namespace isc { namespace dhcp {
 #line 1057 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 131:
-#line 543 "dhcp4_parser.yy" // lalr1.cc:859
+  case 134:
+#line 553 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr ctt(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("calculate-tee-times", ctt);
@@ -1065,8 +1065,8 @@ namespace isc { namespace dhcp {
 #line 1066 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 132:
-#line 548 "dhcp4_parser.yy" // lalr1.cc:859
+  case 135:
+#line 558 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr t1(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t1-percent", t1);
@@ -1074,8 +1074,8 @@ namespace isc { namespace dhcp {
 #line 1075 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 133:
-#line 553 "dhcp4_parser.yy" // lalr1.cc:859
+  case 136:
+#line 563 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr t2(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t2-percent", t2);
@@ -1083,8 +1083,8 @@ namespace isc { namespace dhcp {
 #line 1084 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 134:
-#line 558 "dhcp4_parser.yy" // lalr1.cc:859
+  case 137:
+#line 568 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1092,16 +1092,16 @@ namespace isc { namespace dhcp {
 #line 1093 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 135:
-#line 563 "dhcp4_parser.yy" // lalr1.cc:859
+  case 138:
+#line 573 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1101 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 136:
-#line 565 "dhcp4_parser.yy" // lalr1.cc:859
+  case 139:
+#line 575 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr stag(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
@@ -1110,8 +1110,8 @@ namespace isc { namespace dhcp {
 #line 1111 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 137:
-#line 571 "dhcp4_parser.yy" // lalr1.cc:859
+  case 140:
+#line 581 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr echo(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
@@ -1119,8 +1119,8 @@ namespace isc { namespace dhcp {
 #line 1120 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 138:
-#line 576 "dhcp4_parser.yy" // lalr1.cc:859
+  case 141:
+#line 586 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr match(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
@@ -1128,8 +1128,8 @@ namespace isc { namespace dhcp {
 #line 1129 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 139:
-#line 581 "dhcp4_parser.yy" // lalr1.cc:859
+  case 142:
+#line 591 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("authoritative", prf);
@@ -1137,8 +1137,8 @@ namespace isc { namespace dhcp {
 #line 1138 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 140:
-#line 586 "dhcp4_parser.yy" // lalr1.cc:859
+  case 143:
+#line 596 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-send-updates", b);
@@ -1146,8 +1146,8 @@ namespace isc { namespace dhcp {
 #line 1147 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 141:
-#line 591 "dhcp4_parser.yy" // lalr1.cc:859
+  case 144:
+#line 601 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-no-update", b);
@@ -1155,8 +1155,8 @@ namespace isc { namespace dhcp {
 #line 1156 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 142:
-#line 596 "dhcp4_parser.yy" // lalr1.cc:859
+  case 145:
+#line 606 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-client-update", b);
@@ -1164,16 +1164,16 @@ namespace isc { namespace dhcp {
 #line 1165 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 143:
-#line 601 "dhcp4_parser.yy" // lalr1.cc:859
+  case 146:
+#line 611 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
 #line 1173 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 144:
-#line 603 "dhcp4_parser.yy" // lalr1.cc:859
+  case 147:
+#line 613 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ddns-replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1181,40 +1181,40 @@ namespace isc { namespace dhcp {
 #line 1182 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 145:
-#line 609 "dhcp4_parser.yy" // lalr1.cc:859
+  case 148:
+#line 619 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
 #line 1190 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 146:
-#line 612 "dhcp4_parser.yy" // lalr1.cc:859
+  case 149:
+#line 622 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
 #line 1198 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 147:
-#line 615 "dhcp4_parser.yy" // lalr1.cc:859
+  case 150:
+#line 625 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
 #line 1206 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 148:
-#line 618 "dhcp4_parser.yy" // lalr1.cc:859
+  case 151:
+#line 628 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
 #line 1214 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 149:
-#line 621 "dhcp4_parser.yy" // lalr1.cc:859
+  case 152:
+#line 631 "dhcp4_parser.yy" // lalr1.cc:859
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
@@ -1222,16 +1222,16 @@ namespace isc { namespace dhcp {
 #line 1223 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 150:
-#line 627 "dhcp4_parser.yy" // lalr1.cc:859
+  case 153:
+#line 637 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1231 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 151:
-#line 629 "dhcp4_parser.yy" // lalr1.cc:859
+  case 154:
+#line 639 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-generated-prefix", s);
@@ -1240,16 +1240,16 @@ namespace isc { namespace dhcp {
 #line 1241 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 152:
-#line 635 "dhcp4_parser.yy" // lalr1.cc:859
+  case 155:
+#line 645 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1249 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 153:
-#line 637 "dhcp4_parser.yy" // lalr1.cc:859
+  case 156:
+#line 647 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-qualifying-suffix", s);
@@ -1258,16 +1258,16 @@ namespace isc { namespace dhcp {
 #line 1259 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 154:
-#line 643 "dhcp4_parser.yy" // lalr1.cc:859
+  case 157:
+#line 653 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1267 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 155:
-#line 645 "dhcp4_parser.yy" // lalr1.cc:859
+  case 158:
+#line 655 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
@@ -1276,16 +1276,16 @@ namespace isc { namespace dhcp {
 #line 1277 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 156:
-#line 651 "dhcp4_parser.yy" // lalr1.cc:859
+  case 159:
+#line 661 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1285 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 157:
-#line 653 "dhcp4_parser.yy" // lalr1.cc:859
+  case 160:
+#line 663 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
@@ -1294,8 +1294,8 @@ namespace isc { namespace dhcp {
 #line 1295 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 158:
-#line 659 "dhcp4_parser.yy" // lalr1.cc:859
+  case 161:
+#line 669 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("store-extended-info", b);
@@ -1303,207 +1303,243 @@ namespace isc { namespace dhcp {
 #line 1304 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 159:
-#line 664 "dhcp4_parser.yy" // lalr1.cc:859
+  case 162:
+#line 674 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1312 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 163:
+#line 676 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr a(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("allocator", a);
+    ctx.leave();
+}
+#line 1322 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 164:
+#line 682 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("free-lease-index", b);
+}
+#line 1331 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 165:
+#line 687 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("option-arena", b);
+}
+#line 1340 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 166:
+#line 692 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr count(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("statistic-default-sample-count", count);
 }
-#line 1313 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1349 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 160:
-#line 669 "dhcp4_parser.yy" // lalr1.cc:859
+  case 167:
+#line 697 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr age(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("statistic-default-sample-age", age);
 }
-#line 1322 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1358 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 161:
-#line 674 "dhcp4_parser.yy" // lalr1.cc:859
+  case 168:
+#line 702 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1333 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1369 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 162:
-#line 679 "dhcp4_parser.yy" // lalr1.cc:859
+  case 169:
+#line 707 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1343 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1379 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 172:
-#line 698 "dhcp4_parser.yy" // lalr1.cc:859
+  case 179:
+#line 726 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1353 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1389 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 173:
-#line 702 "dhcp4_parser.yy" // lalr1.cc:859
+  case 180:
+#line 730 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1362 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1398 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 174:
-#line 707 "dhcp4_parser.yy" // lalr1.cc:859
+  case 181:
+#line 735 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1373 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1409 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 175:
-#line 712 "dhcp4_parser.yy" // lalr1.cc:859
+  case 182:
+#line 740 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1382 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1418 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 176:
-#line 717 "dhcp4_parser.yy" // lalr1.cc:859
+  case 183:
+#line 745 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
-#line 1390 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1426 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 177:
-#line 719 "dhcp4_parser.yy" // lalr1.cc:859
+  case 184:
+#line 747 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1399 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1435 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 178:
-#line 724 "dhcp4_parser.yy" // lalr1.cc:859
+  case 185:
+#line 752 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
-#line 1405 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1441 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 179:
-#line 725 "dhcp4_parser.yy" // lalr1.cc:859
+  case 186:
+#line 753 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
-#line 1411 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1447 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 180:
-#line 728 "dhcp4_parser.yy" // lalr1.cc:859
+  case 187:
+#line 756 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.OUTBOUND_INTERFACE);
 }
-#line 1419 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1455 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 181:
-#line 730 "dhcp4_parser.yy" // lalr1.cc:859
+  case 188:
+#line 758 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("outbound-interface", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1428 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1464 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 182:
-#line 735 "dhcp4_parser.yy" // lalr1.cc:859
+  case 189:
+#line 763 "dhcp4_parser.yy" // lalr1.cc:859
     {
     yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("same-as-inbound", ctx.loc2pos(yystack_[0].location)));
 }
-#line 1436 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1472 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 183:
-#line 737 "dhcp4_parser.yy" // lalr1.cc:859
+  case 190:
+#line 765 "dhcp4_parser.yy" // lalr1.cc:859
     {
     yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("use-routing", ctx.loc2pos(yystack_[0].location)));
     }
-#line 1444 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1480 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 184:
-#line 741 "dhcp4_parser.yy" // lalr1.cc:859
+  case 191:
+#line 769 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1453 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1489 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 185:
-#line 747 "dhcp4_parser.yy" // lalr1.cc:859
+  case 192:
+#line 775 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1464 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1500 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 186:
-#line 752 "dhcp4_parser.yy" // lalr1.cc:859
+  case 193:
+#line 780 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1475 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1511 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 187:
-#line 759 "dhcp4_parser.yy" // lalr1.cc:859
+  case 194:
+#line 787 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1486 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1522 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 188:
-#line 764 "dhcp4_parser.yy" // lalr1.cc:859
+  case 195:
+#line 792 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1495 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1531 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 192:
-#line 774 "dhcp4_parser.yy" // lalr1.cc:859
+  case 199:
+#line 802 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1503 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1539 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 193:
-#line 776 "dhcp4_parser.yy" // lalr1.cc:859
+  case 200:
+#line 804 "dhcp4_parser.yy" // lalr1.cc:859
     {
 
     if ( (string(yystack_[0].value.as< std::string > ()) == "none") ||
@@ -1519,671 +1555,734 @@ namespace isc { namespace dhcp {
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1523 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1559 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 194:
-#line 792 "dhcp4_parser.yy" // lalr1.cc:859
+  case 201:
+#line 820 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1534 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1570 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 195:
-#line 797 "dhcp4_parser.yy" // lalr1.cc:859
+  case 202:
+#line 825 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1545 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1581 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 196:
-#line 804 "dhcp4_parser.yy" // lalr1.cc:859
+  case 203:
+#line 832 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1556 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1592 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 197:
-#line 809 "dhcp4_parser.yy" // lalr1.cc:859
+  case 204:
+#line 837 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1565 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1601 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 202:
-#line 822 "dhcp4_parser.yy" // lalr1.cc:859
+  case 209:
+#line 850 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1575 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1611 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 203:
-#line 826 "dhcp4_parser.yy" // lalr1.cc:859
+  case 210:
+#line 854 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1585 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1621 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 227:
-#line 859 "dhcp4_parser.yy" // lalr1.cc:859
+  case 238:
+#line 891 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1593 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1629 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 228:
-#line 861 "dhcp4_parser.yy" // lalr1.cc:859
+  case 239:
+#line 893 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1602 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1638 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 229:
-#line 866 "dhcp4_parser.yy" // lalr1.cc:859
+  case 240:
+#line 898 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1608 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1644 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 230:
-#line 867 "dhcp4_parser.yy" // lalr1.cc:859
+  case 241:
+#line 899 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1614 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1650 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 231:
-#line 868 "dhcp4_parser.yy" // lalr1.cc:859
+  case 242:
+#line 900 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1620 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1656 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 232:
-#line 869 "dhcp4_parser.yy" // lalr1.cc:859
+  case 243:
+#line 901 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1626 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1662 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 233:
-#line 872 "dhcp4_parser.yy" // lalr1.cc:859
+  case 244:
+#line 904 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1634 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1670 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 234:
-#line 874 "dhcp4_parser.yy" // lalr1.cc:859
+  case 245:
+#line 906 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1644 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1680 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 235:
-#line 880 "dhcp4_parser.yy" // lalr1.cc:859
+  case 246:
+#line 912 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1652 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1688 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 236:
-#line 882 "dhcp4_parser.yy" // lalr1.cc:859
+  case 247:
+#line 914 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1662 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1698 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 237:
-#line 888 "dhcp4_parser.yy" // lalr1.cc:859
+  case 248:
+#line 920 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1670 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1706 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 238:
-#line 890 "dhcp4_parser.yy" // lalr1.cc:859
+  case 249:
+#line 922 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1680 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1716 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 239:
-#line 896 "dhcp4_parser.yy" // lalr1.cc:859
+  case 250:
+#line 928 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1689 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1725 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 240:
-#line 901 "dhcp4_parser.yy" // lalr1.cc:859
+  case 251:
+#line 933 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1697 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1733 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 241:
-#line 903 "dhcp4_parser.yy" // lalr1.cc:859
+  case 252:
+#line 935 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1707 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1743 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 242:
-#line 909 "dhcp4_parser.yy" // lalr1.cc:859
+  case 253:
+#line 941 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1716 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1752 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 243:
-#line 914 "dhcp4_parser.yy" // lalr1.cc:859
+  case 254:
+#line 946 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1725 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1761 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 244:
-#line 919 "dhcp4_parser.yy" // lalr1.cc:859
+  case 255:
+#line 951 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1734 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1770 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 245:
-#line 924 "dhcp4_parser.yy" // lalr1.cc:859
+  case 256:
+#line 956 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1743 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1779 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 246:
-#line 929 "dhcp4_parser.yy" // lalr1.cc:859
+  case 257:
+#line 961 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1752 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1788 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 247:
-#line 934 "dhcp4_parser.yy" // lalr1.cc:859
+  case 258:
+#line 966 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1761 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1797 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 248:
-#line 939 "dhcp4_parser.yy" // lalr1.cc:859
+  case 259:
+#line 971 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1770 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1806 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 249:
-#line 944 "dhcp4_parser.yy" // lalr1.cc:859
+  case 260:
+#line 976 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1778 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1814 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 250:
-#line 946 "dhcp4_parser.yy" // lalr1.cc:859
+  case 261:
+#line 978 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1788 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1824 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 251:
-#line 952 "dhcp4_parser.yy" // lalr1.cc:859
+  case 262:
+#line 984 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1796 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1832 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 252:
-#line 954 "dhcp4_parser.yy" // lalr1.cc:859
+  case 263:
+#line 986 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1806 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1842 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 253:
-#line 960 "dhcp4_parser.yy" // lalr1.cc:859
+  case 264:
+#line 992 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1814 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1850 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 254:
-#line 962 "dhcp4_parser.yy" // lalr1.cc:859
+  case 265:
+#line 994 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
     ctx.leave();
 }
-#line 1824 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1860 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 255:
-#line 968 "dhcp4_parser.yy" // lalr1.cc:859
+  case 266:
+#line 1000 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1832 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1868 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 256:
-#line 970 "dhcp4_parser.yy" // lalr1.cc:859
+  case 267:
+#line 1002 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
     ctx.leave();
 }
-#line 1842 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1878 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 257:
-#line 976 "dhcp4_parser.yy" // lalr1.cc:859
+  case 268:
+#line 1008 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1851 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1887 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 258:
-#line 981 "dhcp4_parser.yy" // lalr1.cc:859
+  case 269:
+#line 1013 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1860 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1896 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 259:
-#line 986 "dhcp4_parser.yy" // lalr1.cc:859
+  case 270:
+#line 1018 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-row-errors", n);
 }
-#line 1869 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1905 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 260:
-#line 992 "dhcp4_parser.yy" // lalr1.cc:859
+  case 271:
+#line 1023 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1913 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 272:
+#line 1025 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("durability", d);
+    ctx.leave();
+}
+#line 1923 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 273:
+#line 1031 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1931 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 274:
+#line 1033 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr f(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-format", f);
+    ctx.leave();
+}
+#line 1941 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 275:
+#line 1039 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1949 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 276:
+#line 1041 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr m(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-mode", m);
+    ctx.leave();
+}
+#line 1959 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 277:
+#line 1047 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-write-rate", n);
+}
+#line 1968 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 278:
+#line 1053 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1880 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1979 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 261:
-#line 997 "dhcp4_parser.yy" // lalr1.cc:859
+  case 279:
+#line 1058 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1889 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1988 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 269:
-#line 1013 "dhcp4_parser.yy" // lalr1.cc:859
+  case 287:
+#line 1074 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1898 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1997 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 270:
-#line 1018 "dhcp4_parser.yy" // lalr1.cc:859
+  case 288:
+#line 1079 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1907 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2006 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 271:
-#line 1023 "dhcp4_parser.yy" // lalr1.cc:859
+  case 289:
+#line 1084 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1916 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2015 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 272:
-#line 1028 "dhcp4_parser.yy" // lalr1.cc:859
+  case 290:
+#line 1089 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1925 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2024 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 273:
-#line 1033 "dhcp4_parser.yy" // lalr1.cc:859
+  case 291:
+#line 1094 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1934 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2033 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 274:
-#line 1040 "dhcp4_parser.yy" // lalr1.cc:859
+  case 292:
+#line 1101 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr mt(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("multi-threading", mt);
     ctx.stack_.push_back(mt);
     ctx.enter(ctx.DHCP_MULTI_THREADING);
 }
-#line 1945 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2044 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 275:
-#line 1045 "dhcp4_parser.yy" // lalr1.cc:859
+  case 293:
+#line 1106 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The enable parameter is required.
     ctx.require("enable-multi-threading", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1956 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2055 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 284:
-#line 1064 "dhcp4_parser.yy" // lalr1.cc:859
+  case 302:
+#line 1125 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-multi-threading", b);
 }
-#line 1965 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2064 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 285:
-#line 1069 "dhcp4_parser.yy" // lalr1.cc:859
+  case 303:
+#line 1130 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("thread-pool-size", prf);
 }
-#line 1974 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2073 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 286:
-#line 1074 "dhcp4_parser.yy" // lalr1.cc:859
+  case 304:
+#line 1135 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("packet-queue-size", prf);
 }
-#line 1983 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2082 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 287:
-#line 1079 "dhcp4_parser.yy" // lalr1.cc:859
+  case 305:
+#line 1140 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1994 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2093 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 288:
-#line 1084 "dhcp4_parser.yy" // lalr1.cc:859
+  case 306:
+#line 1145 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2003 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2102 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 293:
-#line 1097 "dhcp4_parser.yy" // lalr1.cc:859
+  case 311:
+#line 1158 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2013 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2112 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 294:
-#line 1101 "dhcp4_parser.yy" // lalr1.cc:859
+  case 312:
+#line 1162 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2023 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2122 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 295:
-#line 1107 "dhcp4_parser.yy" // lalr1.cc:859
+  case 313:
+#line 1168 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2033 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2132 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 296:
-#line 1111 "dhcp4_parser.yy" // lalr1.cc:859
+  case 314:
+#line 1172 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2043 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2142 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 302:
-#line 1126 "dhcp4_parser.yy" // lalr1.cc:859
+  case 320:
+#line 1187 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2051 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2150 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 303:
-#line 1128 "dhcp4_parser.yy" // lalr1.cc:859
+  case 321:
+#line 1189 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 2061 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2160 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 304:
-#line 1134 "dhcp4_parser.yy" // lalr1.cc:859
+  case 322:
+#line 1195 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2069 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2168 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 305:
-#line 1136 "dhcp4_parser.yy" // lalr1.cc:859
+  case 323:
+#line 1197 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2078 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2177 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 306:
-#line 1142 "dhcp4_parser.yy" // lalr1.cc:859
+  case 324:
+#line 1203 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 2089 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2188 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 307:
-#line 1147 "dhcp4_parser.yy" // lalr1.cc:859
+  case 325:
+#line 1208 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2099 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2198 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 316:
-#line 1165 "dhcp4_parser.yy" // lalr1.cc:859
+  case 334:
+#line 1226 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 2108 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2207 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 317:
-#line 1170 "dhcp4_parser.yy" // lalr1.cc:859
+  case 335:
+#line 1231 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 2117 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2216 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 318:
-#line 1175 "dhcp4_parser.yy" // lalr1.cc:859
+  case 336:
+#line 1236 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 2126 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2225 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 319:
-#line 1180 "dhcp4_parser.yy" // lalr1.cc:859
+  case 337:
+#line 1241 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 2135 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2234 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 320:
-#line 1185 "dhcp4_parser.yy" // lalr1.cc:859
+  case 338:
+#line 1246 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 2144 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2243 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 321:
-#line 1190 "dhcp4_parser.yy" // lalr1.cc:859
+  case 339:
+#line 1251 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 2153 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2252 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 322:
-#line 1198 "dhcp4_parser.yy" // lalr1.cc:859
+  case 340:
+#line 1259 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 2164 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2263 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 323:
-#line 1203 "dhcp4_parser.yy" // lalr1.cc:859
+  case 341:
+#line 1264 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2173 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2272 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 328:
-#line 1223 "dhcp4_parser.yy" // lalr1.cc:859
+  case 346:
+#line 1284 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2183 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2282 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 329:
-#line 1227 "dhcp4_parser.yy" // lalr1.cc:859
+  case 347:
+#line 1288 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -2205,294 +2304,294 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2209 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2308 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 330:
-#line 1249 "dhcp4_parser.yy" // lalr1.cc:859
+  case 348:
+#line 1310 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2219 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2318 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 331:
-#line 1253 "dhcp4_parser.yy" // lalr1.cc:859
+  case 349:
+#line 1314 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The subnet subnet4 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2229 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2328 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 372:
-#line 1305 "dhcp4_parser.yy" // lalr1.cc:859
+  case 391:
+#line 1367 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2237 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2336 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 373:
-#line 1307 "dhcp4_parser.yy" // lalr1.cc:859
+  case 392:
+#line 1369 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 2247 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2346 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 374:
-#line 1313 "dhcp4_parser.yy" // lalr1.cc:859
+  case 393:
+#line 1375 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2255 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2354 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 375:
-#line 1315 "dhcp4_parser.yy" // lalr1.cc:859
+  case 394:
+#line 1377 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 2265 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2364 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 376:
-#line 1321 "dhcp4_parser.yy" // lalr1.cc:859
+  case 395:
+#line 1383 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2273 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2372 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 377:
-#line 1323 "dhcp4_parser.yy" // lalr1.cc:859
+  case 396:
+#line 1385 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 2283 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2382 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 378:
-#line 1329 "dhcp4_parser.yy" // lalr1.cc:859
+  case 397:
+#line 1391 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2291 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2390 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 379:
-#line 1331 "dhcp4_parser.yy" // lalr1.cc:859
+  case 398:
+#line 1393 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 2301 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2400 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 380:
-#line 1337 "dhcp4_parser.yy" // lalr1.cc:859
+  case 399:
+#line 1399 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2309 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2408 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 381:
-#line 1339 "dhcp4_parser.yy" // lalr1.cc:859
+  case 400:
+#line 1401 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2319 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2418 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 382:
-#line 1345 "dhcp4_parser.yy" // lalr1.cc:859
+  case 401:
+#line 1407 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2327 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2426 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 383:
-#line 1347 "dhcp4_parser.yy" // lalr1.cc:859
+  case 402:
+#line 1409 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2337 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2436 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 384:
-#line 1353 "dhcp4_parser.yy" // lalr1.cc:859
+  case 403:
+#line 1415 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2348 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2447 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 385:
-#line 1358 "dhcp4_parser.yy" // lalr1.cc:859
+  case 404:
+#line 1420 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2357 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2456 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 386:
-#line 1363 "dhcp4_parser.yy" // lalr1.cc:859
+  case 405:
+#line 1425 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2365 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2464 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 387:
-#line 1365 "dhcp4_parser.yy" // lalr1.cc:859
+  case 406:
+#line 1427 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2374 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2473 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 388:
-#line 1370 "dhcp4_parser.yy" // lalr1.cc:859
+  case 407:
+#line 1432 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2380 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2479 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 389:
-#line 1371 "dhcp4_parser.yy" // lalr1.cc:859
+  case 408:
+#line 1433 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2386 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2485 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 390:
-#line 1372 "dhcp4_parser.yy" // lalr1.cc:859
+  case 409:
+#line 1434 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2392 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2491 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 391:
-#line 1373 "dhcp4_parser.yy" // lalr1.cc:859
+  case 410:
+#line 1435 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2398 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2497 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 392:
-#line 1376 "dhcp4_parser.yy" // lalr1.cc:859
+  case 411:
+#line 1438 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2407 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2506 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 393:
-#line 1383 "dhcp4_parser.yy" // lalr1.cc:859
+  case 412:
+#line 1445 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2418 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2517 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 394:
-#line 1388 "dhcp4_parser.yy" // lalr1.cc:859
+  case 413:
+#line 1450 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2427 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2526 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 399:
-#line 1403 "dhcp4_parser.yy" // lalr1.cc:859
+  case 418:
+#line 1465 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2437 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2536 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 400:
-#line 1407 "dhcp4_parser.yy" // lalr1.cc:859
+  case 419:
+#line 1469 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 2445 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2544 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 436:
-#line 1454 "dhcp4_parser.yy" // lalr1.cc:859
+  case 456:
+#line 1517 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2456 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2555 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 437:
-#line 1459 "dhcp4_parser.yy" // lalr1.cc:859
+  case 457:
+#line 1522 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2465 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2564 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 438:
-#line 1467 "dhcp4_parser.yy" // lalr1.cc:859
+  case 458:
+#line 1530 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2474 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2573 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 439:
-#line 1470 "dhcp4_parser.yy" // lalr1.cc:859
+  case 459:
+#line 1533 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 2482 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2581 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 444:
-#line 1486 "dhcp4_parser.yy" // lalr1.cc:859
+  case 464:
+#line 1549 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2492 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2591 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 445:
-#line 1490 "dhcp4_parser.yy" // lalr1.cc:859
+  case 465:
+#line 1553 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2500,21 +2599,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2504 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2603 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 446:
-#line 1501 "dhcp4_parser.yy" // lalr1.cc:859
+  case 466:
+#line 1564 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2514 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2613 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 447:
-#line 1505 "dhcp4_parser.yy" // lalr1.cc:859
+  case 467:
+#line 1568 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2522,281 +2621,281 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2526 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2625 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 463:
-#line 1537 "dhcp4_parser.yy" // lalr1.cc:859
+  case 483:
+#line 1600 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2535 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2634 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 465:
-#line 1544 "dhcp4_parser.yy" // lalr1.cc:859
+  case 485:
+#line 1607 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2543 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2642 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 466:
-#line 1546 "dhcp4_parser.yy" // lalr1.cc:859
+  case 486:
+#line 1609 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2553 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2652 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 467:
-#line 1552 "dhcp4_parser.yy" // lalr1.cc:859
+  case 487:
+#line 1615 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2561 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2660 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 468:
-#line 1554 "dhcp4_parser.yy" // lalr1.cc:859
+  case 488:
+#line 1617 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2571 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2670 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 469:
-#line 1560 "dhcp4_parser.yy" // lalr1.cc:859
+  case 489:
+#line 1623 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2579 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2678 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 470:
-#line 1562 "dhcp4_parser.yy" // lalr1.cc:859
+  case 490:
+#line 1625 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2589 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2688 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 472:
-#line 1570 "dhcp4_parser.yy" // lalr1.cc:859
+  case 492:
+#line 1633 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2597 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2696 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 473:
-#line 1572 "dhcp4_parser.yy" // lalr1.cc:859
+  case 493:
+#line 1635 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2607 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2706 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 474:
-#line 1578 "dhcp4_parser.yy" // lalr1.cc:859
+  case 494:
+#line 1641 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2616 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2715 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 475:
-#line 1587 "dhcp4_parser.yy" // lalr1.cc:859
+  case 495:
+#line 1650 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2627 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2726 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 476:
-#line 1592 "dhcp4_parser.yy" // lalr1.cc:859
+  case 496:
+#line 1655 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2636 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2735 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 481:
-#line 1611 "dhcp4_parser.yy" // lalr1.cc:859
+  case 501:
+#line 1674 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2646 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2745 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 482:
-#line 1615 "dhcp4_parser.yy" // lalr1.cc:859
+  case 502:
+#line 1678 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2655 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2754 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 483:
-#line 1623 "dhcp4_parser.yy" // lalr1.cc:859
+  case 503:
+#line 1686 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2665 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2764 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 484:
-#line 1627 "dhcp4_parser.yy" // lalr1.cc:859
+  case 504:
+#line 1690 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2674 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2773 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 499:
-#line 1660 "dhcp4_parser.yy" // lalr1.cc:859
+  case 519:
+#line 1723 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2682 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2781 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 500:
-#line 1662 "dhcp4_parser.yy" // lalr1.cc:859
+  case 520:
+#line 1725 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2692 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2791 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 503:
-#line 1672 "dhcp4_parser.yy" // lalr1.cc:859
+  case 523:
+#line 1735 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2701 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2800 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 504:
-#line 1677 "dhcp4_parser.yy" // lalr1.cc:859
+  case 524:
+#line 1740 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2710 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2809 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 505:
-#line 1685 "dhcp4_parser.yy" // lalr1.cc:859
+  case 525:
+#line 1748 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2721 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2820 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 506:
-#line 1690 "dhcp4_parser.yy" // lalr1.cc:859
+  case 526:
+#line 1753 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2730 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2829 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 511:
-#line 1705 "dhcp4_parser.yy" // lalr1.cc:859
+  case 531:
+#line 1768 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2740 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2839 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 512:
-#line 1709 "dhcp4_parser.yy" // lalr1.cc:859
+  case 532:
+#line 1772 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2750 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2849 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 513:
-#line 1715 "dhcp4_parser.yy" // lalr1.cc:859
+  case 533:
+#line 1778 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2760 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2859 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 514:
-#line 1719 "dhcp4_parser.yy" // lalr1.cc:859
+  case 534:
+#line 1782 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2770 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2869 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 524:
-#line 1738 "dhcp4_parser.yy" // lalr1.cc:859
+  case 544:
+#line 1801 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2778 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2877 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 525:
-#line 1740 "dhcp4_parser.yy" // lalr1.cc:859
+  case 545:
+#line 1803 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2788 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2887 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 526:
-#line 1746 "dhcp4_parser.yy" // lalr1.cc:859
+  case 546:
+#line 1809 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2796 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2895 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 527:
-#line 1748 "dhcp4_parser.yy" // lalr1.cc:859
+  case 547:
+#line 1811 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
@@ -2819,19 +2918,19 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2823 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2922 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 528:
-#line 1771 "dhcp4_parser.yy" // lalr1.cc:859
+  case 548:
+#line 1834 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2831 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2930 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 529:
-#line 1773 "dhcp4_parser.yy" // lalr1.cc:859
+  case 549:
+#line 1836 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -2856,1108 +2955,1108 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2860 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2959 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 530:
-#line 1801 "dhcp4_parser.yy" // lalr1.cc:859
+  case 550:
+#line 1864 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2871 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2970 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 531:
-#line 1806 "dhcp4_parser.yy" // lalr1.cc:859
+  case 551:
+#line 1869 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2880 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2979 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 536:
-#line 1819 "dhcp4_parser.yy" // lalr1.cc:859
+  case 556:
+#line 1882 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2890 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2989 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 537:
-#line 1823 "dhcp4_parser.yy" // lalr1.cc:859
+  case 557:
+#line 1886 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2899 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2998 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 538:
-#line 1828 "dhcp4_parser.yy" // lalr1.cc:859
+  case 558:
+#line 1891 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2909 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3008 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 539:
-#line 1832 "dhcp4_parser.yy" // lalr1.cc:859
+  case 559:
+#line 1895 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2918 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3017 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 559:
-#line 1863 "dhcp4_parser.yy" // lalr1.cc:859
+  case 579:
+#line 1926 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2926 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3025 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 560:
-#line 1865 "dhcp4_parser.yy" // lalr1.cc:859
+  case 580:
+#line 1928 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr next_server(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2936 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3035 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 561:
-#line 1871 "dhcp4_parser.yy" // lalr1.cc:859
+  case 581:
+#line 1934 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2944 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3043 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 562:
-#line 1873 "dhcp4_parser.yy" // lalr1.cc:859
+  case 582:
+#line 1936 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr srv(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2954 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3053 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 563:
-#line 1879 "dhcp4_parser.yy" // lalr1.cc:859
+  case 583:
+#line 1942 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2962 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3061 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 564:
-#line 1881 "dhcp4_parser.yy" // lalr1.cc:859
+  case 584:
+#line 1944 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr bootfile(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2972 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3071 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 565:
-#line 1887 "dhcp4_parser.yy" // lalr1.cc:859
+  case 585:
+#line 1950 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2980 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3079 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 566:
-#line 1889 "dhcp4_parser.yy" // lalr1.cc:859
+  case 586:
+#line 1952 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2990 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3089 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 567:
-#line 1895 "dhcp4_parser.yy" // lalr1.cc:859
+  case 587:
+#line 1958 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3001 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3100 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 568:
-#line 1900 "dhcp4_parser.yy" // lalr1.cc:859
+  case 588:
+#line 1963 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3010 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3109 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 569:
-#line 1905 "dhcp4_parser.yy" // lalr1.cc:859
+  case 589:
+#line 1968 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3018 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3117 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 570:
-#line 1907 "dhcp4_parser.yy" // lalr1.cc:859
+  case 590:
+#line 1970 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 3028 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3127 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 571:
-#line 1913 "dhcp4_parser.yy" // lalr1.cc:859
+  case 591:
+#line 1976 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3036 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3135 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 572:
-#line 1915 "dhcp4_parser.yy" // lalr1.cc:859
+  case 592:
+#line 1978 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 3046 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3145 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 573:
-#line 1921 "dhcp4_parser.yy" // lalr1.cc:859
+  case 593:
+#line 1984 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3054 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3153 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 574:
-#line 1923 "dhcp4_parser.yy" // lalr1.cc:859
+  case 594:
+#line 1986 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 3064 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3163 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 575:
-#line 1929 "dhcp4_parser.yy" // lalr1.cc:859
+  case 595:
+#line 1992 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3072 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3171 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 576:
-#line 1931 "dhcp4_parser.yy" // lalr1.cc:859
+  case 596:
+#line 1994 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 3082 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3181 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 577:
-#line 1937 "dhcp4_parser.yy" // lalr1.cc:859
+  case 597:
+#line 2000 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3090 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3189 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 578:
-#line 1939 "dhcp4_parser.yy" // lalr1.cc:859
+  case 598:
+#line 2002 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 3100 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3199 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 579:
-#line 1945 "dhcp4_parser.yy" // lalr1.cc:859
+  case 599:
+#line 2008 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3108 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3207 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 580:
-#line 1947 "dhcp4_parser.yy" // lalr1.cc:859
+  case 600:
+#line 2010 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 3118 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3217 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 581:
-#line 1953 "dhcp4_parser.yy" // lalr1.cc:859
+  case 601:
+#line 2016 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3129 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3228 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 582:
-#line 1958 "dhcp4_parser.yy" // lalr1.cc:859
+  case 602:
+#line 2021 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3138 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3237 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 583:
-#line 1966 "dhcp4_parser.yy" // lalr1.cc:859
+  case 603:
+#line 2029 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 3149 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3248 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 584:
-#line 1971 "dhcp4_parser.yy" // lalr1.cc:859
+  case 604:
+#line 2034 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3158 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3257 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 587:
-#line 1983 "dhcp4_parser.yy" // lalr1.cc:859
+  case 607:
+#line 2046 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 3169 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3268 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 588:
-#line 1988 "dhcp4_parser.yy" // lalr1.cc:859
+  case 608:
+#line 2051 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3178 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3277 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 591:
-#line 1997 "dhcp4_parser.yy" // lalr1.cc:859
+  case 611:
+#line 2060 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3188 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3287 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 592:
-#line 2001 "dhcp4_parser.yy" // lalr1.cc:859
+  case 612:
+#line 2064 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 3198 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3297 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 609:
-#line 2030 "dhcp4_parser.yy" // lalr1.cc:859
+  case 629:
+#line 2093 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3206 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3305 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 610:
-#line 2032 "dhcp4_parser.yy" // lalr1.cc:859
+  case 630:
+#line 2095 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 3216 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3315 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 611:
-#line 2038 "dhcp4_parser.yy" // lalr1.cc:859
+  case 631:
+#line 2101 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 3225 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3324 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 612:
-#line 2045 "dhcp4_parser.yy" // lalr1.cc:859
+  case 632:
+#line 2108 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3234 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3333 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 613:
-#line 2052 "dhcp4_parser.yy" // lalr1.cc:859
+  case 633:
+#line 2115 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3245 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3344 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 614:
-#line 2057 "dhcp4_parser.yy" // lalr1.cc:859
+  case 634:
+#line 2120 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3254 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3353 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 622:
-#line 2073 "dhcp4_parser.yy" // lalr1.cc:859
+  case 642:
+#line 2136 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3262 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3361 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 623:
-#line 2075 "dhcp4_parser.yy" // lalr1.cc:859
+  case 643:
+#line 2138 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3272 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3371 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 624:
-#line 2081 "dhcp4_parser.yy" // lalr1.cc:859
+  case 644:
+#line 2144 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3280 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3379 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 625:
-#line 2083 "dhcp4_parser.yy" // lalr1.cc:859
+  case 645:
+#line 2146 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3290 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3389 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 626:
-#line 2092 "dhcp4_parser.yy" // lalr1.cc:859
+  case 646:
+#line 2155 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr qc(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-queue-control", qc);
     ctx.stack_.push_back(qc);
     ctx.enter(ctx.DHCP_QUEUE_CONTROL);
 }
-#line 3301 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3400 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 627:
-#line 2097 "dhcp4_parser.yy" // lalr1.cc:859
+  case 647:
+#line 2160 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The enable queue parameter is required.
     ctx.require("enable-queue", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3312 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3411 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 636:
-#line 2116 "dhcp4_parser.yy" // lalr1.cc:859
+  case 656:
+#line 2179 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-queue", b);
 }
-#line 3321 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3420 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 637:
-#line 2121 "dhcp4_parser.yy" // lalr1.cc:859
+  case 657:
+#line 2184 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3329 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3428 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 638:
-#line 2123 "dhcp4_parser.yy" // lalr1.cc:859
+  case 658:
+#line 2186 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr qt(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("queue-type", qt);
     ctx.leave();
 }
-#line 3339 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3438 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 639:
-#line 2129 "dhcp4_parser.yy" // lalr1.cc:859
+  case 659:
+#line 2192 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("capacity", c);
 }
-#line 3348 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3447 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 640:
-#line 2134 "dhcp4_parser.yy" // lalr1.cc:859
+  case 660:
+#line 2197 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3356 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3455 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 641:
-#line 2136 "dhcp4_parser.yy" // lalr1.cc:859
+  case 661:
+#line 2199 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set(yystack_[3].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3365 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3464 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 642:
-#line 2143 "dhcp4_parser.yy" // lalr1.cc:859
+  case 662:
+#line 2206 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3376 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3475 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 643:
-#line 2148 "dhcp4_parser.yy" // lalr1.cc:859
+  case 663:
+#line 2211 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3387 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3486 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 644:
-#line 2155 "dhcp4_parser.yy" // lalr1.cc:859
+  case 664:
+#line 2218 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3397 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3496 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 645:
-#line 2159 "dhcp4_parser.yy" // lalr1.cc:859
+  case 665:
+#line 2222 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3407 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3506 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 666:
-#line 2189 "dhcp4_parser.yy" // lalr1.cc:859
+  case 686:
+#line 2252 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3416 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3515 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 667:
-#line 2194 "dhcp4_parser.yy" // lalr1.cc:859
+  case 687:
+#line 2257 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3424 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3523 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 668:
-#line 2196 "dhcp4_parser.yy" // lalr1.cc:859
+  case 688:
+#line 2259 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3434 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3533 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 669:
-#line 2202 "dhcp4_parser.yy" // lalr1.cc:859
+  case 689:
+#line 2265 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3443 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3542 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 670:
-#line 2207 "dhcp4_parser.yy" // lalr1.cc:859
+  case 690:
+#line 2270 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3451 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3550 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 671:
-#line 2209 "dhcp4_parser.yy" // lalr1.cc:859
+  case 691:
+#line 2272 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3461 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3560 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 672:
-#line 2215 "dhcp4_parser.yy" // lalr1.cc:859
+  case 692:
+#line 2278 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3470 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3569 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 673:
-#line 2220 "dhcp4_parser.yy" // lalr1.cc:859
+  case 693:
+#line 2283 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3479 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3578 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 674:
-#line 2225 "dhcp4_parser.yy" // lalr1.cc:859
+  case 694:
+#line 2288 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3487 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3586 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 675:
-#line 2227 "dhcp4_parser.yy" // lalr1.cc:859
+  case 695:
+#line 2290 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3496 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3595 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 676:
-#line 2233 "dhcp4_parser.yy" // lalr1.cc:859
+  case 696:
+#line 2296 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3502 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3601 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 677:
-#line 2234 "dhcp4_parser.yy" // lalr1.cc:859
+  case 697:
+#line 2297 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3508 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3607 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 678:
-#line 2237 "dhcp4_parser.yy" // lalr1.cc:859
+  case 698:
+#line 2300 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3516 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3615 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 679:
-#line 2239 "dhcp4_parser.yy" // lalr1.cc:859
+  case 699:
+#line 2302 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3526 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3625 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 680:
-#line 2246 "dhcp4_parser.yy" // lalr1.cc:859
+  case 700:
+#line 2309 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3534 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3633 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 681:
-#line 2248 "dhcp4_parser.yy" // lalr1.cc:859
+  case 701:
+#line 2311 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3544 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3643 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 682:
-#line 2255 "dhcp4_parser.yy" // lalr1.cc:859
+  case 702:
+#line 2318 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3553 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3652 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 683:
-#line 2261 "dhcp4_parser.yy" // lalr1.cc:859
+  case 703:
+#line 2324 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3562 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3661 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 684:
-#line 2267 "dhcp4_parser.yy" // lalr1.cc:859
+  case 704:
+#line 2330 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3570 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3669 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 685:
-#line 2269 "dhcp4_parser.yy" // lalr1.cc:859
+  case 705:
+#line 2332 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3579 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3678 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 686:
-#line 2275 "dhcp4_parser.yy" // lalr1.cc:859
+  case 706:
+#line 2338 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3587 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3686 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 687:
-#line 2277 "dhcp4_parser.yy" // lalr1.cc:859
+  case 707:
+#line 2340 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3597 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3696 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 688:
-#line 2284 "dhcp4_parser.yy" // lalr1.cc:859
+  case 708:
+#line 2347 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3605 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3704 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 689:
-#line 2286 "dhcp4_parser.yy" // lalr1.cc:859
+  case 709:
+#line 2349 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3615 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3714 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 690:
-#line 2293 "dhcp4_parser.yy" // lalr1.cc:859
+  case 710:
+#line 2356 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3623 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3722 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 691:
-#line 2295 "dhcp4_parser.yy" // lalr1.cc:859
+  case 711:
+#line 2358 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3633 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3732 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 692:
-#line 2304 "dhcp4_parser.yy" // lalr1.cc:859
+  case 712:
+#line 2367 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3641 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3740 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 693:
-#line 2306 "dhcp4_parser.yy" // lalr1.cc:859
+  case 713:
+#line 2369 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3650 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3749 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 694:
-#line 2311 "dhcp4_parser.yy" // lalr1.cc:859
+  case 714:
+#line 2374 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3658 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3757 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 695:
-#line 2313 "dhcp4_parser.yy" // lalr1.cc:859
+  case 715:
+#line 2376 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3667 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3766 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 696:
-#line 2318 "dhcp4_parser.yy" // lalr1.cc:859
+  case 716:
+#line 2381 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3675 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3774 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 697:
-#line 2320 "dhcp4_parser.yy" // lalr1.cc:859
+  case 717:
+#line 2383 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3684 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3783 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 698:
-#line 2327 "dhcp4_parser.yy" // lalr1.cc:859
+  case 718:
+#line 2390 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3695 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3794 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 699:
-#line 2332 "dhcp4_parser.yy" // lalr1.cc:859
+  case 719:
+#line 2395 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3705 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3804 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 700:
-#line 2338 "dhcp4_parser.yy" // lalr1.cc:859
+  case 720:
+#line 2401 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3715 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3814 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 701:
-#line 2342 "dhcp4_parser.yy" // lalr1.cc:859
+  case 721:
+#line 2405 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No config_control params are required
     // parsing completed
 }
-#line 3724 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3823 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 706:
-#line 2357 "dhcp4_parser.yy" // lalr1.cc:859
+  case 726:
+#line 2420 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3735 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3834 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 707:
-#line 2362 "dhcp4_parser.yy" // lalr1.cc:859
+  case 727:
+#line 2425 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3744 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3843 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 708:
-#line 2367 "dhcp4_parser.yy" // lalr1.cc:859
+  case 728:
+#line 2430 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3753 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3852 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 709:
-#line 2377 "dhcp4_parser.yy" // lalr1.cc:859
+  case 729:
+#line 2440 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3764 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3863 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 710:
-#line 2382 "dhcp4_parser.yy" // lalr1.cc:859
+  case 730:
+#line 2445 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3773 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3872 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 711:
-#line 2387 "dhcp4_parser.yy" // lalr1.cc:859
+  case 731:
+#line 2450 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3783 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3882 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 712:
-#line 2391 "dhcp4_parser.yy" // lalr1.cc:859
+  case 732:
+#line 2454 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 3791 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3890 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 716:
-#line 2407 "dhcp4_parser.yy" // lalr1.cc:859
+  case 736:
+#line 2470 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3802 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3901 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 717:
-#line 2412 "dhcp4_parser.yy" // lalr1.cc:859
+  case 737:
+#line 2475 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3811 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3910 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 720:
-#line 2424 "dhcp4_parser.yy" // lalr1.cc:859
+  case 740:
+#line 2487 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3821 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3920 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 721:
-#line 2428 "dhcp4_parser.yy" // lalr1.cc:859
+  case 741:
+#line 2491 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3829 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3928 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 731:
-#line 2445 "dhcp4_parser.yy" // lalr1.cc:859
+  case 751:
+#line 2508 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3838 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3937 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 732:
-#line 2450 "dhcp4_parser.yy" // lalr1.cc:859
+  case 752:
+#line 2513 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3846 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3945 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 733:
-#line 2452 "dhcp4_parser.yy" // lalr1.cc:859
+  case 753:
+#line 2515 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3856 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3955 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 734:
-#line 2458 "dhcp4_parser.yy" // lalr1.cc:859
+  case 754:
+#line 2521 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3867 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3966 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 735:
-#line 2463 "dhcp4_parser.yy" // lalr1.cc:859
+  case 755:
+#line 2526 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3876 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3975 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 738:
-#line 2472 "dhcp4_parser.yy" // lalr1.cc:859
+  case 758:
+#line 2535 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3886 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3985 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 739:
-#line 2476 "dhcp4_parser.yy" // lalr1.cc:859
+  case 759:
+#line 2539 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3894 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3993 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 747:
-#line 2491 "dhcp4_parser.yy" // lalr1.cc:859
+  case 767:
+#line 2554 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3902 "dhcp4_parser.cc" // lalr1.cc:859
+#line 4001 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 748:
-#line 2493 "dhcp4_parser.yy" // lalr1.cc:859
+  case 768:
+#line 2556 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3912 "dhcp4_parser.cc" // lalr1.cc:859
+#line 4011 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 749:
-#line 2499 "dhcp4_parser.yy" // lalr1.cc:859
+  case 769:
+#line 2562 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3921 "dhcp4_parser.cc" // lalr1.cc:859
+#line 4020 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 750:
-#line 2504 "dhcp4_parser.yy" // lalr1.cc:859
+  case 770:
+#line 2567 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3930 "dhcp4_parser.cc" // lalr1.cc:859
+#line 4029 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 751:
-#line 2509 "dhcp4_parser.yy" // lalr1.cc:859
+  case 771:
+#line 2572 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3939 "dhcp4_parser.cc" // lalr1.cc:859
+#line 4038 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 752:
-#line 2514 "dhcp4_parser.yy" // lalr1.cc:859
+  case 772:
+#line 2577 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3947 "dhcp4_parser.cc" // lalr1.cc:859
+#line 4046 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 753:
-#line 2516 "dhcp4_parser.yy" // lalr1.cc:859
+  case 773:
+#line 2579 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 3957 "dhcp4_parser.cc" // lalr1.cc:859
+#line 4056 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
 
-#line 3961 "dhcp4_parser.cc" // lalr1.cc:859
+#line 4060 "dhcp4_parser.cc" // lalr1.cc:859
             default:
               break;
             }
@@ -4212,134 +4311,138 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp4Parser::yypact_ninf_ = -939;
+  const short int Dhcp4Parser::yypact_ninf_ = -965;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
   const short int
   Dhcp4Parser::yypact_[] =
   {
-     370,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,    32,    43,    33,    50,    67,
-      69,    71,    83,    90,   112,   121,   127,   129,   157,   171,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,    43,  -162,
-      24,   200,   107,   637,    -8,    54,   -33,    91,    58,   -67,
-     223,  -112,   134,  -939,   178,    62,   191,   189,   209,  -939,
-    -939,  -939,  -939,  -939,   216,  -939,    35,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,   218,   220,   240,  -939,
-    -939,  -939,  -939,  -939,  -939,   242,   250,   252,   273,   275,
-     283,   285,   309,   332,  -939,   336,   339,   360,   378,   385,
-    -939,  -939,  -939,   392,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,   399,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,    48,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,   401,  -939,    59,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,   409,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,    72,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,    85,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,   412,   418,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,   414,  -939,  -939,
-     419,  -939,  -939,  -939,   421,  -939,  -939,   422,   424,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,   425,   428,  -939,  -939,  -939,  -939,   426,   430,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,   113,  -939,  -939,  -939,   431,  -939,  -939,   433,
-    -939,   439,   442,  -939,  -939,   444,   445,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,   174,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,   244,  -939,  -939,  -939,   446,   245,  -939,  -939,  -939,
-    -939,    43,    43,  -939,   262,   455,   456,   458,   459,   460,
-    -939,    24,  -939,   461,   463,   465,   276,   279,   281,   472,
-     477,   479,   480,   481,   483,   296,   297,   299,   302,   307,
-     301,   310,   314,   318,   498,   320,   321,   312,   324,   327,
-     510,   511,   516,   331,   524,   525,   526,   528,   529,   530,
-     531,   532,   533,   534,   535,   537,   350,   539,   557,   558,
-     559,   560,   561,   562,   200,  -939,   563,   564,   565,   377,
-     107,  -939,   566,   568,   569,   570,   571,   572,   386,   573,
-     575,   576,   637,  -939,   577,    -8,  -939,   578,   579,   580,
-     581,   582,   583,   584,   585,  -939,    54,  -939,   586,   587,
-     400,   590,   591,   592,   403,  -939,    91,   594,   406,   407,
-    -939,    58,   598,   599,   204,  -939,   410,   602,   603,   416,
-     605,   420,   427,   606,   607,   423,   429,   609,   610,   612,
-     614,   223,  -939,  -112,  -939,   616,   432,   134,  -939,  -939,
-    -939,   617,   615,   618,    43,    43,    43,  -939,   619,   620,
-     621,  -939,  -939,  -939,   438,   440,   441,   623,   628,   632,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,   447,
-    -939,  -939,  -939,  -939,  -939,     2,   448,   450,  -939,   638,
-     639,   640,   641,   635,   457,     3,   642,   648,   649,   651,
-     650,  -939,   652,   653,   654,   661,   467,   478,   665,  -939,
-     666,   363,   398,  -939,  -939,   482,   484,   485,   667,   486,
-     487,  -939,   666,   488,   673,  -939,   490,  -939,   666,   491,
-     492,   493,   494,   495,   496,   497,  -939,   502,   512,  -939,
-     513,   514,   522,  -939,  -939,   536,  -939,  -939,  -939,   546,
-      43,  -939,  -939,   547,   548,  -939,   549,  -939,  -939,    31,
-     517,  -939,  -939,     2,   550,   551,   553,  -939,  -939,   697,
-    -939,  -939,    43,   200,  -112,  -939,  -939,  -939,   134,   107,
-     693,  -939,  -939,  -939,   305,   305,   712,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,   713,   714,   715,   716,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,   172,   717,
-     718,   719,   114,    60,    14,    17,   223,  -939,  -939,   721,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,   723,  -939,  -939,  -939,  -939,   292,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,   712,  -939,   247,   293,   294,
-     300,  -939,   303,  -939,  -939,  -939,  -939,  -939,  -939,   741,
-     744,   745,   746,   747,  -939,  -939,  -939,  -939,   748,   749,
-     751,   752,   753,   754,  -939,   304,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,   306,  -939,   755,
-     756,  -939,  -939,   757,   759,  -939,  -939,   758,   762,  -939,
-    -939,   760,   764,  -939,  -939,   763,   765,  -939,  -939,  -939,
-    -939,  -939,  -939,    38,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,    88,  -939,  -939,   766,   767,  -939,  -939,   768,   770,
-    -939,   771,   772,   773,   774,   775,   776,   313,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,   777,   778,   779,  -939,   316,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,   319,  -939,  -939,  -939,   780,  -939,   781,  -939,  -939,
-    -939,   325,  -939,  -939,  -939,  -939,  -939,   326,  -939,   168,
-    -939,   595,  -939,   782,   784,  -939,  -939,  -939,  -939,   783,
-     786,  -939,  -939,  -939,  -939,   785,   693,  -939,   789,   790,
-     791,   792,   611,   596,   613,   604,   622,   793,   797,   798,
-     800,   624,   625,   626,   627,   629,   630,   305,  -939,  -939,
-     305,  -939,   712,   637,  -939,   713,    91,  -939,   714,    58,
-    -939,   715,  1166,  -939,   716,   172,  -939,   109,   717,  -939,
-      54,  -939,   718,   -67,  -939,   719,   633,   634,   643,   644,
-     645,   646,   114,  -939,   636,   647,   655,    60,  -939,   802,
-     803,    14,  -939,   656,   804,   657,   805,    17,  -939,  -939,
-     124,   721,  -939,  -939,   806,   807,    -8,  -939,   723,   809,
-    -939,  -939,   660,  -939,   371,   662,   663,   664,  -939,  -939,
-    -939,  -939,  -939,   668,   669,   670,   671,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,   329,  -939,   376,  -939,   812,  -939,
-     813,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,   380,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-     811,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-     816,   808,  -939,  -939,  -939,  -939,  -939,   819,  -939,   387,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,   672,   674,  -939,  -939,   675,  -939,    43,  -939,
-    -939,   825,  -939,  -939,  -939,  -939,  -939,   389,  -939,  -939,
-    -939,  -939,  -939,  -939,   676,   390,  -939,   666,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  1166,  -939,   827,   658,  -939,
-     109,  -939,  -939,  -939,  -939,  -939,  -939,   828,   677,   829,
-     124,  -939,  -939,  -939,  -939,  -939,   679,  -939,  -939,   835,
-    -939,   680,  -939,  -939,   834,  -939,  -939,   207,  -939,   -40,
-     834,  -939,  -939,   830,   838,   839,  -939,   396,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,   840,   678,   682,   683,   841,
-     -40,  -939,   686,  -939,  -939,  -939,   687,  -939,  -939,  -939
+     173,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,    32,    43,    36,    50,    61,
+      71,    81,   114,   164,   193,   201,   203,   213,   220,   232,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,    43,  -169,
+      24,   205,    25,   614,     3,    54,   -36,    52,   208,   -75,
+     411,  -123,   148,  -965,   106,   125,   176,   174,   246,  -965,
+    -965,  -965,  -965,  -965,   251,  -965,    77,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,   292,   308,   323,  -965,
+    -965,  -965,  -965,  -965,  -965,   345,   351,   367,   368,   369,
+     374,   375,   376,   401,  -965,   405,   407,   408,   409,   410,
+    -965,  -965,  -965,   412,  -965,   413,   414,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   415,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,    98,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,   416,  -965,   121,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,   417,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   122,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,   142,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+     420,   421,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,   422,  -965,  -965,   419,  -965,  -965,
+    -965,   425,  -965,  -965,   424,   430,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   431,
+     433,  -965,  -965,  -965,  -965,   432,   436,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   143,
+    -965,  -965,  -965,   438,  -965,  -965,   439,  -965,   440,   441,
+    -965,  -965,   443,   449,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,   206,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   210,  -965,
+    -965,  -965,   452,   218,  -965,  -965,  -965,  -965,    43,    43,
+    -965,   217,   454,   455,   456,   459,   465,  -965,    24,  -965,
+     466,   468,   469,   273,   274,   276,   475,   476,   479,   481,
+     482,   487,   294,   295,   296,   298,   299,   300,   304,   305,
+     307,   495,   317,   324,   316,   319,   327,   505,   518,   520,
+     329,   521,   330,   334,   534,   537,   538,   540,   541,   542,
+     543,   544,   545,   546,   547,   548,   357,   553,   555,   556,
+     570,   571,   572,   573,   205,  -965,   574,   575,   578,   382,
+      25,  -965,   580,   581,   582,   583,   584,   585,   391,   587,
+     588,   589,   614,  -965,   590,     3,  -965,   591,   592,   593,
+     594,   595,   596,   597,   598,  -965,    54,  -965,   599,   600,
+     406,   603,   604,   606,   418,  -965,    52,   607,   423,   426,
+    -965,   208,   609,   610,   136,  -965,   428,   611,   612,   427,
+     613,   434,   435,   616,   617,   429,   437,   618,   619,   621,
+     627,   411,  -965,  -123,  -965,   628,   446,   148,  -965,  -965,
+    -965,   631,   629,   630,    43,    43,    43,  -965,   632,   639,
+     642,  -965,  -965,  -965,   453,   457,   458,   646,   647,   652,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   460,
+    -965,  -965,  -965,  -965,  -965,   -92,   461,   462,  -965,   463,
+    -965,  -965,   657,   662,   664,   665,   666,   473,    60,   667,
+     678,   679,   680,   688,  -965,   689,   690,   694,   700,   488,
+     510,   704,  -965,   705,   335,   284,  -965,  -965,   513,   514,
+     516,   716,   524,   525,  -965,   705,   526,   718,  -965,   528,
+    -965,   705,   530,   531,   535,   536,   539,   549,   550,  -965,
+     551,   552,  -965,   558,   559,   560,  -965,  -965,   561,  -965,
+    -965,  -965,   562,    43,  -965,  -965,   563,   564,  -965,   565,
+    -965,  -965,    20,   568,  -965,  -965,   -92,   566,   567,   569,
+    -965,  -965,   730,  -965,  -965,    43,   205,  -123,  -965,  -965,
+    -965,   148,    25,   712,  -965,  -965,  -965,   342,   342,   732,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+     733,   734,   735,   736,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,    73,   737,   738,   739,    53,    -8,   -46,    56,
+     411,  -965,  -965,   759,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,   761,  -965,  -965,  -965,  -965,
+     212,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   732,
+    -965,   237,   243,   245,   253,  -965,   254,  -965,  -965,  -965,
+    -965,  -965,  -965,   765,   766,   767,   768,   769,  -965,  -965,
+    -965,  -965,   770,   771,   772,   773,   774,   775,  -965,  -965,
+    -965,   776,  -965,   255,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   286,
+    -965,   779,   778,  -965,  -965,   788,   792,  -965,  -965,   790,
+     794,  -965,  -965,   800,   804,  -965,  -965,   803,   807,  -965,
+    -965,  -965,  -965,  -965,  -965,    59,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,    84,  -965,  -965,   805,   812,  -965,  -965,
+     810,   814,  -965,   815,   816,   817,   818,   819,   820,   287,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,   821,   824,   826,
+    -965,   310,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,   311,  -965,  -965,  -965,   828,  -965,   829,
+    -965,  -965,  -965,   312,  -965,  -965,  -965,  -965,  -965,   318,
+    -965,   105,  -965,   620,  -965,   830,   831,  -965,  -965,  -965,
+    -965,   827,   833,  -965,  -965,  -965,  -965,   836,   712,  -965,
+     838,   839,   840,   841,   638,   645,   648,   649,   653,   844,
+     847,   849,   850,   656,   658,   659,   660,   655,   661,   857,
+     858,   859,   668,   342,  -965,  -965,   342,  -965,   732,   614,
+    -965,   733,    52,  -965,   734,   208,  -965,   735,   725,  -965,
+     736,    73,  -965,   110,   737,  -965,    54,  -965,   738,   -75,
+    -965,   739,   669,   670,   671,   672,   673,   674,    53,  -965,
+     663,   675,   676,    -8,  -965,   861,   862,   -46,  -965,   677,
+     872,   681,   873,    56,  -965,  -965,   158,   759,  -965,  -965,
+     875,   876,     3,  -965,   761,   878,  -965,  -965,   685,  -965,
+      99,   686,   687,   691,  -965,  -965,  -965,  -965,  -965,   692,
+     693,   695,   698,  -965,  -965,  -965,  -965,  -965,  -965,   699,
+     702,   703,  -965,  -965,   320,  -965,   321,  -965,   879,  -965,
+     880,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   322,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,   882,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,   884,   895,  -965,  -965,  -965,  -965,  -965,   896,  -965,
+     333,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,   709,   724,  -965,  -965,   729,  -965,    43,
+    -965,  -965,   899,  -965,  -965,  -965,  -965,  -965,   336,  -965,
+    -965,  -965,  -965,  -965,  -965,   741,   337,  -965,   705,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   725,
+    -965,   910,   742,  -965,   110,  -965,  -965,  -965,  -965,  -965,
+    -965,   940,   757,   953,   158,  -965,  -965,  -965,  -965,  -965,
+     762,  -965,  -965,   777,  -965,   780,  -965,  -965,   956,  -965,
+    -965,   175,  -965,   -15,   956,  -965,  -965,   966,   967,   975,
+    -965,   343,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   977,
+     823,   822,   832,  1013,   -15,  -965,   834,  -965,  -965,  -965,
+     835,  -965,  -965,  -965
   };
 
   const unsigned short int
@@ -4349,170 +4452,175 @@ namespace isc { namespace dhcp {
       20,    22,    24,    26,    28,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    45,    38,    34,    33,    30,    31,    32,    37,     3,
-      35,    36,    58,     5,    70,     7,   172,     9,   330,    11,
-     513,    13,   538,    15,   438,    17,   446,    19,   483,    21,
-     295,    23,   644,    25,   711,    27,   700,    29,    47,    41,
-       0,     0,     0,     0,     0,   540,     0,   448,   485,     0,
+      35,    36,    58,     5,    70,     7,   179,     9,   348,    11,
+     533,    13,   558,    15,   458,    17,   466,    19,   503,    21,
+     313,    23,   664,    25,   731,    27,   720,    29,    47,    41,
+       0,     0,     0,     0,     0,   560,     0,   468,   505,     0,
        0,     0,     0,    49,     0,    48,     0,     0,    42,    68,
-     709,   692,   694,   696,     0,    67,     0,    60,    62,    64,
-      65,    66,    63,   698,   161,   187,     0,     0,     0,   559,
-     561,   563,   185,   194,   196,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   135,     0,     0,     0,     0,     0,
-     143,   150,   152,     0,   322,   436,   475,   393,   526,   528,
-     386,   260,   587,   530,   287,   306,     0,   274,   613,   626,
-     642,   154,   156,   716,   125,     0,    72,    74,    75,    76,
-      77,    78,   109,   110,   111,    79,   107,    96,    97,    98,
-     115,   116,   117,   118,   119,   120,   113,   114,   121,   122,
-     123,    82,    83,   104,    84,    85,    86,   124,    90,    91,
-      80,   108,    81,    88,    89,   102,   103,   105,    99,   100,
-     101,    87,    92,    93,    94,    95,   106,   112,   174,   176,
-     180,     0,   171,     0,   163,   165,   166,   167,   168,   169,
-     170,   374,   376,   378,   505,   372,   380,     0,   384,   382,
-     583,   371,   334,   335,   336,   337,   338,   359,   360,   361,
-     349,   350,   362,   363,   364,   365,   366,   367,   368,   369,
-     370,     0,   332,   341,   354,   355,   356,   342,   344,   345,
-     347,   343,   339,   340,   357,   358,   346,   351,   352,   353,
-     348,   524,   523,   519,   520,   518,     0,   515,   517,   521,
-     522,   581,   569,   571,   575,   573,   579,   577,   565,   558,
-     552,   556,   557,     0,   541,   542,   553,   554,   555,   549,
-     544,   550,   546,   547,   548,   551,   545,     0,   465,   240,
-       0,   469,   467,   472,     0,   461,   462,     0,   449,   450,
-     452,   464,   453,   454,   455,   471,   456,   457,   458,   459,
-     460,   499,     0,     0,   497,   498,   501,   502,     0,   486,
-     487,   489,   490,   491,   492,   493,   494,   495,   496,   302,
-     304,   299,     0,   297,   300,   301,     0,   680,   667,     0,
-     670,     0,     0,   674,   678,     0,     0,   684,   686,   688,
-     690,   665,   663,   664,     0,   646,   648,   649,   650,   651,
-     652,   653,   654,   655,   660,   656,   657,   658,   659,   661,
-     662,     0,   713,   715,   706,     0,     0,   702,   704,   705,
-      46,     0,     0,    39,     0,     0,     0,     0,     0,     0,
-      57,     0,    59,     0,     0,     0,     0,     0,     0,     0,
+     729,   712,   714,   716,     0,    67,     0,    60,    62,    64,
+      65,    66,    63,   718,   168,   194,     0,     0,     0,   579,
+     581,   583,   192,   201,   203,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   138,     0,     0,     0,     0,     0,
+     146,   153,   155,     0,   162,     0,     0,   340,   456,   495,
+     412,   546,   548,   405,   278,   607,   550,   305,   324,     0,
+     292,   633,   646,   662,   157,   159,   736,   128,     0,    72,
+      74,    75,    76,    77,    78,   109,   110,   111,    79,   107,
+      96,    97,    98,   115,   116,   117,   118,   119,   120,   113,
+     114,   121,   122,   123,   124,   125,   126,    82,    83,   104,
+      84,    85,    86,   127,    90,    91,    80,   108,    81,    88,
+      89,   102,   103,   105,    99,   100,   101,    87,    92,    93,
+      94,    95,   106,   112,   181,   183,   187,     0,   178,     0,
+     170,   172,   173,   174,   175,   176,   177,   393,   395,   397,
+     525,   391,   399,     0,   403,   401,   603,   390,   352,   353,
+     354,   355,   356,   377,   378,   379,   367,   368,   380,   381,
+     382,   383,   384,   385,   386,   387,   388,   389,     0,   350,
+     359,   372,   373,   374,   360,   362,   363,   365,   361,   357,
+     358,   375,   376,   364,   369,   370,   371,   366,   544,   543,
+     539,   540,   538,     0,   535,   537,   541,   542,   601,   589,
+     591,   595,   593,   599,   597,   585,   578,   572,   576,   577,
+       0,   561,   562,   573,   574,   575,   569,   564,   570,   566,
+     567,   568,   571,   565,     0,   485,   251,     0,   489,   487,
+     492,     0,   481,   482,     0,   469,   470,   472,   484,   473,
+     474,   475,   491,   476,   477,   478,   479,   480,   519,     0,
+       0,   517,   518,   521,   522,     0,   506,   507,   509,   510,
+     511,   512,   513,   514,   515,   516,   320,   322,   317,     0,
+     315,   318,   319,     0,   700,   687,     0,   690,     0,     0,
+     694,   698,     0,     0,   704,   706,   708,   710,   685,   683,
+     684,     0,   666,   668,   669,   670,   671,   672,   673,   674,
+     675,   680,   676,   677,   678,   679,   681,   682,     0,   733,
+     735,   726,     0,     0,   722,   724,   725,    46,     0,     0,
+      39,     0,     0,     0,     0,     0,     0,    57,     0,    59,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,    71,     0,     0,     0,     0,
-       0,   173,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   331,     0,     0,   514,     0,     0,     0,
-       0,     0,     0,     0,     0,   539,     0,   439,     0,     0,
-       0,     0,     0,     0,     0,   447,     0,     0,     0,     0,
-     484,     0,     0,     0,     0,   296,     0,     0,     0,     0,
+       0,   180,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   349,     0,     0,   534,     0,     0,     0,
+       0,     0,     0,     0,     0,   559,     0,   459,     0,     0,
+       0,     0,     0,     0,     0,   467,     0,     0,     0,     0,
+     504,     0,     0,     0,     0,   314,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   645,     0,   712,     0,     0,     0,   701,    50,
+       0,     0,   665,     0,   732,     0,     0,     0,   721,    50,
       43,     0,     0,     0,     0,     0,     0,    61,     0,     0,
-       0,   137,   138,   139,     0,     0,     0,     0,     0,     0,
-     126,   127,   128,   129,   130,   131,   132,   133,   134,     0,
-     159,   160,   140,   141,   142,     0,     0,     0,   158,     0,
+       0,   140,   141,   142,     0,     0,     0,     0,     0,     0,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,     0,
+     166,   167,   143,   144,   145,     0,     0,     0,   161,     0,
+     164,   165,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   632,     0,     0,     0,     0,     0,
+       0,     0,    73,     0,     0,     0,   191,   171,     0,     0,
+       0,     0,     0,     0,   411,     0,     0,     0,   351,     0,
+     536,     0,     0,     0,     0,     0,     0,     0,     0,   563,
+       0,     0,   483,     0,     0,     0,   494,   471,     0,   523,
+     524,   508,     0,     0,   316,   686,     0,     0,   689,     0,
+     692,   693,     0,     0,   702,   703,     0,     0,     0,     0,
+     667,   734,     0,   728,   723,     0,     0,     0,   713,   715,
+     717,     0,     0,     0,   580,   582,   584,     0,     0,   205,
+     139,   148,   149,   150,   151,   152,   147,   154,   156,   163,
+     342,   460,   497,   414,    40,   547,   549,   407,   408,   409,
+     410,   406,     0,     0,   552,   307,     0,     0,     0,     0,
+       0,   158,   160,     0,    51,   182,   185,   186,   184,   189,
+     190,   188,   394,   396,   398,   527,   392,   400,   404,   402,
+       0,   545,   602,   590,   592,   596,   594,   600,   598,   586,
+     486,   252,   490,   488,   493,   520,   321,   323,   701,   688,
+     691,   696,   697,   695,   699,   705,   707,   709,   711,   205,
+      44,     0,     0,     0,     0,   199,     0,   196,   198,   238,
+     244,   246,   248,     0,     0,     0,     0,     0,   260,   262,
+     264,   266,     0,     0,     0,     0,     0,     0,   271,   273,
+     275,     0,   237,     0,   211,   213,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   226,   227,   228,   223,   229,
+     230,   231,   224,   225,   232,   233,   234,   235,   236,     0,
+     209,     0,   206,   207,   346,     0,   343,   344,   464,     0,
+     461,   462,   501,     0,   498,   499,   418,     0,   415,   416,
+     287,   288,   289,   290,   291,     0,   280,   282,   283,   284,
+     285,   286,   611,     0,   609,   556,     0,   553,   554,   311,
+       0,   308,   309,     0,     0,     0,     0,     0,     0,     0,
+     326,   328,   329,   330,   331,   332,   333,     0,     0,     0,
+     301,     0,   294,   296,   297,   298,   299,   300,   642,   644,
+     641,   639,   640,     0,   635,   637,   638,     0,   657,     0,
+     660,   653,   654,     0,   648,   650,   651,   652,   655,     0,
+     740,     0,   738,    53,   531,     0,   528,   529,   587,   605,
+     606,     0,     0,    69,   730,   719,   169,     0,     0,   195,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   612,     0,     0,     0,     0,     0,     0,     0,    73,
-       0,     0,     0,   184,   164,     0,     0,     0,     0,     0,
-       0,   392,     0,     0,     0,   333,     0,   516,     0,     0,
-       0,     0,     0,     0,     0,     0,   543,     0,     0,   463,
-       0,     0,     0,   474,   451,     0,   503,   504,   488,     0,
-       0,   298,   666,     0,     0,   669,     0,   672,   673,     0,
-       0,   682,   683,     0,     0,     0,     0,   647,   714,     0,
-     708,   703,     0,     0,     0,   693,   695,   697,     0,     0,
-       0,   560,   562,   564,     0,     0,   198,   136,   145,   146,
-     147,   148,   149,   144,   151,   153,   324,   440,   477,   395,
-      40,   527,   529,   388,   389,   390,   391,   387,     0,     0,
-     532,   289,     0,     0,     0,     0,     0,   155,   157,     0,
-      51,   175,   178,   179,   177,   182,   183,   181,   375,   377,
-     379,   507,   373,   381,   385,   383,     0,   525,   582,   570,
-     572,   576,   574,   580,   578,   566,   466,   241,   470,   468,
-     473,   500,   303,   305,   681,   668,   671,   676,   677,   675,
-     679,   685,   687,   689,   691,   198,    44,     0,     0,     0,
-       0,   192,     0,   189,   191,   227,   233,   235,   237,     0,
-       0,     0,     0,     0,   249,   251,   253,   255,     0,     0,
-       0,     0,     0,     0,   226,     0,   204,   206,   207,   208,
-     209,   210,   211,   212,   213,   214,   215,   219,   220,   221,
-     216,   222,   223,   224,   217,   218,   225,     0,   202,     0,
-     199,   200,   328,     0,   325,   326,   444,     0,   441,   442,
-     481,     0,   478,   479,   399,     0,   396,   397,   269,   270,
-     271,   272,   273,     0,   262,   264,   265,   266,   267,   268,
-     591,     0,   589,   536,     0,   533,   534,   293,     0,   290,
-     291,     0,     0,     0,     0,     0,     0,     0,   308,   310,
-     311,   312,   313,   314,   315,     0,     0,     0,   283,     0,
-     276,   278,   279,   280,   281,   282,   622,   624,   621,   619,
-     620,     0,   615,   617,   618,     0,   637,     0,   640,   633,
-     634,     0,   628,   630,   631,   632,   635,     0,   720,     0,
-     718,    53,   511,     0,   508,   509,   567,   585,   586,     0,
-       0,    69,   710,   699,   162,     0,     0,   188,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   186,   195,
-       0,   197,     0,     0,   323,     0,   448,   437,     0,   485,
-     476,     0,     0,   394,     0,     0,   261,   593,     0,   588,
-     540,   531,     0,     0,   288,     0,     0,     0,     0,     0,
-       0,     0,     0,   307,     0,     0,     0,     0,   275,     0,
-       0,     0,   614,     0,     0,     0,     0,     0,   627,   643,
-       0,     0,   717,    55,     0,    54,     0,   506,     0,     0,
-     584,   707,     0,   190,     0,     0,     0,     0,   239,   242,
-     243,   244,   245,     0,     0,     0,     0,   257,   258,   246,
-     247,   248,   259,   205,     0,   201,     0,   327,     0,   443,
-       0,   480,   435,   418,   419,   420,   406,   407,   423,   424,
-     425,   409,   410,   426,   427,   428,   429,   430,   431,   432,
-     433,   434,   403,   404,   405,   416,   417,   415,     0,   401,
-     408,   421,   422,   411,   412,   413,   414,   398,   263,   609,
-       0,   607,   608,   600,   601,   605,   606,   602,   603,   604,
-       0,   594,   595,   597,   598,   599,   590,     0,   535,     0,
-     292,   316,   317,   318,   319,   320,   321,   309,   284,   285,
-     286,   277,     0,     0,   616,   636,     0,   639,     0,   629,
-     734,     0,   732,   730,   724,   728,   729,     0,   722,   726,
-     727,   725,   719,    52,     0,     0,   510,     0,   193,   229,
-     230,   231,   232,   228,   234,   236,   238,   250,   252,   254,
-     256,   203,   329,   445,   482,     0,   400,     0,     0,   592,
-       0,   537,   294,   623,   625,   638,   641,     0,     0,     0,
-       0,   721,    56,   512,   568,   402,     0,   611,   596,     0,
-     731,     0,   723,   610,     0,   733,   738,     0,   736,     0,
-       0,   735,   747,     0,     0,     0,   752,     0,   740,   742,
-     743,   744,   745,   746,   737,     0,     0,     0,     0,     0,
-       0,   739,     0,   749,   750,   751,     0,   741,   748,   753
+       0,     0,     0,     0,   193,   202,     0,   204,     0,     0,
+     341,     0,   468,   457,     0,   505,   496,     0,     0,   413,
+       0,     0,   279,   613,     0,   608,   560,   551,     0,     0,
+     306,     0,     0,     0,     0,     0,     0,     0,     0,   325,
+       0,     0,     0,     0,   293,     0,     0,     0,   634,     0,
+       0,     0,     0,     0,   647,   663,     0,     0,   737,    55,
+       0,    54,     0,   526,     0,     0,   604,   727,     0,   197,
+       0,     0,     0,     0,   250,   253,   254,   255,   256,     0,
+       0,     0,     0,   268,   269,   257,   258,   259,   270,     0,
+       0,     0,   277,   212,     0,   208,     0,   345,     0,   463,
+       0,   500,   455,   437,   438,   439,   425,   426,   442,   443,
+     444,   428,   429,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   422,   423,   424,   435,   436,   434,     0,
+     420,   427,   440,   441,   430,   431,   432,   433,   417,   281,
+     629,     0,   627,   628,   620,   621,   625,   626,   622,   623,
+     624,     0,   614,   615,   617,   618,   619,   610,     0,   555,
+       0,   310,   334,   335,   336,   337,   338,   339,   327,   302,
+     303,   304,   295,     0,     0,   636,   656,     0,   659,     0,
+     649,   754,     0,   752,   750,   744,   748,   749,     0,   742,
+     746,   747,   745,   739,    52,     0,     0,   530,     0,   200,
+     240,   241,   242,   243,   239,   245,   247,   249,   261,   263,
+     265,   267,   272,   274,   276,   210,   347,   465,   502,     0,
+     419,     0,     0,   612,     0,   557,   312,   643,   645,   658,
+     661,     0,     0,     0,     0,   741,    56,   532,   588,   421,
+       0,   631,   616,     0,   751,     0,   743,   630,     0,   753,
+     758,     0,   756,     0,     0,   755,   767,     0,     0,     0,
+     772,     0,   760,   762,   763,   764,   765,   766,   757,     0,
+       0,     0,     0,     0,     0,   759,     0,   769,   770,   771,
+       0,   761,   768,   773
   };
 
   const short int
   Dhcp4Parser::yypgoto_[] =
   {
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,     0,  -939,   177,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -587,  -939,  -939,
-    -939,   -70,  -939,  -939,  -939,   435,  -939,  -939,  -939,  -939,
-     108,   384,   -43,   -31,   -27,    -4,    -2,     8,    16,    19,
-    -939,  -939,  -939,  -939,    22,    23,    26,    27,    29,    34,
-    -939,   203,    37,  -939,    40,  -939,    41,  -939,    42,  -939,
-      44,  -939,  -939,  -939,  -939,   188,   388,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,   -52,  -939,  -939,  -939,  -939,  -939,  -939,
-     126,  -939,   -74,  -939,  -662,   -41,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,   -66,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,   -42,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,   -89,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,   -64,  -939,  -939,  -939,
-     -46,   383,  -939,  -939,  -939,  -939,  -939,  -939,  -939,   -35,
-    -939,  -939,  -939,  -939,  -939,  -939,  -938,  -939,  -939,  -939,
-     -15,  -939,  -939,  -939,   -25,   449,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -936,  -939,   -68,  -939,    46,  -939,
-      45,  -939,  -939,  -939,  -939,  -939,  -939,  -939,   -20,  -939,
-    -939,  -201,   -49,  -939,  -939,  -939,  -939,  -939,     5,  -939,
-    -939,  -939,    -1,  -939,   489,  -939,   -45,  -939,  -939,  -939,
-    -939,  -939,   -39,  -939,  -939,  -939,  -939,  -939,   -38,  -939,
-    -939,  -939,     1,  -939,  -939,  -939,     6,  -939,   499,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-      -7,  -939,  -939,  -939,    -6,   515,  -939,  -939,   -54,  -939,
-     -14,  -939,   -28,  -939,  -939,  -939,    39,  -939,  -939,  -939,
-      47,  -939,   503,   -58,  -939,    -3,  -939,     4,  -939,   277,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -924,  -939,  -939,
-    -939,  -939,  -939,    51,  -939,  -939,  -939,  -148,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,    25,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,    18,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,   298,   500,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,  -939,   340,   474,  -939,  -939,  -939,  -939,  -939,  -939,
-    -939,   348,   501,   -59,  -939,  -939,    28,  -939,  -939,  -147,
-    -939,  -939,  -939,  -939,  -939,  -939,  -166,  -939,  -939,  -185,
-    -939,  -939,  -939,  -939,  -939,  -939,  -939
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,    -1,  -965,   442,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -600,  -965,  -965,
+    -965,   -70,  -965,  -965,  -965,   622,  -965,  -965,  -965,  -965,
+     352,   576,   -43,   -31,   -27,    -4,    -2,     8,    16,    19,
+    -965,  -965,  -965,  -965,    22,    23,    26,    27,    29,    34,
+    -965,   361,    37,  -965,    40,  -965,    41,  -965,    42,  -965,
+      44,    45,  -965,  -965,  -965,  -965,  -965,  -965,  -965,   347,
+     554,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,    92,  -965,  -965,
+    -965,  -965,  -965,  -965,   266,  -965,    68,  -965,  -675,    74,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+     -66,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+      58,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,    38,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,    51,  -965,  -965,
+    -965,    55,   519,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+      49,  -965,  -965,  -965,  -965,  -965,  -965,  -964,  -965,  -965,
+    -965,    75,  -965,  -965,  -965,    76,   557,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -962,  -965,   -68,  -965,    48,
+    -965,    47,  -965,  -965,  -965,  -965,  -965,  -965,  -965,    72,
+    -965,  -965,  -131,   -49,  -965,  -965,  -965,  -965,  -965,    79,
+    -965,  -965,  -965,    82,  -965,   577,  -965,   -45,  -965,  -965,
+    -965,  -965,  -965,   -39,  -965,  -965,  -965,  -965,  -965,   -38,
+    -965,  -965,  -965,    78,  -965,  -965,  -965,    83,  -965,   579,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,    33,  -965,  -965,  -965,    39,   586,  -965,  -965,   -54,
+    -965,   -14,  -965,   -28,  -965,  -965,  -965,    63,  -965,  -965,
+    -965,    70,  -965,   601,   -58,  -965,    -3,  -965,     4,  -965,
+     325,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -950,  -965,
+    -965,  -965,  -965,  -965,    80,  -965,  -965,  -965,  -125,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,    62,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,    64,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,   340,   522,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,  -965,   381,   527,  -965,  -965,  -965,  -965,  -965,
+    -965,  -965,   389,   529,   -59,  -965,  -965,    65,  -965,  -965,
+    -127,  -965,  -965,  -965,  -965,  -965,  -965,  -146,  -965,  -965,
+    -163,  -965,  -965,  -965,  -965,  -965,  -965,  -965
   };
 
   const short int
@@ -4520,535 +4628,516 @@ namespace isc { namespace dhcp {
   {
       -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
       24,    25,    26,    27,    28,    29,    38,    39,    40,    69,
-     691,    87,    88,    41,    68,    84,    85,   711,   901,   994,
-     995,   784,    43,    70,    96,    97,    98,   405,    45,    71,
-     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
-     165,   166,   434,   167,   168,   169,   170,   171,   172,   173,
-     440,   683,   174,   441,   175,   442,   176,   461,   177,   462,
-     178,   179,   180,   181,   414,   213,   214,    47,    72,   215,
-     466,   216,   467,   714,   217,   468,   717,   218,   182,   422,
-     183,   415,   762,   763,   764,   915,   184,   423,   185,   424,
-     809,   810,   811,   940,   785,   786,   787,   918,  1133,   788,
-     919,   789,   920,   790,   921,   791,   792,   499,   793,   794,
-     795,   796,   797,   798,   799,   800,   927,   801,   928,   802,
-     929,   803,   930,   804,   805,   806,   186,   451,   833,   834,
-     835,   836,   837,   838,   839,   187,   457,   869,   870,   871,
-     872,   873,   188,   454,   848,   849,   850,   963,    61,    79,
-     352,   353,   354,   512,   355,   513,   189,   455,   857,   858,
-     859,   860,   861,   862,   863,   864,   190,   444,   813,   814,
-     815,   943,    49,    73,   251,   252,   253,   476,   254,   472,
-     255,   473,   256,   474,   257,   477,   258,   480,   259,   479,
-     191,   450,   697,   261,   192,   447,   825,   826,   827,   952,
-    1058,  1059,   193,   445,    55,    76,   817,   818,   819,   946,
-      57,    77,   317,   318,   319,   320,   321,   322,   323,   498,
-     324,   502,   325,   501,   326,   327,   503,   328,   194,   446,
-     821,   822,   823,   949,    59,    78,   338,   339,   340,   341,
-     342,   507,   343,   344,   345,   346,   263,   475,   903,   904,
-     905,   996,    51,    74,   276,   277,   278,   484,   195,   448,
-     196,   449,   197,   453,   844,   845,   846,   960,    53,    75,
-     293,   294,   295,   198,   419,   199,   420,   200,   421,   299,
-     494,   908,   999,   300,   488,   301,   489,   302,   491,   303,
-     490,   304,   493,   305,   492,   306,   487,   270,   481,   909,
-     201,   452,   841,   842,   957,  1080,  1081,  1082,  1083,  1084,
-    1147,  1085,   202,   203,   458,   881,   882,   883,   979,   884,
-     980,   204,   459,   891,   892,   893,   894,   984,   895,   896,
-     986,   205,   460,    63,    80,   374,   375,   376,   377,   518,
-     378,   379,   520,   380,   381,   382,   523,   749,   383,   524,
-     384,   517,   385,   386,   387,   527,   388,   528,   389,   529,
-     390,   530,    99,   407,   100,   408,   101,   409,   206,   413,
-      67,    82,   396,   397,   398,   535,   399,   102,   406,    65,
-      81,   391,   392,   207,   463,   899,   900,   990,  1117,  1118,
-    1119,  1120,  1159,  1121,  1157,  1177,  1178,  1179,  1187,  1188,
-    1189,  1195,  1190,  1191,  1192,  1193,  1199
+     705,    87,    88,    41,    68,    84,    85,   725,   923,  1020,
+    1021,   802,    43,    70,    96,    97,    98,   412,    45,    71,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   441,   170,   171,   172,   173,   174,   175,   176,
+     447,   696,   177,   448,   178,   449,   179,   471,   180,   472,
+     181,   182,   451,   183,   184,   185,   186,   187,   421,   219,
+     220,    47,    72,   221,   476,   222,   477,   728,   223,   478,
+     731,   224,   188,   429,   189,   422,   776,   777,   778,   937,
+     190,   430,   191,   431,   831,   832,   833,   966,   803,   804,
+     805,   940,  1164,   806,   941,   807,   942,   808,   943,   809,
+     810,   509,   811,   812,   813,   814,   815,   816,   817,   818,
+     949,   819,   950,   820,   951,   821,   952,   822,   823,   824,
+     825,   959,   826,   960,   827,   961,   828,   192,   461,   855,
+     856,   857,   858,   859,   860,   861,   193,   467,   891,   892,
+     893,   894,   895,   194,   464,   870,   871,   872,   989,    61,
+      79,   359,   360,   361,   522,   362,   523,   195,   465,   879,
+     880,   881,   882,   883,   884,   885,   886,   196,   454,   835,
+     836,   837,   969,    49,    73,   258,   259,   260,   486,   261,
+     482,   262,   483,   263,   484,   264,   487,   265,   490,   266,
+     489,   197,   460,   711,   268,   198,   457,   847,   848,   849,
+     978,  1089,  1090,   199,   455,    55,    76,   839,   840,   841,
+     972,    57,    77,   324,   325,   326,   327,   328,   329,   330,
+     508,   331,   512,   332,   511,   333,   334,   513,   335,   200,
+     456,   843,   844,   845,   975,    59,    78,   345,   346,   347,
+     348,   349,   517,   350,   351,   352,   353,   270,   485,   925,
+     926,   927,  1022,    51,    74,   283,   284,   285,   494,   201,
+     458,   202,   459,   203,   463,   866,   867,   868,   986,    53,
+      75,   300,   301,   302,   204,   426,   205,   427,   206,   428,
+     306,   504,   930,  1025,   307,   498,   308,   499,   309,   501,
+     310,   500,   311,   503,   312,   502,   313,   497,   277,   491,
+     931,   207,   462,   863,   864,   983,  1111,  1112,  1113,  1114,
+    1115,  1181,  1116,   208,   209,   468,   903,   904,   905,  1005,
+     906,  1006,   210,   469,   913,   914,   915,   916,  1010,   917,
+     918,  1012,   211,   470,    63,    80,   381,   382,   383,   384,
+     528,   385,   386,   530,   387,   388,   389,   533,   763,   390,
+     534,   391,   527,   392,   393,   394,   537,   395,   538,   396,
+     539,   397,   540,    99,   414,   100,   415,   101,   416,   212,
+     420,    67,    82,   403,   404,   405,   545,   406,   102,   413,
+      65,    81,   398,   399,   213,   473,   921,   922,  1016,  1148,
+    1149,  1150,  1151,  1193,  1152,  1191,  1211,  1212,  1213,  1221,
+    1222,  1223,  1229,  1224,  1225,  1226,  1227,  1233
   };
 
   const unsigned short int
   Dhcp4Parser::yytable_[] =
   {
-      95,   154,   212,   231,   272,   289,   273,   315,   334,   351,
-     371,   316,   335,   807,  1053,   267,  1054,   296,   219,   264,
-     279,   291,   393,   329,   347,   724,   372,   307,  1066,    86,
-     232,   728,    30,   336,    89,   262,   275,   290,   411,   337,
-      42,   955,   233,   412,   956,   266,   234,   135,    31,   747,
-      32,   464,    33,   153,   349,   350,   465,    44,   220,   265,
-     280,   292,   470,   330,   348,   401,   373,   471,    83,   235,
-     268,   236,   297,   136,    46,   482,    48,   269,    50,   298,
-     483,   237,   109,   110,   111,   271,   138,   139,   485,   238,
-      52,   958,   239,   486,   959,   240,   241,    54,   228,   242,
-     243,   229,   244,   693,   694,   695,   696,   245,   138,   139,
-     246,   138,   139,   247,   248,   249,   514,   250,   260,    56,
-     274,   515,   208,   209,    94,   308,   210,  1182,    58,   211,
-    1183,  1184,  1185,  1186,    60,   136,    62,   109,   110,   111,
-     309,   331,   310,   311,   332,   333,   394,   395,   138,   139,
-     876,   877,   138,   139,   138,   139,   885,   886,   887,   281,
-     678,   679,   680,   681,    64,   282,   283,   284,   285,   286,
-     287,   991,   288,   309,   992,   310,   311,   531,    66,   312,
-     313,   314,   532,    94,   400,   138,   139,   748,    90,   135,
-     136,   309,   865,   866,   867,   402,   682,   403,    91,    92,
-      93,   138,   139,   138,   139,    94,   309,  1053,   888,  1054,
-    1180,   103,   404,  1181,   104,    94,  1069,  1070,   138,   139,
-     410,  1066,   416,   105,   417,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,    34,    35,    36,    37,   851,   852,
-     853,   854,   855,   856,   418,    94,   425,   533,   537,    94,
-     464,    94,   534,   538,   426,   911,   427,   115,   116,   117,
-     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,   428,  1024,   429,
-     135,   136,    94,   828,   829,   830,   831,   430,   832,   431,
-    1110,   137,  1111,  1112,   138,   139,   533,   537,    94,   140,
-      94,   912,   913,   470,   141,   142,   916,   937,   914,   937,
-     143,   917,   938,   432,   939,    94,   972,   138,   139,   977,
-     144,   973,   981,   145,   978,   349,   350,   982,   987,   531,
-     146,   147,   937,   988,   989,   148,   433,  1141,   149,   765,
-     435,    95,   150,   436,   766,   767,   768,   769,   770,   771,
-     772,   773,   774,   775,   776,   777,   778,   779,   780,   781,
-     782,   783,   151,   152,   437,   153,   356,   357,   358,   359,
-     360,   361,   362,   363,   364,   365,   366,   367,   368,   482,
-     712,   713,   438,  1145,  1142,   369,   370,   309,  1146,   439,
-     514,    94,  1160,   485,   154,  1152,   443,  1161,  1163,  1200,
-     212,   539,   540,   456,  1201,   469,  1129,  1130,  1131,  1132,
-     288,   906,   231,   478,    94,   272,   219,   273,   715,   716,
-     495,   496,   497,   500,   267,   504,   289,   506,   264,   508,
-     505,   279,   509,   511,   510,   516,   315,   519,   296,   232,
-     316,   334,   291,   521,   262,   335,   522,   275,   525,   526,
-     536,   233,   329,   541,   266,   234,   220,   347,   290,   542,
-     543,   371,   544,   545,   546,   548,   336,   549,   265,   550,
-     551,   280,   337,   552,   393,   553,   554,   372,   235,   268,
-     236,   555,   292,   556,   557,   558,   269,   559,   560,   561,
-     237,   562,   330,   297,   563,   565,    94,   348,   238,   564,
-     298,   239,   569,   566,   240,   241,   572,   567,   242,   243,
-     568,   244,   570,   571,   575,   576,   245,   373,   573,   246,
-     577,   574,   247,   248,   249,   578,   250,   260,   579,   580,
-     581,   274,   582,   583,   584,   585,   586,   587,   588,   589,
-    1164,   590,   591,   592,   665,   666,   667,     1,     2,     3,
+      95,   157,   218,   237,   279,   296,   280,   322,   341,   358,
+     378,   323,   342,   829,  1084,   274,  1085,   303,   225,   271,
+     286,   298,   400,   336,   354,   738,   379,   314,  1097,    86,
+     238,   742,    30,   343,    89,   269,   282,   297,   761,   344,
+     214,   215,   239,    42,   216,   273,   240,   217,    31,   156,
+      32,   138,    33,   356,   357,   141,   142,    44,   226,   272,
+     287,   299,   981,   337,   355,   982,   380,    83,    46,   241,
+     275,   242,   304,   691,   692,   693,   694,   276,    48,   305,
+     418,   243,   109,   110,   111,   419,   315,   984,    50,   244,
+     985,   139,   245,   141,   142,   246,   247,   898,   899,   248,
+     249,   474,   250,   278,   141,   142,   475,   251,  1017,   695,
+     252,  1018,   407,   253,   254,   255,   234,   256,   257,   235,
+     267,    52,   281,    94,   480,   492,   141,   142,   408,   481,
+     493,   887,   888,   889,  1160,  1161,  1162,  1163,   109,   110,
+     111,   316,   139,   317,   318,   495,   524,   319,   320,   321,
+     496,   525,    94,   141,   142,   141,   142,   141,   142,  1216,
+     401,   402,  1217,  1218,  1219,  1220,   288,   707,   708,   709,
+     710,    54,   289,   290,   291,   292,   293,   294,  1214,   295,
+     409,  1215,   410,   762,   873,   874,   875,   876,   877,   878,
+      94,   850,   851,   852,   853,    90,   854,   138,   139,   316,
+      56,    94,   907,   908,   909,    91,    92,    93,    58,   541,
+      60,   141,   142,   543,   542,  1084,   103,  1085,   544,   104,
+      62,   547,    94,    94,  1100,  1101,   548,    64,   105,  1097,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,    66,
+     474,    34,    35,    36,    37,   933,   543,   316,   547,   411,
+      94,   934,    94,   935,   910,   417,   480,   938,   963,   141,
+     142,   936,   939,   964,   356,   357,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   963,
+     998,  1054,   138,   139,   965,   999,   423,   316,   338,   317,
+     318,   339,   340,   140,   729,   730,   141,   142,    94,   141,
+     142,   143,   424,  1003,  1007,  1013,   144,   145,  1004,  1008,
+    1014,   541,   146,   963,   492,  1179,  1015,   425,  1175,  1176,
+    1180,  1141,   147,  1142,  1143,   148,   524,   295,   928,  1194,
+     495,  1186,   149,   150,  1195,  1197,  1234,   151,    95,   432,
+     152,  1235,   726,   727,   153,   433,    94,     1,     2,     3,
        4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,   593,   594,   595,   596,   597,   598,   600,   601,   602,
-     605,   603,   606,   607,   608,   609,   610,   612,   611,   613,
-     614,   616,   618,   619,   620,   621,   622,   623,   624,   625,
-     627,   628,   629,   154,   630,   631,   632,   633,   635,   212,
-     636,   637,   639,   640,   642,   393,   643,   644,   645,   646,
-     649,   650,   647,   653,   654,   219,   655,   651,   656,   648,
-     659,   662,   663,   652,   660,   664,   668,   669,   670,   671,
-     674,   672,   673,   868,   878,   675,   371,   676,   677,   684,
-     743,   685,    32,   686,   687,   688,   689,   698,   692,   874,
-     879,   889,   372,   699,   700,   220,   701,   702,   707,   703,
-     704,   705,   756,   107,   108,   109,   110,   111,   706,   708,
-     709,   710,   721,   718,   750,   719,   720,   722,   723,   725,
-     726,   727,   729,   730,   731,   732,   733,   734,   735,   875,
-     880,   890,   373,   736,   115,   116,   117,   118,   119,   120,
-     121,   122,   755,   737,   738,   739,   127,   128,   129,   130,
-     131,   132,   133,   740,   221,   222,   223,   761,   136,   808,
-     812,   816,   820,   824,   840,   843,   847,   741,   898,   224,
-     902,   138,   139,   225,   226,   227,   140,   742,   744,   745,
-     746,   752,   753,   228,   754,   922,   229,   143,   923,   924,
-     925,   926,   931,   932,   230,   933,   934,   935,   936,   942,
-     690,   941,   945,   944,   947,   948,   950,   951,   954,   953,
-     962,   757,   961,   965,   964,   966,   967,   968,   969,   970,
-     971,   974,   975,   976,   983,   985,   993,   998,   997,  1002,
-    1009,  1000,  1001,  1004,  1005,  1006,  1007,  1013,  1011,   151,
-     152,  1014,  1015,  1008,  1016,  1010,  1102,  1103,  1106,  1108,
-    1124,  1150,  1123,  1127,  1012,  1148,  1017,  1018,  1019,  1020,
-    1143,  1144,  1022,  1021,  1149,  1091,  1092,  1151,    94,  1158,
-    1098,  1166,  1169,  1171,  1196,  1093,  1094,  1095,  1096,  1099,
-    1174,  1176,  1197,  1198,  1202,  1206,   547,  1100,   599,  1107,
-    1105,  1128,  1167,  1134,  1135,  1136,   751,   760,   604,  1137,
-    1138,  1139,  1140,  1153,  1003,  1154,  1155,  1162,  1025,  1170,
-    1173,  1175,  1203,   231,  1204,  1205,   315,  1208,  1209,   334,
-     316,   910,  1032,   335,  1055,   267,  1052,  1071,  1101,   264,
-     289,  1072,   329,   351,  1063,   347,  1023,   641,  1061,  1077,
-     232,  1090,   296,  1075,   336,   262,   291,   868,  1073,  1033,
-     337,   878,   233,  1068,  1060,   266,   234,  1089,  1026,  1074,
-    1113,  1034,   290,   874,  1114,  1035,   272,   879,   273,   265,
-    1027,   615,   330,   889,  1067,   348,  1115,  1097,  1062,   235,
-     268,   236,   279,  1076,  1165,  1028,   292,   269,  1036,  1064,
-    1037,   237,  1031,  1029,  1078,  1030,  1065,   297,   275,   238,
-    1038,  1079,   239,   875,   298,   240,   241,   880,  1039,   242,
-     243,  1040,   244,   890,  1041,  1042,  1116,   245,  1043,  1044,
-     246,  1045,   280,   247,   248,   249,  1046,   250,   260,  1047,
-    1125,  1126,  1048,  1049,  1050,   634,  1051,  1057,  1056,   626,
-     617,  1088,  1168,   907,   897,  1109,  1104,  1087,   759,  1086,
-     638,   661,   758,  1172,  1194,  1207,     0,     0,     0,  1122,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   657,     0,     0,   658,     0,     0,     0,     0,     0,
-       0,     0,   274,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,  1032,     0,  1055,     0,  1052,
-    1071,     0,     0,     0,  1072,     0,     0,  1063,     0,     0,
-    1113,  1061,  1077,     0,  1114,     0,  1075,     0,     0,     0,
-       0,  1073,  1033,     0,     0,     0,  1115,  1060,  1156,     0,
-       0,     0,  1074,     0,  1034,     0,     0,     0,  1035,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,  1062,     0,     0,     0,     0,  1076,     0,     0,     0,
-       0,  1036,  1064,  1037,     0,     0,  1116,  1078,     0,  1065,
-       0,     0,     0,  1038,  1079,     0,     0,     0,     0,     0,
-       0,  1039,     0,     0,  1040,     0,     0,  1041,  1042,     0,
-       0,  1043,  1044,     0,  1045,     0,     0,     0,     0,  1046,
-       0,     0,  1047,     0,     0,  1048,  1049,  1050,     0,  1051,
-    1057,  1056,   107,   108,   109,   110,   111,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   115,   116,   117,   118,   119,   120,   121,
-     122,     0,     0,     0,     0,   127,   128,   129,   130,   131,
-     132,   133,   134,     0,     0,     0,     0,   136,   309,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     138,   139,     0,   226,     0,   140,     0,     0,     0,     0,
-       0,     0,   228,     0,     0,   229,     0,     0,     0,     0,
-       0,     0,     0,   230,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   151,   152,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    94
+      14,   434,   435,   436,   154,   155,   779,   156,   437,   438,
+     439,   780,   781,   782,   783,   784,   785,   786,   787,   788,
+     789,   790,   791,   792,   793,   794,   795,   796,   797,   798,
+     799,   800,   801,    94,   157,   440,    94,   549,   550,   442,
+     218,   443,   444,   445,   446,   551,   450,   452,   453,   466,
+     479,   488,   237,   510,   506,   279,   225,   280,   505,   514,
+     507,   316,   515,   516,   274,   518,   296,   519,   271,   521,
+     520,   286,   526,   529,   531,   532,   322,   535,   303,   238,
+     323,   341,   298,   536,   269,   342,   546,   282,   552,   553,
+     554,   239,   336,   555,   273,   240,   226,   354,   297,   556,
+     558,   378,   559,   560,   561,   562,   343,   563,   272,   564,
+     565,   287,   344,   566,   400,   567,   568,   379,   241,   275,
+     242,   569,   299,   570,   571,   572,   276,   573,   574,   579,
+     243,   575,   337,   304,   576,   577,   578,   355,   244,   585,
+     305,   245,   141,   142,   246,   247,   580,   582,   248,   249,
+     583,   250,   586,   581,   587,   589,   251,   380,   584,   252,
+     588,   590,   253,   254,   255,   591,   256,   257,   592,   267,
+      94,   593,   594,   281,   595,   596,   597,   598,   599,   600,
+     601,   602,   603,   678,   679,   680,   604,   605,  1198,   606,
+     607,   363,   364,   365,   366,   367,   368,   369,   370,   371,
+     372,   373,   374,   375,   608,   609,   610,   611,   613,   614,
+     376,   377,   615,   616,   618,   619,   620,   621,   622,   623,
+     624,   625,   626,   627,   629,   631,   632,   633,   634,   635,
+     636,   637,   638,   640,   641,   642,   157,   643,   644,    94,
+     645,   648,   218,   652,   653,   656,   657,   659,   400,   646,
+     662,   663,   666,   667,   649,   668,   658,   650,   225,   655,
+     664,   669,   672,   660,   661,   675,   676,   677,   665,   681,
+     107,   108,   109,   110,   111,   673,   682,   890,   900,   683,
+     378,   684,   757,   687,   688,   685,   686,   689,   690,   697,
+     698,   699,   700,   896,   901,   911,   379,   701,   226,   702,
+     703,   706,   712,    32,   770,   115,   116,   117,   118,   119,
+     120,   121,   122,   713,   714,   715,   721,   127,   128,   129,
+     130,   131,   132,   133,   134,   716,   717,   718,   227,   228,
+     229,   719,   139,   897,   902,   912,   380,   720,   722,   723,
+     724,   732,   733,   230,   734,   141,   142,   231,   232,   233,
+     143,   735,   736,   737,   739,   740,   741,   234,   743,   744,
+     235,   146,   764,   745,   746,   769,   775,   747,   236,   830,
+     834,   838,   842,   846,   862,   865,   869,   748,   749,   750,
+     751,   107,   108,   109,   110,   111,   752,   753,   754,   755,
+     756,   758,   759,   760,   766,   767,   920,   768,   924,   944,
+     945,   946,   947,   948,   953,   954,   955,   956,   957,   958,
+     962,   968,  1208,   154,   155,   967,   115,   116,   117,   118,
+     119,   120,   121,   122,   970,   971,   973,   974,   127,   128,
+     129,   130,   131,   132,   133,   134,   976,   977,   137,   979,
+     980,   987,    94,   139,   316,   988,   990,   991,  1019,   992,
+     993,   994,   995,   996,   997,  1000,   141,   142,  1001,   232,
+    1002,   143,  1009,  1011,  1024,  1026,  1023,  1034,   234,  1027,
+    1028,   235,  1030,  1031,  1032,  1033,  1035,  1036,  1039,   236,
+    1037,  1040,  1038,  1041,  1042,  1043,  1047,  1044,  1045,  1046,
+    1048,  1049,  1050,  1051,  1129,  1133,  1134,  1052,  1122,  1123,
+    1124,  1125,  1126,  1127,  1130,  1131,  1137,  1139,  1136,  1155,
+    1138,  1154,  1158,  1159,  1165,  1166,  1182,  1177,  1178,  1167,
+    1168,  1169,  1183,  1170,   154,   155,  1171,  1172,  1184,   237,
+    1173,  1174,   322,  1192,  1185,   341,   323,  1187,  1062,   342,
+    1086,   274,  1083,  1102,  1200,   271,   296,  1103,   336,   358,
+    1094,   354,  1188,    94,  1092,  1108,   238,  1189,   303,  1106,
+     343,   269,   298,   890,  1104,  1063,   344,   900,   239,  1196,
+    1091,   273,   240,  1201,  1203,  1105,  1144,  1064,   297,   896,
+    1145,  1065,   279,   901,   280,   272,  1204,  1205,   337,   911,
+    1207,   355,  1146,  1210,  1093,   241,   275,   242,   286,  1107,
+    1230,  1231,   299,   276,  1066,  1095,  1067,   243,  1209,  1232,
+    1109,  1236,  1096,   304,   282,   244,  1068,  1110,   245,   897,
+     305,   246,   247,   902,  1069,   248,   249,  1070,   250,   912,
+    1071,  1072,  1147,   251,  1073,  1074,   252,  1075,   287,   253,
+     254,   255,  1076,   256,   257,  1077,   267,  1240,  1078,  1079,
+    1080,  1238,  1081,  1082,  1237,  1088,  1087,   765,   771,   774,
+    1029,  1239,  1242,  1243,   617,   932,  1055,  1053,   704,  1099,
+     557,  1132,  1121,   654,  1120,  1056,  1057,  1128,  1199,   628,
+     612,  1119,  1098,  1059,  1058,  1061,  1118,  1157,  1060,  1202,
+     919,  1156,   773,   670,  1117,   929,   772,  1206,  1228,  1135,
+     281,  1241,   671,     0,   674,     0,     0,  1140,     0,     0,
+       0,   630,  1153,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   647,     0,     0,     0,     0,     0,     0,
+     651,     0,     0,     0,     0,     0,     0,   639,     0,  1062,
+       0,  1086,     0,  1083,  1102,     0,     0,     0,  1103,     0,
+       0,  1094,     0,     0,  1144,  1092,  1108,     0,  1145,     0,
+    1106,     0,     0,     0,     0,  1104,  1063,     0,  1190,     0,
+    1146,  1091,     0,     0,     0,     0,  1105,     0,  1064,     0,
+       0,     0,  1065,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1093,     0,     0,     0,     0,
+    1107,     0,     0,     0,     0,  1066,  1095,  1067,     0,     0,
+    1147,  1109,     0,  1096,     0,     0,     0,  1068,  1110,     0,
+       0,     0,     0,     0,     0,  1069,     0,     0,  1070,     0,
+       0,  1071,  1072,     0,     0,  1073,  1074,     0,  1075,     0,
+       0,     0,     0,  1076,     0,     0,  1077,     0,     0,  1078,
+    1079,  1080,     0,  1081,  1082,     0,  1088,  1087
   };
 
   const short int
   Dhcp4Parser::yycheck_[] =
   {
       70,    71,    72,    73,    74,    75,    74,    77,    78,    79,
-      80,    77,    78,   675,   952,    73,   952,    75,    72,    73,
-      74,    75,    81,    77,    78,   612,    80,    76,   952,   191,
-      73,   618,     0,    78,    10,    73,    74,    75,     3,    78,
-       7,     3,    73,     8,     6,    73,    73,    80,     5,    18,
-       7,     3,     9,   165,   121,   122,     8,     7,    72,    73,
-      74,    75,     3,    77,    78,     3,    80,     8,    68,    73,
-      73,    73,    75,    81,     7,     3,     7,    73,     7,    75,
-       8,    73,    28,    29,    30,    93,    94,    95,     3,    73,
-       7,     3,    73,     8,     6,    73,    73,     7,   106,    73,
-      73,   109,    73,   100,   101,   102,   103,    73,    94,    95,
-      73,    94,    95,    73,    73,    73,     3,    73,    73,     7,
-      74,     8,    15,    16,   191,    34,    19,   167,     7,    22,
-     170,   171,   172,   173,     7,    81,     7,    28,    29,    30,
-      82,    83,    84,    85,    86,    87,    12,    13,    94,    95,
-     136,   137,    94,    95,    94,    95,   139,   140,   141,   105,
-     158,   159,   160,   161,     7,   111,   112,   113,   114,   115,
-     116,     3,   118,    82,     6,    84,    85,     3,     7,    88,
-      89,    90,     8,   191,     6,    94,    95,   156,   164,    80,
-      81,    82,   132,   133,   134,     4,   194,     8,   174,   175,
-     176,    94,    95,    94,    95,   191,    82,  1145,   191,  1145,
-       3,    11,     3,     6,    14,   191,   107,   108,    94,    95,
-       4,  1145,     4,    23,     4,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,   191,   192,   193,   194,   124,   125,
-     126,   127,   128,   129,     4,   191,     4,     3,     3,   191,
-       3,   191,     8,     8,     4,     8,     4,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,     4,   940,     4,
-      80,    81,   191,   111,   112,   113,   114,     4,   116,     4,
-     166,    91,   168,   169,    94,    95,     3,     3,   191,    99,
-     191,     8,     8,     3,   104,   105,     3,     3,     8,     3,
-     110,     8,     8,     4,     8,   191,     3,    94,    95,     3,
-     120,     8,     3,   123,     8,   121,   122,     8,     3,     3,
-     130,   131,     3,     8,     8,   135,     4,     8,   138,    34,
-       4,   411,   142,     4,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,   162,   163,     4,   165,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,   153,   154,   155,     3,
-      17,    18,     4,     3,     8,   162,   163,    82,     8,     4,
-       3,   191,     3,     3,   464,     8,     4,     8,     8,     3,
-     470,   401,   402,     4,     8,     4,    35,    36,    37,    38,
-     118,   119,   482,     4,   191,   485,   470,   485,    20,    21,
-       8,     3,     8,     4,   482,     4,   496,     3,   482,     4,
-       8,   485,     4,     3,     8,     4,   506,     4,   496,   482,
-     506,   511,   496,     4,   482,   511,     4,   485,     4,     4,
-       4,   482,   506,   191,   482,   482,   470,   511,   496,     4,
-       4,   531,     4,     4,     4,     4,   511,     4,   482,     4,
-     194,   485,   511,   194,   533,   194,     4,   531,   482,   482,
-     482,     4,   496,     4,     4,     4,   482,     4,   192,   192,
-     482,   192,   506,   496,   192,   194,   191,   511,   482,   192,
-     496,   482,     4,   193,   482,   482,   194,   193,   482,   482,
-     192,   482,   192,   192,     4,     4,   482,   531,   194,   482,
-       4,   194,   482,   482,   482,   194,   482,   482,     4,     4,
-       4,   485,     4,     4,     4,     4,     4,     4,     4,     4,
-    1127,     4,   192,     4,   544,   545,   546,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   194,     4,     4,     4,     4,     4,     4,   192,     4,
+      80,    77,    78,   688,   978,    73,   978,    75,    72,    73,
+      74,    75,    81,    77,    78,   625,    80,    76,   978,   198,
+      73,   631,     0,    78,    10,    73,    74,    75,    18,    78,
+      15,    16,    73,     7,    19,    73,    73,    22,     5,   172,
+       7,    87,     9,   128,   129,   101,   102,     7,    72,    73,
+      74,    75,     3,    77,    78,     6,    80,    68,     7,    73,
+      73,    73,    75,   165,   166,   167,   168,    73,     7,    75,
+       3,    73,    28,    29,    30,     8,    34,     3,     7,    73,
+       6,    88,    73,   101,   102,    73,    73,   143,   144,    73,
+      73,     3,    73,   100,   101,   102,     8,    73,     3,   201,
+      73,     6,     6,    73,    73,    73,   113,    73,    73,   116,
+      73,     7,    74,   198,     3,     3,   101,   102,     3,     8,
+       8,   139,   140,   141,    35,    36,    37,    38,    28,    29,
+      30,    89,    88,    91,    92,     3,     3,    95,    96,    97,
+       8,     8,   198,   101,   102,   101,   102,   101,   102,   174,
+      12,    13,   177,   178,   179,   180,   112,   107,   108,   109,
+     110,     7,   118,   119,   120,   121,   122,   123,     3,   125,
+       4,     6,     8,   163,   131,   132,   133,   134,   135,   136,
+     198,   118,   119,   120,   121,   171,   123,    87,    88,    89,
+       7,   198,   146,   147,   148,   181,   182,   183,     7,     3,
+       7,   101,   102,     3,     8,  1179,    11,  1179,     8,    14,
+       7,     3,   198,   198,   114,   115,     8,     7,    23,  1179,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,     7,
+       3,   198,   199,   200,   201,     8,     3,    89,     3,     3,
+     198,     8,   198,     8,   198,     4,     3,     3,     3,   101,
+     102,     8,     8,     8,   128,   129,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,     3,
+       3,   966,    87,    88,     8,     8,     4,    89,    90,    91,
+      92,    93,    94,    98,    20,    21,   101,   102,   198,   101,
+     102,   106,     4,     3,     3,     3,   111,   112,     8,     8,
+       8,     3,   117,     3,     3,     3,     8,     4,     8,     8,
+       8,   173,   127,   175,   176,   130,     3,   125,   126,     3,
+       3,     8,   137,   138,     8,     8,     3,   142,   418,     4,
+     145,     8,    17,    18,   149,     4,   198,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
+     197,     4,     4,     4,   169,   170,    34,   172,     4,     4,
+       4,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,   198,   474,     4,   198,   408,   409,     4,
+     480,     4,     4,     4,     4,   198,     4,     4,     4,     4,
+       4,     4,   492,     4,     3,   495,   480,   495,     8,     4,
+       8,    89,     8,     3,   492,     4,   506,     4,   492,     3,
+       8,   495,     4,     4,     4,     4,   516,     4,   506,   492,
+     516,   521,   506,     4,   492,   521,     4,   495,     4,     4,
+       4,   492,   516,     4,   492,   492,   480,   521,   506,     4,
+       4,   541,     4,     4,   201,   201,   521,   201,   492,     4,
+       4,   495,   521,     4,   543,     4,     4,   541,   492,   492,
+     492,     4,   506,   199,   199,   199,   492,   199,   199,     4,
+     492,   201,   516,   506,   200,   200,   199,   521,   492,     4,
+     506,   492,   101,   102,   492,   492,   199,   201,   492,   492,
+     201,   492,     4,   199,     4,     4,   492,   541,   201,   492,
+     201,   201,   492,   492,   492,   201,   492,   492,     4,   492,
+     198,     4,     4,   495,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,   554,   555,   556,   199,     4,  1158,     4,
+       4,   150,   151,   152,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,     4,     4,     4,     4,     4,     4,
+     169,   170,     4,   201,     4,     4,     4,     4,     4,     4,
+     199,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,   199,   676,     4,     4,   198,
+       4,     4,   682,     4,     4,     4,     4,     4,   677,   201,
+       4,     4,     4,     4,   201,     4,   199,   201,   682,   201,
+     201,     4,     4,   199,   199,     4,     7,     7,   201,     7,
+      26,    27,    28,    29,    30,   199,     7,   717,   718,     7,
+     720,   198,   653,     7,     7,   198,   198,     5,   198,   198,
+     198,   198,     5,   717,   718,   719,   720,     5,   682,     5,
+       5,   198,     5,     7,   675,    61,    62,    63,    64,    65,
+      66,    67,    68,     5,     5,     5,   198,    73,    74,    75,
+      76,    77,    78,    79,    80,     7,     7,     7,    84,    85,
+      86,     7,    88,   717,   718,   719,   720,     7,   198,     5,
+       5,   198,   198,    99,   198,   101,   102,   103,   104,   105,
+     106,     5,   198,   198,   198,     7,   198,   113,   198,   198,
+     116,   117,   164,   198,   198,     5,    24,   198,   124,     7,
+       7,     7,     7,     7,     7,     7,     7,   198,   198,   198,
+     198,    26,    27,    28,    29,    30,   198,   198,   198,   198,
+     198,   198,   198,   198,   198,   198,     7,   198,     7,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,   192,   663,     4,     4,     4,   194,     4,   669,
-     194,   194,     4,     4,   194,   664,     4,     4,   192,     4,
-       4,     4,   192,     4,     4,   669,     4,   194,     4,   192,
-       4,     4,     7,   194,   192,     7,     7,     7,     7,   191,
-       7,   191,   191,   703,   704,     7,   706,     5,   191,   191,
-     640,   191,     7,     5,     5,     5,     5,     5,   191,   703,
-     704,   705,   706,     5,     5,   669,     5,     7,   191,     7,
-       7,     7,   662,    26,    27,    28,    29,    30,     7,   191,
-       5,     5,     5,   191,   157,   191,   191,   191,   191,   191,
-       7,   191,   191,   191,   191,   191,   191,   191,   191,   703,
-     704,   705,   706,   191,    57,    58,    59,    60,    61,    62,
-      63,    64,     5,   191,   191,   191,    69,    70,    71,    72,
-      73,    74,    75,   191,    77,    78,    79,    24,    81,     7,
-       7,     7,     7,     7,     7,     7,     7,   191,     7,    92,
-       7,    94,    95,    96,    97,    98,    99,   191,   191,   191,
-     191,   191,   191,   106,   191,     4,   109,   110,     4,     4,
-       4,     4,     4,     4,   117,     4,     4,     4,     4,     3,
-     583,     6,     3,     6,     6,     3,     6,     3,     3,     6,
-       3,   663,     6,     3,     6,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,   191,     3,     6,     4,
-     194,     8,     6,     4,     4,     4,     4,     4,   194,   162,
-     163,     4,     4,   192,     4,   192,     4,     4,     4,     4,
-       3,     3,     6,     4,   192,     4,   192,   192,   192,   192,
-       8,     8,   192,   194,     8,   192,   192,     8,   191,     4,
-     194,     4,     4,     4,     4,   192,   192,   192,   192,   192,
-       5,     7,     4,     4,     4,     4,   411,   192,   464,   192,
-     194,   191,   194,   191,   191,   191,   653,   669,   470,   191,
-     191,   191,   191,   191,   916,   191,   191,   191,   942,   192,
-     191,   191,   194,   943,   192,   192,   946,   191,   191,   949,
-     946,   755,   952,   949,   952,   943,   952,   957,   977,   943,
-     960,   957,   946,   963,   952,   949,   937,   514,   952,   957,
-     943,   965,   960,   957,   949,   943,   960,   977,   957,   952,
-     949,   981,   943,   955,   952,   943,   943,   963,   943,   957,
-     990,   952,   960,   977,   990,   952,   996,   981,   996,   943,
-     945,   482,   946,   987,   954,   949,   990,   972,   952,   943,
-     943,   943,   996,   957,  1145,   946,   960,   943,   952,   952,
-     952,   943,   951,   948,   957,   949,   952,   960,   996,   943,
-     952,   957,   943,   977,   960,   943,   943,   981,   952,   943,
-     943,   952,   943,   987,   952,   952,   990,   943,   952,   952,
-     943,   952,   996,   943,   943,   943,   952,   943,   943,   952,
-     996,   998,   952,   952,   952,   506,   952,   952,   952,   496,
-     485,   962,  1150,   726,   706,   987,   981,   960,   668,   958,
-     511,   537,   664,  1160,  1180,  1200,    -1,    -1,    -1,   991,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   531,    -1,    -1,   533,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   996,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,  1145,    -1,  1145,    -1,  1145,
-    1150,    -1,    -1,    -1,  1150,    -1,    -1,  1145,    -1,    -1,
-    1160,  1145,  1150,    -1,  1160,    -1,  1150,    -1,    -1,    -1,
-      -1,  1150,  1145,    -1,    -1,    -1,  1160,  1145,  1108,    -1,
-      -1,    -1,  1150,    -1,  1145,    -1,    -1,    -1,  1145,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,  1145,    -1,    -1,    -1,    -1,  1150,    -1,    -1,    -1,
-      -1,  1145,  1145,  1145,    -1,    -1,  1160,  1150,    -1,  1145,
-      -1,    -1,    -1,  1145,  1150,    -1,    -1,    -1,    -1,    -1,
-      -1,  1145,    -1,    -1,  1145,    -1,    -1,  1145,  1145,    -1,
-      -1,  1145,  1145,    -1,  1145,    -1,    -1,    -1,    -1,  1145,
-      -1,    -1,  1145,    -1,    -1,  1145,  1145,  1145,    -1,  1145,
-    1145,  1145,    26,    27,    28,    29,    30,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    57,    58,    59,    60,    61,    62,    63,
-      64,    -1,    -1,    -1,    -1,    69,    70,    71,    72,    73,
-      74,    75,    76,    -1,    -1,    -1,    -1,    81,    82,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      94,    95,    -1,    97,    -1,    99,    -1,    -1,    -1,    -1,
-      -1,    -1,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   117,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   162,   163,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   191
+       4,     3,     5,   169,   170,     6,    61,    62,    63,    64,
+      65,    66,    67,    68,     6,     3,     6,     3,    73,    74,
+      75,    76,    77,    78,    79,    80,     6,     3,    83,     6,
+       3,     6,   198,    88,    89,     3,     6,     3,   198,     4,
+       4,     4,     4,     4,     4,     4,   101,   102,     4,   104,
+       4,   106,     4,     4,     3,     8,     6,   199,   113,     6,
+       4,   116,     4,     4,     4,     4,   201,   199,     4,   124,
+     201,     4,   199,     4,     4,   199,   201,   199,   199,   199,
+     199,     4,     4,     4,   201,     4,     4,   199,   199,   199,
+     199,   199,   199,   199,   199,   199,     4,     4,   201,     3,
+     199,     6,     4,   198,   198,   198,     4,     8,     8,   198,
+     198,   198,     8,   198,   169,   170,   198,   198,     3,   969,
+     198,   198,   972,     4,     8,   975,   972,   198,   978,   975,
+     978,   969,   978,   983,     4,   969,   986,   983,   972,   989,
+     978,   975,   198,   198,   978,   983,   969,   198,   986,   983,
+     975,   969,   986,  1003,   983,   978,   975,  1007,   969,   198,
+     978,   969,   969,   201,     4,   983,  1016,   978,   986,  1003,
+    1016,   978,  1022,  1007,  1022,   969,   199,     4,   972,  1013,
+     198,   975,  1016,     7,   978,   969,   969,   969,  1022,   983,
+       4,     4,   986,   969,   978,   978,   978,   969,   198,     4,
+     983,     4,   978,   986,  1022,   969,   978,   983,   969,  1003,
+     986,   969,   969,  1007,   978,   969,   969,   978,   969,  1013,
+     978,   978,  1016,   969,   978,   978,   969,   978,  1022,   969,
+     969,   969,   978,   969,   969,   978,   969,     4,   978,   978,
+     978,   199,   978,   978,   201,   978,   978,   666,   676,   682,
+     938,   199,   198,   198,   480,   769,   968,   963,   596,   981,
+     418,  1003,   991,   524,   989,   969,   971,   998,  1179,   492,
+     474,   988,   980,   974,   972,   977,   986,  1024,   975,  1184,
+     720,  1022,   681,   541,   984,   740,   677,  1194,  1214,  1007,
+    1022,  1234,   543,    -1,   547,    -1,    -1,  1013,    -1,    -1,
+      -1,   495,  1017,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   516,    -1,    -1,    -1,    -1,    -1,    -1,
+     521,    -1,    -1,    -1,    -1,    -1,    -1,   506,    -1,  1179,
+      -1,  1179,    -1,  1179,  1184,    -1,    -1,    -1,  1184,    -1,
+      -1,  1179,    -1,    -1,  1194,  1179,  1184,    -1,  1194,    -1,
+    1184,    -1,    -1,    -1,    -1,  1184,  1179,    -1,  1139,    -1,
+    1194,  1179,    -1,    -1,    -1,    -1,  1184,    -1,  1179,    -1,
+      -1,    -1,  1179,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,  1179,    -1,    -1,    -1,    -1,
+    1184,    -1,    -1,    -1,    -1,  1179,  1179,  1179,    -1,    -1,
+    1194,  1184,    -1,  1179,    -1,    -1,    -1,  1179,  1184,    -1,
+      -1,    -1,    -1,    -1,    -1,  1179,    -1,    -1,  1179,    -1,
+      -1,  1179,  1179,    -1,    -1,  1179,  1179,    -1,  1179,    -1,
+      -1,    -1,    -1,  1179,    -1,    -1,  1179,    -1,    -1,  1179,
+    1179,  1179,    -1,  1179,  1179,    -1,  1179,  1179
   };
 
   const unsigned short int
   Dhcp4Parser::yystos_[] =
   {
-       0,   177,   178,   179,   180,   181,   182,   183,   184,   185,
-     186,   187,   188,   189,   190,   196,   197,   198,   199,   200,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-       0,     5,     7,     9,   191,   192,   193,   194,   211,   212,
-     213,   218,     7,   227,     7,   233,     7,   272,     7,   377,
-       7,   457,     7,   473,     7,   409,     7,   415,     7,   439,
-       7,   353,     7,   538,     7,   584,     7,   575,   219,   214,
-     228,   234,   273,   378,   458,   474,   410,   416,   440,   354,
-     539,   585,   576,   211,   220,   221,   191,   216,   217,    10,
-     164,   174,   175,   176,   191,   226,   229,   230,   231,   567,
-     569,   571,   582,    11,    14,    23,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,    74,    75,    76,    80,    81,    91,    94,    95,
-      99,   104,   105,   110,   120,   123,   130,   131,   135,   138,
-     142,   162,   163,   165,   226,   235,   236,   237,   238,   239,
-     240,   241,   242,   243,   244,   245,   246,   248,   249,   250,
-     251,   252,   253,   254,   257,   259,   261,   263,   265,   266,
-     267,   268,   283,   285,   291,   293,   331,   340,   347,   361,
-     371,   395,   399,   407,   433,   463,   465,   467,   478,   480,
-     482,   505,   517,   518,   526,   536,   573,   588,    15,    16,
-      19,    22,   226,   270,   271,   274,   276,   279,   282,   463,
-     465,    77,    78,    79,    92,    96,    97,    98,   106,   109,
-     117,   226,   237,   238,   239,   240,   241,   242,   243,   244,
-     249,   250,   251,   252,   253,   254,   257,   259,   261,   263,
-     265,   379,   380,   381,   383,   385,   387,   389,   391,   393,
-     395,   398,   433,   451,   463,   465,   467,   478,   480,   482,
-     502,    93,   226,   391,   393,   433,   459,   460,   461,   463,
-     465,   105,   111,   112,   113,   114,   115,   116,   118,   226,
-     433,   463,   465,   475,   476,   477,   478,   480,   482,   484,
-     488,   490,   492,   494,   496,   498,   500,   407,    34,    82,
-      84,    85,    88,    89,    90,   226,   311,   417,   418,   419,
-     420,   421,   422,   423,   425,   427,   429,   430,   432,   463,
-     465,    83,    86,    87,   226,   311,   421,   427,   441,   442,
-     443,   444,   445,   447,   448,   449,   450,   463,   465,   121,
-     122,   226,   355,   356,   357,   359,   143,   144,   145,   146,
-     147,   148,   149,   150,   151,   152,   153,   154,   155,   162,
-     163,   226,   463,   465,   540,   541,   542,   543,   545,   546,
-     548,   549,   550,   553,   555,   557,   558,   559,   561,   563,
-     565,   586,   587,   588,    12,    13,   577,   578,   579,   581,
-       6,     3,     4,     8,     3,   232,   583,   568,   570,   572,
-       4,     3,     8,   574,   269,   286,     4,     4,     4,   479,
-     481,   483,   284,   292,   294,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   247,     4,     4,     4,     4,     4,
-     255,   258,   260,     4,   372,   408,   434,   400,   464,   466,
-     396,   332,   506,   468,   348,   362,     4,   341,   519,   527,
-     537,   262,   264,   589,     3,     8,   275,   277,   280,     4,
-       3,     8,   384,   386,   388,   452,   382,   390,     4,   394,
-     392,   503,     3,     8,   462,     3,     8,   501,   489,   491,
-     495,   493,   499,   497,   485,     8,     3,     8,   424,   312,
-       4,   428,   426,   431,     4,     8,     3,   446,     4,     4,
-       8,     3,   358,   360,     3,     8,     4,   556,   544,     4,
-     547,     4,     4,   551,   554,     4,     4,   560,   562,   564,
-     566,     3,     8,     3,     8,   580,     4,     3,     8,   211,
-     211,   191,     4,     4,     4,     4,     4,   230,     4,     4,
-       4,   194,   194,   194,     4,     4,     4,     4,     4,     4,
-     192,   192,   192,   192,   192,   194,   193,   193,   192,     4,
-     192,   192,   194,   194,   194,     4,     4,     4,   194,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   192,     4,     4,     4,     4,     4,     4,     4,   236,
-       4,     4,     4,   194,   271,     4,     4,     4,     4,     4,
-       4,   192,     4,     4,     4,   380,     4,   460,     4,     4,
-       4,     4,     4,     4,     4,     4,   477,     4,     4,   192,
-       4,     4,     4,   194,   419,     4,   194,   194,   443,     4,
-       4,   356,   194,     4,     4,   192,     4,   192,   192,     4,
-       4,   194,   194,     4,     4,     4,     4,   541,   587,     4,
-     192,   578,     4,     7,     7,   211,   211,   211,     7,     7,
-       7,   191,   191,   191,     7,     7,     5,   191,   158,   159,
-     160,   161,   194,   256,   191,   191,     5,     5,     5,     5,
-     213,   215,   191,   100,   101,   102,   103,   397,     5,     5,
-       5,     5,     7,     7,     7,     7,     7,   191,   191,     5,
-       5,   222,    17,    18,   278,    20,    21,   281,   191,   191,
-     191,     5,   191,   191,   222,   191,     7,   191,   222,   191,
-     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-     191,   191,   191,   211,   191,   191,   191,    18,   156,   552,
-     157,   256,   191,   191,   191,     5,   211,   235,   586,   577,
-     270,    24,   287,   288,   289,    34,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,   226,   299,   300,   301,   304,   306,
-     308,   310,   311,   313,   314,   315,   316,   317,   318,   319,
-     320,   322,   324,   326,   328,   329,   330,   299,     7,   295,
-     296,   297,     7,   373,   374,   375,     7,   411,   412,   413,
-       7,   435,   436,   437,     7,   401,   402,   403,   111,   112,
-     113,   114,   116,   333,   334,   335,   336,   337,   338,   339,
-       7,   507,   508,     7,   469,   470,   471,     7,   349,   350,
-     351,   124,   125,   126,   127,   128,   129,   363,   364,   365,
-     366,   367,   368,   369,   370,   132,   133,   134,   226,   342,
-     343,   344,   345,   346,   463,   465,   136,   137,   226,   463,
-     465,   520,   521,   522,   524,   139,   140,   141,   191,   463,
-     465,   528,   529,   530,   531,   533,   534,   540,     7,   590,
-     591,   223,     7,   453,   454,   455,   119,   484,   486,   504,
-     295,     8,     8,     8,     8,   290,     3,     8,   302,   305,
-     307,   309,     4,     4,     4,     4,     4,   321,   323,   325,
-     327,     4,     4,     4,     4,     4,     4,     3,     8,     8,
-     298,     6,     3,   376,     6,     3,   414,     6,     3,   438,
-       6,     3,   404,     6,     3,     3,     6,   509,     3,     6,
-     472,     6,     3,   352,     6,     3,     4,     4,     4,     4,
-       4,     4,     3,     8,     4,     4,     4,     3,     8,   523,
-     525,     3,     8,     4,   532,     4,   535,     3,     8,     8,
-     592,     3,     6,   191,   224,   225,   456,     6,     3,   487,
-       8,     6,     4,   288,     4,     4,     4,     4,   192,   194,
-     192,   194,   192,     4,     4,     4,     4,   192,   192,   192,
-     192,   194,   192,   300,   299,   297,   379,   375,   417,   413,
-     441,   437,   226,   237,   238,   239,   240,   241,   242,   243,
-     244,   249,   250,   251,   252,   253,   254,   257,   259,   261,
-     263,   265,   311,   371,   389,   391,   393,   395,   405,   406,
-     433,   463,   465,   478,   480,   482,   502,   403,   334,   107,
-     108,   226,   311,   407,   433,   463,   465,   478,   480,   482,
-     510,   511,   512,   513,   514,   516,   508,   475,   471,   355,
-     351,   192,   192,   192,   192,   192,   192,   364,   194,   192,
-     192,   343,     4,     4,   521,   194,     4,   192,     4,   529,
-     166,   168,   169,   226,   311,   463,   465,   593,   594,   595,
-     596,   598,   591,     6,     3,   459,   455,     4,   191,    35,
-      36,    37,    38,   303,   191,   191,   191,   191,   191,   191,
-     191,     8,     8,     8,     8,     3,     8,   515,     4,     8,
-       3,     8,     8,   191,   191,   191,   211,   599,     4,   597,
-       3,     8,   191,     8,   222,   406,     4,   194,   512,     4,
-     192,     4,   594,   191,     5,   191,     7,   600,   601,   602,
-       3,     6,   167,   170,   171,   172,   173,   603,   604,   605,
-     607,   608,   609,   610,   601,   606,     4,     4,     4,   611,
-       3,     8,     4,   194,   192,   192,     4,   604,   191,   191
+       0,   184,   185,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   196,   197,   203,   204,   205,   206,   207,
+     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
+       0,     5,     7,     9,   198,   199,   200,   201,   218,   219,
+     220,   225,     7,   234,     7,   240,     7,   283,     7,   395,
+       7,   475,     7,   491,     7,   427,     7,   433,     7,   457,
+       7,   371,     7,   556,     7,   602,     7,   593,   226,   221,
+     235,   241,   284,   396,   476,   492,   428,   434,   458,   372,
+     557,   603,   594,   218,   227,   228,   198,   223,   224,    10,
+     171,   181,   182,   183,   198,   233,   236,   237,   238,   585,
+     587,   589,   600,    11,    14,    23,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    87,    88,
+      98,   101,   102,   106,   111,   112,   117,   127,   130,   137,
+     138,   142,   145,   149,   169,   170,   172,   233,   242,   243,
+     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     255,   256,   257,   258,   259,   260,   261,   264,   266,   268,
+     270,   272,   273,   275,   276,   277,   278,   279,   294,   296,
+     302,   304,   349,   358,   365,   379,   389,   413,   417,   425,
+     451,   481,   483,   485,   496,   498,   500,   523,   535,   536,
+     544,   554,   591,   606,    15,    16,    19,    22,   233,   281,
+     282,   285,   287,   290,   293,   481,   483,    84,    85,    86,
+      99,   103,   104,   105,   113,   116,   124,   233,   244,   245,
+     246,   247,   248,   249,   250,   251,   256,   257,   258,   259,
+     260,   261,   264,   266,   268,   270,   272,   273,   397,   398,
+     399,   401,   403,   405,   407,   409,   411,   413,   416,   451,
+     469,   481,   483,   485,   496,   498,   500,   520,   100,   233,
+     409,   411,   451,   477,   478,   479,   481,   483,   112,   118,
+     119,   120,   121,   122,   123,   125,   233,   451,   481,   483,
+     493,   494,   495,   496,   498,   500,   502,   506,   508,   510,
+     512,   514,   516,   518,   425,    34,    89,    91,    92,    95,
+      96,    97,   233,   322,   435,   436,   437,   438,   439,   440,
+     441,   443,   445,   447,   448,   450,   481,   483,    90,    93,
+      94,   233,   322,   439,   445,   459,   460,   461,   462,   463,
+     465,   466,   467,   468,   481,   483,   128,   129,   233,   373,
+     374,   375,   377,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   169,   170,   233,   481,
+     483,   558,   559,   560,   561,   563,   564,   566,   567,   568,
+     571,   573,   575,   576,   577,   579,   581,   583,   604,   605,
+     606,    12,    13,   595,   596,   597,   599,     6,     3,     4,
+       8,     3,   239,   601,   586,   588,   590,     4,     3,     8,
+     592,   280,   297,     4,     4,     4,   497,   499,   501,   295,
+     303,   305,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,   254,     4,     4,     4,     4,     4,   262,   265,   267,
+       4,   274,     4,     4,   390,   426,   452,   418,   482,   484,
+     414,   350,   524,   486,   366,   380,     4,   359,   537,   545,
+     555,   269,   271,   607,     3,     8,   286,   288,   291,     4,
+       3,     8,   402,   404,   406,   470,   400,   408,     4,   412,
+     410,   521,     3,     8,   480,     3,     8,   519,   507,   509,
+     513,   511,   517,   515,   503,     8,     3,     8,   442,   323,
+       4,   446,   444,   449,     4,     8,     3,   464,     4,     4,
+       8,     3,   376,   378,     3,     8,     4,   574,   562,     4,
+     565,     4,     4,   569,   572,     4,     4,   578,   580,   582,
+     584,     3,     8,     3,     8,   598,     4,     3,     8,   218,
+     218,   198,     4,     4,     4,     4,     4,   237,     4,     4,
+       4,   201,   201,   201,     4,     4,     4,     4,     4,     4,
+     199,   199,   199,   199,   199,   201,   200,   200,   199,     4,
+     199,   199,   201,   201,   201,     4,     4,     4,   201,     4,
+     201,   201,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,   199,     4,     4,     4,     4,     4,
+       4,     4,   243,     4,     4,     4,   201,   282,     4,     4,
+       4,     4,     4,     4,   199,     4,     4,     4,   398,     4,
+     478,     4,     4,     4,     4,     4,     4,     4,     4,   495,
+       4,     4,   199,     4,     4,     4,   201,   437,     4,   201,
+     201,   461,     4,     4,   374,   201,     4,     4,   199,     4,
+     199,   199,     4,     4,   201,   201,     4,     4,     4,     4,
+     559,   605,     4,   199,   596,     4,     7,     7,   218,   218,
+     218,     7,     7,     7,   198,   198,   198,     7,     7,     5,
+     198,   165,   166,   167,   168,   201,   263,   198,   198,   198,
+       5,     5,     5,     5,   220,   222,   198,   107,   108,   109,
+     110,   415,     5,     5,     5,     5,     7,     7,     7,     7,
+       7,   198,   198,     5,     5,   229,    17,    18,   289,    20,
+      21,   292,   198,   198,   198,     5,   198,   198,   229,   198,
+       7,   198,   229,   198,   198,   198,   198,   198,   198,   198,
+     198,   198,   198,   198,   198,   198,   198,   218,   198,   198,
+     198,    18,   163,   570,   164,   263,   198,   198,   198,     5,
+     218,   242,   604,   595,   281,    24,   298,   299,   300,    34,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,   233,   310,   311,   312,   315,   317,   319,   321,
+     322,   324,   325,   326,   327,   328,   329,   330,   331,   333,
+     335,   337,   339,   340,   341,   342,   344,   346,   348,   310,
+       7,   306,   307,   308,     7,   391,   392,   393,     7,   429,
+     430,   431,     7,   453,   454,   455,     7,   419,   420,   421,
+     118,   119,   120,   121,   123,   351,   352,   353,   354,   355,
+     356,   357,     7,   525,   526,     7,   487,   488,   489,     7,
+     367,   368,   369,   131,   132,   133,   134,   135,   136,   381,
+     382,   383,   384,   385,   386,   387,   388,   139,   140,   141,
+     233,   360,   361,   362,   363,   364,   481,   483,   143,   144,
+     233,   481,   483,   538,   539,   540,   542,   146,   147,   148,
+     198,   481,   483,   546,   547,   548,   549,   551,   552,   558,
+       7,   608,   609,   230,     7,   471,   472,   473,   126,   502,
+     504,   522,   306,     8,     8,     8,     8,   301,     3,     8,
+     313,   316,   318,   320,     4,     4,     4,     4,     4,   332,
+     334,   336,   338,     4,     4,     4,     4,     4,     4,   343,
+     345,   347,     4,     3,     8,     8,   309,     6,     3,   394,
+       6,     3,   432,     6,     3,   456,     6,     3,   422,     6,
+       3,     3,     6,   527,     3,     6,   490,     6,     3,   370,
+       6,     3,     4,     4,     4,     4,     4,     4,     3,     8,
+       4,     4,     4,     3,     8,   541,   543,     3,     8,     4,
+     550,     4,   553,     3,     8,     8,   610,     3,     6,   198,
+     231,   232,   474,     6,     3,   505,     8,     6,     4,   299,
+       4,     4,     4,     4,   199,   201,   199,   201,   199,     4,
+       4,     4,     4,   199,   199,   199,   199,   201,   199,     4,
+       4,     4,   199,   311,   310,   308,   397,   393,   435,   431,
+     459,   455,   233,   244,   245,   246,   247,   248,   249,   250,
+     251,   256,   257,   258,   259,   260,   261,   264,   266,   268,
+     270,   272,   273,   322,   389,   407,   409,   411,   413,   423,
+     424,   451,   481,   483,   496,   498,   500,   520,   421,   352,
+     114,   115,   233,   322,   425,   451,   481,   483,   496,   498,
+     500,   528,   529,   530,   531,   532,   534,   526,   493,   489,
+     373,   369,   199,   199,   199,   199,   199,   199,   382,   201,
+     199,   199,   361,     4,     4,   539,   201,     4,   199,     4,
+     547,   173,   175,   176,   233,   322,   481,   483,   611,   612,
+     613,   614,   616,   609,     6,     3,   477,   473,     4,   198,
+      35,    36,    37,    38,   314,   198,   198,   198,   198,   198,
+     198,   198,   198,   198,   198,     8,     8,     8,     8,     3,
+       8,   533,     4,     8,     3,     8,     8,   198,   198,   198,
+     218,   617,     4,   615,     3,     8,   198,     8,   229,   424,
+       4,   201,   530,     4,   199,     4,   612,   198,     5,   198,
+       7,   618,   619,   620,     3,     6,   174,   177,   178,   179,
+     180,   621,   622,   623,   625,   626,   627,   628,   619,   624,
+       4,     4,     4,   629,     3,     8,     4,   201,   199,   199,
+       4,   622,   198,   198
   };
 
   const unsigned short int
   Dhcp4Parser::yyr1_[] =
   {
-       0,   195,   197,   196,   198,   196,   199,   196,   200,   196,
-     201,   196,   202,   196,   203,   196,   204,   196,   205,   196,
-     206,   196,   207,   196,   208,   196,   209,   196,   210,   196,
-     211,   211,   211,   211,   211,   211,   211,   212,   214,   213,
-     215,   216,   216,   217,   217,   219,   218,   220,   220,   221,
-     221,   223,   222,   224,   224,   225,   225,   226,   228,   227,
-     229,   229,   230,   230,   230,   230,   230,   230,   232,   231,
-     234,   233,   235,   235,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,   247,   246,   248,   249,   250,
-     251,   252,   253,   255,   254,   256,   256,   256,   256,   256,
-     258,   257,   260,   259,   262,   261,   264,   263,   265,   266,
-     267,   269,   268,   270,   270,   271,   271,   271,   271,   271,
-     271,   271,   273,   272,   275,   274,   277,   276,   278,   278,
-     280,   279,   281,   281,   282,   284,   283,   286,   285,   287,
-     287,   288,   290,   289,   292,   291,   294,   293,   295,   295,
-     296,   296,   298,   297,   299,   299,   300,   300,   300,   300,
-     300,   300,   300,   300,   300,   300,   300,   300,   300,   300,
-     300,   300,   300,   300,   300,   300,   300,   302,   301,   303,
-     303,   303,   303,   305,   304,   307,   306,   309,   308,   310,
-     312,   311,   313,   314,   315,   316,   317,   318,   319,   321,
-     320,   323,   322,   325,   324,   327,   326,   328,   329,   330,
-     332,   331,   333,   333,   334,   334,   334,   334,   334,   335,
-     336,   337,   338,   339,   341,   340,   342,   342,   343,   343,
-     343,   343,   343,   343,   344,   345,   346,   348,   347,   349,
-     349,   350,   350,   352,   351,   354,   353,   355,   355,   355,
-     356,   356,   358,   357,   360,   359,   362,   361,   363,   363,
-     364,   364,   364,   364,   364,   364,   365,   366,   367,   368,
-     369,   370,   372,   371,   373,   373,   374,   374,   376,   375,
-     378,   377,   379,   379,   380,   380,   380,   380,   380,   380,
-     380,   380,   380,   380,   380,   380,   380,   380,   380,   380,
-     380,   380,   380,   380,   380,   380,   380,   380,   380,   380,
-     380,   380,   380,   380,   380,   380,   380,   380,   380,   380,
-     380,   380,   382,   381,   384,   383,   386,   385,   388,   387,
-     390,   389,   392,   391,   394,   393,   396,   395,   397,   397,
-     397,   397,   398,   400,   399,   401,   401,   402,   402,   404,
-     403,   405,   405,   406,   406,   406,   406,   406,   406,   406,
-     406,   406,   406,   406,   406,   406,   406,   406,   406,   406,
-     406,   406,   406,   406,   406,   406,   406,   406,   406,   406,
-     406,   406,   406,   406,   406,   406,   408,   407,   410,   409,
-     411,   411,   412,   412,   414,   413,   416,   415,   417,   417,
-     418,   418,   419,   419,   419,   419,   419,   419,   419,   419,
-     419,   419,   420,   421,   422,   424,   423,   426,   425,   428,
-     427,   429,   431,   430,   432,   434,   433,   435,   435,   436,
-     436,   438,   437,   440,   439,   441,   441,   442,   442,   443,
-     443,   443,   443,   443,   443,   443,   443,   443,   444,   446,
-     445,   447,   448,   449,   450,   452,   451,   453,   453,   454,
-     454,   456,   455,   458,   457,   459,   459,   460,   460,   460,
-     460,   460,   460,   460,   462,   461,   464,   463,   466,   465,
-     468,   467,   469,   469,   470,   470,   472,   471,   474,   473,
-     475,   475,   476,   476,   477,   477,   477,   477,   477,   477,
-     477,   477,   477,   477,   477,   477,   477,   477,   477,   479,
-     478,   481,   480,   483,   482,   485,   484,   487,   486,   489,
-     488,   491,   490,   493,   492,   495,   494,   497,   496,   499,
-     498,   501,   500,   503,   502,   504,   504,   506,   505,   507,
-     507,   509,   508,   510,   510,   511,   511,   512,   512,   512,
-     512,   512,   512,   512,   512,   512,   512,   512,   513,   515,
-     514,   516,   517,   519,   518,   520,   520,   521,   521,   521,
-     521,   521,   523,   522,   525,   524,   527,   526,   528,   528,
-     529,   529,   529,   529,   529,   529,   530,   532,   531,   533,
-     535,   534,   537,   536,   539,   538,   540,   540,   541,   541,
-     541,   541,   541,   541,   541,   541,   541,   541,   541,   541,
-     541,   541,   541,   541,   541,   541,   542,   544,   543,   545,
-     547,   546,   548,   549,   551,   550,   552,   552,   554,   553,
-     556,   555,   557,   558,   560,   559,   562,   561,   564,   563,
-     566,   565,   568,   567,   570,   569,   572,   571,   574,   573,
-     576,   575,   577,   577,   578,   578,   580,   579,   581,   583,
-     582,   585,   584,   586,   586,   587,   589,   588,   590,   590,
-     592,   591,   593,   593,   594,   594,   594,   594,   594,   594,
-     594,   595,   597,   596,   599,   598,   600,   600,   602,   601,
-     603,   603,   604,   604,   604,   604,   604,   606,   605,   607,
-     608,   609,   611,   610
+       0,   202,   204,   203,   205,   203,   206,   203,   207,   203,
+     208,   203,   209,   203,   210,   203,   211,   203,   212,   203,
+     213,   203,   214,   203,   215,   203,   216,   203,   217,   203,
+     218,   218,   218,   218,   218,   218,   218,   219,   221,   220,
+     222,   223,   223,   224,   224,   226,   225,   227,   227,   228,
+     228,   230,   229,   231,   231,   232,   232,   233,   235,   234,
+     236,   236,   237,   237,   237,   237,   237,   237,   239,   238,
+     241,   240,   242,   242,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   254,   253,
+     255,   256,   257,   258,   259,   260,   262,   261,   263,   263,
+     263,   263,   263,   265,   264,   267,   266,   269,   268,   271,
+     270,   272,   274,   273,   275,   276,   277,   278,   280,   279,
+     281,   281,   282,   282,   282,   282,   282,   282,   282,   284,
+     283,   286,   285,   288,   287,   289,   289,   291,   290,   292,
+     292,   293,   295,   294,   297,   296,   298,   298,   299,   301,
+     300,   303,   302,   305,   304,   306,   306,   307,   307,   309,
+     308,   310,   310,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   311,   313,   312,
+     314,   314,   314,   314,   316,   315,   318,   317,   320,   319,
+     321,   323,   322,   324,   325,   326,   327,   328,   329,   330,
+     332,   331,   334,   333,   336,   335,   338,   337,   339,   340,
+     341,   343,   342,   345,   344,   347,   346,   348,   350,   349,
+     351,   351,   352,   352,   352,   352,   352,   353,   354,   355,
+     356,   357,   359,   358,   360,   360,   361,   361,   361,   361,
+     361,   361,   362,   363,   364,   366,   365,   367,   367,   368,
+     368,   370,   369,   372,   371,   373,   373,   373,   374,   374,
+     376,   375,   378,   377,   380,   379,   381,   381,   382,   382,
+     382,   382,   382,   382,   383,   384,   385,   386,   387,   388,
+     390,   389,   391,   391,   392,   392,   394,   393,   396,   395,
+     397,   397,   398,   398,   398,   398,   398,   398,   398,   398,
+     398,   398,   398,   398,   398,   398,   398,   398,   398,   398,
+     398,   398,   398,   398,   398,   398,   398,   398,   398,   398,
+     398,   398,   398,   398,   398,   398,   398,   398,   398,   398,
+     398,   400,   399,   402,   401,   404,   403,   406,   405,   408,
+     407,   410,   409,   412,   411,   414,   413,   415,   415,   415,
+     415,   416,   418,   417,   419,   419,   420,   420,   422,   421,
+     423,   423,   424,   424,   424,   424,   424,   424,   424,   424,
+     424,   424,   424,   424,   424,   424,   424,   424,   424,   424,
+     424,   424,   424,   424,   424,   424,   424,   424,   424,   424,
+     424,   424,   424,   424,   424,   424,   426,   425,   428,   427,
+     429,   429,   430,   430,   432,   431,   434,   433,   435,   435,
+     436,   436,   437,   437,   437,   437,   437,   437,   437,   437,
+     437,   437,   438,   439,   440,   442,   441,   444,   443,   446,
+     445,   447,   449,   448,   450,   452,   451,   453,   453,   454,
+     454,   456,   455,   458,   457,   459,   459,   460,   460,   461,
+     461,   461,   461,   461,   461,   461,   461,   461,   462,   464,
+     463,   465,   466,   467,   468,   470,   469,   471,   471,   472,
+     472,   474,   473,   476,   475,   477,   477,   478,   478,   478,
+     478,   478,   478,   478,   480,   479,   482,   481,   484,   483,
+     486,   485,   487,   487,   488,   488,   490,   489,   492,   491,
+     493,   493,   494,   494,   495,   495,   495,   495,   495,   495,
+     495,   495,   495,   495,   495,   495,   495,   495,   495,   497,
+     496,   499,   498,   501,   500,   503,   502,   505,   504,   507,
+     506,   509,   508,   511,   510,   513,   512,   515,   514,   517,
+     516,   519,   518,   521,   520,   522,   522,   524,   523,   525,
+     525,   527,   526,   528,   528,   529,   529,   530,   530,   530,
+     530,   530,   530,   530,   530,   530,   530,   530,   531,   533,
+     532,   534,   535,   537,   536,   538,   538,   539,   539,   539,
+     539,   539,   541,   540,   543,   542,   545,   544,   546,   546,
+     547,   547,   547,   547,   547,   547,   548,   550,   549,   551,
+     553,   552,   555,   554,   557,   556,   558,   558,   559,   559,
+     559,   559,   559,   559,   559,   559,   559,   559,   559,   559,
+     559,   559,   559,   559,   559,   559,   560,   562,   561,   563,
+     565,   564,   566,   567,   569,   568,   570,   570,   572,   571,
+     574,   573,   575,   576,   578,   577,   580,   579,   582,   581,
+     584,   583,   586,   585,   588,   587,   590,   589,   592,   591,
+     594,   593,   595,   595,   596,   596,   598,   597,   599,   601,
+     600,   603,   602,   604,   604,   605,   607,   606,   608,   608,
+     610,   609,   611,   611,   612,   612,   612,   612,   612,   612,
+     612,   613,   615,   614,   617,   616,   618,   618,   620,   619,
+     621,   621,   622,   622,   622,   622,   622,   624,   623,   625,
+     626,   627,   629,   628
   };
 
   const unsigned char
@@ -5066,35 +5155,37 @@ namespace isc { namespace dhcp {
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     0,     4,     3,     3,     3,
-       3,     3,     3,     0,     4,     1,     1,     1,     1,     1,
-       0,     4,     0,     4,     0,     4,     0,     4,     3,     3,
-       3,     0,     6,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     0,     4,     0,     4,     1,     1,
-       0,     4,     1,     1,     3,     0,     6,     0,     6,     1,
-       3,     1,     0,     4,     0,     6,     0,     6,     0,     1,
-       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     0,     4,
+       3,     3,     3,     3,     3,     3,     0,     4,     1,     1,
+       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
+       4,     3,     0,     4,     3,     3,     3,     3,     0,     6,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     1,     1,     0,     4,     1,
+       1,     3,     0,     6,     0,     6,     1,     3,     1,     0,
+       4,     0,     6,     0,     6,     0,     1,     1,     3,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     1,
-       1,     1,     1,     0,     4,     0,     4,     0,     4,     3,
-       0,     4,     3,     3,     3,     3,     3,     3,     3,     0,
-       4,     0,     4,     0,     4,     0,     4,     3,     3,     3,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     6,     1,     3,     1,     1,
-       1,     1,     1,     1,     3,     3,     3,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     0,     4,     0,     4,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
+       3,     0,     4,     3,     3,     3,     3,     3,     3,     3,
+       0,     4,     0,     4,     0,     4,     0,     4,     3,     3,
+       3,     0,     4,     0,     4,     0,     4,     3,     0,     6,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     6,     1,     3,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     0,     6,     0,     1,     1,
+       3,     0,     4,     0,     4,     1,     3,     1,     1,     1,
+       0,     4,     0,     4,     0,     6,     1,     3,     1,     1,
+       1,     1,     1,     1,     3,     3,     3,     3,     3,     3,
+       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     4,     1,     1,
-       1,     1,     3,     0,     6,     0,     1,     1,     3,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     4,     1,     1,     1,
+       1,     3,     0,     6,     0,     1,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     0,     6,     0,     4,
@@ -5154,18 +5245,20 @@ namespace isc { namespace dhcp {
   "\"connect-timeout\"", "\"contact-points\"", "\"keyspace\"",
   "\"consistency\"", "\"serial-consistency\"", "\"max-reconnect-tries\"",
   "\"reconnect-wait-time\"", "\"request-timeout\"", "\"tcp-keepalive\"",
-  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"valid-lifetime\"",
-  "\"min-valid-lifetime\"", "\"max-valid-lifetime\"", "\"renew-timer\"",
-  "\"rebind-timer\"", "\"calculate-tee-times\"", "\"t1-percent\"",
-  "\"t2-percent\"", "\"decline-probation-period\"", "\"server-tag\"",
-  "\"statistic-default-sample-count\"", "\"statistic-default-sample-age\"",
-  "\"ddns-send-updates\"", "\"ddns-override-no-update\"",
-  "\"ddns-override-client-update\"", "\"ddns-replace-client-name\"",
-  "\"ddns-generated-prefix\"", "\"ddns-qualifying-suffix\"",
-  "\"store-extended-info\"", "\"subnet4\"", "\"4o6-interface\"",
-  "\"4o6-interface-id\"", "\"4o6-subnet\"", "\"option-def\"",
-  "\"option-data\"", "\"name\"", "\"data\"", "\"code\"", "\"space\"",
-  "\"csv-format\"", "\"always-send\"", "\"record-types\"",
+  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"durability\"",
+  "\"lfc-format\"", "\"lfc-mode\"", "\"lfc-write-rate\"",
+  "\"valid-lifetime\"", "\"min-valid-lifetime\"", "\"max-valid-lifetime\"",
+  "\"renew-timer\"", "\"rebind-timer\"", "\"calculate-tee-times\"",
+  "\"t1-percent\"", "\"t2-percent\"", "\"decline-probation-period\"",
+  "\"server-tag\"", "\"statistic-default-sample-count\"",
+  "\"statistic-default-sample-age\"", "\"ddns-send-updates\"",
+  "\"ddns-override-no-update\"", "\"ddns-override-client-update\"",
+  "\"ddns-replace-client-name\"", "\"ddns-generated-prefix\"",
+  "\"ddns-qualifying-suffix\"", "\"store-extended-info\"", "\"allocator\"",
+  "\"free-lease-index\"", "\"option-arena\"", "\"subnet4\"",
+  "\"4o6-interface\"", "\"4o6-interface-id\"", "\"4o6-subnet\"",
+  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
+  "\"space\"", "\"csv-format\"", "\"always-send\"", "\"record-types\"",
   "\"encapsulate\"", "\"array\"", "\"shared-networks\"", "\"pools\"",
   "\"pool\"", "\"user-context\"", "\"comment\"", "\"subnet\"",
   "\"interface\"", "\"id\"", "\"reservation-mode\"", "\"disabled\"",
@@ -5213,173 +5306,178 @@ namespace isc { namespace dhcp {
   "ddns_replace_client_name", "$@22", "ddns_replace_client_name_value",
   "ddns_generated_prefix", "$@23", "ddns_qualifying_suffix", "$@24",
   "hostname_char_set", "$@25", "hostname_char_replacement", "$@26",
-  "store_extended_info", "statistic_default_sample_count",
-  "statistic_default_sample_age", "interfaces_config", "$@27",
+  "store_extended_info", "allocator", "$@27", "free_lease_index",
+  "option_arena", "statistic_default_sample_count",
+  "statistic_default_sample_age", "interfaces_config", "$@28",
   "interfaces_config_params", "interfaces_config_param", "sub_interfaces4",
-  "$@28", "interfaces_list", "$@29", "dhcp_socket_type", "$@30",
-  "socket_type", "outbound_interface", "$@31", "outbound_interface_value",
-  "re_detect", "lease_database", "$@32", "sanity_checks", "$@33",
-  "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@34",
-  "hosts_database", "$@35", "hosts_databases", "$@36", "database_list",
-  "not_empty_database_list", "database", "$@37", "database_map_params",
-  "database_map_param", "database_type", "$@38", "db_type", "user", "$@39",
-  "password", "$@40", "host", "$@41", "port", "name", "$@42", "persist",
+  "$@29", "interfaces_list", "$@30", "dhcp_socket_type", "$@31",
+  "socket_type", "outbound_interface", "$@32", "outbound_interface_value",
+  "re_detect", "lease_database", "$@33", "sanity_checks", "$@34",
+  "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@35",
+  "hosts_database", "$@36", "hosts_databases", "$@37", "database_list",
+  "not_empty_database_list", "database", "$@38", "database_map_params",
+  "database_map_param", "database_type", "$@39", "db_type", "user", "$@40",
+  "password", "$@41", "host", "$@42", "port", "name", "$@43", "persist",
   "lfc_interval", "readonly", "connect_timeout", "request_timeout",
-  "tcp_keepalive", "tcp_nodelay", "contact_points", "$@43", "keyspace",
-  "$@44", "consistency", "$@45", "serial_consistency", "$@46",
+  "tcp_keepalive", "tcp_nodelay", "contact_points", "$@44", "keyspace",
+  "$@45", "consistency", "$@46", "serial_consistency", "$@47",
   "max_reconnect_tries", "reconnect_wait_time", "max_row_errors",
-  "host_reservation_identifiers", "$@47",
+  "durability", "$@48", "lfc_format", "$@49", "lfc_mode", "$@50",
+  "lfc_write_rate", "host_reservation_identifiers", "$@51",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "duid_id", "hw_address_id", "circuit_id", "client_id", "flex_id",
-  "dhcp_multi_threading", "$@48", "multi_threading_params",
+  "dhcp_multi_threading", "$@52", "multi_threading_params",
   "multi_threading_param", "enable_multi_threading", "thread_pool_size",
-  "packet_queue_size", "hooks_libraries", "$@49", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@50",
-  "sub_hooks_library", "$@51", "hooks_params", "hooks_param", "library",
-  "$@52", "parameters", "$@53", "expired_leases_processing", "$@54",
+  "packet_queue_size", "hooks_libraries", "$@53", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@54",
+  "sub_hooks_library", "$@55", "hooks_params", "hooks_param", "library",
+  "$@56", "parameters", "$@57", "expired_leases_processing", "$@58",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet4_list", "$@55",
-  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@56",
-  "sub_subnet4", "$@57", "subnet4_params", "subnet4_param", "subnet",
-  "$@58", "subnet_4o6_interface", "$@59", "subnet_4o6_interface_id",
-  "$@60", "subnet_4o6_subnet", "$@61", "interface", "$@62", "client_class",
-  "$@63", "require_client_classes", "$@64", "reservation_mode", "$@65",
-  "hr_mode", "id", "shared_networks", "$@66", "shared_networks_content",
-  "shared_networks_list", "shared_network", "$@67",
+  "unwarned_reclaim_cycles", "subnet4_list", "$@59",
+  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@60",
+  "sub_subnet4", "$@61", "subnet4_params", "subnet4_param", "subnet",
+  "$@62", "subnet_4o6_interface", "$@63", "subnet_4o6_interface_id",
+  "$@64", "subnet_4o6_subnet", "$@65", "interface", "$@66", "client_class",
+  "$@67", "require_client_classes", "$@68", "reservation_mode", "$@69",
+  "hr_mode", "id", "shared_networks", "$@70", "shared_networks_content",
+  "shared_networks_list", "shared_network", "$@71",
   "shared_network_params", "shared_network_param", "option_def_list",
-  "$@68", "sub_option_def_list", "$@69", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@70",
-  "sub_option_def", "$@71", "option_def_params",
+  "$@72", "sub_option_def_list", "$@73", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@74",
+  "sub_option_def", "$@75", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@72",
-  "option_def_record_types", "$@73", "space", "$@74", "option_def_space",
-  "option_def_encapsulate", "$@75", "option_def_array", "option_data_list",
-  "$@76", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@77", "sub_option_data", "$@78",
+  "code", "option_def_code", "option_def_type", "$@76",
+  "option_def_record_types", "$@77", "space", "$@78", "option_def_space",
+  "option_def_encapsulate", "$@79", "option_def_array", "option_data_list",
+  "$@80", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@81", "sub_option_data", "$@82",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@79",
+  "option_data_param", "option_data_name", "option_data_data", "$@83",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@80", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@81", "sub_pool4", "$@82",
-  "pool_params", "pool_param", "pool_entry", "$@83", "user_context",
-  "$@84", "comment", "$@85", "reservations", "$@86", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@87", "sub_reservation",
-  "$@88", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "next_server", "$@89", "server_hostname", "$@90",
-  "boot_file_name", "$@91", "ip_address", "$@92", "ip_addresses", "$@93",
-  "duid", "$@94", "hw_address", "$@95", "client_id_value", "$@96",
-  "circuit_id_value", "$@97", "flex_id_value", "$@98", "hostname", "$@99",
-  "reservation_client_classes", "$@100", "relay", "$@101", "relay_map",
-  "client_classes", "$@102", "client_classes_list", "client_class_entry",
-  "$@103", "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@104",
-  "only_if_required", "dhcp4o6_port", "control_socket", "$@105",
-  "control_socket_params", "control_socket_param", "control_socket_type",
-  "$@106", "control_socket_name", "$@107", "dhcp_queue_control", "$@108",
+  "option_data_always_send", "pools_list", "$@84", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@85", "sub_pool4", "$@86",
+  "pool_params", "pool_param", "pool_entry", "$@87", "user_context",
+  "$@88", "comment", "$@89", "reservations", "$@90", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@91", "sub_reservation",
+  "$@92", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "next_server", "$@93", "server_hostname", "$@94",
+  "boot_file_name", "$@95", "ip_address", "$@96", "ip_addresses", "$@97",
+  "duid", "$@98", "hw_address", "$@99", "client_id_value", "$@100",
+  "circuit_id_value", "$@101", "flex_id_value", "$@102", "hostname",
+  "$@103", "reservation_client_classes", "$@104", "relay", "$@105",
+  "relay_map", "client_classes", "$@106", "client_classes_list",
+  "client_class_entry", "$@107", "client_class_params",
+  "not_empty_client_class_params", "client_class_param",
+  "client_class_name", "client_class_test", "$@108", "only_if_required",
+  "dhcp4o6_port", "control_socket", "$@109", "control_socket_params",
+  "control_socket_param", "control_socket_type", "$@110",
+  "control_socket_name", "$@111", "dhcp_queue_control", "$@112",
   "queue_control_params", "queue_control_param", "enable_queue",
-  "queue_type", "$@109", "capacity", "arbitrary_map_entry", "$@110",
-  "dhcp_ddns", "$@111", "sub_dhcp_ddns", "$@112", "dhcp_ddns_params",
-  "dhcp_ddns_param", "enable_updates", "server_ip", "$@113", "server_port",
-  "sender_ip", "$@114", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@115", "ncr_protocol_value", "ncr_format", "$@116",
-  "dep_qualifying_suffix", "$@117", "dep_override_no_update",
-  "dep_override_client_update", "dep_replace_client_name", "$@118",
-  "dep_generated_prefix", "$@119", "dep_hostname_char_set", "$@120",
-  "dep_hostname_char_replacement", "$@121", "dhcp6_json_object", "$@122",
-  "dhcpddns_json_object", "$@123", "control_agent_json_object", "$@124",
-  "config_control", "$@125", "sub_config_control", "$@126",
+  "queue_type", "$@113", "capacity", "arbitrary_map_entry", "$@114",
+  "dhcp_ddns", "$@115", "sub_dhcp_ddns", "$@116", "dhcp_ddns_params",
+  "dhcp_ddns_param", "enable_updates", "server_ip", "$@117", "server_port",
+  "sender_ip", "$@118", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@119", "ncr_protocol_value", "ncr_format", "$@120",
+  "dep_qualifying_suffix", "$@121", "dep_override_no_update",
+  "dep_override_client_update", "dep_replace_client_name", "$@122",
+  "dep_generated_prefix", "$@123", "dep_hostname_char_set", "$@124",
+  "dep_hostname_char_replacement", "$@125", "dhcp6_json_object", "$@126",
+  "dhcpddns_json_object", "$@127", "control_agent_json_object", "$@128",
+  "config_control", "$@129", "sub_config_control", "$@130",
   "config_control_params", "config_control_param", "config_databases",
-  "$@127", "config_fetch_wait_time", "logging_object", "$@128",
-  "sub_logging", "$@129", "logging_params", "logging_param", "loggers",
-  "$@130", "loggers_entries", "logger_entry", "$@131", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@132", "output_options_list",
-  "$@133", "output_options_list_content", "output_entry", "$@134",
-  "output_params_list", "output_params", "output", "$@135", "flush",
-  "maxsize", "maxver", "pattern", "$@136", YY_NULLPTR
+  "$@131", "config_fetch_wait_time", "logging_object", "$@132",
+  "sub_logging", "$@133", "logging_params", "logging_param", "loggers",
+  "$@134", "loggers_entries", "logger_entry", "$@135", "logger_params",
+  "logger_param", "debuglevel", "severity", "$@136", "output_options_list",
+  "$@137", "output_options_list_content", "output_entry", "$@138",
+  "output_params_list", "output_params", "output", "$@139", "flush",
+  "maxsize", "maxver", "pattern", "$@140", YY_NULLPTR
   };
 
 #if PARSER4_DEBUG
   const unsigned short int
   Dhcp4Parser::yyrline_[] =
   {
-       0,   283,   283,   283,   284,   284,   285,   285,   286,   286,
-     287,   287,   288,   288,   289,   289,   290,   290,   291,   291,
-     292,   292,   293,   293,   294,   294,   295,   295,   296,   296,
-     304,   305,   306,   307,   308,   309,   310,   313,   318,   318,
-     329,   332,   333,   336,   340,   347,   347,   354,   355,   358,
-     362,   369,   369,   376,   377,   380,   384,   395,   405,   405,
-     421,   422,   426,   427,   428,   429,   430,   431,   434,   434,
-     449,   449,   458,   459,   464,   465,   466,   467,   468,   469,
-     470,   471,   472,   473,   474,   475,   476,   477,   478,   479,
-     480,   481,   482,   483,   484,   485,   486,   487,   488,   489,
-     490,   491,   492,   493,   494,   495,   496,   497,   498,   499,
-     500,   501,   502,   503,   504,   505,   506,   507,   508,   509,
-     510,   511,   512,   513,   514,   515,   518,   523,   528,   533,
-     538,   543,   548,   553,   558,   563,   563,   571,   576,   581,
-     586,   591,   596,   601,   601,   609,   612,   615,   618,   621,
-     627,   627,   635,   635,   643,   643,   651,   651,   659,   664,
-     669,   674,   674,   685,   686,   689,   690,   691,   692,   693,
-     694,   695,   698,   698,   707,   707,   717,   717,   724,   725,
-     728,   728,   735,   737,   741,   747,   747,   759,   759,   769,
-     770,   772,   774,   774,   792,   792,   804,   804,   814,   815,
-     818,   819,   822,   822,   832,   833,   836,   837,   838,   839,
-     840,   841,   842,   843,   844,   845,   846,   847,   848,   849,
-     850,   851,   852,   853,   854,   855,   856,   859,   859,   866,
-     867,   868,   869,   872,   872,   880,   880,   888,   888,   896,
-     901,   901,   909,   914,   919,   924,   929,   934,   939,   944,
-     944,   952,   952,   960,   960,   968,   968,   976,   981,   986,
-     992,   992,  1002,  1003,  1006,  1007,  1008,  1009,  1010,  1013,
-    1018,  1023,  1028,  1033,  1040,  1040,  1052,  1053,  1056,  1057,
-    1058,  1059,  1060,  1061,  1064,  1069,  1074,  1079,  1079,  1089,
-    1090,  1093,  1094,  1097,  1097,  1107,  1107,  1117,  1118,  1119,
-    1122,  1123,  1126,  1126,  1134,  1134,  1142,  1142,  1153,  1154,
-    1157,  1158,  1159,  1160,  1161,  1162,  1165,  1170,  1175,  1180,
-    1185,  1190,  1198,  1198,  1211,  1212,  1215,  1216,  1223,  1223,
-    1249,  1249,  1260,  1261,  1265,  1266,  1267,  1268,  1269,  1270,
-    1271,  1272,  1273,  1274,  1275,  1276,  1277,  1278,  1279,  1280,
-    1281,  1282,  1283,  1284,  1285,  1286,  1287,  1288,  1289,  1290,
-    1291,  1292,  1293,  1294,  1295,  1296,  1297,  1298,  1299,  1300,
-    1301,  1302,  1305,  1305,  1313,  1313,  1321,  1321,  1329,  1329,
-    1337,  1337,  1345,  1345,  1353,  1353,  1363,  1363,  1370,  1371,
-    1372,  1373,  1376,  1383,  1383,  1394,  1395,  1399,  1400,  1403,
-    1403,  1411,  1412,  1415,  1416,  1417,  1418,  1419,  1420,  1421,
-    1422,  1423,  1424,  1425,  1426,  1427,  1428,  1429,  1430,  1431,
-    1432,  1433,  1434,  1435,  1436,  1437,  1438,  1439,  1440,  1441,
-    1442,  1443,  1444,  1445,  1446,  1447,  1454,  1454,  1467,  1467,
-    1476,  1477,  1480,  1481,  1486,  1486,  1501,  1501,  1515,  1516,
-    1519,  1520,  1523,  1524,  1525,  1526,  1527,  1528,  1529,  1530,
-    1531,  1532,  1535,  1537,  1542,  1544,  1544,  1552,  1552,  1560,
-    1560,  1568,  1570,  1570,  1578,  1587,  1587,  1599,  1600,  1605,
-    1606,  1611,  1611,  1623,  1623,  1635,  1636,  1641,  1642,  1647,
-    1648,  1649,  1650,  1651,  1652,  1653,  1654,  1655,  1658,  1660,
-    1660,  1668,  1670,  1672,  1677,  1685,  1685,  1697,  1698,  1701,
-    1702,  1705,  1705,  1715,  1715,  1725,  1726,  1729,  1730,  1731,
-    1732,  1733,  1734,  1735,  1738,  1738,  1746,  1746,  1771,  1771,
-    1801,  1801,  1811,  1812,  1815,  1816,  1819,  1819,  1828,  1828,
-    1837,  1838,  1841,  1842,  1846,  1847,  1848,  1849,  1850,  1851,
-    1852,  1853,  1854,  1855,  1856,  1857,  1858,  1859,  1860,  1863,
-    1863,  1871,  1871,  1879,  1879,  1887,  1887,  1895,  1895,  1905,
-    1905,  1913,  1913,  1921,  1921,  1929,  1929,  1937,  1937,  1945,
-    1945,  1953,  1953,  1966,  1966,  1976,  1977,  1983,  1983,  1993,
-    1994,  1997,  1997,  2007,  2008,  2011,  2012,  2015,  2016,  2017,
-    2018,  2019,  2020,  2021,  2022,  2023,  2024,  2025,  2028,  2030,
-    2030,  2038,  2045,  2052,  2052,  2062,  2063,  2066,  2067,  2068,
-    2069,  2070,  2073,  2073,  2081,  2081,  2092,  2092,  2104,  2105,
-    2108,  2109,  2110,  2111,  2112,  2113,  2116,  2121,  2121,  2129,
-    2134,  2134,  2143,  2143,  2155,  2155,  2165,  2166,  2169,  2170,
-    2171,  2172,  2173,  2174,  2175,  2176,  2177,  2178,  2179,  2180,
-    2181,  2182,  2183,  2184,  2185,  2186,  2189,  2194,  2194,  2202,
-    2207,  2207,  2215,  2220,  2225,  2225,  2233,  2234,  2237,  2237,
-    2246,  2246,  2255,  2261,  2267,  2267,  2275,  2275,  2284,  2284,
-    2293,  2293,  2304,  2304,  2311,  2311,  2318,  2318,  2327,  2327,
-    2338,  2338,  2348,  2349,  2353,  2354,  2357,  2357,  2367,  2377,
-    2377,  2387,  2387,  2398,  2399,  2403,  2407,  2407,  2419,  2420,
-    2424,  2424,  2432,  2433,  2436,  2437,  2438,  2439,  2440,  2441,
-    2442,  2445,  2450,  2450,  2458,  2458,  2468,  2469,  2472,  2472,
-    2480,  2481,  2484,  2485,  2486,  2487,  2488,  2491,  2491,  2499,
-    2504,  2509,  2514,  2514
+       0,   290,   290,   290,   291,   291,   292,   292,   293,   293,
+     294,   294,   295,   295,   296,   296,   297,   297,   298,   298,
+     299,   299,   300,   300,   301,   301,   302,   302,   303,   303,
+     311,   312,   313,   314,   315,   316,   317,   320,   325,   325,
+     336,   339,   340,   343,   347,   354,   354,   361,   362,   365,
+     369,   376,   376,   383,   384,   387,   391,   402,   412,   412,
+     428,   429,   433,   434,   435,   436,   437,   438,   441,   441,
+     456,   456,   465,   466,   471,   472,   473,   474,   475,   476,
+     477,   478,   479,   480,   481,   482,   483,   484,   485,   486,
+     487,   488,   489,   490,   491,   492,   493,   494,   495,   496,
+     497,   498,   499,   500,   501,   502,   503,   504,   505,   506,
+     507,   508,   509,   510,   511,   512,   513,   514,   515,   516,
+     517,   518,   519,   520,   521,   522,   523,   524,   525,   528,
+     533,   538,   543,   548,   553,   558,   563,   568,   573,   573,
+     581,   586,   591,   596,   601,   606,   611,   611,   619,   622,
+     625,   628,   631,   637,   637,   645,   645,   653,   653,   661,
+     661,   669,   674,   674,   682,   687,   692,   697,   702,   702,
+     713,   714,   717,   718,   719,   720,   721,   722,   723,   726,
+     726,   735,   735,   745,   745,   752,   753,   756,   756,   763,
+     765,   769,   775,   775,   787,   787,   797,   798,   800,   802,
+     802,   820,   820,   832,   832,   842,   843,   846,   847,   850,
+     850,   860,   861,   864,   865,   866,   867,   868,   869,   870,
+     871,   872,   873,   874,   875,   876,   877,   878,   879,   880,
+     881,   882,   883,   884,   885,   886,   887,   888,   891,   891,
+     898,   899,   900,   901,   904,   904,   912,   912,   920,   920,
+     928,   933,   933,   941,   946,   951,   956,   961,   966,   971,
+     976,   976,   984,   984,   992,   992,  1000,  1000,  1008,  1013,
+    1018,  1023,  1023,  1031,  1031,  1039,  1039,  1047,  1053,  1053,
+    1063,  1064,  1067,  1068,  1069,  1070,  1071,  1074,  1079,  1084,
+    1089,  1094,  1101,  1101,  1113,  1114,  1117,  1118,  1119,  1120,
+    1121,  1122,  1125,  1130,  1135,  1140,  1140,  1150,  1151,  1154,
+    1155,  1158,  1158,  1168,  1168,  1178,  1179,  1180,  1183,  1184,
+    1187,  1187,  1195,  1195,  1203,  1203,  1214,  1215,  1218,  1219,
+    1220,  1221,  1222,  1223,  1226,  1231,  1236,  1241,  1246,  1251,
+    1259,  1259,  1272,  1273,  1276,  1277,  1284,  1284,  1310,  1310,
+    1321,  1322,  1326,  1327,  1328,  1329,  1330,  1331,  1332,  1333,
+    1334,  1335,  1336,  1337,  1338,  1339,  1340,  1341,  1342,  1343,
+    1344,  1345,  1346,  1347,  1348,  1349,  1350,  1351,  1352,  1353,
+    1354,  1355,  1356,  1357,  1358,  1359,  1360,  1361,  1362,  1363,
+    1364,  1367,  1367,  1375,  1375,  1383,  1383,  1391,  1391,  1399,
+    1399,  1407,  1407,  1415,  1415,  1425,  1425,  1432,  1433,  1434,
+    1435,  1438,  1445,  1445,  1456,  1457,  1461,  1462,  1465,  1465,
+    1473,  1474,  1477,  1478,  1479,  1480,  1481,  1482,  1483,  1484,
+    1485,  1486,  1487,  1488,  1489,  1490,  1491,  1492,  1493,  1494,
+    1495,  1496,  1497,  1498,  1499,  1500,  1501,  1502,  1503,  1504,
+    1505,  1506,  1507,  1508,  1509,  1510,  1517,  1517,  1530,  1530,
+    1539,  1540,  1543,  1544,  1549,  1549,  1564,  1564,  1578,  1579,
+    1582,  1583,  1586,  1587,  1588,  1589,  1590,  1591,  1592,  1593,
+    1594,  1595,  1598,  1600,  1605,  1607,  1607,  1615,  1615,  1623,
+    1623,  1631,  1633,  1633,  1641,  1650,  1650,  1662,  1663,  1668,
+    1669,  1674,  1674,  1686,  1686,  1698,  1699,  1704,  1705,  1710,
+    1711,  1712,  1713,  1714,  1715,  1716,  1717,  1718,  1721,  1723,
+    1723,  1731,  1733,  1735,  1740,  1748,  1748,  1760,  1761,  1764,
+    1765,  1768,  1768,  1778,  1778,  1788,  1789,  1792,  1793,  1794,
+    1795,  1796,  1797,  1798,  1801,  1801,  1809,  1809,  1834,  1834,
+    1864,  1864,  1874,  1875,  1878,  1879,  1882,  1882,  1891,  1891,
+    1900,  1901,  1904,  1905,  1909,  1910,  1911,  1912,  1913,  1914,
+    1915,  1916,  1917,  1918,  1919,  1920,  1921,  1922,  1923,  1926,
+    1926,  1934,  1934,  1942,  1942,  1950,  1950,  1958,  1958,  1968,
+    1968,  1976,  1976,  1984,  1984,  1992,  1992,  2000,  2000,  2008,
+    2008,  2016,  2016,  2029,  2029,  2039,  2040,  2046,  2046,  2056,
+    2057,  2060,  2060,  2070,  2071,  2074,  2075,  2078,  2079,  2080,
+    2081,  2082,  2083,  2084,  2085,  2086,  2087,  2088,  2091,  2093,
+    2093,  2101,  2108,  2115,  2115,  2125,  2126,  2129,  2130,  2131,
+    2132,  2133,  2136,  2136,  2144,  2144,  2155,  2155,  2167,  2168,
+    2171,  2172,  2173,  2174,  2175,  2176,  2179,  2184,  2184,  2192,
+    2197,  2197,  2206,  2206,  2218,  2218,  2228,  2229,  2232,  2233,
+    2234,  2235,  2236,  2237,  2238,  2239,  2240,  2241,  2242,  2243,
+    2244,  2245,  2246,  2247,  2248,  2249,  2252,  2257,  2257,  2265,
+    2270,  2270,  2278,  2283,  2288,  2288,  2296,  2297,  2300,  2300,
+    2309,  2309,  2318,  2324,  2330,  2330,  2338,  2338,  2347,  2347,
+    2356,  2356,  2367,  2367,  2374,  2374,  2381,  2381,  2390,  2390,
+    2401,  2401,  2411,  2412,  2416,  2417,  2420,  2420,  2430,  2440,
+    2440,  2450,  2450,  2461,  2462,  2466,  2470,  2470,  2482,  2483,
+    2487,  2487,  2495,  2496,  2499,  2500,  2501,  2502,  2503,  2504,
+    2505,  2508,  2513,  2513,  2521,  2521,  2531,  2532,  2535,  2535,
+    2543,  2544,  2547,  2548,  2549,  2550,  2551,  2554,  2554,  2562,
+    2567,  2572,  2577,  2577
   };
 
   // Print the state stack on the debug stream.
@@ -5414,7 +5512,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy" // lalr1.cc:1167
 } } // isc::dhcp
-#line 5418 "dhcp4_parser.cc" // lalr1.cc:1167
+#line 5516 "dhcp4_parser.cc" // lalr1.cc:1167
 #line 2522 "dhcp4_parser.yy" // lalr1.cc:1168
 
 
@@ -402,144 +402,151 @@ namespace isc { namespace dhcp {
         TOKEN_TCP_KEEPALIVE = 309,
         TOKEN_TCP_NODELAY = 310,
         TOKEN_MAX_ROW_ERRORS = 311,
-        TOKEN_VALID_LIFETIME = 312,
-        TOKEN_MIN_VALID_LIFETIME = 313,
-        TOKEN_MAX_VALID_LIFETIME = 314,
-        TOKEN_RENEW_TIMER = 315,
-        TOKEN_REBIND_TIMER = 316,
-        TOKEN_CALCULATE_TEE_TIMES = 317,
-        TOKEN_T1_PERCENT = 318,
-        TOKEN_T2_PERCENT = 319,
-        TOKEN_DECLINE_PROBATION_PERIOD = 320,
-        TOKEN_SERVER_TAG = 321,
-        TOKEN_STATISTIC_DEFAULT_SAMPLE_COUNT = 322,
-        TOKEN_STATISTIC_DEFAULT_SAMPLE_AGE = 323,
-        TOKEN_DDNS_SEND_UPDATES = 324,
-        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 325,
-        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 326,
-        TOKEN_DDNS_REPLACE_CLIENT_NAME = 327,
-        TOKEN_DDNS_GENERATED_PREFIX = 328,
-        TOKEN_DDNS_QUALIFYING_SUFFIX = 329,
-        TOKEN_STORE_EXTENDED_INFO = 330,
-        TOKEN_SUBNET4 = 331,
-        TOKEN_SUBNET_4O6_INTERFACE = 332,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 333,
-        TOKEN_SUBNET_4O6_SUBNET = 334,
-        TOKEN_OPTION_DEF = 335,
-        TOKEN_OPTION_DATA = 336,
-        TOKEN_NAME = 337,
-        TOKEN_DATA = 338,
-        TOKEN_CODE = 339,
-        TOKEN_SPACE = 340,
-        TOKEN_CSV_FORMAT = 341,
-        TOKEN_ALWAYS_SEND = 342,
-        TOKEN_RECORD_TYPES = 343,
-        TOKEN_ENCAPSULATE = 344,
-        TOKEN_ARRAY = 345,
-        TOKEN_SHARED_NETWORKS = 346,
-        TOKEN_POOLS = 347,
-        TOKEN_POOL = 348,
-        TOKEN_USER_CONTEXT = 349,
-        TOKEN_COMMENT = 350,
-        TOKEN_SUBNET = 351,
-        TOKEN_INTERFACE = 352,
-        TOKEN_ID = 353,
-        TOKEN_RESERVATION_MODE = 354,
-        TOKEN_DISABLED = 355,
-        TOKEN_OUT_OF_POOL = 356,
-        TOKEN_GLOBAL = 357,
-        TOKEN_ALL = 358,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 359,
-        TOKEN_CLIENT_CLASSES = 360,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 361,
-        TOKEN_TEST = 362,
-        TOKEN_ONLY_IF_REQUIRED = 363,
-        TOKEN_CLIENT_CLASS = 364,
-        TOKEN_RESERVATIONS = 365,
-        TOKEN_DUID = 366,
-        TOKEN_HW_ADDRESS = 367,
-        TOKEN_CIRCUIT_ID = 368,
-        TOKEN_CLIENT_ID = 369,
-        TOKEN_HOSTNAME = 370,
-        TOKEN_FLEX_ID = 371,
-        TOKEN_RELAY = 372,
-        TOKEN_IP_ADDRESS = 373,
-        TOKEN_IP_ADDRESSES = 374,
-        TOKEN_HOOKS_LIBRARIES = 375,
-        TOKEN_LIBRARY = 376,
-        TOKEN_PARAMETERS = 377,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 378,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 379,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 380,
-        TOKEN_HOLD_RECLAIMED_TIME = 381,
-        TOKEN_MAX_RECLAIM_LEASES = 382,
-        TOKEN_MAX_RECLAIM_TIME = 383,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 384,
-        TOKEN_DHCP4O6_PORT = 385,
-        TOKEN_DHCP_MULTI_THREADING = 386,
-        TOKEN_ENABLE_MULTI_THREADING = 387,
-        TOKEN_THREAD_POOL_SIZE = 388,
-        TOKEN_PACKET_QUEUE_SIZE = 389,
-        TOKEN_CONTROL_SOCKET = 390,
-        TOKEN_SOCKET_TYPE = 391,
-        TOKEN_SOCKET_NAME = 392,
-        TOKEN_DHCP_QUEUE_CONTROL = 393,
-        TOKEN_ENABLE_QUEUE = 394,
-        TOKEN_QUEUE_TYPE = 395,
-        TOKEN_CAPACITY = 396,
-        TOKEN_DHCP_DDNS = 397,
-        TOKEN_ENABLE_UPDATES = 398,
-        TOKEN_QUALIFYING_SUFFIX = 399,
-        TOKEN_SERVER_IP = 400,
-        TOKEN_SERVER_PORT = 401,
-        TOKEN_SENDER_IP = 402,
-        TOKEN_SENDER_PORT = 403,
-        TOKEN_MAX_QUEUE_SIZE = 404,
-        TOKEN_NCR_PROTOCOL = 405,
-        TOKEN_NCR_FORMAT = 406,
-        TOKEN_OVERRIDE_NO_UPDATE = 407,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 408,
-        TOKEN_REPLACE_CLIENT_NAME = 409,
-        TOKEN_GENERATED_PREFIX = 410,
-        TOKEN_TCP = 411,
-        TOKEN_JSON = 412,
-        TOKEN_WHEN_PRESENT = 413,
-        TOKEN_NEVER = 414,
-        TOKEN_ALWAYS = 415,
-        TOKEN_WHEN_NOT_PRESENT = 416,
-        TOKEN_HOSTNAME_CHAR_SET = 417,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 418,
-        TOKEN_LOGGING = 419,
-        TOKEN_LOGGERS = 420,
-        TOKEN_OUTPUT_OPTIONS = 421,
-        TOKEN_OUTPUT = 422,
-        TOKEN_DEBUGLEVEL = 423,
-        TOKEN_SEVERITY = 424,
-        TOKEN_FLUSH = 425,
-        TOKEN_MAXSIZE = 426,
-        TOKEN_MAXVER = 427,
-        TOKEN_PATTERN = 428,
-        TOKEN_DHCP6 = 429,
-        TOKEN_DHCPDDNS = 430,
-        TOKEN_CONTROL_AGENT = 431,
-        TOKEN_TOPLEVEL_JSON = 432,
-        TOKEN_TOPLEVEL_DHCP4 = 433,
-        TOKEN_SUB_DHCP4 = 434,
-        TOKEN_SUB_INTERFACES4 = 435,
-        TOKEN_SUB_SUBNET4 = 436,
-        TOKEN_SUB_POOL4 = 437,
-        TOKEN_SUB_RESERVATION = 438,
-        TOKEN_SUB_OPTION_DEFS = 439,
-        TOKEN_SUB_OPTION_DEF = 440,
-        TOKEN_SUB_OPTION_DATA = 441,
-        TOKEN_SUB_HOOKS_LIBRARY = 442,
-        TOKEN_SUB_DHCP_DDNS = 443,
-        TOKEN_SUB_LOGGING = 444,
-        TOKEN_SUB_CONFIG_CONTROL = 445,
-        TOKEN_STRING = 446,
-        TOKEN_INTEGER = 447,
-        TOKEN_FLOAT = 448,
-        TOKEN_BOOLEAN = 449
+        TOKEN_DURABILITY = 312,
+        TOKEN_LFC_FORMAT = 313,
+        TOKEN_LFC_MODE = 314,
+        TOKEN_LFC_WRITE_RATE = 315,
+        TOKEN_VALID_LIFETIME = 316,
+        TOKEN_MIN_VALID_LIFETIME = 317,
+        TOKEN_MAX_VALID_LIFETIME = 318,
+        TOKEN_RENEW_TIMER = 319,
+        TOKEN_REBIND_TIMER = 320,
+        TOKEN_CALCULATE_TEE_TIMES = 321,
+        TOKEN_T1_PERCENT = 322,
+        TOKEN_T2_PERCENT = 323,
+        TOKEN_DECLINE_PROBATION_PERIOD = 324,
+        TOKEN_SERVER_TAG = 325,
+        TOKEN_STATISTIC_DEFAULT_SAMPLE_COUNT = 326,
+        TOKEN_STATISTIC_DEFAULT_SAMPLE_AGE = 327,
+        TOKEN_DDNS_SEND_UPDATES = 328,
+        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 329,
+        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 330,
+        TOKEN_DDNS_REPLACE_CLIENT_NAME = 331,
+        TOKEN_DDNS_GENERATED_PREFIX = 332,
+        TOKEN_DDNS_QUALIFYING_SUFFIX = 333,
+        TOKEN_STORE_EXTENDED_INFO = 334,
+        TOKEN_ALLOCATOR = 335,
+        TOKEN_FREE_LEASE_INDEX = 336,
+        TOKEN_OPTION_ARENA = 337,
+        TOKEN_SUBNET4 = 338,
+        TOKEN_SUBNET_4O6_INTERFACE = 339,
+        TOKEN_SUBNET_4O6_INTERFACE_ID = 340,
+        TOKEN_SUBNET_4O6_SUBNET = 341,
+        TOKEN_OPTION_DEF = 342,
+        TOKEN_OPTION_DATA = 343,
+        TOKEN_NAME = 344,
+        TOKEN_DATA = 345,
+        TOKEN_CODE = 346,
+        TOKEN_SPACE = 347,
+        TOKEN_CSV_FORMAT = 348,
+        TOKEN_ALWAYS_SEND = 349,
+        TOKEN_RECORD_TYPES = 350,
+        TOKEN_ENCAPSULATE = 351,
+        TOKEN_ARRAY = 352,
+        TOKEN_SHARED_NETWORKS = 353,
+        TOKEN_POOLS = 354,
+        TOKEN_POOL = 355,
+        TOKEN_USER_CONTEXT = 356,
+        TOKEN_COMMENT = 357,
+        TOKEN_SUBNET = 358,
+        TOKEN_INTERFACE = 359,
+        TOKEN_ID = 360,
+        TOKEN_RESERVATION_MODE = 361,
+        TOKEN_DISABLED = 362,
+        TOKEN_OUT_OF_POOL = 363,
+        TOKEN_GLOBAL = 364,
+        TOKEN_ALL = 365,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 366,
+        TOKEN_CLIENT_CLASSES = 367,
+        TOKEN_REQUIRE_CLIENT_CLASSES = 368,
+        TOKEN_TEST = 369,
+        TOKEN_ONLY_IF_REQUIRED = 370,
+        TOKEN_CLIENT_CLASS = 371,
+        TOKEN_RESERVATIONS = 372,
+        TOKEN_DUID = 373,
+        TOKEN_HW_ADDRESS = 374,
+        TOKEN_CIRCUIT_ID = 375,
+        TOKEN_CLIENT_ID = 376,
+        TOKEN_HOSTNAME = 377,
+        TOKEN_FLEX_ID = 378,
+        TOKEN_RELAY = 379,
+        TOKEN_IP_ADDRESS = 380,
+        TOKEN_IP_ADDRESSES = 381,
+        TOKEN_HOOKS_LIBRARIES = 382,
+        TOKEN_LIBRARY = 383,
+        TOKEN_PARAMETERS = 384,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 385,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 386,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 387,
+        TOKEN_HOLD_RECLAIMED_TIME = 388,
+        TOKEN_MAX_RECLAIM_LEASES = 389,
+        TOKEN_MAX_RECLAIM_TIME = 390,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 391,
+        TOKEN_DHCP4O6_PORT = 392,
+        TOKEN_DHCP_MULTI_THREADING = 393,
+        TOKEN_ENABLE_MULTI_THREADING = 394,
+        TOKEN_THREAD_POOL_SIZE = 395,
+        TOKEN_PACKET_QUEUE_SIZE = 396,
+        TOKEN_CONTROL_SOCKET = 397,
+        TOKEN_SOCKET_TYPE = 398,
+        TOKEN_SOCKET_NAME = 399,
+        TOKEN_DHCP_QUEUE_CONTROL = 400,
+        TOKEN_ENABLE_QUEUE = 401,
+        TOKEN_QUEUE_TYPE = 402,
+        TOKEN_CAPACITY = 403,
+        TOKEN_DHCP_DDNS = 404,
+        TOKEN_ENABLE_UPDATES = 405,
+        TOKEN_QUALIFYING_SUFFIX = 406,
+        TOKEN_SERVER_IP = 407,
+        TOKEN_SERVER_PORT = 408,
+        TOKEN_SENDER_IP = 409,
+        TOKEN_SENDER_PORT = 410,
+        TOKEN_MAX_QUEUE_SIZE = 411,
+        TOKEN_NCR_PROTOCOL = 412,
+        TOKEN_NCR_FORMAT = 413,
+        TOKEN_OVERRIDE_NO_UPDATE = 414,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 415,
+        TOKEN_REPLACE_CLIENT_NAME = 416,
+        TOKEN_GENERATED_PREFIX = 417,
+        TOKEN_TCP = 418,
+        TOKEN_JSON = 419,
+        TOKEN_WHEN_PRESENT = 420,
+        TOKEN_NEVER = 421,
+        TOKEN_ALWAYS = 422,
+        TOKEN_WHEN_NOT_PRESENT = 423,
+        TOKEN_HOSTNAME_CHAR_SET = 424,
+        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 425,
+        TOKEN_LOGGING = 426,
+        TOKEN_LOGGERS = 427,
+        TOKEN_OUTPUT_OPTIONS = 428,
+        TOKEN_OUTPUT = 429,
+        TOKEN_DEBUGLEVEL = 430,
+        TOKEN_SEVERITY = 431,
+        TOKEN_FLUSH = 432,
+        TOKEN_MAXSIZE = 433,
+        TOKEN_MAXVER = 434,
+        TOKEN_PATTERN = 435,
+        TOKEN_DHCP6 = 436,
+        TOKEN_DHCPDDNS = 437,
+        TOKEN_CONTROL_AGENT = 438,
+        TOKEN_TOPLEVEL_JSON = 439,
+        TOKEN_TOPLEVEL_DHCP4 = 440,
+        TOKEN_SUB_DHCP4 = 441,
+        TOKEN_SUB_INTERFACES4 = 442,
+        TOKEN_SUB_SUBNET4 = 443,
+        TOKEN_SUB_POOL4 = 444,
+        TOKEN_SUB_RESERVATION = 445,
+        TOKEN_SUB_OPTION_DEFS = 446,
+        TOKEN_SUB_OPTION_DEF = 447,
+        TOKEN_SUB_OPTION_DATA = 448,
+        TOKEN_SUB_HOOKS_LIBRARY = 449,
+        TOKEN_SUB_DHCP_DDNS = 450,
+        TOKEN_SUB_LOGGING = 451,
+        TOKEN_SUB_CONFIG_CONTROL = 452,
+        TOKEN_STRING = 453,
+        TOKEN_INTEGER = 454,
+        TOKEN_FLOAT = 455,
+        TOKEN_BOOLEAN = 456
       };
     };
 
@@ -874,6 +881,22 @@ namespace isc { namespace dhcp {
     symbol_type
     make_MAX_ROW_ERRORS (const location_type& l);
 
+    static inline
+    symbol_type
+    make_DURABILITY (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_FORMAT (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_MODE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_WRITE_RATE (const location_type& l);
+
     static inline
     symbol_type
     make_VALID_LIFETIME (const location_type& l);
@@ -950,6 +973,18 @@ namespace isc { namespace dhcp {
     symbol_type
     make_STORE_EXTENDED_INFO (const location_type& l);
 
+    static inline
+    symbol_type
+    make_ALLOCATOR (const location_type& l);
+
+    static inline
+    symbol_type
+    make_FREE_LEASE_INDEX (const location_type& l);
+
+    static inline
+    symbol_type
+    make_OPTION_ARENA (const location_type& l);
+
     static inline
     symbol_type
     make_SUBNET4 (const location_type& l);
@@ -1631,12 +1666,12 @@ namespace isc { namespace dhcp {
     enum
     {
       yyeof_ = 0,
-      yylast_ = 1357,     ///< Last index in yytable_.
-      yynnts_ = 417,  ///< Number of nonterminal symbols.
+      yylast_ = 1227,     ///< Last index in yytable_.
+      yynnts_ = 428,  ///< Number of nonterminal symbols.
       yyfinal_ = 30, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 195  ///< Number of tokens.
+      yyntokens_ = 202  ///< Number of tokens.
     };
 
 
@@ -1697,9 +1732,10 @@ namespace isc { namespace dhcp {
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-     185,   186,   187,   188,   189,   190,   191,   192,   193,   194
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201
     };
-    const unsigned int user_token_number_max_ = 449;
+    const unsigned int user_token_number_max_ = 456;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1732,30 +1768,30 @@ namespace isc { namespace dhcp {
   {
       switch (other.type_get ())
     {
-      case 211: // value
-      case 215: // map_value
-      case 256: // ddns_replace_client_name_value
-      case 278: // socket_type
-      case 281: // outbound_interface_value
-      case 303: // db_type
-      case 397: // hr_mode
-      case 552: // ncr_protocol_value
+      case 218: // value
+      case 222: // map_value
+      case 263: // ddns_replace_client_name_value
+      case 289: // socket_type
+      case 292: // outbound_interface_value
+      case 314: // db_type
+      case 415: // hr_mode
+      case 570: // ncr_protocol_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 194: // "boolean"
+      case 201: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 193: // "floating point"
+      case 200: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 192: // "integer"
+      case 199: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 191: // "constant string"
+      case 198: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1776,30 +1812,30 @@ namespace isc { namespace dhcp {
     (void) v;
       switch (this->type_get ())
     {
-      case 211: // value
-      case 215: // map_value
-      case 256: // ddns_replace_client_name_value
-      case 278: // socket_type
-      case 281: // outbound_interface_value
-      case 303: // db_type
-      case 397: // hr_mode
-      case 552: // ncr_protocol_value
+      case 218: // value
+      case 222: // map_value
+      case 263: // ddns_replace_client_name_value
+      case 289: // socket_type
+      case 292: // outbound_interface_value
+      case 314: // db_type
+      case 415: // hr_mode
+      case 570: // ncr_protocol_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 194: // "boolean"
+      case 201: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 193: // "floating point"
+      case 200: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 192: // "integer"
+      case 199: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 191: // "constant string"
+      case 198: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1879,30 +1915,30 @@ namespace isc { namespace dhcp {
     // Type destructor.
     switch (yytype)
     {
-      case 211: // value
-      case 215: // map_value
-      case 256: // ddns_replace_client_name_value
-      case 278: // socket_type
-      case 281: // outbound_interface_value
-      case 303: // db_type
-      case 397: // hr_mode
-      case 552: // ncr_protocol_value
+      case 218: // value
+      case 222: // map_value
+      case 263: // ddns_replace_client_name_value
+      case 289: // socket_type
+      case 292: // outbound_interface_value
+      case 314: // db_type
+      case 415: // hr_mode
+      case 570: // ncr_protocol_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 194: // "boolean"
+      case 201: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 193: // "floating point"
+      case 200: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 192: // "integer"
+      case 199: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 191: // "constant string"
+      case 198: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1929,30 +1965,30 @@ namespace isc { namespace dhcp {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 211: // value
-      case 215: // map_value
-      case 256: // ddns_replace_client_name_value
-      case 278: // socket_type
-      case 281: // outbound_interface_value
-      case 303: // db_type
-      case 397: // hr_mode
-      case 552: // ncr_protocol_value
+      case 218: // value
+      case 222: // map_value
+      case 263: // ddns_replace_client_name_value
+      case 289: // socket_type
+      case 292: // outbound_interface_value
+      case 314: // db_type
+      case 415: // hr_mode
+      case 570: // ncr_protocol_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 194: // "boolean"
+      case 201: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 193: // "floating point"
+      case 200: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 192: // "integer"
+      case 199: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 191: // "constant string"
+      case 198: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -2030,7 +2066,8 @@ namespace isc { namespace dhcp {
      415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
      425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
      435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449
+     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
+     455,   456
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -2365,6 +2402,30 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_MAX_ROW_ERRORS, l);
   }
 
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_DURABILITY (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_DURABILITY, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_LFC_FORMAT (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_FORMAT, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_LFC_MODE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_MODE, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_LFC_WRITE_RATE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_WRITE_RATE, l);
+  }
+
   Dhcp4Parser::symbol_type
   Dhcp4Parser::make_VALID_LIFETIME (const location_type& l)
   {
@@ -2479,6 +2540,24 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_STORE_EXTENDED_INFO, l);
   }
 
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_ALLOCATOR (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_ALLOCATOR, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_FREE_LEASE_INDEX (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_FREE_LEASE_INDEX, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_OPTION_ARENA (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_OPTION_ARENA, l);
+  }
+
   Dhcp4Parser::symbol_type
   Dhcp4Parser::make_SUBNET4 (const location_type& l)
   {
@@ -3196,7 +3275,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy" // lalr1.cc:377
 } } // isc::dhcp
-#line 3200 "dhcp4_parser.h" // lalr1.cc:377
+#line 3279 "dhcp4_parser.h" // lalr1.cc:377
 
 
 
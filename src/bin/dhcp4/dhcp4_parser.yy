@@ -101,6 +101,10 @@ using namespace std;
   TCP_KEEPALIVE "tcp-keepalive"
   TCP_NODELAY "tcp-nodelay"
   MAX_ROW_ERRORS "max-row-errors"
+  DURABILITY "durability"
+  LFC_FORMAT "lfc-format"
+  LFC_MODE "lfc-mode"
+  LFC_WRITE_RATE "lfc-write-rate"
 
   VALID_LIFETIME "valid-lifetime"
   MIN_VALID_LIFETIME "min-valid-lifetime"
@@ -121,6 +125,9 @@ using namespace std;
   DDNS_GENERATED_PREFIX "ddns-generated-prefix"
   DDNS_QUALIFYING_SUFFIX "ddns-qualifying-suffix"
   STORE_EXTENDED_INFO "store-extended-info"
+  ALLOCATOR "allocator"
+  FREE_LEASE_INDEX "free-lease-index"
+  OPTION_ARENA "option-arena"
   SUBNET4 "subnet4"
   SUBNET_4O6_INTERFACE "4o6-interface"
   SUBNET_4O6_INTERFACE_ID "4o6-interface-id"
@@ -509,6 +516,9 @@ global_param: valid_lifetime
             | ddns_generated_prefix
             | ddns_qualifying_suffix
             | store_extended_info
+            | allocator
+            | free_lease_index
+            | option_arena
             | statistic_default_sample_count
             | statistic_default_sample_age
             | dhcp_multi_threading
@@ -661,6 +671,24 @@ store_extended_info: STORE_EXTENDED_INFO COLON BOOLEAN {
     ctx.stack_.back()->set("store-extended-info", b);
 };
 
+allocator: ALLOCATOR {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr a(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("allocator", a);
+    ctx.leave();
+};
+
+free_lease_index: FREE_LEASE_INDEX COLON BOOLEAN {
+    ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("free-lease-index", b);
+};
+
+option_arena: OPTION_ARENA COLON BOOLEAN {
+    ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("option-arena", b);
+};
+
 statistic_default_sample_count: STATISTIC_DEFAULT_SAMPLE_COUNT COLON INTEGER {
     ElementPtr count(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("statistic-default-sample-count", count);
@@ -853,6 +881,10 @@ database_map_param: database_type
                   | consistency
                   | serial_consistency
                   | max_row_errors
+                  | durability
+                  | lfc_format
+                  | lfc_mode
+                  | lfc_write_rate
                   | unknown_map_entry
                   ;
 
@@ -988,6 +1020,35 @@ max_row_errors: MAX_ROW_ERRORS COLON INTEGER {
     ctx.stack_.back()->set("max-row-errors", n);
 };
 
+durability: DURABILITY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr d(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("durability", d);
+    ctx.leave();
+};
+
+lfc_format: LFC_FORMAT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr f(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("lfc-format", f);
+    ctx.leave();
+};
+
+lfc_mode: LFC_MODE {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr m(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("lfc-mode", m);
+    ctx.leave();
+};
+
+lfc_write_rate: LFC_WRITE_RATE COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-write-rate", n);
+};
+
 
 host_reservation_identifiers: HOST_RESERVATION_IDENTIFIERS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
@@ -1299,6 +1360,7 @@ subnet4_param: valid_lifetime
              | hostname_char_set
              | hostname_char_replacement
              | store_extended_info
+             | allocator
              | unknown_map_entry
              ;
 
@@ -1444,6 +1506,7 @@ shared_network_param: name
                     | hostname_char_set
                     | hostname_char_replacement
                     | store_extended_info
+                    | allocator
                     | unknown_map_entry
                     ;
 
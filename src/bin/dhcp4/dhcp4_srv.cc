@@ -22,6 +22,7 @@
 #include <dhcp/pkt4o6.h>
 #include <dhcp/pkt6.h>
 #include <dhcp/docsis3_option_defs.h>
+#include <dhcp4/client_handler.h>
 #include <dhcp4/dhcp4to6_ipc.h>
 #include <dhcp4/dhcp4_log.h>
 #include <dhcp4/dhcp4_srv.h>
@@ -109,6 +110,47 @@ struct Dhcp4Hooks {
     }
 };
 
+/// Structure that holds the counters of the statistics bumped for each
+/// received or sent packet, so these statistics are not looked up by name
+/// nor locked in the packet processing path.
+struct Dhcp4Counters {
+    StatsCounterPtr received_;          ///< "pkt4-received"
+    StatsCounterPtr discover_received_; ///< "pkt4-discover-received"
+    StatsCounterPtr offer_received_;    ///< "pkt4-offer-received"
+    StatsCounterPtr request_received_;  ///< "pkt4-request-received"
+    StatsCounterPtr ack_received_;      ///< "pkt4-ack-received"
+    StatsCounterPtr nak_received_;      ///< "pkt4-nak-received"
+    StatsCounterPtr release_received_;  ///< "pkt4-release-received"
+    StatsCounterPtr decline_received_;  ///< "pkt4-decline-received"
+    StatsCounterPtr inform_received_;   ///< "pkt4-inform-received"
+    StatsCounterPtr unknown_received_;  ///< "pkt4-unknown-received"
+    StatsCounterPtr sent_;              ///< "pkt4-sent"
+    StatsCounterPtr offer_sent_;        ///< "pkt4-offer-sent"
+    StatsCounterPtr ack_sent_;          ///< "pkt4-ack-sent"
+    StatsCounterPtr nak_sent_;          ///< "pkt4-nak-sent"
+    StatsCounterPtr receive_drop_;      ///< "pkt4-receive-drop"
+
+    /// Constructor that gets the counters from the statistics manager
+    Dhcp4Counters() {
+        StatsMgr& mgr = StatsMgr::instance();
+        received_          = mgr.getCounter("pkt4-received");
+        discover_received_ = mgr.getCounter("pkt4-discover-received");
+        offer_received_    = mgr.getCounter("pkt4-offer-received");
+        request_received_  = mgr.getCounter("pkt4-request-received");
+        ack_received_      = mgr.getCounter("pkt4-ack-received");
+        nak_received_      = mgr.getCounter("pkt4-nak-received");
+        release_received_  = mgr.getCounter("pkt4-release-received");
+        decline_received_  = mgr.getCounter("pkt4-decline-received");
+        inform_received_   = mgr.getCounter("pkt4-inform-received");
+        unknown_received_  = mgr.getCounter("pkt4-unknown-received");
+        sent_              = mgr.getCounter("pkt4-sent");
+        offer_sent_        = mgr.getCounter("pkt4-offer-sent");
+        ack_sent_          = mgr.getCounter("pkt4-ack-sent");
+        nak_sent_          = mgr.getCounter("pkt4-nak-sent");
+        receive_drop_      = mgr.getCounter("pkt4-receive-drop");
+    }
+};
+
 /// List of statistics which is initialized to 0 during the DHCPv4
 /// server startup.
 std::set<std::string> dhcp4_statistics = {
@@ -138,6 +180,9 @@ std::set<std::string> dhcp4_statistics = {
 // module is called.
 Dhcp4Hooks Hooks;
 
+// Declare the packet statistic counters in the same way.
+Dhcp4Counters Counters;
+
 
 namespace isc {
 namespace dhcp {
@@ -542,6 +587,8 @@ void Dhcpv4Exchange::evaluateClasses(const Pkt4Ptr& pkt, bool depend_on_known) {
     const ClientClassDictionaryPtr& dict =
         CfgMgr::instance().getCurrentCfg()->getClientClassDictionary();
     const ClientClassDefListPtr& defs_ptr = dict->getClasses();
+    // The classes share the values they extract from the packet.
+    ScopedEnableExtractionCache extraction_cache(*pkt);
     for (ClientClassDefList::const_iterator it = defs_ptr->cbegin();
          it != defs_ptr->cend(); ++it) {
         // Note second cannot be null
@@ -558,6 +605,10 @@ void Dhcpv4Exchange::evaluateClasses(const Pkt4Ptr& pkt, bool depend_on_known) {
         if ((*it)->getDependOnKnown() != depend_on_known) {
             continue;
         }
+        // Nothing depends on the class
+        if (!(*it)->getUsed()) {
+            continue;
+        }
         // Evaluate the expression which can return false (no match),
         // true (match) or raise an exception (error)
         try {
@@ -1063,8 +1114,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
     // failures in unpacking will cause the packet to be dropped. We
     // will increase type specific statistic further down the road.
     // See processStatsReceived().
-    isc::stats::StatsMgr::instance().addValue("pkt4-received",
-                                              static_cast<int64_t>(1));
+    Counters.received_->add();
 
     bool skip_unpack = false;
 
@@ -1144,8 +1194,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             // Increase the statistics of parse failures and dropped packets.
             isc::stats::StatsMgr::instance().addValue("pkt4-parse-failed",
                                                       static_cast<int64_t>(1));
-            isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                      static_cast<int64_t>(1));
+            Counters.receive_drop_->add();
             return;
         }
     }
@@ -1165,8 +1214,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
     // There is no need to log anything here. This function logs by itself.
     if (!accept(query)) {
         // Increase the statistic of dropped packets.
-        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                  static_cast<int64_t>(1));
+        Counters.receive_drop_->add();
         return;
     }
 
@@ -1222,11 +1270,58 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
     if (query->inClass("DROP")) {
         LOG_DEBUG(packet4_logger, DBGLVL_TRACE_BASIC, DHCP4_PACKET_DROP_0010)
             .arg(query->toText());
-        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                  static_cast<int64_t>(1));
+        Counters.receive_drop_->add();
         return;
     }
 
+    // In multi-threading mode do not process in parallel two queries
+    // from the same client: the later query is deferred until the client
+    // is free.
+    ClientHandler client_handler;
+    if (MultiThreadingMgr::instance().getMode()) {
+        ContinuationPtr cont =
+            makeContinuation(std::bind(&Dhcpv4Srv::processDhcp4QueryAndSendResponse,
+                                       this, query, rsp, allow_packet_park));
+        if (!client_handler.tryLock(query, cont)) {
+            return;
+        }
+    }
+
+    processDhcp4Query(query, rsp, allow_packet_park);
+}
+
+void
+Dhcpv4Srv::processDhcp4QueryAndSendResponse(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                                            bool allow_packet_park) {
+    try {
+        // Another query from the client may have been received since
+        // this one was deferred.
+        ClientHandler client_handler;
+        ContinuationPtr cont =
+            makeContinuation(std::bind(&Dhcpv4Srv::processDhcp4QueryAndSendResponse,
+                                       this, query, rsp, allow_packet_park));
+        if (!client_handler.tryLock(query, cont)) {
+            return;
+        }
+
+        processDhcp4Query(query, rsp, allow_packet_park);
+        if (!rsp) {
+            return;
+        }
+
+        CalloutHandlePtr callout_handle = getCalloutHandle(query);
+        processPacketBufferSend(callout_handle, rsp);
+    } catch (const std::exception& e) {
+        LOG_ERROR(packet4_logger, DHCP4_PACKET_PROCESS_STD_EXCEPTION)
+            .arg(e.what());
+    } catch (...) {
+        LOG_ERROR(packet4_logger, DHCP4_PACKET_PROCESS_EXCEPTION);
+    }
+}
+
+void
+Dhcpv4Srv::processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                             bool allow_packet_park) {
     AllocEngine::ClientContext4Ptr ctx;
 
     try {
@@ -1275,8 +1370,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             .arg(e.what());
 
         // Increase the statistic of dropped packets.
-        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                  static_cast<int64_t>(1));
+        Counters.receive_drop_->add();
     }
 
     bool packet_park = false;
@@ -1646,9 +1740,11 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
         return;
     }
 
+    // The configured option list flattened by option code.
+    const CfgOptionListResolver& resolver = ex.getCfgOptionListResolver();
+
     // Unlikely short cut
-    const CfgOptionList& co_list = ex.getCfgOptionList();
-    if (co_list.empty()) {
+    if (resolver.empty()) {
         return;
     }
 
@@ -1664,24 +1760,12 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
     if (option_prl) {
         requested_opts = option_prl->getValues();
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP4_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            if (desc->option_) {
-                uint8_t code = static_cast<uint8_t>(desc->option_->getType());
-                requested_opts.push_back(code);
-            }
-        }
+
+    // Add the codes of the persistent options to requested options
+    std::vector<uint16_t> persistent_opts;
+    resolver.getPersistent(DHCP4_OPTION_SPACE, persistent_opts);
+    for (auto code : persistent_opts) {
+        requested_opts.push_back(static_cast<uint8_t>(code));
     }
 
     // For each requested option code get the instance of the option
@@ -1690,15 +1774,9 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
          opt != requested_opts.end(); ++opt) {
         // Add nothing when it is already there
         if (!resp->getOption(*opt)) {
-            // Iterate on the configured option list
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE, *opt);
-                // Got it: add it and jump to the outer loop
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
+            OptionPtr option = resolver.get(DHCP4_OPTION_SPACE, *opt);
+            if (option) {
+                resp->addOption(option);
             }
         }
     }
@@ -1717,9 +1795,11 @@ Dhcpv4Srv::appendRequestedVendorOptions(Dhcpv4Exchange& ex) {
         return;
     }
 
+    // The configured option list flattened by option code.
+    const CfgOptionListResolver& resolver = ex.getCfgOptionListResolver();
+
     // Unlikely short cut
-    const CfgOptionList& co_list = ex.getCfgOptionList();
-    if (co_list.empty()) {
+    if (resolver.empty()) {
         return;
     }
 
@@ -1764,25 +1844,12 @@ Dhcpv4Srv::appendRequestedVendorOptions(Dhcpv4Exchange& ex) {
     if (oro) {
         requested_opts = oro->getValues();
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(vendor_id);
-        if (!opts) {
-            continue;
-        }
 
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            if (desc->option_) {
-                uint8_t code = static_cast<uint8_t>(desc->option_->getType());
-                requested_opts.push_back(code);
-            }
-        }
+    // Add the codes of the persistent options to requested options
+    std::vector<uint16_t> persistent_opts;
+    resolver.getPersistent(vendor_id, persistent_opts);
+    for (auto code : persistent_opts) {
+        requested_opts.push_back(static_cast<uint8_t>(code));
     }
 
     // If there is nothing to add don't do anything then.
@@ -1801,14 +1868,10 @@ Dhcpv4Srv::appendRequestedVendorOptions(Dhcpv4Exchange& ex) {
     for (std::vector<uint8_t>::const_iterator code = requested_opts.begin();
          code != requested_opts.end(); ++code) {
         if  (!vendor_rsp->getOption(*code)) {
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(vendor_id, *code);
-                if (desc.option_) {
-                    vendor_rsp->addOption(desc.option_);
-                    added = true;
-                    break;
-                }
+            OptionPtr option = resolver.get(vendor_id, *code);
+            if (option) {
+                vendor_rsp->addOption(option);
+                added = true;
             }
         }
 
@@ -1840,9 +1903,11 @@ Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
         return;
     }
 
+    // The configured option list flattened by option code.
+    const CfgOptionListResolver& resolver = ex.getCfgOptionListResolver();
+
     // Unlikely short cut
-    const CfgOptionList& co_list = ex.getCfgOptionList();
-    if (co_list.empty()) {
+    if (resolver.empty()) {
         return;
     }
 
@@ -1854,14 +1919,9 @@ Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
         OptionPtr opt = resp->getOption(required_options[i]);
         if (!opt) {
             // Check whether option has been configured.
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE,
-                                                      required_options[i]);
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
+            opt = resolver.get(DHCP4_OPTION_SPACE, required_options[i]);
+            if (opt) {
+                resp->addOption(opt);
             }
         }
     }
@@ -3094,6 +3154,9 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release, AllocEngine::ClientContext4Ptr& cont
 
             if (success) {
 
+                // The address can be allocated again.
+                alloc_engine_->freeLeaseAddress(lease);
+
                 context.reset(new AllocEngine::ClientContext4());
                 context->old_lease_ = lease;
 
@@ -3643,6 +3706,7 @@ void Dhcpv4Srv::requiredClassify(Dhcpv4Exchange& ex) {
     // Note getClientClassDictionary() cannot be null
     const ClientClassDictionaryPtr& dict =
         CfgMgr::instance().getCurrentCfg()->getClientClassDictionary();
+    ScopedEnableExtractionCache extraction_cache(*query);
     for (ClientClasses::const_iterator cclass = classes.cbegin();
          cclass != classes.cend(); ++cclass) {
         const ClientClassDefPtr class_def = dict->findClass(*cclass);
@@ -3825,35 +3889,35 @@ void Dhcpv4Srv::processStatsReceived(const Pkt4Ptr& query) {
     // Note that we're not bumping pkt4-received statistic as it was
     // increased early in the packet reception code.
 
-    string stat_name = "pkt4-unknown-received";
+    StatsCounter* counter = Counters.unknown_received_.get();
     try {
         switch (query->getType()) {
         case DHCPDISCOVER:
-            stat_name = "pkt4-discover-received";
+            counter = Counters.discover_received_.get();
             break;
         case DHCPOFFER:
             // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-offer-received";
+            counter = Counters.offer_received_.get();
             break;
         case DHCPREQUEST:
-            stat_name = "pkt4-request-received";
+            counter = Counters.request_received_.get();
             break;
         case DHCPACK:
             // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-ack-received";
+            counter = Counters.ack_received_.get();
             break;
         case DHCPNAK:
             // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-nak-received";
+            counter = Counters.nak_received_.get();
             break;
         case DHCPRELEASE:
-            stat_name = "pkt4-release-received";
+            counter = Counters.release_received_.get();
         break;
         case DHCPDECLINE:
-            stat_name = "pkt4-decline-received";
+            counter = Counters.decline_received_.get();
             break;
         case DHCPINFORM:
-            stat_name = "pkt4-inform-received";
+            counter = Counters.inform_received_.get();
             break;
         default:
             ; // do nothing
@@ -3866,34 +3930,31 @@ void Dhcpv4Srv::processStatsReceived(const Pkt4Ptr& query) {
         // name of pkt4-unknown-received.
     }
 
-    isc::stats::StatsMgr::instance().addValue(stat_name,
-                                              static_cast<int64_t>(1));
+    counter->add();
 }
 
 void Dhcpv4Srv::processStatsSent(const Pkt4Ptr& response) {
     // Increase generic counter for sent packets.
-    isc::stats::StatsMgr::instance().addValue("pkt4-sent",
-                                              static_cast<int64_t>(1));
+    Counters.sent_->add();
 
     // Increase packet type specific counter for packets sent.
-    string stat_name;
+    StatsCounter* counter = 0;
     switch (response->getType()) {
     case DHCPOFFER:
-        stat_name = "pkt4-offer-sent";
+        counter = Counters.offer_sent_.get();
         break;
     case DHCPACK:
-        stat_name = "pkt4-ack-sent";
+        counter = Counters.ack_sent_.get();
         break;
     case DHCPNAK:
-        stat_name = "pkt4-nak-sent";
+        counter = Counters.nak_sent_.get();
         break;
     default:
         // That should never happen
         return;
     }
 
-    isc::stats::StatsMgr::instance().addValue(stat_name,
-                                              static_cast<int64_t>(1));
+    counter->add();
 }
 
 int Dhcpv4Srv::getHookIndexBuffer4Receive() {
@@ -20,6 +20,7 @@
 #include <dhcpsrv/cb_ctl_dhcp4.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/d2_client_mgr.h>
+#include <dhcpsrv/flat_cfg_option.h>
 #include <dhcpsrv/network_state.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
@@ -112,7 +113,10 @@ public:
     }
 
     /// @brief Returns the configured option list (non-const version)
+    ///
+    /// The list may be modified so its resolver is rebuilt on next use.
     CfgOptionList& getCfgOptionList() {
+        cfg_option_list_resolver_.reset();
         return (cfg_option_list_);
     }
 
@@ -121,6 +125,17 @@ public:
         return (cfg_option_list_);
     }
 
+    /// @brief Returns the resolver of the configured option list.
+    ///
+    /// The resolver is built on first use and shared by all the methods
+    /// appending options to the response.
+    const CfgOptionListResolver& getCfgOptionListResolver() {
+        if (!cfg_option_list_resolver_) {
+            cfg_option_list_resolver_.reset(new CfgOptionListResolver(cfg_option_list_));
+        }
+        return (*cfg_option_list_resolver_);
+    }
+
     /// @brief Sets reserved values of siaddr, sname and file in the
     /// server's response.
     void setReservedMessageFields();
@@ -218,6 +233,9 @@ private:
     /// @note The configured option list is an *ordered* list of
     /// @c CfgOption objects used to append options to the response.
     CfgOptionList cfg_option_list_;
+
+    /// @brief Resolver of the configured option list.
+    boost::shared_ptr<CfgOptionListResolver> cfg_option_list_resolver_;
 };
 
 /// @brief Type representing the pointer to the @c Dhcpv4Exchange.
@@ -361,6 +379,28 @@ public:
     void processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp,
                        bool allow_packet_park = true);
 
+    /// @brief Process a single incoming DHCPv4 query.
+    ///
+    /// It calls per-type processXXX methods, generates appropriate answer.
+    /// The query must have been unpacked, classified and accepted.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param rsp A pointer to the response
+    /// @param allow_packet_park Indicates if parking a packet is allowed.
+    void processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                           bool allow_packet_park);
+
+    /// @brief Process a deferred DHCPv4 query and sends the response.
+    ///
+    /// This is the continuation of a query deferred because another query
+    /// from the same client was being processed.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param rsp A pointer to the response
+    /// @param allow_packet_park Indicates if parking a packet is allowed.
+    void processDhcp4QueryAndSendResponse(Pkt4Ptr& query, Pkt4Ptr& rsp,
+                                          bool allow_packet_park);
+
     /// @brief Instructs the server to shut down.
     void shutdown();
 
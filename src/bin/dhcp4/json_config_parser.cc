@@ -15,6 +15,7 @@
 #include <dhcp4/json_config_parser.h>
 #include <dhcp/libdhcp++.h>
 #include <dhcp/option_definition.h>
+#include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cb_ctl_dhcp4.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfgmgr.h>
@@ -113,6 +114,17 @@ public:
         // Set the server's logical name
         std::string server_tag = getString(global, "server-tag");
         cfg->setServerTag(server_tag);
+
+        // Check the allocator type: it is applied by subnets.
+        ConstElementPtr allocator = global->get("allocator");
+        if (allocator) {
+            try {
+                AllocEngine::allocTypeFromText(allocator->stringValue());
+            } catch (const std::exception& ex) {
+                isc_throw(DhcpConfigError, ex.what() << " ("
+                          << allocator->getPosition() << ")");
+            }
+        }
     }
 
     /// @brief Copies subnets from shared networks to regular subnets container
@@ -582,6 +594,9 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
                  (config_pair.first == "ddns-generated-prefix") ||
                  (config_pair.first == "ddns-qualifying-suffix") ||
                  (config_pair.first == "store-extended-info") ||
+                 (config_pair.first == "allocator") ||
+                 (config_pair.first == "free-lease-index") ||
+                 (config_pair.first == "option-arena") ||
                  (config_pair.first == "statistic-default-sample-count") ||
                  (config_pair.first == "statistic-default-sample-age")) {
                 CfgMgr::instance().getStagingCfg()->addConfiguredGlobal(config_pair.first,
@@ -703,6 +718,11 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
         }
     }
 
+    // Find the client classes which need to be evaluated for each packet.
+    if (!rollback) {
+        srv_cfg->updateUsedClientClasses();
+    }
+
     // Rollback changes as the configuration parsing failed.
     if (rollback) {
         // Revert to original configuration of runtime option definitions
@@ -0,0 +1,137 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option.h>
+#include <dhcp4/client_handler.h>
+#include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::stats;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Test fixture class for testing client handler.
+class ClientHandleTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Enables the multi-threading mode without starting the threads so
+    /// the continuations pushed to the thread pool stay in its queue.
+    ClientHandleTest() {
+        MultiThreadingMgr::instance().setMode(true);
+        StatsMgr::instance().setValue("pkt4-receive-drop",
+                                      static_cast<int64_t>(0));
+    }
+
+    /// @brief Destructor.
+    ~ClientHandleTest() {
+        MultiThreadingMgr::instance().getThreadPool().reset();
+        MultiThreadingMgr::instance().setMode(false);
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Creates a query.
+    ///
+    /// @param hwaddr_byte The last byte of the hardware address.
+    /// @param client_id_byte The last byte of the client identifier,
+    /// none when 0.
+    Pkt4Ptr createQuery(uint8_t hwaddr_byte, uint8_t client_id_byte = 0) {
+        Pkt4Ptr query(new Pkt4(DHCPREQUEST, 1234));
+        std::vector<uint8_t> mac = { 0, 1, 2, 3, 4, hwaddr_byte };
+        query->setHWAddr(HWAddrPtr(new HWAddr(mac, HTYPE_ETHER)));
+        if (client_id_byte) {
+            OptionBuffer client_id = { 1, 2, 3, 4, client_id_byte };
+            query->addOption(OptionPtr(new Option(Option::V4,
+                                                  DHO_DHCP_CLIENT_IDENTIFIER,
+                                                  client_id)));
+        }
+        return (query);
+    }
+
+    /// @brief Returns the number of dropped queries.
+    int64_t getDropped() {
+        return (StatsMgr::instance().getObservation("pkt4-receive-drop")->
+                getInteger().first);
+    }
+
+    /// @brief Returns the number of continuations in the thread pool.
+    size_t getPushed() {
+        return (MultiThreadingMgr::instance().getThreadPool().count());
+    }
+};
+
+// Verifies that a second query from the same client is parked and
+// pushed to the thread pool when the first one is done.
+TEST_F(ClientHandleTest, parked) {
+    bool called = false;
+    ContinuationPtr cont = makeContinuation([&called]() { called = true; });
+    {
+        ClientHandler handler1;
+        ASSERT_TRUE(handler1.tryLock(createQuery(1, 1)));
+
+        // Same client identifier, other hardware address.
+        ClientHandler handler2;
+        EXPECT_FALSE(handler2.tryLock(createQuery(2, 1), cont));
+        EXPECT_EQ(0, getPushed());
+
+        // Another client is not blocked.
+        ClientHandler handler3;
+        EXPECT_TRUE(handler3.tryLock(createQuery(3, 3)));
+    }
+    EXPECT_EQ(1, getPushed());
+    EXPECT_EQ(0, getDropped());
+    EXPECT_FALSE(called);
+
+    // The client is free again.
+    ClientHandler handler;
+    EXPECT_TRUE(handler.tryLock(createQuery(1, 1)));
+}
+
+// Verifies that a newer query replaces the parked one, and that a query
+// without continuation is dropped.
+TEST_F(ClientHandleTest, dropped) {
+    ContinuationPtr cont1 = makeContinuation([]() {});
+    ContinuationPtr cont2 = makeContinuation([]() {});
+    {
+        // No client identifier: the hardware address is used.
+        ClientHandler handler1;
+        ASSERT_TRUE(handler1.tryLock(createQuery(1)));
+
+        ClientHandler handler2;
+        EXPECT_FALSE(handler2.tryLock(createQuery(1), cont1));
+        EXPECT_EQ(0, getDropped());
+
+        ClientHandler handler3;
+        EXPECT_FALSE(handler3.tryLock(createQuery(1), cont2));
+        EXPECT_EQ(1, getDropped());
+
+        ClientHandler handler4;
+        EXPECT_FALSE(handler4.tryLock(createQuery(1)));
+        EXPECT_EQ(2, getDropped());
+    }
+    // Only the last parked query is processed.
+    EXPECT_EQ(1, getPushed());
+}
+
+// Verifies that a query without identifier is always processed.
+TEST_F(ClientHandleTest, noIdentifier) {
+    Pkt4Ptr query(new Pkt4(DHCPREQUEST, 1234));
+    query->setHWAddr(HWAddrPtr(new HWAddr()));
+    ClientHandler handler1;
+    EXPECT_TRUE(handler1.tryLock(query));
+    ClientHandler handler2;
+    EXPECT_TRUE(handler2.tryLock(query));
+}
+
+} // end of anonymous namespace
@@ -7134,6 +7134,116 @@ TEST_F(Dhcp4ParserTest, storeExtendedInfoGlobal) {
     EXPECT_TRUE(subnet2->getStoreExtendedInfo());
 }
 
+// This test checks that the global allocator parameter is used when there
+// is no such parameter under subnet and that the parameter specified for
+// a subnet overrides the global setting.
+TEST_F(Dhcp4ParserTest, allocatorGlobal) {
+    std::string config = "{ " + genIfaceConfig() + "," +
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, "
+        "\"allocator\": \"hashed\","
+        "\"subnet4\": [ "
+        "{"
+        "    \"allocator\": \"iterative\","
+        "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.100\" } ],"
+        "    \"subnet\": \"192.0.2.0/24\""
+        "},"
+        "{"
+        "    \"pools\": [ { \"pool\": \"192.0.3.1 - 192.0.3.100\" } ],"
+        "    \"subnet\": \"192.0.3.0/24\""
+        "} ],"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    extractConfig(config);
+
+    ConstElementPtr status;
+    ASSERT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 0);
+
+    CfgSubnets4Ptr cfg = CfgMgr::instance().getStagingCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet1 = cfg->selectSubnet(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(subnet1);
+    // Reset the fetch global function to staging (vs current) config.
+    subnet1->setFetchGlobalsFn([]() -> ConstElementPtr {
+        return (CfgMgr::instance().getStagingCfg()->getConfiguredGlobals());
+    });
+    EXPECT_EQ("iterative", subnet1->getAllocatorType().get());
+
+    Subnet4Ptr subnet2 = cfg->selectSubnet(IOAddress("192.0.3.1"));
+    ASSERT_TRUE(subnet2);
+    // Reset the fetch global function to staging (vs current) config.
+    subnet2->setFetchGlobalsFn([]() -> ConstElementPtr {
+        return (CfgMgr::instance().getStagingCfg()->getConfiguredGlobals());
+    });
+    EXPECT_EQ("hashed", subnet2->getAllocatorType().get());
+}
+
+// This test checks that an unknown allocator type is rejected.
+TEST_F(Dhcp4ParserTest, allocatorInvalid) {
+    std::string config = "{ " + genIfaceConfig() + "," +
+        "\"subnet4\": [ "
+        "{"
+        "    \"allocator\": \"foo\","
+        "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.100\" } ],"
+        "    \"subnet\": \"192.0.2.0/24\""
+        "} ],"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+
+    ConstElementPtr status;
+    ASSERT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 1);
+}
+
+// This test checks that the free-lease-index global parameter is stored
+// in the configured globals.
+TEST_F(Dhcp4ParserTest, freeLeaseIndex) {
+    std::string config = "{ " + genIfaceConfig() + "," +
+        "\"free-lease-index\": true,"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+
+    ConstElementPtr status;
+    ASSERT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 0);
+
+    ConstElementPtr enabled = CfgMgr::instance().getStagingCfg()->
+        getConfiguredGlobal("free-lease-index");
+    ASSERT_TRUE(enabled);
+    EXPECT_TRUE(enabled->boolValue());
+}
+
+// This test checks that the option-arena global parameter is stored in
+// the configured globals and must be a boolean.
+TEST_F(Dhcp4ParserTest, optionArena) {
+    std::string config = "{ " + genIfaceConfig() + "," +
+        "\"option-arena\": true,"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+
+    ConstElementPtr status;
+    ASSERT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 0);
+
+    ConstElementPtr enabled = CfgMgr::instance().getStagingCfg()->
+        getConfiguredGlobal("option-arena");
+    ASSERT_TRUE(enabled);
+    EXPECT_TRUE(enabled->boolValue());
+
+    config = "{ " + genIfaceConfig() + "," +
+        "\"option-arena\": 1,"
+        "\"valid-lifetime\": 4000 }";
+    EXPECT_THROW(parseDHCP4(config), Dhcp4ParseError);
+}
+
 /// This test checks that the statistic-default-sample-count and age
 /// global parameters are committed to the stats manager as expected.
 TEST_F(Dhcp4ParserTest, statsDefaultLimits) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -483,7 +483,7 @@ HostOptionsTest::testOverrideVendorOptions(const bool stateless) {
     // Information option with exactly one suboption.
     ASSERT_EQ(1, client.config_.vendor_suboptions_.size());
     // Assume this suboption is a TFTP servers suboption.
-    std::multimap<unsigned int, OptionPtr>::const_iterator opt =
+    OptionCollection::const_iterator opt =
         client.config_.vendor_suboptions_.find(DOCSIS3_V4_TFTP_SERVERS);
     ASSERT_TRUE(opt->second);
     Option4AddrLstPtr opt_tftp = boost::dynamic_pointer_cast<
@@ -342,6 +342,95 @@ void testError(const std::string& txt,
     }
 }
 
+// Check that the durability of the memfile lease updates can be specified
+// in the lease database.
+TEST(ParserTest, leaseDatabaseDurability) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"durability\": \"group-commit\" } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt,
+                                           Parser4Context::PARSER_DHCP4));
+    ConstElementPtr durability =
+        json->get("Dhcp4")->get("lease-database")->get("durability");
+    ASSERT_TRUE(durability);
+    EXPECT_EQ("group-commit", durability->stringValue());
+
+    // The durability is a string.
+    txt = "{ \"Dhcp4\": { \"lease-database\": {"
+          " \"type\": \"memfile\", \"durability\": 1 } } }";
+    testError(txt, Parser4Context::PARSER_DHCP4,
+              "<string>:1.67: syntax error, unexpected integer, "
+              "expecting constant string");
+}
+
+// Check that the format of the lease files written by the Lease File
+// Cleanup can be specified in the lease database.
+TEST(ParserTest, leaseDatabaseLfcFormat) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"lfc-interval\": 3600,"
+                 " \"lfc-format\": \"binary\" } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt,
+                                           Parser4Context::PARSER_DHCP4));
+    ConstElementPtr format =
+        json->get("Dhcp4")->get("lease-database")->get("lfc-format");
+    ASSERT_TRUE(format);
+    EXPECT_EQ("binary", format->stringValue());
+
+    // The format is a string.
+    txt = "{ \"Dhcp4\": { \"lease-database\": {"
+          " \"type\": \"memfile\", \"lfc-format\": true } } }";
+    testError(txt, Parser4Context::PARSER_DHCP4,
+              "<string>:1.67-70: syntax error, unexpected boolean, "
+              "expecting constant string");
+}
+
+// Check that the mode and the write rate of the Lease File Cleanup can be
+// specified in the lease database.
+TEST(ParserTest, leaseDatabaseLfcMode) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"lfc-interval\": 3600,"
+                 " \"lfc-mode\": \"in-process\","
+                 " \"lfc-write-rate\": 1000 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    Parser4Context ctx;
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = ctx.parseString(txt,
+                                           Parser4Context::PARSER_DHCP4));
+    ConstElementPtr database = json->get("Dhcp4")->get("lease-database");
+    ASSERT_TRUE(database);
+    ConstElementPtr mode = database->get("lfc-mode");
+    ASSERT_TRUE(mode);
+    EXPECT_EQ("in-process", mode->stringValue());
+    ConstElementPtr rate = database->get("lfc-write-rate");
+    ASSERT_TRUE(rate);
+    EXPECT_EQ(1000, rate->intValue());
+
+    // The mode is a string.
+    txt = "{ \"Dhcp4\": { \"lease-database\": {"
+          " \"type\": \"memfile\", \"lfc-mode\": 1 } } }";
+    testError(txt, Parser4Context::PARSER_DHCP4,
+              "<string>:1.65: syntax error, unexpected integer, "
+              "expecting constant string");
+
+    // The write rate is an integer.
+    txt = "{ \"Dhcp4\": { \"lease-database\": {"
+          " \"type\": \"memfile\", \"lfc-write-rate\": \"x\" } } }";
+    testError(txt, Parser4Context::PARSER_DHCP4,
+              "<string>:1.71-73: syntax error, unexpected constant string, "
+              "expecting integer");
+}
+
 // Verify that error conditions are handled correctly.
 TEST(ParserTest, errors) {
     // no input
@@ -0,0 +1,126 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/dhcp6.h>
+#include <dhcp6/client_handler.h>
+#include <dhcp6/dhcp6_log.h>
+#include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
+
+#include <boost/functional/hash.hpp>
+
+using namespace isc::util;
+
+namespace isc {
+namespace dhcp {
+
+ClientHandler::Stripe ClientHandler::stripes_[ClientHandler::STRIPES];
+
+ClientHandler::Client::Client(const Pkt6Ptr& query)
+    : query_(query) {
+}
+
+size_t
+ClientHandler::KeyHash::operator()(const Key& key) const {
+    return (boost::hash_range(key.begin(), key.end()));
+}
+
+ClientHandler::Stripe&
+ClientHandler::getStripe(const Key& key) {
+    return (stripes_[KeyHash()(key) % STRIPES]);
+}
+
+void
+ClientHandler::makeKey(const Pkt6Ptr& query, Key& key) {
+    key.clear();
+
+    OptionPtr opt = query->getOption(D6O_CLIENTID);
+    if (opt) {
+        const OptionBuffer& data = opt->getData();
+        key.assign(data.begin(), data.end());
+    }
+}
+
+ClientHandler::ClientHandler() {
+}
+
+ClientHandler::~ClientHandler() {
+    if (key_.empty()) {
+        return;
+    }
+
+    ContinuationPtr cont;
+    Stripe& stripe = getStripe(key_);
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex_);
+        auto it = stripe.clients_.find(key_);
+        if (it == stripe.clients_.end()) {
+            return;
+        }
+        cont = it->second->cont_;
+        stripe.clients_.erase(it);
+    }
+
+    // Process the parked query now the client is free.
+    if (cont) {
+        MultiThreadingMgr::instance().getThreadPool().add(cont);
+    }
+}
+
+bool
+ClientHandler::tryLock(const Pkt6Ptr& query, const ContinuationPtr& cont) {
+    if (!key_.empty()) {
+        isc_throw(InvalidOperation, "client handler already holds a client");
+    }
+
+    Key key;
+    makeKey(query, key);
+    if (key.empty()) {
+        // Nothing to identify the client: process the query.
+        return (true);
+    }
+
+    Pkt6Ptr dropped;
+    Stripe& stripe = getStripe(key);
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex_);
+        auto it = stripe.clients_.find(key);
+        if (it == stripe.clients_.end()) {
+            stripe.clients_[key] = ClientPtr(new Client(query));
+            key_.swap(key);
+            return (true);
+        }
+
+        // The client is in progress: park the query, replacing the
+        // query parked before which is dropped.
+        const ClientPtr& client = it->second;
+        if (cont) {
+            dropped = client->next_query_;
+            client->next_query_ = query;
+            client->cont_ = cont;
+        } else {
+            dropped = query;
+        }
+    }
+
+    if (cont) {
+        LOG_DEBUG(packet6_logger, DBG_DHCP6_DETAIL, DHCP6_PACKET_DEFERRED)
+            .arg(query->getLabel());
+    }
+    if (dropped) {
+        LOG_DEBUG(bad_packet6_logger, DBG_DHCP6_DETAIL,
+                  DHCP6_PACKET_DROP_DUPLICATE)
+            .arg(dropped->getLabel());
+        stats::StatsMgr::instance().addValue("pkt6-receive-drop",
+                                             static_cast<int64_t>(1));
+    }
+    return (false);
+}
+
+} // namespace dhcp
+} // namespace isc
@@ -0,0 +1,141 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CLIENT_HANDLER_H
+#define CLIENT_HANDLER_H
+
+#include <dhcp/pkt6.h>
+#include <boost/make_shared.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Define the type of packet processing continuation.
+typedef std::function<void()> Continuation;
+
+/// @brief Define the type of shared pointers to continuations.
+typedef boost::shared_ptr<Continuation> ContinuationPtr;
+
+/// @brief Continuation factory.
+///
+/// @param cont Continuation rvalue.
+inline ContinuationPtr makeContinuation(Continuation&& cont) {
+    return (boost::make_shared<Continuation>(cont));
+}
+
+/// @brief Client race avoidance RAII handler.
+///
+/// In multi-threading mode the queries are processed in parallel so two
+/// queries from the same client (e.g. a retransmission) could race in the
+/// allocation engine. A handler registers the client of the query it
+/// processes in a table of clients in progress. A query from a client
+/// already in progress is not processed: its processing continuation is
+/// parked in the client entry, replacing (and dropping) a query parked
+/// before, and it is pushed to the thread pool when the query in progress
+/// is done. So at most one query per client is processed at a time.
+///
+/// The client is identified by its DUID, i.e. the content of its client
+/// identifier option. The table is split into
+/// stripes, each with its own mutex, so handlers of different clients
+/// seldom contend.
+class ClientHandler : public boost::noncopyable {
+public:
+
+    /// @brief Number of stripes of the table of clients in progress.
+    static const size_t STRIPES = 64;
+
+    /// @brief Constructor.
+    ClientHandler();
+
+    /// @brief Destructor.
+    ///
+    /// Unregisters the client and pushes the parked continuation, if any,
+    /// to the thread pool.
+    virtual ~ClientHandler();
+
+    /// @brief Tries to acquire the client of a query.
+    ///
+    /// @param query The query from the client.
+    /// @param cont The continuation processing the query, parked when the
+    /// client is in progress. When null the query is simply dropped.
+    /// @return true if the query can be processed, false if it was parked
+    /// or dropped because another query of the client is in progress.
+    bool tryLock(const Pkt6Ptr& query,
+                 const ContinuationPtr& cont = ContinuationPtr());
+
+private:
+
+    /// @brief Structure representing a client in progress.
+    struct Client {
+
+        /// @brief Constructor.
+        ///
+        /// @param query The query being processed.
+        Client(const Pkt6Ptr& query);
+
+        /// @brief The query being processed.
+        Pkt6Ptr query_;
+
+        /// @brief The query parked while the client is in progress.
+        Pkt6Ptr next_query_;
+
+        /// @brief The continuation of the parked query.
+        ContinuationPtr cont_;
+    };
+
+    /// @brief The type of shared pointers to clients.
+    typedef boost::shared_ptr<Client> ClientPtr;
+
+    /// @brief The type of client identifiers used as keys.
+    typedef std::vector<uint8_t> Key;
+
+    /// @brief Hash functor of keys.
+    struct KeyHash {
+        /// @brief Returns the hash of a key.
+        ///
+        /// @param key The key.
+        size_t operator()(const Key& key) const;
+    };
+
+    /// @brief A stripe of the table of clients in progress.
+    struct Stripe {
+        /// @brief The mutex protecting the stripe.
+        std::mutex mutex_;
+
+        /// @brief The clients in progress.
+        std::unordered_map<Key, ClientPtr, KeyHash> clients_;
+    };
+
+    /// @brief Returns the stripe of a key.
+    ///
+    /// @param key The key.
+    static Stripe& getStripe(const Key& key);
+
+    /// @brief Builds the key of the client of a query.
+    ///
+    /// @param query The query.
+    /// @param [out] key The key, left empty when the query has no client
+    /// identifier.
+    static void makeKey(const Pkt6Ptr& query, Key& key);
+
+    /// @brief The table of clients in progress.
+    static Stripe stripes_[STRIPES];
+
+    /// @brief The key of the acquired client (empty when none).
+    Key key_;
+};
+
+} // namespace dhcp
+} // namespace isc
+
+#endif // CLIENT_HANDLER_H
@@ -769,6 +769,15 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Build the allocation state of the pools from the leases.
+    try {
+        srv->alloc_engine_->
+            buildAllocatorStates(CfgMgr::instance().getStagingCfg());
+    } catch (const std::exception& ex) {
+        err << "Unable to build the allocator state: " << ex.what();
+        return (isc::config::createAnswer(1, err.str()));
+    }
+
     // Regenerate server identifier if needed.
     try {
         const std::string duid_file =
@@ -822,6 +831,12 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Allocate the options of the received packets in an arena when
+    // configured.
+    data::ConstElementPtr option_arena =
+        CfgMgr::instance().getStagingCfg()->getConfiguredGlobal("option-arena");
+    Pkt::setDefaultOptionArena(option_arena && option_arena->boolValue());
+
     // Configuration may change active interfaces. Therefore, we have to reopen
     // sockets according to new configuration. It is possible that this
     // operation will fail for some interfaces but the openSockets function
@@ -1116,6 +1131,8 @@ ControlledDhcpv6Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
     try {
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getCurrentCfg()->getCfgDbAccess();
         cfg_db->createManagers();
+        server_->alloc_engine_->
+            buildAllocatorStates(CfgMgr::instance().getCurrentCfg());
         reopened = true;
     } catch (const std::exception& ex) {
         LOG_ERROR(dhcp6_logger, DHCP6_DB_RECONNECT_ATTEMPT_FAILED).arg(ex.what());
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 208
-#define YY_END_OF_BUFFER 209
+#define YY_NUM_RULES 215
+#define YY_END_OF_BUFFER 216
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,35 +700,35 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1873] =
+static const flex_int16_t yy_accept[1934] =
     {   0,
-      201,  201,    0,    0,    0,    0,    0,    0,    0,    0,
-      209,  207,   10,   11,  207,    1,  201,  198,  201,  201,
-      207,  200,  199,  207,  207,  207,  207,  207,  194,  195,
-      207,  207,  207,  196,  197,    5,    5,    5,  207,  207,
-      207,   10,   11,    0,    0,  190,    0,    0,    0,    0,
+      208,  208,    0,    0,    0,    0,    0,    0,    0,    0,
+      216,  214,   10,   11,  214,    1,  208,  205,  208,  208,
+      214,  207,  206,  214,  214,  214,  214,  214,  201,  202,
+      214,  214,  214,  203,  204,    5,    5,    5,  214,  214,
+      214,   10,   11,    0,    0,  197,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  201,
-      201,    0,  200,  201,    3,    2,    6,    0,  201,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    1,  208,
+      208,    0,  207,  208,    3,    2,    6,    0,  208,    0,
         0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
 
-      191,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  193,    0,    0,    0,
+      198,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  200,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    2,    0,    0,    0,    0,
-        0,    0,    0,    8,    0,    0,    0,    0,  161,    0,
+        0,    0,    0,    0,    0,    0,    2,    0,    0,    0,
+        0,    0,    0,    0,    8,    0,    0,    0,    0,  168,
 
-        0,  162,    0,    0,    0,    0,    0,    0,    0,    0,
-      192,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  169,    0,    0,    0,    0,    0,    0,    0,
+        0,  199,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  112,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  119,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
@@ -736,178 +736,185 @@ static const flex_int16_t yy_accept[1873] =
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  206,  204,    0,  203,  202,    0,    0,    0,    0,
-        0,    0,    0,  160,    0,    0,   28,    0,   27,    0,
-        0,  119,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   55,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  213,  211,    0,  210,  209,    0,
+        0,    0,    0,    0,    0,    0,  167,    0,    0,   28,
+        0,   27,    0,    0,  126,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   55,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  116,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  123,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  205,  202,    0,    0,
-        0,    0,    0,    0,    0,    0,   29,    0,    0,   31,
-        0,    0,    0,    0,    0,    0,    0,  120,    0,    0,
-        0,    0,    0,    0,    0,   97,    0,    0,    0,    0,
-        0,    0,    0,    0,  145,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   58,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  212,  209,    0,    0,    0,    0,    0,    0,
+        0,    0,   29,    0,    0,   31,    0,    0,    0,    0,
+        0,    0,    0,    0,  127,    0,    0,    0,    0,    0,
+        0,    0,  104,    0,    0,    0,    0,    0,    0,    0,
+        0,  152,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   58,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   96,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  106,    0,   59,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  103,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  113,
+        0,   59,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  140,    0,  165,   51,    0,   56,    0,
-        0,    0,    0,    0,    0,  187,   37,    0,   34,    0,
-       33,    0,    0,    0,  153,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  147,    0,  172,   51,    0,
+       56,    0,    0,    0,    0,    0,    0,  194,   37,    0,
+       34,    0,   33,    0,    0,    0,    0,  160,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  131,    0,    0,    0,    0,    0,
-        0,    0,    0,  164,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   53,    0,    0,   32,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  138,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  171,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       99,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  154,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  149,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    7,
+        0,    0,    0,   53,    0,    0,   32,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  106,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  161,    0,    0,    0,    0,    0,    0,    0,    0,
 
-       35,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  156,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    7,   35,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  118,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  125,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  133,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  130,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  101,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  140,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  137,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  109,
+        0,    0,    0,    0,    0,    0,  108,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  127,    0,    0,    0,    0,    0,    0,  108,    0,
+        0,    0,    0,  116,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  134,    0,    0,    0,    0,
+        0,    0,    0,  115,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  148,    0,    0,
+        0,    0,    0,  155,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  158,  128,    0,    0,    0,    0,    0,
-        0,    0,  132,   52,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  134,    0,   60,
 
+        0,    0,    0,  165,  135,    0,    0,    0,    0,    0,
+        0,    0,  139,   52,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  141,    0,
+       60,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   95,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  195,    0,    0,    0,    0,    0,  192,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   91,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  188,    0,    0,    0,    0,  185,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  115,
+
+        0,  122,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  154,    0,    0,    0,
+        0,    0,    0,   63,    0,    0,    0,    0,   75,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  147,    0,    0,    0,    0,    0,    0,   63,
+        0,   57,  107,    0,    0,    0,  151,    0,    0,    0,
+        0,   50,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      143,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   97,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   57,  100,    0,    0,    0,  144,    0,
-        0,    0,    0,   50,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  193,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  136,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  117,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  186,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  110,    0,
+        0,    0,    0,    0,    0,    0,   41,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   16,    0,
+        0,  166,   14,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  157,    0,    0,    0,    0,    0,    0,  142,    0,
+        0,    0,    0,   73,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  153,
+      170,    0,   40,    0,  162,    0,    0,    0,   74,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   41,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   16,    0,    0,  159,   14,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  150,    0,    0,
-        0,    0,    0,    0,  135,    0,    0,    0,    0,    0,
+        0,   20,    0,    0,    0,    0,  101,    0,    0,    0,
+        0,    0,  164,   54,    0,  109,    0,  191,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,  146,  163,    0,   40,    0,  155,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   20,    0,    0,    0,   94,    0,    0,
-        0,    0,    0,  157,   54,    0,  102,    0,  184,    0,
+        0,    0,    0,   86,    0,    0,    0,    0,    0,  132,
+      133,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      105,    0,    0,    0,    0,    0,    0,   64,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   82,    0,    0,    0,    0,    0,
-      125,  126,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   98,    0,    0,    0,    0,    0,    0,   64,    0,
+        0,    0,    0,  159,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  152,    0,    0,    0,    0,    0,
+        0,    0,  128,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  102,  124,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   83,
+        0,    0,    0,    0,    0,    0,   17,    0,   15,    0,
 
+      188,  187,    0,    0,    0,   69,    0,    0,    0,    0,
+        0,    0,   30,    0,  146,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  121,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   95,  117,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   79,    0,    0,
-        0,    0,    0,    0,   17,    0,   15,    0,  181,  180,
-        0,    0,    0,   69,    0,    0,    0,    0,    0,    0,
-       30,    0,  139,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  174,
-        0,  183,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  111,    0,  143,   43,    0,   61,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   19,
-        0,    0,    0,    0,    0,    0,    0,  113,   80,    0,
-        0,  151,    0,    0,    0,    0,    0,  142,    0,    0,
-        0,    0,    0,    0,    0,    0,  107,    0,  189,    0,
+        0,  181,    0,  190,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  118,    0,  150,   43,
+        0,   61,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   19,    0,   99,    0,    0,    0,    0,
+        0,    0,  120,   84,    0,    0,  158,    0,    0,    0,
+        0,    0,  149,    0,    0,    0,    0,    0,    0,    0,
+        0,  114,    0,  196,    0,    0,    0,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  105,    0,    0,    0,  166,
+      112,    0,    0,    0,  173,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   42,    0,    0,    0,    0,
+        0,    0,   42,    0,    0,    0,    0,   68,    0,    0,
+        0,    0,    0,  144,   47,    0,    0,    0,   70,  186,
+       38,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       12,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   45,    0,    0,   44,   76,    0,   18,    0,    0,
 
-       68,    0,    0,    0,    0,    0,  137,   47,    0,    0,
-        0,   70,  179,   38,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   12,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   45,    0,    0,   44,    0,   18,    0,
-        0,    0,   72,    0,    0,    0,    0,    0,  129,    0,
+        0,   72,    0,    0,    0,    0,    0,  136,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   76,    0,    0,
-        0,    0,   62,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  103,    0,    0,    0,    0,    0,  156,    0,
+        0,    0,    0,    0,    0,    0,   80,    0,    0,    0,
+        0,   62,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  110,    0,    0,    0,    0,    0,    0,  163,    0,
         0,    0,   46,    0,    0,    0,    0,    0,    0,    0,
-
-        0,  175,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   67,    0,    0,    0,   93,    0,    0,    0,
+        0,  182,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   67,    0,    0,    0,  100,    0,    0,    0,
         0,   36,    0,   48,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   24,    0,    0,
-        0,    0,    0,    0,    0,  172,    0,    0,    0,    0,
-      141,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  114,    0,    0,    0,  177,    0,    0,    0,    0,
-        0,    0,    0,    0,   85,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   25,   39,    0,    0,    0,    0,
-        0,    0,    0,    0,  178,    0,   13,    0,    0,    0,
-
+        0,    0,    0,    0,    0,    0,    0,   98,   24,    0,
+
+        0,    0,    0,    0,    0,    0,  179,    0,    0,    0,
+        0,  148,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  121,    0,    0,    0,  184,    0,    0,    0,
+        0,    0,    0,    0,    0,   89,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   25,   39,    0,    0,    0,
+        0,    0,    0,    0,    0,  185,    0,   13,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  182,    0,    0,    0,    0,    0,
-        0,    0,    0,  171,    0,   78,    0,   77,    0,   21,
-       73,    0,    0,    0,    0,    0,   65,    0,    0,    0,
-      124,    0,    0,    0,    0,    0,    0,    0,    0,  104,
-        0,    0,  170,    0,    0,    0,   71,    0,    0,    0,
-       66,    0,   23,    0,    0,   92,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  189,    0,    0,    0,    0,
+        0,    0,    0,    0,  178,    0,   82,    0,   81,    0,
+       21,   77,    0,    0,    0,    0,    0,   65,    0,    0,
+
+        0,  131,    0,    0,    0,    0,    0,    0,    0,    0,
+      111,    0,    0,  177,    0,    0,    0,   71,    0,    0,
+        0,   66,    0,   23,    0,    0,   96,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   89,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   93,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,   49,    0,    0,
-       90,    0,    0,  176,    0,    0,    0,    0,   75,   74,
-       22,    0,  122,  138,    0,    0,    0,   86,    0,    0,
-        0,    0,    0,    0,  168,    0,  173,    0,   88,   81,
-        0,    0,    0,    0,    0,    0,  167,    0,    0,   26,
-        0,    0,    0,    0,    0,    0,    0,   87,    0,    0,
-        0,    0,    0,  123,   84,    0,    0,    0,    0,   83,
-      169,    0
+        0,    0,    0,    0,    0,    0,    0,    0,   49,    0,
+        0,   94,    0,    0,  183,    0,    0,    0,    0,   79,
+       78,   22,    0,  129,  145,    0,    0,    0,   90,    0,
+        0,    0,    0,    0,    0,  175,    0,  180,    0,   92,
+
+       85,    0,    0,    0,    0,    0,    0,  174,    0,    0,
+       26,    0,    0,    0,    0,    0,    0,    0,   91,    0,
+        0,    0,    0,    0,  130,   88,    0,    0,    0,    0,
+       87,  176,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -944,718 +951,788 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[74] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    5,    5,    5,    5,    5,    5,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    5,    5,    5,    5,    5,
-        5,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1885] =
+static const flex_int16_t yy_base[1934] =
     {   0,
-        0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     2274, 2275,   34, 2270,  145,    0,  207, 2275,  214,  221,
-       13,  228, 2275, 2250,  118,   25,    2,    6, 2275, 2275,
-       73,   11,   17, 2275, 2275, 2275,  104, 2258, 2211,    0,
-     2248,  108, 2265,   24,  256, 2275,   67, 2207, 2213, 2233,
-       84,   75,  189,   88,  226,   91,   89,  284,  196,  206,
-      279,  191,  210,  197,   60,  216, 2214,  241,  288,  309,
-      301,  315, 2197,  212,  320,  367,  320, 2216,    0,  373,
-      381,  395,  424,  429, 2275,    0, 2275,  410,  443,  241,
-      242,  306,  269,  299,  310, 2275, 2213, 2254, 2275,  297,
-
-     2275,  442,  337, 2200, 2210, 2251,  306,   10,  395, 2204,
-      355,  373,  397,  415,  324, 2249,    0,  495,  410, 2191,
-      219, 2199,  413, 2195, 2184, 2185, 2190,  418, 2200, 2183,
-     2192,  368,  416,  219, 2186, 2184,  423, 2173, 2231,  423,
-     2176, 2229, 2169, 2192, 2189, 2189, 2183,  421, 2176, 2174,
-     2175, 2167, 2172, 2166,  414, 2177, 2170, 2161, 2160, 2174,
-      434, 2212, 2159,  428, 2171,  450, 2159,  491, 2160,  465,
-     2172, 2169, 2170,  293, 2168, 2203, 2202,  434, 2148, 2148,
-     2152, 2148, 2140, 2157, 2149,    0,  450,  472,  467,  470,
-      473,  499, 2148, 2275,    0,  508, 2139, 2142, 2275,  497,
-
-      503, 2275, 2196, 2149,  509, 2194,  513, 2193,  515, 2192,
-     2275,  561, 2191,  534, 2150, 2147, 2148, 2143, 2142, 2133,
-      505, 2184, 2178, 2142, 2123, 2120, 2128, 2134, 2122, 2136,
-     2132, 2133, 2133, 2128, 2120, 2122, 2106, 2110, 2123, 2125,
-     2122, 2114, 2104, 2107, 2121, 2275, 2107, 2115, 2118, 2099,
-     2098, 2150, 2097, 2107, 2147,  504, 2106, 2145, 2090, 2092,
-     2103, 2141,  531, 2145, 2080, 2095,  505, 2085, 2091, 2100,
-     2081, 2079, 2082, 2078, 2084, 2075, 2074, 2087, 2080, 2070,
-     2081, 2085, 2084, 2078,  533, 2085, 2080, 2072, 2062, 2077,
-     2072, 2076,  506, 2074, 2060, 2066, 2073, 2055, 2056, 2059,
-
-     2056, 2055,  561, 2050, 2064, 2063, 2062, 2065, 2047, 2055,
-      555, 2275, 2275,  556, 2275, 2275, 2042,    0,  524, 2044,
-      574,  568, 2100, 2275, 2051,  561, 2275, 2098, 2275, 2092,
-      611, 2275,  560, 2032, 2035, 2052, 2040, 2092, 2047, 2042,
-     2045, 2040,   80, 2275, 2042,  591, 2081, 2039, 2036, 2037,
-      587, 2041, 2081, 2029, 2024, 2021, 2017, 2019, 2070, 2027,
-     2016, 2032, 2066, 2012,  608, 2025, 2025, 2008, 2009, 2022,
-     2009, 2019, 2014, 2021, 2016, 2001,  554, 2010, 2013, 2008,
-      579, 2007, 2003, 2053,  552,  585, 2275, 2047, 1997, 1996,
-     1989, 1991, 2003, 1994, 1983, 2000, 1989, 1994,  616, 2041,
-
-     1994,  591, 1991, 1994, 1994, 1992, 1981, 1981, 1993,  584,
-     1968, 1969, 1990,  599, 1972, 1969, 1983, 1986, 1981, 1967,
-     1979, 1978, 1977, 1972, 1975, 1974, 1973, 1972,  595, 2015,
-     1974, 2013, 2012, 1954,  644, 1967, 2275, 2275, 1966,    0,
-      606, 1954, 2007, 2006, 1962, 2004, 2275, 1950, 2002, 2275,
-      631,  679,  620, 2001, 1949, 1951, 1939, 2275, 1944, 1950,
-     1953, 1936, 1951, 1938, 1937, 2275, 1947,  614, 1938, 1935,
-     1947,  582, 1932, 1934, 2275, 1940, 1925, 1927, 1938, 1936,
-     1931,  658, 1938, 1926, 1919, 1970, 2275, 1917, 1933, 1967,
-     1971, 1927, 1921, 1923, 1924, 1926, 1960, 1911, 1906, 1905,
-
-     1907, 1903, 1899,  573, 1918, 1892, 1899, 1904, 1897, 1913,
-     1947, 1951, 2275, 1896, 1892, 1948, 1899, 1893, 1900, 1885,
-     1895, 1883, 1897, 1886, 1882, 1884, 1879, 2275, 1936, 2275,
-     1878, 1877, 1870, 1887, 1926, 1925, 1870, 1875, 1884, 1878,
-     1872, 1881,  662, 1918, 1880, 1863, 1863, 1858, 1854, 1860,
-     1865, 1858, 1866, 1870, 1853, 1911, 1852, 1904, 1849, 1850,
-     1849, 1861, 1850, 2275, 1860, 2275, 2275, 1849, 2275, 1859,
-     1895, 1855,    0, 1898, 1846, 2275, 2275, 1843, 2275, 1849,
-     2275,  619,  636,  675, 2275, 1854, 1834, 1887, 1832, 1885,
-     1830, 1829, 1828, 1835, 1828, 1836, 1839, 1821, 1821, 1836,
-
-     1835, 1834, 1833, 1817, 1832, 1814, 1861, 1828, 1866, 1810,
-     1812, 1824, 1824, 1823, 2275, 1808, 1805, 1863, 1818, 1810,
-     1816, 1807, 1815, 2275, 1800, 1811, 1815, 1797, 1811,  370,
-     1793, 1787, 1792, 1789, 1804, 1803, 1804, 1783, 1793, 1799,
-     1842, 1797, 1796, 1788, 1779, 2275, 1780, 1782, 2275, 1790,
-     1829, 1828,   16, 1789, 1826, 1771, 1772, 1775, 1776, 1767,
-     2275, 1781, 1767,  702, 1759, 1763, 1779, 1776, 1768, 1813,
-     1765, 1772, 1810, 2275, 1756, 1754, 1768, 1752, 1766, 1769,
-     1803, 1802, 1801, 1800, 1745, 1798, 1797, 2275, 1742, 1756,
-      669, 1757, 1756, 1753, 1753, 1790, 1750, 1739, 1741, 2275,
-
-     2275, 1786, 1732, 1789,  645,  661, 1730, 1728, 1722, 1743,
-     1784,  666, 1778, 1738, 1776, 1775, 1727, 1721, 1724, 1732,
-     1735, 1719, 1720, 1711, 1766, 1726,   82,  291,  360,  354,
-      654,  395,  400,  421,  473,  519,  477,  501, 2275,  551,
-      578,  619,  635,  643,  641,  644,  652,  651,  659,  665,
-      673,  671,  716,  717,  661,  680,  666,  676,  723,  681,
-      731, 2275,  732,  688,  686,  688,  684,  678,  733,  696,
-      685, 2275,  687,  698,  687,  700,  702,  747,  690,  749,
-      692,  707, 2275,  701,  695,  706,  691,  702,  715,  694,
-      700,  755,  719,  703,  703,  716,  760,  761,  762,  709,
-
-      727,  722,  729,  724,  709,  721,  722,  728,  715, 2275,
-      780,  738,  740,  730,  742,  732,  745,  736,  742,  751,
-      792, 2275,  788,  764,  751,  752,  797,  747, 2275,  745,
-      760,  757,  743,  750,  749,  747,  766,  763,  764,  752,
-      759,  760,  769,  769,  759,  772,  758,  757,  763,  819,
-      760,  761,  768,  784,  767,  821,  776, 2275,  786,  786,
-      779,  790,  788,  833,  775,  777,  792,  793,  781,  840,
-      797,  783,  786, 2275, 2275,  802,  801,  802,  807,  795,
-      805,  807, 2275, 2275,  807,  809,  796,  814,  801,  799,
-      817,  804,  804,  855,  802,  806,  864, 2275,  865, 2275,
-
-      810,  824,  824,  869,  817,  816,  820,  814,  874,  827,
-      817,  818,  814,  824,  828,  839,  823,  841,  836,  838,
-      831,  833,  834,  846,  836,  851,  892,  849,  854,  831,
-      854,  838, 2275,  845,  846,  860,  851,  849,  899,  846,
-      861,  861, 2275,  880,  888,  857,  906, 2275,  872,  860,
-      855,  856,  868,  875,  864,  865,  861,  879,  865,  866,
-      876,  885,  921,  876,  871,  924,  930,  887,  879, 2275,
-      883,  892,  894,  879,  895,  885,  897,  891,  938,  904,
-      888,  889, 2275,  905,  908,  891,  893,  951,  894, 2275,
-      911,  914,  894,  913,  901,  954,  912,  908,  905,  958,
-
-      907,  960,  922,  908,  926,  925,  911,  926,  918,  914,
-      932,  931,  918, 2275, 2275,  926,  973,  926, 2275,  934,
-      937,  930,  983, 2275,  932,  938,  982,  933,  934,  946,
-      940,  944,  942,  940,  951,  996,  940,  945,  999, 1000,
-      944,  956, 2275,  944,  952,  950, 1001,  963,  949,  951,
-      960,  972,  959,  957,  971,  972,  973,  989,  994,  976,
-      962,  964,  964,  984,  983,  974,  963,  980,  987, 1030,
-      972,  992,  985,  989,  993,  976, 1037,  984,  988, 2275,
-     1035,  984,  983,  983, 1004, 1001, 1043,  992, 1010, 1011,
-      997, 1005, 1014,  994, 1009, 1016, 1058, 1059, 2275, 1012,
-
-     1061, 1062, 1013, 1023, 1025, 1009, 1011, 1011, 1018, 1027,
-     1015, 1022, 1017, 1024, 1036, 1077, 1024, 1023, 1040, 1081,
-     1031, 1035, 1033, 1031, 1026, 1087, 1088, 1038, 1090, 1086,
-     1092, 1045, 2275, 1050, 1043, 1034, 1053, 1047, 1042, 1052,
-     1049, 1054, 1050, 1062, 2275, 1046, 1049, 2275, 2275, 1049,
-     1109, 1048, 1067, 1068, 1070, 1061, 1115, 1116, 1069, 1054,
-     1068, 1076, 1058, 1063, 1070, 1103, 1094, 1126, 1083, 1070,
-     1072, 1089, 1084, 1088, 1133, 1081, 1085, 2275, 1082, 1078,
-     1095, 1075, 1096, 1086, 2275, 1101, 1099, 1102, 1086, 1098,
-     1104, 1090, 1150, 1103, 1108, 1096, 1107, 1099, 1105, 1101,
-
-     1119, 1120, 1121, 2275, 2275, 1119, 2275, 1121, 2275, 1106,
-     1107, 1126, 1116, 1168, 1125, 1122, 1166, 1130, 1119, 1126,
-     1131, 1128, 1134, 2275, 1127, 1119, 1180, 2275, 1181, 1128,
-     1135, 1179, 1141, 2275, 2275, 1138, 2275, 1129, 2275, 1129,
-     1132, 1146, 1151, 1134, 1145, 1194, 1151, 1152, 1153, 1193,
-     1149, 1200, 1153, 1202, 2275, 1149, 1204, 1205, 1162, 1164,
-     2275, 2275, 1147, 1209, 1205, 1169, 1153, 1165, 1155, 1185,
-     1216, 2275, 1173, 1218, 1165, 1180, 1216, 1168, 2275, 1164,
-     1180, 1168, 1182, 1183, 1180, 1224, 1187, 1191, 1179, 1179,
-     1234, 1230, 1236, 1193, 2275, 1195, 1194, 1196, 1189, 1198,
-
-     1200, 1197, 1187, 1190, 1190, 1249, 1196, 1252, 1253, 1196,
-     1255, 2275, 1213, 1192, 1207, 1200, 1203, 1216, 1220, 1219,
-     1217, 1267, 1220, 2275, 2275, 1216, 1226, 1211, 1267, 1228,
-     1214, 1275, 1276, 1220, 1230, 1279, 1236, 2275, 1228, 1228,
-     1230, 1232, 1285, 1228, 2275, 1229, 2275, 1231, 2275, 2275,
-     1244, 1246, 1247, 2275, 1234, 1242, 1294, 1243, 1296, 1276,
-     2275, 1293, 2275, 1241, 1249, 1243, 1240, 1243, 1246, 1246,
-     1242, 1264, 1303, 1256, 1268, 1271, 1253, 1313, 1261, 2275,
-     1256, 2275, 1258, 1317, 1270, 1261, 1277, 1277, 1280, 1280,
-     1277, 1321, 1283, 2275, 1275, 2275, 2275, 1285, 2275, 1325,
-
-     1287, 1288, 1285, 1329, 1277, 1292, 1332, 1294, 1286, 2275,
-     1283, 1283, 1289, 1288, 1286, 1301, 1301, 2275, 2275, 1342,
-     1289, 2275, 1306, 1291, 1291, 1293, 1299, 2275, 1354, 1296,
-     1306, 1317, 1315, 1359, 1312, 1321, 2275, 1318, 2275, 1337,
-     1305, 1365, 1366, 1323, 1328, 1310, 1370, 1371, 1372, 1368,
-     1332, 1329, 1325, 1318, 1330, 2275, 1320, 1333, 1381, 2275,
-     1319, 1378, 1341, 1338, 1382, 1330, 1335, 1334, 1393, 1349,
-     1395, 1345, 1397, 1358, 1347, 1341, 1401, 1343, 1352, 1345,
-     1359, 1362, 1407, 1349, 1366, 1362, 1352, 1367, 1351, 1409,
-     1410, 1411, 1358, 1413, 1376, 2275, 1376, 1363, 1362, 1418,
-
-     2275, 1359, 1377, 1426, 1396, 1380, 2275, 2275, 1371, 1382,
-     1431, 2275, 2275, 2275, 1377, 1382, 1380, 1430, 1388, 1393,
-     1384, 1382, 1383, 2275, 1441, 1387, 1438, 1381, 1386, 1447,
-     1395, 1405, 1406, 2275, 1452, 1405, 2275, 1406, 2275, 1398,
-     1413, 1401, 2275, 1411, 1412, 1413, 1462, 1420, 2275, 1459,
-     1425, 1401, 1419, 1420, 1429, 1411, 1417, 1419, 1473, 1432,
-     1431, 1423, 1477, 1427, 1431, 1436, 1429, 2275, 1482, 1431,
-     1484, 1426, 2275, 1429, 1439, 1483, 1431, 1446, 1433, 1439,
-     1439, 1450, 2275, 1444, 1439, 1438, 1498, 1451, 2275, 1495,
-     1446, 1443, 2275, 1457, 1459, 1461, 1506, 1459, 1456, 1464,
-
-     1458, 2275, 1511, 1452, 1454, 1470, 1463, 1453, 1469, 1470,
-     1464, 1480, 2275, 1470, 1522, 1481, 2275, 1465, 1472, 1526,
-     1522, 2275, 1484, 2275, 1524, 1486, 1487, 1472, 1473, 1481,
-     1535, 1531, 1486, 1498, 1495, 1486, 1493, 2275, 1490, 1495,
-     1493, 1545, 1546, 1503, 1490, 2275, 1505, 1506, 1507, 1508,
-     2275, 1498, 1510, 1555, 1512, 1557, 1499, 1507, 1501, 1509,
-     1522, 2275, 1499, 1559, 1520, 2275, 1524, 1509, 1509, 1524,
-     1517, 1516, 1527, 1514, 2275, 1519, 1575, 1533, 1524, 1536,
-     1527, 1536, 1538, 1542, 2275, 2275, 1524, 1584, 1527, 1586,
-     1528, 1588, 1546, 1590, 2275, 1591, 2275, 1587, 1549, 1546,
-
-     1551, 1538, 1597, 1540, 1545, 1536, 1601, 1554, 1555, 1545,
-     1562, 1561, 1602, 1564, 2275, 1561, 1610, 1567, 1568, 1613,
-     1570, 1573, 1568, 2275, 1617, 2275, 1570, 2275, 1579, 2275,
-     2275, 1561, 1621, 1568, 1623, 1566, 2275, 1585, 1626, 1585,
-     2275, 1576, 1566, 1625, 1591, 1584, 1580, 1577, 1582, 2275,
-     1578, 1580, 2275, 1585, 1595, 1588, 2275, 1589, 1583, 1595,
-     2275, 1591, 2275, 1601, 1594, 2275, 1596, 1604, 1649, 1590,
-     1592, 1589, 1613, 1606, 1609, 1598, 1652, 1599, 1607, 1616,
-     1617, 1618, 1611, 1606, 1607, 1611, 1623, 1668, 2275, 1614,
-     1626, 1671, 1620, 1619, 1674, 1627, 1614, 1629, 1634, 1679,
-
-     1680, 1681, 1638, 1683, 1684, 1634, 1628, 2275, 1644, 1688,
-     2275, 1645, 1647, 2275, 1638, 1652, 1648, 1641, 2275, 2275,
-     2275, 1695, 2275, 2275, 1652, 1697, 1658, 2275, 1699, 1700,
-     1655, 1654, 1655, 1645, 2275, 1700, 2275, 1647, 2275, 2275,
-     1707, 1649, 1665, 1710, 1671, 1668, 2275, 1709, 1658, 2275,
-     1670, 1663, 1718, 1660, 1662, 1677, 1662, 2275, 1675, 1724,
-     1725, 1673, 1675, 2275, 2275, 1669, 1685, 1730, 1731, 2275,
-     2275, 2275, 1737, 1742, 1747, 1752, 1757, 1762, 1767, 1770,
-     1744, 1749, 1751, 1764
+       74,    0,  220,    0,  888,    0,  769,    0,  811,    0,
+      223,    0,  737,  293,  147,  293,  733,    0,  974,  776,
+     1091,    0,    0,  347,  818,  793,  890,  983,    0,    0,
+      689,  746,  841,    0,    0,    0,    0,  906,  880,  439,
+      975,    0,    0,  582,  706,    0, 1001,  968,  990, 1241,
+      935, 1047, 1053, 1060,  857, 1070,  724,  830,  741,  761,
+      821, 1046,  809, 1050,  740,  681, 1227, 1005,  979, 1020,
+      771,  981, 1216, 1062,  749,  887, 1050, 1238,    0,    0,
+        0,    0,    0,    0,    0,  366,    0, 1036,    0, 1085,
+     1086, 1080, 1230, 1231, 1223,    0, 1243, 1286,    0,    0,
+
+        0,  818, 1080, 1234, 1246, 1290, 1090,  826,  974, 1245,
+     1083, 1090, 1087, 1093, 1099,  509,    0,  582, 1066, 1235,
+     1071, 1246,  791, 1244, 1235, 1238, 1246,  870, 1258, 1243,
+     1076, 1023, 1083, 1086, 1258, 1250, 1251, 1015, 1242, 1302,
+     1127, 1249, 1304, 1246, 1271, 1270, 1272, 1268, 1089, 1263,
+     1263, 1266, 1260, 1267, 1263, 1260, 1278, 1273, 1266, 1267,
+     1283,  907, 1323, 1272, 1013, 1286, 1095, 1276,  962, 1279,
+     1019, 1293, 1292, 1295, 1109, 1295, 1332, 1333, 1284, 1282,
+     1284, 1290, 1288, 1282, 1301, 1295,    0, 1099, 1107, 1130,
+     1289, 1297, 1305, 1299,    0,  655, 1136, 1292, 1297,    0,
+
+     1104, 1128,    0, 1353, 1308, 1134, 1355, 1135, 1356, 1133,
+        0,    0,  883, 1160, 1317, 1318, 1317, 1320, 1317, 1318,
+     1311,  983, 1364, 1360, 1326, 1309, 1308, 1318, 1326, 1316,
+     1332, 1330, 1334, 1334, 1336, 1333, 1327, 1331, 1317, 1323,
+     1338, 1339, 1343, 1342, 1336, 1328, 1333, 1349,    0, 1337,
+     1347, 1352, 1335, 1336, 1390, 1339, 1351, 1393,  824, 1354,
+     1395, 1342, 1346, 1359, 1399, 1361, 1406, 1343, 1360, 1156,
+     1352, 1360, 1371, 1354, 1354, 1359, 1357, 1365, 1358, 1359,
+     1374, 1369, 1361, 1374, 1380, 1381, 1377,  385, 1386, 1383,
+     1377, 1369, 1386, 1383, 1389, 1116, 1389, 1377, 1385, 1394,
+
+     1378, 1381, 1386, 1385, 1386, 1437, 1384, 1400, 1401, 1402,
+     1407, 1391, 1401, 1144,    0,    0, 1406,    0,    0, 1391,
+      898, 1131, 1395, 1063, 1146, 1453,    0, 1406, 1139,    0,
+     1455,    0, 1451,  936,    0, 1415, 1394, 1395, 1400, 1419,
+     1409, 1463, 1420, 1417, 1422, 1419,  805,    0, 1423, 1170,
+     1464, 1424, 1423, 1426, 1178, 1432, 1474, 1434, 1425, 1422,
+     1421, 1419, 1423, 1476, 1435, 1478, 1427, 1445, 1481, 1429,
+      879, 1444, 1446, 1431, 1434, 1449, 1438, 1450, 1006, 1455,
+     1452, 1439, 1000, 1450, 1455, 1452, 1130, 1453, 1451, 1503,
+     1127, 1447,    0, 1500, 1452, 1453, 1448, 1452, 1466, 1459,
+
+     1450, 1469, 1460, 1467,  930, 1516, 1471, 1125, 1470, 1475,
+     1477, 1477, 1468, 1470, 1484, 1127, 1461, 1464, 1487, 1149,
+     1471, 1470, 1486, 1491, 1488, 1476, 1490, 1491, 1492, 1489,
+     1494, 1495, 1496, 1497, 1148, 1542, 1503, 1544, 1545, 1489,
+     1187, 1504,    0,    0, 1505,  951, 1164, 1495, 1550, 1551,
+     1509, 1553,    0, 1501, 1555,    0,  961,  655, 1516, 1499,
+     1558, 1508, 1512, 1502,    0, 1509, 1517, 1522, 1507, 1524,
+     1513, 1514,    0, 1526,  800, 1519, 1518, 1532, 1156, 1519,
+     1523,    0, 1527, 1532, 1519, 1523, 1536, 1536, 1533, 1200,
+     1531, 1543, 1533, 1528, 1581,    0, 1530, 1548, 1584, 1590,
+
+     1548, 1544, 1548, 1551, 1555, 1591, 1543, 1545, 1545, 1543,
+     1544, 1545, 1549, 1547, 1545, 1159, 1566, 1542, 1551, 1558,
+     1553, 1571, 1607, 1613,    0, 1560, 1558, 1616, 1569, 1565,
+     1574, 1561, 1573, 1563, 1579, 1570, 1568, 1572, 1569,    0,
+     1628,    0, 1572, 1573, 1568, 1587, 1628, 1629, 1576, 1583,
+     1594, 1590, 1586, 1597, 1202, 1636, 1600, 1585, 1587, 1584,
+     1582, 1590, 1597, 1592, 1602, 1608, 1593, 1653, 1596, 1650,
+     1597, 1600, 1601, 1615, 1606,    0, 1618,    0,    0, 1609,
+        0, 1621, 1659, 1621,  989, 1666, 1616,    0,    0, 1615,
+        0, 1623,    0, 1177, 1177, 1611, 1666,    0, 1632, 1614,
+
+     1669, 1616, 1671, 1618, 1619, 1620, 1629, 1624, 1634, 1639,
+     1623, 1625, 1642, 1643, 1644, 1645, 1631, 1648, 1632, 1681,
+     1650, 1644, 1691, 1637, 1641, 1655, 1657, 1658,    0, 1645,
+     1659, 1645, 1705, 1662, 1656, 1664, 1657, 1667,    0, 1654,
+     1667, 1673, 1657, 1673, 1166, 1659, 1658, 1675, 1671, 1656,
+     1663, 1662, 1679, 1680, 1683, 1664, 1676, 1684, 1729, 1686,
+     1687, 1681, 1674,    0, 1677, 1681,    0, 1691, 1732, 1733,
+     1210, 1696, 1735, 1682, 1685, 1690, 1693, 1686,    0, 1702,
+     1690, 1079, 1684, 1690, 1708, 1707, 1701, 1748, 1702, 1711,
+     1751,    0, 1699, 1699, 1715, 1701, 1717, 1722, 1758, 1759,
+
+     1760, 1761, 1708, 1763, 1764,    0, 1711, 1727, 1215, 1730,
+     1731, 1730, 1732, 1771, 1733, 1724, 1728,    0,    0, 1775,
+     1723, 1782, 1185, 1196, 1729, 1726, 1726, 1722, 1745, 1788,
+     1043, 1784, 1746, 1786, 1787, 1741, 1737, 1742, 1752, 1757,
+     1743, 1746, 1739, 1796, 1758, 1750, 1760, 1800, 1763, 1759,
+     1035, 1757, 1761, 1767, 1806, 1812, 1769, 1774, 1771,    0,
+     1774, 1769, 1760, 1775, 1780, 1777, 1774, 1781, 1780, 1781,
+     1779, 1787, 1776, 1785, 1786, 1772, 1832, 1833, 1777, 1790,
+     1776, 1167, 1832, 1790, 1839,    0, 1840, 1796, 1794, 1796,
+     1792, 1786, 1841, 1180, 1792,    0, 1794, 1805, 1794, 1807,
+
+     1809, 1853, 1796, 1855, 1798, 1813,    0, 1807, 1801, 1812,
+     1797, 1808, 1821, 1800, 1806, 1861, 1825, 1809, 1809, 1822,
+     1866, 1867, 1868, 1815, 1833, 1171, 1834, 1041, 1813, 1825,
+     1171, 1831, 1817,    0, 1881, 1838, 1839, 1829, 1841, 1831,
+     1844, 1835, 1841, 1850, 1891,    0, 1887, 1195, 1836, 1850,
+     1851, 1896, 1846,    0, 1844, 1859, 1856, 1842, 1849, 1848,
+     1846, 1865, 1862, 1863, 1851, 1858, 1859, 1868, 1868, 1858,
+     1871, 1857, 1856, 1862, 1918, 1860, 1860, 1861, 1867, 1883,
+     1866, 1920, 1875,    0, 1885, 1870, 1886, 1879, 1890, 1888,
+     1228, 1874, 1876, 1891, 1892, 1879, 1938, 1895, 1881, 1901,
+
+     1885, 1943, 1900,    0,    0, 1903, 1902, 1903, 1908, 1896,
+     1906, 1908,    0,    0, 1908, 1910, 1897, 1915, 1902, 1900,
+     1901, 1192, 1905, 1905, 1956, 1902, 1906, 1964,    0, 1965,
+        0, 1910, 1924, 1924, 1969, 1917, 1916, 1920, 1914, 1974,
+     1927, 1917, 1918, 1914, 1924, 1928, 1939, 1923, 1941, 1936,
+     1938, 1931, 1933, 1934, 1186, 1935, 1950, 1991, 1948, 1953,
+     1930, 1953, 1937,    0, 1944, 1945, 1959, 1949, 1947, 1997,
+     1944, 1959, 1959,    0, 1207, 1216, 2006, 1954, 2003,    0,
+     1969, 1957, 1952, 1953, 1965, 1972, 1961, 1962, 1958, 1976,
+     1962, 1963, 1973, 1982, 2018, 1973, 1968, 2021, 2027, 1984,
+
+     1975,    0, 1966, 1980, 1988, 1990, 1975, 1991, 1981, 1993,
+     1987, 1995, 2035, 2001, 1985, 1986,    0, 2002, 2005, 1988,
+     1990, 1092, 1990,    0, 2007, 2010, 1992, 1991,    0, 2048,
+     2010, 1998, 2051, 2009, 2005, 2002, 2055, 2004, 2057, 2019,
+     2005, 2023, 2022, 2023, 2009, 2024, 2016, 2012, 1197, 2028,
+     2015,    0,    0, 2023, 2070, 2023,    0, 2031, 2034, 2027,
+     2080,    0, 2029, 2034, 2078, 2029, 2030, 2042, 2036, 2040,
+     2038, 2036, 2047, 2092, 2036, 2041, 2095, 2096, 2040, 2052,
+        0, 2040, 2048, 2046, 2097, 2059, 2045, 2046, 2055, 2067,
+     2054, 2052, 2066, 2067, 2068, 1209, 1216,    0, 2070, 2055,
+
+     2057, 2057, 2077, 2076, 2067, 2056, 2073, 2080, 2123, 2065,
+     2085, 2078, 2082, 2086, 2069, 2130, 2077, 2081,    0, 2128,
+     2077, 2135, 2077, 2077, 2098, 2095, 2135, 2084, 2102, 2103,
+     2139, 2090, 2098, 2107, 2087, 2102, 2109, 2151, 2152,    0,
+     2105, 1243, 1245, 2104, 2114, 2156, 2117, 2101, 2101, 2103,
+     2103, 2110, 2119, 2107, 2114, 2109, 2116, 2128, 2169, 2116,
+     2115, 2119, 2133, 2174, 2124, 2128, 2126, 2124, 2119, 2180,
+     2181, 2131, 2183, 2179, 2185, 2138,    0, 2143, 2136, 2127,
+     2146, 2140, 2135, 2145, 2142, 2147, 2143, 2155,    0, 2139,
+     2141,    0,    0, 2141, 2201, 2140, 2159, 2160, 2162, 2153,
+
+     2207, 2208, 2161, 2146, 2160, 2168, 2150, 2155, 2162, 1226,
+     1215, 2216, 2173, 2160, 2162, 2179, 2174, 2178, 2223, 2171,
+     2175,    0, 2172, 2168, 2185, 2165, 2186, 2176,    0, 2191,
+     2189, 2192, 2176,    0, 2188, 2193, 2179, 2239, 2192, 2197,
+     2184, 2195, 2196, 2188, 2194, 2190, 2208, 2209, 2210,    0,
+        0, 2208,    0, 2210,    0, 2195, 2196, 2215,    0, 2205,
+     2217, 2258, 2215, 2212, 2256, 2220, 2209, 2216, 2221, 2218,
+     2224,    0, 2217, 2209, 2230, 2271,    0, 2272, 2219, 2226,
+     2270, 2232,    0,    0, 2229,    0, 2220,    0, 2220, 2223,
+     2237, 2242, 2225, 2236, 2285, 2242, 2243, 2244, 1246, 2239,
+
+     2290, 2243, 2292,    0, 2239, 2294, 2295, 2252, 2254,    0,
+        0, 2237, 2299, 2295, 2259, 2243, 2255, 2245, 1222, 2305,
+        0, 2262, 1254, 2253, 2268, 2304, 2256,    0, 2252, 2268,
+     2256, 2270, 2271, 2268, 2312, 2275, 2279, 2267, 2267, 2322,
+     2318, 2324, 2281,    0, 2283, 2282, 2284, 2277, 2277, 2287,
+     2288, 2285, 2275, 2278, 2278, 2337, 2284, 2339, 2340, 2283,
+     2342, 2284,    0, 2301, 2280, 1204, 2287, 2290, 2303, 2306,
+     2305, 2303, 2352, 2305, 2354,    0,    0, 2302, 2312, 2297,
+     2353, 2314, 2300, 2361, 2362, 2306, 2316, 2365, 2322,    0,
+     2314, 2314, 2316, 2318, 2371, 2314,    0, 2315,    0, 2317,
+
+        0,    0, 2330, 2332, 2333,    0, 2320, 2328, 2380, 2329,
+     2382, 1235,    0, 2378,    0, 2326, 2334, 2328, 2325, 2328,
+     2331, 2331, 2327, 2349, 2388, 2341, 2353, 2356, 2338, 2398,
+     2346,    0, 2341,    0, 2343, 2402, 2355, 2346, 2361, 2363,
+     2362, 2365, 2365, 2362, 2406, 2368,    0, 2360,    0,    0,
+     2370,    0, 2371, 2411, 2373, 2374, 2371, 2415, 2363, 2378,
+     2418, 2380, 2372,    0, 2369,    0, 2369, 2375, 2374, 2372,
+     2387, 2387,    0,    0, 2428, 2375,    0, 2392, 2377, 2377,
+     2379, 2385,    0, 2440, 2382, 2392, 2403, 2401, 2445, 2398,
+     2407,    0, 2404,    0, 1231, 2390, 2450, 2451, 2408, 2413,
+
+     2395, 2455, 2456, 2457, 2453, 1219, 2413, 2409, 2402, 2414,
+        0, 2404, 2417, 2465,    0, 2403, 2462, 2425, 2425, 2422,
+     2466, 2414, 2419, 1201, 1264, 2429, 2475, 2476, 2426, 2478,
+     2439, 2428, 2422, 2482, 2424, 2433, 2426, 2440, 2443, 2488,
+     2430, 2447, 2443, 2433, 2448, 2432, 2490, 2491, 2492, 2439,
+     2494, 2457,    0, 2457, 2444, 2443, 2499,    0, 2440, 2458,
+     2507, 1234, 2460,    0,    0, 2451, 2462, 2511,    0,    0,
+        0, 2457, 2462, 2460, 2510, 2468, 2473, 2464, 2462, 2463,
+        0, 1268, 2466, 2517, 2460, 2461, 2466, 2526, 2474, 2484,
+     2485,    0, 2530, 2483,    0,    0, 2484,    0, 2475, 2490,
+
+     2478,    0, 2488, 2489, 2490, 2539, 2497,    0, 2536, 2502,
+     2478, 2496, 2497, 2506, 2488, 2494, 2496, 2550, 2509, 2508,
+     2500, 2554, 2504, 2508, 2513, 2506,    0, 2559, 2508, 2561,
+     2503,    0, 2506, 2516, 2560, 2508, 2523, 2510, 2516, 2516,
+     2527,    0, 2521, 2516, 2515, 2575, 2576, 2529,    0, 2573,
+     2524, 2521,    0, 2535, 2537, 2539, 2584, 2537, 2534, 2542,
+     2536,    0, 2589, 2530, 2532, 2548, 2541, 2531, 2547, 2548,
+     2542, 2558,    0, 2548, 2600, 2559,    0, 2543, 2550, 2604,
+     2600,    0, 2562,    0, 2602, 2564, 2565, 2550, 2551, 2559,
+     2613, 2609, 2564, 2576, 2573, 2564, 2571,    0,    0, 2568,
+
+     2573, 2571, 2623, 2624, 2581, 2568,    0, 2583, 2584, 2585,
+     2586,    0, 2576, 2588, 2633, 2590, 2635, 2577, 2585, 2579,
+     2587, 2600,    0, 2577, 2637, 2598,    0, 2602, 2587, 2587,
+     2602, 2595, 2594, 2605, 2592,    0, 2597, 2653, 2611, 2602,
+     2614, 2605, 2614, 2616, 2620,    0,    0, 2602, 2662, 2605,
+     2664, 2606, 2666, 2624, 2668,    0, 2669,    0, 2665, 2627,
+     2624, 2629, 2616, 2675, 2618, 2623, 2614, 2679, 2632, 2633,
+     2623, 2640, 2639, 2680, 2642,    0, 2639, 2688, 2645, 2646,
+     2691, 2648, 2651, 2646,    0, 2695,    0, 2648,    0, 2657,
+        0,    0, 2639, 2699, 2646, 2701, 2644,    0, 2663, 2704,
+
+     2663,    0, 2654, 2644, 2703, 2669, 2662, 2658, 2655, 2660,
+        0, 2656, 2658,    0, 2663, 2673, 2666,    0, 2667, 2661,
+     2673,    0, 2669,    0, 2679, 2672,    0, 2674, 2682, 2727,
+     2668, 2670, 2667, 2691, 2684, 2687, 2676, 2730, 2677, 2685,
+     2694, 2695, 2696, 2689, 2684, 2685, 2689, 2701, 2746,    0,
+     2692, 2704, 2749, 2698, 2697, 2752, 2705, 2692, 2707, 2712,
+     2757, 2758, 2759, 2716, 2761, 2762, 2712, 2706,    0, 2722,
+     2766,    0, 2723, 2725,    0, 2716, 2730, 2726, 2719,    0,
+        0,    0, 2773,    0,    0, 2730, 2775, 2736,    0, 2777,
+     2778, 2733, 2732, 2733, 2723,    0, 2778,    0, 2725,    0,
+
+        0, 2785, 2727, 2743, 2788, 1235, 2745,    0, 2785, 2734,
+        0, 2746, 2739, 2794, 2736, 2738, 2753, 2738,    0, 2751,
+     2800, 2801, 2749, 2751,    0,    0, 2745, 2761, 2806, 2807,
+        0,    0,    1
     } ;
 
-static const flex_int16_t yy_def[1885] =
+static const flex_int16_t yy_def[1934] =
     {   0,
-     1873, 1873, 1874, 1874, 1873, 1873, 1873, 1873, 1873, 1873,
-     1872, 1872, 1872, 1872, 1872, 1875, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1876,
-     1872, 1872, 1872, 1877,   15, 1872,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1878,   45,   45,
+     1933,    1,    1,    3,    7,    5,    1,    7,    7,    9,
+     1933, 1933, 1933, 1933, 1933, 1933,   20, 1933,   17, 1933,
+     1933,   19, 1933, 1933,   88, 1933, 1933, 1933, 1933, 1933,
+       26,   27,   28, 1933, 1933, 1933,   13, 1933, 1933, 1933,
+     1933,   13,   14,  585,   15, 1933,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,  458,   47,   45,
+       45,   45,   51,   45,   45,   45,   45,   45,   45,   54,
+       45,   45,   45,   45,   45,   55,   56,   45,   16,   20,
+       17,   25,   19,   20, 1933, 1933, 1933, 1933,   88, 1933,
+     1933, 1933,   90,   91,   92, 1933, 1933,   40, 1933,   44,
+
+     1933, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933,   45,  458,  103,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1875, 1872,
-     1872, 1872, 1872, 1872, 1872, 1879, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1876, 1872, 1877,
-
-     1872, 1872,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1880,   45, 1878,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,  111,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  112,   45,
+       45,   45,   45,   45,   45,   45,   86, 1933, 1933, 1933,
+      188,  189,  190, 1933, 1933, 1933,   45,   45,   45, 1933,
+
+       45,   45, 1933,   45,   45,   45,   45,   45,   45,   45,
+      116, 1933,  458,   45,  197,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1879, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1881,   45,   45,   45, 1872,   45,
-
-       45, 1872,   45,   45,   45,   45,   45,   45,   45, 1880,
-     1872, 1878,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,  206,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1872,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,  207,   45,   45,   45,   45,
+       45,   45,   45, 1933, 1933, 1933,  314, 1933, 1933, 1933,
+     1933,   45,   45,   45,   45,   45, 1933,   45,   45, 1933,
+       45, 1933,   45,  458, 1933,   45,  322,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1933,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,  329, 1933,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1882,   45,   45,
-       45,   45,   45, 1872,   45,   45, 1872,   45, 1872,   45,
-     1878, 1872,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1872,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1933, 1933, 1933, 1933,   45,   45,   45,   45,
+       45,   45, 1933,   45,   45, 1933,   45,   45,   45,  447,
+       45,   45,   45,   45, 1933,   45,   45,   45,   45,   45,
+       45,   45, 1933,   45,   45,   45,   45,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1933,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1933,
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1872, 1872, 1872, 1883,
-       45,   45,   45,   45,   45,   45, 1872,   45,   45, 1872,
-       45, 1878,   45,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45,   45,   45, 1872,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1872,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933,   45, 1933, 1933,   45,
+     1933,   45,   45, 1933, 1933,   45,   45, 1933, 1933,   45,
+     1933,   45, 1933,   45,   45,   45,  586, 1933,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45, 1872,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45, 1872, 1872,   45, 1872,   45,
-       45, 1872, 1884,   45,   45, 1872, 1872,   45, 1872,   45,
-     1872,   45,   45,   45, 1872,   45,   45,   45,   45,   45,
+       45,   45,   45, 1933,   45,   45, 1933,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
 
+       45,   45,   45,   45,   45, 1933,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1933, 1933,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1933,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1872,   45,   45, 1872,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1872,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1872,
+       45,   45,   45,   45,   45, 1933,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933,   45,   45,   45,   45,
 
-     1872,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1933,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1872,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933,   45,   45,   45,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1872,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1872,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1872,
+       45,   45,   45, 1933, 1933,   45,   45,   45,   45,   45,
+       45,   45, 1933, 1933,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
+     1933,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1872,   45,   45,   45,   45,   45,   45, 1872,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45,   45, 1933,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872, 1872,   45,   45,   45,   45,   45,
-       45,   45, 1872, 1872,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45, 1872,
 
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1933,   45,   45,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45, 1933,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1933, 1933,   45,   45,   45, 1933,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1872,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45,   45, 1872,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1933,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1933,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872, 1872,   45,   45,   45, 1872,   45,
-       45,   45,   45, 1872,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1933,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1872,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1872,   45,
+       45,   45,   45,   45,   45,   45, 1933,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
+       45, 1933, 1933,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45,   45,   45, 1933,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1933,
+     1933,   45, 1933,   45, 1933,   45,   45,   45, 1933,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872,   45,   45, 1872, 1872,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45,   45, 1872,   45,   45,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45, 1933,   45,   45,   45,
+       45,   45, 1933, 1933,   45, 1933,   45, 1933,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45, 1872, 1872,   45, 1872,   45, 1872,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45, 1872, 1872,   45, 1872,   45, 1872,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45,   45, 1933,
+     1933,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1933,   45,   45,   45,   45,   45,   45, 1933,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872,   45,   45,   45,   45,   45,
-     1872, 1872,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1872,   45,   45,   45,   45,   45,   45, 1872,   45,
+       45,   45,   45, 1933,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872,   45,   45,   45,   45,   45,
+       45,   45, 1933,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933, 1933,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1933,
+       45,   45,   45,   45,   45,   45, 1933,   45, 1933,   45,
 
+     1933, 1933,   45,   45,   45, 1933,   45,   45,   45,   45,
+       45,   45, 1933,   45, 1933,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1872,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872, 1872,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45,   45, 1872,   45, 1872,   45, 1872, 1872,
-       45,   45,   45, 1872,   45,   45,   45,   45,   45,   45,
-     1872,   45, 1872,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1872,
-       45, 1872,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45, 1872, 1872,   45, 1872,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1872,
-       45,   45,   45,   45,   45,   45,   45, 1872, 1872,   45,
-       45, 1872,   45,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45,   45,   45,   45, 1872,   45, 1872,   45,
+       45, 1933,   45, 1933,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1933,   45, 1933, 1933,
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1933,   45, 1933,   45,   45,   45,   45,
+       45,   45, 1933, 1933,   45,   45, 1933,   45,   45,   45,
+       45,   45, 1933,   45,   45,   45,   45,   45,   45,   45,
+       45, 1933,   45, 1933,   45,   45,   45,   45,   45,   45,
+
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1872,   45,   45,   45, 1872,
+     1933,   45,   45,   45, 1933,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1872,   45,   45,   45,   45,
+       45,   45, 1933,   45,   45,   45,   45, 1933,   45,   45,
+       45,   45,   45, 1933, 1933,   45,   45,   45, 1933, 1933,
+     1933,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1933,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1933,   45,   45, 1933, 1933,   45, 1933,   45,   45,
 
-     1872,   45,   45,   45,   45,   45, 1872, 1872,   45,   45,
-       45, 1872, 1872, 1872,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45,   45, 1872,   45, 1872,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45, 1872,   45,
+       45, 1933,   45,   45,   45,   45,   45, 1933,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45, 1872,   45,
-       45,   45, 1872,   45,   45,   45,   45,   45,   45,   45,
-
-       45, 1872,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1872,   45,   45,   45, 1872,   45,   45,   45,
-       45, 1872,   45, 1872,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45,   45,   45, 1872,   45,   45,   45,   45,
-     1872,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1872,   45,   45,   45, 1872,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872, 1872,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872,   45, 1872,   45,   45,   45,
-
+       45,   45,   45,   45,   45,   45, 1933,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45,   45,   45, 1933,   45,
+       45,   45, 1933,   45,   45,   45,   45,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1933,   45,   45,   45, 1933,   45,   45,   45,
+       45, 1933,   45, 1933,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1933, 1933,   45,
+
+       45,   45,   45,   45,   45,   45, 1933,   45,   45,   45,
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1933,   45,   45,   45, 1933,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933, 1933,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933,   45, 1933,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1872,   45,   45,   45,   45,   45,
-       45,   45,   45, 1872,   45, 1872,   45, 1872,   45, 1872,
-     1872,   45,   45,   45,   45,   45, 1872,   45,   45,   45,
-     1872,   45,   45,   45,   45,   45,   45,   45,   45, 1872,
-       45,   45, 1872,   45,   45,   45, 1872,   45,   45,   45,
-     1872,   45, 1872,   45,   45, 1872,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1933,   45,   45,   45,   45,
+       45,   45,   45,   45, 1933,   45, 1933,   45, 1933,   45,
+     1933, 1933,   45,   45,   45,   45,   45, 1933,   45,   45,
+
+       45, 1933,   45,   45,   45,   45,   45,   45,   45,   45,
+     1933,   45,   45, 1933,   45,   45,   45, 1933,   45,   45,
+       45, 1933,   45, 1933,   45,   45, 1933,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1872,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1933,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1872,   45,   45,
-     1872,   45,   45, 1872,   45,   45,   45,   45, 1872, 1872,
-     1872,   45, 1872, 1872,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45,   45, 1872,   45, 1872,   45, 1872, 1872,
-       45,   45,   45,   45,   45,   45, 1872,   45,   45, 1872,
-       45,   45,   45,   45,   45,   45,   45, 1872,   45,   45,
-       45,   45,   45, 1872, 1872,   45,   45,   45,   45, 1872,
-     1872,    0, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872
+       45,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
+       45, 1933,   45,   45, 1933,   45,   45,   45,   45, 1933,
+     1933, 1933,   45, 1933, 1933,   45,   45,   45, 1933,   45,
+       45,   45,   45,   45,   45, 1933,   45, 1933,   45, 1933,
+
+     1933,   45,   45,   45,   45,   45,   45, 1933,   45,   45,
+     1933,   45,   45,   45,   45,   45,   45,   45, 1933,   45,
+       45,   45,   45,   45, 1933, 1933,   45,   45,   45,   45,
+     1933, 1933,    0
     } ;
 
-static const flex_int16_t yy_nxt[2349] =
+static const flex_int16_t yy_nxt[2881] =
     {   0,
-     1872,   13,   14,   13, 1872,   15,   16, 1872,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       85,  772,   37,   14,   37,   86,   25,   26,   38,  101,
-     1872,   27,   37,   14,   37,   42,   28,   42,   38,   91,
-       92,   29,  201,   30,   13,   14,   13,   90,   91,   25,
-       31,   92,   13,   14,   13,   13,   14,   13,   32,   40,
-      773,   13,   14,   13,   33,   40,  102,   91,   92,  201,
-       90,   34,   35,   13,   14,   13,   94,   15,   16,   95,
-       17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   90,   39,  103,   25,   26,
-
-       13,   14,   13,   27,   39,   42,  107,   42,   28,   42,
-      108,   42,   41,   29,  111,   30,  114,  115,   93,  137,
-       41,   25,   31,  103,  138,  463,   88,  139,   88,  107,
-       32,   89,   89,   89,   89,   89,   33,  111,  108,  114,
-      847,  115,  464,   34,   35,   44,   44,   44,   45,   45,
-       46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   47,   45,   48,
-       49,   50,   51,   45,   52,   53,   54,   45,   45,   45,
-       45,   55,   56,   45,   57,   45,   45,   58,   45,   45,
-       59,   45,   60,   61,   62,   63,   64,   65,   66,   52,
-
-       67,   68,   69,   70,   71,   72,   73,   74,   75,   76,
-       77,   78,   57,   45,   45,   45,   45,   45,   80,  109,
-       81,   81,   81,   81,   81,   80,  103,   83,   83,   83,
-       83,   83,  107,   82,   84,   84,   84,   84,   84,   80,
-       82,   83,   83,   83,   83,   83,  135,   82,  110,  132,
-      112,  121,  119,  136,   82,  107,   82,  167,  120,  133,
-      113,  168,  122,   82,  140,  123,  134,  124,  237,  125,
-       82,  187,  188,  112,  141,  216,  142,   82,   45,  217,
-       45,   45,   45,   45,  238,   45,   45,   45,  113,  117,
-      144,  145,   45,   45,  146,   45,   45,  187,  188,  187,
-
-      147,   45,  101,   45,   45,   45,   45,   45,   45,   45,
+       11, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933,   12,   13,   14,   13,   12,   15,
+       16,   12,   17,   18,   19,   20,   21,   22,   22,   22,
+       22,   22,   23,   24,   12,   12,   12,   12,   12,   12,
+
+       25,   26,   12,   12,   12,   27,   12,   12,   12,   12,
+       28,   12,   12,   12,   12,   29,   12,   30,   12,   12,
+       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
+       12,   12,   32,   12,   12,   12,   12,   12,   33,   12,
+       12,   12,   12,   12,   12,   34,   35,   44,   44,   44,
+       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
+       45,   48,   49,   50,   51,   45,   52,   53,   54,   45,
+       45,   45,   45,   55,   56,   45,   57,   45,   45,   58,
+       45,   45,   59,   45,   60,   61,   62,   63,   64,   65,
+
+       66,   52,   67,   68,   69,   70,   71,   72,   73,   74,
+       75,   76,   77,   78,   57,   45,   45,   45,   45,   45,
+       36,   37, 1933,   37,   36,   36,   36,   38,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   79,   79,   43,   79,   79,   79,   79,
+
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,  187,  187,   87,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
+      187,  187,  187,  187,  187,  187,  187,  187,  187,   98,
+       98,  415,   98,   98,  416,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,  211,  211,  212,  211,  211,  211,  211,  211,
+      211,  211,  211,  211,  211,  211,  211,  211,  211,  211,
+      211,  211,  211,  211,  211,  211,  211,  211,  211,  211,
+      211,  211,  211,  211,  211,  211,  211,  211,  211,  211,
+      211,  211,  211,  211,  211,  211,  211,  211,  211,  211,
+      211,  211,  211,  211,  211,  211,  211,  211,  211,  211,
+      211,  211,  211,  211,  211,  211,  211,  211,  211,  211,
+      211,  211,  100,  100,  100,  100,  100,  101,  100,  100,
+      100,  100,  100,  100,  100,  213,  213,  213,  213,  213,
+
+      100,  100,  100,  100,  213,  213,  213,  213,  213,  213,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  102,  100,  100,  213,  213,  213,
+      213,  213,  213,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  321,  321,
+      321,  321,  321,  116,  116,  116,  116,  321,  321,  321,
+      321,  321,  321,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+
+      321,  321,  321,  321,  321,  321,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,   45,  141,
+       45,   45,   45,   45,   93,   45,   45,   45,   42,  142,
+       42,  143,   45,   45,   80,   45,   81,   81,   81,   81,
+       81,   45,  115,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  126,  190,   45,  127,  128,  188,
-       45,  129,  130,  148,   45,  111,  200,  149,  298,  102,
-      848,  150,   45,  189,  131,  114,   45,  189,   45,  118,
-      209,  156,  299,  151,  153,  191,  154,  152,  155,  157,
-      161,  158,  200,  162,  163,  169,  159,  160,  114,  170,
-      849,  189,  171,  209,  164,  192,  196,  165,  183,  172,
-      173,  176,  177,  184,  174,  175,   84,   84,   84,   84,
-       84,  112,   80,  205,   81,   81,   81,   81,   81,   82,
-
-      202,  113,  850,   88,  196,   88,  206,   82,   89,   89,
-       89,   89,   89,  232,  178,  233,  179,  750,  751,  180,
-      181,  205,   82,   89,   89,   89,   89,   89,  246,  113,
-       82,  203,  234,  206,  207,   80,  182,   83,   83,   83,
-       83,   83,   84,   84,   84,   84,   84,  100,  208,  196,
-       82,  854,  205,  855,  100,   82,   89,   89,   89,   89,
-       89,  219,  207,  235,  226,  227,  213,  206,  255,  856,
-      220,  221,  247,   82,  228,  208,  236,  214,   82,  241,
-      263,  269,  242,  857,  100,  311,  243,  275,  100,  256,
-      276,  277,  100,  313,  303,  279,  270,  271,  272,  280,
-
-      100,  282,  312,  312,  100,  311,  100,  195,  212,  212,
-      212,  212,  212,  311,  377,  390,  313,  212,  212,  212,
-      212,  212,  212,  292,  858,  313,  859,  293,  312,  315,
-      319,  294,  322,  314,  323,  326,  283,  284,  285,  328,
-      212,  212,  212,  212,  212,  212,  330,  286,  316,  287,
-      860,  288,  289,  319,  290,  340,  319,  326,  326,  418,
-      322,  323,  328,  341,  441,  391,  327,  378,  342,  343,
-      379,  429,  419,  330,  331,  331,  331,  331,  331,  333,
-      386,  437,  437,  331,  331,  331,  331,  331,  331,  409,
-      443,  444,  410,  441,  446,  449,  466,  472,  861,  445,
-
-      441,  467,  514,  473,  437,  438,  331,  331,  331,  331,
-      331,  331,  515,  487,  502,  503,  504,  446,  488,  449,
-      505,  528,  637,  449,  452,  452,  452,  452,  452,  453,
-      605,  862,  638,  452,  452,  452,  452,  452,  452,  509,
-      532,  574,  541,  606,  533,  510,  542,  516,  546,  569,
-      562,  705,  547,  563,  570,  574,  452,  452,  452,  452,
-      452,  452,  582,  615,  583,  597,  489,  674,  616,  574,
-      706,  490,  675,  598,  810,  599,  600,  601,  705,  529,
-      701,  823,  863,  584,  864,  707,  811,  824,  865,  582,
-      866,  583,   45,   45,   45,   45,   45,  867,  706,  868,
-
-      869,   45,   45,   45,   45,   45,   45,  783,  870,  823,
-      824,  851,  784,  830,  831,  852,  832,  871,  872,  853,
-      873,  874,  875,  876,   45,   45,   45,   45,   45,   45,
-      877,  878,  879,  881,  882,  880,  883,  884,  885,  886,
+       45,   45,   45,   45,   40,   12,  115,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   84,
+       84,   84,   84,   84,  170,   12,   12,  119,  171,  138,
+
+       12,  172,   82,  120,  139,   12,  121,  140,  173,  174,
+       12,   94,   12,  175,  176,   90,   12,  122,   12,   12,
+      123,  157,  124,  100,  125,   82,   88,   12,   88,  158,
+      100,  159,   41,   12,  383,  117,  160,  161,   90,  220,
+       12,   12,   45,  116,  116,  116,  116,  116,  221,  222,
+      470,  610,  116,  116,  116,  116,  116,  116,  202,  611,
+      100,  612,  613,  614,  100,  134,  126,  471,  100,  127,
+      128,  135,   45,  129,  130,  116,  100,  116,  116,  116,
+      100,  112,  100,  196,  496,  202,  131,  384,   45,  497,
+      385,  113,   45,   12,   45,  118,  334,  334,  334,  334,
+
+      334,  177,  178,   95,  112,  334,  334,  334,  334,  334,
+      334,  446,  446,  446,  446,  446,  227,  228,   96,  113,
+      446,  446,  446,  446,  446,  446,  229,   91,  334,  334,
+      334,  334,  334,  334,  179,  540,  180,  498,   97,  181,
+      182,   39,  499,  446,  446,  446,  446,  446,  446,  458,
+      458,  458,  458,  458,  272,   91,  183,  107,  458,  458,
+      458,  458,  458,  458,  585,  585,  585,  585,  585,  273,
+      274,  275,  285,  585,  585,  585,  585,  585,  585,  203,
+      107,  458,  458,  458,  458,  458,  458,   83,   83,   83,
+       83,   83,  594,  541,  595,   99,  585,  585,  585,  585,
+
+      585,  585,  100,  100,  100,  100,  100,  286,  287,  288,
+      204,  100,  100,  100,  100,  100,  100,   92,  289,  594,
+      290,  595,  291,  292,  149,  293,  162,  104,  150,  163,
+      164,  103,  151,  344,  100,  100,  100,  100,  100,  100,
+      165,  345,  105,  166,  152,   92,  346,  347,  153,   89,
+       89,   89,   89,   89,  145,  146,  507,  103,  147,  508,
+      514,  515,  516,  509,  148,  154,  517,  155,  234,  156,
+      235,  244,  278,  510,  245,  279,  280,  295,  246,  449,
+      450,  296,  108,  109,  807,  297,  111,  236,  451,  808,
+      855,  856,  877,  857,  955,  114,  878, 1140,   85,  136,
+
+      879,  956, 1141,   86,  132,  957,  137,  168,  184,  111,
+      108,  169,  110,  185,  133,  188,  189,  190,  114,  197,
+      201,  206,  214,  207,  208,  210,  209,  217,  809,  232,
+      237,  218,  249,  215,  314,  239,  258,  315,  233,  325,
+      282,  188,  189,  238,  283,  190,  201,  197,  210,  206,
+      207,  240,  208,  209,  301, 1142,  316,  259,  322,  326,
+      329,  331,  314,  315,  333,  335,  396,  325,  302,  424,
+      443,  447,  452,  455,  544,  473,  250,  526,  545,  316,
+      474,  322,  425,  329,  331,  553,  326,  527,  479,  554,
+      521,  333,  581,  443,  480,  452,  522,  582,  558,  586,
+
+      447,  455,  559,  574,  618,  629,  575,  692,  655,  723,
+      630,  724,  693,  771,  772,  796,  397,  619,  656,  336,
+      834,  847,  848,  909,  952,  921,  910,  586,  922,  960,
+      976,  953,  835, 1017, 1077,  961,  723, 1045, 1018,  724,
+     1096, 1046, 1097, 1210, 1167,  848, 1078, 1211, 1253,  847,
+     1255, 1320, 1319, 1254,  797, 1168, 1394, 1412,  976, 1415,
+     1456, 1495, 1562, 1590, 1591, 1097, 1573, 1096, 1457, 1592,
+     1628, 1210,  106, 1642, 1211, 1319,  144, 1574, 1643, 1320,
+     1912,  167, 1913,  186, 1495, 1412,  191,  192,  193, 1562,
+      194,  195,  198,  199, 1256,  200,  205,  216, 1628,  219,
+
+      223,  224,  225, 1416,  226,  230,  231,  241,  242, 1395,
+      243,  247,  248,  251,  252,  253,  254,  255,  256,  257,
+      260,  261,  262,  263,  264,  265,  266, 1593,  267,  268,
+      269,  270,  271,  276,  277,  281,  284,  294,  298,  299,
+      300,  303,  304,  305,  306,  307,  308,  309,  310,  311,
+      312,  313,  317,  318,  319,  320,  323,  324,  327,  328,
+      330,  332,  337,  338,  339,  340,  341,  342,  343,  348,
+      349,  350,  351,  352,  353,  354,  355,  356,  357,  358,
+      359,  360,  361,  362,  363,  364,  365,  366,  367,  368,
+      369,  370,  371,  372,  373,  374,  375,  376,  377,  378,
+
+      379,  380,  381,  382,  386,  387,  388,  389,  390,  391,
+      392,  393,  394,  395,  398,  399,  400,  401,  402,  403,
+      404,  405,  406,  407,  408,  409,  410,  411,  412,  413,
+      414,  417,  418,  419,  420,  421,  422,  423,  426,  427,
+      428,  429,  430,  431,  432,  433,  434,  435,  436,  437,
+      438,  439,  440,  441,  442,  444,  445,  448,  453,  454,
+      456,  457,  459,  460,  461,  462,  463,  464,  465,  466,
+      467,  468,  469,  472,  475,  476,  477,  478,  481,  482,
+      483,  484,  485,  486,  487,  488,  489,  490,  491,  492,
+      493,  494,  495,  500,  501,  502,  503,  504,  505,  506,
+
+      511,  512,  513,  518,  519,  520,  523,  524,  525,  528,
+      529,  530,  531,  532,  533,  534,  535,  536,  537,  538,
+      539,  542,  543,  546,  547,  548,  549,  550,  551,  552,
+      555,  556,  557,  560,  561,  562,  563,  564,  565,  566,
+      567,  568,  569,  570,  571,  572,  573,  576,  577,  578,
+      579,  580,  583,  584,  587,  588,  589,  590,  591,  592,
+      593,  596,  597,  598,  599,  600,  601,  602,  603,  604,
+      605,  606,  607,  608,  609,  615,  616,  617,  620,  621,
+      622,  623,  624,  625,  626,  627,  628,  631,  632,  633,
+      634,  635,  636,  637,  638,  639,  640,  641,  642,  643,
+
+      644,  645,  646,  647,  648,  649,  650,  651,  652,  653,
+      654,  657,  658,  659,  660,  661,  662,  663,  664,  665,
+      666,  667,  668,  669,  670,  671,  672,  673,  674,  675,
+      676,  677,  678,  679,  680,  681,  682,  683,  684,  685,
+      686,  687,  688,  689,  690,  691,  694,  695,  696,  697,
+      698,  699,  700,  701,  702,  703,  704,  705,  706,  707,
+      708,  709,  710,  711,  712,  713,  714,  715,  716,  717,
+      718,  719,  720,  721,  722,  725,  726,  727,  728,  729,
+      730,  731,  732,  733,  734,  735,  736,  737,  738,  739,
+      740,  741,  742,  743,  744,  745,  746,  747,  748,  749,
+
+      750,  751,  752,  753,  754,  755,  756,  757,  758,  759,
+      760,  761,  762,  763,  764,  765,  766,  767,  768,  769,
+      770,  773,  774,  775,  776,  777,  778,  779,  780,  781,
+      782,  783,  784,  785,  786,  787,  788,  789,  790,  791,
+      792,  793,  794,  795,  798,  799,  800,  801,  802,  803,
+      804,  805,  806,  810,  811,  812,  813,  814,  815,  816,
+      817,  818,  819,  820,  821,  822,  823,  824,  825,  826,
+      827,  828,  829,  830,  831,  832,  833,  836,  837,  838,
+      839,  840,  841,  842,  843,  844,  845,  846,  849,  850,
+      851,  852,  853,  854,  858,  859,  860,  861,  862,  863,
+
+      864,  865,  866,  867,  868,  869,  870,  871,  872,  873,
+      874,  875,  876,  880,  881,  882,  883,  884,  885,  886,
       887,  888,  889,  890,  891,  892,  893,  894,  895,  896,
-      897,  785,  898,  899,  900,  901,  902,  903,  904,  905,
-      906,  907,  908,  909,  910,  911,  912,  913,  914,  915,
-      916,  917,  918,  919,  920,  921,  923,  924,  927,  928,
-      929,  931,  922,  932,  925,  933,  930,  934,  926,  935,
-      936,  937,  938,  939,  940,  941,  942,  943,  944,  945,
-
-      946,  947,  948,  949,  950,  951,  952,  953,  954,  955,
-      956,  957,  958,  959,  960,  961,  962,  963,  964,  965,
-      966,  967,  968,  969,  970,  971,  972,  945,  973,  974,
-      975,  976,  977,  978,  979,  980,  981,  982,  983,  985,
-      986,  987,  988,  984,  989,  990,  991,  992,  993,  994,
-      995,  996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004,
-     1005, 1006, 1007, 1009, 1010, 1011, 1008, 1012, 1013, 1014,
-     1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024,
-     1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-     1035, 1036, 1037, 1038, 1039, 1041, 1042, 1043, 1044, 1045,
-
-     1046, 1047, 1048, 1049, 1050, 1051, 1040, 1052, 1053, 1054,
-     1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
-     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
-     1075, 1076, 1077, 1078, 1079, 1080, 1081, 1059, 1082, 1083,
-     1058, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
-     1093, 1094, 1095, 1096, 1097, 1098, 1099, 1102, 1103, 1104,
-     1105, 1100, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
-     1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
-     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
-     1124, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143,
-
-     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
-     1154, 1155, 1156, 1157, 1101, 1158, 1159, 1160, 1161, 1162,
-     1163, 1164, 1165, 1166, 1168, 1167, 1169, 1170, 1171, 1172,
-     1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182,
-     1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
-     1193, 1166, 1167, 1194, 1195, 1196, 1197, 1198, 1199, 1200,
-     1201, 1202, 1203, 1204, 1205, 1206, 1207, 1209, 1211, 1212,
-     1213, 1208, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221,
-     1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
-     1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241,
-
-     1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251,
-     1252, 1210, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260,
-     1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270,
-     1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280,
-     1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290,
-     1291, 1292, 1270, 1293, 1294, 1295, 1296, 1297, 1271, 1298,
-     1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308,
-     1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318,
-     1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
-     1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
-
-     1339, 1340, 1341, 1342, 1344, 1345, 1346, 1347, 1348, 1349,
+      897,  898,  899,  900,  901,  902,  903,  904,  905,  906,
+      907,  908,  911,  912,  913,  914,  915,  916,  917,  918,
+      919,  920,  923,  924,  925,  926,  927,  928,  929,  930,
+      931,  932,  933,  934,  935,  936,  937,  938,  939,  940,
+      941,  942,  943,  944,  945,  946,  947,  948,  949,  950,
+      951,  954,  958,  959,  962,  963,  964,  965,  966,  967,
+      968,  969,  970,  971,  972,  973,  974,  975,  977,  978,
+
+      979,  980,  981,  982,  983,  984,  985,  986,  987,  988,
+      989,  990,  991,  992,  993,  994,  995,  996,  997,  998,
+      999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008,
+     1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1019, 1020,
+     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030,
+     1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
+     1041, 1042, 1043, 1044, 1047, 1048, 1049, 1050, 1051, 1052,
+     1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062,
+     1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072,
+     1073, 1074, 1075, 1076, 1079, 1080, 1081, 1082, 1083, 1084,
+
+     1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
+     1095, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
+     1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116,
+     1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
+     1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136,
+     1137, 1138, 1139, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+     1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159,
+     1160, 1161, 1162, 1163, 1164, 1165, 1166, 1169, 1170, 1171,
+     1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181,
+     1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191,
+
+     1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201,
+     1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1212, 1213,
+     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+     1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
+     1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1257,
+     1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+     1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277,
+     1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287,
+     1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297,
+
+     1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
+     1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
+     1318, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329,
+     1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+     1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
      1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
-     1360, 1361, 1362, 1363, 1365, 1366, 1367, 1368, 1369, 1370,
-     1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380,
-     1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1360, 1389,
-     1390, 1391, 1392, 1393, 1394, 1395, 1343, 1396, 1397, 1398,
-     1399, 1400, 1401, 1402, 1404, 1405, 1406, 1364, 1407, 1408,
-     1409, 1403, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417,
-     1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427,
-     1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437,
-
-     1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447,
-     1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457,
-     1458, 1459, 1460, 1461, 1462, 1440, 1463, 1464, 1465, 1466,
+     1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369,
+     1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379,
+     1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+     1390, 1391, 1392, 1393, 1396, 1397, 1398, 1399, 1400, 1401,
+
+     1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
+     1413, 1414, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+     1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
+     1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+     1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454,
+     1455, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466,
      1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476,
      1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486,
-     1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496,
-     1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506,
-     1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516,
-     1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527,
-     1517, 1528, 1529, 1530, 1531, 1505, 1532, 1533, 1534, 1536,
+     1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1496, 1497,
+     1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
 
-     1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
-     1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556,
-     1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566,
-     1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576,
-     1577, 1578, 1579, 1580, 1581, 1582, 1583, 1585, 1586, 1587,
-     1588, 1584, 1589, 1590, 1591, 1592, 1535, 1593, 1594, 1595,
-     1569, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
+     1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+     1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527,
+     1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537,
+     1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547,
+     1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557,
+     1558, 1559, 1560, 1561, 1563, 1564, 1565, 1566, 1567, 1568,
+     1569, 1570, 1571, 1572, 1575, 1576, 1577, 1578, 1579, 1580,
+     1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1594,
+     1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
      1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614,
+
      1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624,
-     1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634,
-
-     1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644,
-     1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654,
-     1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664,
-     1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674,
-     1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684,
-     1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694,
-     1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
-     1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714,
-     1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724,
-     1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734,
-
-     1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744,
-     1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754,
-     1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764,
-     1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774,
-     1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
-     1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
-     1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804,
-     1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814,
-     1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824,
-     1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834,
-
-     1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844,
-     1845, 1846, 1847, 1848, 1849, 1850, 1851, 1853, 1852, 1854,
-     1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864,
-     1865, 1866, 1867, 1868, 1869, 1870, 1871,   12,   12,   12,
-       12,   12,   36,   36,   36,   36,   36,   79,  318,   79,
-       79,   79,   98,  440,   98,  573,   98,  100,  100,  100,
-      100,  100,  116,  116,  116,  116,  116,  186,  100,  186,
-      186,  186,  210,  210,  210,  846,  845,  844,  843,  842,
-      841,  840,  839,  838,  837,  836,  835,  834,  833,  829,
-      828,  827,  826,  825,  822,  821,  820,  819,  818,  817,
-
-      816,  815,  814,  813,  812,  809,  808,  807,  806,  805,
-      804,  803,  802,  801,  800,  799,  798,  797,  796,  795,
-      794,  793,  792,  791,  790,  789,  788,  787,  786,  782,
-      781,  780,  779,  778,  777,  776,  775,  774,  771,  770,
-      769,  768,  767,  766,  765,  764,  763,  762,  761,  760,
-      759,  758,  757,  756,  755,  754,  753,  752,  749,  748,
-      747,  746,  745,  744,  743,  742,  741,  740,  739,  738,
-      737,  736,  735,  734,  733,  732,  731,  730,  729,  728,
-      727,  726,  725,  724,  723,  722,  721,  720,  719,  718,
-      717,  716,  715,  714,  713,  712,  711,  710,  709,  708,
-
-      704,  703,  702,  701,  700,  699,  698,  697,  696,  695,
-      694,  693,  692,  691,  690,  689,  688,  687,  686,  685,
-      684,  683,  682,  681,  680,  679,  678,  677,  676,  673,
-      672,  671,  670,  669,  668,  667,  666,  665,  664,  663,
-      662,  661,  660,  659,  658,  657,  656,  655,  654,  653,
-      652,  651,  650,  649,  648,  647,  646,  645,  644,  643,
-      642,  641,  640,  639,  636,  635,  634,  633,  632,  631,
-      630,  629,  628,  627,  626,  625,  624,  623,  622,  621,
-      620,  619,  618,  617,  614,  613,  612,  611,  610,  609,
-      608,  607,  604,  603,  602,  596,  595,  594,  593,  592,
-
-      591,  590,  589,  588,  587,  586,  585,  581,  580,  579,
-      578,  577,  576,  575,  572,  571,  568,  567,  566,  565,
-      564,  561,  560,  559,  558,  557,  556,  555,  554,  553,
-      552,  551,  550,  549,  548,  545,  544,  543,  540,  539,
-      538,  537,  536,  535,  534,  531,  530,  527,  526,  525,
-      524,  523,  522,  521,  520,  519,  518,  517,  513,  512,
-      511,  508,  507,  506,  501,  500,  499,  498,  497,  496,
-      495,  494,  493,  492,  491,  486,  485,  484,  483,  482,
-      481,  480,  479,  478,  477,  476,  475,  474,  471,  470,
-      469,  468,  465,  462,  461,  460,  459,  458,  457,  456,
-
-      455,  454,  451,  450,  448,  447,  442,  439,  436,  435,
-      434,  433,  432,  431,  430,  428,  427,  426,  425,  424,
-      423,  422,  421,  420,  417,  416,  415,  414,  413,  412,
-      411,  408,  407,  406,  405,  404,  403,  402,  401,  400,
-      399,  398,  397,  396,  395,  394,  393,  392,  389,  388,
-      387,  385,  384,  383,  382,  381,  380,  376,  375,  374,
-      373,  372,  371,  370,  369,  368,  367,  366,  365,  364,
-      363,  362,  361,  360,  359,  358,  357,  356,  355,  354,
-      353,  352,  351,  350,  349,  348,  347,  346,  345,  344,
-      339,  338,  337,  336,  335,  334,  332,  211,  329,  327,
-
-      325,  324,  321,  320,  317,  310,  309,  308,  307,  306,
-      305,  304,  302,  301,  300,  297,  296,  295,  291,  281,
-      278,  274,  273,  268,  267,  266,  265,  264,  262,  261,
-      260,  259,  258,  257,  254,  253,  252,  251,  250,  249,
-      248,  245,  244,  240,  239,  231,  230,  229,  225,  224,
-      223,  222,  218,  215,  211,  204,  199,  198,  197,  194,
-      193,  185,  166,  143,  106,  105,  104,   43,   99,   97,
-       96,   87,   43, 1872,   11, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872
+     1625, 1626, 1627, 1629, 1630, 1631, 1632, 1633, 1634, 1635,
+     1636, 1637, 1638, 1639, 1640, 1641, 1644, 1645, 1646, 1647,
+     1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657,
+     1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667,
+     1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
+     1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687,
+     1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697,
+     1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707,
+     1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717,
+
+     1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+     1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+     1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747,
+     1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757,
+     1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767,
+     1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777,
+     1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787,
+     1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+     1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+     1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
+
+     1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827,
+     1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837,
+     1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847,
+     1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857,
+     1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867,
+     1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877,
+     1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+     1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897,
+     1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907,
+     1908, 1909, 1910, 1911, 1914, 1915, 1916, 1917, 1918, 1919,
+
+     1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+     1930, 1931, 1932,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[2349] =
+static const flex_int16_t yy_chk[2881] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933, 1933,
+     1933, 1933, 1933, 1933,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  653,    3,    3,    3,   21,    1,    1,    3,   44,
-        0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  108,    1,    5,    5,    5,   26,   32,    1,
-        1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      653,    8,    8,    8,    1,    8,   44,   27,   28,  108,
-       26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    9,    9,    9,   31,    5,   47,    2,    2,
-
-       10,   10,   10,    2,    6,   37,   51,   37,    2,   42,
-       52,   42,    9,    2,   54,    2,   56,   57,   31,   65,
-       10,    2,    2,   47,   65,  343,   25,   65,   25,   51,
-        2,   25,   25,   25,   25,   25,    2,   54,   52,   56,
-      727,   57,  343,    2,    2,   15,   15,   15,   15,   15,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -1663,241 +1740,299 @@ static const flex_int16_t yy_chk[2349] =
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
 
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,   53,
-       17,   17,   17,   17,   17,   19,   59,   19,   19,   19,
-       19,   19,   63,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   64,   20,   53,   62,
-       55,   60,   59,   64,   22,   63,   17,   74,   59,   62,
-       55,   74,   60,   19,   66,   60,   63,   60,  134,   60,
-       20,   90,   91,   55,   66,  121,   66,   22,   45,  121,
-       45,   45,   45,   45,  134,   45,   45,   45,   55,   58,
-       68,   68,   45,   45,   68,   45,   58,   90,   91,   93,
-
-       68,   45,  100,   45,   45,   45,   45,   45,   45,   45,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        3,    3,   11,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,   16,   16,   14,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   86,   86,   24,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   40,
+       40,  288,   40,   40,  288,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,  116,  116,  116,  116,  116,  116,  116,  116,
+      116,  116,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,  118,  118,  118,  118,  118,
+
+       44,   44,   44,   44,  118,  118,  118,  118,  118,  118,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,  118,  118,  118,
+      118,  118,  118,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,  458,  458,  458,  458,  458,
+      458,  458,  458,  458,  458,  458,  458,  458,  196,  196,
+      196,  196,  196,  458,  458,  458,  458,  196,  196,  196,
+      196,  196,  196,  458,  458,  458,  458,  458,  458,  458,
+      458,  458,  458,  458,  458,  458,  458,  458,  458,  458,
+
+      196,  196,  196,  196,  196,  196,  458,  458,  458,  458,
+      458,  458,  458,  458,  458,  458,  458,  458,  458,  458,
+      458,  458,  458,  458,  458,  458,  458,  458,   45,   66,
+       45,   45,   45,   45,   31,   45,   45,   45,   13,   66,
+       13,   66,   45,   45,   17,   45,   17,   17,   17,   17,
+       17,   45,   57,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   61,   93,   58,   61,   61,   94,
-       58,   61,   61,   69,   58,   70,  107,   69,  174,  100,
-      728,   69,   58,   92,   61,   77,   58,   95,   58,   58,
-      115,   71,  174,   69,   70,   94,   70,   69,   70,   71,
-       72,   71,  107,   72,   72,   75,   71,   71,   77,   75,
-      729,   92,   75,  115,   72,   95,  103,   72,   77,   75,
-       75,   76,   76,   77,   75,   75,   80,   80,   80,   80,
-       80,   76,   81,  111,   81,   81,   81,   81,   81,   80,
-
-      109,   76,  730,   82,  103,   82,  112,   81,   82,   82,
-       82,   82,   82,  132,   76,  132,   76,  630,  630,   76,
-       76,  111,   80,   88,   88,   88,   88,   88,  140,   76,
-       81,  109,  132,  112,  113,   83,   76,   83,   83,   83,
-       83,   83,   84,   84,   84,   84,   84,  102,  114,  119,
-       83,  732,  155,  733,  102,   84,   89,   89,   89,   89,
-       89,  123,  113,  133,  128,  128,  119,  178,  148,  734,
-      123,  123,  140,   83,  128,  114,  133,  119,   84,  137,
-      155,  161,  137,  735,  102,  187,  137,  164,  102,  148,
-      164,  164,  102,  189,  178,  166,  161,  161,  161,  166,
-
-      102,  168,  188,  191,  102,  190,  102,  102,  118,  118,
-      118,  118,  118,  187,  256,  267,  189,  118,  118,  118,
-      118,  118,  118,  170,  736,  192,  737,  170,  188,  191,
-      196,  170,  200,  190,  201,  205,  168,  168,  168,  207,
-      118,  118,  118,  118,  118,  118,  209,  168,  192,  168,
-      738,  168,  168,  196,  168,  221,  214,  263,  205,  293,
-      200,  201,  207,  221,  319,  267,  303,  256,  221,  221,
-      256,  303,  293,  209,  212,  212,  212,  212,  212,  214,
-      263,  311,  314,  212,  212,  212,  212,  212,  212,  285,
-      321,  321,  285,  319,  322,  326,  346,  351,  740,  321,
-
-      333,  346,  385,  351,  311,  314,  212,  212,  212,  212,
-      212,  212,  385,  365,  377,  377,  377,  322,  365,  386,
-      377,  399,  504,  326,  331,  331,  331,  331,  331,  333,
-      472,  741,  504,  331,  331,  331,  331,  331,  331,  381,
-      402,  441,  410,  472,  402,  381,  410,  386,  414,  435,
-      429,  582,  414,  429,  435,  453,  331,  331,  331,  331,
-      331,  331,  451,  482,  451,  468,  365,  543,  482,  441,
-      583,  365,  543,  468,  691,  468,  468,  468,  582,  399,
-      584,  705,  742,  453,  743,  584,  691,  706,  744,  451,
-      745,  451,  452,  452,  452,  452,  452,  746,  583,  747,
-
-      748,  452,  452,  452,  452,  452,  452,  664,  749,  705,
-      706,  731,  664,  712,  712,  731,  712,  750,  751,  731,
-      752,  753,  754,  755,  452,  452,  452,  452,  452,  452,
-      756,  757,  758,  759,  760,  758,  761,  763,  764,  765,
-      766,  767,  768,  769,  770,  771,  773,  774,  775,  776,
-      777,  664,  778,  779,  780,  781,  782,  784,  785,  786,
-      787,  788,  789,  790,  791,  792,  793,  794,  795,  796,
-      797,  798,  799,  800,  801,  802,  803,  804,  805,  806,
-      807,  808,  802,  809,  804,  811,  807,  812,  804,  813,
-      814,  815,  816,  817,  818,  819,  820,  821,  823,  824,
-
-      825,  826,  827,  828,  830,  831,  832,  833,  834,  835,
-      836,  837,  838,  839,  840,  841,  842,  843,  844,  845,
-      846,  847,  848,  849,  850,  851,  852,  824,  853,  854,
-      855,  856,  857,  859,  860,  861,  862,  863,  864,  865,
-      866,  867,  868,  864,  869,  870,  871,  872,  873,  876,
-      877,  878,  879,  880,  881,  882,  885,  886,  887,  888,
-      889,  890,  891,  892,  893,  894,  891,  895,  896,  897,
-      899,  901,  902,  903,  904,  905,  906,  907,  908,  909,
-      910,  911,  912,  913,  914,  915,  916,  917,  918,  919,
-      920,  921,  922,  923,  924,  925,  926,  927,  928,  929,
-
-      930,  931,  932,  934,  935,  936,  924,  937,  938,  939,
-      940,  941,  942,  944,  945,  946,  947,  949,  950,  951,
-      952,  953,  954,  955,  956,  957,  958,  959,  960,  961,
-      962,  963,  964,  965,  966,  967,  968,  945,  969,  971,
-      944,  972,  973,  974,  975,  976,  977,  978,  979,  980,
-      981,  982,  984,  985,  986,  987,  988,  989,  991,  992,
-      993,  988,  994,  995,  996,  997,  998,  999, 1000, 1001,
-     1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011,
-     1012, 1013, 1016, 1017, 1018, 1020, 1021, 1022, 1023, 1025,
-     1011, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-
-     1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1044, 1045,
-     1046, 1047, 1048, 1049,  988, 1050, 1051, 1052, 1053, 1054,
-     1055, 1056, 1057, 1058, 1060, 1059, 1061, 1062, 1063, 1064,
-     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
-     1075, 1076, 1077, 1078, 1079, 1081, 1082, 1083, 1084, 1085,
-     1086, 1058, 1059, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
-     1094, 1095, 1096, 1097, 1098, 1100, 1101, 1102, 1103, 1104,
-     1105, 1101, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
-     1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
-     1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1134,
-
-     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
-     1146, 1102, 1147, 1150, 1151, 1152, 1153, 1154, 1155, 1156,
-     1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166,
-     1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
-     1177, 1179, 1180, 1181, 1182, 1183, 1184, 1186, 1187, 1188,
-     1189, 1190, 1166, 1191, 1192, 1193, 1194, 1195, 1167, 1196,
-     1197, 1198, 1199, 1200, 1201, 1202, 1203, 1206, 1208, 1210,
-     1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220,
-     1221, 1222, 1223, 1225, 1226, 1227, 1229, 1230, 1231, 1232,
-     1233, 1236, 1238, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
-
-     1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1256, 1257,
-     1258, 1259, 1260, 1263, 1264, 1265, 1266, 1267, 1268, 1269,
-     1270, 1271, 1273, 1274, 1275, 1276, 1277, 1278, 1280, 1281,
-     1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
-     1292, 1293, 1294, 1296, 1297, 1298, 1299, 1300, 1270, 1301,
-     1302, 1303, 1304, 1305, 1306, 1307, 1250, 1308, 1309, 1310,
-     1311, 1313, 1314, 1315, 1316, 1317, 1318, 1274, 1319, 1320,
-     1321, 1315, 1322, 1323, 1326, 1327, 1328, 1329, 1330, 1331,
-     1332, 1333, 1334, 1335, 1336, 1337, 1339, 1340, 1341, 1342,
-     1343, 1344, 1346, 1348, 1351, 1352, 1353, 1355, 1356, 1357,
-
-     1358, 1359, 1360, 1362, 1364, 1365, 1366, 1367, 1368, 1369,
-     1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379,
-     1381, 1383, 1384, 1385, 1386, 1360, 1387, 1388, 1389, 1390,
-     1391, 1392, 1393, 1395, 1398, 1400, 1401, 1402, 1403, 1404,
-     1405, 1406, 1407, 1408, 1409, 1411, 1412, 1413, 1414, 1415,
-     1416, 1417, 1420, 1421, 1423, 1424, 1425, 1426, 1427, 1429,
-     1430, 1431, 1432, 1433, 1434, 1435, 1436, 1438, 1440, 1441,
-     1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451,
-     1452, 1453, 1454, 1455, 1457, 1458, 1459, 1461, 1462, 1463,
-     1451, 1464, 1465, 1466, 1467, 1440, 1468, 1468, 1469, 1470,
-
-     1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480,
-     1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490,
-     1491, 1492, 1493, 1494, 1495, 1497, 1498, 1499, 1500, 1502,
-     1503, 1504, 1505, 1506, 1509, 1510, 1511, 1515, 1516, 1517,
-     1518, 1519, 1520, 1521, 1522, 1523, 1525, 1526, 1527, 1528,
-     1529, 1525, 1530, 1531, 1532, 1533, 1469, 1535, 1536, 1538,
-     1505, 1540, 1541, 1542, 1544, 1545, 1546, 1547, 1548, 1550,
-     1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560,
-     1561, 1562, 1563, 1564, 1565, 1566, 1567, 1569, 1570, 1571,
-     1572, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582,
-
-     1584, 1585, 1586, 1587, 1588, 1590, 1591, 1592, 1594, 1595,
-     1596, 1597, 1598, 1599, 1600, 1601, 1603, 1604, 1605, 1606,
-     1607, 1608, 1609, 1610, 1611, 1612, 1614, 1615, 1616, 1618,
-     1619, 1620, 1621, 1623, 1625, 1626, 1627, 1628, 1629, 1630,
-     1631, 1632, 1633, 1634, 1635, 1636, 1637, 1639, 1640, 1641,
-     1642, 1643, 1644, 1645, 1647, 1648, 1649, 1650, 1652, 1653,
-     1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1663, 1664,
-     1665, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1676,
-     1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1687, 1688,
-     1689, 1690, 1691, 1692, 1693, 1694, 1696, 1698, 1699, 1700,
-
-     1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710,
-     1711, 1712, 1713, 1714, 1716, 1717, 1718, 1719, 1720, 1721,
-     1722, 1723, 1725, 1727, 1729, 1732, 1733, 1734, 1735, 1736,
-     1738, 1739, 1740, 1742, 1743, 1744, 1745, 1746, 1747, 1748,
-     1749, 1751, 1752, 1754, 1755, 1756, 1758, 1759, 1760, 1762,
-     1764, 1765, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774,
-     1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
-     1785, 1786, 1787, 1788, 1790, 1791, 1792, 1793, 1794, 1795,
-     1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805,
-     1806, 1807, 1809, 1810, 1812, 1813, 1815, 1816, 1817, 1818,
-
-     1822, 1825, 1826, 1827, 1829, 1830, 1831, 1832, 1833, 1834,
-     1836, 1838, 1841, 1842, 1843, 1844, 1845, 1846, 1845, 1848,
-     1849, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1859, 1860,
-     1861, 1862, 1863, 1866, 1867, 1868, 1869, 1873, 1873, 1873,
-     1873, 1873, 1874, 1874, 1874, 1874, 1874, 1875, 1881, 1875,
-     1875, 1875, 1876, 1882, 1876, 1883, 1876, 1877, 1877, 1877,
-     1877, 1877, 1878, 1878, 1878, 1878, 1878, 1879, 1884, 1879,
-     1879, 1879, 1880, 1880, 1880,  726,  725,  724,  723,  722,
-      721,  720,  719,  718,  717,  716,  715,  714,  713,  711,
-      710,  709,  708,  707,  704,  703,  702,  699,  698,  697,
-
-      696,  695,  694,  693,  692,  690,  689,  687,  686,  685,
-      684,  683,  682,  681,  680,  679,  678,  677,  676,  675,
-      673,  672,  671,  670,  669,  668,  667,  666,  665,  663,
-      662,  660,  659,  658,  657,  656,  655,  654,  652,  651,
-      650,  648,  647,  645,  644,  643,  642,  641,  640,  639,
-      638,  637,  636,  635,  634,  633,  632,  631,  629,  628,
-      627,  626,  625,  623,  622,  621,  620,  619,  618,  617,
-      616,  614,  613,  612,  611,  610,  609,  608,  607,  606,
-      605,  604,  603,  602,  601,  600,  599,  598,  597,  596,
-      595,  594,  593,  592,  591,  590,  589,  588,  587,  586,
-
-      580,  578,  575,  574,  572,  571,  570,  568,  565,  563,
-      562,  561,  560,  559,  558,  557,  556,  555,  554,  553,
-      552,  551,  550,  549,  548,  547,  546,  545,  544,  542,
-      541,  540,  539,  538,  537,  536,  535,  534,  533,  532,
-      531,  529,  527,  526,  525,  524,  523,  522,  521,  520,
-      519,  518,  517,  516,  515,  514,  512,  511,  510,  509,
-      508,  507,  506,  505,  503,  502,  501,  500,  499,  498,
-      497,  496,  495,  494,  493,  492,  491,  490,  489,  488,
-      486,  485,  484,  483,  481,  480,  479,  478,  477,  476,
-      474,  473,  471,  470,  469,  467,  465,  464,  463,  462,
-
-      461,  460,  459,  457,  456,  455,  454,  449,  448,  446,
-      445,  444,  443,  442,  439,  436,  434,  433,  432,  431,
-      430,  428,  427,  426,  425,  424,  423,  422,  421,  420,
-      419,  418,  417,  416,  415,  413,  412,  411,  409,  408,
-      407,  406,  405,  404,  403,  401,  400,  398,  397,  396,
-      395,  394,  393,  392,  391,  390,  389,  388,  384,  383,
-      382,  380,  379,  378,  376,  375,  374,  373,  372,  371,
-      370,  369,  368,  367,  366,  364,  363,  362,  361,  360,
-      359,  358,  357,  356,  355,  354,  353,  352,  350,  349,
-      348,  347,  345,  342,  341,  340,  339,  338,  337,  336,
-
-      335,  334,  330,  328,  325,  323,  320,  317,  310,  309,
-      308,  307,  306,  305,  304,  302,  301,  300,  299,  298,
-      297,  296,  295,  294,  292,  291,  290,  289,  288,  287,
-      286,  284,  283,  282,  281,  280,  279,  278,  277,  276,
-      275,  274,  273,  272,  271,  270,  269,  268,  266,  265,
-      264,  262,  261,  260,  259,  258,  257,  255,  254,  253,
-      252,  251,  250,  249,  248,  247,  245,  244,  243,  242,
-      241,  240,  239,  238,  237,  236,  235,  234,  233,  232,
-      231,  230,  229,  228,  227,  226,  225,  224,  223,  222,
-      220,  219,  218,  217,  216,  215,  213,  210,  208,  206,
-
-      204,  203,  198,  197,  193,  185,  184,  183,  182,  181,
-      180,  179,  177,  176,  175,  173,  172,  171,  169,  167,
-      165,  163,  162,  160,  159,  158,  157,  156,  154,  153,
-      152,  151,  150,  149,  147,  146,  145,  144,  143,  142,
-      141,  139,  138,  136,  135,  131,  130,  129,  127,  126,
-      125,  124,  122,  120,  116,  110,  106,  105,  104,   98,
-       97,   78,   73,   67,   50,   49,   48,   43,   41,   39,
-       38,   24,   14,   11, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872,
-     1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872
+       45,   45,   45,   45,    7,    7,   57,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,   20,
+       20,   20,   20,   20,   75,    7,    7,   59,   75,   65,
+
+        7,   75,   20,   59,   65,    7,   60,   65,   75,   75,
+        7,   32,    7,   75,   75,   26,    9,   60,    7,    7,
+       60,   71,   60,  102,   60,   20,   25,    7,   25,   71,
+      102,   71,    9,    7,  259,   58,   71,   71,   26,  123,
+        7,    7,   58,   58,   58,   58,   58,   58,  123,  123,
+      347,  475,   58,   58,   58,   58,   58,   58,  108,  475,
+      102,  475,  475,  475,  102,   63,   61,  347,  102,   61,
+       61,   63,   58,   61,   61,   58,  102,   58,   58,   58,
+      102,   55,  102,  102,  371,  108,   61,  259,   58,  371,
+      259,   55,   58,    5,   58,   58,  213,  213,  213,  213,
+
+      213,   76,   76,   33,   55,  213,  213,  213,  213,  213,
+      213,  321,  321,  321,  321,  321,  128,  128,   38,   55,
+      321,  321,  321,  321,  321,  321,  128,   27,  213,  213,
+      213,  213,  213,  213,   76,  405,   76,  371,   39,   76,
+       76,    5,  371,  321,  321,  321,  321,  321,  321,  334,
+      334,  334,  334,  334,  162,   27,   76,   51,  334,  334,
+      334,  334,  334,  334,  446,  446,  446,  446,  446,  162,
+      162,  162,  169,  446,  446,  446,  446,  446,  446,  109,
+       51,  334,  334,  334,  334,  334,  334,   19,   19,   19,
+       19,   19,  457,  405,  457,   41,  446,  446,  446,  446,
+
+      446,  446,  585,  585,  585,  585,  585,  169,  169,  169,
+      109,  585,  585,  585,  585,  585,  585,   28,  169,  457,
+      169,  457,  169,  169,   69,  169,   72,   48,   69,   72,
+       72,   47,   69,  222,  585,  585,  585,  585,  585,  585,
+       72,  222,   49,   72,   69,   28,  222,  222,   69,   88,
+       88,   88,   88,   88,   68,   68,  379,   47,   68,  379,
+      383,  383,  383,  379,   68,   70,  383,   70,  132,   70,
+      132,  138,  165,  379,  138,  165,  165,  171,  138,  324,
+      324,  171,   52,   53,  682,  171,   54,  132,  324,  682,
+      731,  731,  751,  731,  828,   56,  751, 1022,   21,   64,
+
+      751,  828, 1022,   21,   62,  828,   64,   74,   77,   54,
+       52,   74,   53,   77,   62,   90,   91,   92,   56,  103,
+      107,  111,  119,  112,  113,  115,  114,  121,  682,  131,
+      133,  121,  141,  119,  188,  134,  149,  189,  131,  201,
+      167,   90,   91,  133,  167,   92,  107,  103,  115,  111,
+      112,  134,  113,  114,  175, 1022,  190,  149,  197,  202,
+      206,  208,  188,  189,  210,  214,  270,  201,  175,  296,
+      314,  322,  325,  329,  408,  350,  141,  391,  408,  190,
+      350,  197,  296,  206,  208,  416,  202,  391,  355,  416,
+      387,  210,  441,  314,  355,  325,  387,  441,  420,  447,
+
+      322,  329,  420,  435,  479,  490,  435,  555,  516,  594,
+      490,  595,  555,  645,  645,  671,  270,  479,  516,  214,
+      709,  723,  724,  782,  826,  794,  782,  447,  794,  831,
+      848,  826,  709,  891,  955,  831,  594,  922,  891,  595,
+      975,  922,  976, 1096, 1049,  724,  955, 1097, 1142,  723,
+     1143, 1211, 1210, 1142,  671, 1049, 1299, 1319,  848, 1323,
+     1366, 1412, 1495, 1524, 1524,  976, 1506,  975, 1366, 1525,
+     1562, 1096,   50, 1582, 1097, 1210,   67, 1506, 1582, 1211,
+     1906,   73, 1906,   78, 1412, 1319,   93,   94,   95, 1495,
+       97,   98,  104,  105, 1143,  106,  110,  120, 1562,  122,
+
+      124,  125,  126, 1323,  127,  129,  130,  135,  136, 1299,
+      137,  139,  140,  142,  143,  144,  145,  146,  147,  148,
+      150,  151,  152,  153,  154,  155,  156, 1525,  157,  158,
+      159,  160,  161,  163,  164,  166,  168,  170,  172,  173,
+      174,  176,  177,  178,  179,  180,  181,  182,  183,  184,
+      185,  186,  191,  192,  193,  194,  198,  199,  204,  205,
+      207,  209,  215,  216,  217,  218,  219,  220,  221,  223,
+      224,  225,  226,  227,  228,  229,  230,  231,  232,  233,
+      234,  235,  236,  237,  238,  239,  240,  241,  242,  243,
+      244,  245,  246,  247,  248,  250,  251,  252,  253,  254,
+
+      255,  256,  257,  258,  260,  261,  262,  263,  264,  265,
+      266,  267,  268,  269,  271,  272,  273,  274,  275,  276,
+      277,  278,  279,  280,  281,  282,  283,  284,  285,  286,
+      287,  289,  290,  291,  292,  293,  294,  295,  297,  298,
+      299,  300,  301,  302,  303,  304,  305,  306,  307,  308,
+      309,  310,  311,  312,  313,  317,  320,  323,  326,  328,
+      331,  333,  336,  337,  338,  339,  340,  341,  342,  343,
+      344,  345,  346,  349,  351,  352,  353,  354,  356,  357,
+      358,  359,  360,  361,  362,  363,  364,  365,  366,  367,
+      368,  369,  370,  372,  373,  374,  375,  376,  377,  378,
+
+      380,  381,  382,  384,  385,  386,  388,  389,  390,  392,
+      394,  395,  396,  397,  398,  399,  400,  401,  402,  403,
+      404,  406,  407,  409,  410,  411,  412,  413,  414,  415,
+      417,  418,  419,  421,  422,  423,  424,  425,  426,  427,
+      428,  429,  430,  431,  432,  433,  434,  436,  437,  438,
+      439,  440,  442,  445,  448,  449,  450,  451,  452,  454,
+      455,  459,  460,  461,  462,  463,  464,  466,  467,  468,
+      469,  470,  471,  472,  474,  476,  477,  478,  480,  481,
+      483,  484,  485,  486,  487,  488,  489,  491,  492,  493,
+      494,  495,  497,  498,  499,  500,  501,  502,  503,  504,
+
+      505,  506,  507,  508,  509,  510,  511,  512,  513,  514,
+      515,  517,  518,  519,  520,  521,  522,  523,  524,  526,
+      527,  528,  529,  530,  531,  532,  533,  534,  535,  536,
+      537,  538,  539,  541,  543,  544,  545,  546,  547,  548,
+      549,  550,  551,  552,  553,  554,  556,  557,  558,  559,
+      560,  561,  562,  563,  564,  565,  566,  567,  568,  569,
+      570,  571,  572,  573,  574,  575,  577,  580,  582,  583,
+      584,  586,  587,  590,  592,  596,  597,  599,  600,  601,
+      602,  603,  604,  605,  606,  607,  608,  609,  610,  611,
+      612,  613,  614,  615,  616,  617,  618,  619,  620,  621,
+
+      622,  623,  624,  625,  626,  627,  628,  630,  631,  632,
+      633,  634,  635,  636,  637,  638,  640,  641,  642,  643,
+      644,  646,  647,  648,  649,  650,  651,  652,  653,  654,
+      655,  656,  657,  658,  659,  660,  661,  662,  663,  665,
+      666,  668,  669,  670,  672,  673,  674,  675,  676,  677,
+      678,  680,  681,  683,  684,  685,  686,  687,  688,  689,
+      690,  691,  693,  694,  695,  696,  697,  698,  699,  700,
+      701,  702,  703,  704,  705,  707,  708,  710,  711,  712,
+      713,  714,  715,  716,  717,  720,  721,  722,  725,  726,
+      727,  728,  729,  730,  732,  733,  734,  735,  736,  737,
+
+      738,  739,  740,  741,  742,  743,  744,  745,  746,  747,
+      748,  749,  750,  752,  753,  754,  755,  756,  757,  758,
+      759,  761,  762,  763,  764,  765,  766,  767,  768,  769,
+      770,  771,  772,  773,  774,  775,  776,  777,  778,  779,
+      780,  781,  783,  784,  785,  787,  788,  789,  790,  791,
+      792,  793,  795,  797,  798,  799,  800,  801,  802,  803,
+      804,  805,  806,  808,  809,  810,  811,  812,  813,  814,
+      815,  816,  817,  818,  819,  820,  821,  822,  823,  824,
+      825,  827,  829,  830,  832,  833,  835,  836,  837,  838,
+      839,  840,  841,  842,  843,  844,  845,  847,  849,  850,
+
+      851,  852,  853,  855,  856,  857,  858,  859,  860,  861,
+      862,  863,  864,  865,  866,  867,  868,  869,  870,  871,
+      872,  873,  874,  875,  876,  877,  878,  879,  880,  881,
+      882,  883,  885,  886,  887,  888,  889,  890,  892,  893,
+      894,  895,  896,  897,  898,  899,  900,  901,  902,  903,
+      906,  907,  908,  909,  910,  911,  912,  915,  916,  917,
+      918,  919,  920,  921,  923,  924,  925,  926,  927,  928,
+      930,  932,  933,  934,  935,  936,  937,  938,  939,  940,
+      941,  942,  943,  944,  945,  946,  947,  948,  949,  950,
+      951,  952,  953,  954,  956,  957,  958,  959,  960,  961,
+
+      962,  963,  965,  966,  967,  968,  969,  970,  971,  972,
+      973,  977,  978,  979,  981,  982,  983,  984,  985,  986,
+      987,  988,  989,  990,  991,  992,  993,  994,  995,  996,
+      997,  998,  999, 1000, 1001, 1003, 1004, 1005, 1006, 1007,
+     1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1018,
+     1019, 1020, 1021, 1023, 1025, 1026, 1027, 1028, 1030, 1031,
+     1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+     1042, 1043, 1044, 1045, 1046, 1047, 1048, 1050, 1051, 1054,
+     1055, 1056, 1058, 1059, 1060, 1061, 1063, 1064, 1065, 1066,
+     1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+
+     1077, 1078, 1079, 1080, 1082, 1083, 1084, 1085, 1086, 1087,
+     1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1099, 1100,
+     1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110,
+     1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1120, 1121,
+     1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131,
+     1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1141, 1144,
+     1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154,
+     1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
+     1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
+     1175, 1176, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+
+     1186, 1187, 1188, 1190, 1191, 1194, 1195, 1196, 1197, 1198,
+     1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
+     1209, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220,
+     1221, 1223, 1224, 1225, 1226, 1227, 1228, 1230, 1231, 1232,
+     1233, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
+     1244, 1245, 1246, 1247, 1248, 1249, 1252, 1254, 1256, 1257,
+     1258, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268,
+     1269, 1270, 1271, 1273, 1274, 1275, 1276, 1278, 1279, 1280,
+     1281, 1282, 1285, 1287, 1289, 1290, 1291, 1292, 1293, 1294,
+     1295, 1296, 1297, 1298, 1300, 1301, 1302, 1303, 1305, 1306,
+
+     1307, 1308, 1309, 1312, 1313, 1314, 1315, 1316, 1317, 1318,
+     1320, 1322, 1324, 1325, 1326, 1327, 1329, 1330, 1331, 1332,
+     1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342,
+     1343, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
+     1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1364,
+     1365, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+     1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
+     1388, 1389, 1391, 1392, 1393, 1394, 1395, 1396, 1398, 1400,
+     1403, 1404, 1405, 1407, 1408, 1409, 1410, 1411, 1414, 1416,
+     1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
+
+     1427, 1428, 1429, 1430, 1431, 1433, 1435, 1436, 1437, 1438,
+     1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1448, 1451,
+     1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462,
+     1463, 1465, 1467, 1468, 1469, 1470, 1471, 1472, 1475, 1476,
+     1478, 1479, 1480, 1481, 1482, 1484, 1485, 1486, 1487, 1488,
+     1489, 1490, 1491, 1493, 1496, 1497, 1498, 1499, 1500, 1501,
+     1502, 1503, 1504, 1505, 1507, 1508, 1509, 1510, 1512, 1513,
+     1514, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1526,
+     1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536,
+     1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
+
+     1547, 1548, 1549, 1550, 1551, 1552, 1554, 1555, 1556, 1557,
+     1559, 1560, 1561, 1563, 1566, 1567, 1568, 1572, 1573, 1574,
+     1575, 1576, 1577, 1578, 1579, 1580, 1583, 1584, 1585, 1586,
+     1587, 1588, 1589, 1590, 1591, 1593, 1594, 1597, 1599, 1600,
+     1601, 1603, 1604, 1605, 1606, 1607, 1609, 1610, 1611, 1612,
+     1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622,
+     1623, 1624, 1625, 1626, 1628, 1629, 1630, 1631, 1633, 1634,
+     1635, 1636, 1637, 1638, 1639, 1640, 1641, 1643, 1644, 1645,
+     1646, 1647, 1648, 1650, 1651, 1652, 1654, 1655, 1656, 1657,
+     1658, 1659, 1660, 1661, 1663, 1664, 1665, 1666, 1667, 1668,
+
+     1669, 1670, 1671, 1672, 1674, 1675, 1676, 1678, 1679, 1680,
+     1681, 1683, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692,
+     1693, 1694, 1695, 1696, 1697, 1700, 1701, 1702, 1703, 1704,
+     1705, 1706, 1708, 1709, 1710, 1711, 1713, 1714, 1715, 1716,
+     1717, 1718, 1719, 1720, 1721, 1722, 1724, 1725, 1726, 1728,
+     1729, 1730, 1731, 1732, 1733, 1734, 1735, 1737, 1738, 1739,
+     1740, 1741, 1742, 1743, 1744, 1745, 1748, 1749, 1750, 1751,
+     1752, 1753, 1754, 1755, 1757, 1759, 1760, 1761, 1762, 1763,
+     1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
+     1774, 1775, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+
+     1786, 1788, 1790, 1793, 1794, 1795, 1796, 1797, 1799, 1800,
+     1801, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1812,
+     1813, 1815, 1816, 1817, 1819, 1820, 1821, 1823, 1825, 1826,
+     1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837,
+     1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847,
+     1848, 1849, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858,
+     1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868,
+     1870, 1871, 1873, 1874, 1876, 1877, 1878, 1879, 1883, 1886,
+     1887, 1888, 1890, 1891, 1892, 1893, 1894, 1895, 1897, 1899,
+     1902, 1903, 1904, 1905, 1907, 1909, 1910, 1912, 1913, 1914,
+
+     1915, 1916, 1917, 1918, 1920, 1921, 1922, 1923, 1924, 1927,
+     1928, 1929, 1930,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1906,7 +2041,7 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[208] =
+static const flex_int16_t yy_rule_linenum[215] =
     {   0,
       149,  151,  153,  158,  159,  164,  165,  166,  178,  181,
       186,  193,  202,  211,  220,  229,  238,  247,  256,  265,
@@ -1915,22 +2050,23 @@ static const flex_int16_t yy_rule_linenum[208] =
       469,  478,  487,  496,  505,  514,  523,  532,  541,  550,
       559,  572,  581,  590,  599,  608,  619,  630,  641,  652,
       664,  675,  686,  697,  708,  719,  730,  741,  752,  763,
-      774,  785,  794,  805,  816,  827,  838,  849,  860,  871,
-      882,  891,  900,  909,  918,  929,  940,  951,  962,  973,
-      984,  994, 1005, 1014, 1023, 1038, 1054, 1063, 1072, 1081,
-
-     1090, 1099, 1108, 1117, 1126, 1135, 1144, 1168, 1192, 1201,
-     1211, 1221, 1230, 1240, 1251, 1260, 1269, 1278, 1287, 1296,
-     1306, 1315, 1324, 1333, 1344, 1355, 1366, 1375, 1385, 1394,
-     1403, 1412, 1421, 1430, 1439, 1448, 1457, 1467, 1479, 1492,
-     1501, 1510, 1520, 1530, 1539, 1550, 1560, 1569, 1579, 1589,
-     1598, 1607, 1616, 1625, 1635, 1644, 1653, 1662, 1671, 1680,
-     1689, 1698, 1707, 1716, 1725, 1734, 1743, 1752, 1761, 1770,
-     1779, 1788, 1797, 1806, 1815, 1824, 1833, 1842, 1851, 1860,
-     1869, 1878, 1887, 1896, 1905, 1914, 1923, 1932, 1941, 1950,
-     2049, 2054, 2059, 2064, 2065, 2066, 2067, 2068, 2069, 2071,
-
-     2089, 2102, 2107, 2111, 2113, 2115, 2117
+      774,  785,  794,  803,  812,  821,  830,  841,  852,  863,
+      874,  885,  896,  907,  918,  927,  936,  945,  954,  965,
+      976,  987,  998, 1009, 1020, 1030, 1041, 1052, 1061, 1070,
+
+     1079, 1088, 1103, 1119, 1128, 1137, 1146, 1155, 1164, 1173,
+     1182, 1191, 1200, 1209, 1233, 1257, 1266, 1276, 1286, 1295,
+     1305, 1316, 1325, 1334, 1343, 1352, 1361, 1371, 1380, 1389,
+     1398, 1409, 1420, 1431, 1440, 1450, 1459, 1468, 1477, 1486,
+     1495, 1504, 1513, 1522, 1532, 1544, 1557, 1566, 1575, 1585,
+     1595, 1604, 1615, 1625, 1634, 1644, 1654, 1663, 1672, 1681,
+     1690, 1700, 1709, 1718, 1727, 1736, 1745, 1754, 1763, 1772,
+     1781, 1790, 1799, 1808, 1817, 1826, 1835, 1844, 1853, 1862,
+     1871, 1880, 1889, 1898, 1907, 1916, 1925, 1934, 1943, 1952,
+     1961, 1970, 1979, 1988, 1997, 2006, 2015, 2114, 2119, 2124,
+
+     2129, 2130, 2131, 2132, 2133, 2134, 2136, 2154, 2167, 2172,
+     2176, 2178, 2180, 2182
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1983,7 +2119,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1987 "dhcp6_lexer.cc"
+#line 2123 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -2009,8 +2145,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 2013 "dhcp6_lexer.cc"
-#line 2014 "dhcp6_lexer.cc"
+#line 2149 "dhcp6_lexer.cc"
+#line 2150 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2342,7 +2478,7 @@ YY_DECL
     }
 
 
-#line 2346 "dhcp6_lexer.cc"
+#line 2482 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2371,13 +2507,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1873 )
+				if ( yy_current_state >= 1934 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1872 );
+		while ( yy_current_state != 1933 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2396,13 +2532,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 208 )
+			else if ( yy_act < 215 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 208 )
+			else if ( yy_act == 215 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 209 )
+			else if ( yy_act == 216 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -3293,6 +3429,54 @@ YY_RULE_SETUP
 case 73:
 YY_RULE_SETUP
 #line 794 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_DURABILITY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("durability", driver.loc_);
+    }
+}
+	YY_BREAK
+case 74:
+YY_RULE_SETUP
+#line 803 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-format", driver.loc_);
+    }
+}
+	YY_BREAK
+case 75:
+YY_RULE_SETUP
+#line 812 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_MODE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-mode", driver.loc_);
+    }
+}
+	YY_BREAK
+case 76:
+YY_RULE_SETUP
+#line 821 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_WRITE_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-write-rate", driver.loc_);
+    }
+}
+	YY_BREAK
+case 77:
+YY_RULE_SETUP
+#line 830 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3304,9 +3488,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 78:
 YY_RULE_SETUP
-#line 805 "dhcp6_lexer.ll"
+#line 841 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3318,9 +3502,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 79:
 YY_RULE_SETUP
-#line 816 "dhcp6_lexer.ll"
+#line 852 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3332,9 +3516,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 80:
 YY_RULE_SETUP
-#line 827 "dhcp6_lexer.ll"
+#line 863 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3346,9 +3530,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 81:
 YY_RULE_SETUP
-#line 838 "dhcp6_lexer.ll"
+#line 874 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3360,9 +3544,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 82:
 YY_RULE_SETUP
-#line 849 "dhcp6_lexer.ll"
+#line 885 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3374,9 +3558,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 83:
 YY_RULE_SETUP
-#line 860 "dhcp6_lexer.ll"
+#line 896 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3388,9 +3572,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 84:
 YY_RULE_SETUP
-#line 871 "dhcp6_lexer.ll"
+#line 907 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3402,9 +3586,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 85:
 YY_RULE_SETUP
-#line 882 "dhcp6_lexer.ll"
+#line 918 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3414,9 +3598,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 86:
 YY_RULE_SETUP
-#line 891 "dhcp6_lexer.ll"
+#line 927 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3426,9 +3610,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 87:
 YY_RULE_SETUP
-#line 900 "dhcp6_lexer.ll"
+#line 936 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3438,9 +3622,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 88:
 YY_RULE_SETUP
-#line 909 "dhcp6_lexer.ll"
+#line 945 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3450,9 +3634,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 89:
 YY_RULE_SETUP
-#line 918 "dhcp6_lexer.ll"
+#line 954 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3464,9 +3648,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 90:
 YY_RULE_SETUP
-#line 929 "dhcp6_lexer.ll"
+#line 965 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3478,9 +3662,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 91:
 YY_RULE_SETUP
-#line 940 "dhcp6_lexer.ll"
+#line 976 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3492,9 +3676,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 92:
 YY_RULE_SETUP
-#line 951 "dhcp6_lexer.ll"
+#line 987 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3506,9 +3690,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 93:
 YY_RULE_SETUP
-#line 962 "dhcp6_lexer.ll"
+#line 998 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3520,9 +3704,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 94:
 YY_RULE_SETUP
-#line 973 "dhcp6_lexer.ll"
+#line 1009 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3534,9 +3718,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 95:
 YY_RULE_SETUP
-#line 984 "dhcp6_lexer.ll"
+#line 1020 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3547,9 +3731,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 96:
 YY_RULE_SETUP
-#line 994 "dhcp6_lexer.ll"
+#line 1030 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3561,9 +3745,47 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 97:
+YY_RULE_SETUP
+#line 1041 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+    case isc::dhcp::Parser6Context::SUBNET6:
+    case isc::dhcp::Parser6Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp6Parser::make_ALLOCATOR(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("allocator", driver.loc_);
+    }
+}
+	YY_BREAK
+case 98:
+YY_RULE_SETUP
+#line 1052 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_FREE_LEASE_INDEX(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("free-lease-index", driver.loc_);
+    }
+}
+	YY_BREAK
+case 99:
 YY_RULE_SETUP
-#line 1005 "dhcp6_lexer.ll"
+#line 1061 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_OPTION_ARENA(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("option-arena", driver.loc_);
+    }
+}
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+#line 1070 "dhcp6_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3573,9 +3795,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 101:
 YY_RULE_SETUP
-#line 1014 "dhcp6_lexer.ll"
+#line 1079 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3585,9 +3807,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 102:
 YY_RULE_SETUP
-#line 1023 "dhcp6_lexer.ll"
+#line 1088 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3603,9 +3825,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 103:
 YY_RULE_SETUP
-#line 1038 "dhcp6_lexer.ll"
+#line 1103 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3622,9 +3844,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 104:
 YY_RULE_SETUP
-#line 1054 "dhcp6_lexer.ll"
+#line 1119 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3634,9 +3856,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 105:
 YY_RULE_SETUP
-#line 1063 "dhcp6_lexer.ll"
+#line 1128 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3646,9 +3868,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 106:
 YY_RULE_SETUP
-#line 1072 "dhcp6_lexer.ll"
+#line 1137 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3658,9 +3880,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 107:
 YY_RULE_SETUP
-#line 1081 "dhcp6_lexer.ll"
+#line 1146 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3670,9 +3892,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 108:
 YY_RULE_SETUP
-#line 1090 "dhcp6_lexer.ll"
+#line 1155 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3682,9 +3904,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 109:
 YY_RULE_SETUP
-#line 1099 "dhcp6_lexer.ll"
+#line 1164 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3694,9 +3916,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 110:
 YY_RULE_SETUP
-#line 1108 "dhcp6_lexer.ll"
+#line 1173 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3706,9 +3928,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 111:
 YY_RULE_SETUP
-#line 1117 "dhcp6_lexer.ll"
+#line 1182 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3718,9 +3940,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 112:
 YY_RULE_SETUP
-#line 1126 "dhcp6_lexer.ll"
+#line 1191 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3730,9 +3952,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 113:
 YY_RULE_SETUP
-#line 1135 "dhcp6_lexer.ll"
+#line 1200 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -3742,9 +3964,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 114:
 YY_RULE_SETUP
-#line 1144 "dhcp6_lexer.ll"
+#line 1209 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3769,9 +3991,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 115:
 YY_RULE_SETUP
-#line 1168 "dhcp6_lexer.ll"
+#line 1233 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3796,9 +4018,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 116:
 YY_RULE_SETUP
-#line 1192 "dhcp6_lexer.ll"
+#line 1257 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3808,9 +4030,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 117:
 YY_RULE_SETUP
-#line 1201 "dhcp6_lexer.ll"
+#line 1266 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3821,9 +4043,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 118:
 YY_RULE_SETUP
-#line 1211 "dhcp6_lexer.ll"
+#line 1276 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3834,9 +4056,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 119:
 YY_RULE_SETUP
-#line 1221 "dhcp6_lexer.ll"
+#line 1286 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3846,9 +4068,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 120:
 YY_RULE_SETUP
-#line 1230 "dhcp6_lexer.ll"
+#line 1295 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3859,9 +4081,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 121:
 YY_RULE_SETUP
-#line 1240 "dhcp6_lexer.ll"
+#line 1305 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3873,9 +4095,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 122:
 YY_RULE_SETUP
-#line 1251 "dhcp6_lexer.ll"
+#line 1316 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3885,9 +4107,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 123:
 YY_RULE_SETUP
-#line 1260 "dhcp6_lexer.ll"
+#line 1325 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3897,9 +4119,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 124:
 YY_RULE_SETUP
-#line 1269 "dhcp6_lexer.ll"
+#line 1334 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3909,9 +4131,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 125:
 YY_RULE_SETUP
-#line 1278 "dhcp6_lexer.ll"
+#line 1343 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3921,9 +4143,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 126:
 YY_RULE_SETUP
-#line 1287 "dhcp6_lexer.ll"
+#line 1352 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3933,9 +4155,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 127:
 YY_RULE_SETUP
-#line 1296 "dhcp6_lexer.ll"
+#line 1361 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3946,9 +4168,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 128:
 YY_RULE_SETUP
-#line 1306 "dhcp6_lexer.ll"
+#line 1371 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3958,9 +4180,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 129:
 YY_RULE_SETUP
-#line 1315 "dhcp6_lexer.ll"
+#line 1380 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3970,9 +4192,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 130:
 YY_RULE_SETUP
-#line 1324 "dhcp6_lexer.ll"
+#line 1389 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3982,9 +4204,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 131:
 YY_RULE_SETUP
-#line 1333 "dhcp6_lexer.ll"
+#line 1398 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3996,9 +4218,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 132:
 YY_RULE_SETUP
-#line 1344 "dhcp6_lexer.ll"
+#line 1409 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4010,9 +4232,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 133:
 YY_RULE_SETUP
-#line 1355 "dhcp6_lexer.ll"
+#line 1420 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4024,9 +4246,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 134:
 YY_RULE_SETUP
-#line 1366 "dhcp6_lexer.ll"
+#line 1431 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4036,9 +4258,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 135:
 YY_RULE_SETUP
-#line 1375 "dhcp6_lexer.ll"
+#line 1440 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4049,9 +4271,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 136:
 YY_RULE_SETUP
-#line 1385 "dhcp6_lexer.ll"
+#line 1450 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -4061,9 +4283,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 137:
 YY_RULE_SETUP
-#line 1394 "dhcp6_lexer.ll"
+#line 1459 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4073,9 +4295,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 138:
 YY_RULE_SETUP
-#line 1403 "dhcp6_lexer.ll"
+#line 1468 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4085,9 +4307,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 139:
 YY_RULE_SETUP
-#line 1412 "dhcp6_lexer.ll"
+#line 1477 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4097,9 +4319,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 140:
 YY_RULE_SETUP
-#line 1421 "dhcp6_lexer.ll"
+#line 1486 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4109,9 +4331,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 141:
 YY_RULE_SETUP
-#line 1430 "dhcp6_lexer.ll"
+#line 1495 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4121,9 +4343,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 142:
 YY_RULE_SETUP
-#line 1439 "dhcp6_lexer.ll"
+#line 1504 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -4133,9 +4355,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 143:
 YY_RULE_SETUP
-#line 1448 "dhcp6_lexer.ll"
+#line 1513 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -4145,9 +4367,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 144:
 YY_RULE_SETUP
-#line 1457 "dhcp6_lexer.ll"
+#line 1522 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4158,9 +4380,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 145:
 YY_RULE_SETUP
-#line 1467 "dhcp6_lexer.ll"
+#line 1532 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4173,9 +4395,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 146:
 YY_RULE_SETUP
-#line 1479 "dhcp6_lexer.ll"
+#line 1544 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4189,9 +4411,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 147:
 YY_RULE_SETUP
-#line 1492 "dhcp6_lexer.ll"
+#line 1557 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -4201,9 +4423,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 148:
 YY_RULE_SETUP
-#line 1501 "dhcp6_lexer.ll"
+#line 1566 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -4213,9 +4435,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 149:
 YY_RULE_SETUP
-#line 1510 "dhcp6_lexer.ll"
+#line 1575 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4226,9 +4448,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 150:
 YY_RULE_SETUP
-#line 1520 "dhcp6_lexer.ll"
+#line 1585 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4239,9 +4461,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 151:
 YY_RULE_SETUP
-#line 1530 "dhcp6_lexer.ll"
+#line 1595 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4251,9 +4473,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 152:
 YY_RULE_SETUP
-#line 1539 "dhcp6_lexer.ll"
+#line 1604 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -4265,9 +4487,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 153:
 YY_RULE_SETUP
-#line 1550 "dhcp6_lexer.ll"
+#line 1615 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -4278,9 +4500,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 154:
 YY_RULE_SETUP
-#line 1560 "dhcp6_lexer.ll"
+#line 1625 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4290,9 +4512,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 155:
 YY_RULE_SETUP
-#line 1569 "dhcp6_lexer.ll"
+#line 1634 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -4303,9 +4525,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 156:
 YY_RULE_SETUP
-#line 1579 "dhcp6_lexer.ll"
+#line 1644 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4316,9 +4538,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 157:
 YY_RULE_SETUP
-#line 1589 "dhcp6_lexer.ll"
+#line 1654 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -4328,9 +4550,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 158:
 YY_RULE_SETUP
-#line 1598 "dhcp6_lexer.ll"
+#line 1663 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4340,9 +4562,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 159:
 YY_RULE_SETUP
-#line 1607 "dhcp6_lexer.ll"
+#line 1672 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4352,9 +4574,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 160:
 YY_RULE_SETUP
-#line 1616 "dhcp6_lexer.ll"
+#line 1681 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4364,9 +4586,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 161:
 YY_RULE_SETUP
-#line 1625 "dhcp6_lexer.ll"
+#line 1690 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4377,9 +4599,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 162:
 YY_RULE_SETUP
-#line 1635 "dhcp6_lexer.ll"
+#line 1700 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -4389,9 +4611,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 163:
 YY_RULE_SETUP
-#line 1644 "dhcp6_lexer.ll"
+#line 1709 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4401,9 +4623,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 164:
 YY_RULE_SETUP
-#line 1653 "dhcp6_lexer.ll"
+#line 1718 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4413,9 +4635,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 165:
 YY_RULE_SETUP
-#line 1662 "dhcp6_lexer.ll"
+#line 1727 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4425,9 +4647,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 166:
 YY_RULE_SETUP
-#line 1671 "dhcp6_lexer.ll"
+#line 1736 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4437,9 +4659,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 167:
 YY_RULE_SETUP
-#line 1680 "dhcp6_lexer.ll"
+#line 1745 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4449,9 +4671,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 168:
 YY_RULE_SETUP
-#line 1689 "dhcp6_lexer.ll"
+#line 1754 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4461,9 +4683,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 169:
 YY_RULE_SETUP
-#line 1698 "dhcp6_lexer.ll"
+#line 1763 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4473,9 +4695,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 163:
+case 170:
 YY_RULE_SETUP
-#line 1707 "dhcp6_lexer.ll"
+#line 1772 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4485,9 +4707,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 164:
+case 171:
 YY_RULE_SETUP
-#line 1716 "dhcp6_lexer.ll"
+#line 1781 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4497,9 +4719,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 165:
+case 172:
 YY_RULE_SETUP
-#line 1725 "dhcp6_lexer.ll"
+#line 1790 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4509,9 +4731,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 166:
+case 173:
 YY_RULE_SETUP
-#line 1734 "dhcp6_lexer.ll"
+#line 1799 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4521,9 +4743,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 167:
+case 174:
 YY_RULE_SETUP
-#line 1743 "dhcp6_lexer.ll"
+#line 1808 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4533,9 +4755,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 168:
+case 175:
 YY_RULE_SETUP
-#line 1752 "dhcp6_lexer.ll"
+#line 1817 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4545,9 +4767,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 169:
+case 176:
 YY_RULE_SETUP
-#line 1761 "dhcp6_lexer.ll"
+#line 1826 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4557,9 +4779,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 170:
+case 177:
 YY_RULE_SETUP
-#line 1770 "dhcp6_lexer.ll"
+#line 1835 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4569,9 +4791,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 171:
+case 178:
 YY_RULE_SETUP
-#line 1779 "dhcp6_lexer.ll"
+#line 1844 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4581,9 +4803,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 172:
+case 179:
 YY_RULE_SETUP
-#line 1788 "dhcp6_lexer.ll"
+#line 1853 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4593,9 +4815,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 173:
+case 180:
 YY_RULE_SETUP
-#line 1797 "dhcp6_lexer.ll"
+#line 1862 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4605,9 +4827,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 174:
+case 181:
 YY_RULE_SETUP
-#line 1806 "dhcp6_lexer.ll"
+#line 1871 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4617,9 +4839,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 175:
+case 182:
 YY_RULE_SETUP
-#line 1815 "dhcp6_lexer.ll"
+#line 1880 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4629,9 +4851,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 176:
+case 183:
 YY_RULE_SETUP
-#line 1824 "dhcp6_lexer.ll"
+#line 1889 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_MULTI_THREADING:
@@ -4641,9 +4863,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 177:
+case 184:
 YY_RULE_SETUP
-#line 1833 "dhcp6_lexer.ll"
+#line 1898 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_MULTI_THREADING:
@@ -4653,9 +4875,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 178:
+case 185:
 YY_RULE_SETUP
-#line 1842 "dhcp6_lexer.ll"
+#line 1907 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_MULTI_THREADING:
@@ -4665,9 +4887,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 179:
+case 186:
 YY_RULE_SETUP
-#line 1851 "dhcp6_lexer.ll"
+#line 1916 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4677,9 +4899,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 180:
+case 187:
 YY_RULE_SETUP
-#line 1860 "dhcp6_lexer.ll"
+#line 1925 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4689,9 +4911,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 181:
+case 188:
 YY_RULE_SETUP
-#line 1869 "dhcp6_lexer.ll"
+#line 1934 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4701,9 +4923,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 182:
+case 189:
 YY_RULE_SETUP
-#line 1878 "dhcp6_lexer.ll"
+#line 1943 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4713,9 +4935,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 183:
+case 190:
 YY_RULE_SETUP
-#line 1887 "dhcp6_lexer.ll"
+#line 1952 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4725,9 +4947,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 184:
+case 191:
 YY_RULE_SETUP
-#line 1896 "dhcp6_lexer.ll"
+#line 1961 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4737,9 +4959,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 185:
+case 192:
 YY_RULE_SETUP
-#line 1905 "dhcp6_lexer.ll"
+#line 1970 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4749,9 +4971,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 186:
+case 193:
 YY_RULE_SETUP
-#line 1914 "dhcp6_lexer.ll"
+#line 1979 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4761,9 +4983,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 187:
+case 194:
 YY_RULE_SETUP
-#line 1923 "dhcp6_lexer.ll"
+#line 1988 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4773,9 +4995,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 188:
+case 195:
 YY_RULE_SETUP
-#line 1932 "dhcp6_lexer.ll"
+#line 1997 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4785,9 +5007,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 189:
+case 196:
 YY_RULE_SETUP
-#line 1941 "dhcp6_lexer.ll"
+#line 2006 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4797,9 +5019,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 190:
+case 197:
 YY_RULE_SETUP
-#line 1950 "dhcp6_lexer.ll"
+#line 2015 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4899,65 +5121,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 191:
-/* rule 191 can match eol */
+case 198:
+/* rule 198 can match eol */
 YY_RULE_SETUP
-#line 2049 "dhcp6_lexer.ll"
+#line 2114 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 192:
-/* rule 192 can match eol */
+case 199:
+/* rule 199 can match eol */
 YY_RULE_SETUP
-#line 2054 "dhcp6_lexer.ll"
+#line 2119 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 193:
+case 200:
 YY_RULE_SETUP
-#line 2059 "dhcp6_lexer.ll"
+#line 2124 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 194:
+case 201:
 YY_RULE_SETUP
-#line 2064 "dhcp6_lexer.ll"
+#line 2129 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 195:
+case 202:
 YY_RULE_SETUP
-#line 2065 "dhcp6_lexer.ll"
+#line 2130 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 196:
+case 203:
 YY_RULE_SETUP
-#line 2066 "dhcp6_lexer.ll"
+#line 2131 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 197:
+case 204:
 YY_RULE_SETUP
-#line 2067 "dhcp6_lexer.ll"
+#line 2132 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 198:
+case 205:
 YY_RULE_SETUP
-#line 2068 "dhcp6_lexer.ll"
+#line 2133 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 199:
+case 206:
 YY_RULE_SETUP
-#line 2069 "dhcp6_lexer.ll"
+#line 2134 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 200:
+case 207:
 YY_RULE_SETUP
-#line 2071 "dhcp6_lexer.ll"
+#line 2136 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4976,9 +5198,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 201:
+case 208:
 YY_RULE_SETUP
-#line 2089 "dhcp6_lexer.ll"
+#line 2154 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4992,43 +5214,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 202:
+case 209:
 YY_RULE_SETUP
-#line 2102 "dhcp6_lexer.ll"
+#line 2167 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 203:
+case 210:
 YY_RULE_SETUP
-#line 2107 "dhcp6_lexer.ll"
+#line 2172 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 204:
+case 211:
 YY_RULE_SETUP
-#line 2111 "dhcp6_lexer.ll"
+#line 2176 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 205:
+case 212:
 YY_RULE_SETUP
-#line 2113 "dhcp6_lexer.ll"
+#line 2178 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 206:
+case 213:
 YY_RULE_SETUP
-#line 2115 "dhcp6_lexer.ll"
+#line 2180 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 207:
+case 214:
 YY_RULE_SETUP
-#line 2117 "dhcp6_lexer.ll"
+#line 2182 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 2119 "dhcp6_lexer.ll"
+#line 2184 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -5052,12 +5274,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 208:
+case 215:
 YY_RULE_SETUP
-#line 2142 "dhcp6_lexer.ll"
+#line 2207 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 5061 "dhcp6_lexer.cc"
+#line 5283 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -5376,7 +5598,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1873 )
+			if ( yy_current_state >= 1934 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5409,11 +5631,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1873 )
+		if ( yy_current_state >= 1934 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1872);
+	yy_is_jam = (yy_current_state == 1933);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -6162,8 +6384,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 2142 "dhcp6_lexer.ll"
-
+#line 2207 "dhcp6_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -6265,4 +6486,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
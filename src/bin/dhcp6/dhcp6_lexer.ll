@@ -790,6 +790,42 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"durability\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_DURABILITY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("durability", driver.loc_);
+    }
+}
+
+\"lfc-format\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-format", driver.loc_);
+    }
+}
+
+\"lfc-mode\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_MODE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-mode", driver.loc_);
+    }
+}
+
+\"lfc-write-rate\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_WRITE_RATE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-write-rate", driver.loc_);
+    }
+}
+
 \"preferred-lifetime\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -1001,6 +1037,35 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"allocator\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+    case isc::dhcp::Parser6Context::SUBNET6:
+    case isc::dhcp::Parser6Context::SHARED_NETWORK:
+        return isc::dhcp::Dhcp6Parser::make_ALLOCATOR(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("allocator", driver.loc_);
+    }
+}
+
+\"free-lease-index\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_FREE_LEASE_INDEX(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("free-lease-index", driver.loc_);
+    }
+}
+
+\"option-arena\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::DHCP6:
+        return isc::dhcp::Dhcp6Parser::make_OPTION_ARENA(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("option-arena", driver.loc_);
+    }
+}
+
 \"shared-networks\" {
     switch (driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
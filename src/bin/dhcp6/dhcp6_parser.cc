@@ -253,29 +253,29 @@ namespace isc { namespace dhcp {
   {
       switch (that.type_get ())
     {
-      case 220: // value
-      case 224: // map_value
-      case 265: // ddns_replace_client_name_value
-      case 302: // db_type
-      case 403: // hr_mode
-      case 539: // duid_type
-      case 582: // ncr_protocol_value
+      case 227: // value
+      case 231: // map_value
+      case 272: // ddns_replace_client_name_value
+      case 313: // db_type
+      case 421: // hr_mode
+      case 557: // duid_type
+      case 600: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 202: // "boolean"
+      case 209: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 201: // "floating point"
+      case 208: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 200: // "integer"
+      case 207: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 199: // "constant string"
+      case 206: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -294,29 +294,29 @@ namespace isc { namespace dhcp {
     state = that.state;
       switch (that.type_get ())
     {
-      case 220: // value
-      case 224: // map_value
-      case 265: // ddns_replace_client_name_value
-      case 302: // db_type
-      case 403: // hr_mode
-      case 539: // duid_type
-      case 582: // ncr_protocol_value
+      case 227: // value
+      case 231: // map_value
+      case 272: // ddns_replace_client_name_value
+      case 313: // db_type
+      case 421: // hr_mode
+      case 557: // duid_type
+      case 600: // ncr_protocol_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 202: // "boolean"
+      case 209: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 201: // "floating point"
+      case 208: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 200: // "integer"
+      case 207: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 199: // "constant string"
+      case 206: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -356,79 +356,79 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-            case 199: // "constant string"
+            case 206: // "constant string"
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< std::string > (); }
 #line 364 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 200: // "integer"
+      case 207: // "integer"
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< int64_t > (); }
 #line 371 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 201: // "floating point"
+      case 208: // "floating point"
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< double > (); }
 #line 378 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 202: // "boolean"
+      case 209: // "boolean"
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< bool > (); }
 #line 385 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 220: // value
+      case 227: // value
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 392 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 224: // map_value
+      case 231: // map_value
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 399 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 265: // ddns_replace_client_name_value
+      case 272: // ddns_replace_client_name_value
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 406 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 302: // db_type
+      case 313: // db_type
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 413 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 403: // hr_mode
+      case 421: // hr_mode
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 420 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 539: // duid_type
+      case 557: // duid_type
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 427 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 582: // ncr_protocol_value
+      case 600: // ncr_protocol_value
 
-#line 280 "dhcp6_parser.yy" // lalr1.cc:636
+#line 287 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 434 "dhcp6_parser.cc" // lalr1.cc:636
         break;
@@ -630,29 +630,29 @@ namespace isc { namespace dhcp {
          when using variants.  */
         switch (yyr1_[yyn])
     {
-      case 220: // value
-      case 224: // map_value
-      case 265: // ddns_replace_client_name_value
-      case 302: // db_type
-      case 403: // hr_mode
-      case 539: // duid_type
-      case 582: // ncr_protocol_value
+      case 227: // value
+      case 231: // map_value
+      case 272: // ddns_replace_client_name_value
+      case 313: // db_type
+      case 421: // hr_mode
+      case 557: // duid_type
+      case 600: // ncr_protocol_value
         yylhs.value.build< ElementPtr > ();
         break;
 
-      case 202: // "boolean"
+      case 209: // "boolean"
         yylhs.value.build< bool > ();
         break;
 
-      case 201: // "floating point"
+      case 208: // "floating point"
         yylhs.value.build< double > ();
         break;
 
-      case 200: // "integer"
+      case 207: // "integer"
         yylhs.value.build< int64_t > ();
         break;
 
-      case 199: // "constant string"
+      case 206: // "constant string"
         yylhs.value.build< std::string > ();
         break;
 
@@ -674,139 +674,139 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 289 "dhcp6_parser.yy" // lalr1.cc:859
+#line 296 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 680 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 4:
-#line 290 "dhcp6_parser.yy" // lalr1.cc:859
+#line 297 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG; }
 #line 686 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 6:
-#line 291 "dhcp6_parser.yy" // lalr1.cc:859
+#line 298 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP6; }
 #line 692 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 8:
-#line 292 "dhcp6_parser.yy" // lalr1.cc:859
+#line 299 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 698 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 10:
-#line 293 "dhcp6_parser.yy" // lalr1.cc:859
+#line 300 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.SUBNET6; }
 #line 704 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 12:
-#line 294 "dhcp6_parser.yy" // lalr1.cc:859
+#line 301 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.POOLS; }
 #line 710 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 14:
-#line 295 "dhcp6_parser.yy" // lalr1.cc:859
+#line 302 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.PD_POOLS; }
 #line 716 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 16:
-#line 296 "dhcp6_parser.yy" // lalr1.cc:859
+#line 303 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 722 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 18:
-#line 297 "dhcp6_parser.yy" // lalr1.cc:859
+#line 304 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP6; }
 #line 728 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 20:
-#line 298 "dhcp6_parser.yy" // lalr1.cc:859
+#line 305 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 734 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 22:
-#line 299 "dhcp6_parser.yy" // lalr1.cc:859
+#line 306 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 740 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 24:
-#line 300 "dhcp6_parser.yy" // lalr1.cc:859
+#line 307 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 746 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 26:
-#line 301 "dhcp6_parser.yy" // lalr1.cc:859
+#line 308 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 752 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 28:
-#line 302 "dhcp6_parser.yy" // lalr1.cc:859
+#line 309 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.LOGGING; }
 #line 758 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 30:
-#line 303 "dhcp6_parser.yy" // lalr1.cc:859
+#line 310 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG_CONTROL; }
 #line 764 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 32:
-#line 311 "dhcp6_parser.yy" // lalr1.cc:859
+#line 318 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 770 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 33:
-#line 312 "dhcp6_parser.yy" // lalr1.cc:859
+#line 319 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 776 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 34:
-#line 313 "dhcp6_parser.yy" // lalr1.cc:859
+#line 320 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 782 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 35:
-#line 314 "dhcp6_parser.yy" // lalr1.cc:859
+#line 321 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 788 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 36:
-#line 315 "dhcp6_parser.yy" // lalr1.cc:859
+#line 322 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 794 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 37:
-#line 316 "dhcp6_parser.yy" // lalr1.cc:859
+#line 323 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 800 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 38:
-#line 317 "dhcp6_parser.yy" // lalr1.cc:859
+#line 324 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 806 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 39:
-#line 320 "dhcp6_parser.yy" // lalr1.cc:859
+#line 327 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
@@ -815,7 +815,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 40:
-#line 325 "dhcp6_parser.yy" // lalr1.cc:859
+#line 332 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -826,7 +826,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 41:
-#line 330 "dhcp6_parser.yy" // lalr1.cc:859
+#line 337 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -836,13 +836,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 42:
-#line 336 "dhcp6_parser.yy" // lalr1.cc:859
+#line 343 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 842 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 45:
-#line 343 "dhcp6_parser.yy" // lalr1.cc:859
+#line 350 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
@@ -851,7 +851,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 46:
-#line 347 "dhcp6_parser.yy" // lalr1.cc:859
+#line 354 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -861,7 +861,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 47:
-#line 354 "dhcp6_parser.yy" // lalr1.cc:859
+#line 361 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -870,7 +870,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 48:
-#line 357 "dhcp6_parser.yy" // lalr1.cc:859
+#line 364 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -878,7 +878,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 51:
-#line 365 "dhcp6_parser.yy" // lalr1.cc:859
+#line 372 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -887,7 +887,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 52:
-#line 369 "dhcp6_parser.yy" // lalr1.cc:859
+#line 376 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -896,7 +896,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 53:
-#line 376 "dhcp6_parser.yy" // lalr1.cc:859
+#line 383 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // List parsing about to start
 }
@@ -904,7 +904,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 54:
-#line 378 "dhcp6_parser.yy" // lalr1.cc:859
+#line 385 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -913,7 +913,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 387 "dhcp6_parser.yy" // lalr1.cc:859
+#line 394 "dhcp6_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -922,7 +922,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 58:
-#line 391 "dhcp6_parser.yy" // lalr1.cc:859
+#line 398 "dhcp6_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -931,7 +931,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 59:
-#line 402 "dhcp6_parser.yy" // lalr1.cc:859
+#line 409 "dhcp6_parser.yy" // lalr1.cc:859
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as< std::string > ();
@@ -942,7 +942,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 60:
-#line 412 "dhcp6_parser.yy" // lalr1.cc:859
+#line 419 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -953,7 +953,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 61:
-#line 417 "dhcp6_parser.yy" // lalr1.cc:859
+#line 424 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -966,7 +966,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 70:
-#line 441 "dhcp6_parser.yy" // lalr1.cc:859
+#line 448 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -979,7 +979,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 71:
-#line 448 "dhcp6_parser.yy" // lalr1.cc:859
+#line 455 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -989,7 +989,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 72:
-#line 456 "dhcp6_parser.yy" // lalr1.cc:859
+#line 463 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -999,7 +999,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 73:
-#line 460 "dhcp6_parser.yy" // lalr1.cc:859
+#line 467 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     // parsing completed
@@ -1007,16 +1007,16 @@ namespace isc { namespace dhcp {
 #line 1008 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 129:
-#line 526 "dhcp6_parser.yy" // lalr1.cc:859
+  case 132:
+#line 536 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1016 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 130:
-#line 528 "dhcp6_parser.yy" // lalr1.cc:859
+  case 133:
+#line 538 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr datadir(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data-directory", datadir);
@@ -1025,8 +1025,8 @@ namespace isc { namespace dhcp {
 #line 1026 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 131:
-#line 534 "dhcp6_parser.yy" // lalr1.cc:859
+  case 134:
+#line 544 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
@@ -1034,8 +1034,8 @@ namespace isc { namespace dhcp {
 #line 1035 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 132:
-#line 539 "dhcp6_parser.yy" // lalr1.cc:859
+  case 135:
+#line 549 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-preferred-lifetime", prf);
@@ -1043,8 +1043,8 @@ namespace isc { namespace dhcp {
 #line 1044 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 133:
-#line 544 "dhcp6_parser.yy" // lalr1.cc:859
+  case 136:
+#line 554 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-preferred-lifetime", prf);
@@ -1052,8 +1052,8 @@ namespace isc { namespace dhcp {
 #line 1053 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 134:
-#line 549 "dhcp6_parser.yy" // lalr1.cc:859
+  case 137:
+#line 559 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1061,8 +1061,8 @@ namespace isc { namespace dhcp {
 #line 1062 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 135:
-#line 554 "dhcp6_parser.yy" // lalr1.cc:859
+  case 138:
+#line 564 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-valid-lifetime", prf);
@@ -1070,8 +1070,8 @@ namespace isc { namespace dhcp {
 #line 1071 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 136:
-#line 559 "dhcp6_parser.yy" // lalr1.cc:859
+  case 139:
+#line 569 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-valid-lifetime", prf);
@@ -1079,8 +1079,8 @@ namespace isc { namespace dhcp {
 #line 1080 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 137:
-#line 564 "dhcp6_parser.yy" // lalr1.cc:859
+  case 140:
+#line 574 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1088,8 +1088,8 @@ namespace isc { namespace dhcp {
 #line 1089 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 138:
-#line 569 "dhcp6_parser.yy" // lalr1.cc:859
+  case 141:
+#line 579 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1097,8 +1097,8 @@ namespace isc { namespace dhcp {
 #line 1098 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 139:
-#line 574 "dhcp6_parser.yy" // lalr1.cc:859
+  case 142:
+#line 584 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr ctt(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("calculate-tee-times", ctt);
@@ -1106,8 +1106,8 @@ namespace isc { namespace dhcp {
 #line 1107 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 140:
-#line 579 "dhcp6_parser.yy" // lalr1.cc:859
+  case 143:
+#line 589 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr t1(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t1-percent", t1);
@@ -1115,8 +1115,8 @@ namespace isc { namespace dhcp {
 #line 1116 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 141:
-#line 584 "dhcp6_parser.yy" // lalr1.cc:859
+  case 144:
+#line 594 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr t2(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t2-percent", t2);
@@ -1124,8 +1124,8 @@ namespace isc { namespace dhcp {
 #line 1125 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 142:
-#line 589 "dhcp6_parser.yy" // lalr1.cc:859
+  case 145:
+#line 599 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1133,8 +1133,8 @@ namespace isc { namespace dhcp {
 #line 1134 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 143:
-#line 594 "dhcp6_parser.yy" // lalr1.cc:859
+  case 146:
+#line 604 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-send-updates", b);
@@ -1142,8 +1142,8 @@ namespace isc { namespace dhcp {
 #line 1143 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 144:
-#line 599 "dhcp6_parser.yy" // lalr1.cc:859
+  case 147:
+#line 609 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-no-update", b);
@@ -1151,8 +1151,8 @@ namespace isc { namespace dhcp {
 #line 1152 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 145:
-#line 604 "dhcp6_parser.yy" // lalr1.cc:859
+  case 148:
+#line 614 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-client-update", b);
@@ -1160,16 +1160,16 @@ namespace isc { namespace dhcp {
 #line 1161 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 146:
-#line 609 "dhcp6_parser.yy" // lalr1.cc:859
+  case 149:
+#line 619 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
 #line 1169 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 147:
-#line 611 "dhcp6_parser.yy" // lalr1.cc:859
+  case 150:
+#line 621 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ddns-replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1177,40 +1177,40 @@ namespace isc { namespace dhcp {
 #line 1178 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 148:
-#line 617 "dhcp6_parser.yy" // lalr1.cc:859
+  case 151:
+#line 627 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
 #line 1186 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 149:
-#line 620 "dhcp6_parser.yy" // lalr1.cc:859
+  case 152:
+#line 630 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
 #line 1194 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 150:
-#line 623 "dhcp6_parser.yy" // lalr1.cc:859
+  case 153:
+#line 633 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
 #line 1202 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 151:
-#line 626 "dhcp6_parser.yy" // lalr1.cc:859
+  case 154:
+#line 636 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
 #line 1210 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 152:
-#line 629 "dhcp6_parser.yy" // lalr1.cc:859
+  case 155:
+#line 639 "dhcp6_parser.yy" // lalr1.cc:859
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
@@ -1218,16 +1218,16 @@ namespace isc { namespace dhcp {
 #line 1219 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 153:
-#line 635 "dhcp6_parser.yy" // lalr1.cc:859
+  case 156:
+#line 645 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1227 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 154:
-#line 637 "dhcp6_parser.yy" // lalr1.cc:859
+  case 157:
+#line 647 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-generated-prefix", s);
@@ -1236,16 +1236,16 @@ namespace isc { namespace dhcp {
 #line 1237 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 155:
-#line 643 "dhcp6_parser.yy" // lalr1.cc:859
+  case 158:
+#line 653 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1245 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 156:
-#line 645 "dhcp6_parser.yy" // lalr1.cc:859
+  case 159:
+#line 655 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-qualifying-suffix", s);
@@ -1254,16 +1254,16 @@ namespace isc { namespace dhcp {
 #line 1255 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 157:
-#line 651 "dhcp6_parser.yy" // lalr1.cc:859
+  case 160:
+#line 661 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1263 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 158:
-#line 653 "dhcp6_parser.yy" // lalr1.cc:859
+  case 161:
+#line 663 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
@@ -1272,16 +1272,16 @@ namespace isc { namespace dhcp {
 #line 1273 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 159:
-#line 659 "dhcp6_parser.yy" // lalr1.cc:859
+  case 162:
+#line 669 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1281 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 160:
-#line 661 "dhcp6_parser.yy" // lalr1.cc:859
+  case 163:
+#line 671 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
@@ -1290,8 +1290,8 @@ namespace isc { namespace dhcp {
 #line 1291 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 161:
-#line 667 "dhcp6_parser.yy" // lalr1.cc:859
+  case 164:
+#line 677 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("store-extended-info", b);
@@ -1299,509 +1299,608 @@ namespace isc { namespace dhcp {
 #line 1300 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 162:
-#line 672 "dhcp6_parser.yy" // lalr1.cc:859
+  case 165:
+#line 682 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1308 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 166:
+#line 684 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr a(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("allocator", a);
+    ctx.leave();
+}
+#line 1318 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 167:
+#line 690 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("free-lease-index", b);
+}
+#line 1327 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 168:
+#line 695 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("option-arena", b);
+}
+#line 1336 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 169:
+#line 700 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr count(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("statistic-default-sample-count", count);
 }
-#line 1309 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1345 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 163:
-#line 677 "dhcp6_parser.yy" // lalr1.cc:859
+  case 170:
+#line 705 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr age(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("statistic-default-sample-age", age);
 }
-#line 1318 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1354 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 164:
-#line 682 "dhcp6_parser.yy" // lalr1.cc:859
+  case 171:
+#line 710 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1326 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1362 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 165:
-#line 684 "dhcp6_parser.yy" // lalr1.cc:859
+  case 172:
+#line 712 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr stag(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
     ctx.leave();
 }
-#line 1336 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1372 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 166:
-#line 690 "dhcp6_parser.yy" // lalr1.cc:859
+  case 173:
+#line 718 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1347 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1383 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 167:
-#line 695 "dhcp6_parser.yy" // lalr1.cc:859
+  case 174:
+#line 723 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1357 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1393 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 168:
-#line 701 "dhcp6_parser.yy" // lalr1.cc:859
+  case 175:
+#line 729 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1367 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1403 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 169:
-#line 705 "dhcp6_parser.yy" // lalr1.cc:859
+  case 176:
+#line 733 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1376 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1412 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 177:
-#line 721 "dhcp6_parser.yy" // lalr1.cc:859
+  case 184:
+#line 749 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1387 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1423 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 178:
-#line 726 "dhcp6_parser.yy" // lalr1.cc:859
+  case 185:
+#line 754 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1396 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1432 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 179:
-#line 731 "dhcp6_parser.yy" // lalr1.cc:859
+  case 186:
+#line 759 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1405 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1441 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 180:
-#line 736 "dhcp6_parser.yy" // lalr1.cc:859
+  case 187:
+#line 764 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1416 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1452 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 181:
-#line 741 "dhcp6_parser.yy" // lalr1.cc:859
+  case 188:
+#line 769 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1427 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1463 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 182:
-#line 748 "dhcp6_parser.yy" // lalr1.cc:859
+  case 189:
+#line 776 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1438 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1474 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 183:
-#line 753 "dhcp6_parser.yy" // lalr1.cc:859
+  case 190:
+#line 781 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1449 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1485 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 184:
-#line 760 "dhcp6_parser.yy" // lalr1.cc:859
+  case 191:
+#line 788 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1460 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1496 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 185:
-#line 765 "dhcp6_parser.yy" // lalr1.cc:859
+  case 192:
+#line 793 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1469 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1505 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 190:
-#line 778 "dhcp6_parser.yy" // lalr1.cc:859
+  case 197:
+#line 806 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1479 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1515 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 191:
-#line 782 "dhcp6_parser.yy" // lalr1.cc:859
+  case 198:
+#line 810 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1489 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1525 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 215:
-#line 815 "dhcp6_parser.yy" // lalr1.cc:859
+  case 226:
+#line 847 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1497 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1533 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 216:
-#line 817 "dhcp6_parser.yy" // lalr1.cc:859
+  case 227:
+#line 849 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1506 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1542 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 217:
-#line 822 "dhcp6_parser.yy" // lalr1.cc:859
+  case 228:
+#line 854 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1512 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1548 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 218:
-#line 823 "dhcp6_parser.yy" // lalr1.cc:859
+  case 229:
+#line 855 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1518 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1554 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 219:
-#line 824 "dhcp6_parser.yy" // lalr1.cc:859
+  case 230:
+#line 856 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1524 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1560 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 220:
-#line 825 "dhcp6_parser.yy" // lalr1.cc:859
+  case 231:
+#line 857 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1530 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1566 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 221:
-#line 828 "dhcp6_parser.yy" // lalr1.cc:859
+  case 232:
+#line 860 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1538 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1574 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 222:
-#line 830 "dhcp6_parser.yy" // lalr1.cc:859
+  case 233:
+#line 862 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1548 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1584 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 223:
-#line 836 "dhcp6_parser.yy" // lalr1.cc:859
+  case 234:
+#line 868 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1556 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1592 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 224:
-#line 838 "dhcp6_parser.yy" // lalr1.cc:859
+  case 235:
+#line 870 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1566 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1602 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 225:
-#line 844 "dhcp6_parser.yy" // lalr1.cc:859
+  case 236:
+#line 876 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1574 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1610 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 226:
-#line 846 "dhcp6_parser.yy" // lalr1.cc:859
+  case 237:
+#line 878 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1584 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1620 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 227:
-#line 852 "dhcp6_parser.yy" // lalr1.cc:859
+  case 238:
+#line 884 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1593 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1629 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 228:
-#line 857 "dhcp6_parser.yy" // lalr1.cc:859
+  case 239:
+#line 889 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1601 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1637 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 229:
-#line 859 "dhcp6_parser.yy" // lalr1.cc:859
+  case 240:
+#line 891 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1611 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1647 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 230:
-#line 865 "dhcp6_parser.yy" // lalr1.cc:859
+  case 241:
+#line 897 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1620 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1656 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 231:
-#line 870 "dhcp6_parser.yy" // lalr1.cc:859
+  case 242:
+#line 902 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1629 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1665 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 232:
-#line 875 "dhcp6_parser.yy" // lalr1.cc:859
+  case 243:
+#line 907 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1638 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1674 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 233:
-#line 880 "dhcp6_parser.yy" // lalr1.cc:859
+  case 244:
+#line 912 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1647 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1683 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 234:
-#line 885 "dhcp6_parser.yy" // lalr1.cc:859
+  case 245:
+#line 917 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1656 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1692 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 235:
-#line 890 "dhcp6_parser.yy" // lalr1.cc:859
+  case 246:
+#line 922 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-row-errors", n);
 }
-#line 1665 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1701 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 236:
-#line 895 "dhcp6_parser.yy" // lalr1.cc:859
+  case 247:
+#line 927 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1709 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 248:
+#line 929 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("durability", d);
+    ctx.leave();
+}
+#line 1719 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 249:
+#line 935 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1727 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 250:
+#line 937 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr f(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-format", f);
+    ctx.leave();
+}
+#line 1737 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 251:
+#line 943 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1745 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 252:
+#line 945 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr m(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-mode", m);
+    ctx.leave();
+}
+#line 1755 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 253:
+#line 951 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-write-rate", n);
+}
+#line 1764 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 254:
+#line 956 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1674 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1773 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 237:
-#line 900 "dhcp6_parser.yy" // lalr1.cc:859
+  case 255:
+#line 961 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1683 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1782 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 238:
-#line 905 "dhcp6_parser.yy" // lalr1.cc:859
+  case 256:
+#line 966 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1692 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1791 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 239:
-#line 910 "dhcp6_parser.yy" // lalr1.cc:859
+  case 257:
+#line 971 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1700 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1799 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 240:
-#line 912 "dhcp6_parser.yy" // lalr1.cc:859
+  case 258:
+#line 973 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1710 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1809 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 241:
-#line 918 "dhcp6_parser.yy" // lalr1.cc:859
+  case 259:
+#line 979 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1719 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1818 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 242:
-#line 923 "dhcp6_parser.yy" // lalr1.cc:859
+  case 260:
+#line 984 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1727 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1826 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 243:
-#line 925 "dhcp6_parser.yy" // lalr1.cc:859
+  case 261:
+#line 986 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1737 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1836 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 244:
-#line 931 "dhcp6_parser.yy" // lalr1.cc:859
+  case 262:
+#line 992 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1745 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1844 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 245:
-#line 933 "dhcp6_parser.yy" // lalr1.cc:859
+  case 263:
+#line 994 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
     ctx.leave();
 }
-#line 1755 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1854 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 246:
-#line 939 "dhcp6_parser.yy" // lalr1.cc:859
+  case 264:
+#line 1000 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1763 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1862 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 247:
-#line 941 "dhcp6_parser.yy" // lalr1.cc:859
+  case 265:
+#line 1002 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
     ctx.leave();
 }
-#line 1773 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1872 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 248:
-#line 947 "dhcp6_parser.yy" // lalr1.cc:859
+  case 266:
+#line 1008 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1784 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1883 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 249:
-#line 952 "dhcp6_parser.yy" // lalr1.cc:859
+  case 267:
+#line 1013 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1793 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1892 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 253:
-#line 962 "dhcp6_parser.yy" // lalr1.cc:859
+  case 271:
+#line 1023 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1801 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1900 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 254:
-#line 964 "dhcp6_parser.yy" // lalr1.cc:859
+  case 272:
+#line 1025 "dhcp6_parser.yy" // lalr1.cc:859
     {
 
     if ( (string(yystack_[0].value.as< std::string > ()) == "none") ||
@@ -1817,356 +1916,356 @@ namespace isc { namespace dhcp {
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1821 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1920 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 255:
-#line 980 "dhcp6_parser.yy" // lalr1.cc:859
+  case 273:
+#line 1041 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1832 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1931 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 256:
-#line 985 "dhcp6_parser.yy" // lalr1.cc:859
+  case 274:
+#line 1046 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1841 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1940 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 261:
-#line 998 "dhcp6_parser.yy" // lalr1.cc:859
+  case 279:
+#line 1059 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1850 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1949 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 262:
-#line 1003 "dhcp6_parser.yy" // lalr1.cc:859
+  case 280:
+#line 1064 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1859 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1958 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 263:
-#line 1008 "dhcp6_parser.yy" // lalr1.cc:859
+  case 281:
+#line 1069 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1870 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1969 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 264:
-#line 1013 "dhcp6_parser.yy" // lalr1.cc:859
+  case 282:
+#line 1074 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1879 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1978 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 270:
-#line 1027 "dhcp6_parser.yy" // lalr1.cc:859
+  case 288:
+#line 1088 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1888 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1987 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 271:
-#line 1032 "dhcp6_parser.yy" // lalr1.cc:859
+  case 289:
+#line 1093 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1897 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1996 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 272:
-#line 1039 "dhcp6_parser.yy" // lalr1.cc:859
+  case 290:
+#line 1100 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1908 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2007 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 273:
-#line 1044 "dhcp6_parser.yy" // lalr1.cc:859
+  case 291:
+#line 1105 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1917 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2016 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 274:
-#line 1051 "dhcp6_parser.yy" // lalr1.cc:859
+  case 292:
+#line 1112 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr mt(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("multi-threading", mt);
     ctx.stack_.push_back(mt);
     ctx.enter(ctx.DHCP_MULTI_THREADING);
 }
-#line 1928 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2027 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 275:
-#line 1056 "dhcp6_parser.yy" // lalr1.cc:859
+  case 293:
+#line 1117 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The enable parameter is required.
     ctx.require("enable-multi-threading", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1939 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2038 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 284:
-#line 1075 "dhcp6_parser.yy" // lalr1.cc:859
+  case 302:
+#line 1136 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-multi-threading", b);
 }
-#line 1948 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2047 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 285:
-#line 1080 "dhcp6_parser.yy" // lalr1.cc:859
+  case 303:
+#line 1141 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("thread-pool-size", prf);
 }
-#line 1957 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2056 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 286:
-#line 1085 "dhcp6_parser.yy" // lalr1.cc:859
+  case 304:
+#line 1146 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("packet-queue-size", prf);
 }
-#line 1966 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2065 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 287:
-#line 1090 "dhcp6_parser.yy" // lalr1.cc:859
+  case 305:
+#line 1151 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1977 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2076 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 288:
-#line 1095 "dhcp6_parser.yy" // lalr1.cc:859
+  case 306:
+#line 1156 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1986 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2085 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 293:
-#line 1108 "dhcp6_parser.yy" // lalr1.cc:859
+  case 311:
+#line 1169 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1996 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2095 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 294:
-#line 1112 "dhcp6_parser.yy" // lalr1.cc:859
+  case 312:
+#line 1173 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2006 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2105 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 295:
-#line 1118 "dhcp6_parser.yy" // lalr1.cc:859
+  case 313:
+#line 1179 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2016 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2115 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 296:
-#line 1122 "dhcp6_parser.yy" // lalr1.cc:859
+  case 314:
+#line 1183 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2026 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2125 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 302:
-#line 1137 "dhcp6_parser.yy" // lalr1.cc:859
+  case 320:
+#line 1198 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2034 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2133 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 303:
-#line 1139 "dhcp6_parser.yy" // lalr1.cc:859
+  case 321:
+#line 1200 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 2044 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2143 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 304:
-#line 1145 "dhcp6_parser.yy" // lalr1.cc:859
+  case 322:
+#line 1206 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2052 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2151 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 305:
-#line 1147 "dhcp6_parser.yy" // lalr1.cc:859
+  case 323:
+#line 1208 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2061 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2160 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 306:
-#line 1153 "dhcp6_parser.yy" // lalr1.cc:859
+  case 324:
+#line 1214 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 2072 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2171 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 307:
-#line 1158 "dhcp6_parser.yy" // lalr1.cc:859
+  case 325:
+#line 1219 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2082 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2181 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 316:
-#line 1176 "dhcp6_parser.yy" // lalr1.cc:859
+  case 334:
+#line 1237 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 2091 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2190 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 317:
-#line 1181 "dhcp6_parser.yy" // lalr1.cc:859
+  case 335:
+#line 1242 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 2100 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2199 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 318:
-#line 1186 "dhcp6_parser.yy" // lalr1.cc:859
+  case 336:
+#line 1247 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 2109 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2208 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 319:
-#line 1191 "dhcp6_parser.yy" // lalr1.cc:859
+  case 337:
+#line 1252 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 2118 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2217 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 320:
-#line 1196 "dhcp6_parser.yy" // lalr1.cc:859
+  case 338:
+#line 1257 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 2127 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2226 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 321:
-#line 1201 "dhcp6_parser.yy" // lalr1.cc:859
+  case 339:
+#line 1262 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 2136 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2235 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 322:
-#line 1209 "dhcp6_parser.yy" // lalr1.cc:859
+  case 340:
+#line 1270 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 2147 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2246 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 323:
-#line 1214 "dhcp6_parser.yy" // lalr1.cc:859
+  case 341:
+#line 1275 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2156 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2255 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 328:
-#line 1234 "dhcp6_parser.yy" // lalr1.cc:859
+  case 346:
+#line 1295 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2166 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2265 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 329:
-#line 1238 "dhcp6_parser.yy" // lalr1.cc:859
+  case 347:
+#line 1299 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -2188,267 +2287,267 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2192 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2291 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 330:
-#line 1260 "dhcp6_parser.yy" // lalr1.cc:859
+  case 348:
+#line 1321 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2202 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2301 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 331:
-#line 1264 "dhcp6_parser.yy" // lalr1.cc:859
+  case 349:
+#line 1325 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The subnet subnet6 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2212 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2311 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 370:
-#line 1314 "dhcp6_parser.yy" // lalr1.cc:859
+  case 389:
+#line 1376 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2220 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2319 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 371:
-#line 1316 "dhcp6_parser.yy" // lalr1.cc:859
+  case 390:
+#line 1378 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 2230 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2329 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 372:
-#line 1322 "dhcp6_parser.yy" // lalr1.cc:859
+  case 391:
+#line 1384 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2238 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2337 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 373:
-#line 1324 "dhcp6_parser.yy" // lalr1.cc:859
+  case 392:
+#line 1386 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2248 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2347 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 374:
-#line 1330 "dhcp6_parser.yy" // lalr1.cc:859
+  case 393:
+#line 1392 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2256 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2355 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 375:
-#line 1332 "dhcp6_parser.yy" // lalr1.cc:859
+  case 394:
+#line 1394 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 2266 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2365 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 376:
-#line 1338 "dhcp6_parser.yy" // lalr1.cc:859
+  case 395:
+#line 1400 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2274 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2373 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 377:
-#line 1340 "dhcp6_parser.yy" // lalr1.cc:859
+  case 396:
+#line 1402 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2284 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2383 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 378:
-#line 1346 "dhcp6_parser.yy" // lalr1.cc:859
+  case 397:
+#line 1408 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2295 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2394 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 379:
-#line 1351 "dhcp6_parser.yy" // lalr1.cc:859
+  case 398:
+#line 1413 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2304 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2403 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 380:
-#line 1356 "dhcp6_parser.yy" // lalr1.cc:859
+  case 399:
+#line 1418 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2312 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2411 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 381:
-#line 1358 "dhcp6_parser.yy" // lalr1.cc:859
+  case 400:
+#line 1420 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2321 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2420 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 382:
-#line 1363 "dhcp6_parser.yy" // lalr1.cc:859
+  case 401:
+#line 1425 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2327 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2426 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 383:
-#line 1364 "dhcp6_parser.yy" // lalr1.cc:859
+  case 402:
+#line 1426 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2333 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2432 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 384:
-#line 1365 "dhcp6_parser.yy" // lalr1.cc:859
+  case 403:
+#line 1427 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2339 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2438 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 385:
-#line 1366 "dhcp6_parser.yy" // lalr1.cc:859
+  case 404:
+#line 1428 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2345 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2444 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 386:
-#line 1369 "dhcp6_parser.yy" // lalr1.cc:859
+  case 405:
+#line 1431 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2354 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2453 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 387:
-#line 1374 "dhcp6_parser.yy" // lalr1.cc:859
+  case 406:
+#line 1436 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 2363 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2462 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 388:
-#line 1381 "dhcp6_parser.yy" // lalr1.cc:859
+  case 407:
+#line 1443 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2374 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2473 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 389:
-#line 1386 "dhcp6_parser.yy" // lalr1.cc:859
+  case 408:
+#line 1448 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2383 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2482 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 394:
-#line 1401 "dhcp6_parser.yy" // lalr1.cc:859
+  case 413:
+#line 1463 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2393 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2492 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 395:
-#line 1405 "dhcp6_parser.yy" // lalr1.cc:859
+  case 414:
+#line 1467 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 2401 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2500 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 431:
-#line 1452 "dhcp6_parser.yy" // lalr1.cc:859
+  case 451:
+#line 1515 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2412 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2511 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 432:
-#line 1457 "dhcp6_parser.yy" // lalr1.cc:859
+  case 452:
+#line 1520 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2421 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2520 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 433:
-#line 1465 "dhcp6_parser.yy" // lalr1.cc:859
+  case 453:
+#line 1528 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2430 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2529 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 434:
-#line 1468 "dhcp6_parser.yy" // lalr1.cc:859
+  case 454:
+#line 1531 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 2438 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2537 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 439:
-#line 1484 "dhcp6_parser.yy" // lalr1.cc:859
+  case 459:
+#line 1547 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2448 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2547 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 440:
-#line 1488 "dhcp6_parser.yy" // lalr1.cc:859
+  case 460:
+#line 1551 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2456,21 +2555,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2460 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2559 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 441:
-#line 1499 "dhcp6_parser.yy" // lalr1.cc:859
+  case 461:
+#line 1562 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2470 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2569 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 442:
-#line 1503 "dhcp6_parser.yy" // lalr1.cc:859
+  case 462:
+#line 1566 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2478,281 +2577,281 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2482 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2581 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 458:
-#line 1535 "dhcp6_parser.yy" // lalr1.cc:859
+  case 478:
+#line 1598 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2491 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2590 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 460:
-#line 1542 "dhcp6_parser.yy" // lalr1.cc:859
+  case 480:
+#line 1605 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2499 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2598 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 461:
-#line 1544 "dhcp6_parser.yy" // lalr1.cc:859
+  case 481:
+#line 1607 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2509 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2608 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 462:
-#line 1550 "dhcp6_parser.yy" // lalr1.cc:859
+  case 482:
+#line 1613 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2517 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2616 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 463:
-#line 1552 "dhcp6_parser.yy" // lalr1.cc:859
+  case 483:
+#line 1615 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2527 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2626 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 464:
-#line 1558 "dhcp6_parser.yy" // lalr1.cc:859
+  case 484:
+#line 1621 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2535 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2634 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 465:
-#line 1560 "dhcp6_parser.yy" // lalr1.cc:859
+  case 485:
+#line 1623 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2545 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2644 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 467:
-#line 1568 "dhcp6_parser.yy" // lalr1.cc:859
+  case 487:
+#line 1631 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2553 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2652 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 468:
-#line 1570 "dhcp6_parser.yy" // lalr1.cc:859
+  case 488:
+#line 1633 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2563 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2662 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 469:
-#line 1576 "dhcp6_parser.yy" // lalr1.cc:859
+  case 489:
+#line 1639 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2572 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2671 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 470:
-#line 1585 "dhcp6_parser.yy" // lalr1.cc:859
+  case 490:
+#line 1648 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2583 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2682 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 471:
-#line 1590 "dhcp6_parser.yy" // lalr1.cc:859
+  case 491:
+#line 1653 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2592 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2691 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 476:
-#line 1609 "dhcp6_parser.yy" // lalr1.cc:859
+  case 496:
+#line 1672 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2602 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2701 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 477:
-#line 1613 "dhcp6_parser.yy" // lalr1.cc:859
+  case 497:
+#line 1676 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2611 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2710 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 478:
-#line 1621 "dhcp6_parser.yy" // lalr1.cc:859
+  case 498:
+#line 1684 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2621 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2720 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 479:
-#line 1625 "dhcp6_parser.yy" // lalr1.cc:859
+  case 499:
+#line 1688 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2630 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2729 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 494:
-#line 1658 "dhcp6_parser.yy" // lalr1.cc:859
+  case 514:
+#line 1721 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2638 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2737 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 495:
-#line 1660 "dhcp6_parser.yy" // lalr1.cc:859
+  case 515:
+#line 1723 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2648 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2747 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 498:
-#line 1670 "dhcp6_parser.yy" // lalr1.cc:859
+  case 518:
+#line 1733 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2657 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2756 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 499:
-#line 1675 "dhcp6_parser.yy" // lalr1.cc:859
+  case 519:
+#line 1738 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2666 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2765 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 500:
-#line 1683 "dhcp6_parser.yy" // lalr1.cc:859
+  case 520:
+#line 1746 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2677 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2776 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 501:
-#line 1688 "dhcp6_parser.yy" // lalr1.cc:859
+  case 521:
+#line 1751 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2686 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2785 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 506:
-#line 1703 "dhcp6_parser.yy" // lalr1.cc:859
+  case 526:
+#line 1766 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2696 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2795 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 507:
-#line 1707 "dhcp6_parser.yy" // lalr1.cc:859
+  case 527:
+#line 1770 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2706 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2805 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 508:
-#line 1713 "dhcp6_parser.yy" // lalr1.cc:859
+  case 528:
+#line 1776 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2716 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2815 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 509:
-#line 1717 "dhcp6_parser.yy" // lalr1.cc:859
+  case 529:
+#line 1780 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2726 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2825 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 519:
-#line 1736 "dhcp6_parser.yy" // lalr1.cc:859
+  case 539:
+#line 1799 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2734 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2833 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 520:
-#line 1738 "dhcp6_parser.yy" // lalr1.cc:859
+  case 540:
+#line 1801 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2744 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2843 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 521:
-#line 1744 "dhcp6_parser.yy" // lalr1.cc:859
+  case 541:
+#line 1807 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2752 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2851 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 522:
-#line 1746 "dhcp6_parser.yy" // lalr1.cc:859
+  case 542:
+#line 1809 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
@@ -2775,19 +2874,19 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2779 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2878 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 523:
-#line 1769 "dhcp6_parser.yy" // lalr1.cc:859
+  case 543:
+#line 1832 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2787 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2886 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 524:
-#line 1771 "dhcp6_parser.yy" // lalr1.cc:859
+  case 544:
+#line 1834 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -2812,41 +2911,41 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2816 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2915 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 525:
-#line 1799 "dhcp6_parser.yy" // lalr1.cc:859
+  case 545:
+#line 1862 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2827 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2926 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 526:
-#line 1804 "dhcp6_parser.yy" // lalr1.cc:859
+  case 546:
+#line 1867 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2836 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2935 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 531:
-#line 1819 "dhcp6_parser.yy" // lalr1.cc:859
+  case 551:
+#line 1882 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2846 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2945 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 532:
-#line 1823 "dhcp6_parser.yy" // lalr1.cc:859
+  case 552:
+#line 1886 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2854,21 +2953,21 @@ namespace isc { namespace dhcp {
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2858 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2957 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 533:
-#line 1831 "dhcp6_parser.yy" // lalr1.cc:859
+  case 553:
+#line 1894 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2868 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2967 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 534:
-#line 1835 "dhcp6_parser.yy" // lalr1.cc:859
+  case 554:
+#line 1898 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2876,1203 +2975,1203 @@ namespace isc { namespace dhcp {
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2880 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2979 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 548:
-#line 1860 "dhcp6_parser.yy" // lalr1.cc:859
+  case 568:
+#line 1923 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2888 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2987 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 549:
-#line 1862 "dhcp6_parser.yy" // lalr1.cc:859
+  case 569:
+#line 1925 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2898 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2997 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 550:
-#line 1868 "dhcp6_parser.yy" // lalr1.cc:859
+  case 570:
+#line 1931 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2907 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3006 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 551:
-#line 1873 "dhcp6_parser.yy" // lalr1.cc:859
+  case 571:
+#line 1936 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2915 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3014 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 552:
-#line 1875 "dhcp6_parser.yy" // lalr1.cc:859
+  case 572:
+#line 1938 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2925 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3024 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 553:
-#line 1881 "dhcp6_parser.yy" // lalr1.cc:859
+  case 573:
+#line 1944 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2934 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3033 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 554:
-#line 1886 "dhcp6_parser.yy" // lalr1.cc:859
+  case 574:
+#line 1949 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr deleg(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2943 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3042 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 555:
-#line 1894 "dhcp6_parser.yy" // lalr1.cc:859
+  case 575:
+#line 1957 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2954 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3053 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 556:
-#line 1899 "dhcp6_parser.yy" // lalr1.cc:859
+  case 576:
+#line 1962 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2963 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3062 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 561:
-#line 1912 "dhcp6_parser.yy" // lalr1.cc:859
+  case 581:
+#line 1975 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2973 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3072 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 562:
-#line 1916 "dhcp6_parser.yy" // lalr1.cc:859
+  case 582:
+#line 1979 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2982 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3081 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 563:
-#line 1921 "dhcp6_parser.yy" // lalr1.cc:859
+  case 583:
+#line 1984 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2992 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3091 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 564:
-#line 1925 "dhcp6_parser.yy" // lalr1.cc:859
+  case 584:
+#line 1988 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 3001 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3100 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 580:
-#line 1952 "dhcp6_parser.yy" // lalr1.cc:859
+  case 600:
+#line 2015 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3012 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3111 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 581:
-#line 1957 "dhcp6_parser.yy" // lalr1.cc:859
+  case 601:
+#line 2020 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3021 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3120 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 582:
-#line 1962 "dhcp6_parser.yy" // lalr1.cc:859
+  case 602:
+#line 2025 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3032 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3131 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 583:
-#line 1967 "dhcp6_parser.yy" // lalr1.cc:859
+  case 603:
+#line 2030 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3041 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3140 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 584:
-#line 1972 "dhcp6_parser.yy" // lalr1.cc:859
+  case 604:
+#line 2035 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3049 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3148 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 585:
-#line 1974 "dhcp6_parser.yy" // lalr1.cc:859
+  case 605:
+#line 2037 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 3059 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3158 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 586:
-#line 1980 "dhcp6_parser.yy" // lalr1.cc:859
+  case 606:
+#line 2043 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3067 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3166 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 587:
-#line 1982 "dhcp6_parser.yy" // lalr1.cc:859
+  case 607:
+#line 2045 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 3077 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3176 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 588:
-#line 1988 "dhcp6_parser.yy" // lalr1.cc:859
+  case 608:
+#line 2051 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3085 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3184 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 589:
-#line 1990 "dhcp6_parser.yy" // lalr1.cc:859
+  case 609:
+#line 2053 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 3095 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3194 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 590:
-#line 1996 "dhcp6_parser.yy" // lalr1.cc:859
+  case 610:
+#line 2059 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3103 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3202 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 591:
-#line 1998 "dhcp6_parser.yy" // lalr1.cc:859
+  case 611:
+#line 2061 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 3113 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3212 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 592:
-#line 2004 "dhcp6_parser.yy" // lalr1.cc:859
+  case 612:
+#line 2067 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3124 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3223 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 593:
-#line 2009 "dhcp6_parser.yy" // lalr1.cc:859
+  case 613:
+#line 2072 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3133 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3232 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 594:
-#line 2017 "dhcp6_parser.yy" // lalr1.cc:859
+  case 614:
+#line 2080 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 3144 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3243 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 595:
-#line 2022 "dhcp6_parser.yy" // lalr1.cc:859
+  case 615:
+#line 2085 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3153 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3252 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 598:
-#line 2031 "dhcp6_parser.yy" // lalr1.cc:859
+  case 618:
+#line 2094 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3161 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3260 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 599:
-#line 2033 "dhcp6_parser.yy" // lalr1.cc:859
+  case 619:
+#line 2096 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 3171 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3270 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 600:
-#line 2042 "dhcp6_parser.yy" // lalr1.cc:859
+  case 620:
+#line 2105 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 3182 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3281 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 601:
-#line 2047 "dhcp6_parser.yy" // lalr1.cc:859
+  case 621:
+#line 2110 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3191 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3290 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 604:
-#line 2056 "dhcp6_parser.yy" // lalr1.cc:859
+  case 624:
+#line 2119 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3201 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3300 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 605:
-#line 2060 "dhcp6_parser.yy" // lalr1.cc:859
+  case 625:
+#line 2123 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 3211 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3310 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 618:
-#line 2085 "dhcp6_parser.yy" // lalr1.cc:859
+  case 638:
+#line 2148 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3219 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3318 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 619:
-#line 2087 "dhcp6_parser.yy" // lalr1.cc:859
+  case 639:
+#line 2150 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 3229 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3328 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 620:
-#line 2093 "dhcp6_parser.yy" // lalr1.cc:859
+  case 640:
+#line 2156 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 3238 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3337 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 621:
-#line 2101 "dhcp6_parser.yy" // lalr1.cc:859
+  case 641:
+#line 2164 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 3249 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3348 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 622:
-#line 2106 "dhcp6_parser.yy" // lalr1.cc:859
+  case 642:
+#line 2169 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required.
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3260 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3359 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 634:
-#line 2128 "dhcp6_parser.yy" // lalr1.cc:859
+  case 654:
+#line 2191 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 3268 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3367 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 635:
-#line 2130 "dhcp6_parser.yy" // lalr1.cc:859
+  case 655:
+#line 2193 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3277 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3376 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 636:
-#line 2135 "dhcp6_parser.yy" // lalr1.cc:859
+  case 656:
+#line 2198 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 3283 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3382 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 637:
-#line 2136 "dhcp6_parser.yy" // lalr1.cc:859
+  case 657:
+#line 2199 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 3289 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3388 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 638:
-#line 2137 "dhcp6_parser.yy" // lalr1.cc:859
+  case 658:
+#line 2200 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 3295 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3394 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 639:
-#line 2140 "dhcp6_parser.yy" // lalr1.cc:859
+  case 659:
+#line 2203 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr htype(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 3304 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3403 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 640:
-#line 2145 "dhcp6_parser.yy" // lalr1.cc:859
+  case 660:
+#line 2208 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3312 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3411 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 641:
-#line 2147 "dhcp6_parser.yy" // lalr1.cc:859
+  case 661:
+#line 2210 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 3322 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3421 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 642:
-#line 2153 "dhcp6_parser.yy" // lalr1.cc:859
+  case 662:
+#line 2216 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 3331 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3430 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 643:
-#line 2158 "dhcp6_parser.yy" // lalr1.cc:859
+  case 663:
+#line 2221 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 3340 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3439 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 644:
-#line 2165 "dhcp6_parser.yy" // lalr1.cc:859
+  case 664:
+#line 2228 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3349 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3448 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 645:
-#line 2172 "dhcp6_parser.yy" // lalr1.cc:859
+  case 665:
+#line 2235 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3360 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3459 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 646:
-#line 2177 "dhcp6_parser.yy" // lalr1.cc:859
+  case 666:
+#line 2240 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3369 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3468 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 654:
-#line 2193 "dhcp6_parser.yy" // lalr1.cc:859
+  case 674:
+#line 2256 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3377 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3476 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 655:
-#line 2195 "dhcp6_parser.yy" // lalr1.cc:859
+  case 675:
+#line 2258 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3387 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3486 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 656:
-#line 2201 "dhcp6_parser.yy" // lalr1.cc:859
+  case 676:
+#line 2264 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3395 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3494 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 657:
-#line 2203 "dhcp6_parser.yy" // lalr1.cc:859
+  case 677:
+#line 2266 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3405 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3504 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 658:
-#line 2212 "dhcp6_parser.yy" // lalr1.cc:859
+  case 678:
+#line 2275 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr qc(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-queue-control", qc);
     ctx.stack_.push_back(qc);
     ctx.enter(ctx.DHCP_QUEUE_CONTROL);
 }
-#line 3416 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3515 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 659:
-#line 2217 "dhcp6_parser.yy" // lalr1.cc:859
+  case 679:
+#line 2280 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The enable queue parameter is required.
     ctx.require("enable-queue", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3427 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3526 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 668:
-#line 2236 "dhcp6_parser.yy" // lalr1.cc:859
+  case 688:
+#line 2299 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-queue", b);
 }
-#line 3436 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3535 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 669:
-#line 2241 "dhcp6_parser.yy" // lalr1.cc:859
+  case 689:
+#line 2304 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3444 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3543 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 670:
-#line 2243 "dhcp6_parser.yy" // lalr1.cc:859
+  case 690:
+#line 2306 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr qt(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("queue-type", qt);
     ctx.leave();
 }
-#line 3454 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3553 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 671:
-#line 2249 "dhcp6_parser.yy" // lalr1.cc:859
+  case 691:
+#line 2312 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("capacity", c);
 }
-#line 3463 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3562 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 672:
-#line 2254 "dhcp6_parser.yy" // lalr1.cc:859
+  case 692:
+#line 2317 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3471 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3570 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 673:
-#line 2256 "dhcp6_parser.yy" // lalr1.cc:859
+  case 693:
+#line 2319 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set(yystack_[3].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3480 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3579 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 674:
-#line 2263 "dhcp6_parser.yy" // lalr1.cc:859
+  case 694:
+#line 2326 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3491 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3590 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 675:
-#line 2268 "dhcp6_parser.yy" // lalr1.cc:859
+  case 695:
+#line 2331 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3502 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3601 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 676:
-#line 2275 "dhcp6_parser.yy" // lalr1.cc:859
+  case 696:
+#line 2338 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3512 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3611 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 677:
-#line 2279 "dhcp6_parser.yy" // lalr1.cc:859
+  case 697:
+#line 2342 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3522 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3621 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 698:
-#line 2309 "dhcp6_parser.yy" // lalr1.cc:859
+  case 718:
+#line 2372 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3531 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3630 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 699:
-#line 2314 "dhcp6_parser.yy" // lalr1.cc:859
+  case 719:
+#line 2377 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3539 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3638 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 700:
-#line 2316 "dhcp6_parser.yy" // lalr1.cc:859
+  case 720:
+#line 2379 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3549 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3648 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 701:
-#line 2322 "dhcp6_parser.yy" // lalr1.cc:859
+  case 721:
+#line 2385 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3557 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3656 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 702:
-#line 2324 "dhcp6_parser.yy" // lalr1.cc:859
+  case 722:
+#line 2387 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3567 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3666 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 703:
-#line 2330 "dhcp6_parser.yy" // lalr1.cc:859
+  case 723:
+#line 2393 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3576 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3675 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 704:
-#line 2335 "dhcp6_parser.yy" // lalr1.cc:859
+  case 724:
+#line 2398 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3584 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3683 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 705:
-#line 2337 "dhcp6_parser.yy" // lalr1.cc:859
+  case 725:
+#line 2400 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3594 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3693 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 706:
-#line 2343 "dhcp6_parser.yy" // lalr1.cc:859
+  case 726:
+#line 2406 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3603 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3702 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 707:
-#line 2348 "dhcp6_parser.yy" // lalr1.cc:859
+  case 727:
+#line 2411 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3612 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3711 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 708:
-#line 2353 "dhcp6_parser.yy" // lalr1.cc:859
+  case 728:
+#line 2416 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3620 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3719 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 709:
-#line 2355 "dhcp6_parser.yy" // lalr1.cc:859
+  case 729:
+#line 2418 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3629 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3728 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 710:
-#line 2361 "dhcp6_parser.yy" // lalr1.cc:859
+  case 730:
+#line 2424 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3635 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3734 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 711:
-#line 2362 "dhcp6_parser.yy" // lalr1.cc:859
+  case 731:
+#line 2425 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3641 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3740 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 712:
-#line 2365 "dhcp6_parser.yy" // lalr1.cc:859
+  case 732:
+#line 2428 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3649 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3748 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 713:
-#line 2367 "dhcp6_parser.yy" // lalr1.cc:859
+  case 733:
+#line 2430 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3659 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3758 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 714:
-#line 2374 "dhcp6_parser.yy" // lalr1.cc:859
+  case 734:
+#line 2437 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3668 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3767 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 715:
-#line 2380 "dhcp6_parser.yy" // lalr1.cc:859
+  case 735:
+#line 2443 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3677 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3776 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 716:
-#line 2386 "dhcp6_parser.yy" // lalr1.cc:859
+  case 736:
+#line 2449 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3685 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3784 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 717:
-#line 2388 "dhcp6_parser.yy" // lalr1.cc:859
+  case 737:
+#line 2451 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3694 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3793 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 718:
-#line 2394 "dhcp6_parser.yy" // lalr1.cc:859
+  case 738:
+#line 2457 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3702 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3801 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 719:
-#line 2396 "dhcp6_parser.yy" // lalr1.cc:859
+  case 739:
+#line 2459 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3712 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3811 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 720:
-#line 2403 "dhcp6_parser.yy" // lalr1.cc:859
+  case 740:
+#line 2466 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3720 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3819 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 721:
-#line 2405 "dhcp6_parser.yy" // lalr1.cc:859
+  case 741:
+#line 2468 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3730 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3829 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 722:
-#line 2412 "dhcp6_parser.yy" // lalr1.cc:859
+  case 742:
+#line 2475 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3738 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3837 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 723:
-#line 2414 "dhcp6_parser.yy" // lalr1.cc:859
+  case 743:
+#line 2477 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3748 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3847 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 724:
-#line 2423 "dhcp6_parser.yy" // lalr1.cc:859
+  case 744:
+#line 2486 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3756 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3855 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 725:
-#line 2425 "dhcp6_parser.yy" // lalr1.cc:859
+  case 745:
+#line 2488 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3765 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3864 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 726:
-#line 2430 "dhcp6_parser.yy" // lalr1.cc:859
+  case 746:
+#line 2493 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3773 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3872 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 727:
-#line 2432 "dhcp6_parser.yy" // lalr1.cc:859
+  case 747:
+#line 2495 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3782 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3881 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 728:
-#line 2437 "dhcp6_parser.yy" // lalr1.cc:859
+  case 748:
+#line 2500 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3790 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3889 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 729:
-#line 2439 "dhcp6_parser.yy" // lalr1.cc:859
+  case 749:
+#line 2502 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3799 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3898 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 730:
-#line 2446 "dhcp6_parser.yy" // lalr1.cc:859
+  case 750:
+#line 2509 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3810 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3909 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 731:
-#line 2451 "dhcp6_parser.yy" // lalr1.cc:859
+  case 751:
+#line 2514 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3820 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3919 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 732:
-#line 2457 "dhcp6_parser.yy" // lalr1.cc:859
+  case 752:
+#line 2520 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3830 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3929 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 733:
-#line 2461 "dhcp6_parser.yy" // lalr1.cc:859
+  case 753:
+#line 2524 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No config_control params are required
     // parsing completed
 }
-#line 3839 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3938 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 738:
-#line 2476 "dhcp6_parser.yy" // lalr1.cc:859
+  case 758:
+#line 2539 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3850 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3949 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 739:
-#line 2481 "dhcp6_parser.yy" // lalr1.cc:859
+  case 759:
+#line 2544 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3859 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3958 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 740:
-#line 2486 "dhcp6_parser.yy" // lalr1.cc:859
+  case 760:
+#line 2549 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3868 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3967 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 741:
-#line 2496 "dhcp6_parser.yy" // lalr1.cc:859
+  case 761:
+#line 2559 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3879 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3978 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 742:
-#line 2501 "dhcp6_parser.yy" // lalr1.cc:859
+  case 762:
+#line 2564 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3888 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3987 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 743:
-#line 2506 "dhcp6_parser.yy" // lalr1.cc:859
+  case 763:
+#line 2569 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3898 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3997 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 744:
-#line 2510 "dhcp6_parser.yy" // lalr1.cc:859
+  case 764:
+#line 2573 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 3906 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4005 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 748:
-#line 2526 "dhcp6_parser.yy" // lalr1.cc:859
+  case 768:
+#line 2589 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3917 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4016 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 749:
-#line 2531 "dhcp6_parser.yy" // lalr1.cc:859
+  case 769:
+#line 2594 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3926 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4025 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 752:
-#line 2543 "dhcp6_parser.yy" // lalr1.cc:859
+  case 772:
+#line 2606 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3936 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4035 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 753:
-#line 2547 "dhcp6_parser.yy" // lalr1.cc:859
+  case 773:
+#line 2610 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3944 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4043 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 763:
-#line 2564 "dhcp6_parser.yy" // lalr1.cc:859
+  case 783:
+#line 2627 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3953 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4052 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 764:
-#line 2569 "dhcp6_parser.yy" // lalr1.cc:859
+  case 784:
+#line 2632 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3961 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4060 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 765:
-#line 2571 "dhcp6_parser.yy" // lalr1.cc:859
+  case 785:
+#line 2634 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3971 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4070 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 766:
-#line 2577 "dhcp6_parser.yy" // lalr1.cc:859
+  case 786:
+#line 2640 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3982 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4081 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 767:
-#line 2582 "dhcp6_parser.yy" // lalr1.cc:859
+  case 787:
+#line 2645 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3991 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4090 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 770:
-#line 2591 "dhcp6_parser.yy" // lalr1.cc:859
+  case 790:
+#line 2654 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 4001 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4100 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 771:
-#line 2595 "dhcp6_parser.yy" // lalr1.cc:859
+  case 791:
+#line 2658 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 4009 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4108 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 779:
-#line 2610 "dhcp6_parser.yy" // lalr1.cc:859
+  case 799:
+#line 2673 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4017 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4116 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 780:
-#line 2612 "dhcp6_parser.yy" // lalr1.cc:859
+  case 800:
+#line 2675 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 4027 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4126 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 781:
-#line 2618 "dhcp6_parser.yy" // lalr1.cc:859
+  case 801:
+#line 2681 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 4036 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4135 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 782:
-#line 2623 "dhcp6_parser.yy" // lalr1.cc:859
+  case 802:
+#line 2686 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 4045 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4144 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 783:
-#line 2628 "dhcp6_parser.yy" // lalr1.cc:859
+  case 803:
+#line 2691 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 4054 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4153 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 784:
-#line 2633 "dhcp6_parser.yy" // lalr1.cc:859
+  case 804:
+#line 2696 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4062 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4161 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 785:
-#line 2635 "dhcp6_parser.yy" // lalr1.cc:859
+  case 805:
+#line 2698 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 4072 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4171 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
 
-#line 4076 "dhcp6_parser.cc" // lalr1.cc:859
+#line 4175 "dhcp6_parser.cc" // lalr1.cc:859
             default:
               break;
             }
@@ -4327,141 +4426,144 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp6Parser::yypact_ninf_ = -961;
+  const short int Dhcp6Parser::yypact_ninf_ = -987;
 
   const signed char Dhcp6Parser::yytable_ninf_ = -1;
 
   const short int
   Dhcp6Parser::yypact_[] =
   {
-     403,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,    50,    36,    45,    47,
-      51,    65,    75,   119,   154,   164,   186,   197,   198,   208,
-     259,   279,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,    36,  -155,    26,   685,    31,   209,    91,   105,
-     108,    21,    81,   262,   -25,   205,   -52,    86,  -961,   122,
-     159,   284,   286,   306,  -961,  -961,  -961,  -961,  -961,   308,
-    -961,    43,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,   309,   322,   323,   324,   326,   335,
-     346,   348,   349,   369,   395,   396,  -961,   399,   402,   413,
-     418,   419,  -961,  -961,  -961,   422,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,   428,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,    76,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,   430,  -961,    93,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,   431,
-     432,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,   100,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,   113,  -961,  -961,
-    -961,  -961,  -961,   434,  -961,   435,   438,  -961,  -961,  -961,
-    -961,  -961,  -961,   121,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,   333,   340,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,   408,  -961,  -961,   439,  -961,  -961,  -961,   440,  -961,
-    -961,   437,   443,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,   445,   446,  -961,  -961,
-    -961,  -961,   444,   459,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,   176,  -961,  -961,  -961,
-     462,  -961,  -961,   464,  -961,   465,   466,  -961,  -961,   474,
-     475,  -961,  -961,  -961,  -961,  -961,  -961,  -961,   203,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,   221,  -961,  -961,  -961,   478,
-     240,  -961,  -961,  -961,  -961,    36,    36,  -961,   264,   479,
-     480,   481,   482,   483,  -961,    26,  -961,   484,   485,   486,
-     490,   491,   493,   298,   299,   300,   301,   302,   304,   312,
-     314,   305,   315,   316,   318,   502,   319,   320,   329,   332,
-     334,   511,   520,   522,   336,   531,   535,   536,   537,   540,
-     541,   542,   543,   547,   548,   549,   550,   551,   552,   568,
-     569,   375,   570,   580,   598,   601,   604,   607,   609,   685,
-    -961,   610,   414,    31,  -961,   613,   614,   616,   617,   619,
-     424,   425,   622,   624,   625,   209,  -961,   626,    91,  -961,
-     627,   436,   628,   441,   442,   105,  -961,   630,   633,   634,
-     635,   636,   639,   640,  -961,   108,  -961,   641,   642,   447,
-     644,   645,   646,   449,  -961,    81,   651,   455,   457,  -961,
-     262,   656,   657,   -54,  -961,   460,   659,   660,   467,   661,
-     473,   476,   662,   670,   477,   487,   671,   673,   674,   677,
-     205,  -961,   -52,  -961,   678,   488,    86,  -961,  -961,  -961,
-     679,   514,   683,    36,    36,    36,  -961,   494,   687,   688,
-     691,   692,   680,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,   503,  -961,  -961,  -961,  -961,
-    -961,  -105,   507,   508,  -961,   696,   703,   704,   705,   512,
-     155,   708,   709,   710,   712,   711,   714,   715,   716,   747,
-     748,  -961,   749,   750,   751,   752,   523,   524,   755,  -961,
-     756,  -961,  -961,   757,   758,   565,   566,   567,  -961,  -961,
-     756,   571,   760,  -961,   574,  -961,   575,  -961,   576,  -961,
-    -961,  -961,   756,   756,   756,   577,   578,   581,   582,  -961,
-     583,   589,  -961,   591,   592,   593,  -961,  -961,   594,  -961,
-    -961,  -961,   596,    36,  -961,  -961,   597,   599,  -961,   600,
-    -961,  -961,   102,   528,  -961,  -961,  -105,   602,   603,   605,
-    -961,  -961,   763,  -961,  -961,    36,   685,   -52,  -961,  -961,
-    -961,  -961,    86,    31,   106,   106,   762,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,   772,   790,   793,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,   798,   -48,    36,
-      70,   706,   800,   801,   803,   245,    68,   145,   195,    94,
-     205,  -961,  -961,   804,  -961,  -961,   805,   807,  -961,  -961,
-    -961,  -961,  -961,   -68,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,   762,  -961,   303,   307,   313,   321,  -961,
-    -961,  -961,  -961,   811,   812,   813,   814,   815,  -961,   816,
-     819,  -961,  -961,  -961,   820,   821,   823,   824,  -961,   337,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,   339,  -961,   825,   681,  -961,  -961,   826,   707,  -961,
-    -961,   828,   827,  -961,  -961,   829,   833,  -961,  -961,   831,
-     835,  -961,  -961,  -961,   107,  -961,  -961,  -961,   834,  -961,
-    -961,  -961,   166,  -961,  -961,  -961,  -961,   373,  -961,  -961,
-    -961,   211,  -961,  -961,   836,   838,  -961,  -961,   837,   841,
-    -961,   842,   843,   844,   845,   846,   847,   374,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,   848,   849,   852,
-    -961,  -961,  -961,  -961,   377,  -961,  -961,  -961,  -961,  -961,
-    -961,   854,   855,   856,  -961,   380,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,   381,  -961,  -961,
-    -961,   857,  -961,   858,  -961,  -961,  -961,   383,  -961,  -961,
-    -961,  -961,  -961,   384,  -961,   272,  -961,   664,  -961,   839,
-     861,  -961,  -961,   859,   863,  -961,  -961,  -961,   860,  -961,
-     864,  -961,  -961,  -961,  -961,   865,   867,   868,   869,   667,
-     637,   675,   672,   676,   873,   682,   686,   874,   875,   876,
-     689,   690,   693,   694,   106,  -961,  -961,   106,  -961,   762,
-     209,  -961,   772,    81,  -961,   790,   262,  -961,   793,   517,
-    -961,   798,   -48,  -961,  -961,    70,  -961,   877,   706,  -961,
-      -1,   800,  -961,   108,  -961,   801,   -25,  -961,   803,   697,
-     698,   699,   700,   701,   702,   245,  -961,   879,   881,   713,
-     719,   721,    68,  -961,   722,   730,   735,   145,  -961,   883,
-     884,   195,  -961,   734,   887,   737,   888,    94,  -961,  -961,
-     147,   804,  -961,  -961,   890,   900,    91,  -961,   805,   105,
-    -961,   807,   889,  -961,  -961,   405,   740,   742,   744,  -961,
-    -961,  -961,  -961,  -961,   745,  -961,  -961,   753,   771,   778,
-    -961,  -961,  -961,  -961,  -961,   387,  -961,   390,  -961,   896,
-    -961,   897,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,   393,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,   781,  -961,  -961,   903,  -961,  -961,  -961,  -961,  -961,
-     906,   905,  -961,  -961,  -961,  -961,  -961,   938,  -961,   394,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,    97,   784,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,   787,   809,
-    -961,  -961,   840,  -961,    36,  -961,  -961,   907,  -961,  -961,
-    -961,  -961,  -961,   404,  -961,  -961,  -961,  -961,  -961,  -961,
-     850,   410,  -961,   411,  -961,   851,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,   517,  -961,  -961,   946,   759,  -961,    -1,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-     947,   754,   951,   147,  -961,  -961,  -961,  -961,  -961,  -961,
-     853,  -961,  -961,   984,  -961,   862,  -961,  -961,   985,  -961,
-    -961,   273,  -961,   -14,   985,  -961,  -961,   993,   996,  1007,
-    -961,   412,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  1009,
-     830,   866,   870,  1026,   -14,  -961,   872,  -961,  -961,  -961,
-     878,  -961,  -961,  -961
+     380,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,    68,    36,    82,    89,
+     103,   109,   174,   177,   187,   214,   216,   225,   227,   234,
+     262,   263,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,    36,   -88,    40,   661,    41,   210,   107,     9,
+      86,    95,    84,   133,   -78,   188,    17,    47,  -987,   196,
+     221,   251,   275,   281,  -987,  -987,  -987,  -987,  -987,   296,
+    -987,    59,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,   298,   312,   316,   320,   328,   330,
+     332,   339,   355,   356,   362,   363,  -987,   365,   375,   408,
+     419,   428,  -987,  -987,  -987,   429,  -987,   436,   438,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,   440,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,   105,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,   441,  -987,   156,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,   442,   444,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,   162,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,   168,  -987,  -987,  -987,  -987,  -987,
+     445,  -987,   448,   449,  -987,  -987,  -987,  -987,  -987,  -987,
+     217,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,   279,   327,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,   381,  -987,
+    -987,   450,  -987,  -987,  -987,   451,  -987,  -987,   402,   453,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,   455,   456,  -987,  -987,  -987,  -987,   463,
+     469,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,   230,  -987,  -987,  -987,   472,  -987,  -987,
+     474,  -987,   475,   476,  -987,  -987,   484,   485,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,   232,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,   248,  -987,  -987,  -987,   488,   283,  -987,  -987,
+    -987,  -987,    36,    36,  -987,   267,   489,   490,   491,   492,
+     493,  -987,    40,  -987,   494,   495,   496,   500,   501,   503,
+     215,   301,   302,   303,   304,   305,   307,   309,   308,   314,
+     317,   319,   520,   321,   322,   318,   325,   335,   526,   527,
+     532,   336,   537,   337,   340,   544,   546,   547,   550,   551,
+     552,   553,   557,   558,   559,   560,   561,   562,   582,   583,
+     584,   382,   586,   587,   588,   589,   590,   591,   592,   661,
+    -987,   593,   390,    41,  -987,   594,   596,   597,   598,   599,
+     398,   400,   600,   602,   603,   210,  -987,   604,   107,  -987,
+     606,   404,   608,   407,   409,     9,  -987,   609,   611,   613,
+     614,   615,   616,   617,  -987,    86,  -987,   618,   619,   420,
+     620,   622,   625,   421,  -987,    84,   627,   424,   425,  -987,
+     133,   631,   632,   -80,  -987,   430,   633,   634,   433,   637,
+     435,   437,   639,   641,   443,   446,   642,   643,   645,   646,
+     188,  -987,    17,  -987,   647,   447,    47,  -987,  -987,  -987,
+     649,   650,   651,    36,    36,    36,  -987,   454,   652,   654,
+     655,   656,   659,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,   459,  -987,  -987,  -987,  -987,
+    -987,  -103,   468,   471,  -987,   481,  -987,  -987,   664,   670,
+     673,   681,   483,   326,   685,   686,   687,   689,   688,   691,
+     692,   693,   694,   695,  -987,   696,   698,   699,   700,   502,
+     531,   738,  -987,   739,  -987,  -987,   740,   741,   541,   542,
+     543,  -987,  -987,   739,   545,   743,  -987,   554,  -987,   556,
+    -987,   565,  -987,  -987,  -987,   739,   739,   739,   567,   568,
+     569,   570,  -987,   572,   573,  -987,   574,   575,   576,  -987,
+    -987,   577,  -987,  -987,  -987,   578,    36,  -987,  -987,   579,
+     581,  -987,   585,  -987,  -987,   -75,   528,  -987,  -987,  -103,
+     595,   601,   605,  -987,  -987,   747,  -987,  -987,    36,   661,
+      17,  -987,  -987,  -987,  -987,    47,    41,   111,   111,   746,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+     749,   750,   751,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,   752,   -77,    36,   -34,   653,   757,   758,   781,   244,
+      33,   195,   178,   218,   188,  -987,  -987,   783,  -987,  -987,
+     785,   786,  -987,  -987,  -987,  -987,  -987,   -73,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,   746,  -987,   290,
+     291,   293,   311,  -987,  -987,  -987,  -987,   790,   791,   793,
+     794,   795,  -987,   796,   798,  -987,  -987,  -987,   799,   802,
+     804,   806,  -987,  -987,  -987,   809,  -987,   315,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,   354,  -987,   808,   697,  -987,  -987,   811,
+     812,  -987,  -987,   813,   815,  -987,  -987,   814,   818,  -987,
+    -987,   816,   820,  -987,  -987,  -987,    76,  -987,  -987,  -987,
+     819,  -987,  -987,  -987,   114,  -987,  -987,  -987,  -987,   360,
+    -987,  -987,  -987,   130,  -987,  -987,   821,   823,  -987,  -987,
+     822,   826,  -987,   827,   828,   829,   830,   831,   832,   377,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,   835,
+     837,   838,  -987,  -987,  -987,  -987,   385,  -987,  -987,  -987,
+    -987,  -987,  -987,   839,   840,   841,  -987,   387,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,   388,
+    -987,  -987,  -987,   842,  -987,   843,  -987,  -987,  -987,   389,
+    -987,  -987,  -987,  -987,  -987,   395,  -987,   180,  -987,   624,
+    -987,   844,   845,  -987,  -987,   846,   848,  -987,  -987,  -987,
+     648,  -987,   847,  -987,  -987,  -987,  -987,   850,   851,   852,
+     853,   657,   640,   658,   660,   663,   854,   665,   666,   855,
+     856,   857,   667,   668,   662,   669,   858,   859,   862,   671,
+     111,  -987,  -987,   111,  -987,   746,   210,  -987,   749,    84,
+    -987,   750,   133,  -987,   751,  1029,  -987,   752,   -77,  -987,
+    -987,   -34,  -987,   864,   653,  -987,   123,   757,  -987,    86,
+    -987,   758,   -78,  -987,   781,   672,   674,   675,   676,   677,
+     678,   244,  -987,   873,   876,   679,   680,   682,    33,  -987,
+     683,   684,   690,   195,  -987,   884,   886,   178,  -987,   701,
+     889,   702,   890,   218,  -987,  -987,   155,   783,  -987,  -987,
+     892,   893,   107,  -987,   785,     9,  -987,   786,   891,  -987,
+    -987,   414,   705,   706,   707,  -987,  -987,  -987,  -987,  -987,
+     708,  -987,  -987,   709,   710,   711,  -987,  -987,  -987,  -987,
+     712,   713,   714,  -987,  -987,   396,  -987,   397,  -987,   894,
+    -987,   895,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,   399,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,   715,  -987,  -987,   896,  -987,  -987,  -987,  -987,
+    -987,   897,   898,  -987,  -987,  -987,  -987,  -987,   899,  -987,
+     403,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,   245,
+     716,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,   717,
+     718,  -987,  -987,   719,  -987,    36,  -987,  -987,   900,  -987,
+    -987,  -987,  -987,  -987,   405,  -987,  -987,  -987,  -987,  -987,
+    -987,   720,   406,  -987,   417,  -987,   721,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  1029,  -987,  -987,   902,
+     722,  -987,   123,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,   904,   723,   924,   155,  -987,  -987,
+    -987,  -987,  -987,  -987,   727,  -987,  -987,   929,  -987,   731,
+    -987,  -987,   817,  -987,  -987,   189,  -987,     4,   817,  -987,
+    -987,   925,   935,   936,  -987,   418,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,   941,   753,   754,   760,   943,     4,  -987,
+     744,  -987,  -987,  -987,   759,  -987,  -987,  -987
   };
 
   const unsigned short int
@@ -4471,179 +4573,183 @@ namespace isc { namespace dhcp {
       20,    22,    24,    26,    28,    30,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     1,    47,    40,    36,    35,    32,    33,    34,
-      39,     3,    37,    38,    60,     5,    72,     7,   168,     9,
-     330,    11,   508,    13,   533,    15,   563,    17,   433,    19,
-     441,    21,   478,    23,   295,    25,   676,    27,   743,    29,
-     732,    31,    49,    43,     0,     0,     0,     0,     0,     0,
-     565,     0,   443,   480,     0,     0,     0,     0,    51,     0,
-      50,     0,     0,    44,    70,   741,   724,   726,   728,     0,
-      69,     0,    62,    64,    66,    67,    68,    65,   129,   730,
-     166,   180,   182,   184,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   164,     0,     0,     0,
-       0,     0,   146,   153,   155,     0,   322,   431,   470,   521,
-     523,   380,   388,   255,   272,   263,   248,   600,   555,   287,
-     306,   621,     0,   274,   645,   658,   674,   157,   159,   748,
-     128,     0,    74,    76,    77,    78,    79,    80,    81,    82,
-      83,    84,   112,   113,   114,    85,   118,   119,   120,   121,
-     122,   123,   116,   117,   124,   125,   126,   110,    88,    89,
-      90,    91,   107,    92,    94,    93,   127,    98,    99,    86,
-     111,    87,    96,    97,   105,   106,   108,    95,   100,   101,
-     102,   103,   104,   109,   115,   177,     0,   176,     0,   170,
-     172,   173,   174,   175,   500,   525,   370,   372,   374,     0,
-       0,   378,   376,   594,   369,   334,   335,   336,   337,   338,
-     339,   340,   341,   357,   358,   359,   362,   363,   364,   365,
-     366,   367,   360,   361,   368,     0,   332,   345,   346,   347,
-     350,   351,   353,   348,   349,   342,   343,   355,   356,   344,
-     352,   354,   519,   518,   514,   515,   513,     0,   510,   512,
-     516,   517,   548,     0,   551,     0,     0,   547,   541,   542,
-     540,   545,   546,     0,   535,   537,   538,   543,   544,   539,
-     592,   580,   582,   584,   586,   588,   590,   579,   576,   577,
-     578,     0,   566,   567,   571,   572,   569,   573,   574,   575,
-     570,     0,   460,   228,     0,   464,   462,   467,     0,   456,
-     457,     0,   444,   445,   447,   459,   448,   449,   450,   466,
-     451,   452,   453,   454,   455,   494,     0,     0,   492,   493,
-     496,   497,     0,   481,   482,   484,   485,   486,   487,   488,
-     489,   490,   491,   302,   304,   299,     0,   297,   300,   301,
-       0,   699,   701,     0,   704,     0,     0,   708,   712,     0,
-       0,   716,   718,   720,   722,   697,   695,   696,     0,   678,
-     680,   681,   682,   683,   684,   685,   686,   687,   688,   689,
-     690,   691,   692,   693,   694,     0,   745,   747,   738,     0,
-       0,   734,   736,   737,    48,     0,     0,    41,     0,     0,
-       0,     0,     0,     0,    59,     0,    61,     0,     0,     0,
+      39,     3,    37,    38,    60,     5,    72,     7,   175,     9,
+     348,    11,   528,    13,   553,    15,   583,    17,   453,    19,
+     461,    21,   498,    23,   313,    25,   696,    27,   763,    29,
+     752,    31,    49,    43,     0,     0,     0,     0,     0,     0,
+     585,     0,   463,   500,     0,     0,     0,     0,    51,     0,
+      50,     0,     0,    44,    70,   761,   744,   746,   748,     0,
+      69,     0,    62,    64,    66,    67,    68,    65,   132,   750,
+     173,   187,   189,   191,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   171,     0,     0,     0,
+       0,     0,   149,   156,   158,     0,   165,     0,     0,   340,
+     451,   490,   541,   543,   399,   407,   273,   290,   281,   266,
+     620,   575,   305,   324,   641,     0,   292,   665,   678,   694,
+     160,   162,   768,   131,     0,    74,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,   112,   113,   114,    85,   118,
+     119,   120,   121,   122,   123,   116,   117,   124,   125,   126,
+     127,   128,   129,   110,    88,    89,    90,    91,   107,    92,
+      94,    93,   130,    98,    99,    86,   111,    87,    96,    97,
+     105,   106,   108,    95,   100,   101,   102,   103,   104,   109,
+     115,   184,     0,   183,     0,   177,   179,   180,   181,   182,
+     520,   545,   389,   391,   393,     0,     0,   397,   395,   614,
+     388,   352,   353,   354,   355,   356,   357,   358,   359,   375,
+     376,   377,   380,   381,   382,   383,   384,   385,   378,   379,
+     386,   387,     0,   350,   363,   364,   365,   368,   369,   371,
+     366,   367,   360,   361,   373,   374,   362,   370,   372,   539,
+     538,   534,   535,   533,     0,   530,   532,   536,   537,   568,
+       0,   571,     0,     0,   567,   561,   562,   560,   565,   566,
+       0,   555,   557,   558,   563,   564,   559,   612,   600,   602,
+     604,   606,   608,   610,   599,   596,   597,   598,     0,   586,
+     587,   591,   592,   589,   593,   594,   595,   590,     0,   480,
+     239,     0,   484,   482,   487,     0,   476,   477,     0,   464,
+     465,   467,   479,   468,   469,   470,   486,   471,   472,   473,
+     474,   475,   514,     0,     0,   512,   513,   516,   517,     0,
+     501,   502,   504,   505,   506,   507,   508,   509,   510,   511,
+     320,   322,   317,     0,   315,   318,   319,     0,   719,   721,
+       0,   724,     0,     0,   728,   732,     0,     0,   736,   738,
+     740,   742,   717,   715,   716,     0,   698,   700,   701,   702,
+     703,   704,   705,   706,   707,   708,   709,   710,   711,   712,
+     713,   714,     0,   765,   767,   758,     0,     0,   754,   756,
+     757,    48,     0,     0,    41,     0,     0,     0,     0,     0,
+       0,    59,     0,    61,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      73,     0,     0,     0,   169,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   331,     0,     0,   509,
-       0,     0,     0,     0,     0,     0,   534,     0,     0,     0,
-       0,     0,     0,     0,   564,     0,   434,     0,     0,     0,
-       0,     0,     0,     0,   442,     0,     0,     0,     0,   479,
-       0,     0,     0,     0,   296,     0,     0,     0,     0,     0,
+      73,     0,     0,     0,   176,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   349,     0,     0,   529,
+       0,     0,     0,     0,     0,     0,   554,     0,     0,     0,
+       0,     0,     0,     0,   584,     0,   454,     0,     0,     0,
+       0,     0,     0,     0,   462,     0,     0,     0,     0,   499,
+       0,     0,     0,     0,   314,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   677,     0,   744,     0,     0,     0,   733,    52,    45,
+       0,   697,     0,   764,     0,     0,     0,   753,    52,    45,
        0,     0,     0,     0,     0,     0,    63,     0,     0,     0,
-       0,     0,     0,   131,   132,   133,   134,   135,   136,   137,
-     138,   139,   140,   141,   142,     0,   162,   163,   143,   144,
-     145,     0,     0,     0,   161,     0,     0,     0,     0,     0,
+       0,     0,     0,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,     0,   169,   170,   146,   147,
+     148,     0,     0,     0,   164,     0,   167,   168,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   644,     0,     0,     0,     0,     0,     0,     0,    75,
-       0,   179,   171,     0,     0,     0,     0,     0,   386,   387,
-       0,     0,     0,   333,     0,   511,     0,   550,     0,   553,
-     554,   536,     0,     0,     0,     0,     0,     0,     0,   568,
-       0,     0,   458,     0,     0,     0,   469,   446,     0,   498,
-     499,   483,     0,     0,   298,   698,     0,     0,   703,     0,
-     706,   707,     0,     0,   714,   715,     0,     0,     0,     0,
-     679,   746,     0,   740,   735,     0,     0,     0,   725,   727,
-     729,   130,     0,     0,     0,     0,   186,   165,   148,   149,
-     150,   151,   152,   147,   154,   156,   324,   435,   472,    42,
-     522,   524,   382,   383,   384,   385,   381,   390,     0,    49,
-       0,     0,     0,   557,   289,     0,     0,     0,     0,     0,
-       0,   158,   160,     0,    53,   178,   502,   527,   371,   373,
-     375,   379,   377,     0,   520,   549,   552,   593,   581,   583,
-     585,   587,   589,   591,   461,   229,   465,   463,   468,   495,
-     303,   305,   700,   702,   705,   710,   711,   709,   713,   717,
-     719,   721,   723,   186,    46,     0,     0,     0,     0,   215,
-     221,   223,   225,     0,     0,     0,     0,     0,   239,     0,
-       0,   242,   244,   246,     0,     0,     0,     0,   214,     0,
-     192,   194,   195,   196,   197,   198,   199,   200,   201,   202,
-     203,   206,   213,   207,   208,   209,   204,   205,   210,   211,
-     212,     0,   190,     0,   187,   188,   328,     0,   325,   326,
-     439,     0,   436,   437,   476,     0,   473,   474,   394,     0,
-     391,   392,   261,   262,     0,   257,   259,   260,     0,   270,
-     271,   267,     0,   265,   268,   269,   253,     0,   250,   252,
-     604,     0,   602,   561,     0,   558,   559,   293,     0,   290,
-     291,     0,     0,     0,     0,     0,     0,     0,   308,   310,
-     311,   312,   313,   314,   315,   634,   640,     0,     0,     0,
-     633,   630,   631,   632,     0,   623,   625,   628,   626,   627,
-     629,     0,     0,     0,   283,     0,   276,   278,   279,   280,
-     281,   282,   654,   656,   653,   651,   652,     0,   647,   649,
-     650,     0,   669,     0,   672,   665,   666,     0,   660,   662,
-     663,   664,   667,     0,   752,     0,   750,    55,   506,     0,
-     503,   504,   531,     0,   528,   529,   598,   597,     0,   596,
-       0,    71,   742,   731,   167,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   664,     0,     0,     0,     0,     0,
+       0,     0,    75,     0,   186,   178,     0,     0,     0,     0,
+       0,   405,   406,     0,     0,     0,   351,     0,   531,     0,
+     570,     0,   573,   574,   556,     0,     0,     0,     0,     0,
+       0,     0,   588,     0,     0,   478,     0,     0,     0,   489,
+     466,     0,   518,   519,   503,     0,     0,   316,   718,     0,
+       0,   723,     0,   726,   727,     0,     0,   734,   735,     0,
+       0,     0,     0,   699,   766,     0,   760,   755,     0,     0,
+       0,   745,   747,   749,   133,     0,     0,     0,     0,   193,
+     172,   151,   152,   153,   154,   155,   150,   157,   159,   166,
+     342,   455,   492,    42,   542,   544,   401,   402,   403,   404,
+     400,   409,     0,    49,     0,     0,     0,   577,   307,     0,
+       0,     0,     0,     0,     0,   161,   163,     0,    53,   185,
+     522,   547,   390,   392,   394,   398,   396,     0,   540,   569,
+     572,   613,   601,   603,   605,   607,   609,   611,   481,   240,
+     485,   483,   488,   515,   321,   323,   720,   722,   725,   730,
+     731,   729,   733,   737,   739,   741,   743,   193,    46,     0,
+       0,     0,     0,   226,   232,   234,   236,     0,     0,     0,
+       0,     0,   257,     0,     0,   260,   262,   264,     0,     0,
+       0,     0,   247,   249,   251,     0,   225,     0,   199,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   213,
+     220,   221,   222,   223,   224,   214,   215,   216,   211,   212,
+     217,   218,   219,     0,   197,     0,   194,   195,   346,     0,
+     343,   344,   459,     0,   456,   457,   496,     0,   493,   494,
+     413,     0,   410,   411,   279,   280,     0,   275,   277,   278,
+       0,   288,   289,   285,     0,   283,   286,   287,   271,     0,
+     268,   270,   624,     0,   622,   581,     0,   578,   579,   311,
+       0,   308,   309,     0,     0,     0,     0,     0,     0,     0,
+     326,   328,   329,   330,   331,   332,   333,   654,   660,     0,
+       0,     0,   653,   650,   651,   652,     0,   643,   645,   648,
+     646,   647,   649,     0,     0,     0,   301,     0,   294,   296,
+     297,   298,   299,   300,   674,   676,   673,   671,   672,     0,
+     667,   669,   670,     0,   689,     0,   692,   685,   686,     0,
+     680,   682,   683,   684,   687,     0,   772,     0,   770,    55,
+     526,     0,   523,   524,   551,     0,   548,   549,   618,   617,
+       0,   616,     0,    71,   762,   751,   174,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   181,   183,     0,   185,     0,
-       0,   323,     0,   443,   432,     0,   480,   471,     0,     0,
-     389,     0,     0,   256,   273,     0,   264,     0,     0,   249,
-     606,     0,   601,   565,   556,     0,     0,   288,     0,     0,
-       0,     0,     0,     0,     0,     0,   307,     0,     0,     0,
-       0,     0,     0,   622,     0,     0,     0,     0,   275,     0,
-       0,     0,   646,     0,     0,     0,     0,     0,   659,   675,
-       0,     0,   749,    57,     0,    56,     0,   501,     0,     0,
-     526,     0,     0,   595,   739,     0,     0,     0,     0,   227,
-     230,   231,   232,   233,     0,   241,   234,     0,     0,     0,
-     236,   237,   238,   235,   193,     0,   189,     0,   327,     0,
-     438,     0,   475,   430,   409,   410,   411,   413,   414,   415,
-     402,   403,   418,   419,   420,   423,   424,   425,   426,   427,
-     428,   421,   422,   429,   398,   399,   400,   401,   407,   408,
-     406,   412,     0,   396,   404,   416,   417,   405,   393,   258,
-     266,     0,   251,   618,     0,   616,   617,   613,   614,   615,
-       0,   607,   608,   610,   611,   612,   603,     0,   560,     0,
-     292,   316,   317,   318,   319,   320,   321,   309,     0,     0,
-     639,   642,   643,   624,   284,   285,   286,   277,     0,     0,
-     648,   668,     0,   671,     0,   661,   766,     0,   764,   762,
-     756,   760,   761,     0,   754,   758,   759,   757,   751,    54,
-       0,     0,   505,     0,   530,     0,   217,   218,   219,   220,
-     216,   222,   224,   226,   240,   243,   245,   247,   191,   329,
-     440,   477,     0,   395,   254,     0,     0,   605,     0,   562,
-     294,   636,   637,   638,   635,   641,   655,   657,   670,   673,
-       0,     0,     0,     0,   753,    58,   507,   532,   599,   397,
-       0,   620,   609,     0,   763,     0,   755,   619,     0,   765,
-     770,     0,   768,     0,     0,   767,   779,     0,     0,     0,
-     784,     0,   772,   774,   775,   776,   777,   778,   769,     0,
-       0,     0,     0,     0,     0,   771,     0,   781,   782,   783,
-       0,   773,   780,   785
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   188,   190,     0,   192,     0,     0,   341,     0,   463,
+     452,     0,   500,   491,     0,     0,   408,     0,     0,   274,
+     291,     0,   282,     0,     0,   267,   626,     0,   621,   585,
+     576,     0,     0,   306,     0,     0,     0,     0,     0,     0,
+       0,     0,   325,     0,     0,     0,     0,     0,     0,   642,
+       0,     0,     0,     0,   293,     0,     0,     0,   666,     0,
+       0,     0,     0,     0,   679,   695,     0,     0,   769,    57,
+       0,    56,     0,   521,     0,     0,   546,     0,     0,   615,
+     759,     0,     0,     0,     0,   238,   241,   242,   243,   244,
+       0,   259,   245,     0,     0,     0,   254,   255,   256,   246,
+       0,     0,     0,   253,   200,     0,   196,     0,   345,     0,
+     458,     0,   495,   450,   428,   429,   430,   432,   433,   434,
+     421,   422,   437,   438,   439,   442,   443,   444,   445,   446,
+     447,   440,   441,   448,   449,   417,   418,   419,   420,   426,
+     427,   425,   431,     0,   415,   423,   435,   436,   424,   412,
+     276,   284,     0,   269,   638,     0,   636,   637,   633,   634,
+     635,     0,   627,   628,   630,   631,   632,   623,     0,   580,
+       0,   310,   334,   335,   336,   337,   338,   339,   327,     0,
+       0,   659,   662,   663,   644,   302,   303,   304,   295,     0,
+       0,   668,   688,     0,   691,     0,   681,   786,     0,   784,
+     782,   776,   780,   781,     0,   774,   778,   779,   777,   771,
+      54,     0,     0,   525,     0,   550,     0,   228,   229,   230,
+     231,   227,   233,   235,   237,   258,   261,   263,   265,   248,
+     250,   252,   198,   347,   460,   497,     0,   414,   272,     0,
+       0,   625,     0,   582,   312,   656,   657,   658,   655,   661,
+     675,   677,   690,   693,     0,     0,     0,     0,   773,    58,
+     527,   552,   619,   416,     0,   640,   629,     0,   783,     0,
+     775,   639,     0,   785,   790,     0,   788,     0,     0,   787,
+     799,     0,     0,     0,   804,     0,   792,   794,   795,   796,
+     797,   798,   789,     0,     0,     0,     0,     0,     0,   791,
+       0,   801,   802,   803,     0,   793,   800,   805
   };
 
   const short int
   Dhcp6Parser::yypgoto_[] =
   {
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,    -5,  -961,   448,
-    -961,  -961,  -961,  -961,  -961,  -961,   317,  -961,  -573,  -961,
-    -961,  -961,   -74,  -961,  -961,  -961,   615,  -961,  -961,  -961,
-    -961,   356,   555,  -961,  -961,   -62,   -42,   -24,   -22,   -21,
-     -18,    -4,    10,    13,    14,    15,  -961,    16,    27,    30,
-      32,  -961,   367,    34,  -961,    35,  -961,    37,  -961,    38,
-    -961,    42,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-     352,   572,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,   275,  -961,    72,  -961,  -669,    79,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,   -66,  -961,  -703,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-      56,  -961,  -961,  -961,  -961,  -961,    64,  -692,  -961,  -961,
-    -961,  -961,    62,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-      33,  -961,  -961,  -961,  -961,  -961,  -961,  -961,    54,  -961,
-    -961,  -961,    53,   525,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,    49,  -961,  -961,  -961,  -961,  -961,  -961,  -960,  -961,
-    -961,  -961,    83,  -961,  -961,  -961,    87,   573,  -961,  -961,
-    -958,  -961,  -957,  -961,    44,  -961,    52,  -961,    48,  -961,
-    -961,  -961,  -956,  -961,  -961,  -961,  -961,    78,  -961,  -961,
-    -139,   991,  -961,  -961,  -961,  -961,  -961,    88,  -961,  -961,
-    -961,    92,  -961,   553,  -961,   -76,  -961,  -961,  -961,  -961,
-    -961,   -70,  -961,  -961,  -961,  -961,  -961,   -40,  -961,  -961,
-    -961,    95,  -961,  -961,  -961,    90,  -961,   544,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,    39,
-    -961,  -961,  -961,    40,   584,  -961,  -961,   -58,  -961,    -2,
-    -961,  -961,  -961,  -961,  -961,    28,  -961,  -961,  -961,    46,
-     579,  -961,  -961,  -961,  -961,  -961,  -961,  -961,   -47,  -961,
-    -961,  -961,    80,  -961,  -961,  -961,    77,  -961,   585,   338,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -955,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,    96,  -961,  -961,  -961,  -120,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,    67,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,    60,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,    55,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,   364,   546,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,  -961,   407,   554,  -961,  -961,  -961,  -961,  -961,  -961,
-    -961,   415,   556,   -72,  -961,  -961,    63,  -961,  -961,  -118,
-    -961,  -961,  -961,  -961,  -961,  -961,  -141,  -961,  -961,  -158,
-    -961,  -961,  -961,  -961,  -961,  -961,  -961
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,    -5,  -987,   288,
+    -987,  -987,  -987,  -987,  -987,  -987,   223,  -987,  -591,  -987,
+    -987,  -987,   -74,  -987,  -987,  -987,   538,  -987,  -987,  -987,
+    -987,   270,   487,  -987,  -987,   -62,   -43,   -42,   -24,   -22,
+     -21,   -18,    -4,    10,    13,    14,  -987,    15,    16,    27,
+      30,  -987,   289,    32,  -987,    34,  -987,    35,  -987,    37,
+    -987,    38,    42,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,   271,   510,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,   193,  -987,    -9,  -987,  -682,
+     -19,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,   -66,  -987,  -717,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,   -37,  -987,  -987,  -987,  -987,  -987,   -12,  -706,  -987,
+    -987,  -987,  -987,    -6,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,   -44,  -987,  -987,  -987,  -987,  -987,  -987,  -987,   -16,
+    -987,  -987,  -987,   -20,   480,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,   -15,  -987,  -987,  -987,  -987,  -987,  -987,  -986,
+    -987,  -987,  -987,    26,  -987,  -987,  -987,    31,   534,  -987,
+    -987,  -984,  -987,  -983,  -987,    44,  -987,    52,  -987,    48,
+    -987,  -987,  -987,  -982,  -987,  -987,  -987,  -987,    39,  -987,
+    -987,  -178,   979,  -987,  -987,  -987,  -987,  -987,    51,  -987,
+    -987,  -987,    56,  -987,   533,  -987,   -76,  -987,  -987,  -987,
+    -987,  -987,   -70,  -987,  -987,  -987,  -987,  -987,   -40,  -987,
+    -987,  -987,    55,  -987,  -987,  -987,    54,  -987,   535,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+      -3,  -987,  -987,  -987,     0,   566,  -987,  -987,   -58,  -987,
+      -2,  -987,  -987,  -987,  -987,  -987,    -1,  -987,  -987,  -987,
+      25,   621,  -987,  -987,  -987,  -987,  -987,  -987,  -987,   -47,
+    -987,  -987,  -987,    57,  -987,  -987,  -987,    60,  -987,   607,
+     333,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -979,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,    64,  -987,  -987,  -987,  -141,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,    58,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,    46,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,    45,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,   366,   549,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,  -987,   410,   548,  -987,  -987,  -987,  -987,  -987,
+    -987,  -987,   411,   555,   -72,  -987,  -987,    53,  -987,  -987,
+    -150,  -987,  -987,  -987,  -987,  -987,  -987,  -166,  -987,  -987,
+    -185,  -987,  -987,  -987,  -987,  -987,  -987,  -987
   };
 
   const short int
@@ -4651,179 +4757,183 @@ namespace isc { namespace dhcp {
   {
       -1,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    88,    41,    42,
-      73,   710,    92,    93,    43,    72,    89,    90,   735,   937,
-    1044,  1045,   798,    45,    74,   101,   102,   103,   419,    47,
-      75,   161,   162,   163,   427,   164,   165,   166,   167,   168,
-     169,   170,   171,   172,   173,   174,   175,   176,   177,   178,
-     179,   451,   703,   180,   452,   181,   453,   182,   476,   183,
-     477,   184,   185,   186,   187,   445,   188,   429,    49,    76,
-     218,   219,   220,   481,   221,   189,   430,   190,   431,   191,
-     432,   823,   824,   825,   977,   799,   800,   801,   955,  1190,
-     802,   956,   803,   957,   804,   958,   805,   806,   518,   807,
-     808,   809,   810,   811,   812,   813,   814,   815,   816,   964,
-     817,   818,   967,   819,   968,   820,   969,   192,   465,   857,
-     858,   859,   997,   193,   462,   844,   845,   846,   847,   194,
-     464,   852,   853,   854,   855,   195,   463,   196,   472,   905,
-     906,   907,   908,   909,   197,   468,   868,   869,   870,  1006,
-      65,    84,   366,   367,   368,   531,   369,   532,   198,   469,
-     877,   878,   879,   880,   881,   882,   883,   884,   199,   455,
-     827,   828,   829,   980,    51,    77,   255,   256,   257,   487,
-     258,   488,   259,   489,   260,   493,   261,   492,   200,   460,
-     716,   263,   264,   201,   461,   839,   840,   841,   989,  1112,
-    1113,   202,   456,    59,    81,   831,   832,   833,   983,    61,
-      82,   331,   332,   333,   334,   335,   336,   337,   517,   338,
-     521,   339,   520,   340,   341,   522,   342,   203,   457,   835,
-     836,   837,   986,    63,    83,   352,   353,   354,   355,   356,
-     526,   357,   358,   359,   360,   266,   485,   939,   940,   941,
-    1046,    53,    78,   277,   278,   279,   497,   204,   458,   205,
-     459,   269,   486,   943,   944,   945,  1049,    55,    79,   293,
-     294,   295,   500,   296,   297,   502,   298,   299,   206,   467,
-     864,   865,   866,  1003,    57,    80,   311,   312,   313,   314,
-     508,   315,   509,   316,   510,   317,   511,   318,   512,   319,
-     513,   320,   507,   271,   494,   948,   949,  1052,   207,   466,
-     861,   862,  1000,  1130,  1131,  1132,  1133,  1134,  1205,  1135,
-     208,   470,   894,   895,   896,  1017,  1214,   897,   898,  1018,
-     899,   900,   209,   210,   473,   917,   918,   919,  1029,   920,
-    1030,   211,   474,   927,   928,   929,   930,  1034,   931,   932,
-    1036,   212,   475,    67,    85,   388,   389,   390,   391,   536,
-     392,   537,   393,   394,   539,   395,   396,   397,   542,   767,
-     398,   543,   399,   400,   401,   546,   402,   547,   403,   548,
-     404,   549,   104,   421,   105,   422,   106,   423,   213,   428,
-      71,    87,   410,   411,   412,   554,   413,   107,   420,    69,
-      86,   405,   406,   214,   478,   935,   936,  1040,  1173,  1174,
-    1175,  1176,  1222,  1177,  1220,  1241,  1242,  1243,  1251,  1252,
-    1253,  1259,  1254,  1255,  1256,  1257,  1263
+      73,   724,    92,    93,    43,    72,    89,    90,   749,   959,
+    1070,  1071,   816,    45,    74,   101,   102,   103,   426,    47,
+      75,   164,   165,   166,   434,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   458,   716,   183,   459,   184,   460,   185,   486,   186,
+     487,   187,   188,   462,   189,   190,   191,   192,   193,   452,
+     194,   436,    49,    76,   224,   225,   226,   491,   227,   195,
+     437,   196,   438,   197,   439,   845,   846,   847,  1003,   817,
+     818,   819,   977,  1221,   820,   978,   821,   979,   822,   980,
+     823,   824,   528,   825,   826,   827,   828,   829,   830,   831,
+     996,   832,   997,   833,   998,   834,   835,   836,   837,   838,
+     986,   839,   840,   989,   841,   990,   842,   991,   198,   475,
+     879,   880,   881,  1023,   199,   472,   866,   867,   868,   869,
+     200,   474,   874,   875,   876,   877,   201,   473,   202,   482,
+     927,   928,   929,   930,   931,   203,   478,   890,   891,   892,
+    1032,    65,    84,   373,   374,   375,   541,   376,   542,   204,
+     479,   899,   900,   901,   902,   903,   904,   905,   906,   205,
+     465,   849,   850,   851,  1006,    51,    77,   262,   263,   264,
+     497,   265,   498,   266,   499,   267,   503,   268,   502,   206,
+     470,   730,   270,   271,   207,   471,   861,   862,   863,  1015,
+    1143,  1144,   208,   466,    59,    81,   853,   854,   855,  1009,
+      61,    82,   338,   339,   340,   341,   342,   343,   344,   527,
+     345,   531,   346,   530,   347,   348,   532,   349,   209,   467,
+     857,   858,   859,  1012,    63,    83,   359,   360,   361,   362,
+     363,   536,   364,   365,   366,   367,   273,   495,   961,   962,
+     963,  1072,    53,    78,   284,   285,   286,   507,   210,   468,
+     211,   469,   276,   496,   965,   966,   967,  1075,    55,    79,
+     300,   301,   302,   510,   303,   304,   512,   305,   306,   212,
+     477,   886,   887,   888,  1029,    57,    80,   318,   319,   320,
+     321,   518,   322,   519,   323,   520,   324,   521,   325,   522,
+     326,   523,   327,   517,   278,   504,   970,   971,  1078,   213,
+     476,   883,   884,  1026,  1161,  1162,  1163,  1164,  1165,  1239,
+    1166,   214,   480,   916,   917,   918,  1043,  1248,   919,   920,
+    1044,   921,   922,   215,   216,   483,   939,   940,   941,  1055,
+     942,  1056,   217,   484,   949,   950,   951,   952,  1060,   953,
+     954,  1062,   218,   485,    67,    85,   395,   396,   397,   398,
+     546,   399,   547,   400,   401,   549,   402,   403,   404,   552,
+     781,   405,   553,   406,   407,   408,   556,   409,   557,   410,
+     558,   411,   559,   104,   428,   105,   429,   106,   430,   219,
+     435,    71,    87,   417,   418,   419,   564,   420,   107,   427,
+      69,    86,   412,   413,   220,   488,   957,   958,  1066,  1204,
+    1205,  1206,  1207,  1256,  1208,  1254,  1275,  1276,  1277,  1285,
+    1286,  1287,  1293,  1288,  1289,  1290,  1291,  1297
   };
 
   const unsigned short int
   Dhcp6Parser::yytable_[] =
   {
-     100,   160,   217,   234,   273,   287,   307,   350,   329,   348,
-     365,   385,    40,   351,   407,   235,   330,   349,   222,   267,
-     280,   291,   309,   891,   343,   361,   821,   386,   851,  1105,
-     270,  1106,  1107,  1111,  1117,   236,    94,   265,   276,   290,
-     308,    33,   301,    34,    91,    35,   425,   215,   216,   946,
-      32,   426,    44,   237,    46,   238,   239,   741,    48,   240,
-     698,   699,   700,   701,   842,   363,   364,   138,   323,   747,
-     748,   749,    50,   241,   223,   268,   281,   292,   310,   479,
-     344,   362,    52,   387,   480,   139,   140,   242,   137,   885,
-     243,   244,   245,   246,   363,   364,   483,   702,   784,   408,
-     409,   484,   322,   495,   247,  1123,  1124,   248,   496,   249,
-     992,   250,   251,   993,   252,   253,   498,   139,   140,   254,
-     159,   499,   274,   288,   505,   262,    54,   779,   414,   506,
-     275,   289,   780,   781,   782,   783,   784,   785,   786,   787,
-     788,   789,   790,   791,   792,   793,   794,   795,   796,   797,
-     323,   843,   324,   325,   139,   140,   326,   327,   328,   138,
-    1246,    56,   415,  1247,  1248,  1249,  1250,   139,   140,   995,
-     272,    58,   996,   138,    99,   323,   138,   139,   140,   533,
-     139,   140,   842,   849,   534,   850,   282,   283,   284,   285,
-     286,   139,   140,    60,   139,   140,   231,    95,    99,   232,
-     886,   887,   888,   889,    62,    64,   550,    96,    97,    98,
-     231,   551,   300,   232,  1001,    66,   323,  1002,   301,   302,
-     303,   304,   305,   306,   552,    99,  1211,  1212,  1213,   553,
-      99,   139,   140,   139,   140,    36,    37,    38,    39,   921,
-     922,   923,  1105,   556,  1106,  1107,  1111,  1117,   557,   712,
-     713,   714,   715,   114,   115,   116,   117,   118,   119,   120,
-     121,   122,   123,   124,   765,   766,    68,    99,   129,   130,
-     131,   132,   133,   134,   135,  1041,  1244,   138,  1042,  1245,
-      99,   139,   140,   901,   902,   903,    70,   224,   416,   225,
-      99,   139,   140,   924,   417,   139,   140,   226,   227,   228,
-     229,   230,   141,   851,    99,    99,   479,    99,  1075,   418,
-     552,   951,   424,   433,   231,   952,   556,   232,   148,   891,
-    1166,   953,  1167,  1168,   483,   233,   434,   435,   436,   954,
-     437,   323,   345,   324,   325,   346,   347,   912,   913,   438,
-     974,   514,   974,   515,    99,   975,    99,   976,   139,   140,
-     439,   100,   440,   441,   370,   371,   372,   373,   374,   375,
-     376,   377,   378,   379,   380,   381,   382,   871,   872,   873,
-     874,   875,   876,   442,   383,   384,   998,  1015,   157,   158,
-    1022,   999,  1016,  1027,  1031,  1023,  1037,   550,  1028,  1032,
-     974,  1038,  1039,   495,    99,  1198,  1202,   533,  1199,   443,
-     444,  1203,  1210,   446,    99,   160,   447,  1223,    99,   217,
-     558,   559,  1224,   498,   505,  1264,   516,   448,  1226,  1227,
-    1265,   234,   449,   450,   273,   222,   454,  1186,  1187,  1188,
-    1189,   287,   471,   235,   482,   490,   491,   267,   501,   503,
-     280,   307,   504,   519,   523,   524,   525,   291,   270,   527,
-     528,   329,   529,   236,   350,   265,   348,   309,   276,   330,
-     351,    99,   530,   560,   349,   290,   535,   343,   538,   540,
-     541,   237,   361,   238,   239,   308,   385,   240,   544,   545,
-     407,   223,   555,   561,   562,   563,   564,   565,   567,   568,
-     569,   241,   386,   268,   570,   571,   281,   572,   573,   574,
-     575,   576,   577,   292,   578,   242,   585,   581,   243,   244,
-     245,   246,   579,   310,   580,   591,   582,   583,   584,   586,
-     587,   686,   247,   344,   592,   248,   593,   249,   362,   250,
-     251,   588,   252,   253,   589,   595,   590,   254,   594,   596,
-     597,   598,   274,   262,   599,   600,   601,   602,   387,   288,
-     275,   603,   604,   605,   606,   607,   608,   289,   688,   689,
-     690,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   609,   610,   612,   611,   129,   130,   131,   132,
-     133,   134,   135,   136,   613,   138,   323,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    15,   614,   139,   140,   615,   227,   228,   616,   230,
-     141,   617,   160,   618,   620,   407,   621,   623,   624,   217,
-     625,   626,   231,   627,   628,   232,   630,   629,   631,   632,
-     634,   636,   638,   233,   642,   222,   637,   643,   644,   645,
-     646,   639,   640,   647,   648,   650,   651,   652,   653,   654,
-     655,   656,   890,   904,   914,   658,   385,   659,   761,   660,
-     662,   663,   665,   666,   667,   669,   672,   668,   892,   910,
-     915,   925,   386,   670,   673,   676,   671,   677,   678,   674,
-     774,   679,   682,   685,   979,   696,   157,   158,   683,   675,
-     687,   223,   768,   691,   692,   693,   108,   109,   694,   695,
-     110,   706,   697,   111,   112,   113,   704,   705,   707,   708,
-     982,   711,    34,   717,   718,   719,    99,   720,   721,   722,
-     723,   724,   731,   732,   893,   911,   916,   926,   387,   114,
+     100,   163,   223,   240,   280,   294,   314,   357,   336,   355,
+     372,   392,    40,   358,   414,   241,   337,   356,   228,   274,
+     287,   298,   316,   913,   350,   368,   843,   393,   873,  1136,
+     277,  1137,  1138,  1142,   242,   243,  1148,   272,   283,   297,
+     315,    33,   864,    34,   308,    35,   370,   371,   370,   371,
+      94,   968,   755,   244,   907,   245,   246,   221,   222,   247,
+     415,   416,   432,   798,   761,   762,   763,   433,    32,   711,
+     712,   713,   714,   248,   229,   275,   288,   299,   317,  1018,
+     351,   369,  1019,   394,   141,   864,   871,   249,   872,    44,
+     250,   251,   252,   253,   779,   780,    46,   289,   290,   291,
+     292,   293,   142,   143,   254,   329,   715,   255,   489,   256,
+      48,   257,   258,   490,   259,   260,    50,  1021,    91,   261,
+    1022,   237,   281,   295,   238,   269,   142,   143,    99,   865,
+     282,   296,   793,  1027,   142,   143,  1028,   794,   795,   796,
+     797,   798,   799,   800,   801,   802,   803,   804,   805,   806,
+     807,   808,   809,   810,   811,   812,   813,   814,   815,   493,
+     330,   141,   331,   332,   494,   505,   333,   334,   335,   140,
+     506,   508,   908,   909,   910,   911,   509,   142,   143,   142,
+     143,    52,   141,  1067,    54,  1280,  1068,   330,  1281,  1282,
+    1283,  1284,  1278,   279,    56,  1279,   162,   307,   141,   330,
+     142,   143,   421,   308,   309,   310,   311,   312,   313,   330,
+     352,   331,   332,   353,   354,    99,   142,   143,    95,   237,
+     515,    58,   238,    60,   422,   516,   142,   143,    96,    97,
+      98,   330,    62,   543,    64,   560,  1154,  1155,   544,    99,
+     561,    66,    36,    37,    38,    39,    99,    99,   142,   143,
+    1136,   562,  1137,  1138,  1142,   423,   563,  1148,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,    68,
+      70,   142,   143,   129,   130,   131,   132,   133,   134,   135,
+     136,   142,   143,   424,   425,   141,   566,   524,   142,   143,
+      99,   567,    99,   489,   562,   230,   566,   231,   973,   974,
+     431,   975,   440,   142,   143,   232,   233,   234,   235,   236,
+     144,   142,   143,    99,   493,   873,   441,    99,  1000,   976,
+     442,  1105,   237,  1001,   443,   238,   151,   934,   935,    99,
+     525,   913,   444,   239,   445,  1197,   446,  1198,  1199,    99,
+     923,   924,   925,   447,   377,   378,   379,   380,   381,   382,
+     383,   384,   385,   386,   387,   388,   389,  1000,   100,   448,
+     449,    99,  1002,  1024,   390,   391,   450,   451,  1025,   453,
+     943,   944,   945,   893,   894,   895,   896,   897,   898,   454,
+    1041,  1245,  1246,  1247,    99,  1042,   160,   161,  1048,   526,
+    1053,  1057,  1063,  1049,    99,  1054,  1058,  1064,   560,  1000,
+     505,    99,  1236,  1065,  1232,  1233,   543,  1237,  1257,   508,
+     534,  1244,   455,  1258,  1260,   163,    99,   568,   569,   223,
+     515,  1298,   583,   456,   946,  1261,  1299,   726,   727,   728,
+     729,   240,   457,   461,   280,   228,  1217,  1218,  1219,  1220,
+     463,   294,   464,   241,   481,   492,   500,   274,   501,   511,
+     287,   314,   513,   514,   529,   533,   535,   298,   277,   537,
+     538,   336,   242,   243,   357,   272,   355,   316,   283,   337,
+     358,   539,   540,   570,   356,   297,   545,   350,   548,   550,
+     551,   244,   368,   245,   246,   315,   392,   247,   554,   555,
+     414,   229,   565,   571,   572,   573,   574,   575,   577,   578,
+     579,   248,   393,   275,   580,   581,   288,   582,   584,   585,
+     586,   587,   588,   299,   589,   249,   590,   591,   250,   251,
+     252,   253,   592,   317,   595,   593,   594,   598,   596,   597,
+     601,   602,   254,   351,   599,   255,   603,   256,   369,   257,
+     258,   605,   259,   260,   600,   604,   606,   261,   608,   607,
+     609,   610,   281,   269,   611,   612,   613,   614,   394,   295,
+     282,   615,   616,   617,   618,   619,   620,   296,   701,   702,
+     703,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,   621,   622,   623,   624,
+     625,   626,   627,   628,   629,   630,   631,   633,   636,   634,
+     637,   638,   639,   640,   643,   641,   644,   645,   647,   642,
+     649,   650,   651,   655,   652,   656,   653,   657,   658,   659,
+     660,   661,   663,   664,   666,   163,   667,   665,   414,   668,
+     669,   671,   223,   672,   673,   675,   676,   679,   680,   678,
+     681,   682,   683,   685,   684,   686,   689,   690,   228,   691,
+     692,   695,   687,   698,   696,   688,  1079,   699,   700,   705,
+     704,   706,   707,   708,   709,   710,   912,   926,   936,   720,
+     392,   775,   108,   109,   717,   721,   110,   718,   722,   111,
+     112,   113,   914,   932,   937,   947,   393,   719,    34,   725,
+     731,   732,   733,   788,   734,   735,   736,   737,   738,   782,
+    1005,   739,   740,   741,   229,   742,   743,   744,   745,   114,
      115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   725,   726,   727,   728,   729,   730,
-     733,   734,   736,   737,   738,   739,   740,   743,   773,   822,
-     742,   139,   140,   744,   745,   746,   750,   751,   141,   826,
-     752,   753,   754,   142,   143,   144,   145,   146,   755,   147,
-     756,   757,   758,   759,   148,   760,   762,   830,   763,   764,
-     834,   770,   771,   149,   772,   838,   150,   860,   863,   856,
-     867,   934,   938,   151,   942,   959,   960,   961,   962,   963,
-     965,   152,   153,   966,   970,   971,   154,   972,   973,   155,
-     985,   978,   981,   156,   984,   987,   988,   990,   991,  1060,
-     994,  1005,  1004,  1007,  1008,  1047,  1009,  1010,  1011,  1012,
-    1013,  1014,  1019,  1020,   157,   158,  1021,   159,  1024,  1025,
-    1026,  1033,  1035,  1043,  1048,  1050,  1051,  1059,  1053,  1055,
-    1054,  1056,  1057,  1058,  1062,  1061,  1063,  1064,  1067,  1068,
-    1069,  1121,  1065,  1148,    99,  1149,  1066,  1158,  1159,  1070,
-    1071,  1162,  1164,  1185,  1073,  1072,  1179,  1141,  1142,  1143,
-    1144,  1145,  1146,  1180,  1200,  1201,   234,  1206,  1208,   329,
-     350,  1221,   348,  1150,  1207,  1083,   351,   330,   235,  1151,
-     349,  1152,   267,  1104,  1154,   343,  1125,  1084,   361,   307,
-    1155,  1115,   365,   270,  1126,  1156,  1161,  1163,   236,  1191,
-     265,  1192,  1128,  1193,  1194,   309,  1209,  1085,   890,  1114,
-    1230,  1233,  1195,   904,  1234,  1235,   237,   914,   238,   239,
-    1127,  1231,   240,   308,   892,  1086,  1169,  1087,  1088,   910,
-    1196,  1089,   273,   915,  1170,   287,   241,  1197,   268,   925,
-    1204,   344,  1171,  1215,   362,  1090,  1216,  1116,   280,  1238,
-     242,   291,  1240,   243,   244,   245,   246,  1260,  1129,  1091,
-    1261,   310,  1092,  1093,  1094,  1095,   276,   247,  1217,   290,
-     248,  1262,   249,  1266,   250,   251,  1096,   252,   253,  1097,
-     893,  1098,   254,  1099,  1100,   911,  1101,  1102,   262,   916,
-    1270,  1103,  1267,  1108,   619,   926,   848,  1110,  1172,  1218,
-     566,  1109,   775,   769,   281,   778,   709,   292,   950,  1225,
-    1228,  1076,  1237,  1074,  1122,   622,  1119,  1120,   664,  1139,
-    1157,  1239,  1140,  1229,  1147,  1078,  1268,  1077,   633,  1118,
-    1269,  1272,   321,  1080,   661,  1079,  1081,  1273,   657,  1184,
-    1137,   947,   635,  1082,   641,  1138,  1181,  1182,  1232,  1153,
-     274,  1160,  1165,   288,   933,  1183,   680,  1136,   275,   777,
-     649,   289,   776,  1258,  1178,  1236,  1271,     0,   681,     0,
-     684,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,  1083,     0,
-       0,     0,     0,     0,  1125,     0,  1104,     0,     0,     0,
-    1084,     0,  1126,     0,  1115,     0,     0,     0,     0,  1169,
-    1128,     0,     0,     0,     0,     0,     0,  1170,     0,  1219,
-    1085,     0,  1114,     0,     0,  1171,     0,     0,  1127,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,  1086,     0,
-    1087,  1088,     0,     0,  1089,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,  1090,     0,
-    1116,     0,     0,     0,     0,     0,  1129,     0,     0,     0,
-       0,     0,  1091,     0,     0,  1092,  1093,  1094,  1095,     0,
-       0,  1172,     0,     0,     0,     0,     0,     0,     0,  1096,
-       0,     0,  1097,     0,  1098,     0,  1099,  1100,     0,  1101,
-    1102,     0,     0,     0,  1103,     0,  1108,     0,     0,     0,
-    1110,     0,     0,     0,  1109
+     135,   136,   137,   138,   139,   140,   141,   746,   915,   933,
+     938,   948,   394,   747,   748,   750,   751,   752,   753,   754,
+     757,   756,   787,   844,   142,   143,   848,   852,   856,   860,
+     758,   144,   759,   878,   882,   885,   145,   146,   147,   148,
+     149,   760,   150,   764,   765,   766,   767,   151,   768,   769,
+     770,   771,   772,   773,   774,   776,   152,   777,   889,   153,
+     956,   778,   960,   964,   981,   982,   154,   983,   984,   985,
+     987,   784,   988,   992,   155,   156,   993,   785,   994,   157,
+     995,   786,   158,   999,  1004,  1008,   159,  1007,  1011,  1010,
+    1013,  1014,  1016,  1017,  1274,  1020,  1031,  1030,  1033,  1034,
+    1069,  1035,  1036,  1037,  1038,  1039,  1040,   160,   161,  1045,
+     162,  1046,  1047,  1050,  1051,  1052,  1059,  1061,  1074,  1086,
+    1073,  1077,  1076,  1080,  1081,  1082,  1083,  1084,  1090,  1093,
+    1094,  1095,  1100,  1101,  1085,  1087,  1102,    99,  1152,  1088,
+    1089,  1098,  1091,  1092,  1096,  1097,  1099,  1179,  1103,  1172,
+    1180,  1173,  1174,  1175,  1176,  1177,  1181,  1182,  1189,  1183,
+    1190,  1186,  1185,  1193,  1195,  1216,  1211,  1187,  1210,   723,
+    1240,  1242,  1234,  1235,  1255,  1241,  1264,  1243,  1267,  1194,
+    1192,  1222,  1223,  1224,  1225,  1226,  1227,  1228,  1229,  1230,
+    1231,  1238,  1249,  1250,  1251,  1252,  1259,  1262,  1269,  1294,
+    1268,  1265,   240,  1271,  1272,   336,   357,  1273,   355,  1295,
+    1296,  1113,   358,   337,   241,  1300,   356,  1304,   274,  1135,
+    1306,   350,  1156,  1114,   368,   314,   870,  1146,   372,   277,
+    1157,  1302,  1301,   242,   243,  1307,   272,  1303,  1159,   789,
+     576,   316,  1115,  1116,   912,  1145,   632,   792,   783,   926,
+     972,  1104,   244,   936,   245,   246,  1158,  1153,   247,   315,
+     914,  1117,  1200,  1118,  1119,   932,  1106,  1120,   280,   937,
+    1201,   294,   248,   635,   275,   947,  1150,   351,  1202,  1188,
+     369,  1121,  1170,  1147,   287,  1151,   249,   298,  1171,   250,
+     251,   252,   253,   677,  1160,  1122,  1178,   317,  1123,  1124,
+    1125,  1126,   283,   254,  1108,   297,   255,  1107,   256,   646,
+     257,   258,  1127,   259,   260,  1128,   915,  1129,   261,  1130,
+    1131,   933,  1132,  1133,   269,   938,  1149,  1134,  1263,  1139,
+     328,   948,  1110,  1141,  1203,  1109,  1111,  1140,   670,  1112,
+     288,  1213,  1212,   299,   648,   674,  1215,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,  1169,  1168,
+     969,  1167,   129,   130,   131,   132,   133,   134,   135,   136,
+    1214,  1266,   139,  1191,   141,   330,  1184,  1270,  1196,   693,
+     955,   790,  1292,  1305,   697,   791,   281,   694,     0,   295,
+    1209,     0,   142,   143,   282,   233,   234,   296,   236,   144,
+       0,     0,   662,     0,     0,     0,   654,     0,     0,     0,
+       0,   237,     0,     0,   238,     0,     0,     0,     0,     0,
+       0,     0,   239,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1113,     0,     0,     0,     0,     0,  1156,     0,
+    1135,     0,     0,     0,  1114,     0,  1157,     0,  1146,     0,
+       0,     0,     0,  1200,  1159,     0,     0,     0,     0,     0,
+    1253,  1201,     0,  1115,  1116,     0,  1145,     0,     0,  1202,
+       0,     0,  1158,     0,     0,   160,   161,     0,     0,     0,
+       0,     0,  1117,     0,  1118,  1119,     0,     0,  1120,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1121,     0,  1147,    99,     0,     0,     0,     0,
+    1160,     0,     0,     0,     0,     0,  1122,     0,     0,  1123,
+    1124,  1125,  1126,     0,     0,  1203,     0,     0,     0,     0,
+       0,     0,     0,  1127,     0,     0,  1128,     0,  1129,     0,
+    1130,  1131,     0,  1132,  1133,     0,     0,     0,  1134,     0,
+    1139,     0,     0,     0,  1141,     0,     0,     0,  1140
   };
 
   const short int
@@ -4831,347 +4941,355 @@ namespace isc { namespace dhcp {
   {
       74,    75,    76,    77,    78,    79,    80,    83,    82,    83,
       84,    85,    17,    83,    86,    77,    82,    83,    76,    77,
-      78,    79,    80,   726,    82,    83,   695,    85,   720,   989,
-      77,   989,   989,   989,   989,    77,    10,    77,    78,    79,
-      80,     5,   110,     7,   199,     9,     3,    16,    17,   117,
-       0,     8,     7,    77,     7,    77,    77,   630,     7,    77,
-     165,   166,   167,   168,   112,   119,   120,    68,    69,   642,
-     643,   644,     7,    77,    76,    77,    78,    79,    80,     3,
-      82,    83,     7,    85,     8,    86,    87,    77,    67,    21,
-      77,    77,    77,    77,   119,   120,     3,   202,    30,    13,
-      14,     8,    21,     3,    77,   106,   107,    77,     8,    77,
-       3,    77,    77,     6,    77,    77,     3,    86,    87,    77,
-     172,     8,    78,    79,     3,    77,     7,    21,     6,     8,
-      78,    79,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
-      69,   199,    71,    72,    86,    87,    75,    76,    77,    68,
-     174,     7,     3,   177,   178,   179,   180,    86,    87,     3,
-      79,     7,     6,    68,   199,    69,    68,    86,    87,     3,
-      86,    87,   112,   113,     8,   115,    81,    82,    83,    84,
-      85,    86,    87,     7,    86,    87,   105,   171,   199,   108,
-     132,   133,   134,   135,     7,     7,     3,   181,   182,   183,
-     105,     8,   104,   108,     3,     7,    69,     6,   110,   111,
-     112,   113,   114,   115,     3,   199,   129,   130,   131,     8,
-     199,    86,    87,    86,    87,   199,   200,   201,   202,   145,
-     146,   147,  1202,     3,  1202,  1202,  1202,  1202,     8,    94,
-      95,    96,    97,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,   162,   163,     7,   199,    59,    60,
-      61,    62,    63,    64,    65,     3,     3,    68,     6,     6,
-     199,    86,    87,   138,   139,   140,     7,    78,     4,    80,
-     199,    86,    87,   199,     8,    86,    87,    88,    89,    90,
-      91,    92,    93,   995,   199,   199,     3,   199,   977,     3,
-       3,     8,     4,     4,   105,     8,     3,   108,   109,  1022,
-     173,     8,   175,   176,     3,   116,     4,     4,     4,     8,
-       4,    69,    70,    71,    72,    73,    74,   142,   143,     4,
-       3,     8,     3,     3,   199,     8,   199,     8,    86,    87,
-       4,   425,     4,     4,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   122,   123,   124,
-     125,   126,   127,     4,   169,   170,     3,     3,   169,   170,
-       3,     8,     8,     3,     3,     8,     3,     3,     8,     8,
-       3,     8,     8,     3,   199,     8,     3,     3,     8,     4,
-       4,     8,     8,     4,   199,   479,     4,     3,   199,   483,
-     415,   416,     8,     3,     3,     3,     8,     4,     8,     8,
-       8,   495,     4,     4,   498,   483,     4,    22,    23,    24,
-      25,   505,     4,   495,     4,     4,     4,   495,     4,     4,
-     498,   515,     4,     4,     4,     8,     3,   505,   495,     4,
-       4,   525,     8,   495,   530,   495,   530,   515,   498,   525,
-     530,   199,     3,   199,   530,   505,     4,   525,     4,     4,
-       4,   495,   530,   495,   495,   515,   550,   495,     4,     4,
-     552,   483,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   495,   550,   495,     4,     4,   498,     4,   200,   200,
-     200,   200,   200,   505,   200,   495,     4,   202,   495,   495,
-     495,   495,   200,   515,   200,     4,   201,   201,   200,   200,
-     200,     7,   495,   525,     4,   495,     4,   495,   530,   495,
-     495,   202,   495,   495,   202,     4,   202,   495,   202,     4,
-       4,     4,   498,   495,     4,     4,     4,     4,   550,   505,
-     498,     4,     4,     4,     4,     4,     4,   505,   563,   564,
-     565,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,    54,     4,     4,     4,   200,    59,    60,    61,    62,
-      63,    64,    65,    66,     4,    68,    69,   184,   185,   186,
-     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
-     197,   198,     4,    86,    87,     4,    89,    90,     4,    92,
-      93,     4,   686,     4,     4,   687,   202,     4,     4,   693,
-       4,     4,   105,     4,   200,   108,     4,   202,     4,     4,
-       4,     4,     4,   116,     4,   693,   200,     4,     4,     4,
-       4,   200,   200,     4,     4,     4,     4,   200,     4,     4,
-       4,   202,   726,   727,   728,     4,   730,   202,   663,   202,
-       4,     4,   202,     4,     4,     4,     4,   200,   726,   727,
-     728,   729,   730,   200,     4,     4,   200,     4,     4,   202,
-     685,     4,     4,     4,     3,     5,   169,   170,   200,   202,
-       7,   693,   164,   199,     7,     7,    11,    12,     7,     7,
-      15,     5,   199,    18,    19,    20,   199,   199,     5,     5,
-       3,   199,     7,     5,     5,     5,   199,     5,     7,     5,
-       5,     5,   199,   199,   726,   727,   728,   729,   730,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,     7,     7,     7,     7,     7,     7,
-       5,     5,     5,     5,   199,   199,   199,     7,     5,     7,
-     199,    86,    87,   199,   199,   199,   199,   199,    93,     7,
-     199,   199,   199,    98,    99,   100,   101,   102,   199,   104,
-     199,   199,   199,   199,   109,   199,   199,     7,   199,   199,
-       7,   199,   199,   118,   199,     7,   121,     7,     7,   103,
-       7,     7,     7,   128,     7,     4,     4,     4,     4,     4,
-       4,   136,   137,     4,     4,     4,   141,     4,     4,   144,
-       3,     6,     6,   148,     6,     6,     3,     6,     3,   202,
-       6,     3,     6,     6,     3,     6,     4,     4,     4,     4,
-       4,     4,     4,     4,   169,   170,     4,   172,     4,     4,
-       4,     4,     4,   199,     3,     6,     3,   200,     8,     4,
-       6,     4,     4,     4,   202,   200,   200,     4,     4,     4,
-       4,     4,   200,     4,   199,     4,   200,     4,     4,   200,
-     200,     4,     4,     4,   200,   202,     6,   200,   200,   200,
-     200,   200,   200,     3,     8,     8,   980,     4,     3,   983,
-     986,     4,   986,   200,     8,   989,   986,   983,   980,   200,
-     986,   200,   980,   989,   202,   983,  1000,   989,   986,  1003,
-     200,   989,  1006,   980,  1000,   200,   202,   200,   980,   199,
-     980,   199,  1000,   199,   199,  1003,     8,   989,  1022,   989,
-       4,     4,   199,  1027,   200,     4,   980,  1031,   980,   980,
-    1000,   202,   980,  1003,  1022,   989,  1040,   989,   989,  1027,
-     199,   989,  1046,  1031,  1040,  1049,   980,   199,   980,  1037,
-     199,   983,  1040,   199,   986,   989,   199,   989,  1046,     5,
-     980,  1049,     7,   980,   980,   980,   980,     4,  1000,   989,
-       4,  1003,   989,   989,   989,   989,  1046,   980,   199,  1049,
-     980,     4,   980,     4,   980,   980,   989,   980,   980,   989,
-    1022,   989,   980,   989,   989,  1027,   989,   989,   980,  1031,
-       4,   989,   202,   989,   479,  1037,   719,   989,  1040,   199,
-     425,   989,   686,   676,  1046,   693,   598,  1049,   773,   199,
-     199,   979,   199,   974,   998,   483,   992,   995,   533,  1006,
-    1027,   199,  1008,  1202,  1015,   982,   200,   980,   495,   991,
-     200,   199,    81,   985,   530,   983,   986,   199,   525,  1051,
-    1003,   743,   498,   988,   505,  1005,  1046,  1048,  1208,  1022,
-    1046,  1031,  1037,  1049,   730,  1049,   550,  1001,  1046,   692,
-     515,  1049,   687,  1244,  1041,  1223,  1264,    -1,   552,    -1,
-     556,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1202,    -1,
-      -1,    -1,    -1,    -1,  1208,    -1,  1202,    -1,    -1,    -1,
-    1202,    -1,  1208,    -1,  1202,    -1,    -1,    -1,    -1,  1223,
-    1208,    -1,    -1,    -1,    -1,    -1,    -1,  1223,    -1,  1164,
-    1202,    -1,  1202,    -1,    -1,  1223,    -1,    -1,  1208,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1202,    -1,
-    1202,  1202,    -1,    -1,  1202,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1202,    -1,
-    1202,    -1,    -1,    -1,    -1,    -1,  1208,    -1,    -1,    -1,
-      -1,    -1,  1202,    -1,    -1,  1202,  1202,  1202,  1202,    -1,
-      -1,  1223,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1202,
-      -1,    -1,  1202,    -1,  1202,    -1,  1202,  1202,    -1,  1202,
-    1202,    -1,    -1,    -1,  1202,    -1,  1202,    -1,    -1,    -1,
-    1202,    -1,    -1,    -1,  1202
+      78,    79,    80,   740,    82,    83,   708,    85,   734,  1015,
+      77,  1015,  1015,  1015,    77,    77,  1015,    77,    78,    79,
+      80,     5,   119,     7,   117,     9,   126,   127,   126,   127,
+      10,   124,   643,    77,    21,    77,    77,    16,    17,    77,
+      13,    14,     3,    30,   655,   656,   657,     8,     0,   172,
+     173,   174,   175,    77,    76,    77,    78,    79,    80,     3,
+      82,    83,     6,    85,    75,   119,   120,    77,   122,     7,
+      77,    77,    77,    77,   169,   170,     7,    88,    89,    90,
+      91,    92,    93,    94,    77,    21,   209,    77,     3,    77,
+       7,    77,    77,     8,    77,    77,     7,     3,   206,    77,
+       6,   112,    78,    79,   115,    77,    93,    94,   206,   206,
+      78,    79,    21,     3,    93,    94,     6,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,     3,
+      76,    75,    78,    79,     8,     3,    82,    83,    84,    74,
+       8,     3,   139,   140,   141,   142,     8,    93,    94,    93,
+      94,     7,    75,     3,     7,   181,     6,    76,   184,   185,
+     186,   187,     3,    86,     7,     6,   179,   111,    75,    76,
+      93,    94,     6,   117,   118,   119,   120,   121,   122,    76,
+      77,    78,    79,    80,    81,   206,    93,    94,   178,   112,
+       3,     7,   115,     7,     3,     8,    93,    94,   188,   189,
+     190,    76,     7,     3,     7,     3,   113,   114,     8,   206,
+       8,     7,   206,   207,   208,   209,   206,   206,    93,    94,
+    1236,     3,  1236,  1236,  1236,     4,     8,  1236,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,     7,
+       7,    93,    94,    63,    64,    65,    66,    67,    68,    69,
+      70,    93,    94,     8,     3,    75,     3,     8,    93,    94,
+     206,     8,   206,     3,     3,    85,     3,    87,     8,     8,
+       4,     8,     4,    93,    94,    95,    96,    97,    98,    99,
+     100,    93,    94,   206,     3,  1021,     4,   206,     3,     8,
+       4,  1003,   112,     8,     4,   115,   116,   149,   150,   206,
+       3,  1048,     4,   123,     4,   180,     4,   182,   183,   206,
+     145,   146,   147,     4,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,     3,   432,     4,
+       4,   206,     8,     3,   176,   177,     4,     4,     8,     4,
+     152,   153,   154,   129,   130,   131,   132,   133,   134,     4,
+       3,   136,   137,   138,   206,     8,   176,   177,     3,     8,
+       3,     3,     3,     8,   206,     8,     8,     8,     3,     3,
+       3,   206,     3,     8,     8,     8,     3,     8,     3,     3,
+       8,     8,     4,     8,     8,   489,   206,   422,   423,   493,
+       3,     3,   207,     4,   206,     8,     8,   101,   102,   103,
+     104,   505,     4,     4,   508,   493,    22,    23,    24,    25,
+       4,   515,     4,   505,     4,     4,     4,   505,     4,     4,
+     508,   525,     4,     4,     4,     4,     3,   515,   505,     4,
+       4,   535,   505,   505,   540,   505,   540,   525,   508,   535,
+     540,     8,     3,   206,   540,   515,     4,   535,     4,     4,
+       4,   505,   540,   505,   505,   525,   560,   505,     4,     4,
+     562,   493,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,   505,   560,   505,     4,     4,   508,     4,   207,   207,
+     207,   207,   207,   515,   207,   505,   207,   209,   505,   505,
+     505,   505,   208,   525,     4,   208,   207,   209,   207,   207,
+       4,     4,   505,   535,   209,   505,     4,   505,   540,   505,
+     505,     4,   505,   505,   209,   209,   209,   505,     4,   209,
+       4,     4,   508,   505,     4,     4,     4,     4,   560,   515,
+     508,     4,     4,     4,     4,     4,     4,   515,   573,   574,
+     575,   191,   192,   193,   194,   195,   196,   197,   198,   199,
+     200,   201,   202,   203,   204,   205,     4,     4,     4,   207,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,   209,
+       4,     4,     4,     4,     4,   207,     4,     4,     4,   209,
+       4,   207,     4,     4,   207,     4,   207,     4,     4,     4,
+       4,     4,     4,     4,     4,   699,     4,   207,   700,     4,
+     209,     4,   706,   209,   209,     4,     4,     4,     4,   209,
+     207,     4,   207,     4,   207,     4,     4,     4,   706,     4,
+       4,     4,   209,     4,   207,   209,     8,     7,     7,     7,
+     206,     7,     7,     7,     5,   206,   740,   741,   742,     5,
+     744,   676,    11,    12,   206,     5,    15,   206,     5,    18,
+      19,    20,   740,   741,   742,   743,   744,   206,     7,   206,
+       5,     5,     5,   698,     5,     7,     5,     5,     5,   171,
+       3,     7,     7,     7,   706,     7,     7,     7,   206,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,   206,   740,   741,
+     742,   743,   744,     5,     5,     5,     5,   206,   206,   206,
+       7,   206,     5,     7,    93,    94,     7,     7,     7,     7,
+     206,   100,   206,   110,     7,     7,   105,   106,   107,   108,
+     109,   206,   111,   206,   206,   206,   206,   116,   206,   206,
+     206,   206,   206,   206,   206,   206,   125,   206,     7,   128,
+       7,   206,     7,     7,     4,     4,   135,     4,     4,     4,
+       4,   206,     4,     4,   143,   144,     4,   206,     4,   148,
+       4,   206,   151,     4,     6,     3,   155,     6,     3,     6,
+       6,     3,     6,     3,     7,     6,     3,     6,     6,     3,
+     206,     4,     4,     4,     4,     4,     4,   176,   177,     4,
+     179,     4,     4,     4,     4,     4,     4,     4,     3,   209,
+       6,     3,     6,     6,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,   207,   207,     4,   206,     4,   209,
+     207,   209,   207,   207,   207,   207,   207,     4,   207,   207,
+       4,   207,   207,   207,   207,   207,   207,   207,     4,   207,
+       4,   207,   209,     4,     4,     4,     3,   207,     6,   611,
+       4,     3,     8,     8,     4,     8,     4,     8,     4,   207,
+     209,   206,   206,   206,   206,   206,   206,   206,   206,   206,
+     206,   206,   206,   206,   206,   206,   206,   206,     4,     4,
+     207,   209,  1006,   206,     5,  1009,  1012,   206,  1012,     4,
+       4,  1015,  1012,  1009,  1006,     4,  1012,     4,  1006,  1015,
+     206,  1009,  1026,  1015,  1012,  1029,   733,  1015,  1032,  1006,
+    1026,   207,   209,  1006,  1006,   206,  1006,   207,  1026,   699,
+     432,  1029,  1015,  1015,  1048,  1015,   489,   706,   689,  1053,
+     787,  1000,  1006,  1057,  1006,  1006,  1026,  1024,  1006,  1029,
+    1048,  1015,  1066,  1015,  1015,  1053,  1005,  1015,  1072,  1057,
+    1066,  1075,  1006,   493,  1006,  1063,  1018,  1009,  1066,  1053,
+    1012,  1015,  1032,  1015,  1072,  1021,  1006,  1075,  1034,  1006,
+    1006,  1006,  1006,   543,  1026,  1015,  1041,  1029,  1015,  1015,
+    1015,  1015,  1072,  1006,  1008,  1075,  1006,  1006,  1006,   505,
+    1006,  1006,  1015,  1006,  1006,  1015,  1048,  1015,  1006,  1015,
+    1015,  1053,  1015,  1015,  1006,  1057,  1017,  1015,  1236,  1015,
+      81,  1063,  1011,  1015,  1066,  1009,  1012,  1015,   535,  1014,
+    1072,  1074,  1072,  1075,   508,   540,  1077,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,  1031,  1029,
+     757,  1027,    63,    64,    65,    66,    67,    68,    69,    70,
+    1075,  1242,    73,  1057,    75,    76,  1048,  1257,  1063,   560,
+     744,   700,  1278,  1298,   566,   705,  1072,   562,    -1,  1075,
+    1067,    -1,    93,    94,  1072,    96,    97,  1075,    99,   100,
+      -1,    -1,   525,    -1,    -1,    -1,   515,    -1,    -1,    -1,
+      -1,   112,    -1,    -1,   115,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   123,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1236,    -1,    -1,    -1,    -1,    -1,  1242,    -1,
+    1236,    -1,    -1,    -1,  1236,    -1,  1242,    -1,  1236,    -1,
+      -1,    -1,    -1,  1257,  1242,    -1,    -1,    -1,    -1,    -1,
+    1195,  1257,    -1,  1236,  1236,    -1,  1236,    -1,    -1,  1257,
+      -1,    -1,  1242,    -1,    -1,   176,   177,    -1,    -1,    -1,
+      -1,    -1,  1236,    -1,  1236,  1236,    -1,    -1,  1236,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1236,    -1,  1236,   206,    -1,    -1,    -1,    -1,
+    1242,    -1,    -1,    -1,    -1,    -1,  1236,    -1,    -1,  1236,
+    1236,  1236,  1236,    -1,    -1,  1257,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,  1236,    -1,    -1,  1236,    -1,  1236,    -1,
+    1236,  1236,    -1,  1236,  1236,    -1,    -1,    -1,  1236,    -1,
+    1236,    -1,    -1,    -1,  1236,    -1,    -1,    -1,  1236
   };
 
   const unsigned short int
   Dhcp6Parser::yystos_[] =
   {
-       0,   184,   185,   186,   187,   188,   189,   190,   191,   192,
-     193,   194,   195,   196,   197,   198,   204,   205,   206,   207,
-     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
-     218,   219,     0,     5,     7,     9,   199,   200,   201,   202,
-     220,   221,   222,   227,     7,   236,     7,   242,     7,   281,
-       7,   387,     7,   464,     7,   480,     7,   497,     7,   416,
-       7,   422,     7,   446,     7,   363,     7,   566,     7,   612,
-       7,   603,   228,   223,   237,   243,   282,   388,   465,   481,
-     498,   417,   423,   447,   364,   567,   613,   604,   220,   229,
-     230,   199,   225,   226,    10,   171,   181,   182,   183,   199,
-     235,   238,   239,   240,   595,   597,   599,   610,    11,    12,
-      15,    18,    19,    20,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    86,
-      87,    93,    98,    99,   100,   101,   102,   104,   109,   118,
-     121,   128,   136,   137,   141,   144,   148,   169,   170,   172,
-     235,   244,   245,   246,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
-     266,   268,   270,   272,   274,   275,   276,   277,   279,   288,
-     290,   292,   330,   336,   342,   348,   350,   357,   371,   381,
-     401,   406,   414,   440,   470,   472,   491,   521,   533,   545,
-     546,   554,   564,   601,   616,    16,    17,   235,   283,   284,
-     285,   287,   470,   472,    78,    80,    88,    89,    90,    91,
-      92,   105,   108,   116,   235,   248,   249,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   260,   261,   262,   263,
-     266,   268,   270,   272,   274,   389,   390,   391,   393,   395,
-     397,   399,   401,   404,   405,   440,   458,   470,   472,   474,
-     491,   516,    79,   235,   397,   399,   440,   466,   467,   468,
-     470,   472,    81,    82,    83,    84,    85,   235,   397,   399,
-     440,   470,   472,   482,   483,   484,   486,   487,   489,   490,
-     104,   110,   111,   112,   113,   114,   115,   235,   440,   470,
-     472,   499,   500,   501,   502,   504,   506,   508,   510,   512,
-     514,   414,    21,    69,    71,    72,    75,    76,    77,   235,
-     310,   424,   425,   426,   427,   428,   429,   430,   432,   434,
-     436,   437,   439,   470,   472,    70,    73,    74,   235,   310,
-     428,   434,   448,   449,   450,   451,   452,   454,   455,   456,
-     457,   470,   472,   119,   120,   235,   365,   366,   367,   369,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,   169,   170,   235,   470,   472,   568,   569,
-     570,   571,   573,   575,   576,   578,   579,   580,   583,   585,
-     586,   587,   589,   591,   593,   614,   615,   616,    13,    14,
-     605,   606,   607,   609,     6,     3,     4,     8,     3,   241,
-     611,   596,   598,   600,     4,     3,     8,   247,   602,   280,
-     289,   291,   293,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   278,     4,     4,     4,     4,
-       4,   264,   267,   269,     4,   382,   415,   441,   471,   473,
-     402,   407,   337,   349,   343,   331,   522,   492,   358,   372,
-     534,     4,   351,   547,   555,   565,   271,   273,   617,     3,
-       8,   286,     4,     3,     8,   459,   475,   392,   394,   396,
-       4,     4,   400,   398,   517,     3,     8,   469,     3,     8,
-     485,     4,   488,     4,     4,     3,     8,   515,   503,   505,
-     507,   509,   511,   513,     8,     3,     8,   431,   311,     4,
-     435,   433,   438,     4,     8,     3,   453,     4,     4,     8,
-       3,   368,   370,     3,     8,     4,   572,   574,     4,   577,
-       4,     4,   581,   584,     4,     4,   588,   590,   592,   594,
-       3,     8,     3,     8,   608,     4,     3,     8,   220,   220,
-     199,     4,     4,     4,     4,     4,   239,     4,     4,     4,
-       4,     4,     4,   200,   200,   200,   200,   200,   200,   200,
-     200,   202,   201,   201,   200,     4,   200,   200,   202,   202,
-     202,     4,     4,     4,   202,     4,     4,     4,     4,     4,
+       0,   191,   192,   193,   194,   195,   196,   197,   198,   199,
+     200,   201,   202,   203,   204,   205,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,     0,     5,     7,     9,   206,   207,   208,   209,
+     227,   228,   229,   234,     7,   243,     7,   249,     7,   292,
+       7,   405,     7,   482,     7,   498,     7,   515,     7,   434,
+       7,   440,     7,   464,     7,   381,     7,   584,     7,   630,
+       7,   621,   235,   230,   244,   250,   293,   406,   483,   499,
+     516,   435,   441,   465,   382,   585,   631,   622,   227,   236,
+     237,   206,   232,   233,    10,   178,   188,   189,   190,   206,
+     242,   245,   246,   247,   613,   615,   617,   628,    11,    12,
+      15,    18,    19,    20,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    93,    94,   100,   105,   106,   107,   108,   109,
+     111,   116,   125,   128,   135,   143,   144,   148,   151,   155,
+     176,   177,   179,   242,   251,   252,   253,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   269,   270,   273,   275,   277,   279,   281,   282,   284,
+     285,   286,   287,   288,   290,   299,   301,   303,   348,   354,
+     360,   366,   368,   375,   389,   399,   419,   424,   432,   458,
+     488,   490,   509,   539,   551,   563,   564,   572,   582,   619,
+     634,    16,    17,   242,   294,   295,   296,   298,   488,   490,
+      85,    87,    95,    96,    97,    98,    99,   112,   115,   123,
+     242,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   267,   268,   269,   270,   273,   275,   277,   279,
+     281,   282,   407,   408,   409,   411,   413,   415,   417,   419,
+     422,   423,   458,   476,   488,   490,   492,   509,   534,    86,
+     242,   415,   417,   458,   484,   485,   486,   488,   490,    88,
+      89,    90,    91,    92,   242,   415,   417,   458,   488,   490,
+     500,   501,   502,   504,   505,   507,   508,   111,   117,   118,
+     119,   120,   121,   122,   242,   458,   488,   490,   517,   518,
+     519,   520,   522,   524,   526,   528,   530,   532,   432,    21,
+      76,    78,    79,    82,    83,    84,   242,   321,   442,   443,
+     444,   445,   446,   447,   448,   450,   452,   454,   455,   457,
+     488,   490,    77,    80,    81,   242,   321,   446,   452,   466,
+     467,   468,   469,   470,   472,   473,   474,   475,   488,   490,
+     126,   127,   242,   383,   384,   385,   387,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     176,   177,   242,   488,   490,   586,   587,   588,   589,   591,
+     593,   594,   596,   597,   598,   601,   603,   604,   605,   607,
+     609,   611,   632,   633,   634,    13,    14,   623,   624,   625,
+     627,     6,     3,     4,     8,     3,   248,   629,   614,   616,
+     618,     4,     3,     8,   254,   620,   291,   300,   302,   304,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   200,     4,     4,     4,     4,     4,     4,     4,   245,
-       4,   202,   284,     4,     4,     4,     4,     4,   200,   202,
-       4,     4,     4,   390,     4,   467,     4,   200,     4,   200,
-     200,   483,     4,     4,     4,     4,     4,     4,     4,   501,
-       4,     4,   200,     4,     4,     4,   202,   426,     4,   202,
-     202,   450,     4,     4,   366,   202,     4,     4,   200,     4,
-     200,   200,     4,     4,   202,   202,     4,     4,     4,     4,
-     569,   615,     4,   200,   606,     4,     7,     7,   220,   220,
-     220,   199,     7,     7,     7,     7,     5,   199,   165,   166,
-     167,   168,   202,   265,   199,   199,     5,     5,     5,   222,
-     224,   199,    94,    95,    96,    97,   403,     5,     5,     5,
-       5,     7,     5,     5,     5,     7,     7,     7,     7,     7,
-       7,   199,   199,     5,     5,   231,     5,     5,   199,   199,
-     199,   231,   199,     7,   199,   199,   199,   231,   231,   231,
-     199,   199,   199,   199,   199,   199,   199,   199,   199,   199,
-     199,   220,   199,   199,   199,   162,   163,   582,   164,   265,
-     199,   199,   199,     5,   220,   244,   614,   605,   283,    21,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,   235,   298,
-     299,   300,   303,   305,   307,   309,   310,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   323,   324,   326,
-     328,   298,     7,   294,   295,   296,     7,   383,   384,   385,
-       7,   418,   419,   420,     7,   442,   443,   444,     7,   408,
-     409,   410,   112,   199,   338,   339,   340,   341,   229,   113,
-     115,   340,   344,   345,   346,   347,   103,   332,   333,   334,
-       7,   523,   524,     7,   493,   494,   495,     7,   359,   360,
-     361,   122,   123,   124,   125,   126,   127,   373,   374,   375,
-     376,   377,   378,   379,   380,    21,   132,   133,   134,   135,
-     235,   312,   470,   472,   535,   536,   537,   540,   541,   543,
-     544,   138,   139,   140,   235,   352,   353,   354,   355,   356,
-     470,   472,   142,   143,   235,   470,   472,   548,   549,   550,
-     552,   145,   146,   147,   199,   470,   472,   556,   557,   558,
-     559,   561,   562,   568,     7,   618,   619,   232,     7,   460,
-     461,   462,     7,   476,   477,   478,   117,   502,   518,   519,
-     294,     8,     8,     8,     8,   301,   304,   306,   308,     4,
-       4,     4,     4,     4,   322,     4,     4,   325,   327,   329,
-       4,     4,     4,     4,     3,     8,     8,   297,     6,     3,
-     386,     6,     3,   421,     6,     3,   445,     6,     3,   411,
-       6,     3,     3,     6,     6,     3,     6,   335,     3,     8,
-     525,     3,     6,   496,     6,     3,   362,     6,     3,     4,
-       4,     4,     4,     4,     4,     3,     8,   538,   542,     4,
-       4,     4,     3,     8,     4,     4,     4,     3,     8,   551,
-     553,     3,     8,     4,   560,     4,   563,     3,     8,     8,
-     620,     3,     6,   199,   233,   234,   463,     6,     3,   479,
-       6,     3,   520,     8,     6,     4,     4,     4,     4,   200,
-     202,   200,   202,   200,     4,   200,   200,     4,     4,     4,
-     200,   200,   202,   200,   299,   298,   296,   389,   385,   424,
-     420,   448,   444,   235,   248,   249,   250,   251,   252,   253,
-     254,   255,   256,   257,   258,   260,   261,   262,   263,   266,
-     268,   270,   272,   274,   310,   381,   393,   395,   397,   399,
-     401,   405,   412,   413,   440,   470,   472,   516,   410,   339,
-     345,     4,   333,   106,   107,   235,   310,   440,   470,   472,
-     526,   527,   528,   529,   530,   532,   524,   499,   495,   365,
-     361,   200,   200,   200,   200,   200,   200,   374,     4,     4,
-     200,   200,   200,   536,   202,   200,   200,   353,     4,     4,
-     549,   202,     4,   200,     4,   557,   173,   175,   176,   235,
-     310,   470,   472,   621,   622,   623,   624,   626,   619,     6,
-       3,   466,   462,   482,   478,     4,    22,    23,    24,    25,
-     302,   199,   199,   199,   199,   199,   199,   199,     8,     8,
-       8,     8,     3,     8,   199,   531,     4,     8,     3,     8,
-       8,   129,   130,   131,   539,   199,   199,   199,   199,   220,
-     627,     4,   625,     3,     8,   199,     8,     8,   199,   413,
-       4,   202,   528,     4,   200,     4,   622,   199,     5,   199,
-       7,   628,   629,   630,     3,     6,   174,   177,   178,   179,
-     180,   631,   632,   633,   635,   636,   637,   638,   629,   634,
-       4,     4,     4,   639,     3,     8,     4,   202,   200,   200,
-       4,   632,   199,   199
+       4,     4,   289,     4,     4,     4,     4,     4,   271,   274,
+     276,     4,   283,     4,     4,   400,   433,   459,   489,   491,
+     420,   425,   355,   367,   361,   349,   540,   510,   376,   390,
+     552,     4,   369,   565,   573,   583,   278,   280,   635,     3,
+       8,   297,     4,     3,     8,   477,   493,   410,   412,   414,
+       4,     4,   418,   416,   535,     3,     8,   487,     3,     8,
+     503,     4,   506,     4,     4,     3,     8,   533,   521,   523,
+     525,   527,   529,   531,     8,     3,     8,   449,   322,     4,
+     453,   451,   456,     4,     8,     3,   471,     4,     4,     8,
+       3,   386,   388,     3,     8,     4,   590,   592,     4,   595,
+       4,     4,   599,   602,     4,     4,   606,   608,   610,   612,
+       3,     8,     3,     8,   626,     4,     3,     8,   227,   227,
+     206,     4,     4,     4,     4,     4,   246,     4,     4,     4,
+       4,     4,     4,   207,   207,   207,   207,   207,   207,   207,
+     207,   209,   208,   208,   207,     4,   207,   207,   209,   209,
+     209,     4,     4,     4,   209,     4,   209,   209,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,   207,     4,     4,     4,     4,     4,
+       4,     4,   252,     4,   209,   295,     4,     4,     4,     4,
+       4,   207,   209,     4,     4,     4,   408,     4,   485,     4,
+     207,     4,   207,   207,   501,     4,     4,     4,     4,     4,
+       4,     4,   519,     4,     4,   207,     4,     4,     4,   209,
+     444,     4,   209,   209,   468,     4,     4,   384,   209,     4,
+       4,   207,     4,   207,   207,     4,     4,   209,   209,     4,
+       4,     4,     4,   587,   633,     4,   207,   624,     4,     7,
+       7,   227,   227,   227,   206,     7,     7,     7,     7,     5,
+     206,   172,   173,   174,   175,   209,   272,   206,   206,   206,
+       5,     5,     5,   229,   231,   206,   101,   102,   103,   104,
+     421,     5,     5,     5,     5,     7,     5,     5,     5,     7,
+       7,     7,     7,     7,     7,   206,   206,     5,     5,   238,
+       5,     5,   206,   206,   206,   238,   206,     7,   206,   206,
+     206,   238,   238,   238,   206,   206,   206,   206,   206,   206,
+     206,   206,   206,   206,   206,   227,   206,   206,   206,   169,
+     170,   600,   171,   272,   206,   206,   206,     5,   227,   251,
+     632,   623,   294,    21,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,   242,   309,   310,   311,
+     314,   316,   318,   320,   321,   323,   324,   325,   326,   327,
+     328,   329,   331,   333,   335,   336,   337,   338,   339,   341,
+     342,   344,   346,   309,     7,   305,   306,   307,     7,   401,
+     402,   403,     7,   436,   437,   438,     7,   460,   461,   462,
+       7,   426,   427,   428,   119,   206,   356,   357,   358,   359,
+     236,   120,   122,   358,   362,   363,   364,   365,   110,   350,
+     351,   352,     7,   541,   542,     7,   511,   512,   513,     7,
+     377,   378,   379,   129,   130,   131,   132,   133,   134,   391,
+     392,   393,   394,   395,   396,   397,   398,    21,   139,   140,
+     141,   142,   242,   323,   488,   490,   553,   554,   555,   558,
+     559,   561,   562,   145,   146,   147,   242,   370,   371,   372,
+     373,   374,   488,   490,   149,   150,   242,   488,   490,   566,
+     567,   568,   570,   152,   153,   154,   206,   488,   490,   574,
+     575,   576,   577,   579,   580,   586,     7,   636,   637,   239,
+       7,   478,   479,   480,     7,   494,   495,   496,   124,   520,
+     536,   537,   305,     8,     8,     8,     8,   312,   315,   317,
+     319,     4,     4,     4,     4,     4,   340,     4,     4,   343,
+     345,   347,     4,     4,     4,     4,   330,   332,   334,     4,
+       3,     8,     8,   308,     6,     3,   404,     6,     3,   439,
+       6,     3,   463,     6,     3,   429,     6,     3,     3,     6,
+       6,     3,     6,   353,     3,     8,   543,     3,     6,   514,
+       6,     3,   380,     6,     3,     4,     4,     4,     4,     4,
+       4,     3,     8,   556,   560,     4,     4,     4,     3,     8,
+       4,     4,     4,     3,     8,   569,   571,     3,     8,     4,
+     578,     4,   581,     3,     8,     8,   638,     3,     6,   206,
+     240,   241,   481,     6,     3,   497,     6,     3,   538,     8,
+       6,     4,     4,     4,     4,   207,   209,   207,   209,   207,
+       4,   207,   207,     4,     4,     4,   207,   207,   209,   207,
+       4,     4,     4,   207,   310,   309,   307,   407,   403,   442,
+     438,   466,   462,   242,   255,   256,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   267,   268,   269,   270,   273,
+     275,   277,   279,   281,   282,   321,   399,   411,   413,   415,
+     417,   419,   423,   430,   431,   458,   488,   490,   534,   428,
+     357,   363,     4,   351,   113,   114,   242,   321,   458,   488,
+     490,   544,   545,   546,   547,   548,   550,   542,   517,   513,
+     383,   379,   207,   207,   207,   207,   207,   207,   392,     4,
+       4,   207,   207,   207,   554,   209,   207,   207,   371,     4,
+       4,   567,   209,     4,   207,     4,   575,   180,   182,   183,
+     242,   321,   488,   490,   639,   640,   641,   642,   644,   637,
+       6,     3,   484,   480,   500,   496,     4,    22,    23,    24,
+      25,   313,   206,   206,   206,   206,   206,   206,   206,   206,
+     206,   206,     8,     8,     8,     8,     3,     8,   206,   549,
+       4,     8,     3,     8,     8,   136,   137,   138,   557,   206,
+     206,   206,   206,   227,   645,     4,   643,     3,     8,   206,
+       8,     8,   206,   431,     4,   209,   546,     4,   207,     4,
+     640,   206,     5,   206,     7,   646,   647,   648,     3,     6,
+     181,   184,   185,   186,   187,   649,   650,   651,   653,   654,
+     655,   656,   647,   652,     4,     4,     4,   657,     3,     8,
+       4,   209,   207,   207,     4,   650,   206,   206
   };
 
   const unsigned short int
   Dhcp6Parser::yyr1_[] =
   {
-       0,   203,   205,   204,   206,   204,   207,   204,   208,   204,
-     209,   204,   210,   204,   211,   204,   212,   204,   213,   204,
-     214,   204,   215,   204,   216,   204,   217,   204,   218,   204,
-     219,   204,   220,   220,   220,   220,   220,   220,   220,   221,
-     223,   222,   224,   225,   225,   226,   226,   228,   227,   229,
-     229,   230,   230,   232,   231,   233,   233,   234,   234,   235,
-     237,   236,   238,   238,   239,   239,   239,   239,   239,   239,
-     241,   240,   243,   242,   244,   244,   245,   245,   245,   245,
-     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
-     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
-     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
-     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
-     245,   245,   245,   245,   245,   245,   245,   245,   245,   247,
-     246,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,   259,   260,   261,   262,   264,   263,   265,   265,
-     265,   265,   265,   267,   266,   269,   268,   271,   270,   273,
-     272,   274,   275,   276,   278,   277,   280,   279,   282,   281,
-     283,   283,   284,   284,   284,   284,   284,   286,   285,   287,
-     289,   288,   291,   290,   293,   292,   294,   294,   295,   295,
-     297,   296,   298,   298,   299,   299,   299,   299,   299,   299,
-     299,   299,   299,   299,   299,   299,   299,   299,   299,   299,
-     299,   299,   299,   299,   299,   301,   300,   302,   302,   302,
-     302,   304,   303,   306,   305,   308,   307,   309,   311,   310,
-     312,   313,   314,   315,   316,   317,   318,   319,   320,   322,
-     321,   323,   325,   324,   327,   326,   329,   328,   331,   330,
-     332,   332,   333,   335,   334,   337,   336,   338,   338,   339,
-     339,   340,   341,   343,   342,   344,   344,   345,   345,   345,
-     346,   347,   349,   348,   351,   350,   352,   352,   353,   353,
-     353,   353,   353,   353,   354,   355,   356,   358,   357,   359,
-     359,   360,   360,   362,   361,   364,   363,   365,   365,   365,
-     366,   366,   368,   367,   370,   369,   372,   371,   373,   373,
-     374,   374,   374,   374,   374,   374,   375,   376,   377,   378,
-     379,   380,   382,   381,   383,   383,   384,   384,   386,   385,
-     388,   387,   389,   389,   390,   390,   390,   390,   390,   390,
-     390,   390,   390,   390,   390,   390,   390,   390,   390,   390,
-     390,   390,   390,   390,   390,   390,   390,   390,   390,   390,
-     390,   390,   390,   390,   390,   390,   390,   390,   390,   390,
-     392,   391,   394,   393,   396,   395,   398,   397,   400,   399,
-     402,   401,   403,   403,   403,   403,   404,   405,   407,   406,
-     408,   408,   409,   409,   411,   410,   412,   412,   413,   413,
-     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
-     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
-     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
-     413,   415,   414,   417,   416,   418,   418,   419,   419,   421,
-     420,   423,   422,   424,   424,   425,   425,   426,   426,   426,
-     426,   426,   426,   426,   426,   426,   426,   427,   428,   429,
-     431,   430,   433,   432,   435,   434,   436,   438,   437,   439,
-     441,   440,   442,   442,   443,   443,   445,   444,   447,   446,
-     448,   448,   449,   449,   450,   450,   450,   450,   450,   450,
-     450,   450,   450,   451,   453,   452,   454,   455,   456,   457,
+       0,   210,   212,   211,   213,   211,   214,   211,   215,   211,
+     216,   211,   217,   211,   218,   211,   219,   211,   220,   211,
+     221,   211,   222,   211,   223,   211,   224,   211,   225,   211,
+     226,   211,   227,   227,   227,   227,   227,   227,   227,   228,
+     230,   229,   231,   232,   232,   233,   233,   235,   234,   236,
+     236,   237,   237,   239,   238,   240,   240,   241,   241,   242,
+     244,   243,   245,   245,   246,   246,   246,   246,   246,   246,
+     248,   247,   250,   249,   251,   251,   252,   252,   252,   252,
+     252,   252,   252,   252,   252,   252,   252,   252,   252,   252,
+     252,   252,   252,   252,   252,   252,   252,   252,   252,   252,
+     252,   252,   252,   252,   252,   252,   252,   252,   252,   252,
+     252,   252,   252,   252,   252,   252,   252,   252,   252,   252,
+     252,   252,   252,   252,   252,   252,   252,   252,   252,   252,
+     252,   252,   254,   253,   255,   256,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   268,   269,   271,
+     270,   272,   272,   272,   272,   272,   274,   273,   276,   275,
+     278,   277,   280,   279,   281,   283,   282,   284,   285,   286,
+     287,   289,   288,   291,   290,   293,   292,   294,   294,   295,
+     295,   295,   295,   295,   297,   296,   298,   300,   299,   302,
+     301,   304,   303,   305,   305,   306,   306,   308,   307,   309,
+     309,   310,   310,   310,   310,   310,   310,   310,   310,   310,
+     310,   310,   310,   310,   310,   310,   310,   310,   310,   310,
+     310,   310,   310,   310,   310,   310,   312,   311,   313,   313,
+     313,   313,   315,   314,   317,   316,   319,   318,   320,   322,
+     321,   323,   324,   325,   326,   327,   328,   330,   329,   332,
+     331,   334,   333,   335,   336,   337,   338,   340,   339,   341,
+     343,   342,   345,   344,   347,   346,   349,   348,   350,   350,
+     351,   353,   352,   355,   354,   356,   356,   357,   357,   358,
+     359,   361,   360,   362,   362,   363,   363,   363,   364,   365,
+     367,   366,   369,   368,   370,   370,   371,   371,   371,   371,
+     371,   371,   372,   373,   374,   376,   375,   377,   377,   378,
+     378,   380,   379,   382,   381,   383,   383,   383,   384,   384,
+     386,   385,   388,   387,   390,   389,   391,   391,   392,   392,
+     392,   392,   392,   392,   393,   394,   395,   396,   397,   398,
+     400,   399,   401,   401,   402,   402,   404,   403,   406,   405,
+     407,   407,   408,   408,   408,   408,   408,   408,   408,   408,
+     408,   408,   408,   408,   408,   408,   408,   408,   408,   408,
+     408,   408,   408,   408,   408,   408,   408,   408,   408,   408,
+     408,   408,   408,   408,   408,   408,   408,   408,   408,   410,
+     409,   412,   411,   414,   413,   416,   415,   418,   417,   420,
+     419,   421,   421,   421,   421,   422,   423,   425,   424,   426,
+     426,   427,   427,   429,   428,   430,   430,   431,   431,   431,
+     431,   431,   431,   431,   431,   431,   431,   431,   431,   431,
+     431,   431,   431,   431,   431,   431,   431,   431,   431,   431,
+     431,   431,   431,   431,   431,   431,   431,   431,   431,   431,
+     431,   433,   432,   435,   434,   436,   436,   437,   437,   439,
+     438,   441,   440,   442,   442,   443,   443,   444,   444,   444,
+     444,   444,   444,   444,   444,   444,   444,   445,   446,   447,
+     449,   448,   451,   450,   453,   452,   454,   456,   455,   457,
      459,   458,   460,   460,   461,   461,   463,   462,   465,   464,
-     466,   466,   467,   467,   467,   467,   467,   467,   467,   469,
-     468,   471,   470,   473,   472,   475,   474,   476,   476,   477,
-     477,   479,   478,   481,   480,   482,   482,   483,   483,   483,
-     483,   483,   483,   483,   483,   483,   483,   483,   485,   484,
-     486,   488,   487,   489,   490,   492,   491,   493,   493,   494,
-     494,   496,   495,   498,   497,   499,   499,   500,   500,   501,
-     501,   501,   501,   501,   501,   501,   501,   501,   501,   501,
-     503,   502,   505,   504,   507,   506,   509,   508,   511,   510,
-     513,   512,   515,   514,   517,   516,   518,   518,   520,   519,
-     522,   521,   523,   523,   525,   524,   526,   526,   527,   527,
-     528,   528,   528,   528,   528,   528,   528,   529,   531,   530,
-     532,   534,   533,   535,   535,   536,   536,   536,   536,   536,
-     536,   536,   536,   536,   538,   537,   539,   539,   539,   540,
-     542,   541,   543,   544,   545,   547,   546,   548,   548,   549,
-     549,   549,   549,   549,   551,   550,   553,   552,   555,   554,
-     556,   556,   557,   557,   557,   557,   557,   557,   558,   560,
-     559,   561,   563,   562,   565,   564,   567,   566,   568,   568,
-     569,   569,   569,   569,   569,   569,   569,   569,   569,   569,
-     569,   569,   569,   569,   569,   569,   569,   569,   570,   572,
-     571,   574,   573,   575,   577,   576,   578,   579,   581,   580,
-     582,   582,   584,   583,   585,   586,   588,   587,   590,   589,
-     592,   591,   594,   593,   596,   595,   598,   597,   600,   599,
-     602,   601,   604,   603,   605,   605,   606,   606,   608,   607,
-     609,   611,   610,   613,   612,   614,   614,   615,   617,   616,
-     618,   618,   620,   619,   621,   621,   622,   622,   622,   622,
-     622,   622,   622,   623,   625,   624,   627,   626,   628,   628,
-     630,   629,   631,   631,   632,   632,   632,   632,   632,   634,
-     633,   635,   636,   637,   639,   638
+     466,   466,   467,   467,   468,   468,   468,   468,   468,   468,
+     468,   468,   468,   469,   471,   470,   472,   473,   474,   475,
+     477,   476,   478,   478,   479,   479,   481,   480,   483,   482,
+     484,   484,   485,   485,   485,   485,   485,   485,   485,   487,
+     486,   489,   488,   491,   490,   493,   492,   494,   494,   495,
+     495,   497,   496,   499,   498,   500,   500,   501,   501,   501,
+     501,   501,   501,   501,   501,   501,   501,   501,   503,   502,
+     504,   506,   505,   507,   508,   510,   509,   511,   511,   512,
+     512,   514,   513,   516,   515,   517,   517,   518,   518,   519,
+     519,   519,   519,   519,   519,   519,   519,   519,   519,   519,
+     521,   520,   523,   522,   525,   524,   527,   526,   529,   528,
+     531,   530,   533,   532,   535,   534,   536,   536,   538,   537,
+     540,   539,   541,   541,   543,   542,   544,   544,   545,   545,
+     546,   546,   546,   546,   546,   546,   546,   547,   549,   548,
+     550,   552,   551,   553,   553,   554,   554,   554,   554,   554,
+     554,   554,   554,   554,   556,   555,   557,   557,   557,   558,
+     560,   559,   561,   562,   563,   565,   564,   566,   566,   567,
+     567,   567,   567,   567,   569,   568,   571,   570,   573,   572,
+     574,   574,   575,   575,   575,   575,   575,   575,   576,   578,
+     577,   579,   581,   580,   583,   582,   585,   584,   586,   586,
+     587,   587,   587,   587,   587,   587,   587,   587,   587,   587,
+     587,   587,   587,   587,   587,   587,   587,   587,   588,   590,
+     589,   592,   591,   593,   595,   594,   596,   597,   599,   598,
+     600,   600,   602,   601,   603,   604,   606,   605,   608,   607,
+     610,   609,   612,   611,   614,   613,   616,   615,   618,   617,
+     620,   619,   622,   621,   623,   623,   624,   624,   626,   625,
+     627,   629,   628,   631,   630,   632,   632,   633,   635,   634,
+     636,   636,   638,   637,   639,   639,   640,   640,   640,   640,
+     640,   640,   640,   641,   643,   642,   645,   644,   646,   646,
+     648,   647,   649,   649,   650,   650,   650,   650,   650,   652,
+     651,   653,   654,   655,   657,   656
   };
 
   const unsigned char
@@ -5189,34 +5307,36 @@ namespace isc { namespace dhcp {
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     0,     4,     1,     1,
-       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
-       4,     3,     3,     3,     0,     4,     0,     6,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     0,     4,     3,
-       0,     6,     0,     6,     0,     6,     0,     1,     1,     3,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     1,     1,     1,
-       1,     0,     4,     0,     4,     0,     4,     3,     0,     4,
+       1,     1,     0,     4,     3,     3,     3,     3,     3,     3,
        3,     3,     3,     3,     3,     3,     3,     3,     3,     0,
-       4,     3,     0,     4,     0,     4,     0,     4,     0,     6,
-       1,     3,     1,     0,     4,     0,     6,     1,     3,     1,
-       1,     1,     1,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     0,     6,     0,     6,     1,     3,     1,     1,
-       1,     1,     1,     1,     3,     3,     3,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     0,     4,     0,     4,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       4,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     0,     4,     3,     0,     4,     3,     3,     3,
+       3,     0,     4,     0,     6,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     0,     4,     3,     0,     6,     0,
+       6,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     1,     1,
+       1,     1,     0,     4,     0,     4,     0,     4,     3,     0,
+       4,     3,     3,     3,     3,     3,     3,     0,     4,     0,
+       4,     0,     4,     3,     3,     3,     3,     0,     4,     3,
+       0,     4,     0,     4,     0,     4,     0,     6,     1,     3,
+       1,     0,     4,     0,     6,     1,     3,     1,     1,     1,
+       1,     0,     6,     1,     3,     1,     1,     1,     1,     1,
+       0,     6,     0,     6,     1,     3,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     0,     6,     0,     1,     1,
+       3,     0,     4,     0,     4,     1,     3,     1,     1,     1,
+       0,     4,     0,     4,     0,     6,     1,     3,     1,     1,
+       1,     1,     1,     1,     3,     3,     3,     3,     3,     3,
+       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     1,     1,     1,     1,     3,     3,     0,     6,
-       0,     1,     1,     3,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     1,     1,     1,     1,     3,     3,     0,     6,     0,
+       1,     1,     3,     0,     4,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -5276,25 +5396,27 @@ namespace isc { namespace dhcp {
   "\"connect-timeout\"", "\"contact-points\"", "\"max-reconnect-tries\"",
   "\"reconnect-wait-time\"", "\"keyspace\"", "\"consistency\"",
   "\"serial-consistency\"", "\"request-timeout\"", "\"tcp-keepalive\"",
-  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"preferred-lifetime\"",
-  "\"min-preferred-lifetime\"", "\"max-preferred-lifetime\"",
-  "\"valid-lifetime\"", "\"min-valid-lifetime\"", "\"max-valid-lifetime\"",
-  "\"renew-timer\"", "\"rebind-timer\"", "\"calculate-tee-times\"",
-  "\"t1-percent\"", "\"t2-percent\"", "\"decline-probation-period\"",
-  "\"server-tag\"", "\"statistic-default-sample-count\"",
-  "\"statistic-default-sample-age\"", "\"ddns-send-updates\"",
-  "\"ddns-override-no-update\"", "\"ddns-override-client-update\"",
-  "\"ddns-replace-client-name\"", "\"ddns-generated-prefix\"",
-  "\"ddns-qualifying-suffix\"", "\"store-extended-info\"", "\"subnet6\"",
-  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
-  "\"space\"", "\"csv-format\"", "\"always-send\"", "\"record-types\"",
-  "\"encapsulate\"", "\"array\"", "\"pools\"", "\"pool\"", "\"pd-pools\"",
-  "\"prefix\"", "\"prefix-len\"", "\"excluded-prefix\"",
-  "\"excluded-prefix-len\"", "\"delegated-len\"", "\"user-context\"",
-  "\"comment\"", "\"subnet\"", "\"interface\"", "\"interface-id\"",
-  "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"", "\"disabled\"",
-  "\"out-of-pool\"", "\"global\"", "\"all\"", "\"shared-networks\"",
-  "\"mac-sources\"", "\"relay-supplied-options\"",
+  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"durability\"",
+  "\"lfc-format\"", "\"lfc-mode\"", "\"lfc-write-rate\"",
+  "\"preferred-lifetime\"", "\"min-preferred-lifetime\"",
+  "\"max-preferred-lifetime\"", "\"valid-lifetime\"",
+  "\"min-valid-lifetime\"", "\"max-valid-lifetime\"", "\"renew-timer\"",
+  "\"rebind-timer\"", "\"calculate-tee-times\"", "\"t1-percent\"",
+  "\"t2-percent\"", "\"decline-probation-period\"", "\"server-tag\"",
+  "\"statistic-default-sample-count\"", "\"statistic-default-sample-age\"",
+  "\"ddns-send-updates\"", "\"ddns-override-no-update\"",
+  "\"ddns-override-client-update\"", "\"ddns-replace-client-name\"",
+  "\"ddns-generated-prefix\"", "\"ddns-qualifying-suffix\"",
+  "\"store-extended-info\"", "\"allocator\"", "\"free-lease-index\"",
+  "\"option-arena\"", "\"subnet6\"", "\"option-def\"", "\"option-data\"",
+  "\"name\"", "\"data\"", "\"code\"", "\"space\"", "\"csv-format\"",
+  "\"always-send\"", "\"record-types\"", "\"encapsulate\"", "\"array\"",
+  "\"pools\"", "\"pool\"", "\"pd-pools\"", "\"prefix\"", "\"prefix-len\"",
+  "\"excluded-prefix\"", "\"excluded-prefix-len\"", "\"delegated-len\"",
+  "\"user-context\"", "\"comment\"", "\"subnet\"", "\"interface\"",
+  "\"interface-id\"", "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
+  "\"disabled\"", "\"out-of-pool\"", "\"global\"", "\"all\"",
+  "\"shared-networks\"", "\"mac-sources\"", "\"relay-supplied-options\"",
   "\"host-reservation-identifiers\"", "\"sanity-checks\"",
   "\"lease-checks\"", "\"client-classes\"", "\"require-client-classes\"",
   "\"test\"", "\"only-if-required\"", "\"client-class\"",
@@ -5341,181 +5463,185 @@ namespace isc { namespace dhcp {
   "ddns_replace_client_name", "$@23", "ddns_replace_client_name_value",
   "ddns_generated_prefix", "$@24", "ddns_qualifying_suffix", "$@25",
   "hostname_char_set", "$@26", "hostname_char_replacement", "$@27",
-  "store_extended_info", "statistic_default_sample_count",
-  "statistic_default_sample_age", "server_tag", "$@28",
-  "interfaces_config", "$@29", "sub_interfaces6", "$@30",
+  "store_extended_info", "allocator", "$@28", "free_lease_index",
+  "option_arena", "statistic_default_sample_count",
+  "statistic_default_sample_age", "server_tag", "$@29",
+  "interfaces_config", "$@30", "sub_interfaces6", "$@31",
   "interfaces_config_params", "interfaces_config_param", "interfaces_list",
-  "$@31", "re_detect", "lease_database", "$@32", "hosts_database", "$@33",
-  "hosts_databases", "$@34", "database_list", "not_empty_database_list",
-  "database", "$@35", "database_map_params", "database_map_param",
-  "database_type", "$@36", "db_type", "user", "$@37", "password", "$@38",
-  "host", "$@39", "port", "name", "$@40", "persist", "lfc_interval",
+  "$@32", "re_detect", "lease_database", "$@33", "hosts_database", "$@34",
+  "hosts_databases", "$@35", "database_list", "not_empty_database_list",
+  "database", "$@36", "database_map_params", "database_map_param",
+  "database_type", "$@37", "db_type", "user", "$@38", "password", "$@39",
+  "host", "$@40", "port", "name", "$@41", "persist", "lfc_interval",
   "readonly", "connect_timeout", "reconnect_wait_time", "max_row_errors",
-  "request_timeout", "tcp_keepalive", "tcp_nodelay", "contact_points",
-  "$@41", "max_reconnect_tries", "keyspace", "$@42", "consistency", "$@43",
-  "serial_consistency", "$@44", "sanity_checks", "$@45",
-  "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@46",
-  "mac_sources", "$@47", "mac_sources_list", "mac_sources_value",
-  "duid_id", "string_id", "host_reservation_identifiers", "$@48",
+  "durability", "$@42", "lfc_format", "$@43", "lfc_mode", "$@44",
+  "lfc_write_rate", "request_timeout", "tcp_keepalive", "tcp_nodelay",
+  "contact_points", "$@45", "max_reconnect_tries", "keyspace", "$@46",
+  "consistency", "$@47", "serial_consistency", "$@48", "sanity_checks",
+  "$@49", "sanity_checks_params", "sanity_checks_param", "lease_checks",
+  "$@50", "mac_sources", "$@51", "mac_sources_list", "mac_sources_value",
+  "duid_id", "string_id", "host_reservation_identifiers", "$@52",
   "host_reservation_identifiers_list", "host_reservation_identifier",
-  "hw_address_id", "flex_id", "relay_supplied_options", "$@49",
-  "dhcp_multi_threading", "$@50", "multi_threading_params",
+  "hw_address_id", "flex_id", "relay_supplied_options", "$@53",
+  "dhcp_multi_threading", "$@54", "multi_threading_params",
   "multi_threading_param", "enable_multi_threading", "thread_pool_size",
-  "packet_queue_size", "hooks_libraries", "$@51", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@52",
-  "sub_hooks_library", "$@53", "hooks_params", "hooks_param", "library",
-  "$@54", "parameters", "$@55", "expired_leases_processing", "$@56",
+  "packet_queue_size", "hooks_libraries", "$@55", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@56",
+  "sub_hooks_library", "$@57", "hooks_params", "hooks_param", "library",
+  "$@58", "parameters", "$@59", "expired_leases_processing", "$@60",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet6_list", "$@57",
-  "subnet6_list_content", "not_empty_subnet6_list", "subnet6", "$@58",
-  "sub_subnet6", "$@59", "subnet6_params", "subnet6_param", "subnet",
-  "$@60", "interface", "$@61", "interface_id", "$@62", "client_class",
-  "$@63", "require_client_classes", "$@64", "reservation_mode", "$@65",
-  "hr_mode", "id", "rapid_commit", "shared_networks", "$@66",
+  "unwarned_reclaim_cycles", "subnet6_list", "$@61",
+  "subnet6_list_content", "not_empty_subnet6_list", "subnet6", "$@62",
+  "sub_subnet6", "$@63", "subnet6_params", "subnet6_param", "subnet",
+  "$@64", "interface", "$@65", "interface_id", "$@66", "client_class",
+  "$@67", "require_client_classes", "$@68", "reservation_mode", "$@69",
+  "hr_mode", "id", "rapid_commit", "shared_networks", "$@70",
   "shared_networks_content", "shared_networks_list", "shared_network",
-  "$@67", "shared_network_params", "shared_network_param",
-  "option_def_list", "$@68", "sub_option_def_list", "$@69",
+  "$@71", "shared_network_params", "shared_network_param",
+  "option_def_list", "$@72", "sub_option_def_list", "$@73",
   "option_def_list_content", "not_empty_option_def_list",
-  "option_def_entry", "$@70", "sub_option_def", "$@71",
+  "option_def_entry", "$@74", "sub_option_def", "$@75",
   "option_def_params", "not_empty_option_def_params", "option_def_param",
-  "option_def_name", "code", "option_def_code", "option_def_type", "$@72",
-  "option_def_record_types", "$@73", "space", "$@74", "option_def_space",
-  "option_def_encapsulate", "$@75", "option_def_array", "option_data_list",
-  "$@76", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@77", "sub_option_data", "$@78",
+  "option_def_name", "code", "option_def_code", "option_def_type", "$@76",
+  "option_def_record_types", "$@77", "space", "$@78", "option_def_space",
+  "option_def_encapsulate", "$@79", "option_def_array", "option_data_list",
+  "$@80", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@81", "sub_option_data", "$@82",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@79",
+  "option_data_param", "option_data_name", "option_data_data", "$@83",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@80", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@81", "sub_pool6", "$@82",
-  "pool_params", "pool_param", "pool_entry", "$@83", "user_context",
-  "$@84", "comment", "$@85", "pd_pools_list", "$@86",
+  "option_data_always_send", "pools_list", "$@84", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@85", "sub_pool6", "$@86",
+  "pool_params", "pool_param", "pool_entry", "$@87", "user_context",
+  "$@88", "comment", "$@89", "pd_pools_list", "$@90",
   "pd_pools_list_content", "not_empty_pd_pools_list", "pd_pool_entry",
-  "$@87", "sub_pd_pool", "$@88", "pd_pool_params", "pd_pool_param",
-  "pd_prefix", "$@89", "pd_prefix_len", "excluded_prefix", "$@90",
-  "excluded_prefix_len", "pd_delegated_len", "reservations", "$@91",
+  "$@91", "sub_pd_pool", "$@92", "pd_pool_params", "pd_pool_param",
+  "pd_prefix", "$@93", "pd_prefix_len", "excluded_prefix", "$@94",
+  "excluded_prefix_len", "pd_delegated_len", "reservations", "$@95",
   "reservations_list", "not_empty_reservations_list", "reservation",
-  "$@92", "sub_reservation", "$@93", "reservation_params",
+  "$@96", "sub_reservation", "$@97", "reservation_params",
   "not_empty_reservation_params", "reservation_param", "ip_addresses",
-  "$@94", "prefixes", "$@95", "duid", "$@96", "hw_address", "$@97",
-  "hostname", "$@98", "flex_id_value", "$@99",
-  "reservation_client_classes", "$@100", "relay", "$@101", "relay_map",
-  "ip_address", "$@102", "client_classes", "$@103", "client_classes_list",
-  "client_class_entry", "$@104", "client_class_params",
+  "$@98", "prefixes", "$@99", "duid", "$@100", "hw_address", "$@101",
+  "hostname", "$@102", "flex_id_value", "$@103",
+  "reservation_client_classes", "$@104", "relay", "$@105", "relay_map",
+  "ip_address", "$@106", "client_classes", "$@107", "client_classes_list",
+  "client_class_entry", "$@108", "client_class_params",
   "not_empty_client_class_params", "client_class_param",
-  "client_class_name", "client_class_test", "$@105", "only_if_required",
-  "server_id", "$@106", "server_id_params", "server_id_param",
-  "server_id_type", "$@107", "duid_type", "htype", "identifier", "$@108",
-  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@109",
-  "control_socket_params", "control_socket_param", "socket_type", "$@110",
-  "socket_name", "$@111", "dhcp_queue_control", "$@112",
+  "client_class_name", "client_class_test", "$@109", "only_if_required",
+  "server_id", "$@110", "server_id_params", "server_id_param",
+  "server_id_type", "$@111", "duid_type", "htype", "identifier", "$@112",
+  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@113",
+  "control_socket_params", "control_socket_param", "socket_type", "$@114",
+  "socket_name", "$@115", "dhcp_queue_control", "$@116",
   "queue_control_params", "queue_control_param", "enable_queue",
-  "queue_type", "$@113", "capacity", "arbitrary_map_entry", "$@114",
-  "dhcp_ddns", "$@115", "sub_dhcp_ddns", "$@116", "dhcp_ddns_params",
-  "dhcp_ddns_param", "enable_updates", "qualifying_suffix", "$@117",
-  "server_ip", "$@118", "server_port", "sender_ip", "$@119", "sender_port",
-  "max_queue_size", "ncr_protocol", "$@120", "ncr_protocol_value",
-  "ncr_format", "$@121", "dep_override_no_update",
-  "dep_override_client_update", "dep_replace_client_name", "$@122",
-  "dep_generated_prefix", "$@123", "dep_hostname_char_set", "$@124",
-  "dep_hostname_char_replacement", "$@125", "dhcp4_json_object", "$@126",
-  "dhcpddns_json_object", "$@127", "control_agent_json_object", "$@128",
-  "config_control", "$@129", "sub_config_control", "$@130",
+  "queue_type", "$@117", "capacity", "arbitrary_map_entry", "$@118",
+  "dhcp_ddns", "$@119", "sub_dhcp_ddns", "$@120", "dhcp_ddns_params",
+  "dhcp_ddns_param", "enable_updates", "qualifying_suffix", "$@121",
+  "server_ip", "$@122", "server_port", "sender_ip", "$@123", "sender_port",
+  "max_queue_size", "ncr_protocol", "$@124", "ncr_protocol_value",
+  "ncr_format", "$@125", "dep_override_no_update",
+  "dep_override_client_update", "dep_replace_client_name", "$@126",
+  "dep_generated_prefix", "$@127", "dep_hostname_char_set", "$@128",
+  "dep_hostname_char_replacement", "$@129", "dhcp4_json_object", "$@130",
+  "dhcpddns_json_object", "$@131", "control_agent_json_object", "$@132",
+  "config_control", "$@133", "sub_config_control", "$@134",
   "config_control_params", "config_control_param", "config_databases",
-  "$@131", "config_fetch_wait_time", "logging_object", "$@132",
-  "sub_logging", "$@133", "logging_params", "logging_param", "loggers",
-  "$@134", "loggers_entries", "logger_entry", "$@135", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@136", "output_options_list",
-  "$@137", "output_options_list_content", "output_entry", "$@138",
-  "output_params_list", "output_params", "output", "$@139", "flush",
-  "maxsize", "maxver", "pattern", "$@140", YY_NULLPTR
+  "$@135", "config_fetch_wait_time", "logging_object", "$@136",
+  "sub_logging", "$@137", "logging_params", "logging_param", "loggers",
+  "$@138", "loggers_entries", "logger_entry", "$@139", "logger_params",
+  "logger_param", "debuglevel", "severity", "$@140", "output_options_list",
+  "$@141", "output_options_list_content", "output_entry", "$@142",
+  "output_params_list", "output_params", "output", "$@143", "flush",
+  "maxsize", "maxver", "pattern", "$@144", YY_NULLPTR
   };
 
 #if PARSER6_DEBUG
   const unsigned short int
   Dhcp6Parser::yyrline_[] =
   {
-       0,   289,   289,   289,   290,   290,   291,   291,   292,   292,
-     293,   293,   294,   294,   295,   295,   296,   296,   297,   297,
-     298,   298,   299,   299,   300,   300,   301,   301,   302,   302,
-     303,   303,   311,   312,   313,   314,   315,   316,   317,   320,
-     325,   325,   336,   339,   340,   343,   347,   354,   354,   361,
-     362,   365,   369,   376,   376,   383,   384,   387,   391,   402,
-     412,   412,   428,   429,   433,   434,   435,   436,   437,   438,
-     441,   441,   456,   456,   465,   466,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   520,   521,   522,   523,   526,
-     526,   534,   539,   544,   549,   554,   559,   564,   569,   574,
-     579,   584,   589,   594,   599,   604,   609,   609,   617,   620,
-     623,   626,   629,   635,   635,   643,   643,   651,   651,   659,
-     659,   667,   672,   677,   682,   682,   690,   690,   701,   701,
-     710,   711,   714,   715,   716,   717,   718,   721,   721,   731,
-     736,   736,   748,   748,   760,   760,   770,   771,   774,   775,
-     778,   778,   788,   789,   792,   793,   794,   795,   796,   797,
-     798,   799,   800,   801,   802,   803,   804,   805,   806,   807,
-     808,   809,   810,   811,   812,   815,   815,   822,   823,   824,
-     825,   828,   828,   836,   836,   844,   844,   852,   857,   857,
-     865,   870,   875,   880,   885,   890,   895,   900,   905,   910,
-     910,   918,   923,   923,   931,   931,   939,   939,   947,   947,
-     957,   958,   960,   962,   962,   980,   980,   990,   991,   994,
-     995,   998,  1003,  1008,  1008,  1018,  1019,  1022,  1023,  1024,
-    1027,  1032,  1039,  1039,  1051,  1051,  1063,  1064,  1067,  1068,
-    1069,  1070,  1071,  1072,  1075,  1080,  1085,  1090,  1090,  1100,
-    1101,  1104,  1105,  1108,  1108,  1118,  1118,  1128,  1129,  1130,
-    1133,  1134,  1137,  1137,  1145,  1145,  1153,  1153,  1164,  1165,
-    1168,  1169,  1170,  1171,  1172,  1173,  1176,  1181,  1186,  1191,
-    1196,  1201,  1209,  1209,  1222,  1223,  1226,  1227,  1234,  1234,
-    1260,  1260,  1271,  1272,  1276,  1277,  1278,  1279,  1280,  1281,
-    1282,  1283,  1284,  1285,  1286,  1287,  1288,  1289,  1290,  1291,
-    1292,  1293,  1294,  1295,  1296,  1297,  1298,  1299,  1300,  1301,
-    1302,  1303,  1304,  1305,  1306,  1307,  1308,  1309,  1310,  1311,
-    1314,  1314,  1322,  1322,  1330,  1330,  1338,  1338,  1346,  1346,
-    1356,  1356,  1363,  1364,  1365,  1366,  1369,  1374,  1381,  1381,
-    1392,  1393,  1397,  1398,  1401,  1401,  1409,  1410,  1413,  1414,
-    1415,  1416,  1417,  1418,  1419,  1420,  1421,  1422,  1423,  1424,
-    1425,  1426,  1427,  1428,  1429,  1430,  1431,  1432,  1433,  1434,
-    1435,  1436,  1437,  1438,  1439,  1440,  1441,  1442,  1443,  1444,
-    1445,  1452,  1452,  1465,  1465,  1474,  1475,  1478,  1479,  1484,
-    1484,  1499,  1499,  1513,  1514,  1517,  1518,  1521,  1522,  1523,
-    1524,  1525,  1526,  1527,  1528,  1529,  1530,  1533,  1535,  1540,
-    1542,  1542,  1550,  1550,  1558,  1558,  1566,  1568,  1568,  1576,
-    1585,  1585,  1597,  1598,  1603,  1604,  1609,  1609,  1621,  1621,
-    1633,  1634,  1639,  1640,  1645,  1646,  1647,  1648,  1649,  1650,
-    1651,  1652,  1653,  1656,  1658,  1658,  1666,  1668,  1670,  1675,
-    1683,  1683,  1695,  1696,  1699,  1700,  1703,  1703,  1713,  1713,
-    1723,  1724,  1727,  1728,  1729,  1730,  1731,  1732,  1733,  1736,
-    1736,  1744,  1744,  1769,  1769,  1799,  1799,  1811,  1812,  1815,
-    1816,  1819,  1819,  1831,  1831,  1843,  1844,  1847,  1848,  1849,
-    1850,  1851,  1852,  1853,  1854,  1855,  1856,  1857,  1860,  1860,
-    1868,  1873,  1873,  1881,  1886,  1894,  1894,  1904,  1905,  1908,
-    1909,  1912,  1912,  1921,  1921,  1930,  1931,  1934,  1935,  1939,
-    1940,  1941,  1942,  1943,  1944,  1945,  1946,  1947,  1948,  1949,
-    1952,  1952,  1962,  1962,  1972,  1972,  1980,  1980,  1988,  1988,
-    1996,  1996,  2004,  2004,  2017,  2017,  2027,  2028,  2031,  2031,
-    2042,  2042,  2052,  2053,  2056,  2056,  2066,  2067,  2070,  2071,
-    2074,  2075,  2076,  2077,  2078,  2079,  2080,  2083,  2085,  2085,
-    2093,  2101,  2101,  2113,  2114,  2117,  2118,  2119,  2120,  2121,
-    2122,  2123,  2124,  2125,  2128,  2128,  2135,  2136,  2137,  2140,
-    2145,  2145,  2153,  2158,  2165,  2172,  2172,  2182,  2183,  2186,
-    2187,  2188,  2189,  2190,  2193,  2193,  2201,  2201,  2212,  2212,
-    2224,  2225,  2228,  2229,  2230,  2231,  2232,  2233,  2236,  2241,
-    2241,  2249,  2254,  2254,  2263,  2263,  2275,  2275,  2285,  2286,
-    2289,  2290,  2291,  2292,  2293,  2294,  2295,  2296,  2297,  2298,
-    2299,  2300,  2301,  2302,  2303,  2304,  2305,  2306,  2309,  2314,
-    2314,  2322,  2322,  2330,  2335,  2335,  2343,  2348,  2353,  2353,
-    2361,  2362,  2365,  2365,  2374,  2380,  2386,  2386,  2394,  2394,
-    2403,  2403,  2412,  2412,  2423,  2423,  2430,  2430,  2437,  2437,
-    2446,  2446,  2457,  2457,  2467,  2468,  2472,  2473,  2476,  2476,
-    2486,  2496,  2496,  2506,  2506,  2517,  2518,  2522,  2526,  2526,
-    2538,  2539,  2543,  2543,  2551,  2552,  2555,  2556,  2557,  2558,
-    2559,  2560,  2561,  2564,  2569,  2569,  2577,  2577,  2587,  2588,
-    2591,  2591,  2599,  2600,  2603,  2604,  2605,  2606,  2607,  2610,
-    2610,  2618,  2623,  2628,  2633,  2633
+       0,   296,   296,   296,   297,   297,   298,   298,   299,   299,
+     300,   300,   301,   301,   302,   302,   303,   303,   304,   304,
+     305,   305,   306,   306,   307,   307,   308,   308,   309,   309,
+     310,   310,   318,   319,   320,   321,   322,   323,   324,   327,
+     332,   332,   343,   346,   347,   350,   354,   361,   361,   368,
+     369,   372,   376,   383,   383,   390,   391,   394,   398,   409,
+     419,   419,   435,   436,   440,   441,   442,   443,   444,   445,
+     448,   448,   463,   463,   472,   473,   478,   479,   480,   481,
+     482,   483,   484,   485,   486,   487,   488,   489,   490,   491,
+     492,   493,   494,   495,   496,   497,   498,   499,   500,   501,
+     502,   503,   504,   505,   506,   507,   508,   509,   510,   511,
+     512,   513,   514,   515,   516,   517,   518,   519,   520,   521,
+     522,   523,   524,   525,   526,   527,   528,   529,   530,   531,
+     532,   533,   536,   536,   544,   549,   554,   559,   564,   569,
+     574,   579,   584,   589,   594,   599,   604,   609,   614,   619,
+     619,   627,   630,   633,   636,   639,   645,   645,   653,   653,
+     661,   661,   669,   669,   677,   682,   682,   690,   695,   700,
+     705,   710,   710,   718,   718,   729,   729,   738,   739,   742,
+     743,   744,   745,   746,   749,   749,   759,   764,   764,   776,
+     776,   788,   788,   798,   799,   802,   803,   806,   806,   816,
+     817,   820,   821,   822,   823,   824,   825,   826,   827,   828,
+     829,   830,   831,   832,   833,   834,   835,   836,   837,   838,
+     839,   840,   841,   842,   843,   844,   847,   847,   854,   855,
+     856,   857,   860,   860,   868,   868,   876,   876,   884,   889,
+     889,   897,   902,   907,   912,   917,   922,   927,   927,   935,
+     935,   943,   943,   951,   956,   961,   966,   971,   971,   979,
+     984,   984,   992,   992,  1000,  1000,  1008,  1008,  1018,  1019,
+    1021,  1023,  1023,  1041,  1041,  1051,  1052,  1055,  1056,  1059,
+    1064,  1069,  1069,  1079,  1080,  1083,  1084,  1085,  1088,  1093,
+    1100,  1100,  1112,  1112,  1124,  1125,  1128,  1129,  1130,  1131,
+    1132,  1133,  1136,  1141,  1146,  1151,  1151,  1161,  1162,  1165,
+    1166,  1169,  1169,  1179,  1179,  1189,  1190,  1191,  1194,  1195,
+    1198,  1198,  1206,  1206,  1214,  1214,  1225,  1226,  1229,  1230,
+    1231,  1232,  1233,  1234,  1237,  1242,  1247,  1252,  1257,  1262,
+    1270,  1270,  1283,  1284,  1287,  1288,  1295,  1295,  1321,  1321,
+    1332,  1333,  1337,  1338,  1339,  1340,  1341,  1342,  1343,  1344,
+    1345,  1346,  1347,  1348,  1349,  1350,  1351,  1352,  1353,  1354,
+    1355,  1356,  1357,  1358,  1359,  1360,  1361,  1362,  1363,  1364,
+    1365,  1366,  1367,  1368,  1369,  1370,  1371,  1372,  1373,  1376,
+    1376,  1384,  1384,  1392,  1392,  1400,  1400,  1408,  1408,  1418,
+    1418,  1425,  1426,  1427,  1428,  1431,  1436,  1443,  1443,  1454,
+    1455,  1459,  1460,  1463,  1463,  1471,  1472,  1475,  1476,  1477,
+    1478,  1479,  1480,  1481,  1482,  1483,  1484,  1485,  1486,  1487,
+    1488,  1489,  1490,  1491,  1492,  1493,  1494,  1495,  1496,  1497,
+    1498,  1499,  1500,  1501,  1502,  1503,  1504,  1505,  1506,  1507,
+    1508,  1515,  1515,  1528,  1528,  1537,  1538,  1541,  1542,  1547,
+    1547,  1562,  1562,  1576,  1577,  1580,  1581,  1584,  1585,  1586,
+    1587,  1588,  1589,  1590,  1591,  1592,  1593,  1596,  1598,  1603,
+    1605,  1605,  1613,  1613,  1621,  1621,  1629,  1631,  1631,  1639,
+    1648,  1648,  1660,  1661,  1666,  1667,  1672,  1672,  1684,  1684,
+    1696,  1697,  1702,  1703,  1708,  1709,  1710,  1711,  1712,  1713,
+    1714,  1715,  1716,  1719,  1721,  1721,  1729,  1731,  1733,  1738,
+    1746,  1746,  1758,  1759,  1762,  1763,  1766,  1766,  1776,  1776,
+    1786,  1787,  1790,  1791,  1792,  1793,  1794,  1795,  1796,  1799,
+    1799,  1807,  1807,  1832,  1832,  1862,  1862,  1874,  1875,  1878,
+    1879,  1882,  1882,  1894,  1894,  1906,  1907,  1910,  1911,  1912,
+    1913,  1914,  1915,  1916,  1917,  1918,  1919,  1920,  1923,  1923,
+    1931,  1936,  1936,  1944,  1949,  1957,  1957,  1967,  1968,  1971,
+    1972,  1975,  1975,  1984,  1984,  1993,  1994,  1997,  1998,  2002,
+    2003,  2004,  2005,  2006,  2007,  2008,  2009,  2010,  2011,  2012,
+    2015,  2015,  2025,  2025,  2035,  2035,  2043,  2043,  2051,  2051,
+    2059,  2059,  2067,  2067,  2080,  2080,  2090,  2091,  2094,  2094,
+    2105,  2105,  2115,  2116,  2119,  2119,  2129,  2130,  2133,  2134,
+    2137,  2138,  2139,  2140,  2141,  2142,  2143,  2146,  2148,  2148,
+    2156,  2164,  2164,  2176,  2177,  2180,  2181,  2182,  2183,  2184,
+    2185,  2186,  2187,  2188,  2191,  2191,  2198,  2199,  2200,  2203,
+    2208,  2208,  2216,  2221,  2228,  2235,  2235,  2245,  2246,  2249,
+    2250,  2251,  2252,  2253,  2256,  2256,  2264,  2264,  2275,  2275,
+    2287,  2288,  2291,  2292,  2293,  2294,  2295,  2296,  2299,  2304,
+    2304,  2312,  2317,  2317,  2326,  2326,  2338,  2338,  2348,  2349,
+    2352,  2353,  2354,  2355,  2356,  2357,  2358,  2359,  2360,  2361,
+    2362,  2363,  2364,  2365,  2366,  2367,  2368,  2369,  2372,  2377,
+    2377,  2385,  2385,  2393,  2398,  2398,  2406,  2411,  2416,  2416,
+    2424,  2425,  2428,  2428,  2437,  2443,  2449,  2449,  2457,  2457,
+    2466,  2466,  2475,  2475,  2486,  2486,  2493,  2493,  2500,  2500,
+    2509,  2509,  2520,  2520,  2530,  2531,  2535,  2536,  2539,  2539,
+    2549,  2559,  2559,  2569,  2569,  2580,  2581,  2585,  2589,  2589,
+    2601,  2602,  2606,  2606,  2614,  2615,  2618,  2619,  2620,  2621,
+    2622,  2623,  2624,  2627,  2632,  2632,  2640,  2640,  2650,  2651,
+    2654,  2654,  2662,  2663,  2666,  2667,  2668,  2669,  2670,  2673,
+    2673,  2681,  2686,  2691,  2696,  2696
   };
 
   // Print the state stack on the debug stream.
@@ -5550,7 +5676,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy" // lalr1.cc:1167
 } } // isc::dhcp
-#line 5554 "dhcp6_parser.cc" // lalr1.cc:1167
+#line 5680 "dhcp6_parser.cc" // lalr1.cc:1167
 #line 2641 "dhcp6_parser.yy" // lalr1.cc:1168
 
 
@@ -388,165 +388,172 @@ namespace isc { namespace dhcp {
         TOKEN_TCP_KEEPALIVE = 296,
         TOKEN_TCP_NODELAY = 297,
         TOKEN_MAX_ROW_ERRORS = 298,
-        TOKEN_PREFERRED_LIFETIME = 299,
-        TOKEN_MIN_PREFERRED_LIFETIME = 300,
-        TOKEN_MAX_PREFERRED_LIFETIME = 301,
-        TOKEN_VALID_LIFETIME = 302,
-        TOKEN_MIN_VALID_LIFETIME = 303,
-        TOKEN_MAX_VALID_LIFETIME = 304,
-        TOKEN_RENEW_TIMER = 305,
-        TOKEN_REBIND_TIMER = 306,
-        TOKEN_CALCULATE_TEE_TIMES = 307,
-        TOKEN_T1_PERCENT = 308,
-        TOKEN_T2_PERCENT = 309,
-        TOKEN_DECLINE_PROBATION_PERIOD = 310,
-        TOKEN_SERVER_TAG = 311,
-        TOKEN_STATISTIC_DEFAULT_SAMPLE_COUNT = 312,
-        TOKEN_STATISTIC_DEFAULT_SAMPLE_AGE = 313,
-        TOKEN_DDNS_SEND_UPDATES = 314,
-        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 315,
-        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 316,
-        TOKEN_DDNS_REPLACE_CLIENT_NAME = 317,
-        TOKEN_DDNS_GENERATED_PREFIX = 318,
-        TOKEN_DDNS_QUALIFYING_SUFFIX = 319,
-        TOKEN_STORE_EXTENDED_INFO = 320,
-        TOKEN_SUBNET6 = 321,
-        TOKEN_OPTION_DEF = 322,
-        TOKEN_OPTION_DATA = 323,
-        TOKEN_NAME = 324,
-        TOKEN_DATA = 325,
-        TOKEN_CODE = 326,
-        TOKEN_SPACE = 327,
-        TOKEN_CSV_FORMAT = 328,
-        TOKEN_ALWAYS_SEND = 329,
-        TOKEN_RECORD_TYPES = 330,
-        TOKEN_ENCAPSULATE = 331,
-        TOKEN_ARRAY = 332,
-        TOKEN_POOLS = 333,
-        TOKEN_POOL = 334,
-        TOKEN_PD_POOLS = 335,
-        TOKEN_PREFIX = 336,
-        TOKEN_PREFIX_LEN = 337,
-        TOKEN_EXCLUDED_PREFIX = 338,
-        TOKEN_EXCLUDED_PREFIX_LEN = 339,
-        TOKEN_DELEGATED_LEN = 340,
-        TOKEN_USER_CONTEXT = 341,
-        TOKEN_COMMENT = 342,
-        TOKEN_SUBNET = 343,
-        TOKEN_INTERFACE = 344,
-        TOKEN_INTERFACE_ID = 345,
-        TOKEN_ID = 346,
-        TOKEN_RAPID_COMMIT = 347,
-        TOKEN_RESERVATION_MODE = 348,
-        TOKEN_DISABLED = 349,
-        TOKEN_OUT_OF_POOL = 350,
-        TOKEN_GLOBAL = 351,
-        TOKEN_ALL = 352,
-        TOKEN_SHARED_NETWORKS = 353,
-        TOKEN_MAC_SOURCES = 354,
-        TOKEN_RELAY_SUPPLIED_OPTIONS = 355,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 356,
-        TOKEN_SANITY_CHECKS = 357,
-        TOKEN_LEASE_CHECKS = 358,
-        TOKEN_CLIENT_CLASSES = 359,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 360,
-        TOKEN_TEST = 361,
-        TOKEN_ONLY_IF_REQUIRED = 362,
-        TOKEN_CLIENT_CLASS = 363,
-        TOKEN_RESERVATIONS = 364,
-        TOKEN_IP_ADDRESSES = 365,
-        TOKEN_PREFIXES = 366,
-        TOKEN_DUID = 367,
-        TOKEN_HW_ADDRESS = 368,
-        TOKEN_HOSTNAME = 369,
-        TOKEN_FLEX_ID = 370,
-        TOKEN_RELAY = 371,
-        TOKEN_IP_ADDRESS = 372,
-        TOKEN_HOOKS_LIBRARIES = 373,
-        TOKEN_LIBRARY = 374,
-        TOKEN_PARAMETERS = 375,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 376,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 377,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 378,
-        TOKEN_HOLD_RECLAIMED_TIME = 379,
-        TOKEN_MAX_RECLAIM_LEASES = 380,
-        TOKEN_MAX_RECLAIM_TIME = 381,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 382,
-        TOKEN_SERVER_ID = 383,
-        TOKEN_LLT = 384,
-        TOKEN_EN = 385,
-        TOKEN_LL = 386,
-        TOKEN_IDENTIFIER = 387,
-        TOKEN_HTYPE = 388,
-        TOKEN_TIME = 389,
-        TOKEN_ENTERPRISE_ID = 390,
-        TOKEN_DHCP4O6_PORT = 391,
-        TOKEN_DHCP_MULTI_THREADING = 392,
-        TOKEN_ENABLE_MULTI_THREADING = 393,
-        TOKEN_THREAD_POOL_SIZE = 394,
-        TOKEN_PACKET_QUEUE_SIZE = 395,
-        TOKEN_CONTROL_SOCKET = 396,
-        TOKEN_SOCKET_TYPE = 397,
-        TOKEN_SOCKET_NAME = 398,
-        TOKEN_DHCP_QUEUE_CONTROL = 399,
-        TOKEN_ENABLE_QUEUE = 400,
-        TOKEN_QUEUE_TYPE = 401,
-        TOKEN_CAPACITY = 402,
-        TOKEN_DHCP_DDNS = 403,
-        TOKEN_ENABLE_UPDATES = 404,
-        TOKEN_QUALIFYING_SUFFIX = 405,
-        TOKEN_SERVER_IP = 406,
-        TOKEN_SERVER_PORT = 407,
-        TOKEN_SENDER_IP = 408,
-        TOKEN_SENDER_PORT = 409,
-        TOKEN_MAX_QUEUE_SIZE = 410,
-        TOKEN_NCR_PROTOCOL = 411,
-        TOKEN_NCR_FORMAT = 412,
-        TOKEN_OVERRIDE_NO_UPDATE = 413,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 414,
-        TOKEN_REPLACE_CLIENT_NAME = 415,
-        TOKEN_GENERATED_PREFIX = 416,
-        TOKEN_UDP = 417,
-        TOKEN_TCP = 418,
-        TOKEN_JSON = 419,
-        TOKEN_WHEN_PRESENT = 420,
-        TOKEN_NEVER = 421,
-        TOKEN_ALWAYS = 422,
-        TOKEN_WHEN_NOT_PRESENT = 423,
-        TOKEN_HOSTNAME_CHAR_SET = 424,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 425,
-        TOKEN_LOGGING = 426,
-        TOKEN_LOGGERS = 427,
-        TOKEN_OUTPUT_OPTIONS = 428,
-        TOKEN_OUTPUT = 429,
-        TOKEN_DEBUGLEVEL = 430,
-        TOKEN_SEVERITY = 431,
-        TOKEN_FLUSH = 432,
-        TOKEN_MAXSIZE = 433,
-        TOKEN_MAXVER = 434,
-        TOKEN_PATTERN = 435,
-        TOKEN_DHCP4 = 436,
-        TOKEN_DHCPDDNS = 437,
-        TOKEN_CONTROL_AGENT = 438,
-        TOKEN_TOPLEVEL_JSON = 439,
-        TOKEN_TOPLEVEL_DHCP6 = 440,
-        TOKEN_SUB_DHCP6 = 441,
-        TOKEN_SUB_INTERFACES6 = 442,
-        TOKEN_SUB_SUBNET6 = 443,
-        TOKEN_SUB_POOL6 = 444,
-        TOKEN_SUB_PD_POOL = 445,
-        TOKEN_SUB_RESERVATION = 446,
-        TOKEN_SUB_OPTION_DEFS = 447,
-        TOKEN_SUB_OPTION_DEF = 448,
-        TOKEN_SUB_OPTION_DATA = 449,
-        TOKEN_SUB_HOOKS_LIBRARY = 450,
-        TOKEN_SUB_DHCP_DDNS = 451,
-        TOKEN_SUB_LOGGING = 452,
-        TOKEN_SUB_CONFIG_CONTROL = 453,
-        TOKEN_STRING = 454,
-        TOKEN_INTEGER = 455,
-        TOKEN_FLOAT = 456,
-        TOKEN_BOOLEAN = 457
+        TOKEN_DURABILITY = 299,
+        TOKEN_LFC_FORMAT = 300,
+        TOKEN_LFC_MODE = 301,
+        TOKEN_LFC_WRITE_RATE = 302,
+        TOKEN_PREFERRED_LIFETIME = 303,
+        TOKEN_MIN_PREFERRED_LIFETIME = 304,
+        TOKEN_MAX_PREFERRED_LIFETIME = 305,
+        TOKEN_VALID_LIFETIME = 306,
+        TOKEN_MIN_VALID_LIFETIME = 307,
+        TOKEN_MAX_VALID_LIFETIME = 308,
+        TOKEN_RENEW_TIMER = 309,
+        TOKEN_REBIND_TIMER = 310,
+        TOKEN_CALCULATE_TEE_TIMES = 311,
+        TOKEN_T1_PERCENT = 312,
+        TOKEN_T2_PERCENT = 313,
+        TOKEN_DECLINE_PROBATION_PERIOD = 314,
+        TOKEN_SERVER_TAG = 315,
+        TOKEN_STATISTIC_DEFAULT_SAMPLE_COUNT = 316,
+        TOKEN_STATISTIC_DEFAULT_SAMPLE_AGE = 317,
+        TOKEN_DDNS_SEND_UPDATES = 318,
+        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 319,
+        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 320,
+        TOKEN_DDNS_REPLACE_CLIENT_NAME = 321,
+        TOKEN_DDNS_GENERATED_PREFIX = 322,
+        TOKEN_DDNS_QUALIFYING_SUFFIX = 323,
+        TOKEN_STORE_EXTENDED_INFO = 324,
+        TOKEN_ALLOCATOR = 325,
+        TOKEN_FREE_LEASE_INDEX = 326,
+        TOKEN_OPTION_ARENA = 327,
+        TOKEN_SUBNET6 = 328,
+        TOKEN_OPTION_DEF = 329,
+        TOKEN_OPTION_DATA = 330,
+        TOKEN_NAME = 331,
+        TOKEN_DATA = 332,
+        TOKEN_CODE = 333,
+        TOKEN_SPACE = 334,
+        TOKEN_CSV_FORMAT = 335,
+        TOKEN_ALWAYS_SEND = 336,
+        TOKEN_RECORD_TYPES = 337,
+        TOKEN_ENCAPSULATE = 338,
+        TOKEN_ARRAY = 339,
+        TOKEN_POOLS = 340,
+        TOKEN_POOL = 341,
+        TOKEN_PD_POOLS = 342,
+        TOKEN_PREFIX = 343,
+        TOKEN_PREFIX_LEN = 344,
+        TOKEN_EXCLUDED_PREFIX = 345,
+        TOKEN_EXCLUDED_PREFIX_LEN = 346,
+        TOKEN_DELEGATED_LEN = 347,
+        TOKEN_USER_CONTEXT = 348,
+        TOKEN_COMMENT = 349,
+        TOKEN_SUBNET = 350,
+        TOKEN_INTERFACE = 351,
+        TOKEN_INTERFACE_ID = 352,
+        TOKEN_ID = 353,
+        TOKEN_RAPID_COMMIT = 354,
+        TOKEN_RESERVATION_MODE = 355,
+        TOKEN_DISABLED = 356,
+        TOKEN_OUT_OF_POOL = 357,
+        TOKEN_GLOBAL = 358,
+        TOKEN_ALL = 359,
+        TOKEN_SHARED_NETWORKS = 360,
+        TOKEN_MAC_SOURCES = 361,
+        TOKEN_RELAY_SUPPLIED_OPTIONS = 362,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 363,
+        TOKEN_SANITY_CHECKS = 364,
+        TOKEN_LEASE_CHECKS = 365,
+        TOKEN_CLIENT_CLASSES = 366,
+        TOKEN_REQUIRE_CLIENT_CLASSES = 367,
+        TOKEN_TEST = 368,
+        TOKEN_ONLY_IF_REQUIRED = 369,
+        TOKEN_CLIENT_CLASS = 370,
+        TOKEN_RESERVATIONS = 371,
+        TOKEN_IP_ADDRESSES = 372,
+        TOKEN_PREFIXES = 373,
+        TOKEN_DUID = 374,
+        TOKEN_HW_ADDRESS = 375,
+        TOKEN_HOSTNAME = 376,
+        TOKEN_FLEX_ID = 377,
+        TOKEN_RELAY = 378,
+        TOKEN_IP_ADDRESS = 379,
+        TOKEN_HOOKS_LIBRARIES = 380,
+        TOKEN_LIBRARY = 381,
+        TOKEN_PARAMETERS = 382,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 383,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 384,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 385,
+        TOKEN_HOLD_RECLAIMED_TIME = 386,
+        TOKEN_MAX_RECLAIM_LEASES = 387,
+        TOKEN_MAX_RECLAIM_TIME = 388,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 389,
+        TOKEN_SERVER_ID = 390,
+        TOKEN_LLT = 391,
+        TOKEN_EN = 392,
+        TOKEN_LL = 393,
+        TOKEN_IDENTIFIER = 394,
+        TOKEN_HTYPE = 395,
+        TOKEN_TIME = 396,
+        TOKEN_ENTERPRISE_ID = 397,
+        TOKEN_DHCP4O6_PORT = 398,
+        TOKEN_DHCP_MULTI_THREADING = 399,
+        TOKEN_ENABLE_MULTI_THREADING = 400,
+        TOKEN_THREAD_POOL_SIZE = 401,
+        TOKEN_PACKET_QUEUE_SIZE = 402,
+        TOKEN_CONTROL_SOCKET = 403,
+        TOKEN_SOCKET_TYPE = 404,
+        TOKEN_SOCKET_NAME = 405,
+        TOKEN_DHCP_QUEUE_CONTROL = 406,
+        TOKEN_ENABLE_QUEUE = 407,
+        TOKEN_QUEUE_TYPE = 408,
+        TOKEN_CAPACITY = 409,
+        TOKEN_DHCP_DDNS = 410,
+        TOKEN_ENABLE_UPDATES = 411,
+        TOKEN_QUALIFYING_SUFFIX = 412,
+        TOKEN_SERVER_IP = 413,
+        TOKEN_SERVER_PORT = 414,
+        TOKEN_SENDER_IP = 415,
+        TOKEN_SENDER_PORT = 416,
+        TOKEN_MAX_QUEUE_SIZE = 417,
+        TOKEN_NCR_PROTOCOL = 418,
+        TOKEN_NCR_FORMAT = 419,
+        TOKEN_OVERRIDE_NO_UPDATE = 420,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 421,
+        TOKEN_REPLACE_CLIENT_NAME = 422,
+        TOKEN_GENERATED_PREFIX = 423,
+        TOKEN_UDP = 424,
+        TOKEN_TCP = 425,
+        TOKEN_JSON = 426,
+        TOKEN_WHEN_PRESENT = 427,
+        TOKEN_NEVER = 428,
+        TOKEN_ALWAYS = 429,
+        TOKEN_WHEN_NOT_PRESENT = 430,
+        TOKEN_HOSTNAME_CHAR_SET = 431,
+        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 432,
+        TOKEN_LOGGING = 433,
+        TOKEN_LOGGERS = 434,
+        TOKEN_OUTPUT_OPTIONS = 435,
+        TOKEN_OUTPUT = 436,
+        TOKEN_DEBUGLEVEL = 437,
+        TOKEN_SEVERITY = 438,
+        TOKEN_FLUSH = 439,
+        TOKEN_MAXSIZE = 440,
+        TOKEN_MAXVER = 441,
+        TOKEN_PATTERN = 442,
+        TOKEN_DHCP4 = 443,
+        TOKEN_DHCPDDNS = 444,
+        TOKEN_CONTROL_AGENT = 445,
+        TOKEN_TOPLEVEL_JSON = 446,
+        TOKEN_TOPLEVEL_DHCP6 = 447,
+        TOKEN_SUB_DHCP6 = 448,
+        TOKEN_SUB_INTERFACES6 = 449,
+        TOKEN_SUB_SUBNET6 = 450,
+        TOKEN_SUB_POOL6 = 451,
+        TOKEN_SUB_PD_POOL = 452,
+        TOKEN_SUB_RESERVATION = 453,
+        TOKEN_SUB_OPTION_DEFS = 454,
+        TOKEN_SUB_OPTION_DEF = 455,
+        TOKEN_SUB_OPTION_DATA = 456,
+        TOKEN_SUB_HOOKS_LIBRARY = 457,
+        TOKEN_SUB_DHCP_DDNS = 458,
+        TOKEN_SUB_LOGGING = 459,
+        TOKEN_SUB_CONFIG_CONTROL = 460,
+        TOKEN_STRING = 461,
+        TOKEN_INTEGER = 462,
+        TOKEN_FLOAT = 463,
+        TOKEN_BOOLEAN = 464
       };
     };
 
@@ -829,6 +836,22 @@ namespace isc { namespace dhcp {
     symbol_type
     make_MAX_ROW_ERRORS (const location_type& l);
 
+    static inline
+    symbol_type
+    make_DURABILITY (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_FORMAT (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_MODE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_WRITE_RATE (const location_type& l);
+
     static inline
     symbol_type
     make_PREFERRED_LIFETIME (const location_type& l);
@@ -917,6 +940,18 @@ namespace isc { namespace dhcp {
     symbol_type
     make_STORE_EXTENDED_INFO (const location_type& l);
 
+    static inline
+    symbol_type
+    make_ALLOCATOR (const location_type& l);
+
+    static inline
+    symbol_type
+    make_FREE_LEASE_INDEX (const location_type& l);
+
+    static inline
+    symbol_type
+    make_OPTION_ARENA (const location_type& l);
+
     static inline
     symbol_type
     make_SUBNET6 (const location_type& l);
@@ -1670,12 +1705,12 @@ namespace isc { namespace dhcp {
     enum
     {
       yyeof_ = 0,
-      yylast_ = 1254,     ///< Last index in yytable_.
-      yynnts_ = 437,  ///< Number of nonterminal symbols.
+      yylast_ = 1288,     ///< Last index in yytable_.
+      yynnts_ = 448,  ///< Number of nonterminal symbols.
       yyfinal_ = 32, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 203  ///< Number of tokens.
+      yyntokens_ = 210  ///< Number of tokens.
     };
 
 
@@ -1737,9 +1772,10 @@ namespace isc { namespace dhcp {
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
      185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
-     195,   196,   197,   198,   199,   200,   201,   202
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209
     };
-    const unsigned int user_token_number_max_ = 457;
+    const unsigned int user_token_number_max_ = 464;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1772,29 +1808,29 @@ namespace isc { namespace dhcp {
   {
       switch (other.type_get ())
     {
-      case 220: // value
-      case 224: // map_value
-      case 265: // ddns_replace_client_name_value
-      case 302: // db_type
-      case 403: // hr_mode
-      case 539: // duid_type
-      case 582: // ncr_protocol_value
+      case 227: // value
+      case 231: // map_value
+      case 272: // ddns_replace_client_name_value
+      case 313: // db_type
+      case 421: // hr_mode
+      case 557: // duid_type
+      case 600: // ncr_protocol_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 202: // "boolean"
+      case 209: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 201: // "floating point"
+      case 208: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 200: // "integer"
+      case 207: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 199: // "constant string"
+      case 206: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1815,29 +1851,29 @@ namespace isc { namespace dhcp {
     (void) v;
       switch (this->type_get ())
     {
-      case 220: // value
-      case 224: // map_value
-      case 265: // ddns_replace_client_name_value
-      case 302: // db_type
-      case 403: // hr_mode
-      case 539: // duid_type
-      case 582: // ncr_protocol_value
+      case 227: // value
+      case 231: // map_value
+      case 272: // ddns_replace_client_name_value
+      case 313: // db_type
+      case 421: // hr_mode
+      case 557: // duid_type
+      case 600: // ncr_protocol_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 202: // "boolean"
+      case 209: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 201: // "floating point"
+      case 208: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 200: // "integer"
+      case 207: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 199: // "constant string"
+      case 206: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1917,29 +1953,29 @@ namespace isc { namespace dhcp {
     // Type destructor.
     switch (yytype)
     {
-      case 220: // value
-      case 224: // map_value
-      case 265: // ddns_replace_client_name_value
-      case 302: // db_type
-      case 403: // hr_mode
-      case 539: // duid_type
-      case 582: // ncr_protocol_value
+      case 227: // value
+      case 231: // map_value
+      case 272: // ddns_replace_client_name_value
+      case 313: // db_type
+      case 421: // hr_mode
+      case 557: // duid_type
+      case 600: // ncr_protocol_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 202: // "boolean"
+      case 209: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 201: // "floating point"
+      case 208: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 200: // "integer"
+      case 207: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 199: // "constant string"
+      case 206: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1966,29 +2002,29 @@ namespace isc { namespace dhcp {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 220: // value
-      case 224: // map_value
-      case 265: // ddns_replace_client_name_value
-      case 302: // db_type
-      case 403: // hr_mode
-      case 539: // duid_type
-      case 582: // ncr_protocol_value
+      case 227: // value
+      case 231: // map_value
+      case 272: // ddns_replace_client_name_value
+      case 313: // db_type
+      case 421: // hr_mode
+      case 557: // duid_type
+      case 600: // ncr_protocol_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 202: // "boolean"
+      case 209: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 201: // "floating point"
+      case 208: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 200: // "integer"
+      case 207: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 199: // "constant string"
+      case 206: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -2067,7 +2103,7 @@ namespace isc { namespace dhcp {
      425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
      435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
      445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457
+     455,   456,   457,   458,   459,   460,   461,   462,   463,   464
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -2324,6 +2360,30 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_MAX_ROW_ERRORS, l);
   }
 
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_DURABILITY (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_DURABILITY, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_LFC_FORMAT (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_FORMAT, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_LFC_MODE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_MODE, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_LFC_WRITE_RATE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_WRITE_RATE, l);
+  }
+
   Dhcp6Parser::symbol_type
   Dhcp6Parser::make_PREFERRED_LIFETIME (const location_type& l)
   {
@@ -2456,6 +2516,24 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_STORE_EXTENDED_INFO, l);
   }
 
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_ALLOCATOR (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_ALLOCATOR, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_FREE_LEASE_INDEX (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_FREE_LEASE_INDEX, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_OPTION_ARENA (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_OPTION_ARENA, l);
+  }
+
   Dhcp6Parser::symbol_type
   Dhcp6Parser::make_SUBNET6 (const location_type& l)
   {
@@ -3281,7 +3359,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy" // lalr1.cc:377
 } } // isc::dhcp
-#line 3285 "dhcp6_parser.h" // lalr1.cc:377
+#line 3363 "dhcp6_parser.h" // lalr1.cc:377
 
 
 
@@ -86,6 +86,10 @@ using namespace std;
   TCP_KEEPALIVE "tcp-keepalive"
   TCP_NODELAY "tcp-nodelay"
   MAX_ROW_ERRORS "max-row-errors"
+  DURABILITY "durability"
+  LFC_FORMAT "lfc-format"
+  LFC_MODE "lfc-mode"
+  LFC_WRITE_RATE "lfc-write-rate"
 
   PREFERRED_LIFETIME "preferred-lifetime"
   MIN_PREFERRED_LIFETIME "min-preferred-lifetime"
@@ -109,6 +113,9 @@ using namespace std;
   DDNS_GENERATED_PREFIX "ddns-generated-prefix"
   DDNS_QUALIFYING_SUFFIX "ddns-qualifying-suffix"
   STORE_EXTENDED_INFO "store-extended-info"
+  ALLOCATOR "allocator"
+  FREE_LEASE_INDEX "free-lease-index"
+  OPTION_ARENA "option-arena"
   SUBNET6 "subnet6"
   OPTION_DEF "option-def"
   OPTION_DATA "option-data"
@@ -517,6 +524,9 @@ global_param: data_directory
             | ddns_generated_prefix
             | ddns_qualifying_suffix
             | store_extended_info
+            | allocator
+            | free_lease_index
+            | option_arena
             | statistic_default_sample_count
             | statistic_default_sample_age
             | dhcp_multi_threading
@@ -669,6 +679,24 @@ store_extended_info: STORE_EXTENDED_INFO COLON BOOLEAN {
     ctx.stack_.back()->set("store-extended-info", b);
 };
 
+allocator: ALLOCATOR {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr a(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("allocator", a);
+    ctx.leave();
+};
+
+free_lease_index: FREE_LEASE_INDEX COLON BOOLEAN {
+    ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("free-lease-index", b);
+};
+
+option_arena: OPTION_ARENA COLON BOOLEAN {
+    ElementPtr b(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("option-arena", b);
+};
+
 statistic_default_sample_count: STATISTIC_DEFAULT_SAMPLE_COUNT COLON INTEGER {
     ElementPtr count(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("statistic-default-sample-count", count);
@@ -809,6 +837,10 @@ database_map_param: database_type
                   | consistency
                   | serial_consistency
                   | max_row_errors
+                  | durability
+                  | lfc_format
+                  | lfc_mode
+                  | lfc_write_rate
                   | unknown_map_entry
                   ;
 
@@ -892,6 +924,35 @@ max_row_errors: MAX_ROW_ERRORS COLON INTEGER {
     ctx.stack_.back()->set("max-row-errors", n);
 };
 
+durability: DURABILITY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr d(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("durability", d);
+    ctx.leave();
+};
+
+lfc_format: LFC_FORMAT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr f(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("lfc-format", f);
+    ctx.leave();
+};
+
+lfc_mode: LFC_MODE {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr m(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("lfc-mode", m);
+    ctx.leave();
+};
+
+lfc_write_rate: LFC_WRITE_RATE COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-write-rate", n);
+};
+
 request_timeout: REQUEST_TIMEOUT COLON INTEGER {
     ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("request-timeout", n);
@@ -1308,6 +1369,7 @@ subnet6_param: preferred_lifetime
              | ddns_generated_prefix
              | ddns_qualifying_suffix
              | store_extended_info
+             | allocator
              | unknown_map_entry
              ;
 
@@ -1442,6 +1504,7 @@ shared_network_param: name
                     | ddns_generated_prefix
                     | ddns_qualifying_suffix
                     | store_extended_info
+                    | allocator
                     | unknown_map_entry
                     ;
 
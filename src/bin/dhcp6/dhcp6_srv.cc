@@ -28,6 +28,7 @@
 #include <dhcp/option_vendor_class.h>
 #include <dhcp/option_int_array.h>
 #include <dhcp/pkt6.h>
+#include <dhcp6/client_handler.h>
 #include <dhcp6/dhcp6to4_ipc.h>
 #include <dhcp6/dhcp6_log.h>
 #include <dhcp6/dhcp6_srv.h>
@@ -125,6 +126,60 @@ struct Dhcp6Hooks {
 // module is called.
 Dhcp6Hooks Hooks;
 
+/// Structure that holds the counters of the statistics bumped for each
+/// received or sent packet, so these statistics are not looked up by name
+/// nor locked in the packet processing path.
+struct Dhcp6Counters {
+    StatsCounterPtr received_;                 ///< "pkt6-received"
+    StatsCounterPtr solicit_received_;         ///< "pkt6-solicit-received"
+    StatsCounterPtr advertise_received_;       ///< "pkt6-advertise-received"
+    StatsCounterPtr request_received_;         ///< "pkt6-request-received"
+    StatsCounterPtr confirm_received_;         ///< "pkt6-confirm-received"
+    StatsCounterPtr renew_received_;           ///< "pkt6-renew-received"
+    StatsCounterPtr rebind_received_;          ///< "pkt6-rebind-received"
+    StatsCounterPtr reply_received_;           ///< "pkt6-reply-received"
+    StatsCounterPtr release_received_;         ///< "pkt6-release-received"
+    StatsCounterPtr decline_received_;         ///< "pkt6-decline-received"
+    StatsCounterPtr reconfigure_received_;     ///< "pkt6-reconfigure-received"
+    StatsCounterPtr infrequest_received_;      ///< "pkt6-infrequest-received"
+    StatsCounterPtr dhcpv4_query_received_;    ///< "pkt6-dhcpv4-query-received"
+    StatsCounterPtr dhcpv4_response_received_; ///< "pkt6-dhcpv4-response-received"
+    StatsCounterPtr unknown_received_;         ///< "pkt6-unknown-received"
+    StatsCounterPtr sent_;                     ///< "pkt6-sent"
+    StatsCounterPtr advertise_sent_;           ///< "pkt6-advertise-sent"
+    StatsCounterPtr reply_sent_;               ///< "pkt6-reply-sent"
+    StatsCounterPtr dhcpv4_response_sent_;     ///< "pkt6-dhcpv4-response-sent"
+    StatsCounterPtr receive_drop_;             ///< "pkt6-receive-drop"
+
+    /// Constructor that gets the counters from the statistics manager
+    Dhcp6Counters() {
+        StatsMgr& mgr = StatsMgr::instance();
+        received_                 = mgr.getCounter("pkt6-received");
+        solicit_received_         = mgr.getCounter("pkt6-solicit-received");
+        advertise_received_       = mgr.getCounter("pkt6-advertise-received");
+        request_received_         = mgr.getCounter("pkt6-request-received");
+        confirm_received_         = mgr.getCounter("pkt6-confirm-received");
+        renew_received_           = mgr.getCounter("pkt6-renew-received");
+        rebind_received_          = mgr.getCounter("pkt6-rebind-received");
+        reply_received_           = mgr.getCounter("pkt6-reply-received");
+        release_received_         = mgr.getCounter("pkt6-release-received");
+        decline_received_         = mgr.getCounter("pkt6-decline-received");
+        reconfigure_received_     = mgr.getCounter("pkt6-reconfigure-received");
+        infrequest_received_      = mgr.getCounter("pkt6-infrequest-received");
+        dhcpv4_query_received_    = mgr.getCounter("pkt6-dhcpv4-query-received");
+        dhcpv4_response_received_ = mgr.getCounter("pkt6-dhcpv4-response-received");
+        unknown_received_         = mgr.getCounter("pkt6-unknown-received");
+        sent_                     = mgr.getCounter("pkt6-sent");
+        advertise_sent_           = mgr.getCounter("pkt6-advertise-sent");
+        reply_sent_               = mgr.getCounter("pkt6-reply-sent");
+        dhcpv4_response_sent_     = mgr.getCounter("pkt6-dhcpv4-response-sent");
+        receive_drop_             = mgr.getCounter("pkt6-receive-drop");
+    }
+};
+
+// Declare the packet statistic counters in the same way.
+Dhcp6Counters Counters;
+
 /// @brief Creates instance of the Status Code option.
 ///
 /// This variant of the function is used when the Status Code option
@@ -559,7 +614,7 @@ void Dhcpv6Srv::run_one() {
             // any failures in unpacking will cause the packet to be dropped.
             // we will increase type specific packets further down the road.
             // See processStatsReceived().
-            StatsMgr::instance().addValue("pkt6-received", static_cast<int64_t>(1));
+            Counters.received_->add();
 
         }
         // We used to log that the wait was interrupted, but this is no longer
@@ -693,8 +748,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 .arg(query->getIface());
 
             // Increase the statistic of dropped packets.
-            StatsMgr::instance().addValue("pkt6-receive-drop",
-                                          static_cast<int64_t>(1));
+            Counters.receive_drop_->add();
             return;
         }
 
@@ -728,8 +782,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             // Increase the statistics of parse failures and dropped packets.
             StatsMgr::instance().addValue("pkt6-parse-failed",
                                           static_cast<int64_t>(1));
-            StatsMgr::instance().addValue("pkt6-receive-drop",
-                                          static_cast<int64_t>(1));
+            Counters.receive_drop_->add();
             return;
         }
     }
@@ -742,7 +795,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (!testServerID(query)) {
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        Counters.receive_drop_->add();
         return;
     }
 
@@ -752,7 +805,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (!testUnicast(query)) {
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        Counters.receive_drop_->add();
         return;
     }
 
@@ -799,8 +852,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             LOG_DEBUG(hooks_logger, DBG_DHCP6_HOOKS, DHCP6_HOOK_PACKET_RCVD_SKIP)
                 .arg(query->getLabel());
             // Increase the statistic of dropped packets.
-            StatsMgr::instance().addValue("pkt6-receive-drop",
-                                          static_cast<int64_t>(1));
+            Counters.receive_drop_->add();
             return;
         }
 
@@ -816,8 +868,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (query->inClass("DROP")) {
         LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC, DHCP6_PACKET_DROP_DROP_CLASS)
             .arg(query->toText());
-        StatsMgr::instance().addValue("pkt6-receive-drop",
-                                      static_cast<int64_t>(1));
+        Counters.receive_drop_->add();
         return;
     }
 
@@ -828,6 +879,52 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         return;
     }
 
+    // In multi-threading mode do not process in parallel two queries
+    // from the same client: the later query is deferred until the client
+    // is free.
+    ClientHandler client_handler;
+    if (MultiThreadingMgr::instance().getMode()) {
+        ContinuationPtr cont =
+            makeContinuation(std::bind(&Dhcpv6Srv::processDhcp6QueryAndSendResponse,
+                                       this, query, rsp));
+        if (!client_handler.tryLock(query, cont)) {
+            return;
+        }
+    }
+
+    processDhcp6Query(query, rsp);
+}
+
+void
+Dhcpv6Srv::processDhcp6QueryAndSendResponse(Pkt6Ptr& query, Pkt6Ptr& rsp) {
+    try {
+        // Another query from the client may have been received since
+        // this one was deferred.
+        ClientHandler client_handler;
+        ContinuationPtr cont =
+            makeContinuation(std::bind(&Dhcpv6Srv::processDhcp6QueryAndSendResponse,
+                                       this, query, rsp));
+        if (!client_handler.tryLock(query, cont)) {
+            return;
+        }
+
+        processDhcp6Query(query, rsp);
+        if (!rsp) {
+            return;
+        }
+
+        CalloutHandlePtr callout_handle = getCalloutHandle(query);
+        processPacketBufferSend(callout_handle, rsp);
+    } catch (const std::exception& e) {
+        LOG_ERROR(packet6_logger, DHCP6_PACKET_PROCESS_STD_EXCEPTION)
+            .arg(e.what());
+    } catch (...) {
+        LOG_ERROR(packet6_logger, DHCP6_PACKET_PROCESS_EXCEPTION);
+    }
+}
+
+void
+Dhcpv6Srv::processDhcp6Query(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     // Let's create a simplified client context here.
     AllocEngine::ClientContext6 ctx;
     bool drop = false;
@@ -893,7 +990,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             .arg(e.what());
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        Counters.receive_drop_->add();
     }
 
     if (!rsp) {
@@ -1299,10 +1396,10 @@ Dhcpv6Srv::buildCfgOptionList(const Pkt6Ptr& question,
 
 void
 Dhcpv6Srv::appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
-                                  const CfgOptionList& co_list) {
+                                  const CfgOptionListResolver& resolver) {
 
     // Unlikely short cut
-    if (co_list.empty()) {
+    if (resolver.empty()) {
         return;
     }
 
@@ -1318,33 +1415,13 @@ Dhcpv6Srv::appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
     if (option_oro) {
         requested_opts = option_oro->getValues();
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP6_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            requested_opts.push_back(desc->option_->getType());
-        }
-    }
+    // Add the codes of the persistent options to requested options
+    resolver.getPersistent(DHCP6_OPTION_SPACE, requested_opts);
 
     BOOST_FOREACH(uint16_t opt, requested_opts) {
-        // Iterate on the configured option list
-        for (CfgOptionList::const_iterator copts = co_list.begin();
-             copts != co_list.end(); ++copts) {
-            OptionDescriptor desc = (*copts)->get(DHCP6_OPTION_SPACE, opt);
-            // Got it: add it and jump to the outer loop
-            if (desc.option_) {
-                answer->addOption(desc.option_);
-                break;
-            }
+        OptionPtr option = resolver.get(DHCP6_OPTION_SPACE, opt);
+        if (option) {
+            answer->addOption(option);
         }
     }
 }
@@ -1353,7 +1430,7 @@ void
 Dhcpv6Srv::appendRequestedVendorOptions(const Pkt6Ptr& question,
                                         Pkt6Ptr& answer,
                                         AllocEngine::ClientContext6& ctx,
-                                        const CfgOptionList& co_list) {
+                                        const CfgOptionListResolver& resolver) {
 
     // Leave if there is no subnet matching the incoming packet.
     // There is no need to log the error message here because
@@ -1362,7 +1439,7 @@ Dhcpv6Srv::appendRequestedVendorOptions(const Pkt6Ptr& question,
     // error messages in such case.
     //
     // Also, if there's no options to possibly assign, give up.
-    if (!ctx.subnet_ || co_list.empty()) {
+    if (!ctx.subnet_ || resolver.empty()) {
         return;
     }
 
@@ -1408,22 +1485,8 @@ Dhcpv6Srv::appendRequestedVendorOptions(const Pkt6Ptr& question,
         }
     }
 
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(vendor_id);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            requested_opts.push_back(desc->option_->getType());
-        }
-    }
+    // Add the codes of the persistent options to requested options
+    resolver.getPersistent(vendor_id, requested_opts);
 
     // If there is nothing to add don't do anything then.
     if (requested_opts.empty()) {
@@ -1440,14 +1503,10 @@ Dhcpv6Srv::appendRequestedVendorOptions(const Pkt6Ptr& question,
     bool added = false;
 
     BOOST_FOREACH(uint16_t opt, requested_opts) {
-        for (CfgOptionList::const_iterator copts = co_list.begin();
-             copts != co_list.end(); ++copts) {
-            OptionDescriptor desc = (*copts)->get(vendor_id, opt);
-            if (desc.option_) {
-                vendor_rsp->addOption(desc.option_);
-                added = true;
-                break;
-            }
+        OptionPtr option = resolver.get(vendor_id, opt);
+        if (option) {
+            vendor_rsp->addOption(option);
+            added = true;
         }
     }
 
@@ -1496,7 +1555,7 @@ Dhcpv6Srv::sanityCheck(const Pkt6Ptr& pkt) {
     }
 
     // Increase the statistic of dropped packets.
-    StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+    Counters.receive_drop_->add();
     return (false);
 }
 
@@ -2798,6 +2857,9 @@ Dhcpv6Srv::releaseIA_NA(const DuidPtr& duid, const Pkt6Ptr& query,
     } else {
         old_lease = lease;
 
+        // The address or prefix can be allocated again.
+        alloc_engine_->freeLeaseAddress(lease);
+
         LOG_INFO(lease6_logger, DHCP6_RELEASE_NA)
             .arg(query->getLabel())
             .arg(lease->addr_.toText())
@@ -2962,6 +3024,9 @@ Dhcpv6Srv::releaseIA_PD(const DuidPtr& duid, const Pkt6Ptr& query,
     } else {
         old_lease = lease;
 
+        // The address or prefix can be allocated again.
+        alloc_engine_->freeLeaseAddress(lease);
+
         LOG_INFO(lease6_logger, DHCP6_RELEASE_PD)
             .arg(query->getLabel())
             .arg(lease->addr_.toText())
@@ -3025,8 +3090,9 @@ Dhcpv6Srv::processSolicit(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(solicit, ctx, co_list);
     appendDefaultOptions(solicit, response, co_list);
-    appendRequestedOptions(solicit, response, co_list);
-    appendRequestedVendorOptions(solicit, response, ctx, co_list);
+    CfgOptionListResolver resolver(co_list);
+    appendRequestedOptions(solicit, response, resolver);
+    appendRequestedVendorOptions(solicit, response, ctx, resolver);
 
     updateReservedFqdn(ctx, response);
 
@@ -3055,8 +3121,9 @@ Dhcpv6Srv::processRequest(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(request, ctx, co_list);
     appendDefaultOptions(request, reply, co_list);
-    appendRequestedOptions(request, reply, co_list);
-    appendRequestedVendorOptions(request, reply, ctx, co_list);
+    CfgOptionListResolver resolver(co_list);
+    appendRequestedOptions(request, reply, resolver);
+    appendRequestedVendorOptions(request, reply, ctx, resolver);
 
     updateReservedFqdn(ctx, reply);
     generateFqdn(reply, ctx);
@@ -3081,8 +3148,9 @@ Dhcpv6Srv::processRenew(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(renew, ctx, co_list);
     appendDefaultOptions(renew, reply, co_list);
-    appendRequestedOptions(renew, reply, co_list);
-    appendRequestedVendorOptions(renew, reply, ctx, co_list);
+    CfgOptionListResolver resolver(co_list);
+    appendRequestedOptions(renew, reply, resolver);
+    appendRequestedVendorOptions(renew, reply, ctx, resolver);
 
     updateReservedFqdn(ctx, reply);
     generateFqdn(reply, ctx);
@@ -3107,8 +3175,9 @@ Dhcpv6Srv::processRebind(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(rebind, ctx, co_list);
     appendDefaultOptions(rebind, reply, co_list);
-    appendRequestedOptions(rebind, reply, co_list);
-    appendRequestedVendorOptions(rebind, reply, ctx, co_list);
+    CfgOptionListResolver resolver(co_list);
+    appendRequestedOptions(rebind, reply, resolver);
+    appendRequestedVendorOptions(rebind, reply, ctx, resolver);
 
     updateReservedFqdn(ctx, reply);
     generateFqdn(reply, ctx);
@@ -3138,8 +3207,9 @@ Dhcpv6Srv::processConfirm(AllocEngine::ClientContext6& ctx) {
     CfgOptionList co_list;
     buildCfgOptionList(confirm, ctx, co_list);
     appendDefaultOptions(confirm, reply, co_list);
-    appendRequestedOptions(confirm, reply, co_list);
-    appendRequestedVendorOptions(confirm, reply, ctx, co_list);
+    CfgOptionListResolver resolver(co_list);
+    appendRequestedOptions(confirm, reply, resolver);
+    appendRequestedVendorOptions(confirm, reply, ctx, resolver);
     // Indicates if at least one address has been verified. If no addresses
     // are verified it means that the client has sent no IA_NA options
     // or no IAAddr options and that client's message has to be discarded.
@@ -3550,11 +3620,14 @@ Dhcpv6Srv::processInfRequest(AllocEngine::ClientContext6& ctx) {
     // options once we start supporting authentication)
     appendDefaultOptions(inf_request, reply, co_list);
 
+    // The configured option list flattened by option code.
+    CfgOptionListResolver resolver(co_list);
+
     // Try to assign options that were requested by the client.
-    appendRequestedOptions(inf_request, reply, co_list);
+    appendRequestedOptions(inf_request, reply, resolver);
 
     // Try to assign vendor options that were requested by the client.
-    appendRequestedVendorOptions(inf_request, reply, ctx, co_list);
+    appendRequestedVendorOptions(inf_request, reply, ctx, resolver);
 
     return (reply);
 }
@@ -3621,6 +3694,8 @@ void Dhcpv6Srv::evaluateClasses(const Pkt6Ptr& pkt, bool depend_on_known) {
     const ClientClassDictionaryPtr& dict =
         CfgMgr::instance().getCurrentCfg()->getClientClassDictionary();
     const ClientClassDefListPtr& defs_ptr = dict->getClasses();
+    // The classes share the values they extract from the packet.
+    ScopedEnableExtractionCache extraction_cache(*pkt);
     for (ClientClassDefList::const_iterator it = defs_ptr->cbegin();
          it != defs_ptr->cend(); ++it) {
         // Note second cannot be null
@@ -3637,6 +3712,10 @@ void Dhcpv6Srv::evaluateClasses(const Pkt6Ptr& pkt, bool depend_on_known) {
         if ((*it)->getDependOnKnown() != depend_on_known) {
             continue;
         }
+        // Nothing depends on the class
+        if (!(*it)->getUsed()) {
+            continue;
+        }
         // Evaluate the expression which can return false (no match),
         // true (match) or raise an exception (error)
         try {
@@ -3743,6 +3822,7 @@ Dhcpv6Srv::requiredClassify(const Pkt6Ptr& pkt, AllocEngine::ClientContext6& ctx
     // Note getClientClassDictionary() cannot be null
     const ClientClassDictionaryPtr& dict =
         CfgMgr::instance().getCurrentCfg()->getClientClassDictionary();
+    ScopedEnableExtractionCache extraction_cache(*pkt);
     for (ClientClasses::const_iterator cclass = classes.cbegin();
          cclass != classes.cend(); ++cclass) {
         const ClientClassDefPtr class_def = dict->findClass(*cclass);
@@ -4017,79 +4097,79 @@ void Dhcpv6Srv::processStatsReceived(const Pkt6Ptr& query) {
     // Note that we're not bumping pkt6-received statistic as it was
     // increased early in the packet reception code.
 
-    string stat_name = "pkt6-unknown-received";
+    StatsCounter* counter = Counters.unknown_received_.get();
     switch (query->getType()) {
     case DHCPV6_SOLICIT:
-        stat_name = "pkt6-solicit-received";
+        counter = Counters.solicit_received_.get();
         break;
     case DHCPV6_ADVERTISE:
         // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-advertise-received";
+        counter = Counters.advertise_received_.get();
         break;
     case DHCPV6_REQUEST:
-        stat_name = "pkt6-request-received";
+        counter = Counters.request_received_.get();
         break;
     case DHCPV6_CONFIRM:
-        stat_name = "pkt6-confirm-received";
+        counter = Counters.confirm_received_.get();
         break;
     case DHCPV6_RENEW:
-        stat_name = "pkt6-renew-received";
+        counter = Counters.renew_received_.get();
         break;
     case DHCPV6_REBIND:
-        stat_name = "pkt6-rebind-received";
+        counter = Counters.rebind_received_.get();
         break;
     case DHCPV6_REPLY:
         // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-reply-received";
+        counter = Counters.reply_received_.get();
         break;
     case DHCPV6_RELEASE:
-        stat_name = "pkt6-release-received";
+        counter = Counters.release_received_.get();
         break;
     case DHCPV6_DECLINE:
-        stat_name = "pkt6-decline-received";
+        counter = Counters.decline_received_.get();
         break;
     case DHCPV6_RECONFIGURE:
-        stat_name = "pkt6-reconfigure-received";
+        counter = Counters.reconfigure_received_.get();
         break;
     case DHCPV6_INFORMATION_REQUEST:
-        stat_name = "pkt6-infrequest-received";
+        counter = Counters.infrequest_received_.get();
         break;
     case DHCPV6_DHCPV4_QUERY:
-        stat_name = "pkt6-dhcpv4-query-received";
+        counter = Counters.dhcpv4_query_received_.get();
         break;
     case DHCPV6_DHCPV4_RESPONSE:
         // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-dhcpv4-response-received";
+        counter = Counters.dhcpv4_response_received_.get();
         break;
     default:
             ; // do nothing
     }
 
-    StatsMgr::instance().addValue(stat_name, static_cast<int64_t>(1));
+    counter->add();
 }
 
 void Dhcpv6Srv::processStatsSent(const Pkt6Ptr& response) {
     // Increase generic counter for sent packets.
-    StatsMgr::instance().addValue("pkt6-sent", static_cast<int64_t>(1));
+    Counters.sent_->add();
 
     // Increase packet type specific counter for packets sent.
-    string stat_name;
+    StatsCounter* counter = 0;
     switch (response->getType()) {
     case DHCPV6_ADVERTISE:
-        stat_name = "pkt6-advertise-sent";
+        counter = Counters.advertise_sent_.get();
         break;
     case DHCPV6_REPLY:
-        stat_name = "pkt6-reply-sent";
+        counter = Counters.reply_sent_.get();
         break;
     case DHCPV6_DHCPV4_RESPONSE:
-        stat_name = "pkt6-dhcpv4-response-sent";
+        counter = Counters.dhcpv4_response_sent_.get();
         break;
     default:
         // That should never happen
         return;
     }
 
-    StatsMgr::instance().addValue(stat_name, static_cast<int64_t>(1));
+    counter->add();
 }
 
 int Dhcpv6Srv::getHookIndexBuffer6Send() {
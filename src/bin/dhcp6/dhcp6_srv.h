@@ -23,6 +23,7 @@
 #include <dhcpsrv/cb_ctl_dhcp6.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/d2_client_mgr.h>
+#include <dhcpsrv/flat_cfg_option.h>
 #include <dhcpsrv/network_state.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
@@ -184,6 +185,24 @@ public:
     /// @param rsp A pointer to the response
     void processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp);
 
+    /// @brief Process a single incoming DHCPv6 query.
+    ///
+    /// It calls per-type processXXX methods, generates appropriate answer.
+    /// The query must have been unpacked, classified and accepted.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param rsp A pointer to the response
+    void processDhcp6Query(Pkt6Ptr& query, Pkt6Ptr& rsp);
+
+    /// @brief Process a deferred DHCPv6 query and sends the response.
+    ///
+    /// This is the continuation of a query deferred because another query
+    /// from the same client was being processed.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param rsp A pointer to the response
+    void processDhcp6QueryAndSendResponse(Pkt6Ptr& query, Pkt6Ptr& rsp);
+
     /// @brief Instructs the server to shut down.
     void shutdown();
 
@@ -617,9 +636,9 @@ protected:
     /// @param question client's message
     /// @param answer server's message (options will be added here)
     ///
-    /// @param co_list configured option list
+    /// @param resolver resolver of the configured option list
     void appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
-                                const CfgOptionList& co_list);
+                                const CfgOptionListResolver& resolver);
 
     /// @brief Appends requested vendor options to server's answer.
     ///
@@ -629,10 +648,10 @@ protected:
     /// @param question client's message
     /// @param answer server's message (vendor options will be added here)
     /// @param ctx client context (contains subnet, duid and other parameters)
-    /// @param co_list configured option list
+    /// @param resolver resolver of the configured option list
     void appendRequestedVendorOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
                                       AllocEngine::ClientContext6& ctx,
-                                      const CfgOptionList& co_list);
+                                      const CfgOptionListResolver& resolver);
 
     /// @brief Assigns leases.
     ///
@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option.h>
+#include <dhcp6/client_handler.h>
+#include <stats/stats_mgr.h>
+#include <util/multi_threading_mgr.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::stats;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Test fixture class for testing client handler.
+class ClientHandleTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Enables the multi-threading mode without starting the threads so
+    /// the continuations pushed to the thread pool stay in its queue.
+    ClientHandleTest() {
+        MultiThreadingMgr::instance().setMode(true);
+        StatsMgr::instance().setValue("pkt6-receive-drop",
+                                      static_cast<int64_t>(0));
+    }
+
+    /// @brief Destructor.
+    ~ClientHandleTest() {
+        MultiThreadingMgr::instance().getThreadPool().reset();
+        MultiThreadingMgr::instance().setMode(false);
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Creates a query.
+    ///
+    /// @param duid_byte The last byte of the DUID, no client identifier
+    /// when 0.
+    Pkt6Ptr createQuery(uint8_t duid_byte) {
+        Pkt6Ptr query(new Pkt6(DHCPV6_REQUEST, 1234));
+        if (duid_byte) {
+            OptionBuffer duid = { 0, 1, 2, 3, 4, duid_byte };
+            query->addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID,
+                                                  duid)));
+        }
+        return (query);
+    }
+
+    /// @brief Returns the number of dropped queries.
+    int64_t getDropped() {
+        return (StatsMgr::instance().getObservation("pkt6-receive-drop")->
+                getInteger().first);
+    }
+
+    /// @brief Returns the number of continuations in the thread pool.
+    size_t getPushed() {
+        return (MultiThreadingMgr::instance().getThreadPool().count());
+    }
+};
+
+// Verifies that a second query from the same client is parked and
+// pushed to the thread pool when the first one is done.
+TEST_F(ClientHandleTest, parked) {
+    bool called = false;
+    ContinuationPtr cont = makeContinuation([&called]() { called = true; });
+    {
+        ClientHandler handler1;
+        ASSERT_TRUE(handler1.tryLock(createQuery(1)));
+
+        ClientHandler handler2;
+        EXPECT_FALSE(handler2.tryLock(createQuery(1), cont));
+        EXPECT_EQ(0, getPushed());
+
+        // Another client is not blocked.
+        ClientHandler handler3;
+        EXPECT_TRUE(handler3.tryLock(createQuery(3)));
+    }
+    EXPECT_EQ(1, getPushed());
+    EXPECT_EQ(0, getDropped());
+    EXPECT_FALSE(called);
+
+    // The client is free again.
+    ClientHandler handler;
+    EXPECT_TRUE(handler.tryLock(createQuery(1)));
+}
+
+// Verifies that a newer query replaces the parked one, and that a query
+// without continuation is dropped.
+TEST_F(ClientHandleTest, dropped) {
+    ContinuationPtr cont1 = makeContinuation([]() {});
+    ContinuationPtr cont2 = makeContinuation([]() {});
+    {
+        ClientHandler handler1;
+        ASSERT_TRUE(handler1.tryLock(createQuery(1)));
+
+        ClientHandler handler2;
+        EXPECT_FALSE(handler2.tryLock(createQuery(1), cont1));
+        EXPECT_EQ(0, getDropped());
+
+        ClientHandler handler3;
+        EXPECT_FALSE(handler3.tryLock(createQuery(1), cont2));
+        EXPECT_EQ(1, getDropped());
+
+        ClientHandler handler4;
+        EXPECT_FALSE(handler4.tryLock(createQuery(1)));
+        EXPECT_EQ(2, getDropped());
+    }
+    // Only the last parked query is processed.
+    EXPECT_EQ(1, getPushed());
+}
+
+// Verifies that a query without client identifier is always processed.
+TEST_F(ClientHandleTest, noIdentifier) {
+    Pkt6Ptr query = createQuery(0);
+    ClientHandler handler1;
+    EXPECT_TRUE(handler1.tryLock(query));
+    ClientHandler handler2;
+    EXPECT_TRUE(handler2.tryLock(query));
+}
+
+} // end of anonymous namespace
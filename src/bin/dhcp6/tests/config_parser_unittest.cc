@@ -7701,6 +7701,111 @@ TEST_F(Dhcp6ParserTest, storeExtendedInfoNoGlobal) {
     EXPECT_TRUE(subnet->getStoreExtendedInfo());
 }
 
+// Verifies the value of allocator for subnets when there is a global
+// value defined.
+TEST_F(Dhcp6ParserTest, allocatorGlobal) {
+    const string config = "{ " + genIfaceConfig() + ","
+        "\"preferred-lifetime\": 3000,"
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, "
+        "\"allocator\": \"hashed\","
+        "\"subnet6\": [ "
+        "{ "
+        "    \"pools\": [ { \"pool\": \"2001:db8:1::1 - 2001:db8:1::ffff\" } ],"
+        "    \"subnet\": \"2001:db8:1::/64\","
+        "    \"allocator\": \"iterative\""
+        "},"
+        "{"
+        "    \"pools\": [ { \"pool\": \"2001:db8:2::1 - 2001:db8:2::ffff\" } ],"
+        "    \"subnet\": \"2001:db8:2::/64\" "
+        "} ],"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP6(config));
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp6Server(srv_, json));
+    checkResult(status, 0);
+
+    // First subnet should override the global value.
+    CfgSubnets6Ptr cfg = CfgMgr::instance().getStagingCfg()->getCfgSubnets6();
+    Subnet6Ptr subnet = cfg->selectSubnet(IOAddress("2001:db8:1::"));
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ("iterative", subnet->getAllocatorType().get());
+
+    // Second subnet should use the global value.
+    subnet = cfg->selectSubnet(IOAddress("2001:db8:2::"));
+    ASSERT_TRUE(subnet);
+    // Reset the fetch global function to staging (vs current) config.
+    subnet->setFetchGlobalsFn([]() -> ConstElementPtr {
+        return (CfgMgr::instance().getStagingCfg()->getConfiguredGlobals());
+    });
+    EXPECT_EQ("hashed", subnet->getAllocatorType().get());
+}
+
+// Verifies that an unknown allocator type is rejected.
+TEST_F(Dhcp6ParserTest, allocatorInvalid) {
+    const string config = "{ " + genIfaceConfig() + ","
+        "\"subnet6\": [ "
+        "{ "
+        "    \"pools\": [ { \"pool\": \"2001:db8:1::1 - 2001:db8:1::ffff\" } ],"
+        "    \"subnet\": \"2001:db8:1::/64\","
+        "    \"allocator\": \"foo\""
+        "} ],"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP6(config));
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp6Server(srv_, json));
+    checkResult(status, 1);
+}
+
+// This test checks that the free-lease-index global parameter is stored
+// in the configured globals.
+TEST_F(Dhcp6ParserTest, freeLeaseIndex) {
+    std::string config = "{ " + genIfaceConfig() + "," +
+        "\"free-lease-index\": true,"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP6(config));
+
+    ConstElementPtr status;
+    ASSERT_NO_THROW(status = configureDhcp6Server(srv_, json));
+    checkResult(status, 0);
+
+    ConstElementPtr enabled = CfgMgr::instance().getStagingCfg()->
+        getConfiguredGlobal("free-lease-index");
+    ASSERT_TRUE(enabled);
+    EXPECT_TRUE(enabled->boolValue());
+}
+
+// This test checks that the option-arena global parameter is stored in
+// the configured globals and must be a boolean.
+TEST_F(Dhcp6ParserTest, optionArena) {
+    std::string config = "{ " + genIfaceConfig() + "," +
+        "\"option-arena\": true,"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP6(config));
+
+    ConstElementPtr status;
+    ASSERT_NO_THROW(status = configureDhcp6Server(srv_, json));
+    checkResult(status, 0);
+
+    ConstElementPtr enabled = CfgMgr::instance().getStagingCfg()->
+        getConfiguredGlobal("option-arena");
+    ASSERT_TRUE(enabled);
+    EXPECT_TRUE(enabled->boolValue());
+
+    config = "{ " + genIfaceConfig() + "," +
+        "\"option-arena\": 1,"
+        "\"valid-lifetime\": 4000 }";
+    EXPECT_THROW(parseDHCP6(config), Dhcp6ParseError);
+}
+
 /// This test checks that the statistic-default-sample-count and age
 /// global parameters are committed to the stats manager as expected.
 TEST_F(Dhcp6ParserTest, statsDefaultLimits) {
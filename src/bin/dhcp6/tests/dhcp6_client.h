@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -129,7 +129,7 @@ public:
         /// @return Pointer to the option if the option exists, or NULL if
         /// the option doesn't exist.
         OptionPtr findOption(const uint16_t code) const {
-            std::multimap<unsigned int, OptionPtr>::const_iterator it = options_.find(code);
+            OptionCollection::const_iterator it = options_.find(code);
             if (it != options_.end()) {
                 return (it->second);
             }
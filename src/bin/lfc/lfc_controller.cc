@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,7 @@
 #include <lfc/lfc_log.h>
 #include <util/pid_file.h>
 #include <exceptions/exceptions.h>
+#include <dhcpsrv/binary_lease_file.h>
 #include <dhcpsrv/csv_lease_file4.h>
 #include <dhcpsrv/csv_lease_file6.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
@@ -51,7 +52,8 @@ const char* LFCController::lfc_app_name_ = "DhcpLFC";
 const char* LFCController::lfc_bin_name_ = "kea-lfc";
 
 LFCController::LFCController()
-    : protocol_version_(0), verbose_(false), config_file_(""), previous_file_(""),
+    : protocol_version_(0), verbose_(false), binary_output_(false),
+      convert_(false), config_file_(""), previous_file_(""),
       copy_file_(""), output_file_(""), finish_file_(""), pid_file_("") {
 }
 
@@ -80,6 +82,21 @@ LFCController::launch(int argc, char* argv[], const bool test_mode) {
     // Start up the logging system.
     startLogger(test_mode);
 
+    // In the conversion mode there is no other instance to check and
+    // no file to rotate.
+    if (convert_) {
+        LOG_INFO(lfc_logger, LFC_CONVERTING)
+          .arg(copy_file_)
+          .arg(output_file_);
+
+        if (getProtocolVersion() == 4) {
+            convertLeases<Lease4, CSVLeaseFile4, Lease4Storage>();
+        } else {
+            convertLeases<Lease6, CSVLeaseFile6, Lease6Storage>();
+        }
+        return;
+    }
+
     LOG_INFO(lfc_logger, LFC_START);
 
     // verify we are the only instance
@@ -151,7 +168,7 @@ LFCController::parseArgs(int argc, char* argv[]) {
 
     opterr = 0;
     optind = 1;
-    while ((ch = getopt(argc, argv, ":46dhvVWp:x:i:o:c:f:")) != -1) {
+    while ((ch = getopt(argc, argv, ":46dhvVWbCp:x:i:o:c:f:")) != -1) {
         switch (ch) {
         case '4':
             // Process DHCPv4 lease files.
@@ -183,6 +200,16 @@ LFCController::parseArgs(int argc, char* argv[]) {
             verbose_ = true;
             break;
 
+        case 'b':
+            // Binary output.
+            binary_output_ = true;
+            break;
+
+        case 'C':
+            // Conversion mode.
+            convert_ = true;
+            break;
+
         case 'p':
             // PID file name.
             if (optarg == NULL) {
@@ -260,11 +287,12 @@ LFCController::parseArgs(int argc, char* argv[]) {
         isc_throw(InvalidUsage, "DHCP version required");
     }
 
-    if (pid_file_.empty()) {
+    // The conversion only needs the input and the output files.
+    if (pid_file_.empty() && !convert_) {
         isc_throw(InvalidUsage, "PID file not specified");
     }
 
-    if (previous_file_.empty()) {
+    if (previous_file_.empty() && !convert_) {
         isc_throw(InvalidUsage, "Previous file not specified");
     }
 
@@ -276,11 +304,11 @@ LFCController::parseArgs(int argc, char* argv[]) {
         isc_throw(InvalidUsage, "Output file not specified");
     }
 
-    if (finish_file_.empty()) {
+    if (finish_file_.empty() && !convert_) {
         isc_throw(InvalidUsage, "Finish file not specified");
     }
 
-    if (config_file_.empty()) {
+    if (config_file_.empty() && !convert_) {
         isc_throw(InvalidUsage, "Config file not specified");
     }
 
@@ -293,6 +321,10 @@ LFCController::parseArgs(int argc, char* argv[]) {
                   << "Finish file:               " << finish_file_ << std::endl
                   << "Config file:               " << config_file_ << std::endl
                   << "PID file:                  " << pid_file_ << std::endl
+                  << "Output format:             "
+                  << (binary_output_ ? "binary" : "csv") << std::endl
+                  << "Conversion only:           "
+                  << (convert_ ? "yes" : "no") << std::endl
                   << std::endl;
     }
 }
@@ -304,8 +336,11 @@ LFCController::usage(const std::string& text) {
     }
 
     std::cerr << "Usage: " << lfc_bin_name_ << std::endl
-              << " [-4|-6] -p file -x file -i file -o file -f file -c file" << std::endl
+              << " [-4|-6] [-b] -p file -x file -i file -o file -f file -c file" << std::endl
+              << " [-4|-6] [-b] -C -i file -o file" << std::endl
               << "   -4 or -6 clean a set of v4 or v6 lease files" << std::endl
+              << "   -b: optional, write the output file in the binary format" << std::endl
+              << "   -C: convert the lease file given by -i to the output file" << std::endl
               << "   -p <file>: PID file" << std::endl
               << "   -x <file>: previous or ex lease file" << std::endl
               << "   -i <file>: copy of lease file" << std::endl
@@ -337,34 +372,29 @@ void
 LFCController::processLeases() const {
     StorageType storage;
 
-    // If a previous file exists read the entries into storage
-    LeaseFileType lf_prev(getPreviousFile());
-    if (lf_prev.exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(lf_prev, storage,
-                                               MAX_LEASE_ERRORS);
+    // If a previous file exists read the entries into storage. The files
+    // written by a previous run may be in the binary format. Large files
+    // are parsed by a thread per processor.
+    LeaseFileStats read_stats;
+    if (LeaseFileType(getPreviousFile()).exists()) {
+        LeaseFileLoader::loadFile<LeaseObjectType, LeaseFileType>
+            (getPreviousFile(), storage, MAX_LEASE_ERRORS, read_stats, 0);
     }
 
     // Follow that with the copy of the current lease file
-    LeaseFileType lf_copy(getCopyFile());
-    if (lf_copy.exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(lf_copy, storage,
-                                               MAX_LEASE_ERRORS);
+    if (LeaseFileType(getCopyFile()).exists()) {
+        LeaseFileLoader::loadFile<LeaseObjectType, LeaseFileType>
+            (getCopyFile(), storage, MAX_LEASE_ERRORS, read_stats, 0);
     }
 
-    // Write the result out to the output file
-    LeaseFileType lf_output(getOutputFile());
-    LeaseFileLoader::write<LeaseObjectType>(lf_output, storage);
-
     // If desired log the stats
     LOG_INFO(lfc_logger, LFC_READ_STATS)
-      .arg(lf_prev.getReadLeases() + lf_copy.getReadLeases())
-      .arg(lf_prev.getReads() + lf_copy.getReads())
-      .arg(lf_prev.getReadErrs() + lf_copy.getReadErrs());
+      .arg(read_stats.getReadLeases())
+      .arg(read_stats.getReads())
+      .arg(read_stats.getReadErrs());
 
-    LOG_INFO(lfc_logger, LFC_WRITE_STATS)
-      .arg(lf_output.getWriteLeases())
-      .arg(lf_output.getWrites())
-      .arg(lf_output.getWriteErrs());
+    // Write the result out to the output file
+    writeLeases<LeaseObjectType, LeaseFileType>(storage);
 
     // Once we've finished the output file move it to the complete file
     if (rename(getOutputFile().c_str(), getFinishFile().c_str()) != 0) {
@@ -374,6 +404,58 @@ LFCController::processLeases() const {
     }
 }
 
+template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+void
+LFCController::convertLeases() const {
+    StorageType storage;
+
+    // The loader would create a missing CSV file.
+    if (!LeaseFileType(getCopyFile()).exists()) {
+        isc_throw(RunTimeFail, "Unable to read lease file '" << copy_file_
+                  << "'");
+    }
+
+    // Read the entries of the copy file, in any format.
+    LeaseFileStats read_stats;
+    LeaseFileLoader::loadFile<LeaseObjectType, LeaseFileType>
+        (getCopyFile(), storage, MAX_LEASE_ERRORS, read_stats, 0);
+
+    LOG_INFO(lfc_logger, LFC_READ_STATS)
+      .arg(read_stats.getReadLeases())
+      .arg(read_stats.getReads())
+      .arg(read_stats.getReadErrs());
+
+    // Remove a previous output file so as not to append to it.
+    if ((remove(getOutputFile().c_str()) != 0) && (errno != ENOENT)) {
+        isc_throw(RunTimeFail, "Unable to delete output file '"
+                  << output_file_ << "' error: " << strerror(errno));
+    }
+
+    writeLeases<LeaseObjectType, LeaseFileType>(storage);
+}
+
+template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+void
+LFCController::writeLeases(const StorageType& storage) const {
+    LeaseFileStats write_stats;
+    if (binary_output_) {
+        typename BinaryLeaseFileTraits<LeaseObjectType>::FileType
+            lf_output(getOutputFile());
+        LeaseFileLoader::write<LeaseObjectType>(lf_output, storage);
+        write_stats.addStatistics(lf_output);
+    } else {
+        LeaseFileType lf_output(getOutputFile());
+        LeaseFileLoader::write<LeaseObjectType>(lf_output, storage);
+        write_stats.addStatistics(lf_output);
+    }
+
+    // If desired log the stats
+    LOG_INFO(lfc_logger, LFC_WRITE_STATS)
+      .arg(write_stats.getWriteLeases())
+      .arg(write_stats.getWrites())
+      .arg(write_stats.getWriteErrs());
+}
+
 void
 LFCController::fileRotate() const {
     // Remove the old previous file
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -68,6 +68,9 @@ public:
     /// -# remove pid file
     /// -# exit to the caller
     ///
+    /// In the conversion mode (-C) the leases of the copy file are written
+    /// to the output file instead, and nothing else is done.
+    ///
     /// @param argc Number of strings in the @c argv array.
     /// @param argv Array of arguments passed in via the program's main function.
     /// @param test_mode is a bool value which indicates if @c launch
@@ -76,6 +79,7 @@ public:
     /// mode explicitly.
     ///
     /// @throw InvalidUsage if the command line parameters are invalid.
+    /// @throw isc::Exception if the conversion fails.
     void launch(int argc, char* argv[], const bool test_mode);
 
     /// @brief Process the command line arguments.
@@ -150,6 +154,20 @@ public:
     std::string getPidFile() const {
         return (pid_file_);
     }
+
+    /// @brief Checks if the output file is written in the binary format
+    ///
+    /// @return Returns true if the output is binary, false if it is CSV
+    bool getBinaryOutput() const {
+        return (binary_output_);
+    }
+
+    /// @brief Checks if the conversion mode is enabled
+    ///
+    /// @return Returns true if the copy file is only converted
+    bool getConvert() const {
+        return (convert_);
+    }
     //@}
 
 private:
@@ -157,6 +175,10 @@ private:
     int protocol_version_;
     /// When true output the result of parsing the command line
     bool verbose_;
+    /// When true write the output file in the binary format
+    bool binary_output_;
+    /// When true only convert the copy file to the output file
+    bool convert_;
     std::string config_file_;   ///< The path to the config file
     std::string previous_file_; ///< The path to the previous LFC file (if any)
     std::string copy_file_;     ///< The path to the copy of the lease file
@@ -190,6 +212,33 @@ private:
     template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
     void processLeases() const;
 
+    /// @brief Convert a file.
+    ///
+    /// Read in the leases from the copy file, in the CSV or in the binary
+    /// format, and write them out to the output file.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @throw isc::Exception if the copy file can't be read or the output
+    /// file can't be written.
+    template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+    void convertLeases() const;
+
+    /// @brief Write the leases to the output file.
+    ///
+    /// The file is written in the CSV format or in the binary format
+    /// if requested.
+    ///
+    /// @param storage The leases.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+    void writeLeases(const StorageType& storage) const;
+
     ///@brief Start up the logging system
     ///
     /// @param test_mode indicates if we have have been started from the test
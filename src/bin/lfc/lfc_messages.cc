@@ -7,6 +7,7 @@
 namespace isc {
 namespace lfc {
 
+extern const isc::log::MessageID LFC_CONVERTING = "LFC_CONVERTING";
 extern const isc::log::MessageID LFC_FAIL_PID_CREATE = "LFC_FAIL_PID_CREATE";
 extern const isc::log::MessageID LFC_FAIL_PID_DEL = "LFC_FAIL_PID_DEL";
 extern const isc::log::MessageID LFC_FAIL_PROCESS = "LFC_FAIL_PROCESS";
@@ -25,6 +26,7 @@ extern const isc::log::MessageID LFC_WRITE_STATS = "LFC_WRITE_STATS";
 namespace {
 
 const char* values[] = {
+    "LFC_CONVERTING", "Converting lease file: %1 to: %2",
     "LFC_FAIL_PID_CREATE", ": %1",
     "LFC_FAIL_PID_DEL", ": %1",
     "LFC_FAIL_PROCESS", ": %1",
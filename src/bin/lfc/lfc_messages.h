@@ -8,6 +8,7 @@
 namespace isc {
 namespace lfc {
 
+extern const isc::log::MessageID LFC_CONVERTING;
 extern const isc::log::MessageID LFC_FAIL_PID_CREATE;
 extern const isc::log::MessageID LFC_FAIL_PID_DEL;
 extern const isc::log::MessageID LFC_FAIL_PROCESS;
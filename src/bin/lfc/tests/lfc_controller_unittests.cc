@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -145,6 +145,8 @@ TEST_F(LFCControllerTest, initialValues) {
     EXPECT_TRUE(lfc_controller.getOutputFile().empty());
     EXPECT_TRUE(lfc_controller.getFinishFile().empty());
     EXPECT_TRUE(lfc_controller.getPidFile().empty());
+    EXPECT_FALSE(lfc_controller.getBinaryOutput());
+    EXPECT_FALSE(lfc_controller.getConvert());
 }
 
 /// @todo verify that parsing -v/V/W/h works well without ASSERT_EXIT
@@ -184,6 +186,33 @@ TEST_F(LFCControllerTest, fullCommandLine) {
     EXPECT_EQ(lfc_controller.getPidFile(), "pid");
 }
 
+/// @brief Verify that parsing a conversion command line works.
+/// The conversion only requires the protocol version, the copy
+/// and the output files.
+TEST_F(LFCControllerTest, convertCommandLine) {
+    LFCController lfc_controller;
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-6"),
+                     const_cast<char*>("-b"),
+                     const_cast<char*>("-C"),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>("copy"),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>("output") };
+
+    // The output file is required.
+    EXPECT_THROW(lfc_controller.parseArgs(6, argv), InvalidUsage);
+
+    ASSERT_NO_THROW(lfc_controller.parseArgs(8, argv));
+    EXPECT_EQ(lfc_controller.getProtocolVersion(), 6);
+    EXPECT_TRUE(lfc_controller.getBinaryOutput());
+    EXPECT_TRUE(lfc_controller.getConvert());
+    EXPECT_EQ(lfc_controller.getCopyFile(), "copy");
+    EXPECT_EQ(lfc_controller.getOutputFile(), "output");
+    EXPECT_TRUE(lfc_controller.getPidFile().empty());
+}
+
 /// @brief Verify that parsing a correct but incomplete line fails.
 /// Parse a command line that is correctly formatted but isn't complete
 /// (doesn't include some options or an some option arguments).  We
@@ -670,6 +699,72 @@ TEST_F(LFCControllerTest, launch6) {
     EXPECT_TRUE(noExistIOFP());
 }
 
+/// @brief Verify that the cleanup writes the binary format on request
+/// and that the files are converted between the formats.
+TEST_F(LFCControllerTest, launchBinary4) {
+    LFCController lfc_controller;
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-b"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>(xstr_.c_str()),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>(istr_.c_str()),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>(ostr_.c_str()),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>(cstr_.c_str()),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>(fstr_.c_str()),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>(pstr_.c_str())
+    };
+    int argc = 15;
+
+    string a_1 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,200,8,1,1,host.example.com,1,\n";
+    string a_2 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,800,8,1,1,host.example.com,1,{ \"foo\": true }\n";
+    string b_1 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,150,7,0,0,,1,\n";
+    string c_1 = "192.0.2.5,16:17:18:19:1a:bc,,"
+                 "200,200,8,1,1,host.example.com,1,\n";
+
+    // The cleanup writes the previous file in the binary format.
+    writeFile(xstr_, v4_hdr_ + a_1 + b_1);
+    writeFile(istr_, v4_hdr_ + a_2);
+    launch(lfc_controller, argc, argv);
+    EXPECT_EQ("KEALEASE", readFile(xstr_).substr(0, 8));
+    EXPECT_TRUE(noExistIOFP());
+
+    // The next cleanup reads the binary previous file.
+    writeFile(istr_, v4_hdr_ + c_1);
+    launch(lfc_controller, argc, argv);
+    EXPECT_EQ("KEALEASE", readFile(xstr_).substr(0, 8));
+    EXPECT_TRUE(noExistIOFP());
+
+    // Convert the binary file to the CSV format.
+    char* argv_convert[] = { const_cast<char*>("progName"),
+                             const_cast<char*>("-4"),
+                             const_cast<char*>("-C"),
+                             const_cast<char*>("-i"),
+                             const_cast<char*>(xstr_.c_str()),
+                             const_cast<char*>("-o"),
+                             const_cast<char*>(ostr_.c_str())
+    };
+    launch(lfc_controller, 7, argv_convert);
+    EXPECT_EQ(v4_hdr_ + a_2 + c_1 + b_1, readFile(ostr_));
+
+    // The conversion leaves the other files alone.
+    EXPECT_EQ("KEALEASE", readFile(xstr_).substr(0, 8));
+    EXPECT_TRUE(noExist(pstr_));
+
+    // A missing input file is an error.
+    removeTestFile();
+    EXPECT_THROW(launch(lfc_controller, 7, argv_convert), isc::Exception);
+}
+
 // @todo double launch (how to do that)
 
 } // end of anonymous namespace
@@ -38,6 +38,54 @@ const uint8_t bitMask6[]= { 0, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff };
 const uint8_t revMask6[]= { 0xff, 0x7f, 0x3f, 0x1f, 0xf, 0x7, 0x3, 0x1 };
 
 
+/// @brief adds a 64 bit value shifted left by a number of bits to
+/// an IPv6 address
+///
+/// Note: This is a private function. Do not use it directly.
+/// Please use offsetAddress() or offsetPrefix() instead.
+///
+/// @param addr IPv6 address
+/// @param offset value to add
+/// @param shift number of bits the value is shifted left (0..127)
+IOAddress offsetAddress6(const IOAddress& addr, uint64_t offset,
+                         uint8_t shift) {
+    uint8_t packed[V6ADDRESS_LEN];
+    memcpy(packed, &addr.toBytes()[0], V6ADDRESS_LEN);
+
+    // Split the address into two 64 bit halves (network order).
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    for (int i = 0; i < 8; ++i) {
+        hi = (hi << 8) | packed[i];
+        lo = (lo << 8) | packed[i + 8];
+    }
+
+    // Split the shifted offset the same way.
+    uint64_t off_hi = 0;
+    uint64_t off_lo = 0;
+    if (shift == 0) {
+        off_lo = offset;
+    } else if (shift < 64) {
+        off_lo = offset << shift;
+        off_hi = offset >> (64 - shift);
+    } else {
+        off_hi = offset << (shift - 64);
+    }
+
+    // Add with carry: the address space loops.
+    uint64_t sum_lo = lo + off_lo;
+    hi += off_hi + ((sum_lo < lo) ? 1 : 0);
+    lo = sum_lo;
+
+    for (int i = 7; i >= 0; --i) {
+        packed[i] = static_cast<uint8_t>(hi & 0xff);
+        packed[i + 8] = static_cast<uint8_t>(lo & 0xff);
+        hi >>= 8;
+        lo >>= 8;
+    }
+    return (IOAddress::fromBytes(AF_INET6, packed));
+}
+
 /// @brief calculates the first IPv6 address in a IPv6 prefix
 ///
 /// Note: This is a private function. Do not use it directly.
@@ -373,5 +421,26 @@ uint64_t prefixesInRange(const uint8_t pool_len, const uint8_t delegated_len) {
     }
 }
 
+IOAddress offsetAddress(const IOAddress& addr, uint64_t offset) {
+    if (addr.isV4()) {
+        // The 32 bit arithmetic loops the address space.
+        return (IOAddress(static_cast<uint32_t>(addr.toUint32() + offset)));
+    }
+    return (offsetAddress6(addr, offset, 0));
+}
+
+IOAddress offsetPrefix(const IOAddress& prefix, uint8_t delegated_len,
+                       uint64_t offset) {
+    if (!prefix.isV6()) {
+        isc_throw(BadValue, "Prefix operations are for IPv6 only (attempted "
+                  "to shift prefix " << prefix << ")");
+    }
+    if ((delegated_len < 1) || (delegated_len > 128)) {
+        isc_throw(BadValue, "Cannot shift prefix: invalid prefix length: "
+                  << static_cast<unsigned>(delegated_len));
+    }
+    return (offsetAddress6(prefix, offset, 128 - delegated_len));
+}
+
 };
 };
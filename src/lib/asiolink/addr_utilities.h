@@ -79,6 +79,32 @@ int prefixLengthFromRange(const IOAddress& min, const IOAddress& max);
 /// @param delegated_len length of the prefixes to be delegated from the pool
 /// @return number of prefixes in range
 uint64_t prefixesInRange(const uint8_t pool_len, const uint8_t delegated_len);
+
+/// @brief Returns an address shifted by the specified offset.
+///
+/// The address is treated as an integer and the offset is added to it,
+/// e.g. 192.0.2.250 shifted by 10 is 192.0.3.4. As for
+/// @c IOAddress::increase the address space loops.
+///
+/// @param addr IPv4 or IPv6 address
+/// @param offset number of addresses to add
+/// @return the shifted address
+IOAddress offsetAddress(const IOAddress& addr, uint64_t offset);
+
+/// @brief Returns a prefix shifted by the specified number of prefixes.
+///
+/// Example: offsetPrefix(2001:db8::, 64, 3) returns 2001:db8:0:3::,
+/// i.e. the fourth /64 prefix starting from 2001:db8::.
+///
+/// @throw BadValue if the prefix is not IPv6 or the length is not
+/// within 1..128.
+///
+/// @param prefix IPv6 prefix
+/// @param delegated_len length of the prefixes
+/// @param offset number of prefixes to add
+/// @return the shifted prefix
+IOAddress offsetPrefix(const IOAddress& prefix, uint8_t delegated_len,
+                       uint64_t offset);
 };
 };
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2010-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2010-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -12,6 +12,8 @@
 
 #include <boost/static_assert.hpp>
 
+#include <algorithm>
+
 #include <unistd.h>             // for some IPC/network system calls
 #include <stdint.h>
 #include <sys/socket.h>
@@ -82,6 +84,21 @@ IOAddress::toBytes() const {
     return (std::vector<uint8_t>(bytes6.begin(), bytes6.end()));
 }
 
+size_t
+IOAddress::toBytes(uint8_t* data) const {
+    if (asio_address_.is_v4()) {
+        const boost::asio::ip::address_v4::bytes_type bytes4 =
+            asio_address_.to_v4().to_bytes();
+        std::copy(bytes4.begin(), bytes4.end(), data);
+        return (bytes4.size());
+    }
+
+    const boost::asio::ip::address_v6::bytes_type bytes6 =
+        asio_address_.to_v6().to_bytes();
+    std::copy(bytes6.begin(), bytes6.end(), data);
+    return (bytes6.size());
+}
+
 short
 IOAddress::getFamily() const {
     if (asio_address_.is_v4()) {
@@ -157,6 +157,16 @@ public:
     ///         order.
     std::vector<uint8_t> toBytes() const;
 
+    /// \brief Writes the address as a set of bytes
+    ///
+    /// Unlike the other variant, this one does not allocate memory.
+    ///
+    /// \param data Pointer to a buffer of at least 4 bytes for IPv4, or
+    ///        16 bytes for IPv6.
+    ///
+    /// \return Number of bytes written, i.e. 4 or 16.
+    size_t toBytes(uint8_t* data) const;
+
     /// \brief Compare addresses for equality
     ///
     /// \param other Address to compare against.
@@ -367,4 +367,36 @@ TEST(AddrUtilitiesTest, prefixesInRange) {
 
 }
 
+// Checks if offsetAddress adds the offset to IPv4 and IPv6 addresses.
+TEST(AddrUtilitiesTest, offsetAddress) {
+    EXPECT_EQ("192.0.2.1", offsetAddress(IOAddress("192.0.2.1"), 0).toText());
+    EXPECT_EQ("192.0.3.4", offsetAddress(IOAddress("192.0.2.250"), 10).toText());
+    EXPECT_EQ("10.1.0.0", offsetAddress(IOAddress("10.0.0.0"), 65536).toText());
+    // The address space loops.
+    EXPECT_EQ("0.0.0.1", offsetAddress(IOAddress("255.255.255.255"), 2).toText());
+
+    EXPECT_EQ("2001:db8::1", offsetAddress(IOAddress("2001:db8::1"), 0).toText());
+    EXPECT_EQ("2001:db8::1:4", offsetAddress(IOAddress("2001:db8::fffa"), 10).toText());
+    // Carry from the lower to the upper half.
+    EXPECT_EQ("2001:db8:0:1::",
+              offsetAddress(IOAddress("2001:db8::ffff:ffff:ffff:ffff"), 1).toText());
+    EXPECT_EQ("::", offsetAddress(IOAddress("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"),
+                                  1).toText());
+}
+
+// Checks if offsetPrefix returns the right prefix.
+TEST(AddrUtilitiesTest, offsetPrefix) {
+    EXPECT_EQ("2001:db8::", offsetPrefix(IOAddress("2001:db8::"), 64, 0).toText());
+    EXPECT_EQ("2001:db8:0:3::", offsetPrefix(IOAddress("2001:db8::"), 64, 3).toText());
+    EXPECT_EQ("2001:db8:1::", offsetPrefix(IOAddress("2001:db8::"), 48, 1).toText());
+    EXPECT_EQ("2001:db8:1::", offsetPrefix(IOAddress("2001:db8::"), 64, 65536).toText());
+    EXPECT_EQ("2001:db8::80", offsetPrefix(IOAddress("2001:db8::"), 121, 1).toText());
+    EXPECT_EQ("2001:db8::5", offsetPrefix(IOAddress("2001:db8::"), 128, 5).toText());
+
+    // Only IPv6 prefixes of valid length are accepted.
+    EXPECT_THROW(offsetPrefix(IOAddress("192.0.2.0"), 24, 1), isc::BadValue);
+    EXPECT_THROW(offsetPrefix(IOAddress("2001:db8::"), 0, 1), isc::BadValue);
+    EXPECT_THROW(offsetPrefix(IOAddress("2001:db8::"), 129, 1), isc::BadValue);
+}
+
 }; // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -103,6 +103,22 @@ TEST(IOAddressTest, toBytesV6) {
     EXPECT_TRUE(std::equal(actual.begin(), actual.end(), V6));
 }
 
+// Checks that the addresses can be written to a buffer.
+TEST(IOAddressTest, toBytesBuffer) {
+    uint8_t V4[] = {0xc0, 0x00, 0x02, 0x01};
+    uint8_t V6[] = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xde, 0xad, 0xbe, 0xef
+    };
+    uint8_t data[V6ADDRESS_LEN];
+
+    ASSERT_EQ(sizeof(V4), IOAddress("192.0.2.1").toBytes(data));
+    EXPECT_TRUE(std::equal(V4, V4 + sizeof(V4), data));
+
+    ASSERT_EQ(sizeof(V6), IOAddress("2001:db8:1::dead:beef").toBytes(data));
+    EXPECT_TRUE(std::equal(V6, V6 + sizeof(V6), data));
+}
+
 TEST(IOAddressTest, isV4) {
     const IOAddress address4("192.0.2.1");
     const IOAddress address6("2001:db8:1::dead:beef");
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -55,6 +55,7 @@ DbAccessParser::parse(std::string& access_string,
     int64_t request_timeout = 0;
     int64_t tcp_keepalive = 0;
     int64_t max_row_errors = 0;
+    int64_t lfc_write_rate = 0;
 
     // 2. Update the copy with the passed keywords.
     for (std::pair<std::string, ConstElementPtr> param : database_config->mapValue()) {
@@ -104,6 +105,11 @@ DbAccessParser::parse(std::string& access_string,
                 max_row_errors = param.second->intValue();
                 values_copy[param.first] =
                     boost::lexical_cast<std::string>(max_row_errors);
+
+            } else if (param.first == "lfc-write-rate") {
+                lfc_write_rate = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(lfc_write_rate);
             } else {
                 // all remaining string parameters
                 // type
@@ -115,6 +121,9 @@ DbAccessParser::parse(std::string& access_string,
                 // keyspace
                 // consistency
                 // serial-consistency
+                // durability
+                // lfc-format
+                // lfc-mode
                 values_copy[param.first] = param.second->stringValue();
             }
         } catch (const isc::data::TypeError& ex) {
@@ -190,6 +199,16 @@ DbAccessParser::parse(std::string& access_string,
                   << " (" << value->getPosition() << ")");
     }
 
+    // Check that the lfc-write-rate is within a reasonable range.
+    if ((lfc_write_rate < 0) ||
+        (lfc_write_rate > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("lfc-write-rate");
+        isc_throw(DbConfigError, "lfc-write-rate value: " << lfc_write_rate
+                  << " is out of range, expected value: 0.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
     // Check that the max-reconnect-tries is reasonable.
     if (max_reconnect_tries < 0) {
         ConstElementPtr value = database_config->get("max-reconnect-tries");
@@ -32,13 +32,6 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 
-#ifndef FD_COPY
-#define FD_COPY(orig, copy) \
-    do { \
-        memmove(copy, orig, sizeof(fd_set)); \
-    } while (0)
-#endif
-
 using namespace std;
 using namespace isc::asiolink;
 using namespace isc::util;
@@ -48,6 +41,9 @@ using namespace isc::util::io::internal;
 namespace isc {
 namespace dhcp {
 
+const size_t
+IfaceMgr::MAX_RECEIVER_THREADS;
+
 IfaceMgr&
 IfaceMgr::instance() {
     return (*instancePtr());
@@ -59,6 +55,8 @@ IfaceMgr::instancePtr() {
     return (iface_mgr);
 }
 
+std::atomic<uint64_t> Iface::sockets_generation_(0);
+
 Iface::Iface(const std::string& name, int ifindex)
     :name_(name), ifindex_(ifindex), mac_len_(0), hardware_type_(0),
      flag_loopback_(false), flag_up_(false), flag_running_(false),
@@ -105,6 +103,7 @@ Iface::closeSockets(const uint16_t family) {
                 close(sock->fallbackfd_);
             }
             sockets_.erase(sock++);
+            ++sockets_generation_;
 
         } else {
             // Different type of socket. Let's move
@@ -171,6 +170,7 @@ bool Iface::delSocket(const uint16_t sockfd) {
                 close(sock->fallbackfd_);
             }
             sockets_.erase(sock);
+            ++sockets_generation_;
             return (true); //socket found
         }
         ++sock;
@@ -181,8 +181,14 @@ bool Iface::delSocket(const uint16_t sockfd) {
 IfaceMgr::IfaceMgr()
     :packet_filter_(new PktFilterInet()),
      packet_filter6_(new PktFilterInet6()),
+     fd_event_handler_(createFDEventHandler()),
+     fd_event_handler_dirty_(true),
+     registered_generation_(0),
+     registered_family_(AF_INET),
+     registered_indirect_(false),
      test_mode_(false),
-     allow_loopback_(false) {
+     allow_loopback_(false),
+     receiver_threads_(1) {
 
     // Ensure that PQMs have been created to guarantee we have
     // default packet queues in place.
@@ -285,14 +291,21 @@ void IfaceMgr::closeSockets() {
     BOOST_FOREACH(IfacePtr iface, ifaces_) {
         iface->closeSockets();
     }
+
+    // Drop the packets received from the closed sockets.
+    received4_.clear();
+    received6_.clear();
 }
 
 void IfaceMgr::stopDHCPReceiver() {
-    if (isDHCPReceiverRunning()) {
-        dhcp_receiver_->stop();
+    BOOST_FOREACH(WatchedThreadPtr receiver, dhcp_receivers_) {
+        if (receiver->isRunning()) {
+            receiver->stop();
+        }
     }
 
-    dhcp_receiver_.reset();
+    dhcp_receivers_.clear();
+    fd_event_handler_dirty_ = true;
 
     if (getPacketQueue4()) {
         getPacketQueue4()->clear();
@@ -332,6 +345,7 @@ IfaceMgr::addExternalSocket(int socketfd, SocketCallback callback) {
     x.socket_ = socketfd;
     x.callback_ = callback;
     callbacks_.push_back(x);
+    fd_event_handler_dirty_ = true;
 }
 
 void
@@ -340,6 +354,7 @@ IfaceMgr::deleteExternalSocket(int socketfd) {
          s != callbacks_.end(); ++s) {
         if (s->socket_ == socketfd) {
             callbacks_.erase(s);
+            fd_event_handler_dirty_ = true;
             return;
         }
     }
@@ -365,6 +380,79 @@ IfaceMgr::purgeBadSockets() {
 void
 IfaceMgr::deleteAllExternalSockets() {
     callbacks_.clear();
+    fd_event_handler_dirty_ = true;
+}
+
+void
+IfaceMgr::checkExternalSockets() {
+    if (callbacks_.empty() ||
+        (fd_event_handler_->type() == FDEventHandler::TYPE_SELECT)) {
+        return;
+    }
+    int cnt = purgeBadSockets();
+    if (cnt > 0) {
+        isc_throw(SocketReadError,
+                  "Socket wait interrupted by an invalid socket, purged "
+                  << cnt << " socket descriptors");
+    }
+}
+
+void
+IfaceMgr::checkInterfaceSockets() const {
+    if (fd_event_handler_->type() == FDEventHandler::TYPE_SELECT) {
+        return;
+    }
+    for (auto s : registered_sockets_) {
+        errno = 0;
+        if (fcntl(s.first, F_GETFD) < 0 && (errno == EBADF)) {
+            isc_throw(SocketReadError,
+                      "Socket wait interrupted by an invalid socket "
+                      << s.first << " on interface "
+                      << s.second.first->getName());
+        }
+    }
+}
+
+void
+IfaceMgr::registerSockets(const uint16_t family, const bool indirect) {
+    uint64_t generation = Iface::getSocketsGeneration();
+    if (!fd_event_handler_dirty_ && (registered_generation_ == generation) &&
+        (registered_family_ == family) && (registered_indirect_ == indirect)) {
+        return;
+    }
+
+    fd_event_handler_->clear();
+    registered_sockets_.clear();
+
+    BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
+        fd_event_handler_->add(s.socket_);
+    }
+
+    if (indirect) {
+        BOOST_FOREACH(WatchedThreadPtr receiver, dhcp_receivers_) {
+            // Add Receiver ready watch socket
+            fd_event_handler_->add(receiver->getWatchFd(WatchedThread::READY));
+
+            // Add Receiver error watch socket
+            fd_event_handler_->add(receiver->getWatchFd(WatchedThread::ERROR));
+        }
+    } else {
+        BOOST_FOREACH(IfacePtr iface, ifaces_) {
+            BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
+                // Only deal with the addresses of the family.
+                if ((family == AF_INET) ? s.addr_.isV4() : s.addr_.isV6()) {
+                    fd_event_handler_->add(s.sockfd_);
+                    registered_sockets_.insert(std::make_pair(s.sockfd_,
+                                                              std::make_pair(iface, s)));
+                }
+            }
+        }
+    }
+
+    fd_event_handler_dirty_ = false;
+    registered_generation_ = generation;
+    registered_family_ = family;
+    registered_indirect_ = indirect;
 }
 
 void
@@ -576,7 +664,11 @@ IfaceMgr::openSockets4(const uint16_t port, const bool use_bcast,
                     try {
                         // We haven't open any broadcast sockets yet, so we can
                         // open at least one more.
-                        openSocket(iface->getName(), addr.get(), port, true, true);
+                        if (isReusePortEnabled(AF_INET)) {
+                            openReusePortSockets4(*iface, addr.get(), port, true);
+                        } else {
+                            openSocket(iface->getName(), addr.get(), port, true, true);
+                        }
                     } catch (const Exception& ex) {
                         IFACEMGR_ERROR(SocketConfigError, error_handler,
                                        "failed to open socket on interface "
@@ -594,7 +686,11 @@ IfaceMgr::openSockets4(const uint16_t port, const bool use_bcast,
             } else {
                 try {
                     // Not broadcast capable, do not set broadcast flags.
-                    openSocket(iface->getName(), addr.get(), port, false, false);
+                    if (isReusePortEnabled(AF_INET)) {
+                        openReusePortSockets4(*iface, addr.get(), port, false);
+                    } else {
+                        openSocket(iface->getName(), addr.get(), port, false, false);
+                    }
                 } catch (const Exception& ex) {
                     IFACEMGR_ERROR(SocketConfigError, error_handler,
                                    "failed to open socket on interface "
@@ -659,7 +755,11 @@ IfaceMgr::openSockets6(const uint16_t port,
         BOOST_FOREACH(Iface::Address addr, iface->getUnicasts()) {
 
             try {
-                openSocket(iface->getName(), addr, port);
+                if (isReusePortEnabled(AF_INET6)) {
+                    openReusePortSockets6(*iface, addr, port);
+                } else {
+                    openSocket(iface->getName(), addr, port);
+                }
             } catch (const Exception& ex) {
                 IFACEMGR_ERROR(SocketConfigError, error_handler,
                                "Failed to open unicast socket on  interface "
@@ -719,10 +819,6 @@ IfaceMgr::startDHCPReceiver(const uint16_t family) {
         if(!getPacketQueue4()) {
             return;
         }
-
-        dhcp_receiver_.reset(new WatchedThread());
-        dhcp_receiver_->start(boost::bind(&IfaceMgr::receiveDHCP4Packets, this));
-
         break;
     case AF_INET6:
         // If the queue doesn't exist, packet queing has been configured
@@ -730,14 +826,64 @@ IfaceMgr::startDHCPReceiver(const uint16_t family) {
         if(!getPacketQueue6()) {
             return;
         }
-
-        dhcp_receiver_.reset(new WatchedThread());
-        dhcp_receiver_->start(boost::bind(&IfaceMgr::receiveDHCP6Packets, this));
         break;
     default:
         isc_throw (BadValue, "startDHCPReceiver: invalid family: " << family);
         break;
     }
+
+    // Start one receiver per socket up to the configured number.
+    size_t sockets = 0;
+    BOOST_FOREACH(IfacePtr iface, ifaces_) {
+        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
+            if ((family == AF_INET) ? s.addr_.isV4() : s.addr_.isV6()) {
+                ++sockets;
+            }
+        }
+    }
+    size_t count = receiver_threads_;
+    if (count > sockets) {
+        count = (sockets > 0 ? sockets : 1);
+    }
+
+    fd_event_handler_dirty_ = true;
+    for (size_t i = 0; i < count; ++i) {
+        WatchedThreadPtr receiver(new WatchedThread());
+        dhcp_receivers_.push_back(receiver);
+        if (family == AF_INET) {
+            receiver->start(boost::bind(&IfaceMgr::receiveDHCP4Packets, this,
+                                        receiver, i, count));
+        } else {
+            receiver->start(boost::bind(&IfaceMgr::receiveDHCP6Packets, this,
+                                        receiver, i, count));
+        }
+    }
+}
+
+void
+IfaceMgr::setReceiverThreads(size_t receiver_threads) {
+    if (isDHCPReceiverRunning()) {
+        isc_throw(InvalidOperation, "Cannot change the number of receiver"
+                  " threads while DHCP receiver thread is running");
+    }
+    if ((receiver_threads == 0) ||
+        (receiver_threads > MAX_RECEIVER_THREADS)) {
+        isc_throw(BadValue, "invalid number of receiver threads "
+                  << receiver_threads << ", it must be between 1 and "
+                  << MAX_RECEIVER_THREADS);
+    }
+    receiver_threads_ = receiver_threads;
+}
+
+bool
+IfaceMgr::isReusePortEnabled(const uint16_t family) {
+    if (receiver_threads_ <= 1) {
+        return (false);
+    }
+    if (family == AF_INET) {
+        return (getPacketQueue4() && packet_filter_->isReusePortSupported());
+    }
+    return (getPacketQueue6() && packet_filter6_->isReusePortSupported());
 }
 
 void
@@ -787,6 +933,7 @@ IfaceMgr::getIface(const std::string& ifname) {
 void
 IfaceMgr::clearIfaces() {
     ifaces_.clear();
+    fd_event_handler_dirty_ = true;
 }
 
 void
@@ -965,6 +1112,52 @@ IfaceMgr::openSocket4(Iface& iface, const IOAddress& addr,
     return (info.sockfd_);
 }
 
+void
+IfaceMgr::openReusePortSockets4(Iface& iface, const IOAddress& addr,
+                                const uint16_t port, const bool bcast) {
+    std::vector<int> opened;
+    try {
+        // Broadcast packets are received by all sockets bound to the
+        // "ANY" address so only one is opened.
+        if (bcast) {
+            SocketInfo info = packet_filter_->openReusePortSocket(iface, addr,
+                                                                  port, true,
+                                                                  true);
+            iface.addSocket(info);
+            opened.push_back(info.sockfd_);
+        }
+        // Unicast packets are spread by the kernel among these.
+        for (size_t i = 0; i < receiver_threads_; ++i) {
+            SocketInfo info = packet_filter_->openReusePortSocket(iface, addr,
+                                                                  port, false,
+                                                                  bcast);
+            iface.addSocket(info);
+            opened.push_back(info.sockfd_);
+        }
+    } catch (...) {
+        BOOST_FOREACH(int sockfd, opened) {
+            iface.delSocket(sockfd);
+        }
+        throw;
+    }
+}
+
+void
+IfaceMgr::openReusePortSockets6(Iface& iface, const IOAddress& addr,
+                                const uint16_t port) {
+    std::vector<int> opened;
+    try {
+        for (size_t i = 0; i < receiver_threads_; ++i) {
+            opened.push_back(openSocket6(iface, addr, port, false));
+        }
+    } catch (...) {
+        BOOST_FOREACH(int sockfd, opened) {
+            iface.delSocket(sockfd);
+        }
+        throw;
+    }
+}
+
 bool
 IfaceMgr::send(const Pkt6Ptr& pkt) {
     IfacePtr iface = getIface(pkt->getIface());
@@ -1007,43 +1200,24 @@ Pkt4Ptr IfaceMgr::receive4Indirect(uint32_t timeout_sec, uint32_t timeout_usec /
                   " one million microseconds");
     }
 
-    fd_set sockets;
-    int maxfd = 0;
-
-    FD_ZERO(&sockets);
+    // Detect closed external sockets and register the sockets.
+    checkExternalSockets();
+    registerSockets(AF_INET, true);
 
-    // if there are any callbacks for external sockets registered...
-    if (!callbacks_.empty()) {
-        BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-            addFDtoSet(s.socket_, maxfd, &sockets);
-        }
-    }
-
-    // Add Receiver ready watch socket
-    addFDtoSet(dhcp_receiver_->getWatchFd(WatchedThread::READY), maxfd, &sockets);
-
-    // Add Receiver error watch socket
-    addFDtoSet(dhcp_receiver_->getWatchFd(WatchedThread::ERROR), maxfd, &sockets);
-
-    // Set timeout for our next select() call.  If there are
+    // Set timeout for our next wait call.  If there are
     // no DHCP packets to read, then we'll wait for a finite
     // amount of time for an IO event.  Otherwise, we'll
     // poll (timeout = 0 secs).  We need to poll, even if
     // DHCP packets are waiting so we don't starve external
     // sockets under heavy DHCP load.
-    struct timeval select_timeout;
+    uint32_t wait_sec = 0;
+    uint32_t wait_usec = 0;
     if (getPacketQueue4()->empty()) {
-        select_timeout.tv_sec = timeout_sec;
-        select_timeout.tv_usec = timeout_usec;
-    } else {
-        select_timeout.tv_sec = 0;
-        select_timeout.tv_usec = 0;
+        wait_sec = timeout_sec;
+        wait_usec = timeout_usec;
     }
 
-    // zero out the errno to be safe
-    errno = 0;
-
-    int result = select(maxfd + 1, &sockets, NULL, NULL, &select_timeout);
+    int result = fd_event_handler_->waitEvent(wait_sec, wait_usec);
 
     if ((result == 0) && getPacketQueue4()->empty()) {
         // nothing received and timeout has been reached
@@ -1061,25 +1235,27 @@ Pkt4Ptr IfaceMgr::receive4Indirect(uint32_t timeout_sec, uint32_t timeout_usec /
         } else if (errno == EBADF) {
             int cnt = purgeBadSockets();
             isc_throw(SocketReadError,
-                      "SELECT interrupted by one invalid sockets, purged "
+                      "Socket wait interrupted by an invalid socket, purged "
                        << cnt << " socket descriptors");
         } else {
             isc_throw(SocketReadError, strerror(errno));
         }
     }
 
-    // We only check external sockets if select detected an event.
+    // We only check external sockets if an event was detected.
     if (result > 0) {
         // Check for receiver thread read errors.
-        if (dhcp_receiver_->isReady(WatchedThread::ERROR)) {
-            string msg = dhcp_receiver_->getLastError();
-            dhcp_receiver_->clearReady(WatchedThread::ERROR);
-            isc_throw(SocketReadError, msg);
+        BOOST_FOREACH(WatchedThreadPtr receiver, dhcp_receivers_) {
+            if (receiver->isReady(WatchedThread::ERROR)) {
+                string msg = receiver->getLastError();
+                receiver->clearReady(WatchedThread::ERROR);
+                isc_throw(SocketReadError, msg);
+            }
         }
 
         // Let's find out which external socket has the data
         BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-            if (!FD_ISSET(s.socket_, &sockets)) {
+            if (!fd_event_handler_->readReady(s.socket_)) {
                 continue;
             }
 
@@ -1099,7 +1275,9 @@ Pkt4Ptr IfaceMgr::receive4Indirect(uint32_t timeout_sec, uint32_t timeout_usec /
     // If we're here it should only be because there are DHCP packets waiting.
     Pkt4Ptr pkt = getPacketQueue4()->dequeuePacket();
     if (!pkt) {
-        dhcp_receiver_->clearReady(WatchedThread::READY);
+        BOOST_FOREACH(WatchedThreadPtr receiver, dhcp_receivers_) {
+            receiver->clearReady(WatchedThread::READY);
+        }
     }
 
     return (pkt);
@@ -1111,42 +1289,23 @@ Pkt4Ptr IfaceMgr::receive4Direct(uint32_t timeout_sec, uint32_t timeout_usec /*
         isc_throw(BadValue, "fractional timeout must be shorter than"
                   " one million microseconds");
     }
-    boost::scoped_ptr<SocketInfo> candidate;
-    IfacePtr iface;
-    fd_set sockets;
-    int maxfd = 0;
-
-    FD_ZERO(&sockets);
-
-    /// @todo: marginal performance optimization. We could create the set once
-    /// and then use its copy for select(). Please note that select() modifies
-    /// provided set to indicated which sockets have something to read.
-    BOOST_FOREACH(iface, ifaces_) {
-        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
-            // Only deal with IPv4 addresses.
-            if (s.addr_.isV4()) {
-                // Add this socket to listening set
-                addFDtoSet(s.sockfd_, maxfd, &sockets);
-            }
-        }
-    }
 
-    // if there are any callbacks for external sockets registered...
-    if (!callbacks_.empty()) {
-        BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-            // Add this socket to listening set
-            addFDtoSet(s.socket_, maxfd, &sockets);
-        }
+    // Return the packets remaining from the last batch first.
+    if (!received4_.empty()) {
+        Pkt4Ptr pkt = received4_.front();
+        received4_.pop_front();
+        return (pkt);
     }
 
-    struct timeval select_timeout;
-    select_timeout.tv_sec = timeout_sec;
-    select_timeout.tv_usec = timeout_usec;
+    boost::scoped_ptr<SocketInfo> candidate;
+    IfacePtr iface;
 
-    // zero out the errno to be safe
-    errno = 0;
+    // Detect closed sockets and register the sockets.
+    checkExternalSockets();
+    registerSockets(AF_INET, false);
+    checkInterfaceSockets();
 
-    int result = select(maxfd + 1, &sockets, NULL, NULL, &select_timeout);
+    int result = fd_event_handler_->waitEvent(timeout_sec, timeout_usec);
 
     if (result == 0) {
         // nothing received and timeout has been reached
@@ -1165,7 +1324,7 @@ Pkt4Ptr IfaceMgr::receive4Direct(uint32_t timeout_sec, uint32_t timeout_usec /*
         } else if (errno == EBADF) {
             int cnt = purgeBadSockets();
             isc_throw(SocketReadError,
-                      "SELECT interrupted by one invalid sockets, purged "
+                      "Socket wait interrupted by an invalid socket, purged "
                        << cnt << " socket descriptors");
         } else {
             isc_throw(SocketReadError, strerror(errno));
@@ -1174,7 +1333,7 @@ Pkt4Ptr IfaceMgr::receive4Direct(uint32_t timeout_sec, uint32_t timeout_usec /*
 
     // Let's find out which socket has the data
     BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-        if (!FD_ISSET(s.socket_, &sockets)) {
+        if (!fd_event_handler_->readReady(s.socket_)) {
             continue;
         }
 
@@ -1191,14 +1350,11 @@ Pkt4Ptr IfaceMgr::receive4Direct(uint32_t timeout_sec, uint32_t timeout_usec /*
     }
 
     // Let's find out which interface/socket has the data
-    BOOST_FOREACH(iface, ifaces_) {
-        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
-            if (FD_ISSET(s.sockfd_, &sockets)) {
-                candidate.reset(new SocketInfo(s));
-                break;
-            }
-        }
-        if (candidate) {
+    BOOST_FOREACH(int fd, fd_event_handler_->getReadyFds()) {
+        SocketsByDescriptor::const_iterator s = registered_sockets_.find(fd);
+        if (s != registered_sockets_.end()) {
+            iface = s->second.first;
+            candidate.reset(new SocketInfo(s->second.second));
             break;
         }
     }
@@ -1209,7 +1365,13 @@ Pkt4Ptr IfaceMgr::receive4Direct(uint32_t timeout_sec, uint32_t timeout_usec /*
 
     // Now we have a socket, let's get some data from it!
     // Assuming that packet filter is not NULL, because its modifier checks it.
-    return (packet_filter_->receive(*iface, *candidate));
+    std::vector<Pkt4Ptr> pkts;
+    packet_filter_->receiveBatch(*iface, *candidate, pkts, RCVBATCHSIZE);
+    if (pkts.empty()) {
+        return (Pkt4Ptr());
+    }
+    received4_.insert(received4_.end(), pkts.begin() + 1, pkts.end());
+    return (pkts.front());
 }
 
 Pkt6Ptr
@@ -1241,41 +1403,22 @@ IfaceMgr::receive6Direct(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */ )
                   " one million microseconds");
     }
 
-    boost::scoped_ptr<SocketInfo> candidate;
-    fd_set sockets;
-    int maxfd = 0;
-
-    FD_ZERO(&sockets);
-
-    /// @todo: marginal performance optimization. We could create the set once
-    /// and then use its copy for select(). Please note that select() modifies
-    /// provided set to indicated which sockets have something to read.
-    BOOST_FOREACH(IfacePtr iface, ifaces_) {
-        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
-            // Only deal with IPv6 addresses.
-            if (s.addr_.isV6()) {
-                // Add this socket to listening set
-                addFDtoSet(s.sockfd_, maxfd, &sockets);
-            }
-        }
-    }
-
-    // if there are any callbacks for external sockets registered...
-    if (!callbacks_.empty()) {
-        BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-            // Add it to the set as well
-            addFDtoSet(s.socket_, maxfd, &sockets);
-        }
+    // Return the packets remaining from the last batch first.
+    if (!received6_.empty()) {
+        Pkt6Ptr pkt = received6_.front();
+        received6_.pop_front();
+        return (pkt);
     }
 
-    struct timeval select_timeout;
-    select_timeout.tv_sec = timeout_sec;
-    select_timeout.tv_usec = timeout_usec;
+    boost::scoped_ptr<SocketInfo> candidate;
+    IfacePtr iface;
 
-    // zero out the errno to be safe
-    errno = 0;
+    // Detect closed sockets and register the sockets.
+    checkExternalSockets();
+    registerSockets(AF_INET6, false);
+    checkInterfaceSockets();
 
-    int result = select(maxfd + 1, &sockets, NULL, NULL, &select_timeout);
+    int result = fd_event_handler_->waitEvent(timeout_sec, timeout_usec);
 
     if (result == 0) {
         // nothing received and timeout has been reached
@@ -1294,7 +1437,7 @@ IfaceMgr::receive6Direct(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */ )
         } else if (errno == EBADF) {
             int cnt = purgeBadSockets();
             isc_throw(SocketReadError,
-                      "SELECT interrupted by one invalid sockets, purged "
+                      "Socket wait interrupted by an invalid socket, purged "
                        << cnt << " socket descriptors");
         } else {
             isc_throw(SocketReadError, strerror(errno));
@@ -1303,7 +1446,7 @@ IfaceMgr::receive6Direct(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */ )
 
     // Let's find out which socket has the data
     BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-        if (!FD_ISSET(s.socket_, &sockets)) {
+        if (!fd_event_handler_->readReady(s.socket_)) {
             continue;
         }
 
@@ -1320,14 +1463,11 @@ IfaceMgr::receive6Direct(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */ )
     }
 
     // Let's find out which interface/socket has the data
-    BOOST_FOREACH(IfacePtr iface, ifaces_) {
-        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
-            if (FD_ISSET(s.sockfd_, &sockets)) {
-                candidate.reset(new SocketInfo(s));
-                break;
-            }
-        }
-        if (candidate) {
+    BOOST_FOREACH(int fd, fd_event_handler_->getReadyFds()) {
+        SocketsByDescriptor::const_iterator s = registered_sockets_.find(fd);
+        if (s != registered_sockets_.end()) {
+            iface = s->second.first;
+            candidate.reset(new SocketInfo(s->second.second));
             break;
         }
     }
@@ -1336,7 +1476,13 @@ IfaceMgr::receive6Direct(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */ )
         isc_throw(SocketReadError, "received data over unknown socket");
     }
     // Assuming that packet filter is not NULL, because its modifier checks it.
-    return (packet_filter6_->receive(*candidate));
+    std::vector<Pkt6Ptr> pkts;
+    packet_filter6_->receiveBatch(*candidate, pkts, RCVBATCHSIZE);
+    if (pkts.empty()) {
+        return (Pkt6Ptr());
+    }
+    received6_.insert(received6_.end(), pkts.begin() + 1, pkts.end());
+    return (pkts.front());
 }
 
 Pkt6Ptr
@@ -1347,44 +1493,24 @@ IfaceMgr::receive6Indirect(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
                   " one million microseconds");
     }
 
-    fd_set sockets;
-    int maxfd = 0;
-
-    FD_ZERO(&sockets);
+    // Detect closed external sockets and register the sockets.
+    checkExternalSockets();
+    registerSockets(AF_INET6, true);
 
-    // if there are any callbacks for external sockets registered...
-    if (!callbacks_.empty()) {
-        BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-            // Add it to the set as well
-            addFDtoSet(s.socket_, maxfd, &sockets);
-        }
-    }
-
-    // Add Receiver ready watch socket
-    addFDtoSet(dhcp_receiver_->getWatchFd(WatchedThread::READY), maxfd, &sockets);
-
-    // Add Receiver error watch socket
-    addFDtoSet(dhcp_receiver_->getWatchFd(WatchedThread::ERROR), maxfd, &sockets);
-
-    // Set timeout for our next select() call.  If there are
+    // Set timeout for our next wait call.  If there are
     // no DHCP packets to read, then we'll wait for a finite
     // amount of time for an IO event.  Otherwise, we'll
     // poll (timeout = 0 secs).  We need to poll, even if
     // DHCP packets are waiting so we don't starve external
     // sockets under heavy DHCP load.
-    struct timeval select_timeout;
+    uint32_t wait_sec = 0;
+    uint32_t wait_usec = 0;
     if (getPacketQueue6()->empty()) {
-        select_timeout.tv_sec = timeout_sec;
-        select_timeout.tv_usec = timeout_usec;
-    } else {
-        select_timeout.tv_sec = 0;
-        select_timeout.tv_usec = 0;
+        wait_sec = timeout_sec;
+        wait_usec = timeout_usec;
     }
 
-    // zero out the errno to be safe
-    errno = 0;
-
-    int result = select(maxfd + 1, &sockets, NULL, NULL, &select_timeout);
+    int result = fd_event_handler_->waitEvent(wait_sec, wait_usec);
 
     if ((result == 0) && getPacketQueue6()->empty()) {
         // nothing received and timeout has been reached
@@ -1402,25 +1528,27 @@ IfaceMgr::receive6Indirect(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         } else if (errno == EBADF) {
             int cnt = purgeBadSockets();
             isc_throw(SocketReadError,
-                      "SELECT interrupted by one invalid sockets, purged "
+                      "Socket wait interrupted by an invalid socket, purged "
                        << cnt << " socket descriptors");
         } else {
             isc_throw(SocketReadError, strerror(errno));
         }
     }
 
-    // We only check external sockets if select detected an event.
+    // We only check external sockets if an event was detected.
     if (result > 0) {
         // Check for receiver thread read errors.
-        if (dhcp_receiver_->isReady(WatchedThread::ERROR)) {
-            string msg = dhcp_receiver_->getLastError();
-            dhcp_receiver_->clearReady(WatchedThread::ERROR);
-            isc_throw(SocketReadError, msg);
+        BOOST_FOREACH(WatchedThreadPtr receiver, dhcp_receivers_) {
+            if (receiver->isReady(WatchedThread::ERROR)) {
+                string msg = receiver->getLastError();
+                receiver->clearReady(WatchedThread::ERROR);
+                isc_throw(SocketReadError, msg);
+            }
         }
 
         // Let's find out which external socket has the data
         BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-            if (!FD_ISSET(s.socket_, &sockets)) {
+            if (!fd_event_handler_->readReady(s.socket_)) {
                 continue;
             }
 
@@ -1440,51 +1568,60 @@ IfaceMgr::receive6Indirect(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     // If we're here it should only be because there are DHCP packets waiting.
     Pkt6Ptr pkt = getPacketQueue6()->dequeuePacket();
     if (!pkt) {
-        dhcp_receiver_->clearReady(WatchedThread::READY);
+        BOOST_FOREACH(WatchedThreadPtr receiver, dhcp_receivers_) {
+            receiver->clearReady(WatchedThread::READY);
+        }
     }
 
     return (pkt);
 }
 
 void
-IfaceMgr::receiveDHCP4Packets() {
-    IfacePtr iface;
-    fd_set sockets;
-    int maxfd = 0;
+IfaceMgr::receiveDHCP4Packets(const WatchedThreadPtr& receiver,
+                              size_t index, size_t count) {
+    FDEventHandlerPtr handler;
+    SocketsByDescriptor sockets;
 
-    FD_ZERO(&sockets);
+    try {
+        handler = createFDEventHandler();
 
-    // Add terminate watch socket.
-    addFDtoSet(dhcp_receiver_->getWatchFd(WatchedThread::TERMINATE), maxfd, &sockets);
+        // Add terminate watch socket.
+        handler->add(receiver->getWatchFd(WatchedThread::TERMINATE));
 
-    // Add Interface sockets.
-    BOOST_FOREACH(iface, ifaces_) {
-        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
-            // Only deal with IPv4 addresses.
-            if (s.addr_.isV4()) {
-                // Add this socket to listening set.
-                addFDtoSet(s.sockfd_, maxfd, &sockets);
+        // Add Interface sockets.
+        size_t rank = 0;
+        BOOST_FOREACH(IfacePtr iface, ifaces_) {
+            BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
+                // Only deal with IPv4 addresses.
+                if (s.addr_.isV4()) {
+                    // Leave the socket to another receiver.
+                    if (rank++ % count != index) {
+                        continue;
+                    }
+                    // Add this socket to listening set.
+                    handler->add(s.sockfd_);
+                    sockets.insert(std::make_pair(s.sockfd_,
+                                                  std::make_pair(iface, s)));
+                }
             }
         }
+    } catch (const std::exception& ex) {
+        // Signal the error to receive4.
+        receiver->setError(ex.what());
+        return;
     }
 
     for (;;) {
         // Check the watch socket.
-        if (dhcp_receiver_->shouldTerminate()) {
+        if (receiver->shouldTerminate()) {
             return;
         }
 
-        fd_set rd_set;
-        FD_COPY(&sockets, &rd_set);
-
-        // zero out the errno to be safe.
-        errno = 0;
-
-        // Select with null timeouts to wait indefinetly an event
-        int result = select(maxfd + 1, &rd_set, 0, 0, 0);
+        // Wait indefinitely for an event.
+        int result = handler->waitEvent(0, 0, false);
 
         // Re-check the watch socket.
-        if (dhcp_receiver_->shouldTerminate()) {
+        if (receiver->shouldTerminate()) {
             return;
         }
 
@@ -1496,7 +1633,7 @@ IfaceMgr::receiveDHCP4Packets() {
             // This thread should not get signals?
             if (errno != EINTR) {
                 // Signal the error to receive4.
-                dhcp_receiver_->setError(strerror(errno));
+                receiver->setError(strerror(errno));
                 // We need to sleep in case of the error condition to
                 // prevent the thread from tight looping when result
                 // gets negative.
@@ -1506,15 +1643,15 @@ IfaceMgr::receiveDHCP4Packets() {
         }
 
         // Let's find out which interface/socket has data.
-        BOOST_FOREACH(iface, ifaces_) {
-            BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
-                if (FD_ISSET(s.sockfd_, &sockets)) {
-                    receiveDHCP4Packet(*iface, s);
-                    // Can take time so check one more time the watch socket.
-                    if (dhcp_receiver_->shouldTerminate()) {
-                        return;
-                    }
-                }
+        BOOST_FOREACH(int fd, handler->getReadyFds()) {
+            SocketsByDescriptor::const_iterator s = sockets.find(fd);
+            if (s == sockets.end()) {
+                continue;
+            }
+            receiveDHCP4Packet(*receiver, *s->second.first, s->second.second);
+            // Can take time so check one more time the watch socket.
+            if (receiver->shouldTerminate()) {
+                return;
             }
         }
     }
@@ -1522,44 +1659,51 @@ IfaceMgr::receiveDHCP4Packets() {
 }
 
 void
-IfaceMgr::receiveDHCP6Packets() {
-    IfacePtr iface;
-    fd_set sockets;
-    int maxfd = 0;
+IfaceMgr::receiveDHCP6Packets(const WatchedThreadPtr& receiver,
+                              size_t index, size_t count) {
+    FDEventHandlerPtr handler;
+    SocketsByDescriptor sockets;
 
-    FD_ZERO(&sockets);
+    try {
+        handler = createFDEventHandler();
 
-    // Add terminate watch socket.
-    addFDtoSet(dhcp_receiver_->getWatchFd(WatchedThread::TERMINATE), maxfd, &sockets);
+        // Add terminate watch socket.
+        handler->add(receiver->getWatchFd(WatchedThread::TERMINATE));
 
-    // Add Interface sockets.
-    BOOST_FOREACH(iface, ifaces_) {
-        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
-            // Only deal with IPv6 addresses.
-            if (s.addr_.isV6()) {
-                // Add this socket to listening set.
-                addFDtoSet(s.sockfd_ , maxfd, &sockets);
+        // Add Interface sockets.
+        size_t rank = 0;
+        BOOST_FOREACH(IfacePtr iface, ifaces_) {
+            BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
+                // Only deal with IPv6 addresses.
+                if (s.addr_.isV6()) {
+                    // Leave the socket to another receiver.
+                    if (rank++ % count != index) {
+                        continue;
+                    }
+                    // Add this socket to listening set.
+                    handler->add(s.sockfd_);
+                    sockets.insert(std::make_pair(s.sockfd_,
+                                                  std::make_pair(iface, s)));
+                }
             }
         }
+    } catch (const std::exception& ex) {
+        // Signal the error to receive6.
+        receiver->setError(ex.what());
+        return;
     }
 
     for (;;) {
         // Check the watch socket.
-        if (dhcp_receiver_->shouldTerminate()) {
+        if (receiver->shouldTerminate()) {
             return;
         }
 
-        fd_set rd_set;
-        FD_COPY(&sockets, &rd_set);
-
-        // zero out the errno to be safe.
-        errno = 0;
-
-        // Note we wait until something happen.
-        int result = select(maxfd + 1, &rd_set, 0, 0, 0);
+        // Wait indefinitely for an event.
+        int result = handler->waitEvent(0, 0, false);
 
         // Re-check the watch socket.
-        if (dhcp_receiver_->shouldTerminate()) {
+        if (receiver->shouldTerminate()) {
             return;
         }
 
@@ -1570,7 +1714,7 @@ IfaceMgr::receiveDHCP6Packets() {
             // This thread should not get signals?
             if (errno != EINTR) {
                 // Signal the error to receive6.
-                dhcp_receiver_->setError(strerror(errno));
+                receiver->setError(strerror(errno));
                 // We need to sleep in case of the error condition to
                 // prevent the thread from tight looping when result
                 // gets negative.
@@ -1580,28 +1724,29 @@ IfaceMgr::receiveDHCP6Packets() {
         }
 
         // Let's find out which interface/socket has data.
-        BOOST_FOREACH(iface, ifaces_) {
-            BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
-                if (FD_ISSET(s.sockfd_, &sockets)) {
-                    receiveDHCP6Packet(s);
-                    // Can take time so check one more time the watch socket.
-                    if (dhcp_receiver_->shouldTerminate()) {
-                        return;
-                    }
-                }
+        BOOST_FOREACH(int fd, handler->getReadyFds()) {
+            SocketsByDescriptor::const_iterator s = sockets.find(fd);
+            if (s == sockets.end()) {
+                continue;
+            }
+            receiveDHCP6Packet(*receiver, s->second.second);
+            // Can take time so check one more time the watch socket.
+            if (receiver->shouldTerminate()) {
+                return;
             }
         }
     }
 }
 
 void
-IfaceMgr::receiveDHCP4Packet(Iface& iface, const SocketInfo& socket_info) {
+IfaceMgr::receiveDHCP4Packet(WatchedThread& receiver, Iface& iface,
+                             const SocketInfo& socket_info) {
     int len;
 
     int result = ioctl(socket_info.sockfd_, FIONREAD, &len);
     if (result < 0) {
         // Signal the error to receive4.
-        dhcp_receiver_->setError(strerror(errno));
+        receiver.setError(strerror(errno));
         return;
     }
     if (len == 0) {
@@ -1609,30 +1754,33 @@ IfaceMgr::receiveDHCP4Packet(Iface& iface, const SocketInfo& socket_info) {
         return;
     }
 
-    Pkt4Ptr pkt;
+    std::vector<Pkt4Ptr> pkts;
 
     try {
-        pkt = packet_filter_->receive(iface, socket_info);
+        packet_filter_->receiveBatch(iface, socket_info, pkts, RCVBATCHSIZE);
     } catch (const std::exception& ex) {
-        dhcp_receiver_->setError(strerror(errno));
+        receiver.setError(strerror(errno));
     } catch (...) {
-        dhcp_receiver_->setError("packet filter receive() failed");
+        receiver.setError("packet filter receiveBatch() failed");
     }
 
-    if (pkt) {
-        getPacketQueue4()->enqueuePacket(pkt, socket_info);
-        dhcp_receiver_->markReady(WatchedThread::READY);
+    if (!pkts.empty()) {
+        BOOST_FOREACH(Pkt4Ptr pkt, pkts) {
+            getPacketQueue4()->enqueuePacket(pkt, socket_info);
+        }
+        receiver.markReady(WatchedThread::READY);
     }
 }
 
 void
-IfaceMgr::receiveDHCP6Packet(const SocketInfo& socket_info) {
+IfaceMgr::receiveDHCP6Packet(WatchedThread& receiver,
+                             const SocketInfo& socket_info) {
     int len;
 
     int result = ioctl(socket_info.sockfd_, FIONREAD, &len);
     if (result < 0) {
         // Signal the error to receive6.
-        dhcp_receiver_->setError(strerror(errno));
+        receiver.setError(strerror(errno));
         return;
     }
     if (len == 0) {
@@ -1640,19 +1788,21 @@ IfaceMgr::receiveDHCP6Packet(const SocketInfo& socket_info) {
         return;
     }
 
-    Pkt6Ptr pkt;
+    std::vector<Pkt6Ptr> pkts;
 
     try {
-        pkt = packet_filter6_->receive(socket_info);
+        packet_filter6_->receiveBatch(socket_info, pkts, RCVBATCHSIZE);
     } catch (const std::exception& ex) {
-        dhcp_receiver_->setError(ex.what());
+        receiver.setError(ex.what());
     } catch (...) {
-        dhcp_receiver_->setError("packet filter receive() failed");
+        receiver.setError("packet filter receiveBatch() failed");
     }
 
-    if (pkt) {
-        getPacketQueue6()->enqueuePacket(pkt, socket_info);
-        dhcp_receiver_->markReady(WatchedThread::READY);
+    if (!pkts.empty()) {
+        BOOST_FOREACH(Pkt6Ptr pkt, pkts) {
+            getPacketQueue6()->enqueuePacket(pkt, socket_info);
+        }
+        receiver.markReady(WatchedThread::READY);
     }
 }
 
@@ -1763,6 +1913,26 @@ IfaceMgr::configureDHCPPacketQueue(uint16_t family, data::ConstElementPtr queue_
         }
     }
 
+    // The number of receiver threads is an option of the queue.
+    size_t receiver_threads = 1;
+    if (enable_queue) {
+        data::ConstElementPtr elem = queue_control->get("receiver-threads");
+        if (elem) {
+            if (elem->getType() != data::Element::integer) {
+                isc_throw(BadValue, "receiver-threads must be an integer");
+            }
+            int64_t value = elem->intValue();
+            if ((value < 1) ||
+                (value > static_cast<int64_t>(MAX_RECEIVER_THREADS))) {
+                isc_throw(BadValue, "invalid receiver-threads " << value
+                          << ", it must be between 1 and "
+                          << MAX_RECEIVER_THREADS);
+            }
+            receiver_threads = static_cast<size_t>(value);
+        }
+    }
+    receiver_threads_ = receiver_threads;
+
     if (enable_queue) {
         // Try to create the queue as configured.
         if (family == AF_INET) {
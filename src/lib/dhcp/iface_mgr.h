@@ -16,6 +16,7 @@
 #include <dhcp/packet_queue_mgr6.h>
 #include <dhcp/pkt_filter.h>
 #include <dhcp/pkt_filter6.h>
+#include <util/fd_event_handler.h>
 #include <util/optional.h>
 #include <util/watch_socket.h>
 #include <util/watched_thread.h>
@@ -25,7 +26,9 @@
 #include <boost/scoped_array.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
 #include <list>
+#include <unordered_map>
 #include <vector>
 
 namespace isc {
@@ -312,6 +315,7 @@ public:
     /// @param sock SocketInfo structure that describes socket.
     void addSocket(const SocketInfo& sock) {
         sockets_.push_back(sock);
+        ++sockets_generation_;
     }
 
     /// @brief Closes socket.
@@ -387,10 +391,22 @@ public:
         read_buffer_.resize(new_size);
     }
 
+    /// @brief Returns the generation of the sockets of all interfaces.
+    ///
+    /// The generation is incremented when a socket is added to or
+    /// removed from any interface, so the @c IfaceMgr knows when it
+    /// must register the sockets again for the event wait.
+    static uint64_t getSocketsGeneration() {
+        return (sockets_generation_);
+    }
+
 protected:
     /// Socket used to send data.
     SocketCollection sockets_;
 
+    /// Generation of the sockets of all interfaces.
+    static std::atomic<uint64_t> sockets_generation_;
+
     /// Network interface name.
     std::string name_;
 
@@ -502,6 +518,16 @@ public:
     /// we don't support packets larger than 1500.
     static const uint32_t RCVBUFSIZE = 1500;
 
+    /// @brief Maximum number of packets received from a socket at once
+    ///
+    /// When a socket is ready the packets already waiting on it are
+    /// received together (see @c PktFilter::receiveBatch), saving a
+    /// select() and a system call per packet under load.
+    static const size_t RCVBATCHSIZE = 32;
+
+    /// Maximum number of DHCP packet receiver threads.
+    static const size_t MAX_RECEIVER_THREADS = 64;
+
     // TODO performance improvement: we may change this into
     //      2 maps (ifindex-indexed and name-indexed) and
     //      also hide it (make it public make tests easier for now)
@@ -1005,6 +1031,7 @@ public:
     /// from unit tests.
     void addInterface(const IfacePtr& iface) {
         ifaces_.push_back(iface);
+        fd_event_handler_dirty_ = true;
     }
 
     /// @brief Checks if there is at least one socket of the specified family
@@ -1066,7 +1093,9 @@ public:
     ///
     /// Starts the DHCP packet receiver thread for the given.
     /// protocol, AF_NET or AF_INET6, if the packet queue
-    /// exists, otherwise it simply returns.
+    /// exists, otherwise it simply returns. One thread is started per
+    /// socket of the family up to the number set by
+    /// @c setReceiverThreads.
     ///
     /// @param family indicates which receiver to start,
     /// (AF_INET or AF_INET6)
@@ -1076,16 +1105,41 @@ public:
 
     /// @brief Stops the DHCP packet receiver.
     ///
-    /// If the thread exists, it is stopped, deleted, and
+    /// If the threads exist, they are stopped, deleted, and
     /// the packet queue is flushed.
     void stopDHCPReceiver();
 
     /// @brief Returns true if there is a receiver exists and its
     /// thread is currently running.
     bool isDHCPReceiverRunning() const {
-        return (dhcp_receiver_ != 0 && dhcp_receiver_->isRunning());
+        return (!dhcp_receivers_.empty() && dhcp_receivers_[0]->isRunning());
     }
 
+    /// @brief Returns the number of running DHCP packet receiver threads.
+    size_t getDHCPReceiverCount() const {
+        return (dhcp_receivers_.size());
+    }
+
+    /// @brief Returns the maximum number of DHCP packet receiver threads.
+    size_t getReceiverThreads() const {
+        return (receiver_threads_);
+    }
+
+    /// @brief Sets the maximum number of DHCP packet receiver threads.
+    ///
+    /// When it is greater than one and the packet filter supports it,
+    /// @c openSockets4 and @c openSockets6 open as many sockets per
+    /// unicast address, all bound with the SO_REUSEPORT option so as the
+    /// kernel spreads the traffic among them, and @c startDHCPReceiver
+    /// starts one receiver thread per socket up to this number. It has
+    /// effect only when packet queueing is enabled.
+    ///
+    /// @param receiver_threads the number of receiver threads.
+    /// @throw BadValue if the number is zero or greater than
+    /// @c MAX_RECEIVER_THREADS.
+    /// @throw InvalidOperation if the receiver thread is currently running.
+    void setReceiverThreads(size_t receiver_threads);
+
     /// @brief Configures DHCP packet queue
     ///
     /// If the given configuration enables packet queueing, then the
@@ -1097,8 +1151,13 @@ public:
     /// (AF_INET or AF_INET6)
     /// @param queue_control configuration containing "dhcp-queue-control"
     /// content
+    /// The optional "receiver-threads" entry sets the maximum number of
+    /// receiver threads, see @c setReceiverThreads. It is reset to one
+    /// when queueing is disabled.
+    ///
     /// @return true if packet queueuing has been enabled, false otherwise
     /// @throw InvalidOperation if the receiver thread is currently running.
+    /// @throw BadValue if the "receiver-threads" value is invalid.
     bool configureDHCPPacketQueue(const uint16_t family,
                                   data::ConstElementPtr queue_control);
 
@@ -1111,6 +1170,12 @@ public:
     /// @throw BadValue if sockets is null
     static void addFDtoSet(int fd, int& maxfd, fd_set* sockets);
 
+    /// @brief Returns the type of the event handler used to wait for
+    /// packets and external socket events.
+    util::FDEventHandler::HandlerType getFDEventHandlerType() const {
+        return (fd_event_handler_->type());
+    }
+
     // don't use private, we need derived classes in tests
 protected:
 
@@ -1137,6 +1202,34 @@ protected:
                     const uint16_t port, const bool receive_bcast = false,
                     const bool send_bcast = false);
 
+    /// @brief Checks if several sockets are opened per unicast address.
+    ///
+    /// @param family the socket family (AF_INET or AF_INET6).
+    /// @return true if more than one receiver thread is configured,
+    /// packet queueing is enabled and the packet filter supports the
+    /// SO_REUSEPORT option.
+    bool isReusePortEnabled(const uint16_t family);
+
+    /// @brief Opens the IPv4 sockets sharing an address.
+    ///
+    /// Opens one socket per receiver thread bound to the address, and
+    /// when broadcast traffic is to be received, one more socket bound to
+    /// the "ANY" address and the interface. Broadcast packets are
+    /// delivered to every socket which can receive them so the broadcast
+    /// socket is not replicated. All sockets are opened with the
+    /// SO_REUSEPORT option. If a socket fails to open, the sockets
+    /// already opened by this call are closed.
+    ///
+    /// @param iface reference to interface structure.
+    /// @param addr an address the created sockets should be bound to
+    /// @param port a port that created sockets should be bound to
+    /// @param bcast configure sockets to receive and send broadcast
+    /// messages.
+    /// @throw isc::dhcp::SocketConfigError if a socket fails to open.
+    void openReusePortSockets4(Iface& iface,
+                               const isc::asiolink::IOAddress& addr,
+                               const uint16_t port, const bool bcast);
+
     /// @brief Receive IPv4 packets directly or data from external sockets.
     ///
     /// Attempts to receive a single DHCPv4 message over any of the open
@@ -1198,6 +1291,20 @@ protected:
     int openSocket6(Iface& iface, const isc::asiolink::IOAddress& addr,
                     uint16_t port, const bool join_multicast);
 
+    /// @brief Opens the IPv6 sockets sharing a unicast address.
+    ///
+    /// Opens one socket per receiver thread bound to the address. If
+    /// a socket fails to open, the sockets already opened by this call
+    /// are closed.
+    ///
+    /// @param iface reference to interface structure.
+    /// @param addr an address the created sockets should be bound to
+    /// @param port a port that created sockets should be bound to
+    /// @throw isc::dhcp::SocketConfigError if a socket fails to open.
+    void openReusePortSockets6(Iface& iface,
+                               const isc::asiolink::IOAddress& addr,
+                               const uint16_t port);
+
     /// @brief Receive IPv6 packets directly or data from external sockets.
     ///
     /// Attempts to receive a single DHCPv6 message over any of the open
@@ -1314,45 +1421,97 @@ private:
     /// Loops forever reading DHCPv4 packets from the interface sockets
     /// and adds them to the packet queue.  It monitors the "terminate"
     /// watch socket, and exits if it is marked ready.  This is method
-    /// is used as the worker function in the thread created by @c
-    /// startDHCP4Receiver().  It currently uses select() to monitor
-    /// socket readiness.  If the select errors out (other than EINTR),
-    /// it marks the "error" watch socket as ready.
-    void receiveDHCP4Packets();
+    /// is used as the worker function in the threads created by @c
+    /// startDHCPReceiver().  Each thread handles the sockets whose rank
+    /// among the IPv4 sockets modulo the number of threads is its index.
+    /// If waiting for an event errors out (other than EINTR), it marks
+    /// the "error" watch socket as ready.
+    ///
+    /// @param receiver the receiver thread running the method.
+    /// @param index the index of the receiver thread.
+    /// @param count the number of receiver threads.
+    void receiveDHCP4Packets(const isc::util::WatchedThreadPtr& receiver,
+                             size_t index, size_t count);
 
-    /// @brief Receives a single DHCPv4 packet from an interface socket
+    /// @brief Receives DHCPv4 packets from an interface socket
     ///
     /// Called by @c receiveDHPC4Packets when a socket fd is flagged as
-    /// ready. It uses the DHCPv4 packet filter to receive a single packet
-    /// from the given interface socket, adds it to the packet queue, and
-    /// marks the "receive" watch socket ready. If an error occurs during
+    /// ready. It uses the DHCPv4 packet filter to receive a batch of
+    /// packets from the given interface socket, adds them to the packet
+    /// queue, and marks the "receive" watch socket ready. If an error occurs during
     /// the read, the "error" watch socket is marked ready.
     ///
+    /// @param receiver the receiver thread.
     /// @param iface interface
     /// @param socket_info structure holding socket information
-    void receiveDHCP4Packet(Iface& iface, const SocketInfo& socket_info);
+    void receiveDHCP4Packet(isc::util::WatchedThread& receiver, Iface& iface,
+                            const SocketInfo& socket_info);
 
     /// @brief DHCPv6 receiver method.
     ///
     /// Loops forever reading DHCPv6 packets from the interface sockets
     /// and adds them to the packet queue.  It monitors the "terminate"
     /// watch socket, and exits if it is marked ready.  This is method
-    /// is used as the worker function in the thread created by @c
-    /// startDHCP6Receiver().  It currently uses select() to monitor
-    /// socket readiness.  If the select errors out (other than EINTR),
-    /// it marks the "error" watch socket as ready.
-    void receiveDHCP6Packets();
+    /// is used as the worker function in the threads created by @c
+    /// startDHCPReceiver().  Each thread handles the sockets whose rank
+    /// among the IPv6 sockets modulo the number of threads is its index.
+    /// If waiting for an event errors out (other than EINTR), it marks
+    /// the "error" watch socket as ready.
+    ///
+    /// @param receiver the receiver thread running the method.
+    /// @param index the index of the receiver thread.
+    /// @param count the number of receiver threads.
+    void receiveDHCP6Packets(const isc::util::WatchedThreadPtr& receiver,
+                             size_t index, size_t count);
 
-    /// @brief Receives a single DHCPv6 packet from an interface socket
+    /// @brief Receives DHCPv6 packets from an interface socket
     ///
     /// Called by @c receiveDHPC6Packets when a socket fd is flagged as
-    /// ready. It uses the DHCPv6 packet filter to receive a single packet
-    /// from the given interface socket, adds it to the packet queue, and
-    /// marks the "receive" watch socket ready. If an error occurs during
+    /// ready. It uses the DHCPv6 packet filter to receive a batch of
+    /// packets from the given interface socket, adds them to the packet
+    /// queue, and marks the "receive" watch socket ready. If an error occurs during
     /// the read, the "error" watch socket is marked ready.
     ///
+    /// @param receiver the receiver thread.
     /// @param socket_info structure holding socket information
-    void receiveDHCP6Packet(const SocketInfo& socket_info);
+    void receiveDHCP6Packet(isc::util::WatchedThread& receiver,
+                            const SocketInfo& socket_info);
+
+    /// @brief Registers the sockets to wait on in the receive methods.
+    ///
+    /// The external sockets and, in the indirect mode, the receiver
+    /// thread watch sockets, or, in the direct mode, the interface
+    /// sockets of the family are registered in the event handler. The
+    /// registration is kept until the sockets, the interfaces or the
+    /// receiver thread change, so it is done once for many calls.
+    ///
+    /// @param family The socket family (AF_INET or AF_INET6).
+    /// @param indirect True when the receiver thread is used.
+    void registerSockets(const uint16_t family, const bool indirect);
+
+    /// @brief Detects and purges the external sockets which have been
+    /// closed without being deleted.
+    ///
+    /// select() fails on such sockets but epoll() silently ignores them,
+    /// so they are checked before each wait with the latter.
+    ///
+    /// @throw SocketReadError if a socket was purged.
+    void checkExternalSockets();
+
+    /// @brief Detects the registered interface sockets which have been
+    /// closed behind the manager.
+    ///
+    /// As for the external sockets, select() fails on such sockets but
+    /// epoll() silently ignores them, so they are checked before each
+    /// direct wait with the latter. The sockets belong to the interfaces
+    /// so they are not purged.
+    ///
+    /// @throw SocketReadError if a socket is closed.
+    void checkInterfaceSockets() const;
+
+    /// @brief Interface sockets indexed by their descriptor.
+    typedef std::unordered_map<int, std::pair<IfacePtr, SocketInfo> >
+        SocketsByDescriptor;
 
     /// Holds instance of a class derived from PktFilter, used by the
     /// IfaceMgr to open sockets and send/receive packets through these
@@ -1370,9 +1529,35 @@ private:
     /// setPacketFilter method.
     PktFilter6Ptr packet_filter6_;
 
+    /// @brief DHCPv4 packets received in a batch and not yet returned
+    /// by @c receive4Direct.
+    std::list<Pkt4Ptr> received4_;
+
+    /// @brief DHCPv6 packets received in a batch and not yet returned
+    /// by @c receive6Direct.
+    std::list<Pkt6Ptr> received6_;
+
     /// @brief Contains list of callbacks for external sockets
     SocketCallbackInfoContainer callbacks_;
 
+    /// @brief Event handler used by the receive methods.
+    util::FDEventHandlerPtr fd_event_handler_;
+
+    /// @brief Interface sockets registered in the event handler.
+    SocketsByDescriptor registered_sockets_;
+
+    /// @brief Indicates that the sockets must be registered again.
+    bool fd_event_handler_dirty_;
+
+    /// @brief Sockets generation at the registration.
+    uint64_t registered_generation_;
+
+    /// @brief Family of the registered sockets.
+    uint16_t registered_family_;
+
+    /// @brief Mode of the registration.
+    bool registered_indirect_;
+
     /// @brief Indicates if the IfaceMgr is in the test mode.
     bool test_mode_;
 
@@ -1385,8 +1570,11 @@ private:
     /// @brief Manager for DHCPv6 packet implementations and queues
     PacketQueueMgr6Ptr packet_queue_mgr6_;
 
-    /// DHCP packet receiver.
-    isc::util::WatchedThreadPtr dhcp_receiver_;
+    /// @brief Maximum number of DHCP packet receiver threads.
+    size_t receiver_threads_;
+
+    /// DHCP packet receivers.
+    std::vector<isc::util::WatchedThreadPtr> dhcp_receivers_;
 };
 
 }; // namespace isc::dhcp
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,7 +7,9 @@
 #ifndef OPTION_H
 #define OPTION_H
 
+#include <dhcp/option_arena.h>
 #include <util/buffer.h>
+#include <util/flat_multimap.h>
 
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
@@ -38,7 +40,10 @@ class Option;
 typedef boost::shared_ptr<Option> OptionPtr;
 
 /// A collection of DHCP (v4 or v6) options
-typedef std::multimap<unsigned int, OptionPtr> OptionCollection;
+///
+/// The options are kept sorted by code in a contiguous array, see
+/// @ref isc::util::FlatMultimap for the differences with a multimap.
+typedef isc::util::FlatMultimap<unsigned int, OptionPtr> OptionCollection;
 /// A pointer to an OptionCollection
 typedef boost::shared_ptr<OptionCollection> OptionCollectionPtr;
 
@@ -428,6 +433,23 @@ public:
     /// just to force that every option has virtual dtor
     virtual ~Option();
 
+    /// @brief Allocates an option.
+    ///
+    /// The options created while an arena is opened by the thread are
+    /// allocated in the arena (see @ref OptionArena).
+    ///
+    /// @param size size of the option.
+    static void* operator new(size_t size) {
+        return (OptionArena::allocate(size));
+    }
+
+    /// @brief Frees an option.
+    ///
+    /// @param ptr pointer to the option.
+    static void operator delete(void* ptr) {
+        OptionArena::deallocate(ptr);
+    }
+
     /// @brief Checks if options are equal.
     ///
     /// This method calls a virtual @c equals function to compare objects.
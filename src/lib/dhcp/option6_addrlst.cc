@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -77,7 +77,9 @@ void Option6AddrLst::pack(isc::util::OutputBuffer& buf) const {
         }
         // If an address is IPv6 address it should have assumed
         // length of V6ADDRESS_LEN.
-        buf.writeData(&addr->toBytes()[0], V6ADDRESS_LEN);
+        uint8_t bytes[V6ADDRESS_LEN];
+        addr->toBytes(bytes);
+        buf.writeData(bytes, V6ADDRESS_LEN);
     }
 }
 
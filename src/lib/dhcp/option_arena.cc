@@ -0,0 +1,123 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/option_arena.h>
+
+#include <algorithm>
+#include <new>
+
+namespace {
+
+/// @brief Size of the header preceding each block.
+///
+/// The header holds the arena owning the block, or null for a block
+/// allocated from the heap, and keeps the blocks suitably aligned.
+const size_t HEADER_SIZE = 16;
+
+/// @brief Rounds a size up to the alignment of the blocks.
+///
+/// @param size The size.
+/// @return The aligned size.
+size_t
+alignSize(size_t size) {
+    return ((size + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1));
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+thread_local OptionArena* OptionArena::current_ = 0;
+std::atomic<size_t> OptionArena::arena_count_(0);
+
+OptionArena::Scope::Scope(bool enable)
+    : arena_(0), previous_(OptionArena::current_) {
+    if (enable) {
+        arena_ = new OptionArena();
+        OptionArena::current_ = arena_;
+    }
+}
+
+OptionArena::Scope::~Scope() {
+    if (arena_) {
+        OptionArena::current_ = previous_;
+        arena_->open_ = false;
+        arena_->release();
+    }
+}
+
+OptionArena::OptionArena()
+    : offset_(0), chunk_size_(0), open_(true), refs_(1) {
+    ++arena_count_;
+}
+
+OptionArena::~OptionArena() {
+    for (auto chunk : chunks_) {
+        delete[] chunk;
+    }
+    --arena_count_;
+}
+
+void*
+OptionArena::allocate(size_t size) {
+    size_t block_size = HEADER_SIZE + alignSize(size);
+    OptionArena* arena = current_;
+    void* block;
+    if (arena) {
+        block = arena->carve(block_size);
+        ++arena->refs_;
+    } else {
+        block = ::operator new(block_size);
+    }
+    *static_cast<OptionArena**>(block) = arena;
+    return (static_cast<char*>(block) + HEADER_SIZE);
+}
+
+void
+OptionArena::deallocate(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    void* block = static_cast<char*>(ptr) - HEADER_SIZE;
+    OptionArena* arena = *static_cast<OptionArena**>(block);
+    if (arena) {
+        arena->release();
+    } else {
+        ::operator delete(block);
+    }
+}
+
+size_t
+OptionArena::getOptionCount() const {
+    // An open arena is referenced by its scope.
+    return (open_ ? refs_ - 1 : refs_.load());
+}
+
+void*
+OptionArena::carve(size_t size) {
+    if (chunks_.empty() || (offset_ + size > chunk_size_)) {
+        // Large blocks get a chunk of their own.
+        chunk_size_ = std::max(size, static_cast<size_t>(CHUNK_SIZE));
+        chunks_.push_back(new char[chunk_size_]);
+        offset_ = 0;
+    }
+    void* block = chunks_.back() + offset_;
+    offset_ += size;
+    return (block);
+}
+
+void
+OptionArena::release() {
+    if (--refs_ == 0) {
+        delete this;
+    }
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
@@ -0,0 +1,146 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPTION_ARENA_H
+#define OPTION_ARENA_H
+
+#include <boost/noncopyable.hpp>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Memory arena of the options of a packet.
+///
+/// Parsing a packet creates many small options which are all destroyed
+/// with the packet. When an arena is opened by the current thread (see
+/// @ref OptionArena::Scope) the options it creates are carved out of
+/// large chunks of memory owned by the arena instead of being allocated
+/// one by one from the heap. Freeing such an option does not release
+/// memory: the arena counts its live options and releases its chunks at
+/// once when the scope is closed and the last option is destroyed, i.e.
+/// typically at the end of the exchange.
+///
+/// Options may be destroyed by any thread. An option kept after the
+/// exchange keeps the whole arena alive.
+class OptionArena : public boost::noncopyable {
+public:
+
+    /// @brief RAII object opening an arena for the current thread.
+    ///
+    /// The options created by the thread within the scope in which this
+    /// object exists are allocated in a new arena. Scopes can be nested,
+    /// the enclosing arena is restored when the object goes out of scope.
+    class Scope : public boost::noncopyable {
+    public:
+
+        /// @brief Constructor.
+        ///
+        /// @param enable Opens an arena when true, does nothing otherwise.
+        explicit Scope(bool enable = true);
+
+        /// @brief Destructor.
+        ///
+        /// Closes the arena, which is released when its last option is
+        /// destroyed.
+        ~Scope();
+
+    private:
+
+        /// @brief The arena opened by the scope, null when disabled.
+        OptionArena* arena_;
+
+        /// @brief The arena of the enclosing scope.
+        OptionArena* previous_;
+    };
+
+    /// @brief Allocates the memory of an option.
+    ///
+    /// The memory is taken from the arena of the current thread when
+    /// there is one, from the heap otherwise.
+    ///
+    /// @param size The size of the option.
+    /// @return pointer to the memory.
+    static void* allocate(size_t size);
+
+    /// @brief Releases the memory of an option.
+    ///
+    /// @param ptr Pointer returned by @ref allocate, or null.
+    static void deallocate(void* ptr);
+
+    /// @brief Returns the arena of the current thread.
+    ///
+    /// @return pointer to the arena or null when no arena is opened.
+    static const OptionArena* getCurrent() {
+        return (current_);
+    }
+
+    /// @brief Returns the number of arenas which are not released.
+    static size_t getArenaCount() {
+        return (arena_count_);
+    }
+
+    /// @brief Returns the number of options allocated in the arena and
+    /// not destroyed yet.
+    size_t getOptionCount() const;
+
+    /// @brief Returns the number of chunks of memory of the arena.
+    size_t getChunkCount() const {
+        return (chunks_.size());
+    }
+
+    /// @brief The default size of a chunk.
+    static const size_t CHUNK_SIZE = 4096;
+
+private:
+
+    /// @brief Constructor.
+    ///
+    /// The arena is created with one reference held by its scope.
+    OptionArena();
+
+    /// @brief Destructor.
+    ///
+    /// Releases the chunks.
+    ~OptionArena();
+
+    /// @brief Carves a block out of the chunks.
+    ///
+    /// @param size The size of the block, header included.
+    /// @return pointer to the block.
+    void* carve(size_t size);
+
+    /// @brief Releases a reference, deleting the arena with the last one.
+    void release();
+
+    /// @brief The chunks of memory.
+    std::vector<char*> chunks_;
+
+    /// @brief Offset of the free space in the last chunk.
+    size_t offset_;
+
+    /// @brief Size of the last chunk.
+    size_t chunk_size_;
+
+    /// @brief True until the scope is closed.
+    bool open_;
+
+    /// @brief Number of live options plus one while the scope is open.
+    std::atomic<size_t> refs_;
+
+    /// @brief The arena of the current thread.
+    static thread_local OptionArena* current_;
+
+    /// @brief Number of arenas which are not released.
+    static std::atomic<size_t> arena_count_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // OPTION_ARENA_H
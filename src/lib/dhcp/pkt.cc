@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,9 +11,47 @@
 #include <dhcp/hwaddr.h>
 #include <vector>
 
+namespace {
+
+/// @brief Indicates that the spare buffer of the thread was destroyed.
+thread_local bool spare_buffer_destroyed = false;
+
+/// @brief Holder of the spare output buffer of a thread.
+struct SpareBuffer {
+    /// @brief Constructor.
+    SpareBuffer() : buffer_(0) {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Packets destroyed later by the exiting thread keep their memory.
+    ~SpareBuffer() {
+        spare_buffer_destroyed = true;
+    }
+
+    /// @brief The buffer.
+    isc::util::OutputBuffer buffer_;
+};
+
+/// @brief Returns the spare output buffer of the current thread.
+///
+/// @return pointer to the buffer, null when the thread is exiting.
+isc::util::OutputBuffer*
+getSpareBuffer() {
+    if (spare_buffer_destroyed) {
+        return (0);
+    }
+    thread_local SpareBuffer spare;
+    return (&spare.buffer_);
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
+bool Pkt::default_option_arena_ = false;
+
 Pkt::Pkt(uint32_t transid, const isc::asiolink::IOAddress& local_addr,
          const isc::asiolink::IOAddress& remote_addr, uint16_t local_port,
          uint16_t remote_port)
@@ -25,7 +63,9 @@ Pkt::Pkt(uint32_t transid, const isc::asiolink::IOAddress& local_addr,
      local_port_(local_port),
      remote_port_(remote_port),
      buffer_out_(0),
-     copy_retrieved_options_(false)
+     copy_retrieved_options_(false),
+     option_arena_(false),
+     extraction_cache_enabled_(false)
 {
 }
 
@@ -40,7 +80,9 @@ Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local
      local_port_(local_port),
      remote_port_(remote_port),
      buffer_out_(0),
-     copy_retrieved_options_(false)
+     copy_retrieved_options_(false),
+     option_arena_(default_option_arena_),
+     extraction_cache_enabled_(false)
 {
 
     if (len != 0) {
@@ -52,6 +94,27 @@ Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local
     }
 }
 
+Pkt::~Pkt() {
+    // Keep the largest memory.
+    isc::util::OutputBuffer* spare = getSpareBuffer();
+    if (spare && (buffer_out_.getCapacity() > spare->getCapacity())) {
+        spare->swap(buffer_out_);
+    }
+}
+
+void
+Pkt::prepareBuffer(size_t length) {
+    buffer_out_.clear();
+    if (buffer_out_.getCapacity() < length) {
+        isc::util::OutputBuffer* spare = getSpareBuffer();
+        if (spare && (spare->getCapacity() > buffer_out_.getCapacity())) {
+            buffer_out_.swap(*spare);
+            buffer_out_.clear();
+        }
+        buffer_out_.reserve(length);
+    }
+}
+
 void
 Pkt::addOption(const OptionPtr& opt) {
     options_.insert(std::pair<int, OptionPtr>(opt->getType(), opt));
@@ -91,6 +154,26 @@ Pkt::delOption(uint16_t type) {
     }
 }
 
+const std::string*
+Pkt::getCachedExtraction(const std::string& key) const {
+    if (!extraction_cache_enabled_) {
+        return (0);
+    }
+    std::map<std::string, std::string>::const_iterator x =
+        extraction_cache_.find(key);
+    if (x != extraction_cache_.end()) {
+        return (&x->second);
+    }
+    return (0);
+}
+
+void
+Pkt::cacheExtraction(const std::string& key, const std::string& value) {
+    if (extraction_cache_enabled_) {
+        extraction_cache_[key] = value;
+    }
+}
+
 bool
 Pkt::inClass(const std::string& client_class) {
     return (classes_.contains(client_class));
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -15,8 +15,11 @@
 #include <hooks/callout_handle_associate.h>
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <map>
+#include <string>
 #include <utility>
 
 namespace isc {
@@ -133,8 +136,8 @@ public:
     /// prior to calling this method.
     ///
     /// Output buffer will be stored in buffer_out_.
-    /// The buffer_out_ should be cleared before writing to the buffer
-    /// in the derived classes.
+    /// The buffer_out_ should be prepared with @ref prepareBuffer
+    /// before writing to the buffer in the derived classes.
     ///
     /// @note This is a pure virtual method and must be implemented in
     /// the derived classes. The @c Pkt4 and @c Pkt6 class have respective
@@ -378,6 +381,85 @@ public:
         return (copy_retrieved_options_);
     }
 
+    /// @brief Controls whether the options parsed by @c unpack are
+    /// allocated in an arena.
+    ///
+    /// The options of a received packet are usually all destroyed with
+    /// the packet at the end of the exchange. When enabled, the options
+    /// created by @c unpack are allocated in an @ref OptionArena so they
+    /// take their memory from a few large chunks released at once.
+    ///
+    /// @param enable Indicates if the options are allocated in an arena.
+    void setOptionArena(const bool enable) {
+        option_arena_ = enable;
+    }
+
+    /// @brief Returns whether the options are allocated in an arena.
+    ///
+    /// @return true if @c unpack allocates the options in an arena.
+    bool isOptionArena() const {
+        return (option_arena_);
+    }
+
+    /// @brief Sets whether the received packets allocate their options
+    /// in an arena.
+    ///
+    /// This is the initial value of @ref setOptionArena for the packets
+    /// created from a buffer. It is false by default.
+    ///
+    /// @param enable Indicates if the options are allocated in an arena.
+    static void setDefaultOptionArena(const bool enable) {
+        default_option_arena_ = enable;
+    }
+
+    /// @brief Returns whether the received packets allocate their options
+    /// in an arena.
+    ///
+    /// @return true if the options are allocated in an arena by default.
+    static bool getDefaultOptionArena() {
+        return (default_option_arena_);
+    }
+
+    /// @brief Enables or disables the extraction cache.
+    ///
+    /// The classification expressions often extract the same option or
+    /// field of a packet, e.g. when many classes test the same relay agent
+    /// sub-option. When the cache is enabled the values they extract are
+    /// stored under a key identifying the extraction, so the identical
+    /// extractions of the following expressions reuse them instead of
+    /// decoding the packet again. The cache is cleared when it is enabled
+    /// or disabled: it must only be enabled while the packet is not
+    /// modified, typically during a classification pass (see
+    /// @ref ScopedEnableExtractionCache).
+    ///
+    /// @param enable Indicates if the extraction cache is enabled.
+    void setExtractionCache(const bool enable) {
+        extraction_cache_enabled_ = enable;
+        extraction_cache_.clear();
+    }
+
+    /// @brief Returns whether the extraction cache is enabled.
+    ///
+    /// @return true if the extracted values are cached.
+    bool isExtractionCache() const {
+        return (extraction_cache_enabled_);
+    }
+
+    /// @brief Returns a value of the extraction cache.
+    ///
+    /// @param key Key of the extraction.
+    /// @return pointer to the value or null if the cache is disabled or
+    /// does not hold the value.
+    const std::string* getCachedExtraction(const std::string& key) const;
+
+    /// @brief Stores a value in the extraction cache.
+    ///
+    /// Does nothing when the cache is disabled.
+    ///
+    /// @param key Key of the extraction.
+    /// @param value The extracted value.
+    void cacheExtraction(const std::string& key, const std::string& value);
+
     /// @brief Update packet timestamp.
     ///
     /// Updates packet timestamp. This method is invoked
@@ -581,11 +663,9 @@ public:
 
     /// @brief Virtual destructor.
     ///
-    /// There is nothing to clean up here, but since there are virtual methods,
-    /// we define virtual destructor to ensure that derived classes will have
-    /// a virtual one, too.
-    virtual ~Pkt() {
-    }
+    /// Hands the memory of the output buffer over to the current thread
+    /// for reuse, see @ref prepareBuffer.
+    virtual ~Pkt();
 
     /// @brief Classes this packet belongs to.
     ///
@@ -615,6 +695,18 @@ public:
 
 protected:
 
+    /// @brief Clears the output buffer before packing.
+    ///
+    /// Each thread keeps the memory of the output buffer of the last
+    /// destroyed packet. When the output buffer is too small for the
+    /// packet, it is swapped with this memory, and it is grown at once
+    /// to the packet length when still too small. So packing into the
+    /// buffer does not reallocate, and after the first packets a thread
+    /// packs its responses without allocating memory.
+    ///
+    /// @param length The length of the packet.
+    void prepareBuffer(size_t length);
+
     /// @brief Attempts to obtain MAC address from source link-local
     /// IPv6 address
     ///
@@ -769,6 +861,20 @@ protected:
     /// @see the documentation for @ref Pkt::setCopyRetrievedOptions.
     bool copy_retrieved_options_;
 
+    /// @brief Indicates if the options are allocated in an arena.
+    bool option_arena_;
+
+    /// @brief Initial value of @c option_arena_ for received packets.
+    static bool default_option_arena_;
+
+    /// @brief Indicates if the extraction cache is enabled.
+    ///
+    /// @see the documentation for @ref Pkt::setExtractionCache.
+    bool extraction_cache_enabled_;
+
+    /// @brief Values extracted by the classification, by key.
+    std::map<std::string, std::string> extraction_cache_;
+
     /// packet timestamp
     boost::posix_time::ptime timestamp_;
 
@@ -796,6 +902,45 @@ private:
 /// @brief A pointer to either Pkt4 or Pkt6 packet
 typedef boost::shared_ptr<isc::dhcp::Pkt> PktPtr;
 
+/// @brief RAII object enabling the extraction cache of a packet.
+///
+/// The cache is enabled within the scope in which this object exists,
+/// e.g. while the server evaluates the client classes, and it is disabled
+/// and cleared when the object goes out of scope. Nothing is done when
+/// the cache is already enabled by an enclosing scope.
+class ScopedEnableExtractionCache : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Enables the extraction cache of the packet.
+    ///
+    /// @param pkt The packet.
+    explicit ScopedEnableExtractionCache(Pkt& pkt)
+        : pkt_(pkt), enabled_(!pkt.isExtractionCache()) {
+        if (enabled_) {
+            pkt_.setExtractionCache(true);
+        }
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Disables the extraction cache of the packet.
+    ~ScopedEnableExtractionCache() {
+        if (enabled_) {
+            pkt_.setExtractionCache(false);
+        }
+    }
+
+private:
+
+    /// @brief The packet.
+    Pkt& pkt_;
+
+    /// @brief Indicates if the cache was enabled by this object.
+    bool enabled_;
+};
+
 }; // namespace isc::dhcp
 }; // namespace isc
 
@@ -92,8 +92,10 @@ Pkt4::pack() {
     }
 
     // Clear the output buffer to make sure that consecutive calls to pack()
-    // will not result in concatenation of multiple packet copies.
-    buffer_out_.clear();
+    // will not result in concatenation of multiple packet copies. It is
+    // sized for the packet and the END option, so the packet is written
+    // without reallocation.
+    prepareBuffer(len() + 1);
 
     try {
         size_t hw_len = hwaddr_->hwaddr_.size();
@@ -125,8 +127,8 @@ Pkt4::pack() {
 
         // write (len) bytes of padding
         if (hw_len > 0) {
-            vector<uint8_t> zeros(hw_len, 0);
-            buffer_out_.writeData(&zeros[0], hw_len);
+            static const uint8_t zeros[MAX_CHADDR_LEN] = { 0 };
+            buffer_out_.writeData(zeros, hw_len);
         }
 
         buffer_out_.writeData(sname_, MAX_SNAME_LEN);
@@ -150,6 +152,8 @@ Pkt4::pack() {
 
 void
 Pkt4::unpack() {
+    // Allocate the options in an arena when enabled.
+    OptionArena::Scope arena(option_arena_);
 
     // input buffer (used during message reception)
     isc::util::InputBuffer buffer_in(&data_[0], data_.size());
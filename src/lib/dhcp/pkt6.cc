@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -282,18 +282,16 @@ void
 Pkt6::packUDP() {
     try {
         // Make sure that the buffer is empty before we start writing to it.
-        buffer_out_.clear();
+        // The length also calculates the size needed for each relay (if
+        // there is only one relay, then it will be equal to "regular" length
+        // + relay-forw header + size of relay-msg option header + possibly
+        // size of interface-id option (if present). If there is more than
+        // one relay, the whole process is called iteratively for each relay.
+        prepareBuffer(len());
 
         // is this a relayed packet?
         if (!relay_info_.empty()) {
 
-            // calculate size needed for each relay (if there is only one relay,
-            // then it will be equal to "regular" length + relay-forw header +
-            // size of relay-msg option header + possibly size of interface-id
-            // option (if present). If there is more than one relay, the whole
-            // process is called iteratively for each relay.
-            calculateRelaySizes();
-
             // Now for each relay, we need to...
             for (vector<RelayInfo>::iterator relay = relay_info_.begin();
                  relay != relay_info_.end(); ++relay) {
@@ -301,10 +299,11 @@ Pkt6::packUDP() {
                 // build relay-forw/relay-repl header (see RFC 8415, section 9)
                 buffer_out_.writeUint8(relay->msg_type_);
                 buffer_out_.writeUint8(relay->hop_count_);
-                buffer_out_.writeData(&(relay->linkaddr_.toBytes()[0]),
-                                     isc::asiolink::V6ADDRESS_LEN);
-                buffer_out_.writeData(&relay->peeraddr_.toBytes()[0],
-                                     isc::asiolink::V6ADDRESS_LEN);
+                uint8_t addr[isc::asiolink::V6ADDRESS_LEN];
+                relay->linkaddr_.toBytes(addr);
+                buffer_out_.writeData(addr, isc::asiolink::V6ADDRESS_LEN);
+                relay->peeraddr_.toBytes(addr);
+                buffer_out_.writeData(addr, isc::asiolink::V6ADDRESS_LEN);
 
                 // store every option in this relay scope. Usually that will be
                 // only interface-id, but occasionally other options may be
@@ -352,6 +351,8 @@ Pkt6::packTCP() {
 
 void
 Pkt6::unpack() {
+    // Allocate the options in an arena when enabled.
+    OptionArena::Scope arena(option_arena_);
     switch (proto_) {
     case UDP:
         return unpackUDP();
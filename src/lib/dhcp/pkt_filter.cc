@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,24 @@
 namespace isc {
 namespace dhcp {
 
+SocketInfo
+PktFilter::openReusePortSocket(Iface&, const isc::asiolink::IOAddress&,
+                               const uint16_t, const bool, const bool) {
+    isc_throw(NotImplemented, "the packet filter does not support opening"
+              " sockets with the SO_REUSEPORT option");
+}
+
+size_t
+PktFilter::receiveBatch(Iface& iface, const SocketInfo& socket_info,
+                        std::vector<Pkt4Ptr>& pkts, size_t) {
+    Pkt4Ptr pkt = receive(iface, socket_info);
+    if (!pkt) {
+        return (0);
+    }
+    pkts.push_back(pkt);
+    return (1);
+}
+
 int
 PktFilter::openFallbackSocket(const isc::asiolink::IOAddress& addr,
                               const uint16_t port) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,8 @@
 #include <asiolink/io_address.h>
 #include <boost/shared_ptr.hpp>
 
+#include <vector>
+
 namespace isc {
 namespace dhcp {
 
@@ -59,6 +61,18 @@ public:
     /// @return true of the direct response is supported.
     virtual bool isDirectResponseSupported() const = 0;
 
+    /// @brief Check if several sockets can be bound to the same address.
+    ///
+    /// Checks if the Packet Filter class can open sockets with the
+    /// SO_REUSEPORT option, i.e. several sockets bound to the same address
+    /// and port among which the kernel spreads the received traffic.
+    /// This is used to receive packets with several threads.
+    ///
+    /// @return true if @c openReusePortSocket is supported.
+    virtual bool isReusePortSupported() const {
+        return (false);
+    }
+
     /// @brief Open primary and fallback socket.
     ///
     /// A method implementation in the derived class may open one or two
@@ -84,6 +98,28 @@ public:
                                   const bool receive_bcast,
                                   const bool send_bcast) = 0;
 
+    /// @brief Open a socket sharing its address and port.
+    ///
+    /// Opens a socket like @c openSocket with the SO_REUSEADDR and
+    /// SO_REUSEPORT options set, so as it can be bound to the address and
+    /// port of other sockets opened by this method. No fallback socket is
+    /// opened. The default implementation throws.
+    ///
+    /// @param iface Interface descriptor.
+    /// @param addr Address on the interface to be used to send packets.
+    /// @param port Port number.
+    /// @param receive_bcast Configure socket to receive broadcast messages
+    /// @param send_bcast configure socket to send broadcast messages.
+    ///
+    /// @return A structure describing the socket.
+    /// @throw isc::NotImplemented if the SO_REUSEPORT option is not
+    /// supported.
+    virtual SocketInfo openReusePortSocket(Iface& iface,
+                                           const isc::asiolink::IOAddress& addr,
+                                           const uint16_t port,
+                                           const bool receive_bcast,
+                                           const bool send_bcast);
+
     /// @brief Receive packet over specified socket.
     ///
     /// @param iface interface
@@ -93,6 +129,23 @@ public:
     virtual Pkt4Ptr receive(Iface& iface,
                             const SocketInfo& socket_info) = 0;
 
+    /// @brief Receive a batch of packets over specified socket.
+    ///
+    /// Receives at least one packet, blocking like @c receive, then the
+    /// packets already waiting on the socket up to @c max_count. This
+    /// saves a select and a system call per packet under load. The
+    /// default implementation receives a single packet with @c receive.
+    ///
+    /// @param iface interface
+    /// @param socket_info structure holding socket information
+    /// @param [out] pkts vector the received packets are appended to
+    /// @param max_count maximum number of packets to receive
+    ///
+    /// @return number of appended packets
+    virtual size_t receiveBatch(Iface& iface, const SocketInfo& socket_info,
+                                std::vector<Pkt4Ptr>& pkts,
+                                size_t max_count);
+
     /// @brief Send packet over specified socket.
     ///
     /// @param iface interface to be used to send packet
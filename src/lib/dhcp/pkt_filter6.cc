@@ -11,6 +11,17 @@
 namespace isc {
 namespace dhcp {
 
+size_t
+PktFilter6::receiveBatch(const SocketInfo& socket_info,
+                         std::vector<Pkt6Ptr>& pkts, size_t) {
+    Pkt6Ptr pkt = receive(socket_info);
+    if (!pkt) {
+        return (0);
+    }
+    pkts.push_back(pkt);
+    return (1);
+}
+
 bool
 PktFilter6::joinMulticast(int sock, const std::string& ifname,
                           const std::string & mcast) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,8 @@
 #include <asiolink/io_address.h>
 #include <dhcp/pkt6.h>
 
+#include <vector>
+
 namespace isc {
 namespace dhcp {
 
@@ -73,6 +75,18 @@ public:
     /// @brief Virtual Destructor.
     virtual ~PktFilter6() { }
 
+    /// @brief Check if several sockets can be bound to the same address.
+    ///
+    /// Checks if the sockets opened by @c openSocket can share their address
+    /// and port with other sockets opened by the same method, i.e. have
+    /// the SO_REUSEPORT option set. The kernel then spreads the received
+    /// traffic among them.
+    ///
+    /// @return true if several sockets can be opened on the same address.
+    virtual bool isReusePortSupported() const {
+        return (false);
+    }
+
     /// @brief Opens a socket.
     ///
     /// This function open an IPv6 socket on an interface and binds it to a
@@ -101,6 +115,23 @@ public:
     /// @return A pointer to received message.
     virtual Pkt6Ptr receive(const SocketInfo& socket_info) = 0;
 
+    /// @brief Receives a batch of DHCPv6 messages on the interface.
+    ///
+    /// Receives at least one message, blocking like @c receive, then the
+    /// messages already waiting on the socket up to @c max_count. Messages
+    /// dropped by the filter are not appended, so the function may return
+    /// 0. The default implementation receives a single message with
+    /// @c receive.
+    ///
+    /// @param socket_info A structure holding socket information.
+    /// @param [out] pkts A vector the received messages are appended to.
+    /// @param max_count A maximum number of messages to receive.
+    ///
+    /// @return A number of appended messages.
+    virtual size_t receiveBatch(const SocketInfo& socket_info,
+                                std::vector<Pkt6Ptr>& pkts,
+                                size_t max_count);
+
     /// @brief Sends DHCPv6 message through a specified interface and socket.
     ///
     /// This function sends a DHCPv6 message through a specified interface and
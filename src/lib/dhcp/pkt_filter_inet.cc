@@ -20,12 +20,48 @@ namespace dhcp {
 const size_t
 PktFilterInet::CONTROL_BUF_LEN = CMSG_SPACE(sizeof(struct in6_pktinfo));
 
+const size_t
+PktFilterInet::MAX_BATCH_SIZE;
+
+bool
+PktFilterInet::isReusePortSupported() const {
+#ifdef SO_REUSEPORT
+    return (true);
+#else
+    return (false);
+#endif
+}
+
 SocketInfo
 PktFilterInet::openSocket(Iface& iface,
                           const isc::asiolink::IOAddress& addr,
                           const uint16_t port,
                           const bool receive_bcast,
                           const bool send_bcast) {
+    return (openSocketInternal(iface, addr, port, receive_bcast, send_bcast,
+                               false));
+}
+
+SocketInfo
+PktFilterInet::openReusePortSocket(Iface& iface,
+                                   const isc::asiolink::IOAddress& addr,
+                                   const uint16_t port,
+                                   const bool receive_bcast,
+                                   const bool send_bcast) {
+    if (!isReusePortSupported()) {
+        isc_throw(NotImplemented, "SO_REUSEPORT is not supported on this OS");
+    }
+    return (openSocketInternal(iface, addr, port, receive_bcast, send_bcast,
+                               true));
+}
+
+SocketInfo
+PktFilterInet::openSocketInternal(Iface& iface,
+                                  const isc::asiolink::IOAddress& addr,
+                                  const uint16_t port,
+                                  const bool receive_bcast,
+                                  const bool send_bcast,
+                                  const bool reuse_port) {
     struct sockaddr_in addr4;
     memset(&addr4, 0, sizeof(sockaddr));
     addr4.sin_family = AF_INET;
@@ -63,6 +99,22 @@ PktFilterInet::openSocket(Iface& iface,
     }
 #endif
 
+    if (reuse_port) {
+#ifdef SO_REUSEPORT
+        // Allow other sockets opened the same way to be bound to the same
+        // address and port: the kernel spreads the traffic among them.
+        int flag = 1;
+        if ((setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &flag,
+                        sizeof(flag)) < 0) ||
+            (setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &flag,
+                        sizeof(flag)) < 0)) {
+            close(sock);
+            isc_throw(SocketConfigError, "Failed to set SO_REUSEPORT option"
+                      << " on socket " << sock);
+        }
+#endif
+    }
+
     if (send_bcast && iface.flag_broadcast_) {
         // Enable sending to broadcast address.
         int flag = 1;
@@ -140,8 +192,84 @@ PktFilterInet::receive(Iface& iface, const SocketInfo& socket_info) {
         isc_throw(SocketReadError, "failed to receive UDP4 data");
     }
 
+    return (createPacket(iface, socket_info, buf, result, from_addr, m));
+}
+
+size_t
+PktFilterInet::receiveBatch(Iface& iface, const SocketInfo& socket_info,
+                            std::vector<Pkt4Ptr>& pkts, size_t max_count) {
+#if defined (OS_LINUX) && defined (MSG_WAITFORONE)
+    if (max_count > MAX_BATCH_SIZE) {
+        max_count = MAX_BATCH_SIZE;
+    }
+    if (max_count <= 1) {
+        return (PktFilter::receiveBatch(iface, socket_info, pkts, max_count));
+    }
+
+    struct sockaddr_in from_addr[MAX_BATCH_SIZE];
+    uint8_t buf[MAX_BATCH_SIZE][IfaceMgr::RCVBUFSIZE];
+    uint8_t control_buf[MAX_BATCH_SIZE][CONTROL_BUF_LEN];
+    struct iovec v[MAX_BATCH_SIZE];
+    struct mmsghdr msgs[MAX_BATCH_SIZE];
+
+    memset(&control_buf[0][0], 0, sizeof(control_buf));
+    memset(&from_addr[0], 0, sizeof(from_addr));
+    memset(&msgs[0], 0, sizeof(msgs));
+
+    // Same message headers as in receive(), one per packet.
+    for (size_t i = 0; i < max_count; ++i) {
+        v[i].iov_base = static_cast<void*>(buf[i]);
+        v[i].iov_len = IfaceMgr::RCVBUFSIZE;
+        struct msghdr& m = msgs[i].msg_hdr;
+        m.msg_name = &from_addr[i];
+        m.msg_namelen = sizeof(from_addr[i]);
+        m.msg_iov = &v[i];
+        m.msg_iovlen = 1;
+        m.msg_control = &control_buf[i][0];
+        m.msg_controllen = CONTROL_BUF_LEN;
+    }
+
+    // Block for the first packet only: the following ones are taken
+    // when they are already waiting on the socket.
+    int result = recvmmsg(socket_info.sockfd_, &msgs[0], max_count,
+                          MSG_WAITFORONE, 0);
+    if (result < 0) {
+        isc_throw(SocketReadError, "failed to receive UDP4 data");
+    }
+
+    // A malformed packet must not cause the loss of the other packets
+    // of the batch: it is skipped, and reported only when nothing else
+    // was received.
+    size_t count = 0;
+    std::string error;
+    for (int i = 0; i < result; ++i) {
+        try {
+            pkts.push_back(createPacket(iface, socket_info, buf[i],
+                                        msgs[i].msg_len, from_addr[i],
+                                        msgs[i].msg_hdr));
+            ++count;
+        } catch (const std::exception& ex) {
+            if (error.empty()) {
+                error = ex.what();
+            }
+        }
+    }
+    if ((count == 0) && !error.empty()) {
+        isc_throw(SocketReadError, "failed to create new packet: " << error);
+    }
+    return (count);
+#else
+    return (PktFilter::receiveBatch(iface, socket_info, pkts, max_count));
+#endif
+}
+
+Pkt4Ptr
+PktFilterInet::createPacket(Iface& iface, const SocketInfo& socket_info,
+                            const uint8_t* buf, size_t len,
+                            const struct sockaddr_in& from_addr,
+                            struct msghdr& m) {
     // We have all data let's create Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(buf, result));
+    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(buf, len));
 
     pkt->updateTimestamp();
 
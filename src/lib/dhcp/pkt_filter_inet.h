@@ -10,6 +10,9 @@
 #include <dhcp/pkt_filter.h>
 #include <boost/scoped_array.hpp>
 
+#include <netinet/in.h>
+#include <sys/socket.h>
+
 namespace isc {
 namespace dhcp {
 
@@ -31,6 +34,11 @@ public:
         return (false);
     }
 
+    /// @brief Check if several sockets can be bound to the same address.
+    ///
+    /// @return true if the system defines the SO_REUSEPORT option.
+    virtual bool isReusePortSupported() const;
+
     /// @brief Open primary and fallback socket.
     ///
     /// @param iface Interface descriptor.
@@ -48,6 +56,25 @@ public:
                                   const bool receive_bcast,
                                   const bool send_bcast);
 
+    /// @brief Open a socket sharing its address and port.
+    ///
+    /// @param iface Interface descriptor.
+    /// @param addr Address on the interface to be used to send packets.
+    /// @param port Port number.
+    /// @param receive_bcast Configure socket to receive broadcast messages
+    /// @param send_bcast Configure socket to send broadcast messages.
+    ///
+    /// @return A structure describing the socket.
+    /// @throw isc::NotImplemented if the system does not define the
+    /// SO_REUSEPORT option.
+    /// @throw isc::dhcp::SocketConfigError if error occurs when opening,
+    /// binding or configuring the socket.
+    virtual SocketInfo openReusePortSocket(Iface& iface,
+                                           const isc::asiolink::IOAddress& addr,
+                                           const uint16_t port,
+                                           const bool receive_bcast,
+                                           const bool send_bcast);
+
     /// @brief Receive packet over specified socket.
     ///
     /// @param iface interface
@@ -60,6 +87,26 @@ public:
     /// message parsing fails.
     virtual Pkt4Ptr receive(Iface& iface, const SocketInfo& socket_info);
 
+    /// @brief Receive a batch of packets over specified socket.
+    ///
+    /// On Linux the packets are received with a single recvmmsg call
+    /// which blocks until the first packet arrives and returns the
+    /// packets already waiting on the socket, up to @c max_count and
+    /// @c MAX_BATCH_SIZE. A packet of the batch which can't be parsed is
+    /// skipped. On other systems a single packet is received.
+    ///
+    /// @param iface interface
+    /// @param socket_info structure holding socket information
+    /// @param [out] pkts vector the received packets are appended to
+    /// @param max_count maximum number of packets to receive
+    ///
+    /// @return number of appended packets
+    /// @throw isc::dhcp::SocketReadError if an error occurs during reception
+    /// or if no packet of the batch could be parsed.
+    virtual size_t receiveBatch(Iface& iface, const SocketInfo& socket_info,
+                                std::vector<Pkt4Ptr>& pkts,
+                                size_t max_count);
+
     /// @brief Send packet over specified socket.
     ///
     /// This function will use local address specified in the @c pkt as a source
@@ -78,7 +125,45 @@ public:
     /// a DHCP message through the socket.
     virtual int send(const Iface& iface, uint16_t sockfd, const Pkt4Ptr& pkt);
 
+    /// Maximum number of packets received by a single receiveBatch call.
+    static const size_t MAX_BATCH_SIZE = 32;
+
 private:
+
+    /// @brief Opens a socket.
+    ///
+    /// @param iface Interface descriptor.
+    /// @param addr Address on the interface to be used to send packets.
+    /// @param port Port number.
+    /// @param receive_bcast Configure socket to receive broadcast messages
+    /// @param send_bcast Configure socket to send broadcast messages.
+    /// @param reuse_port Set the SO_REUSEADDR and SO_REUSEPORT options.
+    ///
+    /// @return A structure describing the socket.
+    /// @throw isc::dhcp::SocketConfigError if error occurs when opening,
+    /// binding or configuring the socket.
+    SocketInfo openSocketInternal(Iface& iface,
+                                  const isc::asiolink::IOAddress& addr,
+                                  const uint16_t port,
+                                  const bool receive_bcast,
+                                  const bool send_bcast,
+                                  const bool reuse_port);
+
+    /// @brief Creates a packet from received data.
+    ///
+    /// @param iface interface
+    /// @param socket_info structure holding socket information
+    /// @param buf received data
+    /// @param len length of the received data
+    /// @param from_addr address the data was received from
+    /// @param m message header holding the control messages
+    ///
+    /// @return Received packet
+    Pkt4Ptr createPacket(Iface& iface, const SocketInfo& socket_info,
+                         const uint8_t* buf, size_t len,
+                         const struct sockaddr_in& from_addr,
+                         struct msghdr& m);
+
     /// Length of the socket control buffer.
     static const size_t CONTROL_BUF_LEN;
 };
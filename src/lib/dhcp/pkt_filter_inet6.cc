@@ -22,6 +22,18 @@ namespace dhcp {
 const size_t
 PktFilterInet6::CONTROL_BUF_LEN = CMSG_SPACE(sizeof(struct in6_pktinfo));
 
+const size_t
+PktFilterInet6::MAX_BATCH_SIZE;
+
+bool
+PktFilterInet6::isReusePortSupported() const {
+#ifdef SO_REUSEPORT
+    return (true);
+#else
+    return (false);
+#endif
+}
+
 SocketInfo
 PktFilterInet6::openSocket(const Iface& iface,
                            const isc::asiolink::IOAddress& addr,
@@ -166,39 +178,115 @@ PktFilterInet6::receive(const SocketInfo& socket_info) {
     m.msg_controllen = CONTROL_BUF_LEN;
 
     int result = recvmsg(socket_info.sockfd_, &m, 0);
+    if (result < 0) {
+        isc_throw(SocketReadError, "failed to receive data");
+    }
 
+    return (createPacket(socket_info, buf, result, from, m));
+}
+
+size_t
+PktFilterInet6::receiveBatch(const SocketInfo& socket_info,
+                             std::vector<Pkt6Ptr>& pkts, size_t max_count) {
+#if defined (OS_LINUX) && defined (MSG_WAITFORONE)
+    if (max_count > MAX_BATCH_SIZE) {
+        max_count = MAX_BATCH_SIZE;
+    }
+    if (max_count <= 1) {
+        return (PktFilter6::receiveBatch(socket_info, pkts, max_count));
+    }
+
+    struct sockaddr_in6 from[MAX_BATCH_SIZE];
+    uint8_t buf[MAX_BATCH_SIZE][IfaceMgr::RCVBUFSIZE];
+    uint8_t control_buf[MAX_BATCH_SIZE][CONTROL_BUF_LEN];
+    struct iovec v[MAX_BATCH_SIZE];
+    struct mmsghdr msgs[MAX_BATCH_SIZE];
+
+    memset(&control_buf[0][0], 0, sizeof(control_buf));
+    memset(&from[0], 0, sizeof(from));
+    memset(&v[0], 0, sizeof(v));
+    memset(&msgs[0], 0, sizeof(msgs));
+
+    // Same message headers as in receive(), one per message.
+    for (size_t i = 0; i < max_count; ++i) {
+        v[i].iov_base = static_cast<void*>(buf[i]);
+        v[i].iov_len = IfaceMgr::RCVBUFSIZE;
+        struct msghdr& m = msgs[i].msg_hdr;
+        m.msg_name = &from[i];
+        m.msg_namelen = sizeof(from[i]);
+        m.msg_iov = &v[i];
+        m.msg_iovlen = 1;
+        m.msg_control = &control_buf[i][0];
+        m.msg_controllen = CONTROL_BUF_LEN;
+    }
+
+    // Block for the first message only: the following ones are taken
+    // when they are already waiting on the socket.
+    int result = recvmmsg(socket_info.sockfd_, &msgs[0], max_count,
+                          MSG_WAITFORONE, 0);
+    if (result < 0) {
+        isc_throw(SocketReadError, "failed to receive data");
+    }
+
+    // A malformed message must not cause the loss of the other messages
+    // of the batch: it is skipped, and reported only when nothing else
+    // was received.
+    size_t count = 0;
+    std::string error;
+    for (int i = 0; i < result; ++i) {
+        try {
+            Pkt6Ptr pkt = createPacket(socket_info, buf[i], msgs[i].msg_len,
+                                       from[i], msgs[i].msg_hdr);
+            if (pkt) {
+                pkts.push_back(pkt);
+                ++count;
+            }
+        } catch (const std::exception& ex) {
+            if (error.empty()) {
+                error = ex.what();
+            }
+        }
+    }
+    if ((count == 0) && !error.empty()) {
+        isc_throw(SocketReadError, error);
+    }
+    return (count);
+#else
+    return (PktFilter6::receiveBatch(socket_info, pkts, max_count));
+#endif
+}
+
+Pkt6Ptr
+PktFilterInet6::createPacket(const SocketInfo& socket_info,
+                             const uint8_t* buf, size_t len,
+                             const struct sockaddr_in6& from,
+                             struct msghdr& m) {
     struct in6_addr to_addr;
     memset(&to_addr, 0, sizeof(to_addr));
 
     int ifindex = -1;
-    if (result >= 0) {
-        struct in6_pktinfo* pktinfo = NULL;
-
-
-        // If we did read successfully, then we need to loop
-        // through the control messages we received and
-        // find the one with our destination address.
-        //
-        // We also keep a flag to see if we found it. If we
-        // didn't, then we consider this to be an error.
-        bool found_pktinfo = false;
-        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&m);
-        while (cmsg != NULL) {
-            if ((cmsg->cmsg_level == IPPROTO_IPV6) &&
-                (cmsg->cmsg_type == IPV6_PKTINFO)) {
-                pktinfo = util::io::internal::convertPktInfo6(CMSG_DATA(cmsg));
-                to_addr = pktinfo->ipi6_addr;
-                ifindex = pktinfo->ipi6_ifindex;
-                found_pktinfo = true;
-                break;
-            }
-            cmsg = CMSG_NXTHDR(&m, cmsg);
-        }
-        if (!found_pktinfo) {
-            isc_throw(SocketReadError, "unable to find pktinfo");
+    struct in6_pktinfo* pktinfo = NULL;
+
+    // We did read successfully, so we need to loop through the control
+    // messages we received and find the one with our destination address.
+    //
+    // We also keep a flag to see if we found it. If we
+    // didn't, then we consider this to be an error.
+    bool found_pktinfo = false;
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&m);
+    while (cmsg != NULL) {
+        if ((cmsg->cmsg_level == IPPROTO_IPV6) &&
+            (cmsg->cmsg_type == IPV6_PKTINFO)) {
+            pktinfo = util::io::internal::convertPktInfo6(CMSG_DATA(cmsg));
+            to_addr = pktinfo->ipi6_addr;
+            ifindex = pktinfo->ipi6_ifindex;
+            found_pktinfo = true;
+            break;
         }
-    } else {
-        isc_throw(SocketReadError, "failed to receive data");
+        cmsg = CMSG_NXTHDR(&m, cmsg);
+    }
+    if (!found_pktinfo) {
+        isc_throw(SocketReadError, "unable to find pktinfo");
     }
 
     // Filter out packets sent to global unicast address (not link local and
@@ -215,7 +303,7 @@ PktFilterInet6::receive(const SocketInfo& socket_info) {
     // Let's create a packet.
     Pkt6Ptr pkt;
     try {
-        pkt = Pkt6Ptr(new Pkt6(buf, result));
+        pkt = Pkt6Ptr(new Pkt6(buf, len));
     } catch (const std::exception& ex) {
         isc_throw(SocketReadError, "failed to create new packet");
     }
@@ -238,7 +326,6 @@ PktFilterInet6::receive(const SocketInfo& socket_info) {
     }
 
     return (pkt);
-
 }
 
 int
@@ -251,9 +338,7 @@ PktFilterInet6::send(const Iface&, uint16_t sockfd, const Pkt6Ptr& pkt) {
     memset(&to, 0, sizeof(to));
     to.sin6_family = AF_INET6;
     to.sin6_port = htons(pkt->getRemotePort());
-    memcpy(&to.sin6_addr,
-           &pkt->getRemoteAddr().toBytes()[0],
-           16);
+    pkt->getRemoteAddr().toBytes(reinterpret_cast<uint8_t*>(&to.sin6_addr));
     to.sin6_scope_id = pkt->getIndex();
 
     // Initialize our message header structure.
@@ -10,6 +10,9 @@
 #include <dhcp/pkt_filter6.h>
 #include <boost/scoped_array.hpp>
 
+#include <netinet/in.h>
+#include <sys/socket.h>
+
 namespace isc {
 namespace dhcp {
 
@@ -21,6 +24,11 @@ namespace dhcp {
 class PktFilterInet6 : public PktFilter6 {
 public:
 
+    /// @brief Check if several sockets can be bound to the same address.
+    ///
+    /// @return true if the system defines the SO_REUSEPORT option.
+    virtual bool isReusePortSupported() const;
+
     /// @brief Opens a socket.
     ///
     /// This function opens an IPv6 socket on an interface and binds it to a
@@ -62,6 +70,26 @@ public:
     /// reception.
     virtual Pkt6Ptr receive(const SocketInfo& socket_info);
 
+    /// @brief Receives a batch of DHCPv6 messages on the interface.
+    ///
+    /// On Linux the messages are received with a single recvmmsg call
+    /// which blocks until the first message arrives and returns the
+    /// messages already waiting on the socket, up to @c max_count and
+    /// @c MAX_BATCH_SIZE. The messages are filtered like in @c receive and
+    /// a message which can't be parsed is skipped. On other systems a
+    /// single message is received.
+    ///
+    /// @param socket_info A structure holding socket information.
+    /// @param [out] pkts A vector the received messages are appended to.
+    /// @param max_count A maximum number of messages to receive.
+    ///
+    /// @return A number of appended messages.
+    /// @throw isc::dhcp::SocketReadError if error occurred during reception
+    /// or if no message of the batch could be parsed.
+    virtual size_t receiveBatch(const SocketInfo& socket_info,
+                                std::vector<Pkt6Ptr>& pkts,
+                                size_t max_count);
+
     /// @brief Sends DHCPv6 message through a specified interface and socket.
     ///
     /// The function sends a DHCPv6 message through a specified interface and
@@ -77,7 +105,27 @@ public:
     /// packet.
     virtual int send(const Iface& iface, uint16_t sockfd, const Pkt6Ptr& pkt);
 
+    /// Maximum number of messages received by a single receiveBatch call.
+    static const size_t MAX_BATCH_SIZE = 32;
+
 private:
+
+    /// @brief Creates a DHCPv6 message from received data.
+    ///
+    /// @param socket_info A structure holding socket information.
+    /// @param buf Received data.
+    /// @param len Length of the received data.
+    /// @param from Address the data was received from.
+    /// @param m Message header holding the control messages.
+    ///
+    /// @return A pointer to received message or null if the message was
+    /// filtered out.
+    /// @throw isc::dhcp::SocketReadError if the message is invalid.
+    Pkt6Ptr createPacket(const SocketInfo& socket_info,
+                         const uint8_t* buf, size_t len,
+                         const struct sockaddr_in6& from,
+                         struct msghdr& m);
+
     /// Length of the socket control buffer.
     static const size_t CONTROL_BUF_LEN;
 };
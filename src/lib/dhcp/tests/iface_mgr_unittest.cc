@@ -726,8 +726,8 @@ public:
             pkt4 = ifacemgr->receive4(RECEIVE_WAIT_MS(10));
             ADD_FAILURE() << "receive4 should have failed";
         } catch (const SocketReadError& ex) {
-            EXPECT_EQ(std::string("SELECT interrupted by one invalid sockets,"
-                                  " purged 1 socket descriptors"),
+            EXPECT_EQ(std::string("Socket wait interrupted by an invalid"
+                                  " socket, purged 1 socket descriptors"),
                       std::string(ex.what()));
         } catch (const std::exception& ex) {
             ADD_FAILURE() << "wrong exception thrown: " << ex.what();
@@ -813,8 +813,8 @@ public:
             pkt6 = ifacemgr->receive6(RECEIVE_WAIT_MS(10));
             ADD_FAILURE() << "receive6 should have failed";
         } catch (const SocketReadError& ex) {
-            EXPECT_EQ(std::string("SELECT interrupted by one invalid sockets,"
-                                  " purged 1 socket descriptors"),
+            EXPECT_EQ(std::string("Socket wait interrupted by an invalid"
+                                  " socket, purged 1 socket descriptors"),
                       std::string(ex.what()));
         } catch (const std::exception& ex) {
             ADD_FAILURE() << "wrong exception thrown: " << ex.what();
@@ -2937,6 +2937,56 @@ TEST_F(IfaceMgrTest, DeleteExternalSockets4) {
     close(secondpipe[0]);
 }
 
+// Tests that the sockets registered for the wait in receive4() follow
+// the changes of the external sockets between the calls.
+TEST_F(IfaceMgrTest, ExternalSocketsRegistration4) {
+
+    callback_ok = false;
+    callback2_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    // Create first pipe and register it as extra socket
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[0], my_callback));
+
+    // The first callback is called.
+    EXPECT_EQ(38, write(pipefd[1], "Hi, this is a message sent over a pipe", 38));
+    Pkt4Ptr pkt4;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(pkt4);
+    EXPECT_TRUE(callback_ok);
+    EXPECT_FALSE(callback2_ok);
+
+    // Replace the first pipe by a second one.
+    EXPECT_NO_THROW(ifacemgr->deleteExternalSocket(pipefd[0]));
+    int secondpipe[2];
+    EXPECT_TRUE(pipe(secondpipe) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(secondpipe[0], my_callback2));
+
+    // Only the second callback is called.
+    callback_ok = false;
+    EXPECT_EQ(38, write(secondpipe[1], "Hi, this is a message sent over a pipe", 38));
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(pkt4);
+    EXPECT_FALSE(callback_ok);
+    EXPECT_TRUE(callback2_ok);
+
+    // The first pipe still has data but is no longer watched.
+    callback2_ok = false;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(0, 1000));
+    EXPECT_FALSE(pkt4);
+    EXPECT_FALSE(callback_ok);
+
+    // close both pipe ends
+    close(pipefd[1]);
+    close(pipefd[0]);
+
+    close(secondpipe[1]);
+    close(secondpipe[0]);
+}
+
 // Tests that an existing external socket that becomes invalid
 // is detected and purged, without affecting other sockets.
 // Tests uses receive4() without queuing.
@@ -3386,4 +3436,116 @@ TEST_F(IfaceMgrTest, configureDHCPPacketQueueTest6) {
     ASSERT_FALSE(ifacemgr->isDHCPReceiverRunning());
 }
 
+// Verifies the receiver-threads entry of the queue configuration.
+TEST_F(IfaceMgrTest, configureDHCPPacketQueueReceiverThreads) {
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    // One receiver thread by default.
+    EXPECT_EQ(1, ifacemgr->getReceiverThreads());
+
+    data::ElementPtr queue_control;
+    queue_control = makeQueueConfig(PacketQueueMgr4::DEFAULT_QUEUE_TYPE4, 500, true);
+    queue_control->set("receiver-threads", data::Element::create(4));
+    ASSERT_NO_THROW(ifacemgr->configureDHCPPacketQueue(AF_INET, queue_control));
+    EXPECT_EQ(4, ifacemgr->getReceiverThreads());
+
+    // The value must be an integer between 1 and 64.
+    queue_control->set("receiver-threads", data::Element::create(0));
+    EXPECT_THROW(ifacemgr->configureDHCPPacketQueue(AF_INET, queue_control),
+                 BadValue);
+    queue_control->set("receiver-threads", data::Element::create(65));
+    EXPECT_THROW(ifacemgr->configureDHCPPacketQueue(AF_INET, queue_control),
+                 BadValue);
+    queue_control->set("receiver-threads", data::Element::create("2"));
+    EXPECT_THROW(ifacemgr->configureDHCPPacketQueue(AF_INET, queue_control),
+                 BadValue);
+    EXPECT_EQ(4, ifacemgr->getReceiverThreads());
+
+    // Disabling the queue resets it.
+    queue_control = makeQueueConfig(PacketQueueMgr4::DEFAULT_QUEUE_TYPE4, 500, false);
+    queue_control->set("receiver-threads", data::Element::create(4));
+    ASSERT_NO_THROW(ifacemgr->configureDHCPPacketQueue(AF_INET, queue_control));
+    EXPECT_EQ(1, ifacemgr->getReceiverThreads());
+
+    // The setter enforces the same limits.
+    EXPECT_THROW(ifacemgr->setReceiverThreads(0), BadValue);
+    EXPECT_THROW(ifacemgr->setReceiverThreads(65), BadValue);
+    EXPECT_NO_THROW(ifacemgr->setReceiverThreads(2));
+    EXPECT_EQ(2, ifacemgr->getReceiverThreads());
+}
+
+#if defined (OS_LINUX)
+
+// Verifies that several SO_REUSEPORT sockets are opened on an address
+// when several receiver threads are configured and that the packets
+// received by all receiver threads are returned.
+TEST_F(IfaceMgrTest, reusePortReceivers4) {
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    // Use the loopback interface only.
+    BOOST_FOREACH(IfacePtr iface, ifacemgr->getIfaces()) {
+        iface->inactive4_ = (iface->getName() != LOOPBACK);
+    }
+    ifacemgr->setAllowLoopBack(true);
+
+    data::ElementPtr queue_control;
+    queue_control = makeQueueConfig(PacketQueueMgr4::DEFAULT_QUEUE_TYPE4, 500, true);
+    queue_control->set("receiver-threads", data::Element::create(2));
+    ASSERT_NO_THROW(ifacemgr->configureDHCPPacketQueue(AF_INET, queue_control));
+
+    const uint16_t port = DHCP4_SERVER_PORT + 10000;
+    ASSERT_TRUE(ifacemgr->openSockets4(port, false));
+
+    // Two sockets and two receiver threads.
+    IfacePtr lo = ifacemgr->getIface(LOOPBACK);
+    ASSERT_TRUE(lo);
+    size_t sockets = 0;
+    BOOST_FOREACH(SocketInfo s, lo->getSockets()) {
+        if (s.addr_.isV4()) {
+            ++sockets;
+        }
+    }
+    EXPECT_EQ(2, sockets);
+    ASSERT_TRUE(ifacemgr->isDHCPReceiverRunning());
+    EXPECT_EQ(2, ifacemgr->getDHCPReceiverCount());
+
+    // Send packets from several client ports so as the kernel spreads
+    // them among the sockets.
+    const int clients = 8;
+    Pkt4Ptr send_pkt(new Pkt4(DHCPDISCOVER, 1234));
+    ASSERT_NO_THROW(send_pkt->pack());
+    const util::OutputBuffer& buf = send_pkt->getBuffer();
+    struct sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_port = htons(port);
+    to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    for (int i = 0; i < clients; ++i) {
+        int sock = socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_GE(sock, 0);
+        EXPECT_EQ(static_cast<ssize_t>(buf.getLength()),
+                  sendto(sock, buf.getData(), buf.getLength(), 0,
+                         reinterpret_cast<struct sockaddr*>(&to), sizeof(to)));
+        close(sock);
+    }
+
+    // All of them are received. An empty packet can be returned when
+    // a receiver was marked ready for packets already dequeued.
+    int received = 0;
+    for (int i = 0; (i < 10 * clients) && (received < clients); ++i) {
+        Pkt4Ptr rcv_pkt;
+        ASSERT_NO_THROW(rcv_pkt = ifacemgr->receive4(1));
+        if (rcv_pkt) {
+            EXPECT_EQ(port, rcv_pkt->getLocalPort());
+            ++received;
+        }
+    }
+    EXPECT_EQ(clients, received);
+
+    ifacemgr->closeSockets();
+    EXPECT_EQ(0, ifacemgr->getDHCPReceiverCount());
+}
+
+#endif
+
 }
@@ -0,0 +1,133 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/option.h>
+#include <dhcp/option_arena.h>
+#include <dhcp/option_string.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+// Checks that the options are allocated from the heap without an arena.
+TEST(OptionArenaTest, noArena) {
+    EXPECT_FALSE(OptionArena::getCurrent());
+    size_t count = OptionArena::getArenaCount();
+    OptionPtr option(new Option(Option::V4, 12));
+    EXPECT_EQ(count, OptionArena::getArenaCount());
+
+    // A disabled scope does nothing.
+    OptionArena::Scope scope(false);
+    EXPECT_FALSE(OptionArena::getCurrent());
+}
+
+// Checks that the arena is released with its last option.
+TEST(OptionArenaTest, release) {
+    size_t count = OptionArena::getArenaCount();
+    std::vector<OptionPtr> options;
+    {
+        OptionArena::Scope scope;
+        const OptionArena* arena = OptionArena::getCurrent();
+        ASSERT_TRUE(arena);
+        EXPECT_EQ(count + 1, OptionArena::getArenaCount());
+        EXPECT_EQ(0, arena->getOptionCount());
+        EXPECT_EQ(0, arena->getChunkCount());
+
+        for (uint16_t code = 1; code <= 100; ++code) {
+            options.push_back(OptionPtr(new OptionString(Option::V4, code,
+                                                         "foo")));
+        }
+        EXPECT_EQ(100, arena->getOptionCount());
+        EXPECT_LT(1, arena->getChunkCount());
+
+        // Destroying an option does not release the arena.
+        options.pop_back();
+        EXPECT_EQ(99, arena->getOptionCount());
+    }
+
+    // The options outlive the scope.
+    EXPECT_FALSE(OptionArena::getCurrent());
+    EXPECT_EQ(count + 1, OptionArena::getArenaCount());
+    EXPECT_EQ("foo", boost::dynamic_pointer_cast<OptionString>(options[0])->getValue());
+
+    // Options created after the scope are not in the arena.
+    options.push_back(OptionPtr(new Option(Option::V4, 12)));
+    options.pop_back();
+    EXPECT_EQ(count + 1, OptionArena::getArenaCount());
+
+    options.clear();
+    EXPECT_EQ(count, OptionArena::getArenaCount());
+}
+
+// Checks that an empty arena is released with its scope.
+TEST(OptionArenaTest, empty) {
+    size_t count = OptionArena::getArenaCount();
+    {
+        OptionArena::Scope scope;
+        EXPECT_EQ(count + 1, OptionArena::getArenaCount());
+    }
+    EXPECT_EQ(count, OptionArena::getArenaCount());
+}
+
+// Checks that the scopes can be nested.
+TEST(OptionArenaTest, nested) {
+    OptionPtr outer_option;
+    OptionPtr inner_option;
+    OptionArena::Scope outer;
+    const OptionArena* outer_arena = OptionArena::getCurrent();
+    {
+        OptionArena::Scope inner;
+        const OptionArena* inner_arena = OptionArena::getCurrent();
+        EXPECT_NE(outer_arena, inner_arena);
+        inner_option.reset(new Option(Option::V6, 1));
+        EXPECT_EQ(1, inner_arena->getOptionCount());
+    }
+    EXPECT_EQ(outer_arena, OptionArena::getCurrent());
+    outer_option.reset(new Option(Option::V6, 2));
+    EXPECT_EQ(1, outer_arena->getOptionCount());
+}
+
+// Checks that large options get a chunk of their own.
+TEST(OptionArenaTest, large) {
+    OptionArena::Scope scope;
+    const OptionArena* arena = OptionArena::getCurrent();
+    OptionPtr small(new Option(Option::V6, 1));
+    EXPECT_EQ(1, arena->getChunkCount());
+    void* large = OptionArena::allocate(2 * OptionArena::CHUNK_SIZE);
+    ASSERT_TRUE(large);
+    EXPECT_EQ(2, arena->getChunkCount());
+    EXPECT_EQ(2, arena->getOptionCount());
+    OptionArena::deallocate(large);
+    EXPECT_EQ(1, arena->getOptionCount());
+
+    // Null is ignored.
+    EXPECT_NO_THROW(OptionArena::deallocate(0));
+}
+
+// Checks that the options can be destroyed by another thread.
+TEST(OptionArenaTest, otherThread) {
+    size_t count = OptionArena::getArenaCount();
+    std::vector<OptionPtr> options;
+    {
+        OptionArena::Scope scope;
+        for (uint16_t code = 1; code <= 10; ++code) {
+            options.push_back(OptionPtr(new Option(Option::V6, code)));
+        }
+    }
+    std::thread thread([&options]() { options.clear(); });
+    thread.join();
+    EXPECT_EQ(count, OptionArena::getArenaCount());
+}
+
+} // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -322,6 +322,28 @@ TEST_F(Pkt4Test, fixedFieldsPack) {
     EXPECT_EQ(0, memcmp(exp, got, Pkt4::DHCPV4_PKT_HDR_LEN));
 }
 
+// Checks that the output buffer is sized once and reused by the thread.
+TEST_F(Pkt4Test, packBuffer) {
+    Pkt4Ptr pkt = generateTestPacket1();
+    ASSERT_NO_THROW(pkt->pack());
+
+    // The buffer holds the packet and the END option.
+    EXPECT_EQ(pkt->len() + 1, pkt->getBuffer().getLength());
+    EXPECT_LE(pkt->getBuffer().getLength(), pkt->getBuffer().getCapacity());
+    const void* data = pkt->getBuffer().getData();
+
+    // Packing again reuses the buffer.
+    ASSERT_NO_THROW(pkt->pack());
+    EXPECT_EQ(data, pkt->getBuffer().getData());
+
+    // The next packet packed by the thread gets the memory.
+    pkt.reset();
+    pkt = generateTestPacket1();
+    EXPECT_EQ(0, pkt->getBuffer().getCapacity());
+    ASSERT_NO_THROW(pkt->pack());
+    EXPECT_EQ(data, pkt->getBuffer().getData());
+}
+
 /// TODO Uncomment when ticket #1226 is implemented
 TEST_F(Pkt4Test, fixedFieldsUnpack) {
     vector<uint8_t> expectedFormat = generateTestPacket2();
@@ -690,6 +712,34 @@ TEST_F(Pkt4Test, unpackOptions) {
     verifyParsedOptions(pkt);
 }
 
+// Checks that the options of a packet can be allocated in an arena.
+TEST_F(Pkt4Test, unpackOptionArena) {
+    vector<uint8_t> expectedFormat = generateTestPacket2();
+
+    expectedFormat.push_back(0x63);
+    expectedFormat.push_back(0x82);
+    expectedFormat.push_back(0x53);
+    expectedFormat.push_back(0x63);
+
+    for (size_t i = 0; i < sizeof(v4_opts); i++) {
+        expectedFormat.push_back(v4_opts[i]);
+    }
+
+    size_t count = OptionArena::getArenaCount();
+    boost::shared_ptr<Pkt4> pkt(new Pkt4(&expectedFormat[0],
+                                expectedFormat.size()));
+    EXPECT_FALSE(pkt->isOptionArena());
+    pkt->setOptionArena(true);
+    ASSERT_NO_THROW(pkt->unpack());
+    verifyParsedOptions(pkt);
+
+    // The arena lives as long as the options.
+    EXPECT_FALSE(OptionArena::getCurrent());
+    EXPECT_EQ(count + 1, OptionArena::getArenaCount());
+    pkt.reset();
+    EXPECT_EQ(count, OptionArena::getArenaCount());
+}
+
 // Checks if the code is able to handle a malformed option
 TEST_F(Pkt4Test, unpackMalformed) {
 
@@ -982,6 +1032,43 @@ TEST_F(Pkt4Test, deferredClientClasses) {
     EXPECT_TRUE(pkt.getClasses(true).contains("foo"));
 }
 
+// Tests that the extraction cache holds values only while it is enabled.
+TEST_F(Pkt4Test, extractionCache) {
+    Pkt4 pkt(DHCPDISCOVER, 1234);
+
+    // The cache is disabled by default.
+    EXPECT_FALSE(pkt.isExtractionCache());
+    pkt.cacheExtraction("option[12].hex", "foo");
+    EXPECT_FALSE(pkt.getCachedExtraction("option[12].hex"));
+
+    {
+        ScopedEnableExtractionCache cache(pkt);
+        EXPECT_TRUE(pkt.isExtractionCache());
+        EXPECT_FALSE(pkt.getCachedExtraction("option[12].hex"));
+        pkt.cacheExtraction("option[12].hex", "foo");
+        pkt.cacheExtraction("option[12].text", "");
+        const std::string* value = pkt.getCachedExtraction("option[12].hex");
+        ASSERT_TRUE(value);
+        EXPECT_EQ("foo", *value);
+        value = pkt.getCachedExtraction("option[12].text");
+        ASSERT_TRUE(value);
+        EXPECT_TRUE(value->empty());
+
+        // A nested scope keeps the cache.
+        {
+            ScopedEnableExtractionCache nested(pkt);
+            EXPECT_TRUE(pkt.getCachedExtraction("option[12].hex"));
+        }
+        EXPECT_TRUE(pkt.isExtractionCache());
+        EXPECT_TRUE(pkt.getCachedExtraction("option[12].hex"));
+    }
+
+    // The values are discarded with the scope.
+    EXPECT_FALSE(pkt.isExtractionCache());
+    pkt.setExtractionCache(true);
+    EXPECT_FALSE(pkt.getCachedExtraction("option[12].hex"));
+}
+
 // Tests whether MAC can be obtained and that MAC sources are not
 // confused.
 TEST_F(Pkt4Test, getMAC) {
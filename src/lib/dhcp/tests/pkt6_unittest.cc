@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -826,6 +826,10 @@ TEST_F(Pkt6Test, relayPack) {
               + optRelay1->len(),
               parent->len());
 
+    // The buffer was sized for the packet.
+    EXPECT_EQ(parent->len(), parent->getBuffer().getLength());
+    EXPECT_LE(parent->len(), parent->getBuffer().getCapacity());
+
     // Create second packet,based on assembled data from the first one
     scoped_ptr<Pkt6> clone(new Pkt6(static_cast<const uint8_t*>(
                                     parent->getBuffer().getData()),
@@ -145,4 +145,44 @@ TEST_F(PktFilterInetTest, receive) {
     testRcvdMessageAddressPort(rcvd_pkt);
 }
 
+// This test verifies that the DHCPv4 packets waiting on the socket are
+// received in a batch.
+TEST_F(PktFilterInetTest, receiveBatch) {
+
+    // Packets will be received over loopback interface.
+    Iface iface(ifname_, ifindex_);
+    IOAddress addr("127.0.0.1");
+
+    // Create an instance of the class which we are testing.
+    PktFilterInet pkt_filter;
+    sock_info_ = pkt_filter.openSocket(iface, addr, PORT, false, false);
+    ASSERT_GE(sock_info_.sockfd_, 0);
+
+    // Send three DHCPv4 messages to the local loopback address and
+    // server's port.
+    sendMessage();
+    sendMessage();
+    sendMessage();
+
+    // Receive the packets.
+    std::vector<Pkt4Ptr> pkts;
+    size_t count = 0;
+    ASSERT_NO_THROW(count = pkt_filter.receiveBatch(iface, sock_info_,
+                                                    pkts, 8));
+#if defined (OS_LINUX)
+    // All packets are received at once.
+    EXPECT_EQ(3, count);
+#endif
+    ASSERT_EQ(count, pkts.size());
+    ASSERT_LE(1, count);
+
+    // Check that the packets have been correctly received.
+    for (auto rcvd_pkt : pkts) {
+        ASSERT_TRUE(rcvd_pkt);
+        ASSERT_NO_THROW(rcvd_pkt->unpack());
+        testRcvdMessage(rcvd_pkt);
+        testRcvdMessageAddressPort(rcvd_pkt);
+    }
+}
+
 } // anonymous namespace
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <asiolink/addr_utilities.h>
 #include <dhcp/dhcp6.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
@@ -26,6 +27,7 @@
 #include <dhcpsrv/callout_handle_store.h>
 #include <stats/stats_mgr.h>
 #include <util/encode/hex.h>
+#include <util/hash.h>
 #include <util/stopwatch.h>
 #include <hooks/server_hooks.h>
 #include <hooks/hooks_manager.h>
@@ -90,6 +92,133 @@ AllocEngineHooks Hooks;
 namespace isc {
 namespace dhcp {
 
+uint64_t
+AllocEngine::Allocator::getPoolOffset(const PoolPtr& pool,
+                                      const IOAddress& address,
+                                      bool prefix) {
+    if (address.isV4()) {
+        return (address.toUint32() - pool->getFirstAddress().toUint32());
+    }
+
+    // Get the difference as 16 bytes and shift it right by the number
+    // of bits which are not in the delegated prefix.
+    const std::vector<uint8_t>& diff =
+        IOAddress::subtract(address, pool->getFirstAddress()).toBytes();
+    unsigned shift = 0;
+    if (prefix) {
+        Pool6Ptr pool6 = boost::dynamic_pointer_cast<Pool6>(pool);
+        if (!pool6) {
+            // Something is gravely wrong here
+            isc_throw(Unexpected, "Wrong type of pool: " << pool->toText()
+                      << " is not Pool6");
+        }
+        shift = 128 - pool6->getLength();
+    }
+    uint64_t offset = 0;
+    for (unsigned bit = shift; (bit < 128) && (bit < shift + 64); ++bit) {
+        // Bit 0 is the least significant bit of the last byte.
+        if (diff[V6ADDRESS_LEN - 1 - bit / 8] & (1 << (bit % 8))) {
+            offset |= static_cast<uint64_t>(1) << (bit - shift);
+        }
+    }
+    return (offset);
+}
+
+IOAddress
+AllocEngine::Allocator::getPoolAddress(const PoolPtr& pool,
+                                       uint64_t offset,
+                                       bool prefix) {
+    if (!prefix) {
+        return (offsetAddress(pool->getFirstAddress(), offset));
+    }
+    Pool6Ptr pool6 = boost::dynamic_pointer_cast<Pool6>(pool);
+    if (!pool6) {
+        // Something is gravely wrong here
+        isc_throw(Unexpected, "Wrong type of pool: " << pool->toText()
+                  << " is not Pool6");
+    }
+    return (offsetPrefix(pool6->getFirstAddress(), pool6->getLength(), offset));
+}
+
+bool
+AllocEngine::Allocator::hasFreeLeaseIndex(const PoolCollection& pools,
+                                          const ClientClasses& client_classes) {
+    bool found = false;
+    for (auto const& pool : pools) {
+        if (!pool->clientSupported(client_classes)) {
+            continue;
+        }
+        if (!pool->getFreeLeaseIndex()) {
+            return (false);
+        }
+        found = true;
+    }
+    return (found);
+}
+
+void
+AllocEngine::Allocator::updateAddress(const SubnetPtr& subnet,
+                                      const IOAddress& address,
+                                      bool used) {
+    PoolPtr pool = subnet->getPool(pool_type_, address, false);
+    if (!pool) {
+        return;
+    }
+    uint64_t offset = getPoolOffset(pool, address,
+                                    pool_type_ == Lease::TYPE_PD);
+    PoolFreeLeaseIndexPtr index = pool->getFreeLeaseIndex();
+    if (index) {
+        if (used) {
+            index->setUsed(offset);
+        } else {
+            index->setFree(offset);
+        }
+    }
+    updatePoolState(pool, offset, used);
+}
+
+void
+AllocEngine::Allocator::buildStateInternal(const SubnetPtr& subnet,
+                                           bool free_lease_index) {
+    const PoolCollection& pools = subnet->getPools(pool_type_);
+
+    // Give new states to the pools.
+    bool tracked = false;
+    for (auto const& pool : pools) {
+        PoolFreeLeaseIndexPtr index;
+        if (free_lease_index) {
+            index.reset(new PoolFreeLeaseIndex(pool->getCapacity()));
+        }
+        pool->setFreeLeaseIndex(index);
+        initPoolState(subnet, pool);
+        if (pool->getFreeLeaseIndex() || pool->getAllocationState()) {
+            tracked = true;
+        }
+    }
+    if (!tracked) {
+        return;
+    }
+
+    // Mark the addresses of the active leases as used. Expired leases
+    // are left free as the allocation engine may reuse them.
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    if (pool_type_ == Lease::TYPE_V4) {
+        Lease4Collection leases = lease_mgr.getLeases4(subnet->getID());
+        for (auto const& lease : leases) {
+            if (!lease->expired()) {
+                updateAddress(subnet, lease->addr_, true);
+            }
+        }
+    } else {
+        Lease6Collection leases = lease_mgr.getLeases6(subnet->getID());
+        for (auto const& lease : leases) {
+            if ((lease->type_ == pool_type_) && !lease->expired()) {
+                updateAddress(subnet, lease->addr_, true);
+            }
+        }
+    }
+}
+
 AllocEngine::IterativeAllocator::IterativeAllocator(Lease::Type lease_type)
     : Allocator(lease_type) {
 }
@@ -158,6 +287,47 @@ AllocEngine::IterativeAllocator::increaseAddress(const isc::asiolink::IOAddress&
     }
 }
 
+bool
+AllocEngine::IterativeAllocator::pickFreeAddress(const SubnetPtr& subnet,
+                                                 const ClientClasses& client_classes,
+                                                 IOAddress& address) {
+    // Is this prefix allocation?
+    bool prefix = pool_type_ == Lease::TYPE_PD;
+
+    const PoolCollection& pools = subnet->getPools(pool_type_);
+
+    // The search starts after the last allocated address, else at the
+    // beginning of the first pool.
+    IOAddress last = subnet->getLastAllocated(pool_type_);
+    size_t start_pool = 0;
+    uint64_t start = 0;
+    for (size_t i = 0; i < pools.size(); ++i) {
+        if (pools[i]->clientSupported(client_classes) &&
+            pools[i]->inRange(last)) {
+            start_pool = i;
+            start = getPoolOffset(pools[i], last, prefix) + 1;
+            break;
+        }
+    }
+
+    // Take the first free address from there, wrapping around to the
+    // beginning of the pool the search started in.
+    for (size_t n = 0; n <= pools.size(); ++n) {
+        const PoolPtr& pool = pools[(start_pool + n) % pools.size()];
+        uint64_t offset = 0;
+        if (pool->clientSupported(client_classes) &&
+            pool->getFreeLeaseIndex()->findFree(n == 0 ? start : 0, offset)) {
+            address = getPoolAddress(pool, offset, prefix);
+            pool->setLastAllocated(address);
+            subnet->setLastAllocated(pool_type_, address);
+            return (true);
+        }
+    }
+
+    // No free address in the index of the allowed pools.
+    return (false);
+}
+
 isc::asiolink::IOAddress
 AllocEngine::IterativeAllocator::pickAddressInternal(const SubnetPtr& subnet,
                                                      const ClientClasses& client_classes,
@@ -180,6 +350,16 @@ AllocEngine::IterativeAllocator::pickAddressInternal(const SubnetPtr& subnet,
         isc_throw(AllocFailed, "No pools defined in selected subnet");
     }
 
+    // Skip the used addresses when the pools know them. When the index
+    // has no free address left, e.g. because some leases expired or were
+    // deleted behind the allocation engine, scan the pools.
+    if (hasFreeLeaseIndex(pools, client_classes)) {
+        IOAddress address(last);
+        if (pickFreeAddress(subnet, client_classes, address)) {
+            return (address);
+        }
+    }
+
     // first we need to find a pool the last address belongs to.
     PoolCollection::const_iterator it;
     PoolCollection::const_iterator first = pools.end();
@@ -288,28 +468,237 @@ AllocEngine::IterativeAllocator::pickAddressInternal(const SubnetPtr& subnet,
 
 AllocEngine::HashedAllocator::HashedAllocator(Lease::Type lease_type)
     : Allocator(lease_type) {
-    isc_throw(NotImplemented, "Hashed allocator is not implemented");
 }
 
 isc::asiolink::IOAddress
-AllocEngine::HashedAllocator::pickAddressInternal(const SubnetPtr&,
-                                                  const ClientClasses&,
-                                                  const DuidPtr&,
-                                                  const IOAddress&) {
-    isc_throw(NotImplemented, "Hashed allocator is not implemented");
+AllocEngine::HashedAllocator::pickAddressInternal(const SubnetPtr& subnet,
+                                                  const ClientClasses& client_classes,
+                                                  const DuidPtr& duid,
+                                                  const IOAddress& hint) {
+    // Is this prefix allocation?
+    bool prefix = pool_type_ == Lease::TYPE_PD;
+
+    const PoolCollection& pools = subnet->getPools(pool_type_);
+
+    if (pools.empty()) {
+        isc_throw(AllocFailed, "No pools defined in selected subnet");
+    }
+
+    // The allowed pools are seen as one range of addresses (or prefixes)
+    // so an offset in this range selects a pool and an address in it.
+    // Compute the size of the range and the offset of the hint when
+    // it belongs to one of the allowed pools.
+    uint64_t total = 0;
+    uint64_t offset = 0;
+    bool hint_found = false;
+    for (auto const& pool : pools) {
+        if (!pool->clientSupported(client_classes)) {
+            continue;
+        }
+        if (!hint_found && pool->inRange(hint)) {
+            offset = total + getPoolOffset(pool, hint, prefix);
+            hint_found = true;
+        }
+        uint64_t capacity = pool->getCapacity();
+        if (capacity > std::numeric_limits<uint64_t>::max() - total) {
+            total = std::numeric_limits<uint64_t>::max();
+        } else {
+            total += capacity;
+        }
+    }
+
+    // Caller checked this cannot happen
+    if (total == 0) {
+        isc_throw(AllocFailed, "No allowed pools defined in selected subnet");
+    }
+
+    if (hint_found) {
+        // Probe the next candidate after the previous one.
+        offset = (offset + 1) % total;
+    } else {
+        // First candidate: it depends only on the client identifier.
+        uint64_t hash = 0;
+        if (duid) {
+            const std::vector<uint8_t>& id = duid->getDuid();
+            if (!id.empty()) {
+                hash = Hash64::hash(&id[0], id.size());
+            }
+        }
+        offset = hash % total;
+    }
+
+    // Find the pool the offset points into.
+    size_t start_pool = 0;
+    for (; start_pool < pools.size(); ++start_pool) {
+        const PoolPtr& pool = pools[start_pool];
+        if (!pool->clientSupported(client_classes)) {
+            continue;
+        }
+        if (offset < pool->getCapacity()) {
+            break;
+        }
+        offset -= pool->getCapacity();
+    }
+
+    // Skip the used addresses when the pools know them: take the first
+    // free address at or after the offset, wrapping around to the
+    // beginning of the pool the offset points into. When the index has
+    // no free address left, e.g. because some leases expired or were
+    // deleted behind the allocation engine, the address at the offset is
+    // probed.
+    if ((start_pool < pools.size()) &&
+        hasFreeLeaseIndex(pools, client_classes)) {
+        for (size_t n = 0; n <= pools.size(); ++n) {
+            const PoolPtr& pool = pools[(start_pool + n) % pools.size()];
+            uint64_t position = 0;
+            if (pool->clientSupported(client_classes) &&
+                pool->getFreeLeaseIndex()->findFree(n == 0 ? offset : 0,
+                                                    position)) {
+                return (getPoolAddress(pool, position, prefix));
+            }
+        }
+    }
+
+    if (start_pool < pools.size()) {
+        return (getPoolAddress(pools[start_pool], offset, prefix));
+    }
+
+    // Can't happen as the offset is lower than the sum of capacities.
+    isc_throw(Unexpected, "Hashed allocator failed to find an address in "
+              "subnet " << subnet->toText());
 }
 
 AllocEngine::RandomAllocator::RandomAllocator(Lease::Type lease_type)
-    : Allocator(lease_type) {
-    isc_throw(NotImplemented, "Random allocator is not implemented");
+    : Allocator(lease_type), generator_(std::random_device()()) {
+}
+
+uint64_t
+AllocEngine::RandomAllocator::random(uint64_t limit) {
+    std::uniform_int_distribution<uint64_t> dist(0, limit - 1);
+    return (dist(generator_));
+}
+
+void
+AllocEngine::RandomAllocator::initPoolState(const SubnetPtr& subnet,
+                                            const PoolPtr& pool) {
+    if (pool->getCapacity() <= MAX_BITMAP_CAPACITY) {
+        PoolFreeBitmapPtr bitmap(new PoolFreeBitmap(pool->getCapacity()));
+        pool->setAllocationState(bitmap);
+        return;
+    }
+
+    // Too large for a bitmap: the free lease index is used if any.
+    pool->setAllocationState(PoolAllocationStatePtr());
+    if (!pool->getFreeLeaseIndex()) {
+        LOG_INFO(alloc_engine_logger, ALLOC_ENGINE_RANDOM_POOL_NOT_TRACKED)
+            .arg(pool->toText())
+            .arg(subnet->toText());
+    }
+}
+
+PoolFreeBitmapPtr
+AllocEngine::RandomAllocator::getBitmap(const PoolPtr& pool) {
+    return (boost::dynamic_pointer_cast<PoolFreeBitmap>(pool->getAllocationState()));
 }
 
 isc::asiolink::IOAddress
-AllocEngine::RandomAllocator::pickAddressInternal(const SubnetPtr&,
-                                                  const ClientClasses&,
+AllocEngine::RandomAllocator::pickAddressInternal(const SubnetPtr& subnet,
+                                                  const ClientClasses& client_classes,
                                                   const DuidPtr&,
                                                   const IOAddress&) {
-    isc_throw(NotImplemented, "Random allocator is not implemented");
+    // Is this prefix allocation?
+    bool prefix = pool_type_ == Lease::TYPE_PD;
+
+    const PoolCollection& pools = subnet->getPools(pool_type_);
+
+    if (pools.empty()) {
+        isc_throw(AllocFailed, "No pools defined in selected subnet");
+    }
+
+    // Collect the allowed pools with the number of free addresses in each.
+    // Pools without bitmap use their free lease index, else count all
+    // their addresses as free.
+    std::vector<PoolPtr> allowed;
+    std::vector<PoolFreeBitmapPtr> bitmaps;
+    std::vector<uint64_t> free_counts;
+    uint64_t total = 0;
+    for (auto const& pool : pools) {
+        if (!pool->clientSupported(client_classes)) {
+            continue;
+        }
+        PoolFreeBitmapPtr bitmap = getBitmap(pool);
+        PoolFreeLeaseIndexPtr index = pool->getFreeLeaseIndex();
+        allowed.push_back(pool);
+        bitmaps.push_back(bitmap);
+        if (bitmap) {
+            free_counts.push_back(bitmap->getFreeCount());
+        } else if (index) {
+            free_counts.push_back(index->getFreeCount());
+        } else {
+            free_counts.push_back(pool->getCapacity());
+        }
+        if (free_counts.back() > std::numeric_limits<uint64_t>::max() - total) {
+            total = std::numeric_limits<uint64_t>::max();
+        } else {
+            total += free_counts.back();
+        }
+    }
+
+    // Caller checked this cannot happen
+    if (allowed.empty()) {
+        isc_throw(AllocFailed, "No allowed pools defined in selected subnet");
+    }
+
+    if (total == 0) {
+        // Nothing is free: return a random address the allocation engine
+        // will reject unless its lease has expired in the meantime.
+        PoolPtr pool = allowed[random(allowed.size())];
+        return (getPoolAddress(pool, random(pool->getCapacity()), prefix));
+    }
+
+    // Select a pool with a probability proportional to its number of free
+    // addresses, then a free address in it. The bitmap is not changed:
+    // the address becomes used only when its lease is committed.
+    uint64_t offset = random(total);
+    for (size_t i = 0; i < allowed.size(); ++i) {
+        if (offset >= free_counts[i]) {
+            offset -= free_counts[i];
+            continue;
+        }
+        const PoolPtr& pool = allowed[i];
+        const PoolFreeBitmapPtr& bitmap = bitmaps[i];
+        uint64_t position = random(pool->getCapacity());
+        if (bitmap) {
+            position = bitmap->findFree(position);
+        } else {
+            // The first free address at or after the position, wrapping
+            // around at the end of the pool.
+            PoolFreeLeaseIndexPtr index = pool->getFreeLeaseIndex();
+            if (index && !index->findFree(position, position)) {
+                index->findFree(0, position);
+            }
+        }
+        return (getPoolAddress(pool, position, prefix));
+    }
+
+    // Can't happen as the offset is lower than the sum of free counts.
+    isc_throw(Unexpected, "Random allocator failed to find an address in "
+              "subnet " << subnet->toText());
+}
+
+void
+AllocEngine::RandomAllocator::updatePoolState(const PoolPtr& pool,
+                                              uint64_t offset,
+                                              bool used) {
+    PoolFreeBitmapPtr bitmap = getBitmap(pool);
+    if (!bitmap) {
+        return;
+    }
+    if (used) {
+        bitmap->setUsed(offset);
+    } else {
+        bitmap->setFree(offset);
+    }
 }
 
 AllocEngine::AllocEngine(AllocType engine_type, uint64_t attempts,
@@ -317,50 +706,55 @@ AllocEngine::AllocEngine(AllocType engine_type, uint64_t attempts,
     : attempts_(attempts), incomplete_v4_reclamations_(0),
       incomplete_v6_reclamations_(0) {
 
-    // Choose the basic (normal address) lease type
-    Lease::Type basic_type = ipv6 ? Lease::TYPE_NA : Lease::TYPE_V4;
+    // Choose the pool types to handle: normal addresses, and for IPv6
+    // also temporary addresses and prefixes.
+    std::vector<Lease::Type> types;
+    if (ipv6) {
+        types.push_back(Lease::TYPE_NA);
+        types.push_back(Lease::TYPE_TA);
+        types.push_back(Lease::TYPE_PD);
+    } else {
+        types.push_back(Lease::TYPE_V4);
+    }
 
-    // Initialize normal address allocators
+    // Initialize allocators of all types as they can be selected per
+    // subnet by configuration.
+    for (auto const& type : types) {
+        type_allocators_[ALLOC_ITERATIVE][type].reset(new IterativeAllocator(type));
+        type_allocators_[ALLOC_HASHED][type].reset(new HashedAllocator(type));
+        type_allocators_[ALLOC_RANDOM][type].reset(new RandomAllocator(type));
+    }
+
+    // Select the default allocators.
     switch (engine_type) {
     case ALLOC_ITERATIVE:
-        allocators_[basic_type] = AllocatorPtr(new IterativeAllocator(basic_type));
-        break;
     case ALLOC_HASHED:
-        allocators_[basic_type] = AllocatorPtr(new HashedAllocator(basic_type));
-        break;
     case ALLOC_RANDOM:
-        allocators_[basic_type] = AllocatorPtr(new RandomAllocator(basic_type));
+        allocators_ = type_allocators_[engine_type];
         break;
     default:
         isc_throw(BadValue, "Invalid/unsupported allocation algorithm");
     }
 
-    // If this is IPv6 allocation engine, initialize also temporary addrs
-    // and prefixes
-    if (ipv6) {
-        switch (engine_type) {
-        case ALLOC_ITERATIVE:
-            allocators_[Lease::TYPE_TA] = AllocatorPtr(new IterativeAllocator(Lease::TYPE_TA));
-            allocators_[Lease::TYPE_PD] = AllocatorPtr(new IterativeAllocator(Lease::TYPE_PD));
-            break;
-        case ALLOC_HASHED:
-            allocators_[Lease::TYPE_TA] = AllocatorPtr(new HashedAllocator(Lease::TYPE_TA));
-            allocators_[Lease::TYPE_PD] = AllocatorPtr(new HashedAllocator(Lease::TYPE_PD));
-            break;
-        case ALLOC_RANDOM:
-            allocators_[Lease::TYPE_TA] = AllocatorPtr(new RandomAllocator(Lease::TYPE_TA));
-            allocators_[Lease::TYPE_PD] = AllocatorPtr(new RandomAllocator(Lease::TYPE_PD));
-            break;
-        default:
-            isc_throw(BadValue, "Invalid/unsupported allocation algorithm");
-        }
-    }
-
     // Register hook points
     hook_index_lease4_select_ = Hooks.hook_index_lease4_select_;
     hook_index_lease6_select_ = Hooks.hook_index_lease6_select_;
 }
 
+AllocEngine::AllocType
+AllocEngine::allocTypeFromText(const std::string& allocator_type) {
+    if (allocator_type == "iterative") {
+        return (ALLOC_ITERATIVE);
+    } else if (allocator_type == "hashed") {
+        return (ALLOC_HASHED);
+    } else if (allocator_type == "random") {
+        return (ALLOC_RANDOM);
+    }
+    isc_throw(BadValue, "unsupported allocator '" << allocator_type
+              << "', supported allocators are: iterative, hashed and"
+              " random");
+}
+
 AllocEngine::AllocatorPtr AllocEngine::getAllocator(Lease::Type type) {
     std::map<Lease::Type, AllocatorPtr>::const_iterator alloc = allocators_.find(type);
 
@@ -371,6 +765,77 @@ AllocEngine::AllocatorPtr AllocEngine::getAllocator(Lease::Type type) {
     return (alloc->second);
 }
 
+AllocEngine::AllocatorPtr
+AllocEngine::getAllocator(Lease::Type type, const SubnetPtr& subnet) {
+    util::Optional<std::string> allocator_type;
+    if (subnet) {
+        allocator_type = subnet->getAllocatorType();
+    }
+    if (allocator_type.unspecified() || allocator_type.get().empty()) {
+        return (getAllocator(type));
+    }
+
+    auto allocators = type_allocators_.find(allocTypeFromText(allocator_type));
+    if (allocators == type_allocators_.end()) {
+        isc_throw(BadValue, "No " << allocator_type.get() << " allocator "
+                  "initialized");
+    }
+    std::map<Lease::Type, AllocatorPtr>::const_iterator alloc =
+        allocators->second.find(type);
+
+    if (alloc == allocators->second.end()) {
+        isc_throw(BadValue, "No " << allocator_type.get() << " allocator "
+                  "initialized for pool type " << Lease::typeToText(type));
+    }
+    return (alloc->second);
+}
+
+void
+AllocEngine::freeLeaseAddress(const Lease4Ptr& lease) {
+    Subnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets4()->getSubnet(lease->subnet_id_);
+    if (subnet) {
+        getAllocator(Lease::TYPE_V4, subnet)->freeAddress(subnet, lease->addr_);
+    }
+}
+
+void
+AllocEngine::freeLeaseAddress(const Lease6Ptr& lease) {
+    Subnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets6()->getSubnet(lease->subnet_id_);
+    if (subnet) {
+        getAllocator(lease->type_, subnet)->freeAddress(subnet, lease->addr_);
+    }
+}
+
+void
+AllocEngine::buildAllocatorStates(const SrvConfigPtr& config) {
+    // The free lease indexes are enabled by configuration.
+    bool free_lease_index = false;
+    ConstElementPtr enabled = config->getConfiguredGlobal("free-lease-index");
+    if (enabled) {
+        free_lease_index = enabled->boolValue();
+    }
+
+    if (allocators_.count(Lease::TYPE_V4) > 0) {
+        const Subnet4Collection* subnets =
+            config->getCfgSubnets4()->getAll();
+        for (auto const& subnet : *subnets) {
+            getAllocator(Lease::TYPE_V4, subnet)->
+                buildState(subnet, free_lease_index);
+        }
+        return;
+    }
+
+    const Subnet6Collection* subnets = config->getCfgSubnets6()->getAll();
+    for (auto const& subnet : *subnets) {
+        for (auto const& alloc : allocators_) {
+            getAllocator(alloc.first, subnet)->
+                buildState(subnet, free_lease_index);
+        }
+    }
+}
+
 } // end of namespace isc::dhcp
 } // end of namespace isc
 
@@ -844,13 +1309,6 @@ AllocEngine::allocateLeases6(ClientContext6& ctx) {
 Lease6Collection
 AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
 
-    AllocatorPtr allocator = getAllocator(ctx.currentIA().type_);
-
-    if (!allocator) {
-        isc_throw(InvalidOperation, "No allocator specified for "
-                  << Lease6::typeToText(ctx.currentIA().type_));
-    }
-
     Lease6Collection leases;
 
     IOAddress hint = IOAddress::IPV6_ZERO_ADDRESS();
@@ -1018,6 +1476,13 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
         uint64_t max_attempts = (attempts_ > 0 ? attempts_  : possible_attempts);
         Network::HRMode hr_mode = subnet->getHostReservationMode();
 
+        // The allocator can be configured per subnet.
+        AllocatorPtr allocator = getAllocator(ctx.currentIA().type_, subnet);
+
+        // Address returned by the previous attempt: stateless allocators
+        // use it to continue probing after it.
+        IOAddress last_candidate = IOAddress::IPV6_ZERO_ADDRESS();
+
         // Set the default status code in case the lease6_select callouts
         // do not exist and the callout handle has a status returned by
         // any of the callouts already invoked for this packet.
@@ -1032,7 +1497,8 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
             IOAddress candidate = allocator->pickAddress(subnet,
                                                          ctx.query_->getClasses(),
                                                          ctx.duid_,
-                                                         hint);
+                                                         last_candidate);
+            last_candidate = candidate;
             // The first step is to find out prefix length. It is 128 for
             // non-PD leases.
             uint8_t prefix_len = 128;
@@ -1050,6 +1516,11 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
             Lease6Ptr existing = LeaseMgrFactory::instance().getLease6(ctx.currentIA().type_,
                                                                        candidate);
 
+            // An active lease is committed: tell the allocator.
+            if (existing && !existing->expired()) {
+                allocator->useAddress(subnet, candidate);
+            }
+
             if (!existing) {
                 /// In-pool reservations: Check if this address is reserved for someone
                 /// else. There is no need to check for whom it is reserved, because if
@@ -1749,6 +2220,8 @@ AllocEngine::reuseExpiredLease(Lease6Ptr& expired, ClientContext6& ctx,
 
         // for REQUEST we do update the lease
         LeaseMgrFactory::instance().updateLease6(expired);
+        getAllocator(ctx.currentIA().type_, ctx.subnet_)->
+            useAddress(ctx.subnet_, expired->addr_);
 
         // If the lease is in the current subnet we need to account
         // for the re-assignment of The lease.
@@ -1850,6 +2323,9 @@ Lease6Ptr AllocEngine::createLease6(ClientContext6& ctx,
         bool status = LeaseMgrFactory::instance().addLease(lease);
 
         if (status) {
+            getAllocator(ctx.currentIA().type_, ctx.subnet_)->
+                useAddress(ctx.subnet_, lease->addr_);
+
             // The lease insertion succeeded - if the lease is in the
             // current subnet lets bump up the statistic.
             if (ctx.subnet_->inPool(ctx.currentIA().type_, addr)) {
@@ -2544,6 +3020,11 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
         }
     }
 
+    // Tell the allocator serving the subnet the address is free again.
+    if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
+        freeLeaseAddress(lease);
+    }
+
     // Update statistics.
 
     // Decrease number of assigned leases.
@@ -2640,6 +3121,11 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
         }
     }
 
+    // Tell the allocator serving the subnet the address is free again.
+    if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
+        freeLeaseAddress(lease);
+    }
+
     // Update statistics.
 
     // Decrease number of assigned addresses.
@@ -3663,6 +4149,9 @@ AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
         // That is a real (REQUEST) allocation
         bool status = LeaseMgrFactory::instance().addLease(lease);
         if (status) {
+            getAllocator(Lease::TYPE_V4, ctx.subnet_)->
+                useAddress(ctx.subnet_, lease->addr_);
+
 
             // The lease insertion succeeded, let's bump up the statistic.
             StatsMgr::instance().addValue(
@@ -3871,6 +4360,8 @@ AllocEngine::reuseExpiredLease4(Lease4Ptr& expired,
     if (!ctx.fake_allocation_) {
         // for REQUEST we do update the lease
         LeaseMgrFactory::instance().updateLease4(expired);
+        getAllocator(Lease::TYPE_V4, ctx.subnet_)->
+            useAddress(ctx.subnet_, expired->addr_);
 
         // We need to account for the re-assignment of The lease.
         StatsMgr::instance().addValue(
@@ -3913,7 +4404,6 @@ AllocEngine::allocateOrReuseLease4(const IOAddress& candidate, ClientContext4& c
 Lease4Ptr
 AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
     Lease4Ptr new_lease;
-    AllocatorPtr allocator = getAllocator(Lease::TYPE_V4);
     Subnet4Ptr subnet = ctx.subnet_;
 
     // Need to check if the subnet belongs to a shared network. If so,
@@ -3946,6 +4436,20 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
             client_id = ctx.clientid_;
         }
 
+        // The client identifier is given to the allocator: when it is not
+        // used to identify the client use the hardware address instead.
+        DuidPtr client_key = client_id;
+        if (!client_key && ctx.hwaddr_ && !ctx.hwaddr_->hwaddr_.empty()) {
+            client_key.reset(new DUID(ctx.hwaddr_->hwaddr_));
+        }
+
+        // The allocator can be configured per subnet.
+        AllocatorPtr allocator = getAllocator(Lease::TYPE_V4, subnet);
+
+        // Address returned by the previous attempt: stateless allocators
+        // use it to continue probing after it.
+        IOAddress last_candidate = IOAddress::IPV4_ZERO_ADDRESS();
+
         uint64_t possible_attempts =
             subnet->getPoolCapacity(Lease::TYPE_V4,
                                     ctx.query_->getClasses());
@@ -3960,10 +4464,15 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
         for (uint64_t i = 0; i < max_attempts; ++i) {
             IOAddress candidate = allocator->pickAddress(subnet,
                                                          ctx.query_->getClasses(),
-                                                         client_id,
-                                                         ctx.requested_address_);
+                                                         client_key,
+                                                         last_candidate);
+            last_candidate = candidate;
             // Check for an existing lease for the candidate address.
             Lease4Ptr exist_lease = LeaseMgrFactory::instance().getLease4(candidate);
+            // An active lease is committed: tell the allocator.
+            if (exist_lease && !exist_lease->expired()) {
+                allocator->useAddress(subnet, candidate);
+            }
             if (!exist_lease) {
                 // No existing lease, is it reserved?
                 if (!addressReserved(candidate, ctx)) {
@@ -20,6 +20,7 @@
 #include <dhcpsrv/host.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/pool_free_bitmap.h>
 #include <dhcpsrv/srv_config.h>
 #include <hooks/callout_handle.h>
 #include <util/multi_threading_mgr.h>
@@ -31,6 +32,7 @@
 #include <list>
 #include <map>
 #include <mutex>
+#include <random>
 #include <set>
 #include <utility>
 
@@ -89,8 +91,9 @@ protected:
         ///
         /// @param subnet next address will be returned from pool of that subnet
         /// @param client_classes list of classes client belongs to
-        /// @param duid Client's DUID
-        /// @param hint Client's hint
+        /// @param duid Client's DUID (or client identifier for DHCPv4)
+        /// @param hint the address returned by the previous call for the
+        /// same client and subnet, or the zero address for the first call
         ///
         /// @return the next address
         virtual isc::asiolink::IOAddress
@@ -106,6 +109,69 @@ protected:
             }
         }
 
+        /// @brief Tells the allocator an address or prefix became free
+        ///
+        /// This method is called when a lease is released or reclaimed so
+        /// the free lease index of the pool and allocators tracking the
+        /// free addresses of pools can return the address (or prefix) to
+        /// the free set.
+        ///
+        /// @param subnet subnet the address belongs to
+        /// @param address the freed address or prefix
+        virtual void
+        freeAddress(const SubnetPtr& subnet,
+                    const isc::asiolink::IOAddress& address) {
+            if (isc::util::MultiThreadingMgr::instance().getMode()) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                updateAddress(subnet, address, false);
+            } else {
+                updateAddress(subnet, address, false);
+            }
+        }
+
+        /// @brief Tells the allocator an address or prefix became used
+        ///
+        /// This method is called when a lease is committed to the lease
+        /// database so the free lease index of the pool and allocators
+        /// tracking the free addresses of pools can take the address (or
+        /// prefix) out of the free set.
+        ///
+        /// @param subnet subnet the address belongs to
+        /// @param address the used address or prefix
+        virtual void
+        useAddress(const SubnetPtr& subnet,
+                   const isc::asiolink::IOAddress& address) {
+            if (isc::util::MultiThreadingMgr::instance().getMode()) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                updateAddress(subnet, address, true);
+            } else {
+                updateAddress(subnet, address, true);
+            }
+        }
+
+        /// @brief Builds the allocation state of the pools of a subnet
+        ///
+        /// This method is called when the configuration is applied, after
+        /// the lease database was opened, so the per pool state is built
+        /// from the leases outside the packet path. The leases of the
+        /// subnet are fetched once and the addresses of the active ones
+        /// are marked as used in the free lease index of each pool and in
+        /// the state of the allocator. Expired leases are left free as the
+        /// allocation engine may reuse them.
+        ///
+        /// @param subnet subnet the pools of which get a new state
+        /// @param free_lease_index true when the pools get a free lease
+        /// index, false when their index is removed
+        virtual void
+        buildState(const SubnetPtr& subnet, bool free_lease_index) {
+            if (isc::util::MultiThreadingMgr::instance().getMode()) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                buildStateInternal(subnet, free_lease_index);
+            } else {
+                buildStateInternal(subnet, free_lease_index);
+            }
+        }
+
         /// @brief Default constructor
         ///
         /// Specifies which type of leases this allocator will assign
@@ -124,8 +190,88 @@ protected:
                             const DuidPtr& duid,
                             const isc::asiolink::IOAddress& hint) = 0;
 
+        /// @brief Marks an address or prefix as used or free
+        ///
+        /// The free lease index of the pool is updated, then the state of
+        /// the allocator.
+        ///
+        /// @param subnet subnet the address belongs to
+        /// @param address the address or prefix
+        /// @param used true when the address became used, false when it
+        /// became free
+        void updateAddress(const SubnetPtr& subnet,
+                           const isc::asiolink::IOAddress& address,
+                           bool used);
+
+        /// @brief Builds the allocation state of the pools of a subnet
+        ///
+        /// @param subnet subnet the pools of which get a new state
+        /// @param free_lease_index true when the pools get a free lease
+        /// index
+        void buildStateInternal(const SubnetPtr& subnet,
+                                bool free_lease_index);
+
+        /// @brief Initializes the allocator state of a pool
+        ///
+        /// This method is called before the active leases are marked as
+        /// used. The default implementation does nothing.
+        ///
+        /// @param subnet subnet the pool belongs to
+        /// @param pool the pool
+        virtual void
+        initPoolState(const SubnetPtr& /* subnet */,
+                      const PoolPtr& /* pool */) {
+        }
+
+        /// @brief Marks an address or prefix as used or free in the
+        /// allocator state of a pool
+        ///
+        /// The default implementation does nothing.
+        ///
+        /// @param pool the pool
+        /// @param offset position of the address or prefix in the pool
+        /// @param used true when the address became used, false when it
+        /// became free
+        virtual void
+        updatePoolState(const PoolPtr& /* pool */, uint64_t /* offset */,
+                        bool /* used */) {
+        }
+
     protected:
 
+        /// @brief Returns the position of an address or prefix in a pool.
+        ///
+        /// @param pool pool the address or prefix belongs to
+        /// @param address address or prefix
+        /// @param prefix true when the address is a delegated prefix
+        ///
+        /// @return the zero based position in the pool
+        static uint64_t
+        getPoolOffset(const PoolPtr& pool,
+                      const isc::asiolink::IOAddress& address,
+                      bool prefix);
+
+        /// @brief Returns the address or prefix at a position in a pool.
+        ///
+        /// @param pool pool to pick the address or prefix from
+        /// @param offset zero based position in the pool
+        /// @param prefix true when the pool is a prefix delegation pool
+        ///
+        /// @return the address or prefix
+        static isc::asiolink::IOAddress
+        getPoolAddress(const PoolPtr& pool, uint64_t offset, bool prefix);
+
+        /// @brief Checks if the allowed pools have a free lease index
+        ///
+        /// @param pools the pools of a subnet
+        /// @param client_classes list of classes client belongs to
+        ///
+        /// @return true when all the pools allowed for the client classes
+        /// have a free lease index
+        static bool
+        hasFreeLeaseIndex(const PoolCollection& pools,
+                          const ClientClasses& client_classes);
+
         /// @brief Defines pool type allocation
         Lease::Type pool_type_;
 
@@ -144,6 +290,11 @@ protected:
     /// a pool iteratively, one after another. Once the last address is reached,
     /// it starts allocating from the beginning of the first pool (i.e. it loops
     /// over).
+    ///
+    /// When the allowed pools have a free lease index the addresses marked
+    /// as used are skipped. When the index has no free address left the
+    /// pools are scanned as usual, so the addresses of expired leases or
+    /// of leases deleted behind the allocation engine are still found.
     class IterativeAllocator : public Allocator {
     public:
 
@@ -169,6 +320,19 @@ protected:
                             const DuidPtr& duid,
                             const isc::asiolink::IOAddress& hint);
 
+        /// @brief Returns the next free address using the free lease index
+        ///
+        /// @param subnet next address will be returned from pool of that subnet
+        /// @param client_classes list of classes client belongs to
+        /// @param [out] address the next free address after the last
+        /// allocated one
+        ///
+        /// @return true when a free address was found, false when the index
+        /// of the allowed pools has no free address
+        bool pickFreeAddress(const SubnetPtr& subnet,
+                             const ClientClasses& client_classes,
+                             isc::asiolink::IOAddress& address);
+
     protected:
 
         /// @brief Returns the next prefix
@@ -203,7 +367,16 @@ protected:
 
     /// @brief Address/prefix allocator that gets an address based on a hash
     ///
-    /// @todo: This is a skeleton class for now and is missing an implementation.
+    /// This class implements an algorithm which picks the first candidate
+    /// from a hash of the client identifier (DUID, client identifier or
+    /// hardware address), so a client is always offered the same address
+    /// as long as it is free. When this candidate is in use, the next
+    /// addresses (or prefixes) of the allowed pools are probed, wrapping
+    /// around at the end of the last pool. The allocator is stateless:
+    /// the position of the probe is given by the previously returned
+    /// candidate passed as the hint. When the allowed pools have a free
+    /// lease index the addresses marked as used are skipped, unless the
+    /// index has no free address left.
     class HashedAllocator : public Allocator {
     public:
 
@@ -216,8 +389,6 @@ protected:
 
         /// @brief Returns an address based on hash calculated from client's DUID.
         ///
-        /// @todo: Implement this method
-        ///
         /// @param subnet an address will be picked from pool of that subnet
         /// @param client_classes list of classes client belongs to
         /// @param duid Client's DUID
@@ -229,24 +400,42 @@ protected:
                             const ClientClasses& client_classes,
                             const DuidPtr& duid,
                             const isc::asiolink::IOAddress& hint);
+
     };
 
     /// @brief Random allocator that picks address randomly
     ///
-    /// @todo: This is a skeleton class for now and is missing an implementation.
+    /// This class implements an algorithm which picks a free address (or
+    /// prefix) uniformly at random among the allowed pools. Each pool
+    /// keeps a bitmap with one bit per address, set when the address is
+    /// in use. The bitmaps are built from the active leases of the subnet
+    /// when the configuration is applied (see @ref buildState), then kept
+    /// in sync by the allocation engine: a bit is set when a lease is
+    /// committed to the lease database and cleared when the lease is
+    /// released or reclaimed. Picking a candidate does not change the
+    /// bitmap so offers and candidates rejected by the engine do not take
+    /// addresses out of the free set. A random position is drawn and the
+    /// first free bit at or after it is returned, so the cost is constant
+    /// when the pool is almost full.
+    ///
+    /// Pools larger than @c MAX_BITMAP_CAPACITY get no bitmap: the free
+    /// lease index of the pool is used instead when it was built, else a
+    /// random address is returned as collisions are unlikely in such
+    /// pools.
     class RandomAllocator : public Allocator {
     public:
 
-        /// @brief Default constructor (does nothing)
+        /// @brief The largest pool tracked by a bitmap (2 MB of bits).
+        static const uint64_t MAX_BITMAP_CAPACITY = 1ULL << 24;
+
+        /// @brief Default constructor
         ///
         /// @param type - specifies allocation type
         RandomAllocator(Lease::Type type);
 
     private:
 
-        /// @brief Returns a random address from pool of specified subnet
-        ///
-        /// @todo: Implement this method
+        /// @brief Returns a random free address from pool of specified subnet
         ///
         /// @param subnet an address will be picked from pool of that subnet
         /// @param client_classes list of classes client belongs to
@@ -259,6 +448,38 @@ protected:
                             const ClientClasses& client_classes,
                             const DuidPtr& duid,
                             const isc::asiolink::IOAddress& hint);
+
+        /// @brief Gives a new bitmap to a pool which is not too large
+        ///
+        /// @param subnet subnet the pool belongs to
+        /// @param pool the pool
+        virtual void
+        initPoolState(const SubnetPtr& subnet, const PoolPtr& pool);
+
+        /// @brief Marks an address or prefix as used or free in its pool
+        /// bitmap
+        ///
+        /// @param pool the pool
+        /// @param offset position of the address or prefix in the pool
+        /// @param used true when the address became used, false when it
+        /// became free
+        virtual void
+        updatePoolState(const PoolPtr& pool, uint64_t offset, bool used);
+
+        /// @brief Returns the bitmap of a pool
+        ///
+        /// @param pool the pool
+        ///
+        /// @return the bitmap or null when it was not built
+        static PoolFreeBitmapPtr getBitmap(const PoolPtr& pool);
+
+        /// @brief Returns a random number in [0, limit)
+        ///
+        /// @param limit the upper bound (must not be 0)
+        uint64_t random(uint64_t limit);
+
+        /// @brief The random number generator
+        std::mt19937_64 generator_;
     };
 
 public:
@@ -286,6 +507,15 @@ public:
     /// @brief Destructor.
     virtual ~AllocEngine() { }
 
+    /// @brief Converts an allocator name to the allocation type.
+    ///
+    /// @param allocator_type "iterative", "hashed" or "random"
+    ///
+    /// @throw BadValue if the name is not a supported allocator name
+    ///
+    /// @return the allocation type
+    static AllocType allocTypeFromText(const std::string& allocator_type);
+
     /// @brief Returns allocator for a given pool type
     ///
     /// @param type type of pool (V4, IA, TA or PD)
@@ -295,6 +525,51 @@ public:
     /// @return pointer to allocator handling a given resource types
     AllocatorPtr getAllocator(Lease::Type type);
 
+    /// @brief Returns allocator for a given pool type and subnet
+    ///
+    /// The allocator is selected using the allocator parameter of the
+    /// subnet (possibly inherited from the shared network or the global
+    /// scope). When it is not specified the engine default allocator
+    /// for the type is returned.
+    ///
+    /// @param type type of pool (V4, IA, TA or PD)
+    /// @param subnet subnet the pools of which the allocator will use
+    ///
+    /// @throw BadValue if allocator for a given type is missing
+    ///
+    /// @return pointer to allocator handling a given resource types
+    AllocatorPtr getAllocator(Lease::Type type, const SubnetPtr& subnet);
+
+    /// @brief Tells the allocator of the lease subnet the address is free
+    ///
+    /// This method must be called when a lease is removed outside the
+    /// allocation engine (e.g. released by the client) so allocators
+    /// tracking the free addresses of pools can reuse it.
+    ///
+    /// @param lease the removed lease
+    void freeLeaseAddress(const Lease4Ptr& lease);
+
+    /// @brief Tells the allocator of the lease subnet the address is free
+    ///
+    /// @param lease the removed lease
+    void freeLeaseAddress(const Lease6Ptr& lease);
+
+    /// @brief Builds the allocation state of the pools of a configuration
+    ///
+    /// Each subnet of the configuration is given to its allocators which
+    /// build the free lease indexes of the pools and their own per pool
+    /// state (e.g. the bitmaps of the random allocator) from the lease
+    /// database. This method must be called when the configuration is
+    /// applied, after the lease database was opened.
+    ///
+    /// The free lease indexes are built only when the "free-lease-index"
+    /// global parameter is true. An index learns only the changes made
+    /// through the allocation engine, so the allocators fall back to the
+    /// scan of the pools when it has no free address left.
+    ///
+    /// @param config the configuration holding the subnets
+    void buildAllocatorStates(const SrvConfigPtr& config);
+
 private:
 
     /// @brief A pointer to currently used allocator
@@ -303,6 +578,11 @@ private:
     /// For IPv6, there will be 3 allocators: TYPE_NA, TYPE_TA, TYPE_PD
     std::map<Lease::Type, AllocatorPtr> allocators_;
 
+    /// @brief Allocators of all types which can be selected per subnet
+    ///
+    /// Indexed by allocation type then by pool type.
+    std::map<AllocType, std::map<Lease::Type, AllocatorPtr> > type_allocators_;
+
     /// @brief number of attempts before we give up lease allocation (0=unlimited)
     uint64_t attempts_;
 
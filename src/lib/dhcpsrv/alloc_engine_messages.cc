@@ -8,6 +8,7 @@ namespace isc {
 namespace dhcp {
 
 extern const isc::log::MessageID ALLOC_ENGINE_LEASE_RECLAIMED = "ALLOC_ENGINE_LEASE_RECLAIMED";
+extern const isc::log::MessageID ALLOC_ENGINE_RANDOM_POOL_NOT_TRACKED = "ALLOC_ENGINE_RANDOM_POOL_NOT_TRACKED";
 extern const isc::log::MessageID ALLOC_ENGINE_REMOVAL_NCR_FAILED = "ALLOC_ENGINE_REMOVAL_NCR_FAILED";
 extern const isc::log::MessageID ALLOC_ENGINE_V4_ALLOC_ERROR = "ALLOC_ENGINE_V4_ALLOC_ERROR";
 extern const isc::log::MessageID ALLOC_ENGINE_V4_ALLOC_FAIL = "ALLOC_ENGINE_V4_ALLOC_FAIL";
@@ -80,6 +81,7 @@ namespace {
 
 const char* values[] = {
     "ALLOC_ENGINE_LEASE_RECLAIMED", "successfully reclaimed lease %1",
+    "ALLOC_ENGINE_RANDOM_POOL_NOT_TRACKED", "pool %1 of subnet %2 is too large to be tracked by the random allocator",
     "ALLOC_ENGINE_REMOVAL_NCR_FAILED", "sending removal name change request failed for lease %1: %2",
     "ALLOC_ENGINE_V4_ALLOC_ERROR", "%1: error during attempt to allocate an IPv4 address: %2",
     "ALLOC_ENGINE_V4_ALLOC_FAIL", "%1: failed to allocate an IPv4 address after %2 attempt(s)",
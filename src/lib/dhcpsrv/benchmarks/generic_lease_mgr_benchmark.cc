@@ -24,6 +24,7 @@
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace isc::asiolink;
@@ -149,6 +150,24 @@ GenericLeaseMgrBenchmark::benchGetExpiredLeases4() {
     lmptr_->getExpiredLeases4(expired_leases, leases4_.size());
 }
 
+void
+GenericLeaseMgrBenchmark::benchGetUpdateLeases4MT(size_t const& thread_count) {
+    vector<thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.push_back(thread([this, t, thread_count]() {
+            for (size_t i = t; i < leases4_.size(); i += thread_count) {
+                Lease4Ptr lease = lmptr_->getLease4(leases4_[i]->addr_);
+                if (lease && (i % 4 == 0)) {
+                    lmptr_->updateLease4(lease);
+                }
+            }
+        }));
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
 void
 GenericLeaseMgrBenchmark::prepareLeases6(size_t const& lease_count) {
     if (lease_count > 0xfffdu) {
@@ -222,6 +241,25 @@ GenericLeaseMgrBenchmark::benchGetExpiredLeases6() {
     lmptr_->getExpiredLeases6(expired_leases, leases6_.size());
 }
 
+void
+GenericLeaseMgrBenchmark::benchGetUpdateLeases6MT(size_t const& thread_count) {
+    vector<thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.push_back(thread([this, t, thread_count]() {
+            for (size_t i = t; i < leases6_.size(); i += thread_count) {
+                Lease6Ptr lease = lmptr_->getLease6(leases6_[i]->type_,
+                                                    leases6_[i]->addr_);
+                if (lease && (i % 4 == 0)) {
+                    lmptr_->updateLease6(lease);
+                }
+            }
+        }));
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
 /// @todo: Calls that aren't measured:
 /// - deleteLease(const Lease4Ptr& lease);
 /// - deleteLease(const Lease6Ptr& lease);
@@ -94,6 +94,16 @@ public:
     /// @brief This step retrieves all expired IPv4 leases.
     void benchGetExpiredLeases4();
 
+    /// @brief This step retrieves IPv4 leases by IP address from several
+    /// threads.
+    ///
+    /// The leases are split evenly between the threads and every fourth
+    /// retrieved lease is updated, so readers and writers compete for the
+    /// backend like they do in a multi-threaded server.
+    ///
+    /// @param thread_count number of threads sharing the work
+    void benchGetUpdateLeases4MT(size_t const& thread_count);
+
     /// @brief Prepares specified number of IPv6 leases
     ///
     /// The leases are stored in leases6_ container.
@@ -118,6 +128,14 @@ public:
     /// @brief This step retrieves all expired IPv6 leases.
     void benchGetExpiredLeases6();
 
+    /// @brief This step retrieves IPv6 leases by type and IP address from
+    /// several threads.
+    ///
+    /// See @c benchGetUpdateLeases4MT for details.
+    ///
+    /// @param thread_count number of threads sharing the work
+    void benchGetUpdateLeases6MT(size_t const& thread_count);
+
     /// Pointer to the lease manager being under evaluation.
     LeaseMgr* lmptr_;
 
@@ -11,10 +11,12 @@
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
 #include <dhcpsrv/testutils/lease_file_io.h>
+#include <util/multi_threading_mgr.h>
 
 using namespace isc::dhcp;
 using namespace isc::dhcp::bench;
 using namespace isc::dhcp::test;
+using namespace isc::util;
 using namespace std;
 
 namespace {
@@ -224,6 +226,19 @@ BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, getExpiredLeases4)(benchmark::State
     }
 }
 
+// Defines a benchmark that measures IPv4 leases retrieval and update by
+// several threads with multi-threading enabled.
+BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, getUpdateLeases4_mt)(benchmark::State& state) {
+    const size_t lease_count = state.range(0);
+    const size_t thread_count = state.range(1);
+    MultiThreadingMgr::instance().setMode(true);
+    while (state.KeepRunning()) {
+        setUpWithInserts4(state, lease_count);
+        benchGetUpdateLeases4MT(thread_count);
+    }
+    MultiThreadingMgr::instance().setMode(false);
+}
+
 // Defines a benchmark that measures IPv6 leases insertion.
 BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, insertLeases6)(benchmark::State& state) {
     const size_t lease_count = state.range(0);
@@ -280,6 +295,35 @@ BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, getExpiredLeases6)(benchmark::State
     }
 }
 
+// Defines a benchmark that measures IPv6 leases retrieval and update by
+// several threads with multi-threading enabled.
+BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, getUpdateLeases6_mt)(benchmark::State& state) {
+    const size_t lease_count = state.range(0);
+    const size_t thread_count = state.range(1);
+    MultiThreadingMgr::instance().setMode(true);
+    while (state.KeepRunning()) {
+        setUpWithInserts6(state, lease_count);
+        benchGetUpdateLeases6MT(thread_count);
+    }
+    MultiThreadingMgr::instance().setMode(false);
+}
+
+/// @brief Sets the arguments of the multi-threaded benchmarks.
+///
+/// Each benchmark is run with the minimum and the maximum number of leases
+/// and 1, 2, 4, ... up to MAX_THREAD_COUNT threads to show the scaling.
+///
+/// @param b benchmark to set arguments for
+void mtArguments(benchmark::internal::Benchmark* b) {
+    for (size_t lease_count : { MIN_LEASE_COUNT, MAX_LEASE_COUNT }) {
+        for (size_t thread_count = 1; thread_count <= MAX_THREAD_COUNT;
+             thread_count *= 2) {
+            b->Args({ static_cast<int64_t>(lease_count),
+                      static_cast<int64_t>(thread_count) });
+        }
+    }
+}
+
 /// The following macros define run parameters for previously defined
 /// memfile benchmarks.
 
@@ -316,6 +360,12 @@ BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, getLease4_clientid_subnetid)
 BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, getExpiredLeases4)
     ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
 
+/// A benchmark that measures IPv4 lease retrieval and update scaling with
+/// the number of threads. The wall clock time is used as the work is done
+/// by the spawned threads.
+BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, getUpdateLeases4_mt)
+    ->Apply(mtArguments)->UseRealTime()->Unit(UNIT);
+
 /// A benchmark that measures IPv6 leases insertion.
 BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, insertLeases6)
     ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
@@ -341,4 +391,9 @@ BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, getLease6_type_duid_iaid_subnetid
 BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, getExpiredLeases6)
     ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
 
+/// A benchmark that measures IPv6 lease retrieval and update scaling with
+/// the number of threads.
+BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, getUpdateLeases6_mt)
+    ->Apply(mtArguments)->UseRealTime()->Unit(UNIT);
+
 }  // namespace
@@ -31,6 +31,12 @@ constexpr size_t MIN_HOST_COUNT = 512;
 /// @brief A maximum number of leases used in a benchmark
 constexpr size_t MAX_HOST_COUNT = 0xfffd;
 
+/// @brief A maximum number of threads used in a multi-threaded benchmark
+///
+/// Multi-threaded benchmarks are run with 1, 2, 4, ... threads up to this
+/// value.
+constexpr size_t MAX_THREAD_COUNT = 16;
+
 /// @brief A time unit used - all results to be expressed in us (microseconds)
 constexpr benchmark::TimeUnit UNIT = benchmark::kMicrosecond;
 
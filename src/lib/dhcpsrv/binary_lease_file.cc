@@ -0,0 +1,634 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/binary_lease_file.h>
+#include <cc/data.h>
+#include <util/io_utilities.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::util;
+
+namespace {
+
+/// @brief The magic beginning the binary lease files.
+const char MAGIC[] = { 'K', 'E', 'A', 'L', 'E', 'A', 'S', 'E' };
+
+/// @brief Size of the magic.
+const size_t MAGIC_SIZE = sizeof(MAGIC);
+
+/// @brief Size of the records buffered before they are written.
+const size_t WRITE_BUFFER_SIZE = 1 << 20;
+
+/// @brief Flags of the common fields.
+const uint8_t FLAG_FQDN_FWD = 0x01;
+const uint8_t FLAG_FQDN_REV = 0x02;
+const uint8_t FLAG_HWADDR = 0x04;
+
+/// @brief Writes a 64-bit integer in network byte order.
+///
+/// @param value The integer.
+/// @param [out] buffer The buffer, 8 bytes.
+void
+writeUint64(uint64_t value, uint8_t* buffer) {
+    for (int i = 7; i >= 0; --i) {
+        buffer[i] = static_cast<uint8_t>(value & 0xff);
+        value >>= 8;
+    }
+}
+
+/// @brief Writes a buffer to a file.
+///
+/// @param fd The file descriptor.
+/// @param data The buffer.
+/// @param length Its length.
+/// @return true on success, false on error with errno set.
+bool
+writeAll(int fd, const void* data, size_t length) {
+    const uint8_t* ptr = static_cast<const uint8_t*>(data);
+    while (length > 0) {
+        ssize_t count = ::write(fd, ptr, length);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return (false);
+        }
+        ptr += count;
+        length -= static_cast<size_t>(count);
+    }
+    return (true);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const size_t BinaryLeaseFile::HEADER_SIZE;
+const uint16_t BinaryLeaseFile::FORMAT_VERSION;
+const size_t BinaryLeaseFile::COMMON_SIZE;
+const uint64_t BinaryLeaseFile::READ_CHUNK_SIZE;
+
+BinaryLeaseFile::BinaryLeaseFile(const std::string& filename,
+                                 const uint8_t universe,
+                                 const size_t record_size)
+    : filename_(filename), universe_(universe), record_size_(record_size),
+      fd_(-1), map_(NULL), map_size_(0), read_record_size_(0),
+      record_count_(0), next_index_(0), end_index_(0), strings_(NULL), strings_size_(0),
+      written_count_(0) {
+}
+
+BinaryLeaseFile::~BinaryLeaseFile() {
+    try {
+        close();
+    } catch (...) {
+        // The error of an incomplete file can only be reported by an
+        // explicit close.
+    }
+}
+
+bool
+BinaryLeaseFile::isBinary(const std::string& filename) {
+    int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return (false);
+    }
+    char magic[MAGIC_SIZE];
+    ssize_t count = ::read(fd, magic, MAGIC_SIZE);
+    ::close(fd);
+    return ((count == static_cast<ssize_t>(MAGIC_SIZE)) &&
+            (memcmp(magic, MAGIC, MAGIC_SIZE) == 0));
+}
+
+bool
+BinaryLeaseFile::exists() const {
+    return (access(filename_.c_str(), R_OK) == 0);
+}
+
+void
+BinaryLeaseFile::open(const bool /* seek_to_end */) {
+    close();
+    clearStatistics();
+
+    int fd = ::open(filename_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        isc_throw(BinaryLeaseFileError, "unable to open '" << filename_
+                  << "': " << strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int error = errno;
+        ::close(fd);
+        isc_throw(BinaryLeaseFileError, "unable to get the size of '"
+                  << filename_ << "': " << strerror(error));
+    }
+    const uint64_t file_size = static_cast<uint64_t>(st.st_size);
+    if (file_size < HEADER_SIZE) {
+        ::close(fd);
+        isc_throw(BinaryLeaseFileError, "the lease file '" << filename_
+                  << "' is too short");
+    }
+    void* map = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping remains valid after the file is closed.
+    ::close(fd);
+    if (map == MAP_FAILED) {
+        isc_throw(BinaryLeaseFileError, "unable to map '" << filename_
+                  << "': " << strerror(errno));
+    }
+    map_ = static_cast<uint8_t*>(map);
+    map_size_ = file_size;
+    // The records are read once in order.
+    static_cast<void>(madvise(map_, map_size_, MADV_SEQUENTIAL));
+
+    try {
+        if (memcmp(map_, MAGIC, MAGIC_SIZE) != 0) {
+            isc_throw(BinaryLeaseFileError, "the file '" << filename_
+                      << "' is not a binary lease file");
+        }
+        const uint16_t version = readUint16(map_ + 8, 2);
+        if (version != FORMAT_VERSION) {
+            isc_throw(BinaryLeaseFileError, "unsupported version " << version
+                      << " of the binary lease file '" << filename_ << "'");
+        }
+        if (map_[10] != universe_) {
+            isc_throw(BinaryLeaseFileError, "the binary lease file '"
+                      << filename_ << "' holds DHCPv"
+                      << static_cast<int>(map_[10]) << " leases");
+        }
+        read_record_size_ = readUint32(map_ + 12, 4);
+        record_count_ = readUint64(map_ + 16, 8);
+        const uint64_t strings_offset = readUint64(map_ + 24, 8);
+        strings_size_ = readUint64(map_ + 32, 8);
+        if (strings_offset == 0) {
+            isc_throw(BinaryLeaseFileError, "the binary lease file '"
+                      << filename_ << "' is incomplete");
+        }
+        if (read_record_size_ < record_size_) {
+            isc_throw(BinaryLeaseFileError, "invalid record size "
+                      << read_record_size_ << " in the binary lease file '"
+                      << filename_ << "'");
+        }
+        if ((record_count_ > (file_size - HEADER_SIZE) / read_record_size_) ||
+            (strings_offset != HEADER_SIZE + record_count_ * read_record_size_) ||
+            (strings_size_ > file_size - strings_offset)) {
+            isc_throw(BinaryLeaseFileError, "the binary lease file '"
+                      << filename_ << "' is truncated");
+        }
+        strings_ = map_ + strings_offset;
+        next_index_ = 0;
+        end_index_ = record_count_;
+
+    } catch (const std::exception&) {
+        close();
+        throw;
+    }
+}
+
+void
+BinaryLeaseFile::recreate() {
+    close();
+    clearStatistics();
+
+    fd_ = ::open(filename_.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                 S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd_ < 0) {
+        isc_throw(BinaryLeaseFileError, "unable to create '" << filename_
+                  << "': " << strerror(errno));
+    }
+    // The counters of the header are written when the file is closed: a
+    // zero string table offset marks an incomplete file.
+    uint8_t header[HEADER_SIZE];
+    writeHeader(header, 0, 0, 0);
+    if (!writeAll(fd_, header, HEADER_SIZE)) {
+        int error = errno;
+        ::close(fd_);
+        fd_ = -1;
+        isc_throw(BinaryLeaseFileError, "unable to write to '" << filename_
+                  << "': " << strerror(error));
+    }
+    records_.clear();
+    records_.reserve(WRITE_BUFFER_SIZE);
+    written_count_ = 0;
+    string_table_.clear();
+    string_offsets_.clear();
+}
+
+void
+BinaryLeaseFile::close() {
+    if (map_) {
+        munmap(map_, map_size_);
+        map_ = NULL;
+        map_size_ = 0;
+        strings_ = NULL;
+        strings_size_ = 0;
+        record_count_ = 0;
+        next_index_ = 0;
+        end_index_ = 0;
+    }
+    if (fd_ < 0) {
+        return;
+    }
+
+    int fd = fd_;
+    fd_ = -1;
+    try {
+        flushRecords(fd);
+        if (!writeAll(fd, string_table_.data(), string_table_.size())) {
+            isc_throw(BinaryLeaseFileError, "unable to write to '"
+                      << filename_ << "': " << strerror(errno));
+        }
+
+        uint8_t header[HEADER_SIZE];
+        writeHeader(header, written_count_,
+                    HEADER_SIZE + written_count_ * record_size_,
+                    string_table_.size());
+        if (pwrite(fd, header, HEADER_SIZE, 0) !=
+            static_cast<ssize_t>(HEADER_SIZE)) {
+            isc_throw(BinaryLeaseFileError, "unable to write the header of '"
+                      << filename_ << "': " << strerror(errno));
+        }
+
+    } catch (const std::exception&) {
+        ::close(fd);
+        string_table_.clear();
+        string_offsets_.clear();
+        throw;
+    }
+
+    ::close(fd);
+    string_table_.clear();
+    string_offsets_.clear();
+}
+
+void
+BinaryLeaseFile::writeHeader(uint8_t* header, const uint64_t count,
+                             const uint64_t strings_offset,
+                             const uint64_t strings_size) const {
+    memset(header, 0, HEADER_SIZE);
+    memcpy(header, MAGIC, MAGIC_SIZE);
+    writeUint16(FORMAT_VERSION, header + 8, 2);
+    header[10] = universe_;
+    writeUint32(static_cast<uint32_t>(record_size_), header + 12, 4);
+    writeUint64(count, header + 16);
+    writeUint64(strings_offset, header + 24);
+    writeUint64(strings_size, header + 32);
+}
+
+std::string
+BinaryLeaseFile::getSchemaVersion() const {
+    std::ostringstream s;
+    s << FORMAT_VERSION << ".0";
+    return (s.str());
+}
+
+const uint8_t*
+BinaryLeaseFile::nextRecord() {
+    if (!map_) {
+        isc_throw(BinaryLeaseFileError, "the binary lease file '"
+                  << filename_ << "' is not open for reading");
+    }
+    if (next_index_ >= end_index_) {
+        return (NULL);
+    }
+    return (map_ + HEADER_SIZE + (next_index_++) * read_record_size_);
+}
+
+void
+BinaryLeaseFile::setReadRange(const uint64_t begin, const uint64_t end) {
+    if (!map_) {
+        isc_throw(BinaryLeaseFileError, "the binary lease file '"
+                  << filename_ << "' is not open for reading");
+    }
+    end_index_ = std::min(end, record_count_);
+    next_index_ = std::min(begin, end_index_);
+}
+
+void
+BinaryLeaseFile::appendRecord(const uint8_t* record) {
+    if (fd_ < 0) {
+        isc_throw(BinaryLeaseFileError, "the binary lease file '"
+                  << filename_ << "' is not open for writing");
+    }
+    records_.insert(records_.end(), record, record + record_size_);
+    ++written_count_;
+    if (records_.size() >= WRITE_BUFFER_SIZE) {
+        flushRecords(fd_);
+    }
+}
+
+void
+BinaryLeaseFile::flushRecords(int fd) {
+    if (!writeAll(fd, records_.data(), records_.size())) {
+        isc_throw(BinaryLeaseFileError, "unable to write to '"
+                  << filename_ << "': " << strerror(errno));
+    }
+    records_.clear();
+}
+
+void
+BinaryLeaseFile::writeString(const uint8_t* data, const size_t length,
+                             uint8_t* ref) {
+    uint32_t offset = 0;
+    if (length > 0) {
+        std::string value(reinterpret_cast<const char*>(data), length);
+        auto it = string_offsets_.find(value);
+        if (it != string_offsets_.end()) {
+            offset = it->second;
+        } else {
+            if (string_table_.size() + length >
+                std::numeric_limits<uint32_t>::max()) {
+                isc_throw(BinaryLeaseFileError, "the string table of '"
+                          << filename_ << "' is full");
+            }
+            offset = static_cast<uint32_t>(string_table_.size());
+            string_table_.append(value);
+            string_offsets_.insert(std::make_pair(value, offset));
+        }
+    }
+    writeUint32(offset, ref, 4);
+    writeUint32(static_cast<uint32_t>(length), ref + 4, 4);
+}
+
+const uint8_t*
+BinaryLeaseFile::readString(const uint8_t* ref, size_t& length) const {
+    const uint64_t offset = readUint32(ref, 4);
+    length = readUint32(ref + 4, 4);
+    if (offset + length > strings_size_) {
+        isc_throw(BinaryLeaseFileError, "invalid string reference "
+                  << offset << "/" << length);
+    }
+    return (strings_ + offset);
+}
+
+std::string
+BinaryLeaseFile::readString(const uint8_t* ref) const {
+    size_t length = 0;
+    const uint8_t* data = readString(ref, length);
+    return (std::string(reinterpret_cast<const char*>(data), length));
+}
+
+void
+BinaryLeaseFile::writeCommon(const Lease& lease, uint8_t* fields) {
+    writeUint32(lease.valid_lft_, fields, 4);
+    writeUint64(static_cast<uint64_t>(lease.cltt_), fields + 4);
+    writeUint32(lease.subnet_id_, fields + 12, 4);
+    writeUint32(lease.state_, fields + 16, 4);
+    uint8_t flags = 0;
+    if (lease.fqdn_fwd_) {
+        flags |= FLAG_FQDN_FWD;
+    }
+    if (lease.fqdn_rev_) {
+        flags |= FLAG_FQDN_REV;
+    }
+    if (lease.hwaddr_) {
+        const std::vector<uint8_t>& hwaddr = lease.hwaddr_->hwaddr_;
+        if (hwaddr.size() > HWAddr::MAX_HWADDR_LEN) {
+            isc_throw(BinaryLeaseFileError, "hardware address of the lease for "
+                      << lease.addr_ << " is too long");
+        }
+        flags |= FLAG_HWADDR;
+        fields[21] = static_cast<uint8_t>(hwaddr.size());
+        writeUint16(lease.hwaddr_->htype_, fields + 22, 2);
+        writeUint32(lease.hwaddr_->source_, fields + 24, 4);
+        std::copy(hwaddr.begin(), hwaddr.end(), fields + 28);
+    }
+    fields[20] = flags;
+    writeString(lease.hostname_, fields + 48);
+    ConstElementPtr ctx = lease.getContext();
+    writeString(ctx ? ctx->str() : std::string(), fields + 56);
+}
+
+void
+BinaryLeaseFile::readCommon(const uint8_t* fields, Lease& lease) const {
+    lease.valid_lft_ = readUint32(fields, 4);
+    lease.old_valid_lft_ = lease.valid_lft_;
+    lease.cltt_ = static_cast<int64_t>(readUint64(fields + 4, 8));
+    lease.old_cltt_ = lease.cltt_;
+    lease.subnet_id_ = readUint32(fields + 12, 4);
+    lease.state_ = readUint32(fields + 16, 4);
+    const uint8_t flags = fields[20];
+    lease.fqdn_fwd_ = ((flags & FLAG_FQDN_FWD) != 0);
+    lease.fqdn_rev_ = ((flags & FLAG_FQDN_REV) != 0);
+    if ((flags & FLAG_HWADDR) != 0) {
+        const uint8_t length = fields[21];
+        if (length > HWAddr::MAX_HWADDR_LEN) {
+            isc_throw(BinaryLeaseFileError, "invalid hardware address length "
+                      << static_cast<int>(length));
+        }
+        lease.hwaddr_.reset(new HWAddr(fields + 28, length,
+                                       readUint16(fields + 22, 2)));
+        lease.hwaddr_->source_ = readUint32(fields + 24, 4);
+    }
+    lease.hostname_ = readString(fields + 48);
+    const std::string user_context = readString(fields + 56);
+    if (!user_context.empty()) {
+        ConstElementPtr ctx = Element::fromJSON(user_context);
+        if (!ctx || (ctx->getType() != Element::map)) {
+            isc_throw(isc::BadValue, "user context '" << user_context
+                      << "' is not a JSON map");
+        }
+        lease.setContext(ctx);
+    }
+}
+
+const size_t BinaryLeaseFile4::RECORD_SIZE;
+
+BinaryLeaseFile4::BinaryLeaseFile4(const std::string& filename)
+    : BinaryLeaseFile(filename, 4, RECORD_SIZE) {
+}
+
+void
+BinaryLeaseFile4::append(const Lease4& lease) {
+    // Bump the number of write attempts
+    ++writes_;
+
+    try {
+        if (((!lease.hwaddr_) || lease.hwaddr_->hwaddr_.empty()) &&
+            ((!lease.client_id_) || (lease.client_id_->getClientId().empty())) &&
+            (lease.state_ != Lease::STATE_DECLINED)) {
+            isc_throw(BadValue, "Lease4: " << lease.addr_.toText() << ", state: "
+                      << Lease::basicStatesToText(lease.state_)
+                      << " has neither hardware address or client id");
+        }
+        if (!lease.addr_.isV4()) {
+            isc_throw(BadValue, "address " << lease.addr_
+                      << " is not an IPv4 address");
+        }
+
+        uint8_t record[RECORD_SIZE];
+        memset(record, 0, RECORD_SIZE);
+        writeUint32(lease.addr_.toUint32(), record, 4);
+        writeCommon(lease, record + 4);
+        if (lease.client_id_) {
+            const std::vector<uint8_t>& client_id = lease.client_id_->getClientId();
+            writeString(client_id.empty() ? NULL : &client_id[0],
+                        client_id.size(), record + 4 + COMMON_SIZE);
+        }
+        appendRecord(record);
+
+    } catch (const std::exception&) {
+        // Bump the error counter
+        ++write_errs_;
+        throw;
+    }
+
+    // Bump the number of leases written
+    ++write_leases_;
+}
+
+bool
+BinaryLeaseFile4::next(Lease4Ptr& lease) {
+    // Bump the number of read attempts
+    ++reads_;
+
+    try {
+        const uint8_t* record = nextRecord();
+        // The end of the file.
+        if (!record) {
+            lease.reset();
+            return (true);
+        }
+
+        lease.reset(new Lease4());
+        lease->addr_ = IOAddress(readUint32(record, 4));
+        readCommon(record + 4, *lease);
+        size_t length = 0;
+        const uint8_t* client_id = readString(record + 4 + COMMON_SIZE, length);
+        if (length > 0) {
+            lease->client_id_.reset(new ClientId(client_id, length));
+        }
+
+    } catch (const std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
+
+        // The lease might have been created, so let's set it back to NULL to
+        // signal that lease hasn't been parsed.
+        lease.reset();
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    // bump the number of leases read
+    ++read_leases_;
+
+    return (true);
+}
+
+const size_t BinaryLeaseFile6::RECORD_SIZE;
+
+BinaryLeaseFile6::BinaryLeaseFile6(const std::string& filename)
+    : BinaryLeaseFile(filename, 6, RECORD_SIZE) {
+}
+
+void
+BinaryLeaseFile6::append(const Lease6& lease) {
+    // Bump the number of write attempts
+    ++writes_;
+
+    try {
+        if (((!(lease.duid_)) || (*(lease.duid_) == DUID::EMPTY())) &&
+            (lease.state_ != Lease::STATE_DECLINED)) {
+            isc_throw(BadValue, "Lease6: " << lease.addr_.toText() << ", state: "
+                      << Lease::basicStatesToText(lease.state_) << ", has no DUID");
+        }
+        if (!lease.addr_.isV6()) {
+            isc_throw(BadValue, "address " << lease.addr_
+                      << " is not an IPv6 address");
+        }
+
+        uint8_t record[RECORD_SIZE];
+        memset(record, 0, RECORD_SIZE);
+        lease.addr_.toBytes(record);
+        record[16] = static_cast<uint8_t>(lease.type_);
+        record[17] = lease.prefixlen_;
+        writeUint32(lease.iaid_, record + 20, 4);
+        writeUint32(lease.preferred_lft_, record + 24, 4);
+        writeCommon(lease, record + 28);
+        if (lease.duid_) {
+            const std::vector<uint8_t>& duid = lease.duid_->getDuid();
+            writeString(duid.empty() ? NULL : &duid[0], duid.size(),
+                        record + 28 + COMMON_SIZE);
+        }
+        appendRecord(record);
+
+    } catch (const std::exception&) {
+        // Bump the error counter
+        ++write_errs_;
+        throw;
+    }
+
+    // Bump the number of leases written
+    ++write_leases_;
+}
+
+bool
+BinaryLeaseFile6::next(Lease6Ptr& lease) {
+    // Bump the number of read attempts
+    ++reads_;
+
+    try {
+        const uint8_t* record = nextRecord();
+        // The end of the file.
+        if (!record) {
+            lease.reset();
+            return (true);
+        }
+
+        lease.reset(new Lease6());
+        // Not using IOAddress::fromBytes which converts to and from text.
+        boost::asio::ip::address_v6::bytes_type bytes;
+        std::copy(record, record + 16, bytes.begin());
+        lease->addr_ = IOAddress(boost::asio::ip::address_v6(bytes));
+        if (record[16] > Lease::TYPE_PD) {
+            isc_throw(BinaryLeaseFileError, "invalid lease type "
+                      << static_cast<int>(record[16]));
+        }
+        lease->type_ = static_cast<Lease::Type>(record[16]);
+        lease->prefixlen_ = record[17];
+        lease->iaid_ = readUint32(record + 20, 4);
+        lease->preferred_lft_ = readUint32(record + 24, 4);
+        readCommon(record + 28, *lease);
+        size_t length = 0;
+        const uint8_t* duid = readString(record + 28 + COMMON_SIZE, length);
+        if (length > 0) {
+            lease->duid_.reset(new DUID(duid, length));
+        } else {
+            lease->duid_.reset(new DUID(DUID::EMPTY()));
+        }
+
+    } catch (const std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
+
+        // The lease might have been created, so let's set it back to NULL to
+        // signal that lease hasn't been parsed.
+        lease.reset();
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    // bump the number of leases read
+    ++read_leases_;
+
+    return (true);
+}
+
+} // namespace dhcp
+} // namespace isc
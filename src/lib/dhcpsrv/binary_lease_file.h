@@ -0,0 +1,396 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef BINARY_LEASE_FILE_H
+#define BINARY_LEASE_FILE_H
+
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_file_stats.h>
+#include <exceptions/exceptions.h>
+#include <util/versioned_csv_file.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Exception thrown when a binary lease file can't be opened,
+/// read or written.
+class BinaryLeaseFileError : public Exception {
+public:
+    BinaryLeaseFileError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+/// @brief Lease file in the binary format.
+///
+/// The binary format holds a snapshot of the leases, e.g. written by the
+/// Lease File Cleanup, which can be loaded much faster than a CSV file:
+/// the file is memory mapped and each lease is decoded from a fixed-width
+/// record without any text parsing. The layout of the file is:
+/// - a header of @c HEADER_SIZE bytes: the "KEALEASE" magic, the format
+///   version (uint16), the universe (uint8), a reserved byte, the size of
+///   the records (uint32), the number of records (uint64), the offset and
+///   the size of the string table (uint64 each),
+/// - the records, in the order they were appended,
+/// - the string table, holding the variable-length values (client
+///   identifiers, DUIDs, hostnames and user contexts) the records refer
+///   to by offset and length. Equal values are stored once.
+///
+/// All the integers are stored in network byte order. The string table
+/// and the counters of the header are written when the file is closed,
+/// so a file whose writing was interrupted is rejected.
+///
+/// The records of both universes hold the following common fields (64
+/// bytes): the valid lifetime (4 bytes), the client last transmission
+/// time (8), the subnet identifier (4), the state (4), the flags (1), the
+/// hardware address length (1) and type (2), the hardware address source
+/// (4), the hardware address (20) and the references to the hostname and
+/// to the user context (8 each).
+///
+/// The records of a newer minor version may be longer: the reader uses
+/// the record size from the header and ignores the trailing bytes.
+///
+/// This class implements the functions shared by the DHCPv4 and DHCPv6
+/// files. Files are opened either for reading with @c open or for writing
+/// with @c recreate.
+class BinaryLeaseFile : public LeaseFileStats, public boost::noncopyable {
+public:
+
+    /// @brief Size of the file header.
+    static const size_t HEADER_SIZE = 40;
+
+    /// @brief Version of the format.
+    static const uint16_t FORMAT_VERSION = 1;
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    /// @param universe 4 or 6.
+    /// @param record_size Size of the records written.
+    BinaryLeaseFile(const std::string& filename, const uint8_t universe,
+                    const size_t record_size);
+
+    /// @brief Destructor.
+    ///
+    /// Closes the file.
+    virtual ~BinaryLeaseFile();
+
+    /// @brief Checks if a file is in the binary format.
+    ///
+    /// @param filename Name of the file.
+    /// @return true if the file begins with the binary lease file magic.
+    static bool isBinary(const std::string& filename);
+
+    /// @brief Returns the name of the file.
+    std::string getFilename() const {
+        return (filename_);
+    }
+
+    /// @brief Checks if the file exists and can be opened for reading.
+    bool exists() const;
+
+    /// @brief Opens the file for reading.
+    ///
+    /// The file is memory mapped and its header is checked. The reading
+    /// statistics are cleared.
+    ///
+    /// @param seek_to_end Ignored, the files are not appended to after
+    /// they are closed.
+    /// @throw BinaryLeaseFileError if the file can't be opened or is not a
+    /// complete lease file of the expected universe and version.
+    void open(const bool seek_to_end = false);
+
+    /// @brief Creates the file for writing.
+    ///
+    /// An existing file is truncated.
+    ///
+    /// @throw BinaryLeaseFileError if the file can't be created.
+    void recreate();
+
+    /// @brief Closes the file.
+    ///
+    /// When the file is written, the string table and the header are
+    /// written first. It is allowed to close multiple times.
+    ///
+    /// @throw BinaryLeaseFileError if the file can't be completed.
+    void close();
+
+    /// @brief Returns the description of the last read error.
+    std::string getReadMsg() const {
+        return (read_msg_);
+    }
+
+    /// @brief Returns false, binary files never need a conversion.
+    ///
+    /// The following three functions let @c LeaseFileLoader handle the
+    /// binary files and the CSV files alike.
+    bool needsConversion() const {
+        return (false);
+    }
+
+    /// @brief Returns the schema state, always current.
+    util::VersionedCSVFile::InputSchemaState getInputSchemaState() const {
+        return (util::VersionedCSVFile::CURRENT);
+    }
+
+    /// @brief Returns the version of the format.
+    std::string getSchemaVersion() const;
+
+    /// @brief Default size of the ranges the file is split into to be
+    /// read concurrently, in records.
+    static const uint64_t READ_CHUNK_SIZE = 16384;
+
+    /// @brief Returns the number of records of the file open for reading.
+    ///
+    /// The read ranges (see @c setReadRange) are expressed in records.
+    uint64_t getReadSize() const {
+        return (record_count_);
+    }
+
+    /// @brief Restricts the reading to a range of records.
+    ///
+    /// The next read record is the first of the range and the end of the
+    /// file is returned after the last one. This lets several objects read
+    /// the parts of a file concurrently.
+    ///
+    /// @param begin Index of the first record of the range.
+    /// @param end Index following the last record of the range.
+    /// @throw BinaryLeaseFileError if the file is not open for reading.
+    void setReadRange(const uint64_t begin, const uint64_t end);
+
+protected:
+
+    /// @brief Returns the next record to decode.
+    ///
+    /// @return Pointer to the record or NULL at the end of the file.
+    /// @throw BinaryLeaseFileError if the file is not open for reading.
+    const uint8_t* nextRecord();
+
+    /// @brief Queues a record to be written.
+    ///
+    /// @param record The record, of the record size.
+    /// @throw BinaryLeaseFileError if the file is not open for writing or
+    /// the write fails.
+    void appendRecord(const uint8_t* record);
+
+    /// @brief Stores a value in the string table.
+    ///
+    /// @param data The value.
+    /// @param length Its length.
+    /// @param [out] ref Buffer receiving the reference to the value, 8 bytes.
+    /// @throw BinaryLeaseFileError if the string table is full.
+    void writeString(const uint8_t* data, const size_t length, uint8_t* ref);
+
+    /// @brief Stores a string in the string table.
+    ///
+    /// @param value The string.
+    /// @param [out] ref Buffer receiving the reference to the value, 8 bytes.
+    void writeString(const std::string& value, uint8_t* ref) {
+        writeString(reinterpret_cast<const uint8_t*>(value.data()),
+                    value.size(), ref);
+    }
+
+    /// @brief Reads a value from the string table.
+    ///
+    /// @param ref The reference to the value, 8 bytes.
+    /// @param [out] length The length of the value.
+    /// @return Pointer to the value.
+    /// @throw BinaryLeaseFileError if the reference is out of the table.
+    const uint8_t* readString(const uint8_t* ref, size_t& length) const;
+
+    /// @brief Reads a string from the string table.
+    ///
+    /// @param ref The reference to the value, 8 bytes.
+    /// @return The string.
+    std::string readString(const uint8_t* ref) const;
+
+    /// @brief Writes the fields common to the DHCPv4 and DHCPv6 leases.
+    ///
+    /// @param lease The lease.
+    /// @param [out] fields Buffer receiving the common fields, 64 bytes.
+    /// @throw BinaryLeaseFileError if the hardware address is too long.
+    void writeCommon(const Lease& lease, uint8_t* fields);
+
+    /// @brief Reads the fields common to the DHCPv4 and DHCPv6 leases.
+    ///
+    /// @param fields The common fields.
+    /// @param [out] lease The lease.
+    /// @throw BinaryLeaseFileError if the fields are invalid.
+    void readCommon(const uint8_t* fields, Lease& lease) const;
+
+    /// @brief Size of the common fields.
+    static const size_t COMMON_SIZE = 64;
+
+    /// @brief Sets the read error.
+    ///
+    /// @param msg The error.
+    void setReadMsg(const std::string& msg) {
+        read_msg_ = msg;
+    }
+
+private:
+
+    /// @brief Fills the header of the file.
+    ///
+    /// @param [out] header Buffer receiving the header.
+    /// @param count Number of records.
+    /// @param strings_offset Offset of the string table, 0 while the file
+    /// is written.
+    /// @param strings_size Size of the string table.
+    void writeHeader(uint8_t* header, const uint64_t count,
+                     const uint64_t strings_offset,
+                     const uint64_t strings_size) const;
+
+    /// @brief Writes the buffered records to the file.
+    ///
+    /// @param fd The file descriptor of the file.
+    /// @throw BinaryLeaseFileError if the write fails.
+    void flushRecords(int fd);
+
+    /// @brief Name of the file.
+    std::string filename_;
+
+    /// @brief Universe of the leases.
+    uint8_t universe_;
+
+    /// @brief Size of the records written.
+    size_t record_size_;
+
+    /// @brief File descriptor of the file open for writing or -1.
+    int fd_;
+
+    /// @brief Mapping of the file open for reading or NULL.
+    uint8_t* map_;
+
+    /// @brief Size of the mapping.
+    size_t map_size_;
+
+    /// @brief Size of the records read.
+    size_t read_record_size_;
+
+    /// @brief Number of records read.
+    uint64_t record_count_;
+
+    /// @brief Index of the next record read.
+    uint64_t next_index_;
+
+    /// @brief Index following the last record read.
+    uint64_t end_index_;
+
+    /// @brief Beginning of the string table read.
+    const uint8_t* strings_;
+
+    /// @brief Size of the string table read.
+    uint64_t strings_size_;
+
+    /// @brief Records waiting to be written.
+    std::vector<uint8_t> records_;
+
+    /// @brief Number of records written.
+    uint64_t written_count_;
+
+    /// @brief String table being written.
+    std::string string_table_;
+
+    /// @brief Offsets of the values of the string table being written.
+    std::unordered_map<std::string, uint32_t> string_offsets_;
+
+    /// @brief Last read error.
+    std::string read_msg_;
+};
+
+/// @brief DHCPv4 lease file in the binary format.
+///
+/// The records hold, in this order: the address (4 bytes), the common
+/// fields (64) and the reference to the client identifier (8).
+class BinaryLeaseFile4 : public BinaryLeaseFile {
+public:
+
+    /// @brief Size of the records.
+    static const size_t RECORD_SIZE = 76;
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    BinaryLeaseFile4(const std::string& filename);
+
+    /// @brief Appends a lease to the file.
+    ///
+    /// @param lease The lease.
+    /// @throw BinaryLeaseFileError if the file is not open for writing.
+    void append(const Lease4& lease);
+
+    /// @brief Reads the next lease.
+    ///
+    /// This function is exception safe.
+    ///
+    /// @param [out] lease The lease read or NULL at the end of the file.
+    /// @return true if the lease was read or the end of the file was hit,
+    /// false on error, the error being returned by @c getReadMsg.
+    bool next(Lease4Ptr& lease);
+};
+
+/// @brief DHCPv6 lease file in the binary format.
+///
+/// The records hold, in this order: the address (16 bytes), the lease
+/// type (1), the prefix length (1), two reserved bytes, the IAID (4), the
+/// preferred lifetime (4), the common fields (64) and the reference to
+/// the DUID (8).
+class BinaryLeaseFile6 : public BinaryLeaseFile {
+public:
+
+    /// @brief Size of the records.
+    static const size_t RECORD_SIZE = 100;
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    BinaryLeaseFile6(const std::string& filename);
+
+    /// @brief Appends a lease to the file.
+    ///
+    /// @param lease The lease.
+    /// @throw BinaryLeaseFileError if the file is not open for writing.
+    void append(const Lease6& lease);
+
+    /// @brief Reads the next lease.
+    ///
+    /// This function is exception safe.
+    ///
+    /// @param [out] lease The lease read or NULL at the end of the file.
+    /// @return true if the lease was read or the end of the file was hit,
+    /// false on error, the error being returned by @c getReadMsg.
+    bool next(Lease6Ptr& lease);
+};
+
+/// @brief Returns the binary lease file type of a lease type.
+///
+/// @tparam LeaseObjectType @c Lease4 or @c Lease6.
+template<typename LeaseObjectType>
+struct BinaryLeaseFileTraits;
+
+/// @brief Binary lease file type of the DHCPv4 leases.
+template<>
+struct BinaryLeaseFileTraits<Lease4> {
+    typedef BinaryLeaseFile4 FileType;
+};
+
+/// @brief Binary lease file type of the DHCPv6 leases.
+template<>
+struct BinaryLeaseFileTraits<Lease6> {
+    typedef BinaryLeaseFile6 FileType;
+};
+
+} // namespace dhcp
+} // namespace isc
+
+#endif // BINARY_LEASE_FILE_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -49,7 +49,14 @@ OptionDescriptor::equals(const OptionDescriptor& other) const {
             option_->equals(other.option_));
 }
 
-CfgOption::CfgOption() {
+std::atomic<uint64_t> CfgOption::generation_(0);
+
+CfgOption::CfgOption()
+    : client_specific_(false) {
+}
+
+CfgOption::~CfgOption() {
+    changed();
 }
 
 bool
@@ -90,6 +97,7 @@ CfgOption::add(const OptionDescriptor& desc, const std::string& option_space) {
     } else {
         options_.addItem(desc, option_space);
     }
+    changed();
 }
 
 void
@@ -115,6 +123,7 @@ CfgOption::replace(const OptionDescriptor& desc, const std::string& option_space
     } 
 
     idx.replace(od_itr, desc);
+    changed();
 }
 
 
@@ -234,6 +243,7 @@ CfgOption::mergeTo(CfgOption& other) const {
     mergeInternal(options_, other.options_);
     // Merge vendor options.
     mergeInternal(vendor_options_, other.vendor_options_);
+    other.changed();
 }
 
 void
@@ -250,6 +260,7 @@ CfgOption::encapsulate() {
     encapsulateInternal(DHCP4_OPTION_SPACE);
     // Append sub-options to the top level "dhcp6" option space.
     encapsulateInternal(DHCP6_OPTION_SPACE);
+    changed();
 }
 
 void
@@ -369,6 +380,7 @@ CfgOption::del(const std::string& option_space, const uint16_t option_code) {
         }
     }
 
+    changed();
     auto& idx = options->get<1>();
     return (idx.erase(option_code));
 }
@@ -382,6 +394,7 @@ CfgOption::del(const uint32_t vendor_id, const uint16_t option_code) {
         return (0);
     }
 
+    changed();
     auto& idx = vendor_options->get<1>();
     return (idx.erase(option_code));
 }
@@ -422,6 +435,13 @@ CfgOption::del(const uint64_t id) {
     return (num_deleted);
 }
 
+void
+CfgOption::changed() const {
+    if (!client_specific_) {
+        ++generation_;
+    }
+}
+
 ElementPtr
 CfgOption::toElement() const {
     return (toElementWithMetadata(false));
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -21,6 +21,7 @@
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/shared_ptr.hpp>
+#include <atomic>
 #include <stdint.h>
 #include <string>
 #include <list>
@@ -301,6 +302,9 @@ public:
     /// @brief default constructor
     CfgOption();
 
+    /// @brief Destructor.
+    virtual ~CfgOption();
+
     /// @brief Indicates the object is empty
     ///
     /// @return true when the object is empty
@@ -627,8 +631,43 @@ public:
     isc::data::ElementPtr
     toElementWithMetadata(const bool include_metadata) const;
 
+    /// @brief Marks the options as specific to a client.
+    ///
+    /// The options of the host reservations are specific to a client,
+    /// which are usually fetched from a database for each query, while
+    /// the options of the pools, subnets, shared networks, classes and
+    /// the global options are shared by the clients. Only the latter
+    /// are flattened (see @ref FlatCfgOption).
+    ///
+    /// @param client_specific true if the options are specific to a client.
+    void setClientSpecific(const bool client_specific) {
+        client_specific_ = client_specific;
+    }
+
+    /// @brief Checks if the options are specific to a client.
+    ///
+    /// @return true if the options are specific to a client.
+    bool isClientSpecific() const {
+        return (client_specific_);
+    }
+
+    /// @brief Returns the generation of the options.
+    ///
+    /// The generation is incremented when an option configuration which
+    /// is not specific to a client is modified or destroyed, so as the
+    /// flattened options can be rebuilt.
+    ///
+    /// @return the current generation.
+    static uint64_t getGeneration() {
+        return (generation_);
+    }
+
 private:
 
+    /// @brief Increments the generation unless the options are specific
+    /// to a client.
+    void changed() const;
+
     /// @brief Appends encapsulated options to the options in an option space.
     ///
     /// This method appends sub-options to the options belonging to the
@@ -682,6 +721,12 @@ private:
                                  uint32_t> VendorOptionSpaceCollection;
     /// @brief Container holding options grouped by vendor id.
     VendorOptionSpaceCollection vendor_options_;
+
+    /// @brief Indicates if the options are specific to a client.
+    bool client_specific_;
+
+    /// @brief The generation of the options.
+    static std::atomic<uint64_t> generation_;
 };
 
 /// @name Pointers to the @c CfgOption objects.
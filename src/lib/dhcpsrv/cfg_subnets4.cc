@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -23,6 +23,11 @@ using namespace isc::data;
 namespace isc {
 namespace dhcp {
 
+CfgSubnets4::CfgSubnets4()
+    : subnets_(), selection_changed_(new std::atomic<bool>(false)),
+      selection_index_() {
+}
+
 void
 CfgSubnets4::add(const Subnet4Ptr& subnet) {
     if (getBySubnetId(subnet->getID())) {
@@ -39,6 +44,8 @@ CfgSubnets4::add(const Subnet4Ptr& subnet) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_ADD_SUBNET4)
               .arg(subnet->toText());
     static_cast<void>(subnets_.push_back(subnet));
+    subnet->setSelectionChangedFlag(selection_changed_);
+    resetSelectionIndex();
 }
 
 Subnet4Ptr
@@ -52,6 +59,10 @@ CfgSubnets4::replace(const Subnet4Ptr& subnet) {
     }
     Subnet4Ptr old = *subnet_it;
     bool ret = index.replace(subnet_it, subnet);
+    if (ret) {
+        subnet->setSelectionChangedFlag(selection_changed_);
+    }
+    resetSelectionIndex();
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_UPDATE_SUBNET4)
         .arg(subnet_id).arg(ret);
@@ -79,6 +90,7 @@ CfgSubnets4::del(const SubnetID& subnet_id) {
     Subnet4Ptr subnet = *subnet_it;
 
     index.erase(subnet_it);
+    resetSelectionIndex();
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_DEL_SUBNET4)
         .arg(subnet->toText());
@@ -160,6 +172,7 @@ CfgSubnets4::merge(CfgOptionDefPtr cfg_def, CfgSharedNetworks4Ptr networks,
 
         // Add the "other" subnet to the our collection of subnets.
         static_cast<void>(subnets_.push_back(*other_subnet));
+        (*other_subnet)->setSelectionChangedFlag(selection_changed_);
 
         // If it belongs to a shared network, find the network and
         // add the subnet to it
@@ -178,6 +191,9 @@ CfgSubnets4::merge(CfgOptionDefPtr cfg_def, CfgSharedNetworks4Ptr networks,
             }
         }
     }
+
+    // The lookups use the previous index until the new one is published.
+    updateSelectionIndex();
 }
 
 ConstSubnet4Ptr
@@ -306,29 +322,11 @@ CfgSubnets4::selectSubnet(const SubnetSelector& selector) const {
     // addresses across all subnets, but we need to verify that for all subnets
     // before we can try to use the giaddr to match with the subnet prefix.
     if (!selector.giaddr_.isV4Zero()) {
-        for (Subnet4Collection::const_iterator subnet = subnets_.begin();
-             subnet != subnets_.end(); ++subnet) {
-
-            // If relay information is specified for this subnet, it must match.
-            // Otherwise, we ignore this subnet.
-            if ((*subnet)->hasRelays()) {
-                if (!(*subnet)->hasRelayAddress(selector.giaddr_)) {
-                    continue;
-                }
-            } else {
-                // Relay information is not specified on the subnet level,
-                // so let's try matching on the shared network level.
-                SharedNetwork4Ptr network;
-                (*subnet)->getSharedNetwork(network);
-                if (!network || !(network->hasRelayAddress(selector.giaddr_))) {
-                    continue;
-                }
-            }
-
-            // If a subnet meets the client class criteria return it.
-            if ((*subnet)->clientSupported(selector.client_classes_)) {
-                return (*subnet);
-            }
+        Subnet4Ptr subnet =
+            getSelectionIndex()->selectByRelay(selector.giaddr_,
+                                               selector.client_classes_);
+        if (subnet) {
+            return (subnet);
         }
     }
 
@@ -392,44 +390,15 @@ CfgSubnets4::selectSubnet(const SubnetSelector& selector) const {
 Subnet4Ptr
 CfgSubnets4::selectSubnet(const std::string& iface,
                           const ClientClasses& client_classes) const {
-    for (Subnet4Collection::const_iterator subnet = subnets_.begin();
-         subnet != subnets_.end(); ++subnet) {
-
-        Subnet4Ptr subnet_selected;
-
-        // First, try subnet specific interface name.
-        if (!(*subnet)->getIface().empty()) {
-            if ((*subnet)->getIface() == iface) {
-                subnet_selected = (*subnet);
-            }
-
-        } else {
-            // Interface not specified for a subnet, so let's try if
-            // we can match with shared network specific setting of
-            // the interface.
-            SharedNetwork4Ptr network;
-            (*subnet)->getSharedNetwork(network);
-            if (network && !network->getIface().empty() &&
-                (network->getIface() == iface)) {
-                subnet_selected = (*subnet);
-            }
-        }
-
-        if (subnet_selected) {
-
-            // If a subnet meets the client class criteria return it.
-            if (subnet_selected->clientSupported(client_classes)) {
-                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
-                          DHCPSRV_CFGMGR_SUBNET4_IFACE)
-                    .arg((*subnet)->toText())
-                    .arg(iface);
-                return (subnet_selected);
-            }
-        }
+    Subnet4Ptr subnet = getSelectionIndex()->selectByIface(iface,
+                                                           client_classes);
+    if (subnet) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                  DHCPSRV_CFGMGR_SUBNET4_IFACE)
+            .arg(subnet->toText())
+            .arg(iface);
     }
-
-    // Failed to find a subnet.
-    return (Subnet4Ptr());
+    return (subnet);
 }
 
 Subnet4Ptr
@@ -448,25 +417,79 @@ CfgSubnets4::getSubnet(const SubnetID id) const {
 Subnet4Ptr
 CfgSubnets4::selectSubnet(const IOAddress& address,
                  const ClientClasses& client_classes) const {
+    Subnet4Ptr subnet = getSelectionIndex()->selectByAddress(address,
+                                                             client_classes);
+    if (subnet) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET4_ADDR)
+            .arg(subnet->toText())
+            .arg(address.toText());
+    }
+    return (subnet);
+}
+
+CfgSubnets4::ConstSelectionIndexPtr
+CfgSubnets4::getSelectionIndex() const {
+    // A selection parameter was modified in place: discard the index.
+    // The flag is only read on the common path.
+    if (selection_changed_->load() && selection_changed_->exchange(false)) {
+        boost::atomic_store(&selection_index_, ConstSelectionIndexPtr());
+    }
+
+    ConstSelectionIndexPtr index = boost::atomic_load(&selection_index_);
+    if (!index) {
+        // The subnets were changed since the last commit. Build the index
+        // and publish it, unless another thread has already done it.
+        ConstSelectionIndexPtr expected;
+        index = buildSelectionIndex();
+        if (!boost::atomic_compare_exchange(&selection_index_, &expected,
+                                            index)) {
+            index = expected;
+        }
+    }
+    return (index);
+}
+
+void
+CfgSubnets4::updateSelectionIndex() {
+    selection_changed_->store(false);
+    boost::atomic_store(&selection_index_, buildSelectionIndex());
+}
+
+CfgSubnets4::ConstSelectionIndexPtr
+CfgSubnets4::buildSelectionIndex() const {
+    boost::shared_ptr<SelectionIndex> index(new SelectionIndex());
     for (Subnet4Collection::const_iterator subnet = subnets_.begin();
          subnet != subnets_.end(); ++subnet) {
+        size_t rank = index->add(*subnet);
 
-        // Address is in range for the subnet prefix, so return it.
-        if (!(*subnet)->inRange(address)) {
-            continue;
+        SharedNetwork4Ptr network;
+        (*subnet)->getSharedNetwork(network);
+
+        // Relay addresses of the subnet or else of its shared network.
+        if ((*subnet)->hasRelays()) {
+            for (auto address : (*subnet)->getRelayAddresses()) {
+                index->addRelay(rank, address);
+            }
+        } else if (network) {
+            for (auto address : network->getRelayAddresses()) {
+                index->addRelay(rank, address);
+            }
         }
 
-        // If a subnet meets the client class criteria return it.
-        if ((*subnet)->clientSupported(client_classes)) {
-            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET4_ADDR)
-                .arg((*subnet)->toText())
-                .arg(address.toText());
-            return (*subnet);
+        // Interface name of the subnet or else of its shared network.
+        if (!(*subnet)->getIface().empty()) {
+            index->addIface(rank, (*subnet)->getIface().get());
+        } else if (network && !network->getIface().empty()) {
+            index->addIface(rank, network->getIface().get());
         }
     }
 
-    // Failed to find a subnet.
-    return (Subnet4Ptr());
+    return (index);
+}
+
+void
+CfgSubnets4::resetSelectionIndex() {
+    boost::atomic_store(&selection_index_, ConstSelectionIndexPtr());
 }
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,7 @@
 #include <dhcpsrv/cfg_shared_networks.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_id.h>
+#include <dhcpsrv/subnet_selection_index.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <boost/shared_ptr.hpp>
 #include <string>
@@ -33,6 +34,9 @@ namespace dhcp {
 class CfgSubnets4 : public isc::data::CfgToElement {
 public:
 
+    /// @brief Constructor.
+    CfgSubnets4();
+
     /// @brief Adds new subnet to the configuration.
     ///
     /// @param subnet Pointer to the subnet being added.
@@ -202,13 +206,9 @@ public:
     ///
     /// If the address matches with a subnet, the subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// The relay addresses, interface names and prefixes are looked up
+    /// in the selection index (see @c getSelectionIndex) rather than
+    /// compared with every subnet.
     ///
     /// @param selector Const reference to the selector structure which holds
     /// various information extracted from the client's packet which are used
@@ -234,13 +234,9 @@ public:
     /// testing. This method is also called by the
     /// @c selectSubnet(SubnetSelector).
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a simple
-    /// STL vector which precludes fast searches using specific keys.
-    /// Hence, full scan is required. To improve the search performance a
-    /// different container type is required, e.g. multi-index container,
-    /// or something of a similar functionality.
+    /// The subnets including the address are found with a prefix trie.
+    /// When several subnets include it, the first one in the configuration
+    /// order supporting the client classes is returned.
     ///
     /// @param address Address for which the subnet is searched.
     /// @param client_classes Optional parameter specifying the classes that
@@ -259,14 +255,6 @@ public:
     /// not match a subnet definition. This method is also called by the
     /// @c selectSubnet(SubnetSelector).
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a simple
-    /// STL vector which precludes fast searches using specific keys.
-    /// Hence, full scan is required. To improve the search performance a
-    /// different container type is required, e.g. multi-index container,
-    /// or something of a similar functionality.
-    ///
     /// @param iface name of the interface to be matched.
     /// @param client_classes Optional parameter specifying the classes that
     /// the client belongs to.
@@ -319,11 +307,57 @@ public:
     /// @return a pointer to unparsed configuration
     virtual isc::data::ElementPtr toElement() const;
 
+    /// @brief Type of the subnet selection index.
+    typedef SubnetSelectionIndex<Subnet4Ptr> SelectionIndex;
+
+    /// @brief Pointer to a subnet selection index.
+    typedef boost::shared_ptr<const SelectionIndex> ConstSelectionIndexPtr;
+
+    /// @brief Returns the subnet selection index.
+    ///
+    /// The index is an immutable snapshot published with an atomic store,
+    /// so it is read without a lock. It is normally built by
+    /// @c updateSelectionIndex when the configuration is committed. When
+    /// the subnets were changed since, or when the selection parameters
+    /// (interface name, relay addresses, interface-id or shared network)
+    /// of a subnet or shared network of this configuration were modified
+    /// in place, the index is built again by the first call and published
+    /// unless another thread published one first.
+    ///
+    /// @return Pointer to the index.
+    ConstSelectionIndexPtr getSelectionIndex() const;
+
+    /// @brief Builds and publishes the subnet selection index.
+    ///
+    /// It is called by the @c CfgMgr when the configuration is committed,
+    /// so as the first lookups do not pay for the build.
+    void updateSelectionIndex();
+
 private:
 
+    /// @brief Builds the subnet selection index from the subnets.
+    ///
+    /// @return Pointer to the new index.
+    ConstSelectionIndexPtr buildSelectionIndex() const;
+
+    /// @brief Discards the subnet selection index.
+    ///
+    /// Called when the subnets change so as the index is built again
+    /// on the next lookup or commit.
+    void resetSelectionIndex();
+
     /// @brief A container for IPv4 subnets.
     Subnet4Collection subnets_;
 
+    /// @brief The flag raised by the subnets and shared networks when
+    /// their selection parameters are modified.
+    SelectionChangedFlagPtr selection_changed_;
+
+    /// @brief The subnet selection index, null when it must be rebuilt.
+    ///
+    /// It is only accessed with the atomic load, store and exchange
+    /// functions for shared pointers.
+    mutable ConstSelectionIndexPtr selection_index_;
 };
 
 /// @name Pointer to the @c CfgSubnets4 objects.
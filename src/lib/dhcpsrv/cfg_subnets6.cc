@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -23,6 +23,11 @@ using namespace isc::data;
 namespace isc {
 namespace dhcp {
 
+CfgSubnets6::CfgSubnets6()
+    : subnets_(), selection_changed_(new std::atomic<bool>(false)),
+      selection_index_() {
+}
+
 void
 CfgSubnets6::add(const Subnet6Ptr& subnet) {
     if (getBySubnetId(subnet->getID())) {
@@ -39,6 +44,8 @@ CfgSubnets6::add(const Subnet6Ptr& subnet) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_ADD_SUBNET6)
               .arg(subnet->toText());
     static_cast<void>(subnets_.push_back(subnet));
+    subnet->setSelectionChangedFlag(selection_changed_);
+    resetSelectionIndex();
 }
 
 Subnet6Ptr
@@ -52,6 +59,10 @@ CfgSubnets6::replace(const Subnet6Ptr& subnet) {
     }
     Subnet6Ptr old = *subnet_it;
     bool ret = index.replace(subnet_it, subnet);
+    if (ret) {
+        subnet->setSelectionChangedFlag(selection_changed_);
+    }
+    resetSelectionIndex();
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_UPDATE_SUBNET6)
         .arg(subnet_id).arg(ret);
@@ -79,6 +90,7 @@ CfgSubnets6::del(const SubnetID& subnet_id) {
     Subnet6Ptr subnet = *subnet_it;
 
     index.erase(subnet_it);
+    resetSelectionIndex();
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_DEL_SUBNET6)
         .arg(subnet->toText());
@@ -162,6 +174,7 @@ CfgSubnets6::merge(CfgOptionDefPtr cfg_def, CfgSharedNetworks6Ptr networks,
 
         // Add the "other" subnet to the our collection of subnets.
         static_cast<void>(subnets_.push_back(*other_subnet));
+        (*other_subnet)->setSelectionChangedFlag(selection_changed_);
 
         // If it belongs to a shared network, find the network and
         // add the subnet to it
@@ -180,6 +193,9 @@ CfgSubnets6::merge(CfgOptionDefPtr cfg_def, CfgSharedNetworks6Ptr networks,
             }
         }
     }
+
+    // The lookups use the previous index until the new one is published.
+    updateSelectionIndex();
 }
 
 ConstSubnet6Ptr
@@ -266,52 +282,31 @@ CfgSubnets6::selectSubnet(const asiolink::IOAddress& address,
                           const ClientClasses& client_classes,
                           const bool is_relay_address) const {
 
+    ConstSelectionIndexPtr index = getSelectionIndex();
+    Subnet6Ptr subnet;
+
     // If the specified address is a relay address we first need to match
     // it with the relay addresses specified for all subnets.
     if (is_relay_address) {
-        for (Subnet6Collection::const_iterator subnet = subnets_.begin();
-             subnet != subnets_.end(); ++subnet) {
-
-            // If the specified address matches a relay address, return this
-            // subnet.
-            if ((*subnet)->hasRelays()) {
-                if (!(*subnet)->hasRelayAddress(address)) {
-                    continue;
-                }
-
-            } else {
-                SharedNetwork6Ptr network;
-                (*subnet)->getSharedNetwork(network);
-                if (!network || !network->hasRelayAddress(address)) {
-                    continue;
-                }
-            }
-
-            if ((*subnet)->clientSupported(client_classes)) {
-                // The relay address is matching the one specified for a subnet
-                // or its shared network.
-                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
-                          DHCPSRV_CFGMGR_SUBNET6_RELAY)
-                    .arg((*subnet)->toText()).arg(address.toText());
-                return (*subnet);
-            }
+        subnet = index->selectByRelay(address, client_classes);
+        if (subnet) {
+            // The relay address is matching the one specified for a subnet
+            // or its shared network.
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                      DHCPSRV_CFGMGR_SUBNET6_RELAY)
+                .arg(subnet->toText()).arg(address.toText());
+            return (subnet);
         }
     }
 
     // No success so far. Check if the specified address is in range
     // with any subnet.
-    for (Subnet6Collection::const_iterator subnet = subnets_.begin();
-         subnet != subnets_.end(); ++subnet) {
-        if ((*subnet)->inRange(address) &&
-            (*subnet)->clientSupported(client_classes)) {
-            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET6)
-                      .arg((*subnet)->toText()).arg(address.toText());
-            return (*subnet);
-        }
+    subnet = index->selectByAddress(address, client_classes);
+    if (subnet) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET6)
+                  .arg(subnet->toText()).arg(address.toText());
     }
-
-    // Nothing found.
-    return (Subnet6Ptr());
+    return (subnet);
 }
 
 
@@ -321,20 +316,16 @@ CfgSubnets6::selectSubnet(const std::string& iface_name,
 
     // If empty interface specified, we can't select subnet by interface.
     if (!iface_name.empty()) {
-        for (Subnet6Collection::const_iterator subnet = subnets_.begin();
-             subnet != subnets_.end(); ++subnet) {
-
-            // If interface name matches with the one specified for the subnet
-            // and the client is not rejected based on the classification,
-            // return the subnet.
-            if (((*subnet)->getIface() == iface_name) &&
-                (*subnet)->clientSupported(client_classes)) {
-
-                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
-                          DHCPSRV_CFGMGR_SUBNET6_IFACE)
-                    .arg((*subnet)->toText()).arg(iface_name);
-                return (*subnet);
-            }
+        // If interface name matches with the one specified for the subnet
+        // and the client is not rejected based on the classification,
+        // return the subnet.
+        Subnet6Ptr subnet =
+            getSelectionIndex()->selectByIface(iface_name, client_classes);
+        if (subnet) {
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                      DHCPSRV_CFGMGR_SUBNET6_IFACE)
+                .arg(subnet->toText()).arg(iface_name);
+            return (subnet);
         }
     }
 
@@ -348,26 +339,91 @@ CfgSubnets6::selectSubnet(const OptionPtr& interface_id,
     // We can only select subnet using an interface id, if the interface
     // id is known.
     if (interface_id) {
-        for (Subnet6Collection::const_iterator subnet = subnets_.begin();
-             subnet != subnets_.end(); ++subnet) {
-
-            // If interface id matches for the subnet and the subnet is not
-            // rejected based on the classification.
-            if ((*subnet)->getInterfaceId() &&
-                (*subnet)->getInterfaceId()->equals(interface_id) &&
-                (*subnet)->clientSupported(client_classes)) {
-
-                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+        // If interface id matches for the subnet and the subnet is not
+        // rejected based on the classification.
+        Subnet6Ptr subnet =
+            getSelectionIndex()->selectByInterfaceId(interface_id,
+                                                     client_classes);
+        if (subnet) {
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
                       DHCPSRV_CFGMGR_SUBNET6_IFACE_ID)
-                    .arg((*subnet)->toText());
-                return (*subnet);
-            }
+                .arg(subnet->toText());
+            return (subnet);
         }
     }
     // No subnet found.
     return (Subnet6Ptr());
 }
 
+CfgSubnets6::ConstSelectionIndexPtr
+CfgSubnets6::getSelectionIndex() const {
+    // A selection parameter was modified in place: discard the index.
+    // The flag is only read on the common path.
+    if (selection_changed_->load() && selection_changed_->exchange(false)) {
+        boost::atomic_store(&selection_index_, ConstSelectionIndexPtr());
+    }
+
+    ConstSelectionIndexPtr index = boost::atomic_load(&selection_index_);
+    if (!index) {
+        // The subnets were changed since the last commit. Build the index
+        // and publish it, unless another thread has already done it.
+        ConstSelectionIndexPtr expected;
+        index = buildSelectionIndex();
+        if (!boost::atomic_compare_exchange(&selection_index_, &expected,
+                                            index)) {
+            index = expected;
+        }
+    }
+    return (index);
+}
+
+void
+CfgSubnets6::updateSelectionIndex() {
+    selection_changed_->store(false);
+    boost::atomic_store(&selection_index_, buildSelectionIndex());
+}
+
+CfgSubnets6::ConstSelectionIndexPtr
+CfgSubnets6::buildSelectionIndex() const {
+    boost::shared_ptr<SelectionIndex> index(new SelectionIndex());
+    for (Subnet6Collection::const_iterator subnet = subnets_.begin();
+         subnet != subnets_.end(); ++subnet) {
+        size_t rank = index->add(*subnet);
+
+        // Relay addresses of the subnet or else of its shared network.
+        if ((*subnet)->hasRelays()) {
+            for (auto address : (*subnet)->getRelayAddresses()) {
+                index->addRelay(rank, address);
+            }
+        } else {
+            SharedNetwork6Ptr network;
+            (*subnet)->getSharedNetwork(network);
+            if (network) {
+                for (auto address : network->getRelayAddresses()) {
+                    index->addRelay(rank, address);
+                }
+            }
+        }
+
+        // Interface name and interface id, inherited from the shared
+        // network.
+        if (!(*subnet)->getIface().empty()) {
+            index->addIface(rank, (*subnet)->getIface().get());
+        }
+        OptionPtr interface_id = (*subnet)->getInterfaceId();
+        if (interface_id) {
+            index->addInterfaceId(rank, interface_id);
+        }
+    }
+
+    return (index);
+}
+
+void
+CfgSubnets6::resetSelectionIndex() {
+    boost::atomic_store(&selection_index_, ConstSelectionIndexPtr());
+}
+
 Subnet6Ptr
 CfgSubnets6::getSubnet(const SubnetID id) const {
 
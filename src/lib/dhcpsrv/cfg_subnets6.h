@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,7 @@
 #include <dhcpsrv/cfg_shared_networks.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_id.h>
+#include <dhcpsrv/subnet_selection_index.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <util/optional.h>
 #include <boost/shared_ptr.hpp>
@@ -34,6 +35,9 @@ namespace dhcp {
 class CfgSubnets6 : public isc::data::CfgToElement {
 public:
 
+    /// @brief Constructor.
+    CfgSubnets6();
+
     /// @brief Adds new subnet to the configuration.
     ///
     /// @param subnet Pointer to the subnet being added.
@@ -186,13 +190,9 @@ public:
     /// associated with any subnet. If not, it is checked if the link address
     /// is in range with any of the subnets.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// The interface names, interface ids, relay addresses and prefixes
+    /// are looked up in the selection index (see @c getSelectionIndex)
+    /// rather than compared with every subnet.
     ///
     /// @param selector Const reference to the selector structure which holds
     /// various information extracted from the client's packet which are used
@@ -227,13 +227,9 @@ public:
     /// address. For other purposes the @c selectSubnet(SubnetSelector) should
     /// rather be used instead.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// The subnets including the address are found with a prefix trie.
+    /// When several subnets include it, the first one in the configuration
+    /// order supporting the client classes is returned.
     ///
     /// @param address Address for which the subnet is searched.
     /// @param client_classes Optional parameter specifying the classes that
@@ -269,22 +265,51 @@ public:
     /// @return a pointer to unparsed configuration
     virtual isc::data::ElementPtr toElement() const;
 
+    /// @brief Type of the subnet selection index.
+    typedef SubnetSelectionIndex<Subnet6Ptr> SelectionIndex;
+
+    /// @brief Pointer to a subnet selection index.
+    typedef boost::shared_ptr<const SelectionIndex> ConstSelectionIndexPtr;
+
+    /// @brief Returns the subnet selection index.
+    ///
+    /// The index is an immutable snapshot published with an atomic store,
+    /// so it is read without a lock. It is normally built by
+    /// @c updateSelectionIndex when the configuration is committed. When
+    /// the subnets were changed since, or when the selection parameters
+    /// (interface name, relay addresses, interface-id or shared network)
+    /// of a subnet or shared network of this configuration were modified
+    /// in place, the index is built again by the first call and published
+    /// unless another thread published one first.
+    ///
+    /// @return Pointer to the index.
+    ConstSelectionIndexPtr getSelectionIndex() const;
+
+    /// @brief Builds and publishes the subnet selection index.
+    ///
+    /// It is called by the @c CfgMgr when the configuration is committed,
+    /// so as the first lookups do not pay for the build.
+    void updateSelectionIndex();
+
 private:
 
+    /// @brief Builds the subnet selection index from the subnets.
+    ///
+    /// @return Pointer to the new index.
+    ConstSelectionIndexPtr buildSelectionIndex() const;
+
+    /// @brief Discards the subnet selection index.
+    ///
+    /// Called when the subnets change so as the index is built again
+    /// on the next lookup or commit.
+    void resetSelectionIndex();
+
     /// @brief Selects a subnet using the interface name.
     ///
     /// This method searches for the subnet using the name of the interface.
     /// If any of the subnets is explicitly associated with the interface
     /// name, the subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a
-    /// simple STL vector which precludes fast searches using specific
-    /// keys. Hence, full scan is required. To improve the search
-    /// performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
-    ///
     /// @param iface_name Interface name.
     /// @param client_classes Optional parameter specifying the classes that
     /// the client belongs to.
@@ -301,14 +326,6 @@ private:
     /// of the subnets is explicitly associated with that interface id, the
     /// subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a
-    /// simple STL vector which precludes fast searches using specific
-    /// keys. Hence, full scan is required. To improve the search
-    /// performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
-    ///
     /// @param interface_id An instance of the Interface ID option received
     /// from the client.
     /// @param client_classes Optional parameter specifying the classes that
@@ -322,6 +339,15 @@ private:
     /// @brief A container for IPv6 subnets.
     Subnet6Collection subnets_;
 
+    /// @brief The flag raised by the subnets and shared networks when
+    /// their selection parameters are modified.
+    SelectionChangedFlagPtr selection_changed_;
+
+    /// @brief The subnet selection index, null when it must be rebuilt.
+    ///
+    /// It is only accessed with the atomic load, store and exchange
+    /// functions for shared pointers.
+    mutable ConstSelectionIndexPtr selection_index_;
 };
 
 /// @name Pointer to the @c CfgSubnets6 objects.
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -114,6 +114,16 @@ CfgMgr::commit() {
 
     // Now we need to set the statistics back.
     configuration_->updateStatistics();
+
+    // Resolve the inherited parameters of the networks once, with the
+    // global parameters of the new current configuration.
+    configuration_->cacheNetworkProperties();
+
+    // Build the subnet selection indexes now rather than on the first
+    // lookup, with the selection parameters set after the subnets were
+    // added, e.g. the shared networks.
+    configuration_->getCfgSubnets4()->updateSelectionIndex();
+    configuration_->getCfgSubnets6()->updateSelectionIndex();
 }
 
 void
@@ -204,6 +214,9 @@ CfgMgr::mergeIntoCurrentCfg(const uint32_t seq) {
         throw;
     }
     getCurrentCfg()->updateStatistics();
+
+    // The merged networks and global parameters are now in use.
+    getCurrentCfg()->cacheNetworkProperties();
 }
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -22,7 +22,7 @@ ClientClassDef::ClientClassDef(const std::string& name,
                                const ExpressionPtr& match_expr,
                                const CfgOptionPtr& cfg_option)
     : name_(name), match_expr_(match_expr), required_(false),
-      depend_on_known_(false), cfg_option_(cfg_option),
+      depend_on_known_(false), used_(true), cfg_option_(cfg_option),
       next_server_(asiolink::IOAddress::IPV4_ZERO_ADDRESS()) {
 
     // Name can't be blank
@@ -41,7 +41,7 @@ ClientClassDef::ClientClassDef(const std::string& name,
 
 ClientClassDef::ClientClassDef(const ClientClassDef& rhs)
     : name_(rhs.name_), match_expr_(ExpressionPtr()), required_(false),
-      depend_on_known_(false), cfg_option_(new CfgOption()),
+      depend_on_known_(false), used_(true), cfg_option_(new CfgOption()),
       next_server_(asiolink::IOAddress::IPV4_ZERO_ADDRESS()) {
 
     if (rhs.match_expr_) {
@@ -59,6 +59,7 @@ ClientClassDef::ClientClassDef(const ClientClassDef& rhs)
 
     required_ = rhs.required_;
     depend_on_known_ = rhs.depend_on_known_;
+    used_ = rhs.used_;
     next_server_ = rhs.next_server_;
     sname_ = rhs.sname_;
     filename_ = rhs.filename_;
@@ -137,6 +138,16 @@ ClientClassDef::setCfgOption(const CfgOptionPtr& cfg_option) {
     cfg_option_ = cfg_option;
 }
 
+bool
+ClientClassDef::getUsed() const {
+    return (used_);
+}
+
+void
+ClientClassDef::setUsed(bool used) {
+    used_ = used;
+}
+
 bool
 ClientClassDef::dependOnClass(const std::string& name) const {
     return (isc::dhcp::dependOnClass(match_expr_, name));
@@ -306,6 +317,28 @@ ClientClassDictionary::dependOnClass(const std::string& name,
     return (false);
 }
 
+void
+ClientClassDictionary::updateUsed(const std::set<std::string>& referenced) {
+    // A class can only depend on the classes defined before it so walking
+    // the list backward decides for the dependent classes first.
+    for (auto this_class = list_->rbegin(); this_class != list_->rend();
+         ++this_class) {
+        const ClientClassDefPtr& def = *this_class;
+        bool used = (def->getRequired() ||
+                     (referenced.count(def->getName()) > 0) ||
+                     (def->getCfgOption() && !def->getCfgOption()->empty()) ||
+                     !def->getNextServer().isV4Zero() ||
+                     !def->getSname().empty() ||
+                     !def->getFilename().empty());
+        for (auto dependent = list_->rbegin();
+             !used && (dependent != this_class); ++dependent) {
+            used = ((*dependent)->getUsed() &&
+                    (*dependent)->dependOnClass(def->getName()));
+        }
+        def->setUsed(used);
+    }
+}
+
 bool
 ClientClassDictionary::equals(const ClientClassDictionary& other) const {
     if (list_->size() != other.list_->size()) {
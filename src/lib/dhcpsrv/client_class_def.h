@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,7 @@
 #include <eval/token.h>
 #include <exceptions/exceptions.h>
 
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <list>
@@ -116,6 +117,14 @@ public:
     /// @param cfg_option the option collection to assign the class
     void setCfgOption(const CfgOptionPtr& cfg_option);
 
+    /// @brief Fetches the used flag
+    bool getUsed() const;
+
+    /// @brief Sets the used flag
+    ///
+    /// @param used the value of the used flag
+    void setUsed(bool used);
+
     /// @brief Checks direct dependency.
     ///
     /// @param name The client class name.
@@ -223,6 +232,13 @@ private:
     /// detected.
     bool depend_on_known_;
 
+    /// @brief The used flag: when true (the default) the match expression
+    /// is evaluated during classification. It is set to false by
+    /// @c ClientClassDictionary::updateUsed when nothing in the
+    /// configuration depends on the membership so the evaluation can be
+    /// skipped.
+    bool used_;
+
     /// @brief The option definition configuration for this class
     CfgOptionDefPtr cfg_option_def_;
 
@@ -339,6 +355,18 @@ public:
     /// @return true if a definition depends on the class name, false if none.
     bool dependOnClass(const std::string& name, std::string& dependent_class) const;
 
+    /// @brief Finds the classes which need to be evaluated.
+    ///
+    /// Sets the used flag of the classes whose membership is observed:
+    /// the classes with options, DHCPv4 fixed fields, the only if required
+    /// flag, referenced by the rest of the configuration or referenced by
+    /// the expression of another used class. The flag of the other classes
+    /// is cleared so their expression is not evaluated for each packet.
+    ///
+    /// @param referenced Names of the classes referenced by the rest of the
+    /// configuration, e.g. in subnets or pools.
+    void updateUsed(const std::set<std::string>& referenced);
+
     /// @brief Compares two @c ClientClassDictionary objects for equality.
     ///
     /// @param other Other client class definition to compare to.
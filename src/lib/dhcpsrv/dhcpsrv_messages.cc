@@ -137,6 +137,10 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_FILE_LOAD = "DHCPSRV_MEMF
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_LOAD = "DHCPSRV_MEMFILE_LEASE_LOAD";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR = "DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_EXECUTE = "DHCPSRV_MEMFILE_LFC_EXECUTE";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_IN_PROCESS_COMPLETE = "DHCPSRV_MEMFILE_LFC_IN_PROCESS_COMPLETE";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_IN_PROCESS_EXECUTE = "DHCPSRV_MEMFILE_LFC_IN_PROCESS_EXECUTE";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAIL = "DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAIL";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_IN_PROCESS_RUNNING = "DHCPSRV_MEMFILE_LFC_IN_PROCESS_RUNNING";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_LEASE_FILE_RENAME_FAIL = "DHCPSRV_MEMFILE_LFC_LEASE_FILE_RENAME_FAIL";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_LEASE_FILE_REOPEN_FAIL = "DHCPSRV_MEMFILE_LFC_LEASE_FILE_REOPEN_FAIL";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_SETUP = "DHCPSRV_MEMFILE_LFC_SETUP";
@@ -381,6 +385,10 @@ const char* values[] = {
     "DHCPSRV_MEMFILE_LEASE_LOAD", "loading lease %1",
     "DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR", "discarding row %1, error: %2",
     "DHCPSRV_MEMFILE_LFC_EXECUTE", "executing Lease File Cleanup using: %1",
+    "DHCPSRV_MEMFILE_LFC_IN_PROCESS_COMPLETE", "in-process lease file cleanup wrote %1 leases to %2",
+    "DHCPSRV_MEMFILE_LFC_IN_PROCESS_EXECUTE", "executing in-process Lease File Cleanup, write rate %1 leases/s",
+    "DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAIL", "in-process lease file cleanup failed: %1",
+    "DHCPSRV_MEMFILE_LFC_IN_PROCESS_RUNNING", "in-process lease file cleanup skipped because the previous one is in progress",
     "DHCPSRV_MEMFILE_LFC_LEASE_FILE_RENAME_FAIL", "failed to rename the current lease file %1 to %2, reason: %3",
     "DHCPSRV_MEMFILE_LFC_LEASE_FILE_REOPEN_FAIL", "failed to reopen lease file %1 after preparing input file for lease file cleanup, reason: %2, new leases will not be persisted!",
     "DHCPSRV_MEMFILE_LFC_SETUP", "setting up the Lease File Cleanup interval to %1 sec",
@@ -138,6 +138,10 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_FILE_LOAD;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_LOAD;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_EXECUTE;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_IN_PROCESS_COMPLETE;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_IN_PROCESS_EXECUTE;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAIL;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_IN_PROCESS_RUNNING;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_LEASE_FILE_RENAME_FAIL;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_LEASE_FILE_REOPEN_FAIL;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_SETUP;
@@ -0,0 +1,280 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/flat_cfg_option.h>
+#include <boost/functional/hash.hpp>
+
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Key of the cache, the addresses of the configurations.
+typedef std::vector<const CfgOption*> CacheKey;
+
+/// @brief Hash of the keys of the cache.
+struct CacheKeyHash {
+    /// @brief Returns the hash of a key.
+    ///
+    /// @param key The key.
+    size_t operator()(const CacheKey& key) const {
+        return (boost::hash_range(key.begin(), key.end()));
+    }
+};
+
+/// @brief Immutable snapshot of the cache of the flattened options.
+struct Cache {
+    /// @brief Constructor.
+    ///
+    /// @param generation The generation of the option configurations.
+    explicit Cache(const uint64_t generation) : generation_(generation) {
+    }
+
+    /// @brief The generation of the option configurations of the
+    /// cached entries.
+    uint64_t generation_;
+
+    /// @brief The flattened options by list of configurations.
+    std::unordered_map<CacheKey, ConstFlatCfgOptionPtr, CacheKeyHash> entries_;
+};
+
+/// @brief Pointer to a snapshot of the cache.
+typedef boost::shared_ptr<const Cache> ConstCachePtr;
+
+/// @brief Returns the current snapshot of the cache.
+///
+/// The snapshot is never modified once published: it is only accessed
+/// with the atomic load, store and compare exchange functions, so the
+/// lookups of the threads processing packets do not lock.
+ConstCachePtr&
+getCache() {
+    static ConstCachePtr cache(new Cache(CfgOption::getGeneration()));
+    return (cache);
+}
+
+/// @brief Empty list of codes.
+const std::vector<uint16_t> NO_CODES;
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const size_t FlatCfgOption::MAX_CACHE_SIZE;
+
+FlatCfgOption::FlatCfgOption(CfgOptionList::const_iterator first,
+                             CfgOptionList::const_iterator last) {
+    for (auto cfg = first; cfg != last; ++cfg) {
+        for (auto space : (*cfg)->getOptionSpaceNames()) {
+            flatten(**cfg, space, spaces_[space]);
+        }
+        for (auto vendor_id : (*cfg)->getVendorIds()) {
+            flatten(**cfg, vendor_id, vendors_[vendor_id]);
+        }
+    }
+}
+
+template<typename Selector>
+void
+FlatCfgOption::flatten(const CfgOption& cfg, const Selector& key,
+                       Space& space) {
+    OptionContainerPtr options = cfg.getAll(key);
+    for (auto desc = options->begin(); desc != options->end(); ++desc) {
+        if (!desc->option_) {
+            continue;
+        }
+        uint16_t code = desc->option_->getType();
+        if (space.options_.count(code) == 0) {
+            // Select the option as a search of the configuration would.
+            OptionDescriptor selected = cfg.get(key, code);
+            if (selected.option_) {
+                space.options_[code] = selected.option_;
+            }
+        }
+    }
+
+    const OptionContainerPersistIndex& idx = options->get<2>();
+    const OptionContainerPersistRange& range = idx.equal_range(true);
+    for (auto desc = range.first; desc != range.second; ++desc) {
+        if (desc->option_) {
+            space.persistent_.push_back(desc->option_->getType());
+        }
+    }
+}
+
+OptionPtr
+FlatCfgOption::get(const std::string& space, const uint16_t code) const {
+    auto it = spaces_.find(space);
+    if (it == spaces_.end()) {
+        return (OptionPtr());
+    }
+    auto option = it->second.options_.find(code);
+    if (option == it->second.options_.end()) {
+        return (OptionPtr());
+    }
+    return (option->second);
+}
+
+OptionPtr
+FlatCfgOption::get(const uint32_t vendor_id, const uint16_t code) const {
+    auto it = vendors_.find(vendor_id);
+    if (it == vendors_.end()) {
+        return (OptionPtr());
+    }
+    auto option = it->second.options_.find(code);
+    if (option == it->second.options_.end()) {
+        return (OptionPtr());
+    }
+    return (option->second);
+}
+
+const std::vector<uint16_t>&
+FlatCfgOption::getPersistent(const std::string& space) const {
+    auto it = spaces_.find(space);
+    return (it == spaces_.end() ? NO_CODES : it->second.persistent_);
+}
+
+const std::vector<uint16_t>&
+FlatCfgOption::getPersistent(const uint32_t vendor_id) const {
+    auto it = vendors_.find(vendor_id);
+    return (it == vendors_.end() ? NO_CODES : it->second.persistent_);
+}
+
+ConstFlatCfgOptionPtr
+FlatCfgOption::create(CfgOptionList::const_iterator first,
+                      CfgOptionList::const_iterator last) {
+    // The key is reused by the thread to not allocate it for each lookup.
+    static thread_local CacheKey key;
+    key.clear();
+    for (auto cfg = first; cfg != last; ++cfg) {
+        key.push_back(cfg->get());
+    }
+
+    ConstCachePtr& current = getCache();
+    uint64_t generation = CfgOption::getGeneration();
+    ConstCachePtr cache = boost::atomic_load(&current);
+    if (cache->generation_ == generation) {
+        auto it = cache->entries_.find(key);
+        if (it != cache->entries_.end()) {
+            return (it->second);
+        }
+    }
+
+    // Not cached: flatten the list and publish a new snapshot with it.
+    ConstFlatCfgOptionPtr flat(new FlatCfgOption(first, last));
+    for (;;) {
+        if (cache->generation_ == generation) {
+            auto it = cache->entries_.find(key);
+            if (it != cache->entries_.end()) {
+                // Another thread published it in the meantime.
+                return (it->second);
+            }
+        } else if (cache->generation_ > generation) {
+            // An option configuration was modified since this lookup
+            // started: do not cache options which may be stale.
+            return (flat);
+        }
+
+        boost::shared_ptr<Cache> updated(new Cache(generation));
+        // A changed generation means an option configuration was modified
+        // or destroyed, so the old entries are dropped.
+        if ((cache->generation_ == generation) &&
+            (cache->entries_.size() < MAX_CACHE_SIZE)) {
+            updated->entries_ = cache->entries_;
+        }
+        updated->entries_[key] = flat;
+        ConstCachePtr desired(updated);
+        if (boost::atomic_compare_exchange(&current, &cache, desired)) {
+            return (flat);
+        }
+        // The compare exchange failed and loaded the new snapshot.
+    }
+}
+
+size_t
+FlatCfgOption::getCacheSize() {
+    return (boost::atomic_load(&getCache())->entries_.size());
+}
+
+void
+FlatCfgOption::clearCache() {
+    ConstCachePtr empty(new Cache(CfgOption::getGeneration()));
+    boost::atomic_store(&getCache(), empty);
+}
+
+CfgOptionListResolver::CfgOptionListResolver(const CfgOptionList& list)
+    : list_(list), flat_begin_(list.begin()) {
+    while ((flat_begin_ != list_.end()) && (*flat_begin_)->isClientSpecific()) {
+        ++flat_begin_;
+    }
+    if (flat_begin_ != list_.end()) {
+        flat_ = FlatCfgOption::create(flat_begin_, list_.end());
+    }
+}
+
+template<typename Selector>
+OptionPtr
+CfgOptionListResolver::getInternal(const Selector& key,
+                                   const uint16_t code) const {
+    for (auto cfg = list_.begin(); cfg != flat_begin_; ++cfg) {
+        OptionDescriptor desc = (*cfg)->get(key, code);
+        if (desc.option_) {
+            return (desc.option_);
+        }
+    }
+    if (flat_) {
+        return (flat_->get(key, code));
+    }
+    return (OptionPtr());
+}
+
+OptionPtr
+CfgOptionListResolver::get(const std::string& space,
+                           const uint16_t code) const {
+    return (getInternal(space, code));
+}
+
+OptionPtr
+CfgOptionListResolver::get(const uint32_t vendor_id,
+                           const uint16_t code) const {
+    return (getInternal(vendor_id, code));
+}
+
+template<typename Selector>
+void
+CfgOptionListResolver::getPersistentInternal(const Selector& key,
+                                             std::vector<uint16_t>& codes) const {
+    for (auto cfg = list_.begin(); cfg != flat_begin_; ++cfg) {
+        OptionContainerPtr options = (*cfg)->getAll(key);
+        const OptionContainerPersistIndex& idx = options->get<2>();
+        const OptionContainerPersistRange& range = idx.equal_range(true);
+        for (auto desc = range.first; desc != range.second; ++desc) {
+            if (desc->option_) {
+                codes.push_back(desc->option_->getType());
+            }
+        }
+    }
+    if (flat_) {
+        const std::vector<uint16_t>& flat_codes = flat_->getPersistent(key);
+        codes.insert(codes.end(), flat_codes.begin(), flat_codes.end());
+    }
+}
+
+void
+CfgOptionListResolver::getPersistent(const std::string& space,
+                                     std::vector<uint16_t>& codes) const {
+    getPersistentInternal(space, codes);
+}
+
+void
+CfgOptionListResolver::getPersistent(const uint32_t vendor_id,
+                                     std::vector<uint16_t>& codes) const {
+    getPersistentInternal(vendor_id, codes);
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
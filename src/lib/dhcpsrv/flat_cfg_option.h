@@ -0,0 +1,220 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef FLAT_CFG_OPTION_H
+#define FLAT_CFG_OPTION_H
+
+#include <dhcp/option.h>
+#include <dhcpsrv/cfg_option.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+class FlatCfgOption;
+
+/// @brief Pointer to the flattened options.
+typedef boost::shared_ptr<const FlatCfgOption> ConstFlatCfgOptionPtr;
+
+/// @brief Options of a list of option configurations flattened by code.
+///
+/// A response carries, for each option code, the option of the first
+/// configuration of a list (host, pool, subnet, shared network, classes
+/// and global options) which configures it. This class resolves that
+/// cascade once for all the option spaces and vendors of a list: for each
+/// code it holds the option selected by the cascade, and it holds the
+/// codes of the persistent options in the cascade order.
+///
+/// The flattened options are cached by list of configurations (see
+/// @ref create) until an option configuration changes, so the cascade is
+/// resolved once per distinct list instead of once per requested option
+/// of each response. The options of the host reservations are specific to
+/// a client and are not flattened (see @ref CfgOptionListResolver).
+class FlatCfgOption : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param first Beginning of the list of configurations.
+    /// @param last End of the list of configurations.
+    FlatCfgOption(CfgOptionList::const_iterator first,
+                  CfgOptionList::const_iterator last);
+
+    /// @brief Returns the option selected for a code in an option space.
+    ///
+    /// @param space The option space.
+    /// @param code The option code.
+    /// @return The option or null.
+    OptionPtr get(const std::string& space, const uint16_t code) const;
+
+    /// @brief Returns the option selected for a code of a vendor.
+    ///
+    /// @param vendor_id The vendor identifier.
+    /// @param code The option code.
+    /// @return The option or null.
+    OptionPtr get(const uint32_t vendor_id, const uint16_t code) const;
+
+    /// @brief Returns the codes of the persistent options of an option
+    /// space.
+    ///
+    /// @param space The option space.
+    /// @return The codes in the cascade order, possibly repeated.
+    const std::vector<uint16_t>& getPersistent(const std::string& space) const;
+
+    /// @brief Returns the codes of the persistent options of a vendor.
+    ///
+    /// @param vendor_id The vendor identifier.
+    /// @return The codes in the cascade order, possibly repeated.
+    const std::vector<uint16_t>& getPersistent(const uint32_t vendor_id) const;
+
+    /// @brief Returns the flattened options of a list of configurations.
+    ///
+    /// The options are taken from the cache, or flattened and cached.
+    /// The cache is an immutable snapshot read without locking: a list
+    /// which is not cached yet is added to a copy of the snapshot, which
+    /// then replaces it. The configurations must not be specific to a
+    /// client.
+    ///
+    /// @param first Beginning of the list of configurations.
+    /// @param last End of the list of configurations.
+    /// @return The flattened options.
+    static ConstFlatCfgOptionPtr create(CfgOptionList::const_iterator first,
+                                        CfgOptionList::const_iterator last);
+
+    /// @brief Returns the number of cached lists.
+    static size_t getCacheSize();
+
+    /// @brief Empties the cache.
+    static void clearCache();
+
+    /// @brief Maximum number of cached lists.
+    ///
+    /// The cache is emptied when it is full.
+    static const size_t MAX_CACHE_SIZE = 4096;
+
+private:
+
+    /// @brief Flattened options of an option space or a vendor.
+    struct Space {
+        /// @brief The options by code.
+        std::unordered_map<uint16_t, OptionPtr> options_;
+
+        /// @brief The codes of the persistent options.
+        std::vector<uint16_t> persistent_;
+    };
+
+    /// @brief Flattens the options of a configuration.
+    ///
+    /// The options already selected by the previous configurations of
+    /// the list are kept.
+    ///
+    /// @param cfg The configuration.
+    /// @param key The option space or the vendor identifier.
+    /// @param space The flattened options.
+    /// @tparam Selector one of: @c std::string or @c uint32_t
+    template<typename Selector>
+    static void flatten(const CfgOption& cfg, const Selector& key,
+                        Space& space);
+
+    /// @brief The flattened options by option space.
+    std::unordered_map<std::string, Space> spaces_;
+
+    /// @brief The flattened options by vendor identifier.
+    std::unordered_map<uint32_t, Space> vendors_;
+};
+
+/// @brief Resolves the options of a list of option configurations.
+///
+/// The options are searched in the configurations at the head of the
+/// list which are specific to a client, i.e. the host reservation, then
+/// in the flattened options of the rest of the list. This gives the same
+/// result as searching each configuration of the list in turn.
+///
+/// The list must outlive the resolver.
+class CfgOptionListResolver : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param list The list of configurations.
+    explicit CfgOptionListResolver(const CfgOptionList& list);
+
+    /// @brief Checks if the list of configurations is empty.
+    ///
+    /// @return true if there is no configuration to resolve options from.
+    bool empty() const {
+        return (list_.empty());
+    }
+
+    /// @brief Returns the option for a code in an option space.
+    ///
+    /// @param space The option space.
+    /// @param code The option code.
+    /// @return The option of the first configuration which configures
+    /// it, or null.
+    OptionPtr get(const std::string& space, const uint16_t code) const;
+
+    /// @brief Returns the option for a code of a vendor.
+    ///
+    /// @param vendor_id The vendor identifier.
+    /// @param code The option code.
+    /// @return The option of the first configuration which configures
+    /// it, or null.
+    OptionPtr get(const uint32_t vendor_id, const uint16_t code) const;
+
+    /// @brief Appends the codes of the persistent options of an option
+    /// space.
+    ///
+    /// @param space The option space.
+    /// @param [out] codes The codes, appended in the list order.
+    void getPersistent(const std::string& space,
+                       std::vector<uint16_t>& codes) const;
+
+    /// @brief Appends the codes of the persistent options of a vendor.
+    ///
+    /// @param vendor_id The vendor identifier.
+    /// @param [out] codes The codes, appended in the list order.
+    void getPersistent(const uint32_t vendor_id,
+                       std::vector<uint16_t>& codes) const;
+
+private:
+
+    /// @brief Implements the get methods.
+    ///
+    /// @param key The option space or the vendor identifier.
+    /// @param code The option code.
+    /// @tparam Selector one of: @c std::string or @c uint32_t
+    template<typename Selector>
+    OptionPtr getInternal(const Selector& key, const uint16_t code) const;
+
+    /// @brief Implements the getPersistent methods.
+    ///
+    /// @param key The option space or the vendor identifier.
+    /// @param [out] codes The codes.
+    /// @tparam Selector one of: @c std::string or @c uint32_t
+    template<typename Selector>
+    void getPersistentInternal(const Selector& key,
+                               std::vector<uint16_t>& codes) const;
+
+    /// @brief The list of configurations.
+    const CfgOptionList& list_;
+
+    /// @brief The first configuration which is not specific to a client.
+    CfgOptionList::const_iterator flat_begin_;
+
+    /// @brief The flattened options of the rest of the list.
+    ConstFlatCfgOptionPtr flat_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // FLAT_CFG_OPTION_H
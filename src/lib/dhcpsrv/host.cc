@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -161,6 +161,10 @@ Host::Host(const uint8_t* identifier, const size_t identifier_len,
     // Initialize host identifier.
     setIdentifier(identifier, identifier_len, identifier_type);
 
+    // The options of a reservation are specific to the client.
+    cfg_option4_->setClientSpecific(true);
+    cfg_option6_->setClientSpecific(true);
+
     if (!ipv4_reservation.isV4Zero()) {
         // Validate and set IPv4 address reservation.
         setIPv4Reservation(ipv4_reservation);
@@ -197,6 +201,10 @@ Host::Host(const std::string& identifier, const std::string& identifier_name,
     // Initialize host identifier.
     setIdentifier(identifier, identifier_name);
 
+    // The options of a reservation are specific to the client.
+    cfg_option4_->setClientSpecific(true);
+    cfg_option6_->setClientSpecific(true);
+
     if (!ipv4_reservation.isV4Zero()) {
         // Validate and set IPv4 address reservation.
         setIPv4Reservation(ipv4_reservation);
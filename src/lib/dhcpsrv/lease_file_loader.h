@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,7 +7,9 @@
 #ifndef LEASE_FILE_LOADER_H
 #define LEASE_FILE_LOADER_H
 
+#include <dhcpsrv/binary_lease_file.h>
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/lease_file_stats.h>
 #include <dhcpsrv/memfile_lease_storage.h>
 #include <util/versioned_csv_file.h>
 #include <dhcpsrv/sanity_checker.h>
@@ -15,6 +17,12 @@
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 namespace isc {
 namespace dhcp {
 
@@ -53,9 +61,16 @@ public:
     /// means that the particular lease was released and the method
     /// removes an existing lease from the container.
     ///
-    /// @param lease_file A reference to the @c CSVLeaseFile4 or
-    /// @c CSVLeaseFile6 object representing the lease file. The file
-    /// doesn't need to be open because the method re-opens the file.
+    /// A file larger than a chunk is split into chunks parsed by
+    /// concurrent threads. The parsed leases are merged in the order of
+    /// the file directly into the storage, so the result is the same as
+    /// with a sequential load and the leases are not copied to another
+    /// container first.
+    ///
+    /// @param lease_file A reference to the @c CSVLeaseFile4,
+    /// @c CSVLeaseFile6, @c BinaryLeaseFile4 or @c BinaryLeaseFile6 object
+    /// representing the lease file. The file doesn't need to be open
+    /// because the method re-opens the file.
     /// @param storage A reference to the container to which leases
     /// should be inserted.
     /// @param max_errors Maximum number of corrupted leases in the
@@ -67,8 +82,15 @@ public:
     /// One case when the file is not opened is when the server starts
     /// up, reads the leases in the file and then leaves the file open
     /// for writing future lease updates.
+    /// @param threads Number of threads parsing the file, 0 to use the
+    /// number of processors. The default of 1 parses the file
+    /// sequentially.
+    /// @param chunk_size Size of the chunks, in the unit of the read
+    /// ranges of the lease file, 0 (default) to use the default chunk
+    /// size of the lease file.
     /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
-    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4, @c CSVLeaseFile6,
+    /// @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
     /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
     ///
     /// @throw isc::util::CSVFileError when the maximum number of errors
@@ -77,7 +99,9 @@ public:
              typename StorageType>
     static void load(LeaseFileType& lease_file, StorageType& storage,
                      const uint32_t max_errors = 0,
-                     const bool close_file_on_exit = true) {
+                     const bool close_file_on_exit = true,
+                     const size_t threads = 1,
+                     const uint64_t chunk_size = 0) {
 
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_FILE_LOAD)
             .arg(lease_file.getFilename());
@@ -87,6 +111,13 @@ public:
         lease_file.close();
         lease_file.open();
 
+        size_t thread_count = threads;
+        if (thread_count == 0) {
+            thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+        const uint64_t chunk = (chunk_size > 0 ? chunk_size :
+                                LeaseFileType::READ_CHUNK_SIZE);
+
         // Create lease sanity checker if checking is enabled.
         boost::scoped_ptr<SanityChecker> lease_checker;
         if (SanityChecker::leaseCheckingEnabled(false)) {
@@ -96,80 +127,34 @@ public:
             lease_checker.reset(new SanityChecker());
         }
 
-        boost::shared_ptr<LeaseObjectType> lease;
-        // Track the number of corrupted leases.
-        uint32_t errcnt = 0;
-        while (true) {
-            // Unable to parse the lease.
-            if (!lease_file.next(lease)) {
-                LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR)
-                            .arg(lease_file.getReads())
-                            .arg(lease_file.getReadMsg());
-
-                // A value of 0 indicates that we don't return
-                // until the whole file is parsed, even if errors occur.
-                // Otherwise, check if we have exceeded the maximum number
-                // of errors and throw an exception if we have.
-                if (max_errors && (++errcnt > max_errors)) {
-                    // If we break parsing the CSV file because of too many
-                    // errors, it doesn't make sense to keep the file open.
-                    // This is because the caller wouldn't know where we
-                    // stopped parsing and where the internal file pointer
-                    // is. So, there are probably no cases when the caller
-                    // would continue to use the open file.
-                    lease_file.close();
-                    isc_throw(util::CSVFileError, "exceeded maximum number of"
-                              " failures " << max_errors << " to read a lease"
-                              " from the lease file "
-                              << lease_file.getFilename());
-                }
-                // Skip the corrupted lease.
-                continue;
-            }
+        if ((thread_count > 1) && (lease_file.getReadSize() > chunk)) {
+            loadChunks<LeaseObjectType>(lease_file, storage, max_errors,
+                                        thread_count, chunk, lease_checker);
 
-            // Lease was found and we successfully parsed it.
-            if (lease) {
-                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL_DATA,
-                          DHCPSRV_MEMFILE_LEASE_LOAD)
-                    .arg(lease->toText());
-
-                if (lease_checker)  {
-                    // If the lease is insane the checker will reset the lease pointer.
-                    // As lease file is loaded during the configuration, we have
-                    // to use staging config, rather than current config for this
-                    // (false = staging).
-                    lease_checker->checkLease(lease, false);
-                    if (!lease) {
-                        continue;
-                    }
+        } else {
+            boost::shared_ptr<LeaseObjectType> lease;
+            // Track the number of corrupted leases.
+            uint32_t errcnt = 0;
+            while (true) {
+                // Unable to parse the lease.
+                if (!lease_file.next(lease)) {
+                    readError(lease_file, lease_file.getReads(),
+                              lease_file.getReadMsg(), max_errors, errcnt);
+                    // Skip the corrupted lease.
+                    continue;
                 }
 
-                // Check if this lease exists.
-                typename StorageType::iterator lease_it =
-                    storage.find(lease->addr_);
-                // The lease doesn't exist yet. Insert the lease if
-                // it has a positive valid lifetime.
-                if (lease_it == storage.end()) {
-                    if (lease->valid_lft_ > 0) {
-                        storage.insert(lease);
-                    }
-                } else {
-                    // The lease exists. If the new entry has a valid
-                    // lifetime of 0 it is an indication to remove the
-                    // existing entry. Otherwise, we update the lease.
-                    if (lease->valid_lft_ == 0) {
-                        storage.erase(lease_it);
-
-                    } else {
-                        // Use replace to re-index leases on update.
-                        storage.replace(lease_it, lease);
+                // Lease was found and we successfully parsed it.
+                if (lease) {
+                    if (checkLease(lease, lease_checker)) {
+                        updateStorage(storage, lease);
                     }
-                }
 
-            } else {
-                // Being here means that we hit the end of file.
-                break;
+                } else {
+                    // Being here means that we hit the end of file.
+                    break;
 
+                }
             }
         }
 
@@ -188,9 +173,57 @@ public:
         }
     }
 
+    /// @brief Load leases from a lease file in any format.
+    ///
+    /// The format of the file is detected: a file in the binary format
+    /// is loaded with a @c BinaryLeaseFile4 or @c BinaryLeaseFile6 object,
+    /// other files with a @c LeaseFileType object. The file is closed
+    /// on exit.
+    ///
+    /// @param filename Name of the lease file.
+    /// @param storage A reference to the container to which leases
+    /// should be inserted.
+    /// @param max_errors Maximum number of corrupted leases in the
+    /// lease file, 0 disables the limit check.
+    /// @param [out] stats The reading statistics of the file are added
+    /// to these statistics.
+    /// @param threads Number of threads parsing the file, 0 to use the
+    /// number of processors.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @return true if the file is in the CSV format with a schema which
+    /// is not the current one.
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded.
+    /// @throw BinaryLeaseFileError when the file is in the binary format
+    /// but can't be read.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    static bool loadFile(const std::string& filename, StorageType& storage,
+                         const uint32_t max_errors,
+                         LeaseFileStats& stats,
+                         const size_t threads = 1) {
+        if (BinaryLeaseFile::isBinary(filename)) {
+            typedef typename BinaryLeaseFileTraits<LeaseObjectType>::FileType
+                BinaryFileType;
+            BinaryFileType lease_file(filename);
+            load<LeaseObjectType>(lease_file, storage, max_errors, true,
+                                  threads);
+            stats.addStatistics(lease_file);
+            return (false);
+        }
+
+        LeaseFileType lease_file(filename);
+        load<LeaseObjectType>(lease_file, storage, max_errors, true, threads);
+        stats.addStatistics(lease_file);
+        return (lease_file.needsConversion());
+    }
+
     /// @brief Write leases from the storage into a lease file
     ///
-    /// This method iterates over the @c Lease4 or @c Lease6 object in the
+    /// This method materializes the @c Lease4 or @c Lease6 objects held in the
     /// storage specified in the arguments and writes them to the file
     /// specified in the arguments.
     ///
@@ -202,32 +235,36 @@ public:
     /// is the v4 or v6 IP address and they are written from lowest to highest.
     ///
     /// Before writing the method will close the file if it is open
-    /// and reopen it for writing.  After completion it will close
-    /// the file.
+    /// and recreate it, discarding its previous contents.  After
+    /// completion it will close the file.
     ///
-    /// @param lease_file A reference to the @c CSVLeaseFile4 or
-    /// @c CSVLeaseFile6 object representing the lease file. The file
-    /// doesn't need to be open because the method re-opens the file.
+    /// @param lease_file A reference to the @c CSVLeaseFile4,
+    /// @c CSVLeaseFile6, @c BinaryLeaseFile4 or @c BinaryLeaseFile6 object
+    /// representing the lease file. The file doesn't need to be open
+    /// because the method re-opens the file.
     /// @param storage A reference to the container from which leases
     /// should be written.
     ///
     /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
-    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4, @c CSVLeaseFile6,
+    /// @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
     /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
     template<typename LeaseObjectType, typename LeaseFileType,
              typename StorageType>
     static void write(LeaseFileType& lease_file, const StorageType& storage) {
-        // Reopen the file, as we don't know whether the file is open
+        // Recreate the file, as we don't know whether the file is open
         // and we also don't know its current state.
         lease_file.close();
-        lease_file.open();
+        lease_file.recreate();
+        // The statistics are the writing statistics of the new file.
+        lease_file.clearStatistics();
 
         // Iterate over the storage area writing out the leases
         for (typename StorageType::const_iterator lease = storage.begin();
              lease != storage.end();
              ++lease) {
             try {
-                lease_file.append(**lease);
+                lease_file.append(*lease->toLease());
             } catch (const isc::Exception&) {
                 // Close the file
                 lease_file.close();
@@ -238,6 +275,293 @@ public:
         // Close the file
         lease_file.close();
     }
+
+private:
+
+    /// @brief Leases read from a chunk of a lease file.
+    ///
+    /// The statistics are the reading statistics of the chunk.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    template<typename LeaseObjectType>
+    struct LeaseChunk : public LeaseFileStats {
+
+        /// @brief Leases read, in the order of the file.
+        std::vector<boost::shared_ptr<LeaseObjectType> > leases_;
+
+        /// @brief Read errors: number of reads of the chunk at the error
+        /// and description of the error.
+        std::vector<std::pair<uint32_t, std::string> > errors_;
+
+        /// @brief Error which stopped the reading of the chunk, if any.
+        std::string failure_;
+
+        /// @brief Does not count the read returning the end of the chunk.
+        ///
+        /// Only the end of the last chunk is the end of the file.
+        void uncountEnd() {
+            if (reads_ > 0) {
+                --reads_;
+            }
+        }
+    };
+
+    /// @brief Reads a chunk of a lease file.
+    ///
+    /// This function is run by the threads parsing the lease file: it
+    /// opens its own lease file object and doesn't throw.
+    ///
+    /// @param filename Name of the lease file.
+    /// @param begin Beginning of the read range of the chunk.
+    /// @param end End of the read range of the chunk.
+    /// @param last true for the last chunk of the file.
+    /// @param max_errors Maximum number of corrupted leases, 0 for no limit.
+    /// @param [out] chunk The leases, errors and statistics of the chunk.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4, @c CSVLeaseFile6,
+    /// @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
+    template<typename LeaseObjectType, typename LeaseFileType>
+    static void readChunk(const std::string& filename, const uint64_t begin,
+                          const uint64_t end, const bool last,
+                          const uint32_t max_errors,
+                          LeaseChunk<LeaseObjectType>& chunk) {
+        try {
+            LeaseFileType lease_file(filename);
+            lease_file.open();
+            lease_file.setReadRange(begin, end);
+            boost::shared_ptr<LeaseObjectType> lease;
+            while (true) {
+                if (!lease_file.next(lease)) {
+                    chunk.errors_.push_back(std::make_pair(lease_file.getReads(),
+                                                           lease_file.getReadMsg()));
+                    // The caller will stop after this number of errors.
+                    if (max_errors && (chunk.errors_.size() > max_errors)) {
+                        break;
+                    }
+                    continue;
+                }
+                if (!lease) {
+                    break;
+                }
+                chunk.leases_.push_back(lease);
+            }
+            lease_file.close();
+            chunk.addStatistics(lease_file);
+            if (!last) {
+                chunk.uncountEnd();
+            }
+
+        } catch (const std::exception& ex) {
+            chunk.failure_ = ex.what();
+        }
+    }
+
+    /// @brief Loads a lease file parsed by chunks.
+    ///
+    /// The chunks are parsed by rounds of a chunk per thread: the next
+    /// round is parsed while the leases of the previous round are merged
+    /// into the storage, in the order of the file. In addition to the
+    /// storage, the memory holds the leases of at most two rounds of
+    /// chunks, i.e. twice the number of threads times the chunk size.
+    ///
+    /// @param lease_file The lease file, open for reading. The reading
+    /// statistics of the chunks are added to its statistics.
+    /// @param storage The container to which leases should be inserted.
+    /// @param max_errors Maximum number of corrupted leases, 0 for no limit.
+    /// @param threads Number of threads.
+    /// @param chunk_size Size of the chunks.
+    /// @param lease_checker The lease sanity checker, if enabled.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4, @c CSVLeaseFile6,
+    /// @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded or a chunk can't be read.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    static void loadChunks(LeaseFileType& lease_file, StorageType& storage,
+                           const uint32_t max_errors, const size_t threads,
+                           const uint64_t chunk_size,
+                           const boost::scoped_ptr<SanityChecker>& lease_checker) {
+        typedef LeaseChunk<LeaseObjectType> ChunkType;
+
+        const std::string filename = lease_file.getFilename();
+        const uint64_t size = lease_file.getReadSize();
+        const uint64_t chunk_count = (size + chunk_size - 1) / chunk_size;
+        uint64_t next_chunk = 0;
+
+        std::vector<ChunkType> parsing;
+        std::vector<ChunkType> parsed;
+        std::vector<std::thread> workers;
+
+        // Starts the parsing of the next round of chunks.
+        auto start = [&]() {
+            const uint64_t count = std::min(static_cast<uint64_t>(threads),
+                                            chunk_count - next_chunk);
+            // The vector must not be reallocated while the threads run.
+            parsing.clear();
+            parsing.resize(count);
+            for (uint64_t i = 0; i < count; ++i) {
+                const uint64_t begin = (next_chunk + i) * chunk_size;
+                const uint64_t end = std::min(begin + chunk_size, size);
+                workers.push_back(std::thread(&readChunk<LeaseObjectType,
+                                                         LeaseFileType>,
+                                              filename, begin, end,
+                                              end == size, max_errors,
+                                              std::ref(parsing[i])));
+            }
+            next_chunk += count;
+        };
+
+        // Waits for the current round.
+        auto join = [&]() {
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            workers.clear();
+        };
+
+        // Track the number of corrupted leases and the reads of the
+        // previous chunks, to report the errors as a sequential load.
+        uint32_t errcnt = 0;
+        uint32_t reads = 0;
+
+        try {
+            start();
+            while (!workers.empty()) {
+                join();
+                parsed.swap(parsing);
+                if (next_chunk < chunk_count) {
+                    start();
+                }
+
+                for (auto& chunk : parsed) {
+                    if (!chunk.failure_.empty()) {
+                        isc_throw(util::CSVFileError, "failed to read a chunk of"
+                                  " the lease file " << filename << ": "
+                                  << chunk.failure_);
+                    }
+                    for (auto const& error : chunk.errors_) {
+                        readError(lease_file, reads + error.first,
+                                  error.second, max_errors, errcnt);
+                    }
+                    for (auto& lease : chunk.leases_) {
+                        if (checkLease(lease, lease_checker)) {
+                            updateStorage(storage, lease);
+                        }
+                    }
+                    reads += chunk.getReads();
+                    lease_file.addStatistics(chunk);
+                    // Release the leases of the chunk before the next one.
+                    chunk.leases_.clear();
+                    chunk.leases_.shrink_to_fit();
+                }
+                parsed.clear();
+            }
+
+        } catch (...) {
+            join();
+            throw;
+        }
+    }
+
+    /// @brief Reports a lease which can't be read.
+    ///
+    /// @param lease_file The lease file.
+    /// @param row The number of the read of the error.
+    /// @param msg The description of the error.
+    /// @param max_errors Maximum number of corrupted leases, 0 for no limit.
+    /// @param [in,out] errcnt The number of corrupted leases.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4, @c CSVLeaseFile6,
+    /// @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
+    ///
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded.
+    template<typename LeaseFileType>
+    static void readError(LeaseFileType& lease_file, const uint32_t row,
+                          const std::string& msg, const uint32_t max_errors,
+                          uint32_t& errcnt) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR)
+            .arg(row)
+            .arg(msg);
+
+        // A value of 0 indicates that we don't return
+        // until the whole file is parsed, even if errors occur.
+        // Otherwise, check if we have exceeded the maximum number
+        // of errors and throw an exception if we have.
+        if (max_errors && (++errcnt > max_errors)) {
+            // If we break parsing the CSV file because of too many
+            // errors, it doesn't make sense to keep the file open.
+            // This is because the caller wouldn't know where we
+            // stopped parsing and where the internal file pointer
+            // is. So, there are probably no cases when the caller
+            // would continue to use the open file.
+            lease_file.close();
+            isc_throw(util::CSVFileError, "exceeded maximum number of"
+                      " failures " << max_errors << " to read a lease"
+                      " from the lease file "
+                      << lease_file.getFilename());
+        }
+    }
+
+    /// @brief Checks a lease read from a lease file.
+    ///
+    /// @param [in,out] lease The lease, which may be fixed.
+    /// @param lease_checker The lease sanity checker, if enabled.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @return false if the lease must be discarded.
+    template<typename LeaseObjectType>
+    static bool checkLease(boost::shared_ptr<LeaseObjectType>& lease,
+                           const boost::scoped_ptr<SanityChecker>& lease_checker) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL_DATA,
+                  DHCPSRV_MEMFILE_LEASE_LOAD)
+            .arg(lease->toText());
+
+        if (lease_checker)  {
+            // If the lease is insane the checker will reset the lease pointer.
+            // As lease file is loaded during the configuration, we have
+            // to use staging config, rather than current config for this
+            // (false = staging).
+            lease_checker->checkLease(lease, false);
+        }
+        return (static_cast<bool>(lease));
+    }
+
+    /// @brief Applies a lease read from a lease file to the storage.
+    ///
+    /// @param storage The container.
+    /// @param lease The lease.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseObjectType, typename StorageType>
+    static void updateStorage(StorageType& storage,
+                              const boost::shared_ptr<LeaseObjectType>& lease) {
+        // Check if this lease exists. The position is also the hint of
+        // the insertion in the index by address.
+        typedef typename StorageType::value_type EntryType;
+        const typename EntryType::AddressKey key =
+            EntryType::addressKey(lease->addr_);
+        typename StorageType::iterator lease_it = storage.lower_bound(key);
+        // The lease doesn't exist yet. Insert the lease if
+        // it has a positive valid lifetime.
+        if ((lease_it == storage.end()) || (lease_it->addr_ != key)) {
+            if (lease->valid_lft_ > 0) {
+                storage.insert(lease_it, EntryType(*lease));
+            }
+        } else {
+            // The lease exists. If the new entry has a valid
+            // lifetime of 0 it is an indication to remove the
+            // existing entry. Otherwise, we update the lease.
+            if (lease->valid_lft_ == 0) {
+                storage.erase(lease_it);
+
+            } else {
+                // Use replace to re-index leases on update.
+                storage.replace(lease_it, EntryType(*lease));
+            }
+        }
+    }
 };
 
 }  // namespace dhcp
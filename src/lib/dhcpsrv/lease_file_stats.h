@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -68,6 +68,19 @@ public:
         write_errs_   = 0;
     }
 
+    /// @brief Adds the statistics of another file to the statistics.
+    ///
+    /// @param other The statistics to add, e.g. of a file loaded with
+    /// the others.
+    void addStatistics(const LeaseFileStats& other) {
+        reads_        += other.reads_;
+        read_leases_  += other.read_leases_;
+        read_errs_    += other.read_errs_;
+        writes_       += other.writes_;
+        write_leases_ += other.write_leases_;
+        write_errs_   += other.write_errs_;
+    }
+
 protected:
     /// @brief Number of attempts to read a lease
     uint32_t reads_;
@@ -0,0 +1,228 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/memfile_lease_entry.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/functional/hash.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+using namespace isc::asiolink;
+
+namespace {
+
+/// @brief Hash of the interned strings.
+struct StringPtrHash {
+    /// @brief Returns the hash of a string.
+    ///
+    /// @param value Pointer to the string.
+    size_t operator()(const std::string* value) const {
+        return (boost::hash_range(value->begin(), value->end()));
+    }
+};
+
+/// @brief Equality of the interned strings.
+struct StringPtrEqual {
+    /// @brief Compares two strings.
+    ///
+    /// @param first Pointer to the first string.
+    /// @param second Pointer to the second string.
+    bool operator()(const std::string* first,
+                    const std::string* second) const {
+        return (*first == *second);
+    }
+};
+
+/// @brief Pool of the interned strings.
+struct StringPool {
+    /// @brief Protects the pool.
+    std::mutex mutex_;
+
+    /// @brief The interned strings by value.
+    std::unordered_map<const std::string*, boost::weak_ptr<const std::string>,
+                       StringPtrHash, StringPtrEqual> strings_;
+};
+
+/// @brief Returns the pool.
+///
+/// The pool is never destroyed, so the interned strings held by static
+/// objects can be released at exit.
+StringPool&
+getPool() {
+    static StringPool* pool = new StringPool();
+    return (*pool);
+}
+
+/// @brief Deleter of the interned strings, which removes them from the pool.
+struct StringRelease {
+    /// @brief Removes a string from the pool and deletes it.
+    ///
+    /// @param value Pointer to the string.
+    void operator()(const std::string* value) const {
+        StringPool& pool = getPool();
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex_);
+            auto it = pool.strings_.find(value);
+            // The string may have been replaced by a new one with the
+            // same value since its last reference was released.
+            if ((it != pool.strings_.end()) && (it->first == value)) {
+                pool.strings_.erase(it);
+            }
+        }
+        delete value;
+    }
+};
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const std::string InternedString::EMPTY;
+
+InternedString::InternedString(const std::string& value) {
+    if (value.empty()) {
+        return;
+    }
+    StringPool& pool = getPool();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    auto it = pool.strings_.find(&value);
+    if (it != pool.strings_.end()) {
+        value_ = it->second.lock();
+        if (value_) {
+            return;
+        }
+        // The last reference is being released.
+        pool.strings_.erase(it);
+    }
+    value_.reset(new std::string(value), StringRelease());
+    pool.strings_[value_.get()] = value_;
+}
+
+size_t
+InternedString::getPoolSize() {
+    StringPool& pool = getPool();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    return (pool.strings_.size());
+}
+
+LeaseEntry::LeaseEntry(const Lease& lease)
+    : valid_lft_(lease.valid_lft_), cltt_(lease.cltt_),
+      subnet_id_(lease.subnet_id_), state_(lease.state_),
+      fqdn_fwd_(lease.fqdn_fwd_), fqdn_rev_(lease.fqdn_rev_),
+      has_hwaddr_(false), hwaddr_len_(0), htype_(0), hwaddr_source_(0),
+      hostname_(lease.hostname_), user_context_(lease.getContext()) {
+    if (lease.hwaddr_) {
+        const std::vector<uint8_t>& hwaddr = lease.hwaddr_->hwaddr_;
+        if (hwaddr.size() > HWAddr::MAX_HWADDR_LEN) {
+            isc_throw(BadValue, "hardware address of the lease for "
+                      << lease.addr_ << " is too long ("
+                      << hwaddr.size() << " bytes)");
+        }
+        has_hwaddr_ = true;
+        hwaddr_len_ = static_cast<uint8_t>(hwaddr.size());
+        htype_ = lease.hwaddr_->htype_;
+        hwaddr_source_ = lease.hwaddr_->source_;
+        std::copy(hwaddr.begin(), hwaddr.end(), hwaddr_);
+    }
+}
+
+void
+LeaseEntry::toLease(Lease& lease) const {
+    lease.valid_lft_ = valid_lft_;
+    lease.old_valid_lft_ = valid_lft_;
+    lease.cltt_ = cltt_;
+    lease.old_cltt_ = cltt_;
+    lease.subnet_id_ = subnet_id_;
+    lease.hostname_ = hostname_.get();
+    lease.fqdn_fwd_ = fqdn_fwd_;
+    lease.fqdn_rev_ = fqdn_rev_;
+    if (has_hwaddr_) {
+        lease.hwaddr_.reset(new HWAddr(hwaddr_, hwaddr_len_, htype_));
+        lease.hwaddr_->source_ = hwaddr_source_;
+    }
+    lease.state_ = state_;
+    if (user_context_) {
+        lease.setContext(user_context_);
+    }
+}
+
+const size_t Lease4Entry::CLIENT_ID_INLINE_LEN;
+
+Lease4Entry::Lease4Entry(const Lease4& lease)
+    : LeaseEntry(lease), addr_(lease.addr_.toUint32()) {
+    if (lease.client_id_) {
+        const std::vector<uint8_t>& client_id = lease.client_id_->getClientId();
+        client_id_ = CompactBytes<CLIENT_ID_INLINE_LEN>(&client_id[0],
+                                                         client_id.size());
+    }
+}
+
+Lease4Ptr
+Lease4Entry::toLease() const {
+    Lease4Ptr lease(new Lease4());
+    lease->addr_ = getAddress();
+    LeaseEntry::toLease(*lease);
+    if (!client_id_.empty()) {
+        lease->client_id_.reset(new ClientId(client_id_.data(),
+                                             client_id_.size()));
+    }
+    return (lease);
+}
+
+const size_t Lease6Entry::DUID_INLINE_LEN;
+
+Lease6Entry::Lease6Entry(const Lease6& lease)
+    : LeaseEntry(lease), addr_(addressKey(lease.addr_)), type_(lease.type_),
+      prefixlen_(lease.prefixlen_), iaid_(lease.iaid_),
+      preferred_lft_(lease.preferred_lft_) {
+    if (lease.duid_) {
+        const std::vector<uint8_t>& duid = lease.duid_->getDuid();
+        duid_ = CompactBytes<DUID_INLINE_LEN>(&duid[0], duid.size());
+    }
+}
+
+IOAddress
+Lease6Entry::getAddress() const {
+    // Not using IOAddress::fromBytes which converts to and from text.
+    boost::asio::ip::address_v6::bytes_type bytes;
+    std::copy(addr_.begin(), addr_.end(), bytes.begin());
+    return (IOAddress(boost::asio::ip::address_v6(bytes)));
+}
+
+Lease6Ptr
+Lease6Entry::toLease() const {
+    Lease6Ptr lease(new Lease6());
+    lease->addr_ = getAddress();
+    LeaseEntry::toLease(*lease);
+    lease->type_ = type_;
+    lease->prefixlen_ = prefixlen_;
+    lease->iaid_ = iaid_;
+    if (!duid_.empty()) {
+        lease->duid_.reset(new DUID(duid_.data(), duid_.size()));
+    }
+    lease->preferred_lft_ = preferred_lft_;
+    return (lease);
+}
+
+Lease6Entry::AddressKey
+Lease6Entry::addressKey(const IOAddress& address) {
+    if (!address.isV6()) {
+        isc_throw(BadValue, "address " << address << " is not an IPv6 address");
+    }
+    AddressKey key;
+    address.toBytes(key.data());
+    return (key);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,471 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MEMFILE_LEASE_ENTRY_H
+#define MEMFILE_LEASE_ENTRY_H
+
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/subnet_id.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <array>
+#include <cstring>
+#include <stdint.h>
+#include <string>
+#include <time.h>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Reference to a byte string held by a lease entry.
+///
+/// This is the type of the keys by identifier (HW address, client
+/// identifier, DUID) of the lease storage. It can be built from a vector
+/// so the lookups by identifier do not copy the searched identifier.
+/// The order is the order of the vectors holding the same bytes.
+class BytesRef {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param data Pointer to the bytes.
+    /// @param size Number of bytes.
+    BytesRef(const uint8_t* data, size_t size)
+        : data_(data), size_(size) {
+    }
+
+    /// @brief Constructor from a vector.
+    ///
+    /// This constructor is not explicit so vectors can be used as search
+    /// keys of the indexes by identifier.
+    ///
+    /// @param bytes The referenced vector.
+    BytesRef(const std::vector<uint8_t>& bytes)
+        : data_(bytes.empty() ? 0 : &bytes[0]), size_(bytes.size()) {
+    }
+
+    /// @brief Returns a pointer to the bytes.
+    const uint8_t* data() const {
+        return (data_);
+    }
+
+    /// @brief Returns the number of bytes.
+    size_t size() const {
+        return (size_);
+    }
+
+    /// @brief Returns a copy of the bytes.
+    std::vector<uint8_t> toVector() const {
+        return (std::vector<uint8_t>(data_, data_ + size_));
+    }
+
+    /// @brief Lexicographical order of the byte strings.
+    ///
+    /// @param other The other reference.
+    bool operator<(const BytesRef& other) const {
+        int cmp = compare(other);
+        return ((cmp < 0) || ((cmp == 0) && (size_ < other.size_)));
+    }
+
+    /// @brief Equality of the byte strings.
+    ///
+    /// @param other The other reference.
+    bool operator==(const BytesRef& other) const {
+        return ((size_ == other.size_) && (compare(other) == 0));
+    }
+
+private:
+
+    /// @brief Compares the common prefix of the byte strings.
+    ///
+    /// @param other The other reference.
+    /// @return The result of memcmp.
+    int compare(const BytesRef& other) const {
+        size_t size = (size_ < other.size_ ? size_ : other.size_);
+        return (size == 0 ? 0 : std::memcmp(data_, other.data_, size));
+    }
+
+    /// @brief Pointer to the bytes.
+    const uint8_t* data_;
+
+    /// @brief Number of bytes.
+    size_t size_;
+};
+
+/// @brief Byte string stored inline when it is short.
+///
+/// The identifiers of the clients (client identifiers and DUIDs) are
+/// usually short, so they are held in the lease entry rather than in a
+/// vector allocated separately. Longer strings are allocated.
+///
+/// @tparam N Number of bytes stored inline.
+template<size_t N>
+class CompactBytes {
+public:
+
+    /// @brief Constructor of an empty string.
+    CompactBytes() : size_(0) {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// @param data Pointer to the bytes.
+    /// @param size Number of bytes.
+    CompactBytes(const uint8_t* data, size_t size) : size_(0) {
+        assign(data, size);
+    }
+
+    /// @brief Copy constructor.
+    ///
+    /// @param other The copied string.
+    CompactBytes(const CompactBytes& other) : size_(0) {
+        assign(other.data(), other.size_);
+    }
+
+    /// @brief Move constructor.
+    ///
+    /// @param other The moved string, left empty.
+    CompactBytes(CompactBytes&& other) : size_(0) {
+        steal(other);
+    }
+
+    /// @brief Destructor.
+    ~CompactBytes() {
+        clear();
+    }
+
+    /// @brief Copy assignment.
+    ///
+    /// @param other The copied string.
+    CompactBytes& operator=(const CompactBytes& other) {
+        if (this != &other) {
+            assign(other.data(), other.size_);
+        }
+        return (*this);
+    }
+
+    /// @brief Move assignment.
+    ///
+    /// @param other The moved string, left empty.
+    CompactBytes& operator=(CompactBytes&& other) {
+        if (this != &other) {
+            clear();
+            steal(other);
+        }
+        return (*this);
+    }
+
+    /// @brief Returns a pointer to the bytes.
+    const uint8_t* data() const {
+        return (size_ > N ? heap_ : inline_);
+    }
+
+    /// @brief Returns the number of bytes.
+    size_t size() const {
+        return (size_);
+    }
+
+    /// @brief Checks if the string is empty.
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+    /// @brief Returns a reference to the bytes.
+    BytesRef ref() const {
+        return (BytesRef(data(), size_));
+    }
+
+private:
+
+    /// @brief Replaces the bytes.
+    ///
+    /// @param data Pointer to the bytes.
+    /// @param size Number of bytes.
+    void assign(const uint8_t* data, size_t size) {
+        uint8_t* heap = 0;
+        if (size > N) {
+            heap = new uint8_t[size];
+            std::memcpy(heap, data, size);
+        }
+        clear();
+        if (heap) {
+            heap_ = heap;
+        } else if (size > 0) {
+            std::memcpy(inline_, data, size);
+        }
+        size_ = static_cast<uint32_t>(size);
+    }
+
+    /// @brief Takes the bytes of another string.
+    ///
+    /// @param other The other string, left empty.
+    void steal(CompactBytes& other) {
+        if (other.size_ > N) {
+            heap_ = other.heap_;
+        } else if (other.size_ > 0) {
+            std::memcpy(inline_, other.inline_, other.size_);
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    /// @brief Frees the allocated bytes and empties the string.
+    void clear() {
+        if (size_ > N) {
+            delete[] heap_;
+        }
+        size_ = 0;
+    }
+
+    /// @brief The bytes, inline or allocated.
+    union {
+        uint8_t inline_[N];
+        uint8_t* heap_;
+    };
+
+    /// @brief Number of bytes.
+    uint32_t size_;
+};
+
+/// @brief String shared by all the lease entries holding the same value.
+///
+/// The hostnames are interned in a global pool: the entries with the same
+/// hostname share one string, which is freed with its last entry. The
+/// empty hostname, the most common one, is not allocated.
+class InternedString {
+public:
+
+    /// @brief Constructor of an empty string.
+    InternedString() {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// @param value The value of the string, shared with the other
+    /// interned strings holding the same value.
+    explicit InternedString(const std::string& value);
+
+    /// @brief Returns the value of the string.
+    const std::string& get() const {
+        return (value_ ? *value_ : EMPTY);
+    }
+
+    /// @brief Returns the number of distinct values in the pool.
+    static size_t getPoolSize();
+
+private:
+
+    /// @brief The empty string.
+    static const std::string EMPTY;
+
+    /// @brief The shared value or null when it is empty.
+    boost::shared_ptr<const std::string> value_;
+};
+
+/// @brief Common part of the compact lease entries.
+///
+/// The memfile backend holds millions of leases, so the storage does not
+/// hold @c Lease objects, which spread each lease over several allocations
+/// (address, HW address, client identifier, hostname), but compact entries
+/// holding the fixed size fields inline. @c Lease objects are materialized
+/// from the entries only when they are returned by the lease manager.
+///
+/// The fields have the names of the matching @c Lease fields. The "old"
+/// values of the materialized leases are the current ones, as the leases
+/// returned by the SQL backends.
+struct LeaseEntry {
+
+    /// @brief Valid lifetime.
+    uint32_t valid_lft_;
+
+    /// @brief Client last transmission time.
+    time_t cltt_;
+
+    /// @brief Subnet identifier.
+    SubnetID subnet_id_;
+
+    /// @brief Lease state(s).
+    uint32_t state_;
+
+    /// @brief Forward zone updated?
+    bool fqdn_fwd_;
+
+    /// @brief Reverse zone updated?
+    bool fqdn_rev_;
+
+    /// @brief Is there a hardware address?
+    bool has_hwaddr_;
+
+    /// @brief Length of the hardware address.
+    uint8_t hwaddr_len_;
+
+    /// @brief Hardware type of the hardware address.
+    uint16_t htype_;
+
+    /// @brief Source of the hardware address.
+    uint32_t hwaddr_source_;
+
+    /// @brief Hardware address.
+    uint8_t hwaddr_[HWAddr::MAX_HWADDR_LEN];
+
+    /// @brief Client hostname.
+    InternedString hostname_;
+
+    /// @brief User context.
+    data::ConstElementPtr user_context_;
+
+    /// @brief Indicates if the lease is in the "expired-reclaimed" state.
+    bool stateExpiredReclaimed() const {
+        return (state_ == Lease::STATE_EXPIRED_RECLAIMED);
+    }
+
+    /// @brief Returns lease expiration time.
+    int64_t getExpirationTime() const {
+        return (static_cast<int64_t>(cltt_) + valid_lft_);
+    }
+
+    /// @brief Returns the hardware address.
+    ///
+    /// The key extractor of the indexes by HW address. It is empty when
+    /// there is no hardware address.
+    BytesRef getHWAddrKey() const {
+        return (BytesRef(hwaddr_, hwaddr_len_));
+    }
+
+    /// @brief Returns the hostname.
+    ///
+    /// The key extractor of the indexes by hostname.
+    const std::string& getHostname() const {
+        return (hostname_.get());
+    }
+
+protected:
+
+    /// @brief Constructor.
+    ///
+    /// @param lease The lease of which the common fields are copied.
+    /// @throw BadValue if the hardware address is too long.
+    explicit LeaseEntry(const Lease& lease);
+
+    /// @brief Sets the common fields of a lease.
+    ///
+    /// @param [out] lease The lease.
+    void toLease(Lease& lease) const;
+};
+
+/// @brief Compact entry of the DHCPv4 lease storage.
+struct Lease4Entry : public LeaseEntry {
+
+    /// @brief The materialized lease type.
+    typedef Lease4 LeaseType;
+
+    /// @brief Number of bytes of the client identifier stored inline.
+    static const size_t CLIENT_ID_INLINE_LEN = 24;
+
+    /// @brief Type of the address keys.
+    typedef uint32_t AddressKey;
+
+    /// @brief IPv4 address.
+    AddressKey addr_;
+
+    /// @brief Client identifier, empty when there is none.
+    CompactBytes<CLIENT_ID_INLINE_LEN> client_id_;
+
+    /// @brief Constructor.
+    ///
+    /// @param lease The stored lease.
+    explicit Lease4Entry(const Lease4& lease);
+
+    /// @brief Returns the address.
+    asiolink::IOAddress getAddress() const {
+        return (asiolink::IOAddress(addr_));
+    }
+
+    /// @brief Returns the client identifier.
+    ///
+    /// The key extractor of the indexes by client identifier.
+    BytesRef getClientIdKey() const {
+        return (client_id_.ref());
+    }
+
+    /// @brief Materializes the lease.
+    ///
+    /// @return A new lease object.
+    Lease4Ptr toLease() const;
+
+    /// @brief Returns the key of an address in the index by address.
+    ///
+    /// @param address The IPv4 address.
+    static AddressKey addressKey(const asiolink::IOAddress& address) {
+        return (address.toUint32());
+    }
+};
+
+/// @brief Compact entry of the DHCPv6 lease storage.
+struct Lease6Entry : public LeaseEntry {
+
+    /// @brief The materialized lease type.
+    typedef Lease6 LeaseType;
+
+    /// @brief Number of bytes of the DUID stored inline.
+    static const size_t DUID_INLINE_LEN = 24;
+
+    /// @brief Type of the address keys, the address in network order.
+    typedef std::array<uint8_t, 16> AddressKey;
+
+    /// @brief IPv6 address or prefix.
+    AddressKey addr_;
+
+    /// @brief Lease type.
+    Lease::Type type_;
+
+    /// @brief IPv6 prefix length.
+    uint8_t prefixlen_;
+
+    /// @brief Identity Association Identifier (IAID).
+    uint32_t iaid_;
+
+    /// @brief Preferred lifetime.
+    uint32_t preferred_lft_;
+
+    /// @brief Client identifier, empty when there is none.
+    CompactBytes<DUID_INLINE_LEN> duid_;
+
+    /// @brief Constructor.
+    ///
+    /// @param lease The stored lease.
+    explicit Lease6Entry(const Lease6& lease);
+
+    /// @brief Returns the address.
+    asiolink::IOAddress getAddress() const;
+
+    /// @brief Returns the DUID.
+    ///
+    /// The key extractor of the indexes by DUID.
+    BytesRef getDuidKey() const {
+        return (duid_.ref());
+    }
+
+    /// @brief Materializes the lease.
+    ///
+    /// @return A new lease object.
+    Lease6Ptr toLease() const;
+
+    /// @brief Returns the key of an address in the index by address.
+    ///
+    /// @param address The IPv6 address.
+    static AddressKey addressKey(const asiolink::IOAddress& address);
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // MEMFILE_LEASE_ENTRY_H
@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <database/database_connection.h>
+#include <dhcpsrv/binary_lease_file.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/dhcpsrv_log.h>
@@ -17,12 +18,20 @@
 #include <util/pid_file.h>
 #include <util/process_spawn.h>
 #include <util/signal_set.h>
+#include <boost/function.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <errno.h>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -54,6 +63,11 @@ namespace dhcp {
 /// and maintaining the object which is used to spawn the new process which
 /// executes the @c kea-lfc program.
 ///
+/// In the in-process mode the cleanup is not performed by the @c kea-lfc
+/// program but by a function of the @c Memfile_LeaseMgr executed in a
+/// thread created by this class, which also paces the writes of this
+/// function.
+///
 /// This functionality is enclosed in a separate class so as the implementation
 /// details are not exposed in the @c Memfile_LeaseMgr header file and
 /// to maintain a single place with the LFC configuration, instead of multiple
@@ -61,6 +75,12 @@ namespace dhcp {
 class LFCSetup {
 public:
 
+    /// @brief Type of the function performing the in-process cleanup.
+    ///
+    /// The function is given this object to pace its writes, and throws
+    /// an exception when the cleanup fails.
+    typedef boost::function<void(LFCSetup&)> InProcessCallback;
+
     /// @brief Constructor.
     ///
     /// Assigns a pointer to the function triggered to perform the cleanup.
@@ -72,9 +92,34 @@ public:
 
     /// @brief Destructor.
     ///
-    /// Unregisters LFC timer.
+    /// Stops the in-process cleanup and unregisters LFC timer.
     ~LFCSetup();
 
+    /// @brief Performs the cleanup in-process instead of spawning kea-lfc.
+    ///
+    /// Must be called before @c setup.
+    ///
+    /// @param in_process The function performing the cleanup.
+    /// @param write_rate The maximum number of leases written per second
+    /// by the cleanup, 0 for no limit.
+    void setInProcess(const InProcessCallback& in_process,
+                      const uint32_t write_rate);
+
+    /// @brief Checks if the cleanup is performed in-process.
+    bool isInProcess() const {
+        return (!in_process_.empty());
+    }
+
+    /// @brief Paces the writes of the in-process cleanup.
+    ///
+    /// Called by the in-process cleanup after it wrote leases. It waits
+    /// until the write rate of the cleanup is below its limit.
+    ///
+    /// @param count The number of leases written since the last call.
+    /// @return false when the cleanup must stop because this object is
+    /// being destroyed, true otherwise.
+    bool pace(const size_t count);
+
     /// @brief Sets the new configuration for the %Lease File Cleanup.
     ///
     /// @param lfc_interval An interval in seconds at which the cleanup should
@@ -86,12 +131,18 @@ public:
     /// @param run_once_now A flag that causes LFC to be invoked immediately,
     /// regardless of the value of lfc_interval.  This is primarily used to
     /// cause lease file schema upgrades upon startup.
+    /// @param binary_output A flag that causes LFC to write the cleaned up
+    /// leases in the binary format.
     void setup(const uint32_t lfc_interval,
                const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
                const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-               bool run_once_now = false);
+               bool run_once_now = false,
+               bool binary_output = false);
 
     /// @brief Spawns a new process.
+    ///
+    /// In the in-process mode it starts the thread performing the cleanup
+    /// instead, unless the previous cleanup is still in progress.
     void execute();
 
     /// @brief Checks if the lease file cleanup is in progress.
@@ -104,10 +155,55 @@ public:
 
 private:
 
+    /// @brief Creates the object used to spawn the kea-lfc process.
+    ///
+    /// @param lease_file4 A pointer to the DHCPv4 lease file or NULL.
+    /// @param lease_file6 A pointer to the DHCPv6 lease file or NULL.
+    /// @param binary_output A flag that causes LFC to write the cleaned up
+    /// leases in the binary format.
+    void createProcess(const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
+                       const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
+                       bool binary_output);
+
+    /// @brief Body of the thread performing the in-process cleanup.
+    void run();
+
     /// @brief A pointer to the @c ProcessSpawn object used to execute
     /// the LFC.
     boost::scoped_ptr<util::ProcessSpawn> process_;
 
+    /// @brief The function performing the in-process cleanup, empty when
+    /// the cleanup is performed by kea-lfc.
+    InProcessCallback in_process_;
+
+    /// @brief The maximum number of leases written per second by the
+    /// in-process cleanup, 0 for no limit.
+    uint32_t write_rate_;
+
+    /// @brief The thread performing the in-process cleanup.
+    std::thread thread_;
+
+    /// @brief Indicates if the in-process cleanup is in progress.
+    std::atomic<bool> running_;
+
+    /// @brief Exit code of the last in-process cleanup.
+    std::atomic<int> exit_status_;
+
+    /// @brief Mutex protecting the stop flag.
+    std::mutex mutex_;
+
+    /// @brief Condition variable interrupting the pauses of the cleanup.
+    std::condition_variable stop_cv_;
+
+    /// @brief Indicates if the in-process cleanup must stop.
+    bool stop_;
+
+    /// @brief Time at which the in-process cleanup started.
+    std::chrono::steady_clock::time_point start_time_;
+
+    /// @brief Number of leases written by the in-process cleanup.
+    uint64_t written_;
+
     /// @brief A pointer to the callback function executed by the timer.
     asiolink::IntervalTimer::Callback callback_;
 
@@ -122,11 +218,22 @@ private:
 };
 
 LFCSetup::LFCSetup(asiolink::IntervalTimer::Callback callback)
-    : process_(), callback_(callback), pid_(0),
-      timer_mgr_(TimerMgr::instance()) {
+    : process_(), in_process_(), write_rate_(0), running_(false),
+      exit_status_(0), stop_(false), written_(0), callback_(callback),
+      pid_(0), timer_mgr_(TimerMgr::instance()) {
 }
 
 LFCSetup::~LFCSetup() {
+    // Interrupt the in-process cleanup: it removes its partial output.
+    if (thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        stop_cv_.notify_all();
+        thread_.join();
+    }
+
     try {
         // Remove the timer. This will throw an exception if the timer does not
         // exist.  There are several possible reasons for this:
@@ -149,17 +256,53 @@ LFCSetup::~LFCSetup() {
     }
 }
 
+void
+LFCSetup::setInProcess(const InProcessCallback& in_process,
+                       const uint32_t write_rate) {
+    in_process_ = in_process;
+    write_rate_ = write_rate;
+}
+
 void
 LFCSetup::setup(const uint32_t lfc_interval,
                 const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
                 const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-                bool run_once_now) {
+                bool run_once_now,
+                bool binary_output) {
 
     // If to nothing to do, punt
     if (lfc_interval == 0 && !run_once_now) {
         return;
     }
 
+    // The in-process cleanup doesn't spawn kea-lfc.
+    if (!isInProcess()) {
+        createProcess(lease_file4, lease_file6, binary_output);
+    }
+
+    // If we've been told to run it once now, invoke the callback directly.
+    if (run_once_now) {
+        callback_();
+    }
+
+    // If it's supposed to run periodically, setup that now.
+    if (lfc_interval > 0) {
+        // Set the timer to call callback function periodically.
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_SETUP).arg(lfc_interval);
+
+        // Multiple the lfc_interval value by 1000 as this value specifies
+        // a timeout in seconds, whereas the setup() method expects the
+        // timeout in milliseconds.
+        timer_mgr_->registerTimer("memfile-lfc", callback_, lfc_interval * 1000,
+                                  asiolink::IntervalTimer::REPEATING);
+        timer_mgr_->setup("memfile-lfc");
+    }
+}
+
+void
+LFCSetup::createProcess(const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
+                        const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
+                        bool binary_output) {
     // Start preparing the command line for kea-lfc.
     std::string executable;
     char* c_executable = getenv(KEA_LFC_EXECUTABLE_ENV_NAME);
@@ -178,6 +321,11 @@ LFCSetup::setup(const uint32_t lfc_interval,
     // Universe: v4 or v6.
     args.push_back(lease_file4 ? "-4" : "-6");
 
+    // Format of the output file.
+    if (binary_output) {
+        args.push_back("-b");
+    }
+
     // Previous file.
     args.push_back("-x");
     args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
@@ -205,28 +353,28 @@ LFCSetup::setup(const uint32_t lfc_interval,
 
     // Create the process (do not start it yet).
     process_.reset(new util::ProcessSpawn(executable, args));
-
-    // If we've been told to run it once now, invoke the callback directly.
-    if (run_once_now) {
-        callback_();
-    }
-
-    // If it's supposed to run periodically, setup that now.
-    if (lfc_interval > 0) {
-        // Set the timer to call callback function periodically.
-        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_SETUP).arg(lfc_interval);
-
-        // Multiple the lfc_interval value by 1000 as this value specifies
-        // a timeout in seconds, whereas the setup() method expects the
-        // timeout in milliseconds.
-        timer_mgr_->registerTimer("memfile-lfc", callback_, lfc_interval * 1000,
-                                  asiolink::IntervalTimer::REPEATING);
-        timer_mgr_->setup("memfile-lfc");
-    }
 }
 
 void
 LFCSetup::execute() {
+    if (isInProcess()) {
+        if (running_) {
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_RUNNING);
+            return;
+        }
+        // Reap the thread of the previous cleanup.
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_EXECUTE)
+            .arg(write_rate_);
+        start_time_ = std::chrono::steady_clock::now();
+        written_ = 0;
+        running_ = true;
+        thread_ = std::thread(&LFCSetup::run, this);
+        return;
+    }
+
     try {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_EXECUTE)
             .arg(process_->getCommandLine());
@@ -237,13 +385,47 @@ LFCSetup::execute() {
     }
 }
 
+void
+LFCSetup::run() {
+    try {
+        in_process_(*this);
+        exit_status_ = EXIT_SUCCESS;
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAIL)
+            .arg(ex.what());
+        exit_status_ = EXIT_FAILURE;
+    }
+    running_ = false;
+}
+
+bool
+LFCSetup::pace(const size_t count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    written_ += count;
+    if ((write_rate_ > 0) && !stop_) {
+        // Wait until the leases written so far match the rate.
+        const std::chrono::steady_clock::time_point next =
+            start_time_ + std::chrono::microseconds(written_ * 1000000 /
+                                                    write_rate_);
+        stop_cv_.wait_until(lock, next, [this]() { return (stop_); });
+    }
+    return (!stop_);
+}
+
 bool
 LFCSetup::isRunning() const {
+    if (isInProcess()) {
+        return (running_);
+    }
     return (process_ && process_->isRunning(pid_));
 }
 
 int
 LFCSetup::getExitStatus() const {
+    if (isInProcess()) {
+        return (exit_status_);
+    }
     if (!process_) {
         isc_throw(InvalidOperation, "unable to obtain LFC process exit code: "
                   " the process is NULL");
@@ -408,7 +590,7 @@ public:
              lease != upper; ++lease) {
             // If we've hit the next subnet, add rows for the current subnet
             // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
+            if (lease->subnet_id_ != cur_id) {
                 if (cur_id > 0) {
                     if (assigned > 0) {
                         rows_.push_back(LeaseStatsRow(cur_id,
@@ -426,13 +608,13 @@ public:
                 }
 
                 // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
+                cur_id = lease->subnet_id_;
             }
 
             // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
+            if (lease->state_ == Lease::STATE_DEFAULT) {
                 ++assigned;
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
+            } else if (lease->state_ == Lease::STATE_DECLINED) {
                 ++declined;
             }
         }
@@ -551,7 +733,7 @@ public:
              lease != upper; ++lease) {
             // If we've hit the next subnet, add rows for the current subnet
             // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
+            if (lease->subnet_id_ != cur_id) {
                 if (cur_id > 0) {
                     if (assigned > 0) {
                         rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
@@ -576,12 +758,12 @@ public:
                 }
 
                 // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
+                cur_id = lease->subnet_id_;
             }
 
             // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                switch((*lease)->type_) {
+            if (lease->state_ == Lease::STATE_DEFAULT) {
+                switch(lease->type_) {
                 case Lease::TYPE_NA:
                     ++assigned;
                     break;
@@ -591,9 +773,9 @@ public:
                 default:
                     break;
                 }
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
+            } else if (lease->state_ == Lease::STATE_DECLINED) {
                 // In theory only NAs can be declined
-                if (((*lease)->type_) == Lease::TYPE_NA) {
+                if ((lease->type_) == Lease::TYPE_NA) {
                     ++declined;
                 }
             }
@@ -628,11 +810,15 @@ private:
 // declaration so they're not needed here.
 const int Memfile_LeaseMgr::MAJOR_VERSION;
 const int Memfile_LeaseMgr::MINOR_VERSION;
+const size_t Memfile_LeaseMgr::LFC_BATCH_SIZE;
 
 Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& parameters)
     : LeaseMgr(), lfc_setup_(), conn_(parameters), mutex_() {
     bool conversion_needed = false;
 
+    // The mutex is used by the in-process lease file cleanup.
+    mutex_.reset(new ReadWriteMutex());
+
     // Check the universe and use v4 file or v6 file.
     std::string universe = conn_.getParameter("universe");
     if (universe == "4") {
@@ -664,13 +850,15 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
             LOG_WARN(dhcpsrv_logger, DHCPSRV_MEMFILE_CONVERTING_LEASE_FILES)
                     .arg(MAJOR_VERSION).arg(MINOR_VERSION);
         }
+        journalSetup();
         lfcSetup(conversion_needed);
     }
-
-    mutex_.reset(new std::mutex);
 }
 
 Memfile_LeaseMgr::~Memfile_LeaseMgr() {
+    // Stop the in-process lease file cleanup before the storage and the
+    // mutex it uses are destroyed.
+    lfc_setup_.reset();
     if (lease_file4_) {
         lease_file4_->close();
         lease_file4_.reset();
@@ -691,7 +879,8 @@ Memfile_LeaseMgr::getDBVersion() {
 
 bool
 Memfile_LeaseMgr::addLeaseInternal(const Lease4Ptr& lease) {
-    if (getLease4Internal(lease->addr_)) {
+    // Check the existence in the storage without materializing the lease.
+    if (storage4_.find(Lease4Entry::addressKey(lease->addr_)) != storage4_.end()) {
         // there is a lease with specified address already
         return (false);
     }
@@ -703,7 +892,13 @@ Memfile_LeaseMgr::addLeaseInternal(const Lease4Ptr& lease) {
         lease_file4_->append(*lease);
     }
 
-    storage4_.insert(lease);
+    storage4_.insert(Lease4Entry(*lease));
+
+    // The entries do not keep the previous lifetime: the returned leases
+    // have the current one.
+    lease->old_cltt_ = lease->cltt_;
+    lease->old_valid_lft_ = lease->valid_lft_;
+
     return (true);
 }
 
@@ -712,17 +907,34 @@ Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_ADD_ADDR4).arg(lease->addr_.toText());
 
-    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
-        return (addLeaseInternal(lease));
+    bool added;
+    uint64_t sequence;
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        added = addLeaseInternal(lease);
+        sequence = getJournalSequence(V4);
     } else {
-        return (addLeaseInternal(lease));
+        added = addLeaseInternal(lease);
+        sequence = getJournalSequence(V4);
     }
+    // Wait for the lease file outside of the lock.
+    try {
+        waitForJournal(V4, sequence);
+    } catch (const FileJournalError&) {
+        // The lease was not written: remove it from the memory.
+        if (added) {
+            rollbackLease(lease, Lease4Ptr());
+        }
+        throw;
+    }
+    return (added);
 }
 
 bool
 Memfile_LeaseMgr::addLeaseInternal(const Lease6Ptr& lease) {
-    if (getLease6Internal(lease->type_, lease->addr_)) {
+    // Check the existence in the storage without materializing the lease.
+    Lease6Storage::iterator l = storage6_.find(Lease6Entry::addressKey(lease->addr_));
+    if ((l != storage6_.end()) && (l->type_ == lease->type_)) {
         // there is a lease with specified address already
         return (false);
     }
@@ -734,7 +946,13 @@ Memfile_LeaseMgr::addLeaseInternal(const Lease6Ptr& lease) {
         lease_file6_->append(*lease);
     }
 
-    storage6_.insert(lease);
+    storage6_.insert(Lease6Entry(*lease));
+
+    // The entries do not keep the previous lifetime: the returned leases
+    // have the current one.
+    lease->old_cltt_ = lease->cltt_;
+    lease->old_valid_lft_ = lease->valid_lft_;
+
     return (true);
 }
 
@@ -743,22 +961,37 @@ Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_ADD_ADDR6).arg(lease->addr_.toText());
 
-    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
-        return (addLeaseInternal(lease));
+    bool added;
+    uint64_t sequence;
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        added = addLeaseInternal(lease);
+        sequence = getJournalSequence(V6);
     } else {
-        return (addLeaseInternal(lease));
+        added = addLeaseInternal(lease);
+        sequence = getJournalSequence(V6);
+    }
+    // Wait for the lease file outside of the lock.
+    try {
+        waitForJournal(V6, sequence);
+    } catch (const FileJournalError&) {
+        // The lease was not written: remove it from the memory.
+        if (added) {
+            rollbackLease(lease, Lease6Ptr());
+        }
+        throw;
     }
+    return (added);
 }
 
 Lease4Ptr
 Memfile_LeaseMgr::getLease4Internal(const isc::asiolink::IOAddress& addr) const {
     const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
-    Lease4StorageAddressIndex::iterator l = idx.find(addr);
+    Lease4StorageAddressIndex::iterator l = idx.find(Lease4Entry::addressKey(addr));
     if (l == idx.end()) {
         return (Lease4Ptr());
     } else {
-        return (Lease4Ptr(new Lease4(**l)));
+        return (l->toLease());
     }
 }
 
@@ -768,7 +1001,7 @@ Memfile_LeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
               DHCPSRV_MEMFILE_GET_ADDR4).arg(addr.toText());
 
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         return (getLease4Internal(addr));
     } else {
         return (getLease4Internal(addr));
@@ -787,7 +1020,7 @@ Memfile_LeaseMgr::getLease4Internal(const HWAddr& hwaddr,
         = idx.equal_range(boost::make_tuple(hwaddr.hwaddr_));
 
     for (auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -798,7 +1031,7 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr) const {
 
     Lease4Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLease4Internal(hwaddr, collection);
     } else {
         getLease4Internal(hwaddr, collection);
@@ -822,7 +1055,7 @@ Memfile_LeaseMgr::getLease4Internal(const HWAddr& hwaddr,
     }
 
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (lease->toLease());
 }
 
 Lease4Ptr
@@ -833,7 +1066,7 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr,
         .arg(hwaddr.toText());
 
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         return (getLease4Internal(hwaddr, subnet_id));
     } else {
         return (getLease4Internal(hwaddr, subnet_id));
@@ -852,7 +1085,7 @@ Memfile_LeaseMgr::getLease4Internal(const ClientId& client_id,
         = idx.equal_range(boost::make_tuple(client_id.getClientId()));
 
     for (auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -863,7 +1096,7 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id) const {
 
     Lease4Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLease4Internal(client_id, collection);
     } else {
         getLease4Internal(client_id, collection);
@@ -890,7 +1123,7 @@ Memfile_LeaseMgr::getLease4Internal(const ClientId& client_id,
     }
 
     // Lease was found. Return it to the caller.
-    return (*lease);
+    return (lease->toLease());
 }
 
 Lease4Ptr
@@ -903,7 +1136,7 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
                                                         .arg(subnet_id);
 
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         return (getLease4Internal(client_id, hwaddr, subnet_id));
     } else {
         return (getLease4Internal(client_id, hwaddr, subnet_id));
@@ -924,7 +1157,7 @@ Memfile_LeaseMgr::getLease4Internal(const ClientId& client_id,
         return (Lease4Ptr());
     }
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (lease->toLease());
 }
 
 Lease4Ptr
@@ -935,7 +1168,7 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
               .arg(client_id.toText());
 
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         return (getLease4Internal(client_id, subnet_id));
     } else {
         return (getLease4Internal(client_id, subnet_id));
@@ -951,7 +1184,7 @@ Memfile_LeaseMgr::getLeases4Internal(SubnetID subnet_id,
         idx.equal_range(subnet_id);
 
     for (auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -962,7 +1195,7 @@ Memfile_LeaseMgr::getLeases4(SubnetID subnet_id) const {
 
     Lease4Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases4Internal(subnet_id, collection);
     } else {
         getLeases4Internal(subnet_id, collection);
@@ -980,7 +1213,7 @@ Memfile_LeaseMgr::getLeases4Internal(const std::string& hostname,
         idx.equal_range(hostname);
 
     for (auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -991,7 +1224,7 @@ Memfile_LeaseMgr::getLeases4(const std::string& hostname) const {
 
     Lease4Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases4Internal(hostname, collection);
     } else {
         getLeases4Internal(hostname, collection);
@@ -1003,7 +1236,7 @@ Memfile_LeaseMgr::getLeases4(const std::string& hostname) const {
 void
 Memfile_LeaseMgr::getLeases4Internal(Lease4Collection& collection) const {
    for (auto lease = storage4_.begin(); lease != storage4_.end(); ++lease) {
-       collection.push_back(Lease4Ptr(new Lease4(**lease)));
+       collection.push_back(lease->toLease());
    }
 }
 
@@ -1013,7 +1246,7 @@ Memfile_LeaseMgr::getLeases4() const {
 
    Lease4Collection collection;
    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases4Internal(collection);
    } else {
         getLeases4Internal(collection);
@@ -1027,10 +1260,11 @@ Memfile_LeaseMgr::getLeases4Internal(const asiolink::IOAddress& lower_bound_addr
                                      const LeasePageSize& page_size,
                                      Lease4Collection& collection) const {
     const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
-    Lease4StorageAddressIndex::const_iterator lb = idx.lower_bound(lower_bound_address);
+    const Lease4Entry::AddressKey key = Lease4Entry::addressKey(lower_bound_address);
+    Lease4StorageAddressIndex::const_iterator lb = idx.lower_bound(key);
 
     // Exclude the lower bound address specified by the caller.
-    if ((lb != idx.end()) && ((*lb)->addr_ == lower_bound_address)) {
+    if ((lb != idx.end()) && (lb->addr_ == key)) {
         ++lb;
     }
 
@@ -1038,7 +1272,7 @@ Memfile_LeaseMgr::getLeases4Internal(const asiolink::IOAddress& lower_bound_addr
     for (auto lease = lb;
          (lease != idx.end()) && (std::distance(lb, lease) < page_size.page_size_);
          ++lease) {
-        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -1058,7 +1292,7 @@ Memfile_LeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
 
     Lease4Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases4Internal(lower_bound_address, page_size, collection);
     } else {
         getLeases4Internal(lower_bound_address, page_size, collection);
@@ -1070,11 +1304,11 @@ Memfile_LeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
 Lease6Ptr
 Memfile_LeaseMgr::getLease6Internal(Lease::Type type,
                                     const isc::asiolink::IOAddress& addr) const {
-    Lease6Storage::iterator l = storage6_.find(addr);
-    if (l == storage6_.end() || !(*l) || ((*l)->type_ != type)) {
+    Lease6Storage::iterator l = storage6_.find(Lease6Entry::addressKey(addr));
+    if (l == storage6_.end() || (l->type_ != type)) {
         return (Lease6Ptr());
     } else {
-        return (Lease6Ptr(new Lease6(**l)));
+        return (l->toLease());
     }
 }
 
@@ -1087,7 +1321,7 @@ Memfile_LeaseMgr::getLease6(Lease::Type type,
         .arg(Lease::typeToText(type));
 
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         return (getLease6Internal(type, addr));
     } else {
         return (getLease6Internal(type, addr));
@@ -1108,7 +1342,7 @@ Memfile_LeaseMgr::getLeases6Internal(Lease::Type type,
 
     for (Lease6StorageDuidIaidTypeIndex::const_iterator lease =
          l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -1124,7 +1358,7 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
 
     Lease6Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases6Internal(type, duid, iaid, collection);
     } else {
         getLeases6Internal(type, duid, iaid, collection);
@@ -1149,8 +1383,8 @@ Memfile_LeaseMgr::getLeases6Internal(Lease::Type type,
     for (Lease6StorageDuidIaidTypeIndex::const_iterator lease =
          l.first; lease != l.second; ++lease) {
         // Filter out the leases which subnet id doesn't match.
-        if ((*lease)->subnet_id_ == subnet_id) {
-            collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        if (lease->subnet_id_ == subnet_id) {
+            collection.push_back(lease->toLease());
         }
     }
 }
@@ -1169,7 +1403,7 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
 
     Lease6Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases6Internal(type, duid, iaid, subnet_id, collection);
     } else {
         getLeases6Internal(type, duid, iaid, subnet_id, collection);
@@ -1187,7 +1421,7 @@ Memfile_LeaseMgr::getLeases6Internal(SubnetID subnet_id,
         idx.equal_range(subnet_id);
 
     for (auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -1198,7 +1432,7 @@ Memfile_LeaseMgr::getLeases6(SubnetID subnet_id) const {
 
     Lease6Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases6Internal(subnet_id, collection);
     } else {
         getLeases6Internal(subnet_id, collection);
@@ -1216,7 +1450,7 @@ Memfile_LeaseMgr::getLeases6Internal(const std::string& hostname,
         idx.equal_range(hostname);
 
     for (auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -1227,7 +1461,7 @@ Memfile_LeaseMgr::getLeases6(const std::string& hostname) const {
 
     Lease6Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases6Internal(hostname, collection);
     } else {
         getLeases6Internal(hostname, collection);
@@ -1239,7 +1473,7 @@ Memfile_LeaseMgr::getLeases6(const std::string& hostname) const {
 void
 Memfile_LeaseMgr::getLeases6Internal(Lease6Collection& collection) const {
    for (auto lease = storage6_.begin(); lease != storage6_.end(); ++lease) {
-       collection.push_back(Lease6Ptr(new Lease6(**lease)));
+       collection.push_back(lease->toLease());
    }
 }
 
@@ -1249,7 +1483,7 @@ Memfile_LeaseMgr::getLeases6() const {
 
    Lease6Collection collection;
    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases6Internal(collection);
    } else {
         getLeases6Internal(collection);
@@ -1267,7 +1501,7 @@ Memfile_LeaseMgr::getLeases6Internal(const DUID& duid,
         idx.equal_range(duid.getDuid());
 
     for (auto lease = l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -1278,7 +1512,7 @@ Memfile_LeaseMgr::getLeases6(const DUID& duid) const {
 
     Lease6Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases6Internal(duid, collection);
     } else {
         getLeases6Internal(duid, collection);
@@ -1292,10 +1526,11 @@ Memfile_LeaseMgr::getLeases6Internal(const asiolink::IOAddress& lower_bound_addr
                                      const LeasePageSize& page_size,
                                      Lease6Collection& collection) const {
     const Lease6StorageAddressIndex& idx = storage6_.get<AddressIndexTag>();
-    Lease6StorageAddressIndex::const_iterator lb = idx.lower_bound(lower_bound_address);
+    const Lease6Entry::AddressKey key = Lease6Entry::addressKey(lower_bound_address);
+    Lease6StorageAddressIndex::const_iterator lb = idx.lower_bound(key);
 
     // Exclude the lower bound address specified by the caller.
-    if ((lb != idx.end()) && ((*lb)->addr_ == lower_bound_address)) {
+    if ((lb != idx.end()) && (lb->addr_ == key)) {
         ++lb;
     }
 
@@ -1303,7 +1538,7 @@ Memfile_LeaseMgr::getLeases6Internal(const asiolink::IOAddress& lower_bound_addr
     for (auto lease = lb;
          (lease != idx.end()) && (std::distance(lb, lease) < page_size.page_size_);
          ++lease) {
-        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        collection.push_back(lease->toLease());
     }
 }
 
@@ -1323,7 +1558,7 @@ Memfile_LeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
 
     Lease6Collection collection;
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getLeases6Internal(lower_bound_address, page_size, collection);
     } else {
         getLeases6Internal(lower_bound_address, page_size, collection);
@@ -1350,7 +1585,7 @@ Memfile_LeaseMgr::getExpiredLeases4Internal(Lease4Collection& expired_leases,
          (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
                                                  max_leases));
          ++lease) {
-        expired_leases.push_back(Lease4Ptr(new Lease4(**lease)));
+        expired_leases.push_back(lease->toLease());
     }
 }
 
@@ -1361,7 +1596,7 @@ Memfile_LeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
         .arg(max_leases);
 
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getExpiredLeases4Internal(expired_leases, max_leases);
     } else {
         getExpiredLeases4Internal(expired_leases, max_leases);
@@ -1386,7 +1621,7 @@ Memfile_LeaseMgr::getExpiredLeases6Internal(Lease6Collection& expired_leases,
          (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
                                                  max_leases));
          ++lease) {
-        expired_leases.push_back(Lease6Ptr(new Lease6(**lease)));
+        expired_leases.push_back(lease->toLease());
     }
 }
 
@@ -1397,7 +1632,7 @@ Memfile_LeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
         .arg(max_leases);
 
     if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+        ReadLockGuard lock(*mutex_);
         getExpiredLeases6Internal(expired_leases, max_leases);
     } else {
         getExpiredLeases6Internal(expired_leases, max_leases);
@@ -1410,7 +1645,8 @@ Memfile_LeaseMgr::updateLease4Internal(const Lease4Ptr& lease) {
     Lease4StorageAddressIndex& index = storage4_.get<AddressIndexTag>();
 
     // Lease must exist if it is to be updated.
-    Lease4StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+    Lease4StorageAddressIndex::const_iterator lease_it =
+        index.find(Lease4Entry::addressKey(lease->addr_));
     if (lease_it == index.end()) {
         isc_throw(NoSuchLease, "failed to update the lease with address "
                   << lease->addr_ << " - no such lease");
@@ -1424,7 +1660,10 @@ Memfile_LeaseMgr::updateLease4Internal(const Lease4Ptr& lease) {
     }
 
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    index.replace(lease_it, Lease4Entry(*lease));
+
+    lease->old_cltt_ = lease->cltt_;
+    lease->old_valid_lft_ = lease->valid_lft_;
 }
 
 void
@@ -1432,11 +1671,24 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_UPDATE_ADDR4).arg(lease->addr_.toText());
 
-    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+    Lease4Ptr old_lease;
+    uint64_t sequence;
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        old_lease = getRollbackLease(lease);
         updateLease4Internal(lease);
+        sequence = getJournalSequence(V4);
     } else {
+        old_lease = getRollbackLease(lease);
         updateLease4Internal(lease);
+        sequence = getJournalSequence(V4);
+    }
+    try {
+        waitForJournal(V4, sequence);
+    } catch (const FileJournalError&) {
+        // The update was not written: restore the previous lease.
+        rollbackLease(lease, old_lease);
+        throw;
     }
 }
 
@@ -1446,7 +1698,8 @@ Memfile_LeaseMgr::updateLease6Internal(const Lease6Ptr& lease) {
     Lease6StorageAddressIndex& index = storage6_.get<AddressIndexTag>();
 
     // Lease must exist if it is to be updated.
-    Lease6StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+    Lease6StorageAddressIndex::const_iterator lease_it =
+        index.find(Lease6Entry::addressKey(lease->addr_));
     if (lease_it == index.end()) {
         isc_throw(NoSuchLease, "failed to update the lease with address "
                   << lease->addr_ << " - no such lease");
@@ -1460,7 +1713,10 @@ Memfile_LeaseMgr::updateLease6Internal(const Lease6Ptr& lease) {
     }
 
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    index.replace(lease_it, Lease6Entry(*lease));
+
+    lease->old_cltt_ = lease->cltt_;
+    lease->old_valid_lft_ = lease->valid_lft_;
 }
 
 void
@@ -1468,11 +1724,24 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_UPDATE_ADDR6).arg(lease->addr_.toText());
 
-    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
+    Lease6Ptr old_lease;
+    uint64_t sequence;
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        old_lease = getRollbackLease(lease);
         updateLease6Internal(lease);
+        sequence = getJournalSequence(V6);
     } else {
+        old_lease = getRollbackLease(lease);
         updateLease6Internal(lease);
+        sequence = getJournalSequence(V6);
+    }
+    try {
+        waitForJournal(V6, sequence);
+    } catch (const FileJournalError&) {
+        // The update was not written: restore the previous lease.
+        rollbackLease(lease, old_lease);
+        throw;
     }
 }
 
@@ -1483,19 +1752,19 @@ Memfile_LeaseMgr::deleteLeaseInternal(const Lease4Ptr& lease) {
               DHCPSRV_MEMFILE_DELETE_ADDR)
         .arg(addr.toText());
 
-    Lease4Storage::iterator l = storage4_.find(addr);
+    Lease4Storage::iterator l = storage4_.find(Lease4Entry::addressKey(addr));
     if (l == storage4_.end()) {
         // No such lease
         return (false);
     } else {
         if (persistLeases(V4)) {
-            // Copy the lease. The valid lifetime needs to be modified and
-            // we don't modify the original lease.
-            Lease4 lease_copy = **l;
+            // Materialize the lease held in the container. The valid
+            // lifetime needs to be modified.
+            Lease4Ptr lease_copy = l->toLease();
             // Setting valid lifetime to 0 means that lease is being
             // removed.
-            lease_copy.valid_lft_ = 0;
-            lease_file4_->append(lease_copy);
+            lease_copy->valid_lft_ = 0;
+            lease_file4_->append(*lease_copy);
         }
         storage4_.erase(l);
         return (true);
@@ -1507,12 +1776,29 @@ Memfile_LeaseMgr::deleteLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(lease->addr_.toText());
 
-    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
-        return (deleteLeaseInternal(lease));
+    Lease4Ptr old_lease;
+    bool deleted;
+    uint64_t sequence;
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        old_lease = getRollbackLease(lease);
+        deleted = deleteLeaseInternal(lease);
+        sequence = getJournalSequence(V4);
     } else {
-        return (deleteLeaseInternal(lease));
+        old_lease = getRollbackLease(lease);
+        deleted = deleteLeaseInternal(lease);
+        sequence = getJournalSequence(V4);
+    }
+    try {
+        waitForJournal(V4, sequence);
+    } catch (const FileJournalError&) {
+        // The deletion was not written: restore the lease.
+        if (deleted) {
+            rollbackLease(Lease4Ptr(), old_lease);
+        }
+        throw;
     }
+    return (deleted);
 }
 
 bool
@@ -1522,19 +1808,19 @@ Memfile_LeaseMgr::deleteLeaseInternal(const Lease6Ptr& lease) {
               DHCPSRV_MEMFILE_DELETE_ADDR)
         .arg(addr.toText());
 
-    Lease6Storage::iterator l = storage6_.find(addr);
+    Lease6Storage::iterator l = storage6_.find(Lease6Entry::addressKey(addr));
     if (l == storage6_.end()) {
         // No such lease
         return (false);
     } else {
         if (persistLeases(V6)) {
-            // Copy the lease. The lifetimes need to be modified and we
-            // don't modify the original lease.
-            Lease6 lease_copy = **l;
+            // Materialize the lease held in the container. The lifetimes
+            // need to be modified.
+            Lease6Ptr lease_copy = l->toLease();
             // Setting lifetimes to 0 means that lease is being removed.
-            lease_copy.valid_lft_ = 0;
-            lease_copy.preferred_lft_ = 0;
-            lease_file6_->append(lease_copy);
+            lease_copy->valid_lft_ = 0;
+            lease_copy->preferred_lft_ = 0;
+            lease_file6_->append(*lease_copy);
         }
         storage6_.erase(l);
         return (true);
@@ -1546,12 +1832,29 @@ Memfile_LeaseMgr::deleteLease(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(lease->addr_.toText());
 
-    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
-        return (deleteLeaseInternal(lease));
+    Lease6Ptr old_lease;
+    bool deleted;
+    uint64_t sequence;
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        old_lease = getRollbackLease(lease);
+        deleted = deleteLeaseInternal(lease);
+        sequence = getJournalSequence(V6);
     } else {
-        return (deleteLeaseInternal(lease));
+        old_lease = getRollbackLease(lease);
+        deleted = deleteLeaseInternal(lease);
+        sequence = getJournalSequence(V6);
+    }
+    try {
+        waitForJournal(V6, sequence);
+    } catch (const FileJournalError&) {
+        // The deletion was not written: restore the lease.
+        if (deleted) {
+            rollbackLease(Lease6Ptr(), old_lease);
+        }
+        throw;
     }
+    return (deleted);
 }
 
 uint64_t
@@ -1560,16 +1863,22 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED4)
         .arg(secs);
 
-    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
-        return (deleteExpiredReclaimedLeases<
-                Lease4StorageExpirationIndex, Lease4
-                >(secs, V4, storage4_, lease_file4_));
+    uint64_t deleted;
+    uint64_t sequence;
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        deleted = deleteExpiredReclaimedLeases<
+            Lease4StorageExpirationIndex, Lease4
+            >(secs, V4, storage4_, lease_file4_);
+        sequence = getJournalSequence(V4);
     } else {
-        return (deleteExpiredReclaimedLeases<
-                Lease4StorageExpirationIndex, Lease4
-                >(secs, V4, storage4_, lease_file4_));
+        deleted = deleteExpiredReclaimedLeases<
+            Lease4StorageExpirationIndex, Lease4
+            >(secs, V4, storage4_, lease_file4_);
+        sequence = getJournalSequence(V4);
     }
+    waitForJournal(V4, sequence);
+    return (deleted);
 }
 
 uint64_t
@@ -1578,16 +1887,22 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED6)
         .arg(secs);
 
-    if (MultiThreadingMgr::instance().getMode()) {
-        std::lock_guard<std::mutex> lock(*mutex_);
-        return (deleteExpiredReclaimedLeases<
-                Lease6StorageExpirationIndex, Lease6
-                >(secs, V6, storage6_, lease_file6_));
+    uint64_t deleted;
+    uint64_t sequence;
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        deleted = deleteExpiredReclaimedLeases<
+            Lease6StorageExpirationIndex, Lease6
+            >(secs, V6, storage6_, lease_file6_);
+        sequence = getJournalSequence(V6);
     } else {
-        return (deleteExpiredReclaimedLeases<
-                Lease6StorageExpirationIndex, Lease6
-                >(secs, V6, storage6_, lease_file6_));
+        deleted = deleteExpiredReclaimedLeases<
+            Lease6StorageExpirationIndex, Lease6
+            >(secs, V6, storage6_, lease_file6_);
+        sequence = getJournalSequence(V6);
     }
+    waitForJournal(V6, sequence);
+    return (deleted);
 }
 
 template<typename IndexType, typename LeaseType, typename StorageType,
@@ -1636,12 +1951,12 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases(const uint32_t secs,
         if (persistLeases(universe)) {
             for (typename IndexType::const_iterator lease = lower_limit;
                  lease != upper_limit; ++lease) {
-                // Copy lease to not affect the lease in the container.
-                LeaseType lease_copy(**lease);
+                // Materialize the lease held in the container.
+                boost::shared_ptr<LeaseType> lease_copy = lease->toLease();
                 // Set the valid lifetime to 0 to indicate the removal
                 // of the lease.
-                lease_copy.valid_lft_ = 0;
-                lease_file->append(lease_copy);
+                lease_copy->valid_lft_ = 0;
+                lease_file->append(*lease_copy);
             }
         }
 
@@ -1756,6 +2071,129 @@ Memfile_LeaseMgr::initLeaseFilePath(Universe u) {
     return (lease_file);
 }
 
+void
+Memfile_LeaseMgr::journalSetup() {
+    std::string durability_str;
+    try {
+        durability_str = conn_.getParameter("durability");
+    } catch (const std::exception&) {
+        // Write the leases synchronously.
+        return;
+    }
+
+    FileJournal::Durability durability =
+        FileJournal::durabilityFromText(durability_str);
+    if (lease_file4_) {
+        journal4_.reset(new FileJournal(durability));
+        lease_file4_->setJournal(journal4_);
+    }
+    if (lease_file6_) {
+        journal6_.reset(new FileJournal(durability));
+        lease_file6_->setJournal(journal6_);
+    }
+}
+
+uint64_t
+Memfile_LeaseMgr::getJournalSequence(Universe u) const {
+    const FileJournalPtr& journal = (u == V4 ? journal4_ : journal6_);
+    if (!journal || !persistLeases(u)) {
+        return (0);
+    }
+    return (journal->getSequence());
+}
+
+void
+Memfile_LeaseMgr::waitForJournal(Universe u, uint64_t sequence) const {
+    const FileJournalPtr& journal = (u == V4 ? journal4_ : journal6_);
+    if (journal && (sequence > 0)) {
+        journal->wait(sequence);
+    }
+}
+
+Lease4Ptr
+Memfile_LeaseMgr::getRollbackLease(const Lease4Ptr& lease) const {
+    if (!journal4_ || !persistLeases(V4)) {
+        return (Lease4Ptr());
+    }
+    return (getLease4Internal(lease->addr_));
+}
+
+Lease6Ptr
+Memfile_LeaseMgr::getRollbackLease(const Lease6Ptr& lease) const {
+    if (!journal6_ || !persistLeases(V6)) {
+        return (Lease6Ptr());
+    }
+    return (getLease6Internal(lease->type_, lease->addr_));
+}
+
+void
+Memfile_LeaseMgr::rollbackLease(const Lease4Ptr& current,
+                                const Lease4Ptr& previous) {
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        rollbackLeaseInternal(current, previous);
+    } else {
+        rollbackLeaseInternal(current, previous);
+    }
+}
+
+void
+Memfile_LeaseMgr::rollbackLease(const Lease6Ptr& current,
+                                const Lease6Ptr& previous) {
+    if (writeLockRequired()) {
+        WriteLockGuard lock(*mutex_);
+        rollbackLeaseInternal(current, previous);
+    } else {
+        rollbackLeaseInternal(current, previous);
+    }
+}
+
+void
+Memfile_LeaseMgr::rollbackLeaseInternal(const Lease4Ptr& current,
+                                        const Lease4Ptr& previous) {
+    const IOAddress& addr = (current ? current->addr_ : previous->addr_);
+    Lease4Storage::iterator l = storage4_.find(Lease4Entry::addressKey(addr));
+    // Leave the lease alone when another thread changed it in the meantime.
+    if (current) {
+        if ((l == storage4_.end()) || (*l->toLease() != *current)) {
+            return;
+        }
+    } else if (l != storage4_.end()) {
+        return;
+    }
+
+    if (!previous) {
+        storage4_.erase(l);
+    } else if (l == storage4_.end()) {
+        storage4_.insert(Lease4Entry(*previous));
+    } else {
+        storage4_.replace(l, Lease4Entry(*previous));
+    }
+}
+
+void
+Memfile_LeaseMgr::rollbackLeaseInternal(const Lease6Ptr& current,
+                                        const Lease6Ptr& previous) {
+    const IOAddress& addr = (current ? current->addr_ : previous->addr_);
+    Lease6Storage::iterator l = storage6_.find(Lease6Entry::addressKey(addr));
+    // Leave the lease alone when another thread changed it in the meantime.
+    if (current) {
+        if ((l == storage6_.end()) || (*l->toLease() != *current)) {
+            return;
+        }
+    } else if (l != storage6_.end()) {
+        return;
+    }
+
+    if (!previous) {
+        storage6_.erase(l);
+    } else if (l == storage6_.end()) {
+        storage6_.insert(Lease6Entry(*previous));
+    } else {
+        storage6_.replace(l, Lease6Entry(*previous));
+    }
+}
+
 template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
 bool
 Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
@@ -1790,28 +2228,32 @@ Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
                   << max_row_errors_str << " specified");
     }
 
-    // Load the leasefile.completed, if exists.
+    // Load the leasefile.completed, if exists. The files written by the
+    // lease file cleanup may be in the binary format: their format is
+    // detected by the loader. Large files are parsed by a thread per
+    // processor (0 threads).
     bool conversion_needed = false;
+    LeaseFileStats stats;
     lease_file.reset(new LeaseFileType(std::string(filename + ".completed")));
     if (lease_file->exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                               max_row_errors);
-        conversion_needed = conversion_needed || lease_file->needsConversion();
+        conversion_needed = LeaseFileLoader::loadFile<LeaseObjectType, LeaseFileType>
+            (lease_file->getFilename(), storage, max_row_errors, stats, 0) ||
+            conversion_needed;
     } else {
         // If the leasefile.completed doesn't exist, let's load the leases
         // from leasefile.2 and leasefile.1, if they exist.
         lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_PREVIOUS)));
         if (lease_file->exists()) {
-            LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                                   max_row_errors);
-            conversion_needed =  conversion_needed || lease_file->needsConversion();
+            conversion_needed = LeaseFileLoader::loadFile<LeaseObjectType, LeaseFileType>
+                (lease_file->getFilename(), storage, max_row_errors, stats, 0) ||
+                conversion_needed;
         }
 
         lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_INPUT)));
         if (lease_file->exists()) {
-            LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                                   max_row_errors);
-            conversion_needed =  conversion_needed || lease_file->needsConversion();
+            conversion_needed = LeaseFileLoader::loadFile<LeaseObjectType, LeaseFileType>
+                (lease_file->getFilename(), storage, max_row_errors, stats, 0) ||
+                conversion_needed;
         }
     }
 
@@ -1823,7 +2265,7 @@ Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
     // future lease updates.
     lease_file.reset(new LeaseFileType(filename));
     LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                           max_row_errors, false);
+                                           max_row_errors, false, 0);
     conversion_needed =  conversion_needed || lease_file->needsConversion();
 
     return (conversion_needed);
@@ -1870,9 +2312,58 @@ Memfile_LeaseMgr::lfcSetup(bool conversion_needed) {
                   << lfc_interval_str << " specified");
     }
 
+    std::string lfc_format_str = "csv";
+    try {
+        lfc_format_str = conn_.getParameter("lfc-format");
+    } catch (const std::exception&) {
+        // Ignore and default to csv.
+    }
+
+    if ((lfc_format_str != "csv") && (lfc_format_str != "binary")) {
+        isc_throw(isc::BadValue, "invalid value of the lfc-format "
+                  << lfc_format_str << " specified, expected csv or binary");
+    }
+
+    std::string lfc_mode_str = "external";
+    try {
+        lfc_mode_str = conn_.getParameter("lfc-mode");
+    } catch (const std::exception&) {
+        // Ignore and default to external.
+    }
+
+    if ((lfc_mode_str != "external") && (lfc_mode_str != "in-process")) {
+        isc_throw(isc::BadValue, "invalid value of the lfc-mode "
+                  << lfc_mode_str << " specified, expected external or"
+                  " in-process");
+    }
+
+    std::string lfc_write_rate_str = "0";
+    try {
+        lfc_write_rate_str = conn_.getParameter("lfc-write-rate");
+    } catch (const std::exception&) {
+        // Ignore and default to 0.
+    }
+
+    uint32_t lfc_write_rate = 0;
+    try {
+        lfc_write_rate = boost::lexical_cast<uint32_t>(lfc_write_rate_str);
+    } catch (boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the lfc-write-rate "
+                  << lfc_write_rate_str << " specified");
+    }
+
     if (lfc_interval > 0 || conversion_needed) {
         lfc_setup_.reset(new LFCSetup(boost::bind(&Memfile_LeaseMgr::lfcCallback, this)));
-        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed);
+        if (lfc_mode_str == "in-process") {
+            const Universe u = (lease_file4_ ? V4 : V6);
+            lfc_setup_->setInProcess(boost::bind(&Memfile_LeaseMgr::lfcInProcess,
+                                                 this, _1, u,
+                                                 getLeaseFilePath(u),
+                                                 lfc_format_str == "binary"),
+                                     lfc_write_rate);
+        }
+        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed,
+                          lfc_format_str == "binary");
     }
 }
 
@@ -1889,6 +2380,12 @@ Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file) {
     CSVFile lease_file_finish(appendSuffix(lease_file->getFilename(), FILE_FINISH));
     CSVFile lease_file_copy(appendSuffix(lease_file->getFilename(), FILE_INPUT));
     if (!lease_file_finish.exists() && !lease_file_copy.exists()) {
+        // The lease changes must not append to the file being rotated.
+        boost::scoped_ptr<WriteLockGuard> lock;
+        if (writeLockRequired()) {
+            lock.reset(new WriteLockGuard(*mutex_));
+        }
+
         // Close the current file so as we can move it to the copy file.
         lease_file->close();
         // Move the current file to the copy file. Remember the result
@@ -1937,6 +2434,116 @@ Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file) {
     }
 }
 
+bool
+Memfile_LeaseMgr::writeLockRequired() const {
+    return (MultiThreadingMgr::instance().getMode() ||
+            (lfc_setup_ && lfc_setup_->isInProcess()));
+}
+
+void
+Memfile_LeaseMgr::lfcInProcess(LFCSetup& lfc_setup, Universe u,
+                               const std::string& filename,
+                               bool binary_output) {
+    if (u == V4) {
+        if (binary_output) {
+            lfcWrite<BinaryLeaseFile4>(lfc_setup, filename, storage4_);
+        } else {
+            lfcWrite<CSVLeaseFile4>(lfc_setup, filename, storage4_);
+        }
+    } else {
+        if (binary_output) {
+            lfcWrite<BinaryLeaseFile6>(lfc_setup, filename, storage6_);
+        } else {
+            lfcWrite<CSVLeaseFile6>(lfc_setup, filename, storage6_);
+        }
+    }
+}
+
+template<typename LeaseFileType, typename StorageType>
+void
+Memfile_LeaseMgr::lfcWrite(LFCSetup& lfc_setup, const std::string& filename,
+                           const StorageType& storage) {
+    typedef typename StorageType::value_type EntryType;
+    typedef typename EntryType::AddressKey AddressKey;
+    const std::string output_name = appendSuffix(filename, FILE_OUTPUT);
+    const typename StorageType::template index<AddressIndexTag>::type& index =
+        storage.template get<AddressIndexTag>();
+
+    LeaseFileType output(output_name);
+    output.recreate();
+
+    // The storage is copied by batches in the order of the addresses, so
+    // the lease changes wait only for the copy of a batch. A lease changed
+    // during the cleanup is written to the current lease file as well, so
+    // it doesn't matter whether its old or new value is in the output.
+    std::vector<EntryType> batch;
+    batch.reserve(LFC_BATCH_SIZE);
+    AddressKey last_key = AddressKey();
+    uint64_t count = 0;
+    for (;;) {
+        batch.clear();
+        {
+            ReadLockGuard lock(*mutex_);
+            auto entry = (count == 0 ? index.begin() : index.upper_bound(last_key));
+            for (; (entry != index.end()) && (batch.size() < LFC_BATCH_SIZE);
+                 ++entry) {
+                batch.push_back(*entry);
+            }
+        }
+        if (batch.empty()) {
+            break;
+        }
+        last_key = batch.back().addr_;
+        count += batch.size();
+
+        try {
+            for (auto const& entry : batch) {
+                output.append(*entry.toLease());
+            }
+        } catch (const std::exception&) {
+            output.close();
+            static_cast<void>(remove(output_name.c_str()));
+            throw;
+        }
+
+        if (!lfc_setup.pace(batch.size())) {
+            // The server is shutting down or is reconfigured. The next
+            // cleanup will start again from the files left unchanged.
+            output.close();
+            static_cast<void>(remove(output_name.c_str()));
+            return;
+        }
+    }
+    output.close();
+
+    // Replace the previous and copy files by the output as kea-lfc does.
+    // If the server stops before the end, the finish file is loaded with
+    // the current lease file at startup.
+    const std::string finish_name = appendSuffix(filename, FILE_FINISH);
+    const std::string previous_name = appendSuffix(filename, FILE_PREVIOUS);
+    const std::string copy_name = appendSuffix(filename, FILE_INPUT);
+    if (rename(output_name.c_str(), finish_name.c_str()) != 0) {
+        isc_throw(DbOperationError, "unable to rename " << output_name
+                  << " to " << finish_name << ": " << strerror(errno));
+    }
+    if ((remove(previous_name.c_str()) != 0) && (errno != ENOENT)) {
+        isc_throw(DbOperationError, "unable to remove " << previous_name
+                  << ": " << strerror(errno));
+    }
+    if ((remove(copy_name.c_str()) != 0) && (errno != ENOENT)) {
+        isc_throw(DbOperationError, "unable to remove " << copy_name
+                  << ": " << strerror(errno));
+    }
+    if (rename(finish_name.c_str(), previous_name.c_str()) != 0) {
+        isc_throw(DbOperationError, "unable to rename " << finish_name
+                  << " to " << previous_name << ": " << strerror(errno));
+    }
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_COMPLETE)
+        .arg(count)
+        .arg(previous_name);
+}
+
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery4() {
     LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_));
@@ -1999,7 +2606,7 @@ Memfile_LeaseMgr::wipeLeases4(const SubnetID& subnet_id) {
     // Let's collect all leases.
     Lease4Collection leases;
     for (auto lease = l.first; lease != l.second; ++lease) {
-        leases.push_back(*lease);
+        leases.push_back(lease->toLease());
     }
 
     size_t num = leases.size();
@@ -2028,7 +2635,7 @@ Memfile_LeaseMgr::wipeLeases6(const SubnetID& subnet_id) {
     // Let's collect all leases.
     Lease6Collection leases;
     for (auto lease = l.first; lease != l.second; ++lease) {
-        leases.push_back(*lease);
+        leases.push_back(lease->toLease());
     }
 
     size_t num = leases.size();
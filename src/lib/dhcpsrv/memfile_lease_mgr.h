@@ -14,13 +14,13 @@
 #include <dhcpsrv/csv_lease_file6.h>
 #include <dhcpsrv/memfile_lease_storage.h>
 #include <dhcpsrv/lease_mgr.h>
+#include <util/file_journal.h>
 #include <util/process_spawn.h>
+#include <util/readwrite_mutex.h>
 
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 
-#include <mutex>
-
 namespace isc {
 namespace dhcp {
 
@@ -45,7 +45,9 @@ class LFCSetup;
 /// The backend installs an @c asiolink::IntervalTimer to periodically execute
 /// the @c Memfile_LeaseMgr::lfcCallback. This callback function controls
 /// the startup of the background process which removes redundant information
-/// from the lease file(s).
+/// from the lease file(s). With the "in-process" cleanup mode, the cleanup is
+/// instead performed by a thread of the server which writes the leases held
+/// in memory, so the lease files are not parsed again.
 ///
 /// When the backend is starting up, it reads leases from the lease file (one
 /// by one) and adds them to the in-memory container as follows:
@@ -870,6 +872,104 @@ private:
     /// argument to this function.
     std::string initLeaseFilePath(Universe u);
 
+    /// @brief Configures the journals writing the lease files.
+    ///
+    /// When the "durability" parameter is specified, the lease updates are
+    /// queued to a journal whose thread writes them to the lease file in
+    /// batches, and the lease changes return when the update is safe
+    /// according to the durability policy: "none", "periodic" or
+    /// "group-commit". Without this parameter the lease updates are
+    /// written synchronously.
+    ///
+    /// @throw BadValue if the durability policy is invalid.
+    void journalSetup();
+
+    /// @brief Returns the sequence number of the last lease update queued
+    /// to the journal.
+    ///
+    /// Must be called with the mutex locked after the update.
+    ///
+    /// @param u Universe (V4 or V6).
+    /// @return The sequence number or 0 when there is no journal.
+    uint64_t getJournalSequence(Universe u) const;
+
+    /// @brief Waits until a lease update is safe according to the
+    /// durability policy.
+    ///
+    /// Must be called without the mutex, so the other threads can queue
+    /// their updates to the same batch.
+    ///
+    /// @param u Universe (V4 or V6).
+    /// @param sequence The sequence number of the update.
+    /// @throw FileJournalError if the lease file could not be written.
+    void waitForJournal(Universe u, uint64_t sequence) const;
+
+    /// @name Restoring the leases whose change was not written.
+    ///
+    /// With a journal, a lease change is made in memory before it is
+    /// written to the lease file. When the write fails, the change is
+    /// undone so as the memory remains consistent with the lease file.
+    ///@{
+
+    /// @brief Returns the lease to restore if the change of a lease can't
+    /// be written.
+    ///
+    /// Must be called with the mutex locked before the change.
+    ///
+    /// @param lease The lease being changed.
+    /// @return The lease in memory, or null when there is no journal or
+    /// no such lease.
+    Lease4Ptr getRollbackLease(const Lease4Ptr& lease) const;
+
+    /// @brief Returns the lease to restore if the change of a lease can't
+    /// be written.
+    ///
+    /// Must be called with the mutex locked before the change.
+    ///
+    /// @param lease The lease being changed.
+    /// @return The lease in memory, or null when there is no journal or
+    /// no such lease.
+    Lease6Ptr getRollbackLease(const Lease6Ptr& lease) const;
+
+    /// @brief Undoes the change of an IPv4 lease.
+    ///
+    /// The lease is left unchanged when another thread changed it since.
+    ///
+    /// @param current The lease stored by the change or null when the
+    /// lease was deleted.
+    /// @param previous The lease to restore or null when the lease was
+    /// added.
+    void rollbackLease(const Lease4Ptr& current, const Lease4Ptr& previous);
+
+    /// @brief Undoes the change of an IPv6 lease.
+    ///
+    /// The lease is left unchanged when another thread changed it since.
+    ///
+    /// @param current The lease stored by the change or null when the
+    /// lease was deleted.
+    /// @param previous The lease to restore or null when the lease was
+    /// added.
+    void rollbackLease(const Lease6Ptr& current, const Lease6Ptr& previous);
+
+    /// @brief Undoes the change of an IPv4 lease.
+    ///
+    /// Must be called with the mutex locked.
+    ///
+    /// @param current The lease stored by the change or null.
+    /// @param previous The lease to restore or null.
+    void rollbackLeaseInternal(const Lease4Ptr& current,
+                               const Lease4Ptr& previous);
+
+    /// @brief Undoes the change of an IPv6 lease.
+    ///
+    /// Must be called with the mutex locked.
+    ///
+    /// @param current The lease stored by the change or null.
+    /// @param previous The lease to restore or null.
+    void rollbackLeaseInternal(const Lease6Ptr& current,
+                               const Lease6Ptr& previous);
+    ///@}
+
     /// @brief Load leases from the persistent storage.
     ///
     /// This method loads DHCPv4 or DHCPv6 leases from lease files in the
@@ -909,6 +1009,10 @@ private:
     /// retries starting up or reconfiguring the server it will most likely
     /// be successful as the LFC should be complete by that time.
     ///
+    /// The files written by the LFC may be in the binary format, the
+    /// format of these files is detected. The lease file the server
+    /// appends to is always in the CSV format.
+    ///
     /// @todo Consider implementing delaying the lease files loading when
     /// the LFC is in progress by the specified amount of time.
     ///
@@ -943,6 +1047,12 @@ private:
     /// @brief Holds the pointer to the DHCPv6 lease file IO.
     boost::shared_ptr<CSVLeaseFile6> lease_file6_;
 
+    /// @brief Journal writing the DHCPv4 lease file, if any.
+    util::FileJournalPtr journal4_;
+
+    /// @brief Journal writing the DHCPv6 lease file, if any.
+    util::FileJournalPtr journal6_;
+
 public:
 
     /// @name Public methods to retrieve information about the LFC process state.
@@ -1049,6 +1159,10 @@ protected:
 
 private:
 
+    /// @brief Number of leases copied from the storage at once by the
+    /// in-process %Lease File Cleanup.
+    static const size_t LFC_BATCH_SIZE = 1024;
+
     /// @brief Setup the periodic %Lease File Cleanup.
     ///
     /// This method checks if the @c lfc-interval configuration parameter
@@ -1060,11 +1174,19 @@ private:
     /// the unit tests need to override this path (with the path in the
     /// Kea build directory, the @c KEA_LFC_EXECUTABLE environmental
     /// variable should be set to hold an absolute path to the kea-lfc
-    /// executable.
+    /// executable. The @c lfc-format configuration parameter selects the
+    /// format of the files written by the cleanup: "csv" (default) or
+    /// "binary". When the @c lfc-mode configuration parameter is
+    /// "in-process" the cleanup is performed by a thread of the server
+    /// (see @c lfcInProcess) instead of kea-lfc, and the @c lfc-write-rate
+    /// parameter limits the number of leases it writes per second.
     /// @param conversion_needed flag that indicates input lease file(s) are
     /// schema do not match the current schema (older or newer), and need
     /// conversion. This value is passed through to LFCSetup::setup() via its
     /// run_once_now parameter.
+    ///
+    /// @throw BadValue if the lfc-interval, the lfc-format, the lfc-mode
+    /// or the lfc-write-rate is invalid.
     void lfcSetup(bool conversion_needed = false);
 
     /// @brief Performs a lease file cleanup for DHCPv4 or DHCPv6.
@@ -1092,6 +1214,57 @@ private:
     template<typename LeaseFileType>
     void lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file);
 
+    /// @brief Checks if the lease changes must take the mutex.
+    ///
+    /// The lease changes take the mutex in the multi-threading mode and
+    /// when the in-process %Lease File Cleanup may read the storage from
+    /// its thread.
+    ///
+    /// @return true if the lease changes must take the mutex.
+    bool writeLockRequired() const;
+
+    /// @brief Performs the in-process %Lease File Cleanup.
+    ///
+    /// This method is executed by the thread of the in-process cleanup
+    /// once @c lfcExecute has rotated the lease files. Rather than parsing
+    /// the previous and copy lease files as kea-lfc does, it writes the
+    /// leases held in memory to the output file, which then replaces
+    /// these files.
+    ///
+    /// @param lfc_setup The cleanup configuration pacing the writes.
+    /// @param u Universe (V4 or V6).
+    /// @param filename Name of the current lease file.
+    /// @param binary_output A flag that causes the cleanup to write the
+    /// leases in the binary format.
+    /// @throw DbOperationError if the files can't be replaced and
+    /// CSVFileError or BinaryLeaseFileError if the output can't be written.
+    void lfcInProcess(LFCSetup& lfc_setup, Universe u,
+                      const std::string& filename, bool binary_output);
+
+    /// @brief Writes the leases of a storage for the in-process %Lease
+    /// File Cleanup.
+    ///
+    /// The storage is copied by batches of @c LFC_BATCH_SIZE entries in
+    /// the order of the addresses, so the memory used by the cleanup and
+    /// the time the lease changes wait for the mutex are bounded. The
+    /// leases changed during the cleanup are written to the current lease
+    /// file, which is loaded after the output, so the output doesn't have
+    /// to be a consistent snapshot of the storage.
+    ///
+    /// When the output is written it replaces the previous and copy lease
+    /// files in the same steps as kea-lfc. When the cleanup is stopped
+    /// the output is removed and the other files are left unchanged.
+    ///
+    /// @param lfc_setup The cleanup configuration pacing the writes.
+    /// @param filename Name of the current lease file.
+    /// @param storage The storage.
+    /// @tparam LeaseFileType The type of the output file: @c CSVLeaseFile4,
+    /// @c CSVLeaseFile6, @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
+    /// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseFileType, typename StorageType>
+    void lfcWrite(LFCSetup& lfc_setup, const std::string& filename,
+                  const StorageType& storage);
+
     /// @brief A pointer to the Lease File Cleanup configuration.
     boost::scoped_ptr<LFCSetup> lfc_setup_;
 
@@ -1103,8 +1276,11 @@ private:
 
     //@}
 
-    /// @brief Manager mutex
-    boost::scoped_ptr<std::mutex> mutex_;
+    /// @brief Manager read-write mutex
+    ///
+    /// Lookups take the mutex as readers so they can proceed in parallel
+    /// on different threads, lease changes take it as a writer.
+    boost::scoped_ptr<util::ReadWriteMutex> mutex_;
 };
 
 }  // namespace dhcp
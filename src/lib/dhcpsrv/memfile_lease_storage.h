@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 
 #include <asiolink/io_address.h>
 #include <dhcpsrv/lease.h>
+#include <dhcpsrv/memfile_lease_entry.h>
 #include <dhcpsrv/subnet_id.h>
 
 #include <boost/multi_index/indexed_by.hpp>
@@ -66,16 +67,20 @@ struct HostnameIndexTag { };
 /// Indexes can be accessed using the index number (from 0 to 2) or a
 /// name tag. It is recommended to use the tags to access indexes as
 /// they do not depend on the order of indexes in the container.
+///
+/// The container holds compact entries (see @ref LeaseEntry) from which
+/// the Lease6 objects are materialized by the lease manager.
 typedef boost::multi_index_container<
-    // It holds pointers to Lease6 objects.
-    Lease6Ptr,
+    // It holds compact lease entries.
+    Lease6Entry,
     boost::multi_index::indexed_by<
         // Specification of the first index starts here.
         // This index sorts leases by IPv6 addresses represented as
-        // IOAddress objects.
+        // arrays of bytes (see Lease6Entry::addressKey).
         boost::multi_index::ordered_unique<
             boost::multi_index::tag<AddressIndexTag>,
-            boost::multi_index::member<Lease, isc::asiolink::IOAddress, &Lease::addr_>
+            boost::multi_index::member<Lease6Entry, Lease6Entry::AddressKey,
+                                       &Lease6Entry::addr_>
         >,
 
         // Specification of the second index starts here.
@@ -84,15 +89,15 @@ typedef boost::multi_index_container<
             // This is a composite index that will be used to search for
             // the lease using three attributes: DUID, IAID and lease type.
             boost::multi_index::composite_key<
-                Lease6,
-                // The DUID can be retrieved from the Lease6 object using
-                // a getDuidVector const function.
-                boost::multi_index::const_mem_fun<Lease6, const std::vector<uint8_t>&,
-                                                  &Lease6::getDuidVector>,
+                Lease6Entry,
+                // The DUID can be retrieved from the entry using
+                // a getDuidKey const function.
+                boost::multi_index::const_mem_fun<Lease6Entry, BytesRef,
+                                                  &Lease6Entry::getDuidKey>,
                 // The two other ingredients of this index are IAID and
                 // lease type.
-                boost::multi_index::member<Lease6, uint32_t, &Lease6::iaid_>,
-                boost::multi_index::member<Lease6, Lease::Type, &Lease6::type_>
+                boost::multi_index::member<Lease6Entry, uint32_t, &Lease6Entry::iaid_>,
+                boost::multi_index::member<Lease6Entry, Lease::Type, &Lease6Entry::type_>
             >
         >,
 
@@ -104,13 +109,13 @@ typedef boost::multi_index_container<
             // of the search key, the reclaimed or not reclaimed leases will can
             // be searched.
             boost::multi_index::composite_key<
-                Lease6,
+                Lease6Entry,
                 // The boolean value specifying if lease is reclaimed or not.
-                boost::multi_index::const_mem_fun<Lease, bool,
-                                                  &Lease::stateExpiredReclaimed>,
+                boost::multi_index::const_mem_fun<LeaseEntry, bool,
+                                                  &LeaseEntry::stateExpiredReclaimed>,
                 // Lease expiration time.
-                boost::multi_index::const_mem_fun<Lease, int64_t,
-                                                  &Lease::getExpirationTime>
+                boost::multi_index::const_mem_fun<LeaseEntry, int64_t,
+                                                  &LeaseEntry::getExpirationTime>
             >
         >,
 
@@ -118,24 +123,24 @@ typedef boost::multi_index_container<
         // This index sorts leases by SubnetID.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<SubnetIdIndexTag>,
-            boost::multi_index::member<Lease, isc::dhcp::SubnetID,
-            &Lease::subnet_id_>
+            boost::multi_index::member<LeaseEntry, isc::dhcp::SubnetID,
+            &LeaseEntry::subnet_id_>
         >,
 
         // Specification of the fifth index starts here
         // This index is used to retrieve leases for matching duid.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<DuidIndexTag>,
-            boost::multi_index::const_mem_fun<Lease6,
-                                              const std::vector<uint8_t>&,
-                                              &Lease6::getDuidVector>
+            boost::multi_index::const_mem_fun<Lease6Entry, BytesRef,
+                                              &Lease6Entry::getDuidKey>
         >,
 
         // Specification of the sixth index starts here
         // This index is used to retrieve leases for matching hostname.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<HostnameIndexTag>,
-            boost::multi_index::member<Lease, std::string, &Lease::hostname_>
+            boost::multi_index::const_mem_fun<LeaseEntry, const std::string&,
+                                              &LeaseEntry::getHostname>
         >
     >
 > Lease6Storage; // Specify the type name of this container.
@@ -153,39 +158,41 @@ typedef boost::multi_index_container<
 /// Indexes can be accessed using the index number (from 0 to 4) or a
 /// name tag. It is recommended to use the tags to access indexes as
 /// they do not depend on the order of indexes in the container.
+///
+/// The container holds compact entries (see @ref LeaseEntry) from which
+/// the Lease4 objects are materialized by the lease manager.
 typedef boost::multi_index_container<
-    // It holds pointers to Lease4 objects.
-    Lease4Ptr,
+    // It holds compact lease entries.
+    Lease4Entry,
     // Specification of search indexes starts here.
     boost::multi_index::indexed_by<
         // Specification of the first index starts here.
         // This index sorts leases by IPv4 addresses represented as
-        // IOAddress objects.
+        // integers (see Lease4Entry::addressKey).
         boost::multi_index::ordered_unique<
             boost::multi_index::tag<AddressIndexTag>,
-            // The IPv4 address are held in addr_ members that belong to
-            // Lease class.
-            boost::multi_index::member<Lease, isc::asiolink::IOAddress, &Lease::addr_>
+            // The IPv4 address are held in addr_ members of the entries.
+            boost::multi_index::member<Lease4Entry, Lease4Entry::AddressKey,
+                                       &Lease4Entry::addr_>
         >,
 
         // Specification of the second index starts here.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<HWAddressSubnetIdIndexTag>,
             // This is a composite index that combines two attributes of the
-            // Lease4 object: hardware address and subnet id.
+            // entry: hardware address and subnet id.
             boost::multi_index::composite_key<
-                Lease4,
-                // The hardware address is held in the hwaddr_ member of the
-                // Lease4 object, which is a HWAddr object. Boost does not
-                // provide a key extractor for getting a member of a member,
-                // so we need a simple method for that.
-                boost::multi_index::const_mem_fun<Lease, const std::vector<uint8_t>&,
-                                                  &Lease::getHWAddrVector>,
-                // The subnet id is held in the subnet_id_ member of Lease4
-                // class. Note that the subnet_id_ is defined in the base
-                // class (Lease) so we have to point to this class rather
-                // than derived class: Lease4.
-                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>
+                Lease4Entry,
+                // The hardware address is held inline in the entry, so we
+                // need a simple method returning a reference to it.
+                boost::multi_index::const_mem_fun<LeaseEntry, BytesRef,
+                                                  &LeaseEntry::getHWAddrKey>,
+                // The subnet id is held in the subnet_id_ member of the entry.
+                // Note that the subnet_id_ is defined in the base class
+                // (LeaseEntry) so we have to point to this class rather
+                // than derived class: Lease4Entry.
+                boost::multi_index::member<LeaseEntry, SubnetID,
+                                           &LeaseEntry::subnet_id_>
             >
         >,
 
@@ -195,13 +202,14 @@ typedef boost::multi_index_container<
             // This is a composite index that uses two values to search for a
             // lease: client id and subnet id.
             boost::multi_index::composite_key<
-                Lease4,
-                // The client id can be retrieved from the Lease4 object by
-                // calling getClientIdVector const function.
-                boost::multi_index::const_mem_fun<Lease4, const std::vector<uint8_t>&,
-                                                  &Lease4::getClientIdVector>,
+                Lease4Entry,
+                // The client id can be retrieved from the entry by
+                // calling getClientIdKey const function.
+                boost::multi_index::const_mem_fun<Lease4Entry, BytesRef,
+                                                  &Lease4Entry::getClientIdKey>,
                 // The subnet id is accessed through the subnet_id_ member.
-                boost::multi_index::member<Lease, uint32_t, &Lease::subnet_id_>
+                boost::multi_index::member<LeaseEntry, SubnetID,
+                                           &LeaseEntry::subnet_id_>
             >
         >,
 
@@ -211,19 +219,18 @@ typedef boost::multi_index_container<
             // This is a composite index that uses three values to search for a
             // lease: client id, HW address and subnet id.
             boost::multi_index::composite_key<
-                Lease4,
-                // The client id can be retrieved from the Lease4 object by
-                // calling getClientIdVector const function.
-                boost::multi_index::const_mem_fun<Lease4, const std::vector<uint8_t>&,
-                                                  &Lease4::getClientIdVector>,
-                // The hardware address is held in the hwaddr_ object. We can
-                // access the raw data using lease->hwaddr_->hwaddr_, but Boost
-                // doesn't seem to provide a way to use member of a member for this,
-                // so we need a simple key extractor method (getHWAddrVector).
-                boost::multi_index::const_mem_fun<Lease, const std::vector<uint8_t>&,
-                                                  &Lease::getHWAddrVector>,
+                Lease4Entry,
+                // The client id can be retrieved from the entry by
+                // calling getClientIdKey const function.
+                boost::multi_index::const_mem_fun<Lease4Entry, BytesRef,
+                                                  &Lease4Entry::getClientIdKey>,
+                // The hardware address is held inline in the entry, so we
+                // need a simple key extractor method (getHWAddrKey).
+                boost::multi_index::const_mem_fun<LeaseEntry, BytesRef,
+                                                  &LeaseEntry::getHWAddrKey>,
                 // The subnet id is accessed through the subnet_id_ member.
-                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>
+                boost::multi_index::member<LeaseEntry, SubnetID,
+                                           &LeaseEntry::subnet_id_>
             >
         >,
 
@@ -235,13 +242,13 @@ typedef boost::multi_index_container<
             // of the search key, the reclaimed or not reclaimed leases will can
             // be searched.
             boost::multi_index::composite_key<
-                Lease4,
+                Lease4Entry,
                 // The boolean value specifying if lease is reclaimed or not.
-                boost::multi_index::const_mem_fun<Lease, bool,
-                                                  &Lease::stateExpiredReclaimed>,
+                boost::multi_index::const_mem_fun<LeaseEntry, bool,
+                                                  &LeaseEntry::stateExpiredReclaimed>,
                 // Lease expiration time.
-                boost::multi_index::const_mem_fun<Lease, int64_t,
-                                                  &Lease::getExpirationTime>
+                boost::multi_index::const_mem_fun<LeaseEntry, int64_t,
+                                                  &LeaseEntry::getExpirationTime>
             >
         >,
 
@@ -249,7 +256,8 @@ typedef boost::multi_index_container<
         // This index sorts leases by SubnetID.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<SubnetIdIndexTag>,
-            boost::multi_index::member<Lease, isc::dhcp::SubnetID, &Lease::subnet_id_>
+            boost::multi_index::member<LeaseEntry, isc::dhcp::SubnetID,
+                                       &LeaseEntry::subnet_id_>
         >,
 
 
@@ -257,7 +265,8 @@ typedef boost::multi_index_container<
         // This index is used to retrieve leases for matching hostname.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<HostnameIndexTag>,
-            boost::multi_index::member<Lease, std::string, &Lease::hostname_>
+            boost::multi_index::const_mem_fun<LeaseEntry, const std::string&,
+                                              &LeaseEntry::getHostname>
         >
     >
 > Lease4Storage; // Specify the type name for this container.
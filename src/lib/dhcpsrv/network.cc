@@ -54,6 +54,7 @@ Network::RelayInfo::getAddresses() const {
 void
 Network::addRelayAddress(const asiolink::IOAddress& addr) {
     relay_.addAddress(addr);
+    selectionChanged();
 }
 
 bool
@@ -135,6 +136,29 @@ Network::getGlobalProperty(Optional<IOAddress> property,
     return (property);
 }
 
+void
+Network::resolveProperties() {
+    cached_.iface_name_ = getIface();
+    cached_.client_class_ = getClientClass();
+    cached_.valid_ = getValid();
+    cached_.t1_ = getT1();
+    cached_.t2_ = getT2();
+    cached_.host_reservation_mode_ = getHostReservationMode();
+    cached_.calculate_tee_times_ = getCalculateTeeTimes();
+    cached_.t1_percent_ = getT1Percent();
+    cached_.t2_percent_ = getT2Percent();
+    cached_.ddns_send_updates_ = getDdnsSendUpdates();
+    cached_.ddns_override_no_update_ = getDdnsOverrideNoUpdate();
+    cached_.ddns_override_client_update_ = getDdnsOverrideClientUpdate();
+    cached_.ddns_replace_client_name_mode_ = getDdnsReplaceClientNameMode();
+    cached_.ddns_generated_prefix_ = getDdnsGeneratedPrefix();
+    cached_.ddns_qualifying_suffix_ = getDdnsQualifyingSuffix();
+    cached_.hostname_char_set_ = getHostnameCharSet();
+    cached_.hostname_char_replacement_ = getHostnameCharReplacement();
+    cached_.store_extended_info_ = getStoreExtendedInfo();
+    cached_.allocator_type_ = getAllocatorType();
+}
+
 ElementPtr
 Network::toElement() const {
     ElementPtr map = Element::createMap();
@@ -280,6 +304,10 @@ Network::toElement() const {
         map->set("store-extended-info", Element::create(store_extended_info_));
     }
 
+    if (!allocator_type_.unspecified()) {
+        map->set("allocator", Element::create(allocator_type_));
+    }
+
     return (map);
 }
 
@@ -290,16 +318,29 @@ Network4::setSiaddr(const Optional<IOAddress>& siaddr) {
                   << siaddr);
     }
     siaddr_ = siaddr;
+    propertiesChanged();
 }
 
 void
 Network4::setSname(const Optional<std::string>& sname) {
     sname_ = sname;
+    propertiesChanged();
 }
 
 void
 Network4::setFilename(const Optional<std::string>& filename) {
     filename_ = filename;
+    propertiesChanged();
+}
+
+void
+Network4::resolveProperties() {
+    Network::resolveProperties();
+    cached4_.match_client_id_ = getMatchClientId();
+    cached4_.authoritative_ = getAuthoritative();
+    cached4_.siaddr_ = getSiaddr();
+    cached4_.sname_ = getSname();
+    cached4_.filename_ = getFilename();
 }
 
 ElementPtr
@@ -349,6 +390,14 @@ Network4::getServerId() const {
     return (IOAddress::IPV4_ZERO_ADDRESS());
 }
 
+void
+Network6::resolveProperties() {
+    Network::resolveProperties();
+    cached6_.preferred_ = getPreferred();
+    cached6_.interface_id_ = getInterfaceId();
+    cached6_.rapid_commit_ = getRapidCommit();
+}
+
 ElementPtr
 Network6::toElement() const {
     ElementPtr map = Network::toElement();
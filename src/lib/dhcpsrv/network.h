@@ -21,6 +21,7 @@
 #include <util/optional.h>
 #include <boost/shared_ptr.hpp>
 #include <boost/weak_ptr.hpp>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -43,6 +44,10 @@ typedef boost::weak_ptr<Network> WeakNetworkPtr;
 /// configured parameters.
 typedef std::function<data::ConstElementPtr()> FetchNetworkGlobalsFn;
 
+/// @brief Pointer to the flag raised when the subnet selection parameters
+/// of a @c Network change.
+typedef boost::shared_ptr<std::atomic<bool> > SelectionChangedFlagPtr;
+
 /// @brief Common interface representing a network to which the DHCP clients
 /// are connected.
 ///
@@ -207,7 +212,9 @@ public:
           calculate_tee_times_(), t1_percent_(), t2_percent_(),
           ddns_send_updates_(), ddns_override_no_update_(), ddns_override_client_update_(),
           ddns_replace_client_name_mode_(), ddns_generated_prefix_(), ddns_qualifying_suffix_(),
-          hostname_char_set_(), hostname_char_replacement_(), store_extended_info_() {
+          hostname_char_set_(), hostname_char_replacement_(), store_extended_info_(),
+          allocator_type_(), cached_(), properties_cached_(false),
+          selection_changed_() {
     }
 
     /// @brief Virtual destructor.
@@ -221,6 +228,7 @@ public:
     /// @param fetch_globals_fn Pointer to the function.
     void setFetchGlobalsFn(FetchNetworkGlobalsFn fetch_globals_fn) {
         fetch_globals_fn_ = fetch_globals_fn;
+        propertiesChanged();
     }
 
     /// @brief Checks if the network is associated with a function used to
@@ -231,6 +239,67 @@ public:
         return (static_cast<bool>(fetch_globals_fn_));
     }
 
+    /// @brief Invalidates the cached inherited parameters.
+    ///
+    /// This is called when a parameter of the network is modified, when
+    /// the network is assigned to another shared network, and by the
+    /// @ref SrvConfig holding the network when its global parameters
+    /// change. The accessors then resolve the parameters again until
+    /// @ref cacheProperties is called. Only this network is invalidated,
+    /// so as modifying a staging configuration leaves the parameters
+    /// cached by the current configuration untouched. Shared networks
+    /// override this to invalidate their subnets too.
+    virtual void propertiesChanged() {
+        properties_cached_ = false;
+    }
+
+    /// @brief Resolves the inherited parameters and caches them.
+    ///
+    /// Each parameter is resolved using the inheritance from the parent
+    /// network and the global parameters. The accessors called with the
+    /// @c Inheritance::ALL mode return the cached values until
+    /// @ref propertiesChanged is called, so as they don't walk the parent
+    /// network and fetch the global parameters each time a packet is
+    /// processed. This is called when a configuration is committed.
+    void cacheProperties() {
+        properties_cached_ = false;
+        resolveProperties();
+        properties_cached_ = true;
+    }
+
+    /// @brief Checks if the accessors return cached parameters.
+    ///
+    /// @return true if the parameters cached by @ref cacheProperties
+    /// are still valid, false otherwise.
+    bool hasCachedProperties() const {
+        return (properties_cached_);
+    }
+
+    /// @brief Sets the flag raised when the subnet selection parameters
+    /// of the network change.
+    ///
+    /// The flag is shared with the @ref CfgSubnets4 or @ref CfgSubnets6
+    /// object holding the subnet, which rebuilds its subnet selection
+    /// index on the next lookup once the flag is raised.
+    ///
+    /// @param flag Pointer to the flag.
+    void setSelectionChangedFlag(const SelectionChangedFlagPtr& flag) {
+        selection_changed_ = flag;
+    }
+
+    /// @brief Raises the flag of the subnet selection parameters.
+    ///
+    /// This is called when the interface name, the relay addresses or the
+    /// interface-id of the network are modified, or when the network is
+    /// assigned to another shared network. Only the configuration holding
+    /// the network is affected. Shared networks override this to raise the
+    /// flags of their subnets.
+    virtual void selectionChanged() {
+        if (selection_changed_) {
+            selection_changed_->store(true);
+        }
+    }
+
     /// @brief Sets local name of the interface for which this network is
     /// selected.
     ///
@@ -241,6 +310,8 @@ public:
     /// @param iface_name Interface name.
     void setIface(const util::Optional<std::string>& iface_name) {
         iface_name_ = iface_name;
+        propertiesChanged();
+        selectionChanged();
     }
 
     /// @brief Returns name of the local interface for which this network is
@@ -250,6 +321,9 @@ public:
     /// @return Interface name as text.
     util::Optional<std::string>
     getIface(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.iface_name_);
+        }
         return (getProperty<Network>(&Network::getIface, iface_name_,
                                      inheritance, "interface"));
     };
@@ -275,6 +349,7 @@ public:
     /// @param relay structure that contains relay information
     void setRelayInfo(const RelayInfo& relay) {
         relay_ = relay;
+        selectionChanged();
     }
 
     /// @brief Returns const reference to relay information
@@ -348,6 +423,9 @@ public:
     /// @return client class @ref client_class_
     util::Optional<ClientClass>
     getClientClass(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.client_class_);
+        }
         return (getProperty<Network>(&Network::getClientClass, client_class_,
                                      inheritance));
     }
@@ -356,6 +434,9 @@ public:
     ///
     /// @param inheritance inheritance mode to be used.
     Triplet<uint32_t> getValid(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.valid_);
+        }
         return (getProperty<Network>(&Network::getValid, valid_, inheritance,
                                      "valid-lifetime"));
     }
@@ -365,12 +446,16 @@ public:
     /// @param valid New valid lifetime in seconds.
     void setValid(const Triplet<uint32_t>& valid) {
         valid_ = valid;
+        propertiesChanged();
     }
 
     /// @brief Returns T1 (renew timer), expressed in seconds
     ///
     /// @param inheritance inheritance mode to be used.
     Triplet<uint32_t> getT1(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.t1_);
+        }
         return (getProperty<Network>(&Network::getT1, t1_, inheritance, "renew-timer"));
     }
 
@@ -379,12 +464,16 @@ public:
     /// @param t1 New renew timer value in seconds.
     void setT1(const Triplet<uint32_t>& t1) {
         t1_ = t1;
+        propertiesChanged();
     }
 
     /// @brief Returns T2 (rebind timer), expressed in seconds
     ///
     /// @param inheritance inheritance mode to be used.
     Triplet<uint32_t> getT2(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.t2_);
+        }
         return (getProperty<Network>(&Network::getT2, t2_, inheritance, "rebind-timer"));
     }
 
@@ -393,6 +482,7 @@ public:
     /// @param t2 New rebind timer value in seconds.
     void setT2(const Triplet<uint32_t>& t2) {
         t2_ = t2;
+        propertiesChanged();
     }
 
     /// @brief Specifies what type of Host Reservations are supported.
@@ -406,6 +496,9 @@ public:
     /// @return Host reservation mode enabled.
     util::Optional<HRMode>
     getHostReservationMode(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.host_reservation_mode_);
+        }
         // Inheritance for host reservations is a little different than for other
         // parameters. The reservation at the global level is given as a string.
         // Thus we call getProperty here without a global name to check if the
@@ -446,6 +539,7 @@ public:
     /// @param mode mode to be set
     void setHostReservationMode(const util::Optional<HRMode>& mode) {
         host_reservation_mode_ = mode;
+        propertiesChanged();
     }
 
     /// @brief Attempts to convert text representation to HRMode enum.
@@ -476,6 +570,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<bool>
     getCalculateTeeTimes(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.calculate_tee_times_);
+        }
         return (getProperty<Network>(&Network::getCalculateTeeTimes,
                                      calculate_tee_times_,
                                      inheritance,
@@ -487,6 +584,7 @@ public:
     /// @param calculate_tee_times new value of enabled/disabled.
     void setCalculateTeeTimes(const util::Optional<bool>& calculate_tee_times) {
         calculate_tee_times_ = calculate_tee_times;
+        propertiesChanged();
     }
 
     /// @brief Returns percentage to use when calculating the T1 (renew timer).
@@ -494,6 +592,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<double>
     getT1Percent(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.t1_percent_);
+        }
         return (getProperty<Network>(&Network::getT1Percent, t1_percent_,
                                      inheritance, "t1-percent"));
     }
@@ -503,6 +604,7 @@ public:
     /// @param t1_percent New percentage to use.
     void setT1Percent(const util::Optional<double>& t1_percent) {
         t1_percent_ = t1_percent;
+        propertiesChanged();
     }
 
     /// @brief Returns percentage to use when calculating the T2 (rebind timer).
@@ -510,6 +612,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<double>
     getT2Percent(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.t2_percent_);
+        }
         return (getProperty<Network>(&Network::getT2Percent, t2_percent_,
                                      inheritance, "t2-percent"));
     }
@@ -519,6 +624,7 @@ public:
     /// @param t2_percent New percentage to use.
     void setT2Percent(const util::Optional<double>& t2_percent) {
         t2_percent_ = t2_percent;
+        propertiesChanged();
     }
 
     /// @brief Returns ddns-send-updates
@@ -526,6 +632,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<bool>
     getDdnsSendUpdates(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.ddns_send_updates_);
+        }
         return (getProperty<Network>(&Network::getDdnsSendUpdates, ddns_send_updates_,
                                      inheritance, "ddns-send-updates"));
     }
@@ -535,6 +644,7 @@ public:
     /// @param ddns_send_updates New value to use.
     void setDdnsSendUpdates(const util::Optional<bool>& ddns_send_updates) {
         ddns_send_updates_ = ddns_send_updates;
+        propertiesChanged();
     }
 
     /// @brief Returns ddns-override-no-update
@@ -542,6 +652,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<bool>
     getDdnsOverrideNoUpdate(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.ddns_override_no_update_);
+        }
         return (getProperty<Network>(&Network::getDdnsOverrideNoUpdate,
                                      ddns_override_no_update_,
                                      inheritance, "ddns-override-no-update"));
@@ -552,6 +665,7 @@ public:
     /// @param ddns_override_no_update New value to use.
     void setDdnsOverrideNoUpdate(const util::Optional<bool>& ddns_override_no_update) {
         ddns_override_no_update_ = ddns_override_no_update;
+        propertiesChanged();
     }
 
     /// @brief Returns ddns-overridie-client-update
@@ -559,6 +673,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<bool>
     getDdnsOverrideClientUpdate(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.ddns_override_client_update_);
+        }
         return (getProperty<Network>(&Network::getDdnsOverrideClientUpdate,
                                      ddns_override_client_update_,
                                      inheritance, "ddns-override-client-update"));
@@ -570,6 +687,7 @@ public:
     void setDdnsOverrideClientUpdate(const util::Optional<bool>&
                                      ddns_override_client_update) {
         ddns_override_client_update_ = ddns_override_client_update;
+        propertiesChanged();
     }
 
     /// @brief Returns ddns-replace-client-name-mode
@@ -577,6 +695,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<D2ClientConfig::ReplaceClientNameMode>
     getDdnsReplaceClientNameMode(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.ddns_replace_client_name_mode_);
+        }
         // Inheritance for ddns-replace-client-name is a little different than for other
         // parameters. The value at the global level is given as a string.
         // Thus we call getProperty here without a global name to check if it
@@ -615,6 +736,7 @@ public:
     setDdnsReplaceClientNameMode(const util::Optional<D2ClientConfig::ReplaceClientNameMode>&
                                  ddns_replace_client_name_mode) {
         ddns_replace_client_name_mode_ = ddns_replace_client_name_mode;
+        propertiesChanged();
     }
 
     /// @brief Returns ddns-generated-prefix
@@ -622,6 +744,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<std::string>
     getDdnsGeneratedPrefix(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.ddns_generated_prefix_);
+        }
         return (getProperty<Network>(&Network::getDdnsGeneratedPrefix,
                                      ddns_generated_prefix_,
                                      inheritance, "ddns-generated-prefix"));
@@ -632,6 +757,7 @@ public:
     /// @param ddns_generated_prefix New value to use.
     void setDdnsGeneratedPrefix(const util::Optional<std::string>& ddns_generated_prefix) {
         ddns_generated_prefix_ = ddns_generated_prefix;
+        propertiesChanged();
     }
 
     /// @brief Returns ddns-qualifying-suffix
@@ -639,6 +765,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<std::string>
     getDdnsQualifyingSuffix(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.ddns_qualifying_suffix_);
+        }
         return (getProperty<Network>(&Network::getDdnsQualifyingSuffix,
                                      ddns_qualifying_suffix_,
                                      inheritance, "ddns-qualifying-suffix"));
@@ -649,11 +778,15 @@ public:
     /// @param ddns_qualifying_suffix New value to use.
     void setDdnsQualifyingSuffix(const util::Optional<std::string>& ddns_qualifying_suffix) {
         ddns_qualifying_suffix_ = ddns_qualifying_suffix;
+        propertiesChanged();
     }
 
     /// @brief Return the char set regexp used to sanitize client hostnames.
     util::Optional<std::string>
     getHostnameCharSet(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.hostname_char_set_);
+        }
         return (getProperty<Network>(&Network::getHostnameCharSet, hostname_char_set_,
                                      inheritance, "hostname-char-set"));
     }
@@ -663,11 +796,15 @@ public:
     /// @param hostname_char_set New value to use.
     void setHostnameCharSet(const util::Optional<std::string>& hostname_char_set) {
         hostname_char_set_ = hostname_char_set;
+        propertiesChanged();
     }
 
     /// @brief Return the invalid char replacement used to sanitize client hostnames.
     util::Optional<std::string>
     getHostnameCharReplacement(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.hostname_char_replacement_);
+        }
         return (getProperty<Network>(&Network::getHostnameCharReplacement,
                                      hostname_char_replacement_,
                                      inheritance, "hostname-char-replacement"));
@@ -679,6 +816,7 @@ public:
     void setHostnameCharReplacement(const util::Optional<std::string>&
                                     hostname_char_replacement) {
         hostname_char_replacement_ = hostname_char_replacement;
+        propertiesChanged();
     }
 
     /// @brief Returns store-extended-info
@@ -686,6 +824,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     util::Optional<bool>
     getStoreExtendedInfo(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.store_extended_info_);
+        }
         return (getProperty<Network>(&Network::getStoreExtendedInfo,
                                      store_extended_info_,
                                      inheritance, "store-extended-info"));
@@ -696,6 +837,33 @@ public:
     /// @param store-extended-info New value to use.
     void setStoreExtendedInfo(const util::Optional<bool>& store_extended_info) {
         store_extended_info_ = store_extended_info;
+        propertiesChanged();
+    }
+
+    /// @brief Returns allocator type.
+    ///
+    /// The allocator type selects the algorithm the allocation engine
+    /// uses to pick addresses and prefixes from the pools of the network:
+    /// "iterative", "hashed" or "random". When it is unspecified the
+    /// allocation engine default is used.
+    ///
+    /// @param inheritance inheritance mode to be used.
+    util::Optional<std::string>
+    getAllocatorType(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached_.allocator_type_);
+        }
+        return (getProperty<Network>(&Network::getAllocatorType,
+                                     allocator_type_,
+                                     inheritance, "allocator"));
+    }
+
+    /// @brief Sets new allocator type.
+    ///
+    /// @param allocator_type New value to use.
+    void setAllocatorType(const util::Optional<std::string>& allocator_type) {
+        allocator_type_ = allocator_type;
+        propertiesChanged();
     }
 
     /// @brief Unparses network object.
@@ -705,6 +873,19 @@ public:
 
 protected:
 
+    /// @brief Resolves the inherited parameters into the cache.
+    ///
+    /// Derived classes override this to resolve their own parameters.
+    virtual void resolveProperties();
+
+    /// @brief Checks if an accessor returns a cached parameter.
+    ///
+    /// @param inheritance inheritance mode used by the accessor.
+    /// @return true if the cached parameter must be returned.
+    bool useCachedProperties(const Inheritance& inheritance) const {
+        return ((inheritance == Inheritance::ALL) && hasCachedProperties());
+    }
+
     /// @brief Gets the optional callback function used to fetch globally
     /// configured parameters.
     ///
@@ -992,6 +1173,9 @@ protected:
     /// on the lease.
     util::Optional<bool> store_extended_info_;
 
+    /// @brief Allocator used to pick addresses and prefixes from the pools.
+    util::Optional<std::string> allocator_type_;
+
     /// @brief Pointer to another network that this network belongs to.
     ///
     /// The most common case is that this instance is a subnet which belongs
@@ -1003,6 +1187,75 @@ protected:
     /// @brief Pointer to the optional callback used to fetch globally
     /// configured parameters inherited to the @c Network object.
     FetchNetworkGlobalsFn fetch_globals_fn_;
+
+    /// @brief Inherited parameters resolved by @ref cacheProperties.
+    struct CachedProperties {
+        /// @brief Interface name.
+        util::Optional<std::string> iface_name_;
+
+        /// @brief Client class.
+        util::Optional<ClientClass> client_class_;
+
+        /// @brief Valid lifetime.
+        Triplet<uint32_t> valid_;
+
+        /// @brief Renew timer.
+        Triplet<uint32_t> t1_;
+
+        /// @brief Rebind timer.
+        Triplet<uint32_t> t2_;
+
+        /// @brief Host reservation mode.
+        util::Optional<HRMode> host_reservation_mode_;
+
+        /// @brief Enables the calculation of T1 and T2 timers.
+        util::Optional<bool> calculate_tee_times_;
+
+        /// @brief Percentage used to calculate the T1 timer.
+        util::Optional<double> t1_percent_;
+
+        /// @brief Percentage used to calculate the T2 timer.
+        util::Optional<double> t2_percent_;
+
+        /// @brief ddns-send-updates.
+        util::Optional<bool> ddns_send_updates_;
+
+        /// @brief ddns-override-no-update.
+        util::Optional<bool> ddns_override_no_update_;
+
+        /// @brief ddns-override-client-update.
+        util::Optional<bool> ddns_override_client_update_;
+
+        /// @brief ddns-replace-client-name.
+        util::Optional<D2ClientConfig::ReplaceClientNameMode> ddns_replace_client_name_mode_;
+
+        /// @brief ddns-generated-prefix.
+        util::Optional<std::string> ddns_generated_prefix_;
+
+        /// @brief ddns-qualifying-suffix.
+        util::Optional<std::string> ddns_qualifying_suffix_;
+
+        /// @brief hostname-char-set.
+        util::Optional<std::string> hostname_char_set_;
+
+        /// @brief hostname-char-replacement.
+        util::Optional<std::string> hostname_char_replacement_;
+
+        /// @brief store-extended-info.
+        util::Optional<bool> store_extended_info_;
+
+        /// @brief Allocator type.
+        util::Optional<std::string> allocator_type_;
+    };
+
+    /// @brief The cached inherited parameters.
+    CachedProperties cached_;
+
+    /// @brief Indicates if the cached inherited parameters are valid.
+    bool properties_cached_;
+
+    /// @brief The flag raised when the subnet selection parameters change.
+    SelectionChangedFlagPtr selection_changed_;
 };
 
 /// @brief Specialization of the @ref Network object for DHCPv4 case.
@@ -1022,6 +1275,9 @@ public:
     /// @return true if client identifiers should be used, false otherwise.
     util::Optional<bool>
     getMatchClientId(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached4_.match_client_id_);
+        }
         return (getProperty<Network4>(&Network4::getMatchClientId,
                                       match_client_id_,
                                       inheritance,
@@ -1035,6 +1291,7 @@ public:
     /// used for lease lookup.
     void setMatchClientId(const util::Optional<bool>& match) {
         match_client_id_ = match;
+        propertiesChanged();
     }
 
     /// @brief Returns the flag indicating if requests for unknown IP addresses
@@ -1045,6 +1302,9 @@ public:
     /// false otherwise.
     util::Optional<bool>
     getAuthoritative(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached4_.authoritative_);
+        }
         return (getProperty<Network4>(&Network4::getAuthoritative, authoritative_,
                                       inheritance, "authoritative"));
     }
@@ -1056,6 +1316,7 @@ public:
     /// addresses will be rejected with DHCPNAK messages
     void setAuthoritative(const util::Optional<bool>& authoritative) {
         authoritative_ = authoritative;
+        propertiesChanged();
     }
 
     /// @brief Sets siaddr for the network.
@@ -1070,6 +1331,9 @@ public:
     /// @return siaddr value
     util::Optional<asiolink::IOAddress>
     getSiaddr(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached4_.siaddr_);
+        }
         return (getProperty<Network4>(&Network4::getSiaddr, siaddr_,
                                       inheritance, "next-server"));
     }
@@ -1085,6 +1349,9 @@ public:
     /// @return server hostname value
     util::Optional<std::string>
     getSname(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached4_.sname_);
+        }
         return (getProperty<Network4>(&Network4::getSname, sname_,
                                       inheritance, "server-hostname"));
     }
@@ -1100,6 +1367,9 @@ public:
     /// @return boot file name value
     util::Optional<std::string>
     getFilename(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached4_.filename_);
+        }
         return (getProperty<Network4>(&Network4::getFilename, filename_,
                                       inheritance, "boot-file-name"));
     }
@@ -1115,8 +1385,40 @@ public:
     /// indicates that server identifier hasn't been specified.
     virtual asiolink::IOAddress getServerId() const;
 
+protected:
+
+    /// @brief Resolves the inherited parameters into the cache.
+    virtual void resolveProperties();
+
 private:
 
+    /// @brief Inherited DHCPv4 parameters resolved by @ref cacheProperties.
+    struct CachedProperties4 {
+        /// @brief Constructor.
+        CachedProperties4()
+            : match_client_id_(), authoritative_(), siaddr_(), sname_(),
+              filename_() {
+        }
+
+        /// @brief match-client-id.
+        util::Optional<bool> match_client_id_;
+
+        /// @brief authoritative.
+        util::Optional<bool> authoritative_;
+
+        /// @brief next-server.
+        util::Optional<asiolink::IOAddress> siaddr_;
+
+        /// @brief server-hostname.
+        util::Optional<std::string> sname_;
+
+        /// @brief boot-file-name.
+        util::Optional<std::string> filename_;
+    };
+
+    /// @brief The cached inherited DHCPv4 parameters.
+    CachedProperties4 cached4_;
+
     /// @brief Should server use client identifiers for client lease
     /// lookup.
     util::Optional<bool> match_client_id_;
@@ -1149,6 +1451,9 @@ public:
     /// @return a triplet with preferred lifetime
     Triplet<uint32_t>
     getPreferred(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached6_.preferred_);
+        }
         return (getProperty<Network6>(&Network6::getPreferred, preferred_,
                                       inheritance, "preferred-lifetime"));
     }
@@ -1158,6 +1463,7 @@ public:
     /// @param preferred New preferred lifetime in seconds.
     void setPreferred(const Triplet<uint32_t>& preferred) {
         preferred_ = preferred;
+        propertiesChanged();
     }
 
     /// @brief Returns interface-id value (if specified)
@@ -1165,6 +1471,9 @@ public:
     /// @param inheritance inheritance mode to be used.
     /// @return interface-id option (if defined)
     OptionPtr getInterfaceId(const Inheritance& inheritance = Inheritance::ALL) const {
+        if (useCachedProperties(inheritance)) {
+            return (cached6_.interface_id_);
+        }
         return (getOptionProperty<Network6>(&Network6::getInterfaceId, interface_id_,
                                             inheritance));
     }
@@ -1174,6 +1483,8 @@ public:
     /// @param ifaceid pointer to interface-id option
     void setInterfaceId(const OptionPtr& ifaceid) {
         interface_id_ = ifaceid;
+        propertiesChanged();
+        selectionChanged();
     }
 
     /// @brief Returns boolean value indicating that the Rapid Commit option
@@ -1183,7 +1494,9 @@ public:
     /// @return true if the Rapid Commit option is supported, false otherwise.
     util::Optional<bool>
     getRapidCommit(const Inheritance& inheritance = Inheritance::ALL) const {
-
+        if (useCachedProperties(inheritance)) {
+            return (cached6_.rapid_commit_);
+        }
         return (getProperty<Network6>(&Network6::getRapidCommit, rapid_commit_,
                                       inheritance, "rapid-commit"));
     }
@@ -1194,6 +1507,7 @@ public:
     /// option support is enabled (if true), or disabled (if false).
     void setRapidCommit(const util::Optional<bool>& rapid_commit) {
         rapid_commit_ = rapid_commit;
+        propertiesChanged();
     };
 
     /// @brief Unparses network object.
@@ -1201,8 +1515,28 @@ public:
     /// @return A pointer to unparsed network configuration.
     virtual data::ElementPtr toElement() const;
 
+protected:
+
+    /// @brief Resolves the inherited parameters into the cache.
+    virtual void resolveProperties();
+
 private:
 
+    /// @brief Inherited DHCPv6 parameters resolved by @ref cacheProperties.
+    struct CachedProperties6 {
+        /// @brief Preferred lifetime.
+        Triplet<uint32_t> preferred_;
+
+        /// @brief interface-id option.
+        OptionPtr interface_id_;
+
+        /// @brief rapid-commit.
+        util::Optional<bool> rapid_commit_;
+    };
+
+    /// @brief The cached inherited DHCPv6 parameters.
+    CachedProperties6 cached6_;
+
     /// @brief a triplet with preferred lifetime (in seconds)
     Triplet<uint32_t> preferred_;
 
@@ -5,6 +5,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/triplet.h>
 #include <dhcpsrv/parsers/base_network_parser.h>
 #include <util/optional.h>
@@ -114,6 +115,18 @@ BaseNetworkParser::parseCommon(const ConstElementPtr& network_data,
         network->setStoreExtendedInfo(getBoolean(network_data,
                                                  "store-extended-info"));
     }
+
+    if (network_data->contains("allocator")) {
+        std::string allocator_type = getString(network_data, "allocator");
+        try {
+            // Only check the value: the allocation engine does the mapping.
+            AllocEngine::allocTypeFromText(allocator_type);
+        } catch (const std::exception& ex) {
+            isc_throw(DhcpConfigError, ex.what() << " ("
+                      << getPosition("allocator", network_data) << ")");
+        }
+        network->setAllocatorType(allocator_type);
+    }
 }
 
 void
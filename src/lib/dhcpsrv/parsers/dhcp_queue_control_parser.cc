@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <cc/data.h>
+#include <dhcp/iface_mgr.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/parsers/dhcp_queue_control_parser.h>
@@ -41,6 +42,24 @@ DHCPQueueControlParser::parse(const isc::data::ConstElementPtr& control_elem) {
         }
     }
 
+    // The receiver-threads entry handled by the IfaceMgr is checked now
+    // so as a bad value is rejected by config-test rather than at commit.
+    ConstElementPtr elem = control_elem->get("receiver-threads");
+    if (elem) {
+        if (elem->getType() != Element::integer) {
+            isc_throw(DhcpConfigError, "receiver-threads must be an integer ("
+                      << elem->getPosition() << ")");
+        }
+        int64_t value = elem->intValue();
+        if ((value < 1) ||
+            (value > static_cast<int64_t>(IfaceMgr::MAX_RECEIVER_THREADS))) {
+            isc_throw(DhcpConfigError, "invalid receiver-threads " << value
+                      << ", it must be between 1 and "
+                      << IfaceMgr::MAX_RECEIVER_THREADS << " ("
+                      << elem->getPosition() << ")");
+        }
+    }
+
     // Return a copy of it.
     return (data::copy(control_elem));
 }
@@ -22,8 +22,9 @@ namespace dhcp {
 /// 'dhcp-queue-control' is mostly treated as a map of arbitrary values.
 /// There is only mandatory value, 'enable-queue', which enables/disables
 /// DHCP packet queueing.  If this value is true, then the content must
-/// also include a value for 'queue-type'.  Beyond these values, the
-/// map may contain any combination of valid JSON elements.
+/// also include a value for 'queue-type'.  The optional 'receiver-threads'
+/// value, used by the @c IfaceMgr, is validated too.  Beyond these values,
+/// the map may contain any combination of valid JSON elements.
 ///
 /// Unlike most other parsers, this parser primarily serves to validate
 /// the aforementioned rules, and rather than instantiate an object as
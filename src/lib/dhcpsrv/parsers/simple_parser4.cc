@@ -84,6 +84,9 @@ const SimpleKeywords SimpleParser4::GLOBAL4_PARAMETERS = {
     { "ddns-generated-prefix",          Element::string },
     { "ddns-qualifying-suffix",         Element::string },
     { "store-extended-info",            Element::boolean },
+    { "allocator",                      Element::string },
+    { "free-lease-index",               Element::boolean },
+    { "option-arena",                   Element::boolean },
     { "statistic-default-sample-count", Element::integer },
     { "statistic-default-sample-age",   Element::integer },
     { "multi-threading",                Element::map }
@@ -222,6 +225,7 @@ const SimpleKeywords SimpleParser4::SUBNET4_PARAMETERS = {
     { "hostname-char-set",              Element::string },
     { "hostname-char-replacement",      Element::string },
     { "store-extended-info",            Element::boolean },
+    { "allocator",                      Element::string },
     { "metadata",                       Element::map }
 };
 
@@ -329,6 +333,7 @@ const SimpleKeywords SimpleParser4::SHARED_NETWORK4_PARAMETERS = {
     { "hostname-char-set",              Element::string },
     { "hostname-char-replacement",      Element::string },
     { "store-extended-info",            Element::boolean },
+    { "allocator",                      Element::string },
     { "metadata",                       Element::map }
 };
 
@@ -85,6 +85,9 @@ const SimpleKeywords SimpleParser6::GLOBAL6_PARAMETERS = {
     { "ddns-generated-prefix",          Element::string },
     { "ddns-qualifying-suffix",         Element::string },
     { "store-extended-info",            Element::boolean },
+    { "allocator",                      Element::string },
+    { "free-lease-index",               Element::boolean },
+    { "option-arena",                   Element::boolean },
     { "statistic-default-sample-count", Element::integer },
     { "statistic-default-sample-age",   Element::integer },
     { "multi-threading",                Element::map }
@@ -216,6 +219,7 @@ const SimpleKeywords SimpleParser6::SUBNET6_PARAMETERS = {
     { "hostname-char-set",              Element::string },
     { "hostname-char-replacement",      Element::string },
     { "store-extended-info",            Element::boolean },
+    { "allocator",                      Element::string },
     { "metadata",                       Element::map }
 };
 
@@ -342,6 +346,7 @@ const SimpleKeywords SimpleParser6::SHARED_NETWORK6_PARAMETERS = {
     { "hostname-char-set",              Element::string },
     { "hostname-char-replacement",      Element::string },
     { "store-extended-info",            Element::boolean },
+    { "allocator",                      Element::string },
     { "metadata",                       Element::map }
 };
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -15,6 +15,7 @@
 #include <cc/user_context.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/lease.h>
+#include <dhcpsrv/pool_free_lease_index.h>
 #include <boost/shared_ptr.hpp>
 
 #include <vector>
@@ -22,6 +23,22 @@
 namespace isc {
 namespace dhcp {
 
+/// @brief Base class for the allocation state kept in a pool
+///
+/// Allocators which need per pool information (e.g. the set of free
+/// addresses) derive their state from this class and store it in the pool.
+/// The state is dropped with the pool on reconfiguration.
+class PoolAllocationState {
+public:
+
+    /// @brief Virtual destructor
+    virtual ~PoolAllocationState() {
+    }
+};
+
+/// @brief Type of the pointer to a pool allocation state
+typedef boost::shared_ptr<PoolAllocationState> PoolAllocationStatePtr;
+
 /// @brief base class for Pool4 and Pool6
 ///
 /// Stores information about pool of IPv4 or IPv6 addresses.
@@ -161,6 +178,34 @@ public:
         last_allocated_valid_ = false;
     }
 
+    /// @brief Returns the allocation state of the pool
+    ///
+    /// @return the allocation state or null when none was set
+    PoolAllocationStatePtr getAllocationState() const {
+        return (allocation_state_);
+    }
+
+    /// @brief Sets the allocation state of the pool
+    ///
+    /// @param state the new allocation state
+    void setAllocationState(const PoolAllocationStatePtr& state) {
+        allocation_state_ = state;
+    }
+
+    /// @brief Returns the index of the free addresses of the pool
+    ///
+    /// @return the index or null when it was not built
+    PoolFreeLeaseIndexPtr getFreeLeaseIndex() const {
+        return (free_lease_index_);
+    }
+
+    /// @brief Sets the index of the free addresses of the pool
+    ///
+    /// @param index the new index (null to disable it)
+    void setFreeLeaseIndex(const PoolFreeLeaseIndexPtr& index) {
+        free_lease_index_ = index;
+    }
+
     /// @brief Unparse a pool object.
     ///
     /// @return A pointer to unparsed pool configuration.
@@ -234,6 +279,12 @@ protected:
 
     /// @brief Status of last allocated address
     bool last_allocated_valid_;
+
+    /// @brief Allocation state kept by the allocator serving the pool
+    PoolAllocationStatePtr allocation_state_;
+
+    /// @brief Index of the free addresses, shared by all the allocators
+    PoolFreeLeaseIndexPtr free_lease_index_;
 };
 
 class Pool4;
@@ -0,0 +1,105 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/pool_free_bitmap.h>
+#include <exceptions/exceptions.h>
+
+namespace {
+
+/// @brief Number of bits in a bitmap word.
+const uint64_t WORD_BITS = 64;
+
+/// @brief Word with all bits set.
+const uint64_t ALL_USED = ~static_cast<uint64_t>(0);
+
+}
+
+namespace isc {
+namespace dhcp {
+
+PoolFreeBitmap::PoolFreeBitmap(uint64_t capacity)
+    : bits_((capacity + WORD_BITS - 1) / WORD_BITS, 0),
+      capacity_(capacity), free_count_(capacity) {
+    // Mark the padding bits as used.
+    uint64_t tail = capacity % WORD_BITS;
+    if (tail != 0) {
+        bits_.back() = ALL_USED << tail;
+    }
+}
+
+void
+PoolFreeBitmap::checkOffset(uint64_t offset) const {
+    if (offset >= capacity_) {
+        isc_throw(OutOfRange, "offset " << offset << " is out of the pool "
+                  "of " << capacity_ << " addresses");
+    }
+}
+
+bool
+PoolFreeBitmap::isUsed(uint64_t offset) const {
+    checkOffset(offset);
+    uint64_t mask = static_cast<uint64_t>(1) << (offset % WORD_BITS);
+    return ((bits_[offset / WORD_BITS] & mask) != 0);
+}
+
+void
+PoolFreeBitmap::setUsed(uint64_t offset) {
+    checkOffset(offset);
+    uint64_t& word = bits_[offset / WORD_BITS];
+    uint64_t mask = static_cast<uint64_t>(1) << (offset % WORD_BITS);
+    if ((word & mask) == 0) {
+        word |= mask;
+        --free_count_;
+    }
+}
+
+void
+PoolFreeBitmap::setFree(uint64_t offset) {
+    checkOffset(offset);
+    uint64_t& word = bits_[offset / WORD_BITS];
+    uint64_t mask = static_cast<uint64_t>(1) << (offset % WORD_BITS);
+    if ((word & mask) != 0) {
+        word &= ~mask;
+        ++free_count_;
+    }
+}
+
+uint64_t
+PoolFreeBitmap::findFree(uint64_t start) const {
+    checkOffset(start);
+    if (free_count_ == 0) {
+        isc_throw(InvalidOperation, "no free address in the pool of "
+                  << capacity_ << " addresses");
+    }
+
+    // Scan the words starting with the one holding the start bit, with
+    // the bits before the start ignored. The first word is visited again
+    // at the end with all its bits to wrap around.
+    size_t words = bits_.size();
+    size_t index = start / WORD_BITS;
+    uint64_t free_bits = ~bits_[index] & (ALL_USED << (start % WORD_BITS));
+    for (size_t count = 0; count <= words; ++count) {
+        if (free_bits != 0) {
+            uint64_t bit = 0;
+            while ((free_bits & 1) == 0) {
+                free_bits >>= 1;
+                ++bit;
+            }
+            return (index * WORD_BITS + bit);
+        }
+        index = (index + 1) % words;
+        free_bits = ~bits_[index];
+    }
+
+    // Can't happen as the free count is not zero.
+    isc_throw(Unexpected, "no free address found in the pool of "
+              << capacity_ << " addresses");
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,104 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef POOL_FREE_BITMAP_H
+#define POOL_FREE_BITMAP_H
+
+#include <dhcpsrv/pool.h>
+#include <boost/shared_ptr.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Bitmap of the used addresses of a pool
+///
+/// The bitmap holds one bit per address (or delegated prefix) of a pool,
+/// indexed by the position of the address in the pool. A set bit means
+/// the address is used. The number of free addresses is maintained so
+/// an exhausted pool is detected without scanning the bitmap.
+class PoolFreeBitmap : public PoolAllocationState {
+public:
+
+    /// @brief Constructor
+    ///
+    /// All addresses are initially free.
+    ///
+    /// @param capacity the number of addresses in the pool
+    explicit PoolFreeBitmap(uint64_t capacity);
+
+    /// @brief Returns the number of addresses in the pool
+    uint64_t getCapacity() const {
+        return (capacity_);
+    }
+
+    /// @brief Returns the number of free addresses in the pool
+    uint64_t getFreeCount() const {
+        return (free_count_);
+    }
+
+    /// @brief Checks if an address is used
+    ///
+    /// @param offset position of the address in the pool
+    ///
+    /// @return true if the address is used
+    /// @throw isc::OutOfRange if the offset is beyond the pool
+    bool isUsed(uint64_t offset) const;
+
+    /// @brief Marks an address as used
+    ///
+    /// @param offset position of the address in the pool
+    /// @throw isc::OutOfRange if the offset is beyond the pool
+    void setUsed(uint64_t offset);
+
+    /// @brief Marks an address as free
+    ///
+    /// @param offset position of the address in the pool
+    /// @throw isc::OutOfRange if the offset is beyond the pool
+    void setFree(uint64_t offset);
+
+    /// @brief Finds a free address
+    ///
+    /// The bitmap is scanned a word at a time starting at the given
+    /// position and wrapping around at the end of the pool.
+    ///
+    /// @param start position where the scan starts
+    ///
+    /// @return the position of the first free address at or after start
+    /// @throw isc::OutOfRange if the start is beyond the pool
+    /// @throw isc::InvalidOperation if there is no free address
+    uint64_t findFree(uint64_t start) const;
+
+private:
+
+    /// @brief Checks an offset is in the pool
+    ///
+    /// @param offset position of the address in the pool
+    /// @throw isc::OutOfRange if the offset is beyond the pool
+    void checkOffset(uint64_t offset) const;
+
+    /// @brief The bits, 64 addresses per word
+    ///
+    /// The bits beyond the capacity in the last word are set so they
+    /// are never found free.
+    std::vector<uint64_t> bits_;
+
+    /// @brief The number of addresses in the pool
+    uint64_t capacity_;
+
+    /// @brief The number of free addresses in the pool
+    uint64_t free_count_;
+};
+
+/// @brief Type of the pointer to a pool free bitmap
+typedef boost::shared_ptr<PoolFreeBitmap> PoolFreeBitmapPtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // POOL_FREE_BITMAP_H
@@ -0,0 +1,122 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/pool_free_lease_index.h>
+#include <exceptions/exceptions.h>
+
+namespace isc {
+namespace dhcp {
+
+PoolFreeLeaseIndex::PoolFreeLeaseIndex(uint64_t capacity)
+    : capacity_(capacity), free_count_(capacity) {
+    if (capacity > 0) {
+        intervals_[0] = capacity - 1;
+    }
+}
+
+void
+PoolFreeLeaseIndex::checkOffset(uint64_t offset) const {
+    if (offset >= capacity_) {
+        isc_throw(OutOfRange, "offset " << offset << " is out of the pool "
+                  "of " << capacity_ << " addresses");
+    }
+}
+
+PoolFreeLeaseIndex::Intervals::const_iterator
+PoolFreeLeaseIndex::find(uint64_t offset) const {
+    // Get the last interval starting at or before the offset.
+    Intervals::const_iterator it = intervals_.upper_bound(offset);
+    if (it == intervals_.begin()) {
+        return (intervals_.end());
+    }
+    --it;
+    if (it->second < offset) {
+        return (intervals_.end());
+    }
+    return (it);
+}
+
+bool
+PoolFreeLeaseIndex::isFree(uint64_t offset) const {
+    checkOffset(offset);
+    return (find(offset) != intervals_.end());
+}
+
+bool
+PoolFreeLeaseIndex::findFree(uint64_t start, uint64_t& offset) const {
+    if (start >= capacity_) {
+        return (false);
+    }
+
+    // The start position when it is free, else the first position of
+    // the next interval.
+    if (find(start) != intervals_.end()) {
+        offset = start;
+        return (true);
+    }
+    Intervals::const_iterator it = intervals_.upper_bound(start);
+    if (it == intervals_.end()) {
+        return (false);
+    }
+    offset = it->first;
+    return (true);
+}
+
+void
+PoolFreeLeaseIndex::setUsed(uint64_t offset) {
+    checkOffset(offset);
+    Intervals::const_iterator it = find(offset);
+    if (it == intervals_.end()) {
+        return;
+    }
+
+    uint64_t first = it->first;
+    uint64_t last = it->second;
+    intervals_.erase(it);
+    if (first < offset) {
+        intervals_[first] = offset - 1;
+    }
+    if (offset < last) {
+        intervals_[offset + 1] = last;
+    }
+    --free_count_;
+}
+
+void
+PoolFreeLeaseIndex::setFree(uint64_t offset) {
+    checkOffset(offset);
+    if (find(offset) != intervals_.end()) {
+        return;
+    }
+
+    uint64_t first = offset;
+    uint64_t last = offset;
+
+    // Merge with the following interval.
+    Intervals::iterator it = intervals_.upper_bound(offset);
+    if ((it != intervals_.end()) && (it->first == offset + 1)) {
+        last = it->second;
+        it = intervals_.erase(it);
+    }
+
+    // Merge with the preceding interval.
+    if (it != intervals_.begin()) {
+        --it;
+        if (it->second + 1 == offset) {
+            it->second = last;
+            ++free_count_;
+            return;
+        }
+    }
+
+    intervals_[first] = last;
+    ++free_count_;
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef POOL_FREE_LEASE_INDEX_H
+#define POOL_FREE_LEASE_INDEX_H
+
+#include <boost/shared_ptr.hpp>
+
+#include <map>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Index of the free addresses of a pool
+///
+/// The free addresses (or delegated prefixes) are kept as a set of
+/// disjoint intervals of positions in the pool, so a fresh pool of any
+/// size takes one interval and the memory grows with the fragmentation
+/// of the pool, not with its size. Looking up, taking and freeing an
+/// address cost a logarithmic time in the number of intervals.
+///
+/// The index is attached to the pool (see @ref Pool::getFreeLeaseIndex)
+/// and kept in sync with the lease database by the allocation engine so
+/// the allocators can skip the used addresses and detect the exhaustion
+/// of the pool at once.
+class PoolFreeLeaseIndex {
+public:
+
+    /// @brief Constructor
+    ///
+    /// All addresses are initially free.
+    ///
+    /// @param capacity the number of addresses in the pool
+    explicit PoolFreeLeaseIndex(uint64_t capacity);
+
+    /// @brief Returns the number of addresses in the pool
+    uint64_t getCapacity() const {
+        return (capacity_);
+    }
+
+    /// @brief Returns the number of free addresses in the pool
+    uint64_t getFreeCount() const {
+        return (free_count_);
+    }
+
+    /// @brief Returns the number of intervals of free addresses
+    size_t getIntervalCount() const {
+        return (intervals_.size());
+    }
+
+    /// @brief Checks if an address is free
+    ///
+    /// @param offset position of the address in the pool
+    ///
+    /// @return true if the address is free
+    /// @throw isc::OutOfRange if the offset is beyond the pool
+    bool isFree(uint64_t offset) const;
+
+    /// @brief Finds a free address
+    ///
+    /// @param start position where the search starts
+    /// @param [out] offset position of the first free address at or
+    /// after start
+    ///
+    /// @return false if there is no free address at or after start,
+    /// true otherwise
+    bool findFree(uint64_t start, uint64_t& offset) const;
+
+    /// @brief Marks an address as used
+    ///
+    /// @param offset position of the address in the pool
+    /// @throw isc::OutOfRange if the offset is beyond the pool
+    void setUsed(uint64_t offset);
+
+    /// @brief Marks an address as free
+    ///
+    /// @param offset position of the address in the pool
+    /// @throw isc::OutOfRange if the offset is beyond the pool
+    void setFree(uint64_t offset);
+
+private:
+
+    /// @brief Type of the intervals: first position to last position
+    typedef std::map<uint64_t, uint64_t> Intervals;
+
+    /// @brief Checks an offset is in the pool
+    ///
+    /// @param offset position of the address in the pool
+    /// @throw isc::OutOfRange if the offset is beyond the pool
+    void checkOffset(uint64_t offset) const;
+
+    /// @brief Returns the interval holding an address
+    ///
+    /// @param offset position of the address in the pool
+    ///
+    /// @return the interval or the end of the intervals when the
+    /// address is used
+    Intervals::const_iterator find(uint64_t offset) const;
+
+    /// @brief The free intervals, with the first and last positions
+    Intervals intervals_;
+
+    /// @brief The number of addresses in the pool
+    uint64_t capacity_;
+
+    /// @brief The number of free addresses in the pool
+    uint64_t free_count_;
+};
+
+/// @brief Type of the pointer to a pool free lease index
+typedef boost::shared_ptr<PoolFreeLeaseIndex> PoolFreeLeaseIndexPtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // POOL_FREE_LEASE_INDEX_H
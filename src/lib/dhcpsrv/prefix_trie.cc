@@ -0,0 +1,116 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/prefix_trie.h>
+#include <exceptions/exceptions.h>
+
+#include <algorithm>
+
+using namespace isc::asiolink;
+
+namespace isc {
+namespace dhcp {
+
+PrefixTrie::PrefixTrie()
+    : bits_(0), size_(0) {
+}
+
+unsigned
+PrefixTrie::commonLength(const std::vector<uint8_t>& key1,
+                         const std::vector<uint8_t>& key2,
+                         unsigned max_len) {
+    unsigned len = 0;
+    // Compare whole bytes first.
+    while ((len + 8 <= max_len) && (key1[len / 8] == key2[len / 8])) {
+        len += 8;
+    }
+    while ((len < max_len) && (bit(key1, len) == bit(key2, len))) {
+        ++len;
+    }
+    return (len);
+}
+
+void
+PrefixTrie::insert(const IOAddress& prefix, uint8_t len, size_t value) {
+    std::vector<uint8_t> key = prefix.toBytes();
+    unsigned bits = key.size() * 8;
+    if (len > bits) {
+        isc_throw(BadValue, "invalid prefix length " << static_cast<unsigned>(len)
+                  << " for " << prefix);
+    }
+    if (!root_) {
+        bits_ = bits;
+        root_.reset(new Node(std::vector<uint8_t>(key.size(), 0), 0));
+    } else if (bits != bits_) {
+        isc_throw(BadValue, "address family of " << prefix
+                  << " does not match the family of the trie");
+    }
+
+    // The prefix of the current node is a prefix of the key.
+    Node* node = root_.get();
+    for (;;) {
+        if (node->len_ == len) {
+            node->values_.push_back(value);
+            break;
+        }
+
+        boost::scoped_ptr<Node>& child = node->children_[bit(key, node->len_)];
+        if (!child) {
+            child.reset(new Node(key, len));
+            child->values_.push_back(value);
+            break;
+        }
+
+        unsigned common = commonLength(child->key_, key,
+                                       std::min(static_cast<unsigned>(child->len_),
+                                                static_cast<unsigned>(len)));
+        if (common == child->len_) {
+            node = child.get();
+            continue;
+        }
+
+        // The key diverges from the child or ends within its prefix: insert
+        // a node for the common part between the current node and the child.
+        Node* middle = new Node(key, common);
+        middle->children_[bit(child->key_, common)].swap(child);
+        child.reset(middle);
+        if (common == len) {
+            middle->values_.push_back(value);
+        } else {
+            Node* leaf = new Node(key, len);
+            leaf->values_.push_back(value);
+            middle->children_[bit(key, common)].reset(leaf);
+        }
+        break;
+    }
+    ++size_;
+}
+
+void
+PrefixTrie::match(const IOAddress& address,
+                  std::vector<size_t>& values) const {
+    if (!root_) {
+        return;
+    }
+    std::vector<uint8_t> key = address.toBytes();
+    if (key.size() * 8 != bits_) {
+        return;
+    }
+
+    const Node* node = root_.get();
+    while (node && (commonLength(node->key_, key, node->len_) == node->len_)) {
+        values.insert(values.end(), node->values_.begin(), node->values_.end());
+        if (node->len_ == bits_) {
+            break;
+        }
+        node = node->children_[bit(key, node->len_)].get();
+    }
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
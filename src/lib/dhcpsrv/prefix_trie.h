@@ -0,0 +1,112 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PREFIX_TRIE_H
+#define PREFIX_TRIE_H
+
+#include <asiolink/io_address.h>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Path compressed binary trie of address prefixes.
+///
+/// Each prefix is associated with one or more values, e.g. the ranks of
+/// the subnets in the configuration. A lookup returns the values of all
+/// prefixes including an address, i.e. walks at most one node per
+/// distinct prefix length on the path to the address instead of testing
+/// all prefixes. IPv4 and IPv6 prefixes must not be mixed in a trie.
+class PrefixTrie : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates an empty trie.
+    PrefixTrie();
+
+    /// @brief Inserts a prefix.
+    ///
+    /// @param prefix The prefix, bits past its length are ignored.
+    /// @param len The prefix length.
+    /// @param value The value associated with the prefix.
+    /// @throw BadValue if the prefix length is greater than the address
+    /// length or the address family differs from the previous prefixes.
+    void insert(const asiolink::IOAddress& prefix, uint8_t len, size_t value);
+
+    /// @brief Finds the values of the prefixes including an address.
+    ///
+    /// @param address The address.
+    /// @param [out] values The vector the values are appended to, from the
+    /// shortest prefix to the longest one. Nothing is appended when the
+    /// address family differs from the family of the prefixes.
+    void match(const asiolink::IOAddress& address,
+               std::vector<size_t>& values) const;
+
+    /// @brief Returns the number of inserted prefixes.
+    size_t size() const {
+        return (size_);
+    }
+
+private:
+
+    /// @brief Node of the trie.
+    struct Node {
+        /// @brief Constructor.
+        ///
+        /// @param key The address bytes.
+        /// @param len The number of significant bits of the key.
+        Node(const std::vector<uint8_t>& key, uint8_t len)
+            : key_(key), len_(len) {
+        }
+
+        /// @brief The prefix of the node.
+        std::vector<uint8_t> key_;
+
+        /// @brief The length of the prefix of the node.
+        uint8_t len_;
+
+        /// @brief The values of the prefix, empty for a branching node.
+        std::vector<size_t> values_;
+
+        /// @brief The children, by the bit following the prefix.
+        boost::scoped_ptr<Node> children_[2];
+    };
+
+    /// @brief Returns a bit of a key.
+    ///
+    /// @param key The key.
+    /// @param pos The position of the bit, 0 for the most significant one.
+    static unsigned bit(const std::vector<uint8_t>& key, unsigned pos) {
+        return ((key[pos / 8] >> (7 - pos % 8)) & 1);
+    }
+
+    /// @brief Returns the length of the common prefix of two keys.
+    ///
+    /// @param key1 The first key.
+    /// @param key2 The second key.
+    /// @param max_len The maximum length to compare.
+    static unsigned commonLength(const std::vector<uint8_t>& key1,
+                                 const std::vector<uint8_t>& key2,
+                                 unsigned max_len);
+
+    /// @brief The root node, of length 0.
+    boost::scoped_ptr<Node> root_;
+
+    /// @brief The number of bits of the addresses, 0 when empty.
+    unsigned bits_;
+
+    /// @brief The number of inserted prefixes.
+    size_t size_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // PREFIX_TRIE_H
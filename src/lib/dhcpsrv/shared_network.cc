@@ -413,6 +413,22 @@ SharedNetwork4::subnetsAllHRGlobal() const {
     return (Subnet4Ptr());
 }
 
+void
+SharedNetwork4::propertiesChanged() {
+    Network4::propertiesChanged();
+    for (auto subnet : subnets_) {
+        subnet->propertiesChanged();
+    }
+}
+
+void
+SharedNetwork4::selectionChanged() {
+    Network4::selectionChanged();
+    for (auto subnet : subnets_) {
+        subnet->selectionChanged();
+    }
+}
+
 ElementPtr
 SharedNetwork4::toElement() const {
     ElementPtr map = Network4::toElement();
@@ -512,6 +528,22 @@ SharedNetwork6::subnetsAllHRGlobal() const {
     return (Subnet6Ptr());
 }
 
+void
+SharedNetwork6::propertiesChanged() {
+    Network6::propertiesChanged();
+    for (auto subnet : subnets_) {
+        subnet->propertiesChanged();
+    }
+}
+
+void
+SharedNetwork6::selectionChanged() {
+    Network6::selectionChanged();
+    for (auto subnet : subnets_) {
+        subnet->selectionChanged();
+    }
+}
+
 ElementPtr
 SharedNetwork6::toElement() const {
     ElementPtr map = Network6::toElement();
@@ -201,6 +201,14 @@ public:
     /// @return First subnet which has not a global host reservation mode.
     Subnet4Ptr subnetsAllHRGlobal() const;
 
+    /// @brief Invalidates the cached inherited parameters of the shared
+    /// network and of its subnets.
+    virtual void propertiesChanged();
+
+    /// @brief Raises the flags of the subnet selection parameters of the
+    /// subnets of the shared network.
+    virtual void selectionChanged();
+
     /// @brief Unparses shared network object.
     ///
     /// @return A pointer to unparsed shared network configuration.
@@ -405,6 +413,14 @@ public:
     /// @return First subnet which has not a global host reservation mode.
     Subnet6Ptr subnetsAllHRGlobal() const;
 
+    /// @brief Invalidates the cached inherited parameters of the shared
+    /// network and of its subnets.
+    virtual void propertiesChanged();
+
+    /// @brief Raises the flags of the subnet selection parameters of the
+    /// subnets of the shared network.
+    virtual void selectionChanged();
+
     /// @brief Unparses shared network object.
     ///
     /// @return A pointer to unparsed shared network configuration.
@@ -20,12 +20,49 @@
 #include <util/strutil.h>
 
 #include <list>
+#include <set>
 #include <sstream>
 
 using namespace isc::log;
 using namespace isc::data;
 using namespace isc::process;
 
+namespace {
+
+/// @brief Collects the classes referenced by a subnet or a shared network.
+///
+/// @param network The subnet or shared network.
+/// @param [out] referenced The set the class names are added to.
+void
+addNetworkClasses(const isc::dhcp::Network& network,
+                  std::set<std::string>& referenced) {
+    isc::dhcp::ClientClass client_class =
+        network.getClientClass(isc::dhcp::Network::Inheritance::NONE).get();
+    if (!client_class.empty()) {
+        referenced.insert(client_class);
+    }
+    const isc::dhcp::ClientClasses& required = network.getRequiredClasses();
+    referenced.insert(required.cbegin(), required.cend());
+}
+
+/// @brief Collects the classes referenced by the pools of a subnet.
+///
+/// @param pools The pools.
+/// @param [out] referenced The set the class names are added to.
+void
+addPoolClasses(const isc::dhcp::PoolCollection& pools,
+               std::set<std::string>& referenced) {
+    for (auto pool : pools) {
+        if (!pool->getClientClass().empty()) {
+            referenced.insert(pool->getClientClass());
+        }
+        const isc::dhcp::ClientClasses& required = pool->getRequiredClasses();
+        referenced.insert(required.cbegin(), required.cend());
+    }
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
@@ -251,6 +288,36 @@ SrvConfig::mergeGlobals(SrvConfig& other) {
     }
 }
 
+void
+SrvConfig::updateUsedClientClasses() {
+    // Hook libraries and classes fetched later from the backends can
+    // depend on any class.
+    if (!hooks_config_.get().empty() || getConfigControlInfo()) {
+        return;
+    }
+
+    // The servers drop the queries in the DROP class.
+    std::set<std::string> referenced;
+    referenced.insert("DROP");
+    for (auto network : *cfg_shared_networks4_->getAll()) {
+        addNetworkClasses(*network, referenced);
+    }
+    for (auto network : *cfg_shared_networks6_->getAll()) {
+        addNetworkClasses(*network, referenced);
+    }
+    for (auto subnet : *cfg_subnets4_->getAll()) {
+        addNetworkClasses(*subnet, referenced);
+        addPoolClasses(subnet->getPools(Lease::TYPE_V4), referenced);
+    }
+    for (auto subnet : *cfg_subnets6_->getAll()) {
+        addNetworkClasses(*subnet, referenced);
+        addPoolClasses(subnet->getPools(Lease::TYPE_NA), referenced);
+        addPoolClasses(subnet->getPools(Lease::TYPE_TA), referenced);
+        addPoolClasses(subnet->getPools(Lease::TYPE_PD), referenced);
+    }
+    class_dictionary_->updateUsed(referenced);
+}
+
 void
 SrvConfig::removeStatistics() {
     // Removes statistics for v4 and v6 subnets
@@ -259,6 +326,39 @@ SrvConfig::removeStatistics() {
     getCfgSubnets6()->removeStatistics();
 }
 
+void
+SrvConfig::cacheNetworkProperties() const {
+    // The subnets use the values cached by their shared networks.
+    for (auto network : *cfg_shared_networks4_->getAll()) {
+        network->cacheProperties();
+    }
+    for (auto network : *cfg_shared_networks6_->getAll()) {
+        network->cacheProperties();
+    }
+    for (auto subnet : *cfg_subnets4_->getAll()) {
+        subnet->cacheProperties();
+    }
+    for (auto subnet : *cfg_subnets6_->getAll()) {
+        subnet->cacheProperties();
+    }
+}
+
+void
+SrvConfig::networkPropertiesChanged() const {
+    for (auto network : *cfg_shared_networks4_->getAll()) {
+        network->propertiesChanged();
+    }
+    for (auto network : *cfg_shared_networks6_->getAll()) {
+        network->propertiesChanged();
+    }
+    for (auto subnet : *cfg_subnets4_->getAll()) {
+        subnet->propertiesChanged();
+    }
+    for (auto subnet : *cfg_subnets6_->getAll()) {
+        subnet->propertiesChanged();
+    }
+}
+
 void
 SrvConfig::updateStatistics() {
     // Update default sample limits.
@@ -316,6 +416,7 @@ SrvConfig::getConfiguredGlobal(std::string name) const {
 void
 SrvConfig::clearConfiguredGlobals() {
     configured_globals_ = isc::data::Element::createMap();
+    networkPropertiesChanged();
 }
 
 void
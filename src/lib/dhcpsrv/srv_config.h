@@ -497,6 +497,17 @@ public:
         class_dictionary_ = dictionary;
     }
 
+    /// @brief Finds the client classes which need to be evaluated.
+    ///
+    /// Collects the classes referenced by the subnets, shared networks
+    /// and pools, plus the special DROP class, and updates the used flag
+    /// of the classes of the dictionary (see
+    /// @c ClientClassDictionary::updateUsed) so the classification skips
+    /// the classes nothing depends on. Nothing is done when hook libraries
+    /// or configuration backends are configured as they can depend on any
+    /// class.
+    void updateUsedClientClasses();
+
     /// @brief Returns non-const reference to configured hooks libraries.
     ///
     /// @return non-const reference to configured hooks libraries.
@@ -665,6 +676,21 @@ public:
     /// @ref CfgSubnets6::removeStatistics for details.
     void removeStatistics();
 
+    /// @brief Caches the inherited parameters of the shared networks and
+    /// subnets.
+    ///
+    /// This method is called when the configuration becomes the current
+    /// one. See @ref Network::cacheProperties for details.
+    void cacheNetworkProperties() const;
+
+    /// @brief Invalidates the cached inherited parameters of the shared
+    /// networks and subnets.
+    ///
+    /// This method is called when the global parameters of this
+    /// configuration change. The networks of the other configurations
+    /// keep their cached parameters.
+    void networkPropertiesChanged() const;
+
     /// @brief Sets decline probation-period
     ///
     /// Probation-period is the timer, expressed, in seconds, that specifies how
@@ -763,6 +789,7 @@ public:
     /// @param value ElementPtr containing the value of the global
     void addConfiguredGlobal(const std::string& name, isc::data::ConstElementPtr value) {
         configured_globals_->set(name, value);
+        networkPropertiesChanged();
     }
 
     /// @brief Moves deprecated parameters from dhcp-ddns element to global element
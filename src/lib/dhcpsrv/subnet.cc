@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -45,6 +45,29 @@ comparePoolFirstAddress(const PoolPtr& pool1, const PoolPtr& pool2) {
     return (pool1->getFirstAddress() < pool2->getFirstAddress());
 };
 
+/// @brief Returns the pool including an address.
+///
+/// The pools don't overlap and are sorted by first address so the only
+/// candidate is the last pool starting at or before the address, found
+/// with a binary search.
+///
+/// @param pools The sorted pools.
+/// @param addr The address.
+/// @return Iterator to the pool including the address or @c pools.end().
+PoolCollection::const_iterator
+findPool(const PoolCollection& pools, const IOAddress& addr) {
+    PoolCollection::const_iterator ub =
+        std::upper_bound(pools.begin(), pools.end(), addr,
+                         prefixLessThanFirstAddress);
+    if (ub != pools.begin()) {
+        --ub;
+        if ((*ub)->inRange(addr)) {
+            return (ub);
+        }
+    }
+    return (pools.end());
+}
+
 }
 
 namespace isc {
@@ -377,15 +400,9 @@ const PoolPtr Subnet::getPool(Lease::Type type, const isc::asiolink::IOAddress&
         // matching prefix we use decrement operator to go back by one item.
         // If returned iterator points to begin it means that prefixes in all
         // pools are greater than out prefix, and thus there is no match.
-        PoolCollection::const_iterator ub =
-            std::upper_bound(pools.begin(), pools.end(), hint,
-                             prefixLessThanFirstAddress);
-
-        if (ub != pools.begin()) {
-            --ub;
-            if ((*ub)->inRange(hint)) {
-                candidate = *ub;
-            }
+        PoolCollection::const_iterator pool = findPool(pools, hint);
+        if (pool != pools.end()) {
+            candidate = *pool;
         }
 
         // If we don't find anything better, then let's just use the first pool
@@ -408,18 +425,9 @@ const PoolPtr Subnet::getPool(Lease::Type type,
 
     PoolPtr candidate;
 
-    if (!pools.empty()) {
-        PoolCollection::const_iterator ub =
-            std::upper_bound(pools.begin(), pools.end(), hint,
-                             prefixLessThanFirstAddress);
-
-        if (ub != pools.begin()) {
-            --ub;
-            if ((*ub)->inRange(hint) &&
-                (*ub)->clientSupported(client_classes)) {
-                candidate = *ub;
-            }
-        }
+    PoolCollection::const_iterator pool = findPool(pools, hint);
+    if ((pool != pools.end()) && (*pool)->clientSupported(client_classes)) {
+        candidate = *pool;
     }
 
     // Return a pool or NULL if no match found.
@@ -473,12 +481,12 @@ Subnet::addPool(const PoolPtr& pool) {
 
     PoolCollection& pools_writable = getPoolsWritable(pool->getType());
 
-    // Add the pool to the appropriate pools collection
-    pools_writable.push_back(pool);
-
-    // Sort pools by first address.
-    std::sort(pools_writable.begin(), pools_writable.end(),
-              comparePoolFirstAddress);
+    // Add the pool to the appropriate pools collection, keeping the pools
+    // sorted by first address.
+    pools_writable.insert(std::upper_bound(pools_writable.begin(),
+                                           pools_writable.end(),
+                                           pool, comparePoolFirstAddress),
+                          pool);
 }
 
 void
@@ -496,14 +504,7 @@ Subnet::inPool(Lease::Type type, const isc::asiolink::IOAddress& addr) const {
 
     const PoolCollection& pools = getPools(type);
 
-    for (PoolCollection::const_iterator pool = pools.begin();
-         pool != pools.end(); ++pool) {
-        if ((*pool)->inRange(addr)) {
-            return (true);
-        }
-    }
-    // There's no pool that address belongs to
-    return (false);
+    return (findPool(pools, addr) != pools.end());
 }
 
 bool
@@ -518,17 +519,10 @@ Subnet::inPool(Lease::Type type,
 
     const PoolCollection& pools = getPools(type);
 
-    for (PoolCollection::const_iterator pool = pools.begin();
-         pool != pools.end(); ++pool) {
-        if (!(*pool)->clientSupported(client_classes)) {
-            continue;
-        }
-        if ((*pool)->inRange(addr)) {
-            return (true);
-        }
-    }
-    // There's no pool that address belongs to
-    return (false);
+    // The pools don't overlap so only the pool including the address
+    // needs to support the client classes.
+    PoolCollection::const_iterator pool = findPool(pools, addr);
+    return ((pool != pools.end()) && (*pool)->clientSupported(client_classes));
 }
 
 bool
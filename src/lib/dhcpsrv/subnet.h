@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -47,6 +47,9 @@ public:
     /// always true. For the given example, 2001::1234:abcd would return
     /// true for inRange(), but false for inPool() check.
     ///
+    /// The pools are sorted and don't overlap so this method uses binary
+    /// search, as @c getPool.
+    ///
     /// @param type type of pools to iterate over
     /// @param addr this address will be checked if it belongs to any pools in
     ///        that subnet
@@ -55,7 +58,8 @@ public:
 
     /// @brief checks if the specified address is in allowed pools
     ///
-    /// This takes also into account client classes
+    /// This takes also into account client classes. Only the pool the
+    /// address belongs to is checked for the classes.
     ///
     /// @param type type of pools to iterate over
     /// @param addr this address will be checked if it belongs to any pools in
@@ -257,6 +261,8 @@ public:
     /// with the subnet.
     void setSharedNetwork(const NetworkPtr& shared_network) {
         parent_network_ = shared_network;
+        propertiesChanged();
+        selectionChanged();
     }
 
     /// @brief Returns shared network name.
@@ -0,0 +1,209 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SUBNET_SELECTION_INDEX_H
+#define SUBNET_SELECTION_INDEX_H
+
+#include <asiolink/io_address.h>
+#include <dhcp/classify.h>
+#include <dhcp/option.h>
+#include <dhcpsrv/prefix_trie.h>
+#include <boost/functional/hash.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Lookup structure for the subnet selection.
+///
+/// Holds the subnets of a configuration in the configuration order and
+/// indexes them by prefix, relay address, interface name and interface-id.
+/// A lookup returns the first subnet in the configuration order which
+/// matches the key and supports the client classes, i.e. the subnet a scan
+/// of the configuration would return, without testing all subnets.
+///
+/// The index is built once from the configuration and is not modified
+/// after, so it can be used concurrently. The owner rebuilds it when the
+/// configuration changes.
+///
+/// @tparam SubnetPtrType Type of the pointer to the subnets, i.e.
+/// @c Subnet4Ptr or @c Subnet6Ptr.
+template<typename SubnetPtrType>
+class SubnetSelectionIndex : public boost::noncopyable {
+public:
+
+    /// @brief Adds a subnet after the previously added ones.
+    ///
+    /// @param subnet The subnet.
+    /// @return The rank of the subnet, to be passed to the other add
+    /// methods.
+    size_t add(const SubnetPtrType& subnet) {
+        size_t rank = subnets_.size();
+        subnets_.push_back(subnet);
+        std::pair<asiolink::IOAddress, uint8_t> prefix = subnet->get();
+        prefixes_.insert(prefix.first, prefix.second, rank);
+        return (rank);
+    }
+
+    /// @brief Adds a relay address selecting a subnet.
+    ///
+    /// @param rank The rank of the subnet.
+    /// @param address The relay address.
+    void addRelay(size_t rank, const asiolink::IOAddress& address) {
+        relays_[address].push_back(rank);
+    }
+
+    /// @brief Adds an interface name selecting a subnet.
+    ///
+    /// @param rank The rank of the subnet.
+    /// @param iface The interface name.
+    void addIface(size_t rank, const std::string& iface) {
+        ifaces_[iface].push_back(rank);
+    }
+
+    /// @brief Adds an interface-id selecting a subnet.
+    ///
+    /// @param rank The rank of the subnet.
+    /// @param interface_id The interface-id option.
+    void addInterfaceId(size_t rank, const OptionPtr& interface_id) {
+        interface_ids_[interfaceIdKey(interface_id)].push_back(rank);
+    }
+
+    /// @brief Selects a subnet by address.
+    ///
+    /// @param address The address which must be in the subnet prefix.
+    /// @param client_classes The classes of the client.
+    /// @return The first subnet including the address and supporting the
+    /// client classes, or null.
+    SubnetPtrType selectByAddress(const asiolink::IOAddress& address,
+                                  const ClientClasses& client_classes) const {
+        std::vector<size_t> ranks;
+        prefixes_.match(address, ranks);
+        // The ranks come by prefix length.
+        std::sort(ranks.begin(), ranks.end());
+        return (select(ranks, client_classes));
+    }
+
+    /// @brief Selects a subnet by relay address.
+    ///
+    /// @param address The relay address.
+    /// @param client_classes The classes of the client.
+    /// @return The first subnet selected by the relay address and supporting
+    /// the client classes, or null.
+    SubnetPtrType selectByRelay(const asiolink::IOAddress& address,
+                                const ClientClasses& client_classes) const {
+        auto it = relays_.find(address);
+        if (it == relays_.end()) {
+            return (SubnetPtrType());
+        }
+        return (select(it->second, client_classes));
+    }
+
+    /// @brief Selects a subnet by interface name.
+    ///
+    /// @param iface The interface name.
+    /// @param client_classes The classes of the client.
+    /// @return The first subnet selected by the interface name and
+    /// supporting the client classes, or null.
+    SubnetPtrType selectByIface(const std::string& iface,
+                                const ClientClasses& client_classes) const {
+        auto it = ifaces_.find(iface);
+        if (it == ifaces_.end()) {
+            return (SubnetPtrType());
+        }
+        return (select(it->second, client_classes));
+    }
+
+    /// @brief Selects a subnet by interface-id.
+    ///
+    /// @param interface_id The interface-id option.
+    /// @param client_classes The classes of the client.
+    /// @return The first subnet with an interface-id equal to the option
+    /// and supporting the client classes, or null.
+    SubnetPtrType selectByInterfaceId(const OptionPtr& interface_id,
+                                      const ClientClasses& client_classes) const {
+        auto it = interface_ids_.find(interfaceIdKey(interface_id));
+        if (it == interface_ids_.end()) {
+            return (SubnetPtrType());
+        }
+        for (auto rank : it->second) {
+            const SubnetPtrType& subnet = subnets_[rank];
+            // The key holds the data only.
+            OptionPtr subnet_id = subnet->getInterfaceId();
+            if (subnet_id && subnet_id->equals(interface_id) &&
+                subnet->clientSupported(client_classes)) {
+                return (subnet);
+            }
+        }
+        return (SubnetPtrType());
+    }
+
+private:
+
+    /// @brief Returns the first subnet supporting the client classes.
+    ///
+    /// @param ranks The ranks of the candidate subnets in ascending order.
+    /// @param client_classes The classes of the client.
+    /// @return The subnet or null.
+    SubnetPtrType select(const std::vector<size_t>& ranks,
+                         const ClientClasses& client_classes) const {
+        for (auto rank : ranks) {
+            if (subnets_[rank]->clientSupported(client_classes)) {
+                return (subnets_[rank]);
+            }
+        }
+        return (SubnetPtrType());
+    }
+
+    /// @brief Returns the key of an interface-id option.
+    ///
+    /// @param interface_id The interface-id option.
+    static std::string interfaceIdKey(const OptionPtr& interface_id) {
+        const OptionBuffer& data = interface_id->getData();
+        return (std::string(data.begin(), data.end()));
+    }
+
+    /// @brief Hash of the addresses.
+    struct AddressHash {
+        /// @brief Returns the hash of an address.
+        ///
+        /// @param address The address.
+        size_t operator()(const asiolink::IOAddress& address) const {
+            if (address.isV4()) {
+                return (boost::hash<uint32_t>()(address.toUint32()));
+            }
+            std::vector<uint8_t> bytes = address.toBytes();
+            return (boost::hash_range(bytes.begin(), bytes.end()));
+        }
+    };
+
+    /// @brief The subnets by rank.
+    std::vector<SubnetPtrType> subnets_;
+
+    /// @brief The ranks of the subnets by prefix.
+    PrefixTrie prefixes_;
+
+    /// @brief The ranks of the subnets by relay address.
+    std::unordered_map<asiolink::IOAddress, std::vector<size_t>,
+                       AddressHash> relays_;
+
+    /// @brief The ranks of the subnets by interface name.
+    std::unordered_map<std::string, std::vector<size_t> > ifaces_;
+
+    /// @brief The ranks of the subnets by interface-id data.
+    std::unordered_map<std::string, std::vector<size_t> > interface_ids_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // SUBNET_SELECTION_INDEX_H
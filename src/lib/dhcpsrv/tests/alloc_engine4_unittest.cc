@@ -32,11 +32,13 @@ namespace test {
 TEST_F(AllocEngine4Test, constructor) {
     boost::scoped_ptr<AllocEngine> x;
 
-    // Hashed and random allocators are not supported yet
-    ASSERT_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 5, false)),
-                 NotImplemented);
-    ASSERT_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM, 5, false)),
-                 NotImplemented);
+    // Hashed and random allocators can be created
+    ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 5,
+                                            false)));
+    ASSERT_TRUE(x->getAllocator(Lease::TYPE_V4));
+    ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM, 5,
+                                            false)));
+    ASSERT_TRUE(x->getAllocator(Lease::TYPE_V4));
 
     // Create V4 (ipv6=false) Allocation Engine that will try at most
     // 100 attempts to pick up a lease
@@ -821,6 +823,326 @@ TEST_F(AllocEngine4Test, IterativeAllocator_class) {
     }
 }
 
+// This test verifies that the hashed allocator picks addresses that belong
+// to the pool and that the first candidate depends only on the client.
+TEST_F(AllocEngine4Test, HashedAllocator) {
+    NakedAllocEngine::HashedAllocator alloc(Lease::TYPE_V4);
+
+    IOAddress first = alloc.pickAddress(subnet_, cc_, clientid_,
+                                        IOAddress("0.0.0.0"));
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4, first));
+
+    // The same client gets the same first candidate.
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(first, alloc.pickAddress(subnet_, cc_, clientid_,
+                                           IOAddress("0.0.0.0")));
+    }
+
+    // Passing the previous candidate walks over all the pool without
+    // picking the same address twice.
+    std::set<IOAddress> picked;
+    IOAddress candidate = first;
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4, candidate));
+        EXPECT_TRUE(picked.insert(candidate).second);
+        candidate = alloc.pickAddress(subnet_, cc_, clientid_, candidate);
+    }
+    EXPECT_EQ(first, candidate);
+}
+
+// This test verifies that the hashed allocator picks addresses that belong
+// to the pool using classification and spreads clients over pools.
+TEST_F(AllocEngine4Test, HashedAllocator_class) {
+    NakedAllocEngine::HashedAllocator alloc(Lease::TYPE_V4);
+
+    // Restrict pool_ to the foo class. Add a second pool with bar class.
+    pool_->allowClientClass("foo");
+    Pool4Ptr pool(new Pool4(IOAddress("192.0.2.200"),
+                            IOAddress("192.0.2.209")));
+    pool->allowClientClass("bar");
+    subnet_->addPool(pool);
+
+    // Clients are in bar
+    cc_.insert("bar");
+
+    for (uint8_t i = 0; i < 100; ++i) {
+        ClientIdPtr clientid(new ClientId(std::vector<uint8_t>(8, i)));
+        IOAddress candidate = alloc.pickAddress(subnet_, cc_, clientid,
+                                                IOAddress("0.0.0.0"));
+        EXPECT_TRUE(pool->inRange(candidate));
+        candidate = alloc.pickAddress(subnet_, cc_, clientid, candidate);
+        EXPECT_TRUE(pool->inRange(candidate));
+    }
+}
+
+// This test verifies that the random allocator picks free addresses of
+// the pool without picking the same address twice.
+TEST_F(AllocEngine4Test, RandomAllocator) {
+    NakedAllocEngine::RandomAllocator alloc(Lease::TYPE_V4);
+
+    // Two addresses are leased and one lease is expired.
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.101"), hwaddr_, clientid_,
+                               100, time(NULL), subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    lease.reset(new Lease4(IOAddress("192.0.2.105"), hwaddr2_, ClientIdPtr(),
+                           100, time(NULL), subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    lease.reset(new Lease4(IOAddress("192.0.2.107"), hwaddr2_, ClientIdPtr(),
+                           100, time(NULL) - 1000, subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    // The bitmap is built from the lease database.
+    alloc.buildState(subnet_, false);
+    PoolFreeBitmapPtr bitmap =
+        boost::dynamic_pointer_cast<PoolFreeBitmap>(pool_->getAllocationState());
+    ASSERT_TRUE(bitmap);
+    EXPECT_EQ(8, bitmap->getFreeCount());
+
+    // Picking an address does not take it out of the free set.
+    alloc.pickAddress(subnet_, cc_, clientid_, IOAddress("0.0.0.0"));
+    EXPECT_EQ(8, bitmap->getFreeCount());
+
+    // The 8 other addresses are returned once each when they are used.
+    std::set<IOAddress> picked;
+    for (int i = 0; i < 8; ++i) {
+        IOAddress candidate = alloc.pickAddress(subnet_, cc_, clientid_,
+                                                IOAddress("0.0.0.0"));
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4, candidate));
+        EXPECT_NE(IOAddress("192.0.2.101"), candidate);
+        EXPECT_NE(IOAddress("192.0.2.105"), candidate);
+        EXPECT_TRUE(picked.insert(candidate).second);
+        alloc.useAddress(subnet_, candidate);
+    }
+    EXPECT_EQ(1, picked.count(IOAddress("192.0.2.107")));
+    EXPECT_EQ(0, bitmap->getFreeCount());
+
+    // A freed address is returned by the next pick.
+    alloc.freeAddress(subnet_, IOAddress("192.0.2.103"));
+    EXPECT_EQ(IOAddress("192.0.2.103"),
+              alloc.pickAddress(subnet_, cc_, clientid_, IOAddress("0.0.0.0")));
+}
+
+// This test verifies that the random allocator picks addresses that belong
+// to the pool using classification.
+TEST_F(AllocEngine4Test, RandomAllocator_class) {
+    NakedAllocEngine::RandomAllocator alloc(Lease::TYPE_V4);
+
+    // Restrict pool_ to the foo class. Add a second pool with bar class.
+    pool_->allowClientClass("foo");
+    Pool4Ptr pool(new Pool4(IOAddress("192.0.2.200"),
+                            IOAddress("192.0.2.209")));
+    pool->allowClientClass("bar");
+    subnet_->addPool(pool);
+    alloc.buildState(subnet_, false);
+
+    // Clients are in bar
+    cc_.insert("bar");
+
+    std::set<IOAddress> picked;
+    for (int i = 0; i < 10; ++i) {
+        IOAddress candidate = alloc.pickAddress(subnet_, cc_, clientid_,
+                                                IOAddress("0.0.0.0"));
+        EXPECT_TRUE(pool->inRange(candidate));
+        EXPECT_TRUE(picked.insert(candidate).second);
+        alloc.useAddress(subnet_, candidate);
+    }
+}
+
+// This test verifies that the random allocator is told about committed
+// and reclaimed leases but not about offers.
+TEST_F(AllocEngine4Test, RandomAllocatorReclaim) {
+    NakedAllocEngine engine(AllocEngine::ALLOC_RANDOM, 0, false);
+    auto alloc = engine.getAllocator(Lease::TYPE_V4, subnet_);
+    ASSERT_TRUE(alloc);
+    alloc->buildState(subnet_, false);
+    PoolFreeBitmapPtr bitmap =
+        boost::dynamic_pointer_cast<PoolFreeBitmap>(pool_->getAllocationState());
+    ASSERT_TRUE(bitmap);
+    EXPECT_EQ(10, bitmap->getFreeCount());
+
+    // An offer does not use the address.
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("0.0.0.0"), false, false,
+                                    "", true);
+    ctx.query_.reset(new Pkt4(DHCPDISCOVER, 1234));
+    ASSERT_TRUE(engine.allocateLease4(ctx));
+    EXPECT_EQ(10, bitmap->getFreeCount());
+
+    // A committed lease does.
+    ctx.fake_allocation_ = false;
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease = engine.allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(9, bitmap->getFreeCount());
+    EXPECT_TRUE(bitmap->isUsed(lease->addr_.toUint32() -
+                               pool_->getFirstAddress().toUint32()));
+
+    // Reclaim it.
+    lease->valid_lft_ = 100;
+    lease->cltt_ = time(NULL) - 1000;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+    ASSERT_NO_THROW(engine.reclaimExpiredLeases4(0, 0, true));
+
+    EXPECT_EQ(10, bitmap->getFreeCount());
+}
+
+// This test verifies that the iterative allocator skips the addresses
+// the free lease index marks as used and scans the pool when the index
+// has no free address left.
+TEST_F(AllocEngine4Test, IterativeAllocatorFreeLeaseIndex) {
+    NakedAllocEngine::IterativeAllocator alloc(Lease::TYPE_V4);
+
+    // Two addresses are leased and one lease is expired.
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.101"), hwaddr_, clientid_,
+                               100, time(NULL), subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    lease.reset(new Lease4(IOAddress("192.0.2.105"), hwaddr2_, ClientIdPtr(),
+                           100, time(NULL), subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    lease.reset(new Lease4(IOAddress("192.0.2.107"), hwaddr2_, ClientIdPtr(),
+                           100, time(NULL) - 1000, subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    // The index is built from the lease database.
+    alloc.buildState(subnet_, true);
+    PoolFreeLeaseIndexPtr index = pool_->getFreeLeaseIndex();
+    ASSERT_TRUE(index);
+    EXPECT_EQ(8, index->getFreeCount());
+
+    // The free addresses are returned in order and used.
+    const char* expected[] = {
+        "192.0.2.100", "192.0.2.102", "192.0.2.103", "192.0.2.104",
+        "192.0.2.106", "192.0.2.107", "192.0.2.108", "192.0.2.109"
+    };
+    for (auto const& addr : expected) {
+        IOAddress candidate = alloc.pickAddress(subnet_, cc_, clientid_,
+                                                IOAddress("0.0.0.0"));
+        EXPECT_EQ(IOAddress(addr), candidate);
+        alloc.useAddress(subnet_, candidate);
+    }
+
+    // The index is exhausted: the pool is scanned from its beginning.
+    EXPECT_EQ(0, index->getFreeCount());
+    EXPECT_EQ(IOAddress("192.0.2.100"),
+              alloc.pickAddress(subnet_, cc_, clientid_, IOAddress("0.0.0.0")));
+
+    // A freed address is returned by the next pick.
+    alloc.freeAddress(subnet_, IOAddress("192.0.2.103"));
+    EXPECT_EQ(IOAddress("192.0.2.103"),
+              alloc.pickAddress(subnet_, cc_, clientid_, IOAddress("0.0.0.0")));
+
+    // Without index the pool is probed again.
+    alloc.buildState(subnet_, false);
+    EXPECT_FALSE(pool_->getFreeLeaseIndex());
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4,
+                                alloc.pickAddress(subnet_, cc_, clientid_,
+                                                  IOAddress("0.0.0.0"))));
+}
+
+// This test verifies that the hashed allocator skips the addresses the
+// free lease index marks as used and probes the pool when the index has
+// no free address left.
+TEST_F(AllocEngine4Test, HashedAllocatorFreeLeaseIndex) {
+    NakedAllocEngine::HashedAllocator alloc(Lease::TYPE_V4);
+    alloc.buildState(subnet_, true);
+
+    // Each pick is a free address: use it.
+    std::set<IOAddress> picked;
+    for (int i = 0; i < 10; ++i) {
+        IOAddress candidate = alloc.pickAddress(subnet_, cc_, clientid_,
+                                                IOAddress("0.0.0.0"));
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4, candidate));
+        EXPECT_TRUE(picked.insert(candidate).second);
+        alloc.useAddress(subnet_, candidate);
+    }
+
+    // The index is exhausted: the hashed address is probed.
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4,
+                                alloc.pickAddress(subnet_, cc_, clientid_,
+                                                  IOAddress("0.0.0.0"))));
+}
+
+// This test verifies that the free lease indexes are built only when the
+// free-lease-index global parameter is true and that the allocation engine
+// still finds the addresses the index marks as used by mistake.
+TEST_F(AllocEngine4Test, FreeLeaseIndexMiss) {
+    NakedAllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 0, false);
+
+    // Lease all the pool.
+    IOAddress addr("192.0.2.100");
+    for (int i = 0; i < 10; ++i) {
+        Lease4Ptr lease(new Lease4(addr, hwaddr2_, ClientIdPtr(), 100,
+                                   time(NULL), subnet_->getID()));
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+        addr = IOAddress::increase(addr);
+    }
+
+    // The indexes are disabled by default.
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    engine.buildAllocatorStates(cfg);
+    EXPECT_FALSE(pool_->getFreeLeaseIndex());
+
+    cfg->addConfiguredGlobal("free-lease-index", Element::create(true));
+    engine.buildAllocatorStates(cfg);
+    PoolFreeLeaseIndexPtr index = pool_->getFreeLeaseIndex();
+    ASSERT_TRUE(index);
+    EXPECT_EQ(0, index->getFreeCount());
+
+    // A lease deleted behind the allocation engine is still found.
+    Lease4Ptr lease = LeaseMgrFactory::instance().getLease4(IOAddress("192.0.2.104"));
+    ASSERT_TRUE(lease);
+    ASSERT_TRUE(LeaseMgrFactory::instance().deleteLease(lease));
+    EXPECT_EQ(0, index->getFreeCount());
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("0.0.0.0"), false, false,
+                                    "", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    lease = engine.allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(IOAddress("192.0.2.104"), lease->addr_);
+
+    // An expired lease which was not reclaimed is reused.
+    lease = LeaseMgrFactory::instance().getLease4(IOAddress("192.0.2.106"));
+    ASSERT_TRUE(lease);
+    lease->cltt_ = time(NULL) - 1000;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 0x77), HTYPE_ETHER));
+    AllocEngine::ClientContext4 ctx2(subnet_, clientid2_, hwaddr,
+                                     IOAddress("0.0.0.0"), false, false,
+                                     "", false);
+    ctx2.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    lease = engine.allocateLease4(ctx2);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(IOAddress("192.0.2.106"), lease->addr_);
+}
+
+// This test verifies that the allocator used for a subnet follows the
+// allocator parameter of the subnet.
+TEST_F(AllocEngine4Test, getAllocatorSubnet) {
+    NakedAllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 0, false);
+
+    // By default the allocator given to the engine is used.
+    auto alloc = engine.getAllocator(Lease::TYPE_V4, subnet_);
+    ASSERT_TRUE(alloc);
+    EXPECT_TRUE(boost::dynamic_pointer_cast<NakedAllocEngine::IterativeAllocator>(alloc));
+
+    subnet_->setAllocatorType("hashed");
+    alloc = engine.getAllocator(Lease::TYPE_V4, subnet_);
+    ASSERT_TRUE(alloc);
+    EXPECT_TRUE(boost::dynamic_pointer_cast<NakedAllocEngine::HashedAllocator>(alloc));
+
+    // Allocation works with the hashed allocator.
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("0.0.0.0"), false, false,
+                                    "", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease = engine.allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4, lease->addr_));
+}
+
 // This test verifies that the iterative allocator really walks over all addresses
 // in all pools in specified subnet. It also must not pick the same address twice
 // unless it runs out of pool space and must start over.
@@ -55,9 +55,11 @@ TEST(ClientContext6Test, addAllocatedResource) {
 TEST_F(AllocEngine6Test, constructor) {
     boost::scoped_ptr<AllocEngine> x;
 
-    // Hashed and random allocators are not supported yet
-    ASSERT_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 5)), NotImplemented);
-    ASSERT_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM, 5)), NotImplemented);
+    // Hashed and random allocators can be created
+    ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 5)));
+    ASSERT_TRUE(x->getAllocator(Lease::TYPE_PD));
+    ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM, 5)));
+    ASSERT_TRUE(x->getAllocator(Lease::TYPE_PD));
 
     ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_ITERATIVE, 100, true)));
 
@@ -267,6 +269,129 @@ TEST_F(AllocEngine6Test, IterativeAllocator_class) {
     }
 }
 
+// This test verifies that the hashed allocator picks addresses that belong
+// to the pool and that the first candidate depends only on the client.
+TEST_F(AllocEngine6Test, HashedAllocator) {
+    NakedAllocEngine::HashedAllocator alloc(Lease::TYPE_NA);
+
+    IOAddress first = alloc.pickAddress(subnet_, cc_, duid_, IOAddress("::"));
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_NA, first));
+
+    // The same client gets the same first candidate.
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(first, alloc.pickAddress(subnet_, cc_, duid_,
+                                           IOAddress("::")));
+    }
+
+    // Passing the previous candidate walks over all the pool without
+    // picking the same address twice.
+    uint64_t capacity = pool_->getCapacity();
+    std::set<IOAddress> picked;
+    IOAddress candidate = first;
+    for (uint64_t i = 0; i < capacity; ++i) {
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_NA, candidate));
+        EXPECT_TRUE(picked.insert(candidate).second);
+        candidate = alloc.pickAddress(subnet_, cc_, duid_, candidate);
+    }
+    EXPECT_EQ(first, candidate);
+}
+
+// This test verifies that the hashed allocator picks delegated prefixes
+// aligned on the delegated length.
+TEST_F(AllocEngine6Test, HashedAllocatorPrefix) {
+    NakedAllocEngine::HashedAllocator alloc(Lease::TYPE_PD);
+
+    subnet_.reset(new Subnet6(IOAddress("2001:db8::"), 32, 1, 2, 3, 4));
+    Pool6Ptr pool(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:1::"),
+                            48, 56));
+    subnet_->addPool(pool);
+
+    IOAddress first = alloc.pickAddress(subnet_, cc_, duid_, IOAddress("::"));
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_PD, first));
+    EXPECT_EQ(0, first.toBytes()[7]);
+    EXPECT_EQ(first, alloc.pickAddress(subnet_, cc_, duid_, IOAddress("::")));
+
+    // The next candidates are the next prefixes, wrapping at the end.
+    std::set<IOAddress> picked;
+    IOAddress candidate = first;
+    for (int i = 0; i < 256; ++i) {
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_PD, candidate));
+        EXPECT_TRUE(picked.insert(candidate).second);
+        candidate = alloc.pickAddress(subnet_, cc_, duid_, candidate);
+    }
+    EXPECT_EQ(first, candidate);
+}
+
+// This test verifies that the random allocator picks free addresses of
+// the pool without picking the same address twice.
+TEST_F(AllocEngine6Test, RandomAllocator) {
+    NakedAllocEngine::RandomAllocator alloc(Lease::TYPE_NA);
+
+    // One address is leased.
+    Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress("2001:db8:1::12"),
+                               duid_, iaid_, 300, 400, subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    alloc.buildState(subnet_, false);
+
+    uint64_t capacity = pool_->getCapacity();
+    std::set<IOAddress> picked;
+    for (uint64_t i = 0; i < capacity - 1; ++i) {
+        IOAddress candidate = alloc.pickAddress(subnet_, cc_, duid_,
+                                                IOAddress("::"));
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_NA, candidate));
+        EXPECT_NE(IOAddress("2001:db8:1::12"), candidate);
+        EXPECT_TRUE(picked.insert(candidate).second);
+        alloc.useAddress(subnet_, candidate);
+    }
+}
+
+// This test verifies that the random allocator picks delegated prefixes
+// aligned on the delegated length without picking one twice.
+TEST_F(AllocEngine6Test, RandomAllocatorPrefix) {
+    NakedAllocEngine::RandomAllocator alloc(Lease::TYPE_PD);
+    alloc.buildState(subnet_, false);
+
+    // The pool has 65536 /80 prefixes.
+    std::set<IOAddress> picked;
+    for (int i = 0; i < 1000; ++i) {
+        IOAddress candidate = alloc.pickAddress(subnet_, cc_, duid_,
+                                                IOAddress("::"));
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_PD, candidate));
+        EXPECT_EQ(0, candidate.toBytes()[10]);
+        EXPECT_EQ(0, candidate.toBytes()[11]);
+        EXPECT_TRUE(picked.insert(candidate).second);
+        alloc.useAddress(subnet_, candidate);
+    }
+}
+
+// This test verifies that the allocator used for a subnet follows the
+// allocator parameter of the subnet.
+TEST_F(AllocEngine6Test, getAllocatorSubnet) {
+    NakedAllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 100, true);
+
+    // By default the allocator given to the engine is used.
+    auto alloc = engine.getAllocator(Lease::TYPE_NA, subnet_);
+    ASSERT_TRUE(alloc);
+    EXPECT_TRUE(boost::dynamic_pointer_cast<NakedAllocEngine::IterativeAllocator>(alloc));
+
+    subnet_->setAllocatorType("hashed");
+    alloc = engine.getAllocator(Lease::TYPE_NA, subnet_);
+    ASSERT_TRUE(alloc);
+    EXPECT_TRUE(boost::dynamic_pointer_cast<NakedAllocEngine::HashedAllocator>(alloc));
+    alloc = engine.getAllocator(Lease::TYPE_PD, subnet_);
+    ASSERT_TRUE(alloc);
+    EXPECT_TRUE(boost::dynamic_pointer_cast<NakedAllocEngine::HashedAllocator>(alloc));
+
+    // Allocation works with the hashed allocator.
+    AllocEngine::ClientContext6 ctx(subnet_, duid_, false, false, "", false,
+                                    Pkt6Ptr(new Pkt6(DHCPV6_REQUEST, 1234)));
+    ctx.currentIA().iaid_ = iaid_;
+    Lease6Ptr lease;
+    EXPECT_NO_THROW(lease = expectOneLease(engine.allocateLeases6(ctx)));
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_NA, lease->addr_));
+}
+
 TEST_F(AllocEngine6Test, IterativeAllocatorAddrStep) {
     NakedAllocEngine::NakedIterativeAllocator alloc(Lease::TYPE_NA);
 
@@ -3352,9 +3477,10 @@ TEST_F(AllocEngine6Test, globalHostReservedAddress) {
     EXPECT_EQ("3001::1", lease->addr_.toText());
 
     // We're going to rollback the clock a little so we can verify a renewal.
-    // We verify the "time" change in case the lease returned to us
-    // by expectOneLease ever becomes a copy and not what is in the lease mgr.
+    // The lease returned to us by expectOneLease is a copy of what is in the
+    // lease mgr, so the change is written back and verified.
     --lease->cltt_;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease6(lease));
     Lease6Ptr from_mgr = LeaseMgrFactory::instance().getLease6(lease->type_,
                                                                lease->addr_);
     ASSERT_TRUE(from_mgr);
@@ -3416,9 +3542,10 @@ TEST_F(AllocEngine6Test, globalHostReservedPrefix) {
     EXPECT_EQ("3001::", lease->addr_.toText());
 
     // We're going to rollback the clock a little so we can verify a renewal.
-    // We verify the "time" change in case the lease returned to us
-    // by expectOneLease ever becomes a copy and not what is in the lease mgr.
+    // The lease returned to us by expectOneLease is a copy of what is in the
+    // lease mgr, so the change is written back and verified.
     --lease->cltt_;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease6(lease));
     Lease6Ptr from_mgr = LeaseMgrFactory::instance().getLease6(lease->type_,
                                                                lease->addr_);
     ASSERT_TRUE(from_mgr);
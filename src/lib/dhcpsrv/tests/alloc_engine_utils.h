@@ -62,6 +62,8 @@ public:
     // Expose internal classes for testing purposes
     using AllocEngine::Allocator;
     using AllocEngine::IterativeAllocator;
+    using AllocEngine::HashedAllocator;
+    using AllocEngine::RandomAllocator;
     using AllocEngine::getAllocator;
     using AllocEngine::updateLease4ExtendedInfo;
 
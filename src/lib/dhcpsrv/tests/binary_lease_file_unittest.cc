@@ -0,0 +1,328 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcpsrv/binary_lease_file.h>
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <dhcpsrv/testutils/lease_file_io.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+// HWADDR values used by unit tests.
+const uint8_t HWADDR0[] = { 0, 1, 2, 3, 4, 5 };
+const uint8_t HWADDR1[] = { 0xd, 0xe, 0xa, 0xd, 0xb, 0xe, 0xe, 0xf };
+
+const uint8_t CLIENTID[] = { 1, 2, 3, 4 };
+
+const uint8_t DUID0[] = { 0, 1, 2, 3, 4, 5, 6, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf };
+
+/// @brief Test fixture class for the binary lease files.
+class BinaryLeaseFileTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Initializes IO for lease files used by unit tests.
+    BinaryLeaseFileTest()
+        : filename_(absolutePath("leases.bin")), io_(filename_),
+          csv_filename_(absolutePath("leases4.csv")), csv_io_(csv_filename_) {
+        io_.removeFile();
+        csv_io_.removeFile();
+        hwaddr0_.reset(new HWAddr(HWADDR0, sizeof(HWADDR0), HTYPE_ETHER));
+        hwaddr1_.reset(new HWAddr(HWADDR1, sizeof(HWADDR1), HTYPE_ETHER));
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the lease files.
+    virtual ~BinaryLeaseFileTest() {
+        io_.removeFile();
+        csv_io_.removeFile();
+    }
+
+    /// @brief Prepends the absolute path to the file specified
+    /// as an argument.
+    ///
+    /// @param filename Name of the file.
+    /// @return Absolute path to the test file.
+    static std::string absolutePath(const std::string& filename) {
+        std::ostringstream s;
+        s << DHCP_DATA_DIR << "/" << filename;
+        return (s.str());
+    }
+
+    /// @brief Returns sample DHCPv4 leases.
+    std::vector<Lease4Ptr> createLeases4() const {
+        std::vector<Lease4Ptr> leases;
+        Lease4Ptr lease(new Lease4(IOAddress("192.0.2.1"), hwaddr0_,
+                                   CLIENTID, sizeof(CLIENTID), 200, 1000, 8,
+                                   true, true, "host.example.com"));
+        lease->hwaddr_->source_ = HWAddr::HWADDR_SOURCE_RAW;
+        leases.push_back(lease);
+
+        lease.reset(new Lease4(IOAddress("192.0.2.2"), hwaddr1_,
+                               NULL, 0, 100, 2000, 7, false, false,
+                               "host.example.com"));
+        lease->setContext(Element::fromJSON("{ \"foobar\": true }"));
+        leases.push_back(lease);
+
+        lease.reset(new Lease4(IOAddress("192.0.2.3"), HWAddrPtr(),
+                               NULL, 0, 100, 3000, 8));
+        lease->state_ = Lease::STATE_DECLINED;
+        leases.push_back(lease);
+        return (leases);
+    }
+
+    /// @brief Name of the test lease file.
+    std::string filename_;
+
+    /// @brief Object providing access to lease file IO.
+    LeaseFileIO io_;
+
+    /// @brief Name of the test CSV lease file.
+    std::string csv_filename_;
+
+    /// @brief Object providing access to the CSV lease file IO.
+    LeaseFileIO csv_io_;
+
+    /// @brief hardware address 0 (corresponds to HWADDR0 const)
+    HWAddrPtr hwaddr0_;
+
+    /// @brief hardware address 1 (corresponds to HWADDR1 const)
+    HWAddrPtr hwaddr1_;
+};
+
+// Checks that the DHCPv4 leases written to a file are read back.
+TEST_F(BinaryLeaseFileTest, roundTrip4) {
+    std::vector<Lease4Ptr> leases = createLeases4();
+    {
+        BinaryLeaseFile4 lf(filename_);
+        ASSERT_NO_THROW(lf.recreate());
+        for (auto lease : leases) {
+            ASSERT_NO_THROW(lf.append(*lease));
+        }
+        // A lease without any identifier is rejected.
+        Lease4 invalid(IOAddress("192.0.2.4"), HWAddrPtr(), NULL, 0, 100,
+                       1000, 8);
+        EXPECT_THROW(lf.append(invalid), BadValue);
+        ASSERT_NO_THROW(lf.close());
+        EXPECT_EQ(4, lf.getWrites());
+        EXPECT_EQ(3, lf.getWriteLeases());
+        EXPECT_EQ(1, lf.getWriteErrs());
+    }
+
+    EXPECT_TRUE(BinaryLeaseFile::isBinary(filename_));
+
+    BinaryLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    EXPECT_FALSE(lf.needsConversion());
+    Lease4Ptr lease;
+    for (auto expected : leases) {
+        ASSERT_TRUE(lf.next(lease)) << lf.getReadMsg();
+        ASSERT_TRUE(lease);
+        EXPECT_TRUE(*expected == *lease) << lease->toText();
+    }
+
+    // The end of the file.
+    ASSERT_TRUE(lf.next(lease));
+    EXPECT_FALSE(lease);
+    EXPECT_EQ(4, lf.getReads());
+    EXPECT_EQ(3, lf.getReadLeases());
+    EXPECT_EQ(0, lf.getReadErrs());
+}
+
+// Checks that the DHCPv6 leases written to a file are read back.
+TEST_F(BinaryLeaseFileTest, roundTrip6) {
+    DuidPtr duid(new DUID(DUID0, sizeof(DUID0)));
+    std::vector<Lease6Ptr> leases;
+    leases.push_back(Lease6Ptr(new Lease6(Lease::TYPE_NA,
+                                          IOAddress("2001:db8:1::1"), duid,
+                                          7, 100, 200, 8, true, true,
+                                          "host.example.com", hwaddr0_)));
+    leases.back()->cltt_ = 1000;
+    leases.back()->old_cltt_ = 1000;
+    leases.push_back(Lease6Ptr(new Lease6(Lease::TYPE_PD,
+                                          IOAddress("3000:1::"), duid,
+                                          8, 300, 400, 9, HWAddrPtr(), 64)));
+    leases.back()->setContext(Element::fromJSON("{ \"foobar\": true }"));
+    leases.push_back(Lease6Ptr(new Lease6(Lease::TYPE_NA,
+                                          IOAddress("2001:db8:1::2"),
+                                          DuidPtr(new DUID(DUID::EMPTY())),
+                                          0, 0, 0, 8)));
+    leases.back()->state_ = Lease::STATE_DECLINED;
+    {
+        BinaryLeaseFile6 lf(filename_);
+        ASSERT_NO_THROW(lf.recreate());
+        for (auto lease : leases) {
+            ASSERT_NO_THROW(lf.append(*lease));
+        }
+    }
+
+    BinaryLeaseFile6 lf(filename_);
+    ASSERT_NO_THROW(lf.open());
+    Lease6Ptr lease;
+    for (auto expected : leases) {
+        ASSERT_TRUE(lf.next(lease)) << lf.getReadMsg();
+        ASSERT_TRUE(lease);
+        EXPECT_TRUE(*expected == *lease) << lease->toText();
+    }
+    ASSERT_TRUE(lf.next(lease));
+    EXPECT_FALSE(lease);
+
+    // A DHCPv6 file can't be read as a DHCPv4 file.
+    BinaryLeaseFile4 lf4(filename_);
+    EXPECT_THROW(lf4.open(), BinaryLeaseFileError);
+}
+
+// Checks that files which are not complete binary lease files are
+// rejected.
+TEST_F(BinaryLeaseFileTest, invalidFiles) {
+    BinaryLeaseFile4 lf(filename_);
+
+    // No file.
+    EXPECT_FALSE(lf.exists());
+    EXPECT_FALSE(BinaryLeaseFile::isBinary(filename_));
+    EXPECT_THROW(lf.open(), BinaryLeaseFileError);
+
+    // A CSV file.
+    io_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                  "fqdn_fwd,fqdn_rev,hostname,state,user_context\n");
+    EXPECT_FALSE(BinaryLeaseFile::isBinary(filename_));
+    EXPECT_THROW(lf.open(), BinaryLeaseFileError);
+
+    // An unsupported version.
+    io_.writeFile(std::string("KEALEASE") + std::string(32, '\0'));
+    EXPECT_TRUE(BinaryLeaseFile::isBinary(filename_));
+    EXPECT_THROW(lf.open(), BinaryLeaseFileError);
+
+    // A file whose writing was interrupted.
+    const char incomplete[] = { 0, 1, 4, 0, 0, 0, 0, 76 };
+    io_.writeFile(std::string("KEALEASE") +
+                  std::string(incomplete, sizeof(incomplete)) +
+                  std::string(24, '\0'));
+    EXPECT_TRUE(BinaryLeaseFile::isBinary(filename_));
+    EXPECT_THROW(lf.open(), BinaryLeaseFileError);
+
+    // A truncated file.
+    std::vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_NO_THROW(lf.recreate());
+    for (auto lease : leases) {
+        ASSERT_NO_THROW(lf.append(*lease));
+    }
+    ASSERT_NO_THROW(lf.close());
+    ASSERT_NO_THROW(lf.open());
+    lf.close();
+    ASSERT_EQ(0, truncate(filename_.c_str(), BinaryLeaseFile::HEADER_SIZE +
+                          BinaryLeaseFile4::RECORD_SIZE));
+    EXPECT_THROW(lf.open(), BinaryLeaseFileError);
+}
+
+// Checks that the loader detects the format of the files.
+TEST_F(BinaryLeaseFileTest, loadFile) {
+    // The binary file holds the three sample leases.
+    std::vector<Lease4Ptr> leases = createLeases4();
+    {
+        BinaryLeaseFile4 lf(filename_);
+        lf.recreate();
+        for (auto lease : leases) {
+            lf.append(*lease);
+        }
+    }
+    // The CSV file updates the first lease and releases the second.
+    csv_io_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                      "fqdn_fwd,fqdn_rev,hostname,state,user_context\n"
+                      "192.0.2.1,06:07:08:09:0a:bc,,500,1500,8,1,1,"
+                      "host.example.com,0,\n"
+                      "192.0.2.2,,01:02:03,0,100,7,0,0,,0,\n");
+
+    Lease4Storage storage;
+    LeaseFileStats stats;
+    EXPECT_FALSE((LeaseFileLoader::loadFile<Lease4, CSVLeaseFile4>
+                  (filename_, storage, 0, stats)));
+    EXPECT_EQ(3, storage.size());
+    EXPECT_FALSE((LeaseFileLoader::loadFile<Lease4, CSVLeaseFile4>
+                  (csv_filename_, storage, 0, stats)));
+    ASSERT_EQ(2, storage.size());
+    EXPECT_EQ(7, stats.getReads());
+    EXPECT_EQ(5, stats.getReadLeases());
+    EXPECT_EQ(0, stats.getReadErrs());
+
+    // Last entry wins.
+    Lease4Ptr lease = storage.begin()->toLease();
+    EXPECT_EQ("192.0.2.1", lease->addr_.toText());
+    EXPECT_EQ(500, lease->valid_lft_);
+
+    // Write the leases back in the binary format and read them again.
+    io_.removeFile();
+    BinaryLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(LeaseFileLoader::write<Lease4>(lf, storage));
+    Lease4Storage storage2;
+    EXPECT_FALSE((LeaseFileLoader::loadFile<Lease4, CSVLeaseFile4>
+                  (filename_, storage2, 0, stats)));
+    ASSERT_EQ(2, storage2.size());
+    EXPECT_TRUE(*lease == *storage2.begin()->toLease());
+}
+
+// Checks that the records of a range are read and that the file is loaded
+// by chunks.
+TEST_F(BinaryLeaseFileTest, readRange) {
+    std::vector<Lease4Ptr> leases = createLeases4();
+    {
+        BinaryLeaseFile4 lf(filename_);
+        lf.recreate();
+        for (auto lease : leases) {
+            lf.append(*lease);
+        }
+    }
+
+    BinaryLeaseFile4 lf(filename_);
+    EXPECT_THROW(lf.setReadRange(0, 1), BinaryLeaseFileError);
+    ASSERT_NO_THROW(lf.open());
+    EXPECT_EQ(3, lf.getReadSize());
+    ASSERT_NO_THROW(lf.setReadRange(1, 2));
+    Lease4Ptr lease;
+    ASSERT_TRUE(lf.next(lease));
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(*leases[1] == *lease);
+    ASSERT_TRUE(lf.next(lease));
+    EXPECT_FALSE(lease);
+
+    // A range past the end is empty.
+    ASSERT_NO_THROW(lf.setReadRange(2, 10));
+    ASSERT_TRUE(lf.next(lease));
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(*leases[2] == *lease);
+    ASSERT_TRUE(lf.next(lease));
+    EXPECT_FALSE(lease);
+    lf.close();
+
+    // Load the file by chunks of one record.
+    Lease4Storage storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(lf, storage, 0, true, 2, 1));
+    ASSERT_EQ(3, storage.size());
+    EXPECT_EQ(4, lf.getReads());
+    EXPECT_EQ(3, lf.getReadLeases());
+    size_t i = 0;
+    for (auto it = storage.begin(); it != storage.end(); ++it, ++i) {
+        EXPECT_TRUE(*leases[i] == *it->toLease());
+    }
+}
+
+} // end of anonymous namespace
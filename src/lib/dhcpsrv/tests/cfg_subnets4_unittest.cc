@@ -851,6 +851,85 @@ TEST(CfgSubnets4Test, selectSubnetNoCiaddr) {
     EXPECT_FALSE(cfg.selectSubnet(selector));
 }
 
+// This test verifies that when several subnets include the client address
+// the first one in the configuration order is selected.
+TEST(CfgSubnets4Test, selectOverlappingSubnets) {
+    CfgSubnets4 cfg;
+
+    // Create 3 overlapping subnets, not ordered by prefix length.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3, 1));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 2));
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.0.0.0"), 16, 1, 2, 3, 3));
+    cfg.add(subnet1);
+    cfg.add(subnet2);
+    cfg.add(subnet3);
+
+    SubnetSelector selector;
+    selector.local_address_ = IOAddress("10.0.0.100");
+    selector.remote_address_ = IOAddress("192.0.2.1");
+    EXPECT_EQ(subnet1, cfg.selectSubnet(selector));
+    selector.remote_address_ = IOAddress("192.0.3.1");
+    EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+
+    // The first subnet is skipped when the client is not supported.
+    subnet1->allowClientClass("foo");
+    selector.remote_address_ = IOAddress("192.0.2.1");
+    EXPECT_EQ(subnet2, cfg.selectSubnet(selector));
+    selector.remote_address_ = IOAddress("192.0.2.100");
+    EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+    selector.client_classes_.insert("foo");
+    EXPECT_EQ(subnet1, cfg.selectSubnet(selector));
+
+    // Deleted subnets are no longer selected.
+    cfg.del(subnet1);
+    selector.remote_address_ = IOAddress("192.0.2.1");
+    EXPECT_EQ(subnet2, cfg.selectSubnet(selector));
+    cfg.del(subnet2);
+    EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+}
+
+// This test verifies that the subnet selection index is a snapshot which
+// is replaced when the subnets change or when it is explicitly rebuilt.
+TEST(CfgSubnets4Test, selectionIndexSnapshot) {
+    CfgSubnets4 cfg;
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 1));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.64"), 26, 1, 2, 3, 2));
+    cfg.add(subnet1);
+
+    // The index is kept until the subnets change.
+    CfgSubnets4::ConstSelectionIndexPtr index = cfg.getSelectionIndex();
+    ASSERT_TRUE(index);
+    EXPECT_EQ(index, cfg.getSelectionIndex());
+    cfg.add(subnet2);
+    CfgSubnets4::ConstSelectionIndexPtr new_index = cfg.getSelectionIndex();
+    ASSERT_TRUE(new_index);
+    EXPECT_NE(index, new_index);
+
+    // The previous index remains usable by its holders.
+    ClientClasses classes;
+    EXPECT_FALSE(index->selectByAddress(IOAddress("192.0.2.65"), classes));
+    EXPECT_EQ(subnet2,
+              new_index->selectByAddress(IOAddress("192.0.2.65"), classes));
+
+    // The relay addresses modified in place are taken into account by the
+    // next lookup.
+    subnet2->addRelayAddress(IOAddress("10.0.0.1"));
+    index = cfg.getSelectionIndex();
+    EXPECT_NE(new_index, index);
+    EXPECT_EQ(subnet2, index->selectByRelay(IOAddress("10.0.0.1"), classes));
+    EXPECT_EQ(index, cfg.getSelectionIndex());
+
+    // So are the changes of a shared network the subnet belongs to.
+    SharedNetwork4Ptr network(new SharedNetwork4("frog"));
+    network->add(subnet1);
+    index = cfg.getSelectionIndex();
+    network->setIface("eth1");
+    EXPECT_NE(index, cfg.getSelectionIndex());
+    EXPECT_EQ(subnet1,
+              cfg.getSelectionIndex()->selectByIface("eth1", classes));
+}
+
 // This test verifies that the subnet can be selected using an address
 // set on the local interface.
 TEST(CfgSubnets4Test, selectSubnetInterface) {
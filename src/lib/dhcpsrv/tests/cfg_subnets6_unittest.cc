@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -253,6 +253,42 @@ TEST(CfgSubnets6Test, selectSubnetByRelayAddress) {
     EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
 }
 
+// This test checks that when several subnets include the client address
+// the first one in the configuration order is selected.
+TEST(CfgSubnets6Test, selectOverlappingSubnets) {
+    CfgSubnets6 cfg;
+
+    // Configure 3 overlapping subnets, not ordered by prefix length.
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 1));
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4, 2));
+    Subnet6Ptr subnet3(new Subnet6(IOAddress("2001:db8::"), 32, 1, 2, 3, 4, 3));
+    cfg.add(subnet1);
+    cfg.add(subnet2);
+    cfg.add(subnet3);
+
+    SubnetSelector selector;
+    selector.remote_address_ = IOAddress("2001:db8:1::1");
+    EXPECT_EQ(subnet1, cfg.selectSubnet(selector));
+    selector.remote_address_ = IOAddress("2001:db8:2::1");
+    EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+
+    // The first subnet is skipped when the client is not supported.
+    subnet1->allowClientClass("foo");
+    selector.remote_address_ = IOAddress("2001:db8:1::1");
+    EXPECT_EQ(subnet2, cfg.selectSubnet(selector));
+    selector.remote_address_ = IOAddress("2001:db8:1:1::1");
+    EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+    selector.client_classes_.insert("foo");
+    EXPECT_EQ(subnet1, cfg.selectSubnet(selector));
+
+    // Deleted subnets are no longer selected.
+    cfg.del(subnet1);
+    selector.remote_address_ = IOAddress("2001:db8:1::1");
+    EXPECT_EQ(subnet2, cfg.selectSubnet(selector));
+    cfg.del(subnet2);
+    EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+}
+
 // This test checks that subnet can be selected using a relay agent's
 // link address specified on the shared network level.
 TEST(CfgSubnets6Test, selectSubnetByNetworkRelayAddress) {
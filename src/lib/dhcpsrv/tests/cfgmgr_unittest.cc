@@ -633,6 +633,44 @@ TEST_F(CfgMgrTest, commitStats4) {
     EXPECT_EQ("00:00:02", durationToText(total_addrs->getMaxSampleAge().second, 0));
 }
 
+// This test verifies that the inherited parameters of the networks are
+// cached when the configuration is committed and that a staging
+// configuration which is not committed leaves them cached.
+TEST_F(CfgMgrTest, cacheNetworkProperties) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    startBackend(AF_INET);
+    FetchNetworkGlobalsFn fetch_globals = []() -> ConstElementPtr {
+        return (CfgMgr::instance().getCurrentCfg()->getConfiguredGlobals());
+    };
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3, 1));
+    subnet1->setFetchGlobalsFn(fetch_globals);
+    cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet1);
+    cfg_mgr.getStagingCfg()->addConfiguredGlobal("ddns-qualifying-suffix",
+                                                 Element::create("example.org"));
+    cfg_mgr.commit();
+    ASSERT_TRUE(subnet1->hasCachedProperties());
+    EXPECT_EQ("example.org", subnet1->getDdnsQualifyingSuffix().get());
+
+    // Parse a new configuration but don't commit it, as config-test does.
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3, 1));
+    subnet2->setFetchGlobalsFn(fetch_globals);
+    subnet2->setStoreExtendedInfo(true);
+    cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet2);
+    cfg_mgr.getStagingCfg()->addConfiguredGlobal("ddns-qualifying-suffix",
+                                                 Element::create("example.com"));
+    EXPECT_FALSE(subnet2->hasCachedProperties());
+
+    // The subnet of the current configuration still uses its cache.
+    EXPECT_TRUE(subnet1->hasCachedProperties());
+    EXPECT_EQ("example.org", subnet1->getDdnsQualifyingSuffix().get());
+
+    // Committing the new configuration caches its parameters.
+    cfg_mgr.commit();
+    ASSERT_TRUE(subnet2->hasCachedProperties());
+    EXPECT_EQ("example.com", subnet2->getDdnsQualifyingSuffix().get());
+}
+
 // This test verifies that once the configuration is merged into the current
 // configuration, statistics are updated appropriately.
 TEST_F(CfgMgrTest, mergeIntoCurrentStats4) {
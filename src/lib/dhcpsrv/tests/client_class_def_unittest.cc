@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -418,6 +418,79 @@ TEST(ClientClassDictionary, dependency) {
     EXPECT_EQ("cc4", depend);
 }
 
+// Tests that the classes nothing depends on are marked as not used.
+TEST(ClientClassDictionary, updateUsed) {
+    ClientClassDictionaryPtr dictionary(new ClientClassDictionary());
+    ExpressionPtr expr;
+    CfgOptionPtr cfg_option;
+
+    // A class with an option.
+    CfgOptionPtr options(new CfgOption());
+    OptionPtr option(new Option(Option::V4, 17, OptionBuffer(10, 0xFF)));
+    ASSERT_NO_THROW(options->add(option, false, DHCP4_OPTION_SPACE));
+    ASSERT_NO_THROW(dictionary->addClass("option", expr, "", false,
+                                         false, options));
+
+    // A class with a fixed field.
+    ASSERT_NO_THROW(dictionary->addClass("filename", expr, "", false,
+                                         false, cfg_option, CfgOptionDefPtr(),
+                                         data::ConstElementPtr(),
+                                         IOAddress("0.0.0.0"), "", "boot"));
+
+    // A required class.
+    ASSERT_NO_THROW(dictionary->addClass("required", expr, "", true,
+                                         false, cfg_option));
+
+    // A class referenced by the configuration.
+    ASSERT_NO_THROW(dictionary->addClass("referenced", expr, "", false,
+                                         false, cfg_option));
+
+    // Classes only another class depends on.
+    ASSERT_NO_THROW(dictionary->addClass("base", expr, "", false,
+                                         false, cfg_option));
+    ASSERT_NO_THROW(dictionary->addClass("unused-base", expr, "", false,
+                                         false, cfg_option));
+
+    // A class nothing depends on.
+    ASSERT_NO_THROW(dictionary->addClass("unused", expr, "", false,
+                                         false, cfg_option));
+
+    // A used class depending on base.
+    ExpressionPtr expr1(new Expression());
+    expr1->push_back(TokenPtr(new TokenMember("base")));
+    ASSERT_NO_THROW(dictionary->addClass("dependent", expr1, "", true,
+                                         false, cfg_option));
+
+    // An unused class depending on unused-base.
+    ExpressionPtr expr2(new Expression());
+    expr2->push_back(TokenPtr(new TokenMember("unused-base")));
+    ASSERT_NO_THROW(dictionary->addClass("unused-dependent", expr2, "", false,
+                                         false, cfg_option));
+
+    // All classes are used by default.
+    for (auto def : *dictionary->getClasses()) {
+        EXPECT_TRUE(def->getUsed()) << def->getName();
+    }
+
+    std::set<std::string> referenced;
+    referenced.insert("referenced");
+    ASSERT_NO_THROW(dictionary->updateUsed(referenced));
+
+    EXPECT_TRUE(dictionary->findClass("option")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("filename")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("required")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("referenced")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("base")->getUsed());
+    EXPECT_FALSE(dictionary->findClass("unused-base")->getUsed());
+    EXPECT_FALSE(dictionary->findClass("unused")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("dependent")->getUsed());
+    EXPECT_FALSE(dictionary->findClass("unused-dependent")->getUsed());
+
+    // The flag is copied.
+    ClientClassDef copy(*dictionary->findClass("unused"));
+    EXPECT_FALSE(copy.getUsed());
+}
+
 // Tests the default constructor regarding fixed fields
 TEST(ClientClassDef, fixedFieldsDefaults) {
     boost::scoped_ptr<ClientClassDef> cclass;
@@ -82,6 +82,14 @@ TEST_F(DHCPQueueControlParserTest, validContent) {
         "   \"foo\": \"bogus\", \n"
         "   \"random-int\" : 1234 \n"
         "} \n"
+        },
+        {
+        "queue enabled with receiver-threads",
+        "{ \n"
+        "   \"enable-queue\": true, \n"
+        "   \"queue-type\": \"some-type\", \n"
+        "   \"receiver-threads\": 64 \n"
+        "} \n"
         }
     };
 
@@ -147,6 +155,30 @@ TEST_F(DHCPQueueControlParserTest, invalidContent) {
         "   \"enable-queue\": true, \n"
         "   \"queue-type\": 7777 \n"
         "} \n"
+        },
+        {
+        "receiver-threads not an integer",
+        "{ \n"
+        "   \"enable-queue\": true, \n"
+        "   \"queue-type\": \"some-type\", \n"
+        "   \"receiver-threads\": \"2\" \n"
+        "} \n"
+        },
+        {
+        "receiver-threads zero",
+        "{ \n"
+        "   \"enable-queue\": true, \n"
+        "   \"queue-type\": \"some-type\", \n"
+        "   \"receiver-threads\": 0 \n"
+        "} \n"
+        },
+        {
+        "receiver-threads too large",
+        "{ \n"
+        "   \"enable-queue\": true, \n"
+        "   \"queue-type\": \"some-type\", \n"
+        "   \"receiver-threads\": 65 \n"
+        "} \n"
         }
     };
 
@@ -0,0 +1,246 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option.h>
+#include <dhcp/option_space.h>
+#include <dhcp/option_string.h>
+#include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/flat_cfg_option.h>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for the flattened option configurations.
+class FlatCfgOptionTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the list of configurations of the tests.
+    FlatCfgOptionTest() {
+        FlatCfgOption::clearCache();
+        for (int i = 0; i < 3; ++i) {
+            cfgs_.push_back(CfgOptionPtr(new CfgOption()));
+            list_.push_back(cfgs_.back());
+        }
+    }
+
+    /// @brief Destructor.
+    virtual ~FlatCfgOptionTest() {
+        FlatCfgOption::clearCache();
+    }
+
+    /// @brief Adds an option to a configuration.
+    ///
+    /// @param cfg The configuration.
+    /// @param code The option code.
+    /// @param value The option value.
+    /// @param persistent The option is always sent.
+    /// @param space The option space.
+    void add(const CfgOptionPtr& cfg, uint16_t code, const std::string& value,
+             bool persistent = false,
+             const std::string& space = DHCP6_OPTION_SPACE) {
+        OptionPtr option(new OptionString(Option::V6, code, value));
+        cfg->add(option, persistent, space);
+    }
+
+    /// @brief Returns the value of an option.
+    ///
+    /// @param option The option.
+    /// @return The value or an empty string.
+    static std::string value(const OptionPtr& option) {
+        OptionStringPtr option_string =
+            boost::dynamic_pointer_cast<OptionString>(option);
+        return (option_string ? option_string->getValue() : "");
+    }
+
+    /// @brief The configurations.
+    std::vector<CfgOptionPtr> cfgs_;
+
+    /// @brief The list of configurations.
+    CfgOptionList list_;
+};
+
+// Checks that an option is taken from the first configuration which
+// configures it.
+TEST_F(FlatCfgOptionTest, cascade) {
+    add(cfgs_[0], 100, "first");
+    add(cfgs_[1], 100, "second");
+    add(cfgs_[1], 101, "second");
+    add(cfgs_[2], 101, "third");
+    add(cfgs_[2], 102, "third");
+
+    CfgOptionListResolver resolver(list_);
+    EXPECT_EQ("first", value(resolver.get(DHCP6_OPTION_SPACE, 100)));
+    EXPECT_EQ("second", value(resolver.get(DHCP6_OPTION_SPACE, 101)));
+    EXPECT_EQ("third", value(resolver.get(DHCP6_OPTION_SPACE, 102)));
+    EXPECT_FALSE(resolver.get(DHCP6_OPTION_SPACE, 103));
+    EXPECT_FALSE(resolver.get("unknown", 100));
+
+    // The same option instances as in the configurations are returned.
+    EXPECT_EQ(cfgs_[0]->get(DHCP6_OPTION_SPACE, 100).option_,
+              resolver.get(DHCP6_OPTION_SPACE, 100));
+}
+
+// Checks that the codes of the persistent options are returned in the
+// order of the configurations.
+TEST_F(FlatCfgOptionTest, persistent) {
+    add(cfgs_[0], 100, "first", true);
+    add(cfgs_[1], 101, "second");
+    add(cfgs_[1], 102, "second", true);
+    add(cfgs_[2], 100, "third", true);
+    add(cfgs_[2], 103, "third");
+
+    // The persistent options of a configuration are not ordered, so
+    // the configurations have one persistent option each.
+    CfgOptionListResolver resolver(list_);
+    std::vector<uint16_t> codes(1, 1);
+    resolver.getPersistent(DHCP6_OPTION_SPACE, codes);
+    std::vector<uint16_t> expected = { 1, 100, 102, 100 };
+    EXPECT_EQ(expected, codes);
+
+    codes.clear();
+    resolver.getPersistent("unknown", codes);
+    EXPECT_TRUE(codes.empty());
+}
+
+// Checks the vendor options.
+TEST_F(FlatCfgOptionTest, vendor) {
+    add(cfgs_[1], 1, "second", true, "vendor-4491");
+    add(cfgs_[2], 1, "third", false, "vendor-4491");
+    add(cfgs_[2], 2, "third", true, "vendor-4491");
+
+    CfgOptionListResolver resolver(list_);
+    EXPECT_EQ("second", value(resolver.get(4491, 1)));
+    EXPECT_EQ("third", value(resolver.get(4491, 2)));
+    EXPECT_FALSE(resolver.get(4491, 3));
+    EXPECT_FALSE(resolver.get(1234, 1));
+
+    std::vector<uint16_t> codes;
+    resolver.getPersistent(4491, codes);
+    std::vector<uint16_t> expected = { 1, 2 };
+    EXPECT_EQ(expected, codes);
+}
+
+// Checks that the configurations specific to a client are searched first
+// and are not cached.
+TEST_F(FlatCfgOptionTest, clientSpecific) {
+    CfgOptionPtr host(new CfgOption());
+    host->setClientSpecific(true);
+    add(host, 100, "host", true);
+    list_.insert(list_.begin(), host);
+    add(cfgs_[1], 100, "first", true);
+    add(cfgs_[1], 101, "first");
+
+    CfgOptionListResolver resolver(list_);
+    EXPECT_EQ("host", value(resolver.get(DHCP6_OPTION_SPACE, 100)));
+    EXPECT_EQ("first", value(resolver.get(DHCP6_OPTION_SPACE, 101)));
+    std::vector<uint16_t> codes;
+    resolver.getPersistent(DHCP6_OPTION_SPACE, codes);
+    std::vector<uint16_t> expected = { 100, 100 };
+    EXPECT_EQ(expected, codes);
+
+    // Only the rest of the list is cached.
+    EXPECT_EQ(1, FlatCfgOption::getCacheSize());
+    CfgOptionList rest(std::next(list_.begin()), list_.end());
+    CfgOptionListResolver rest_resolver(rest);
+    EXPECT_EQ(1, FlatCfgOption::getCacheSize());
+
+    // Modifying the host options does not empty the cache.
+    uint64_t generation = CfgOption::getGeneration();
+    add(host, 101, "host");
+    EXPECT_EQ(generation, CfgOption::getGeneration());
+    EXPECT_EQ("host", value(resolver.get(DHCP6_OPTION_SPACE, 101)));
+}
+
+// Checks that the flattened options are cached until a configuration
+// is modified.
+TEST_F(FlatCfgOptionTest, cache) {
+    add(cfgs_[0], 100, "first");
+    ConstFlatCfgOptionPtr flat = FlatCfgOption::create(list_.begin(),
+                                                       list_.end());
+    ASSERT_TRUE(flat);
+    EXPECT_EQ(1, FlatCfgOption::getCacheSize());
+    EXPECT_EQ(flat, FlatCfgOption::create(list_.begin(), list_.end()));
+
+    // Another list gets other flattened options.
+    ConstFlatCfgOptionPtr other = FlatCfgOption::create(std::next(list_.begin()),
+                                                        list_.end());
+    EXPECT_NE(flat, other);
+    EXPECT_FALSE(other->get(DHCP6_OPTION_SPACE, 100));
+    EXPECT_EQ(2, FlatCfgOption::getCacheSize());
+
+    // Modifying a configuration invalidates the cache.
+    uint64_t generation = CfgOption::getGeneration();
+    add(cfgs_[2], 101, "third");
+    EXPECT_LT(generation, CfgOption::getGeneration());
+    ConstFlatCfgOptionPtr updated = FlatCfgOption::create(list_.begin(),
+                                                          list_.end());
+    EXPECT_NE(flat, updated);
+    EXPECT_EQ(1, FlatCfgOption::getCacheSize());
+    EXPECT_EQ("third", value(updated->get(DHCP6_OPTION_SPACE, 101)));
+    EXPECT_FALSE(flat->get(DHCP6_OPTION_SPACE, 101));
+
+    // Destroying a configuration invalidates it too.
+    generation = CfgOption::getGeneration();
+    list_.pop_back();
+    cfgs_.pop_back();
+    EXPECT_LT(generation, CfgOption::getGeneration());
+}
+
+// Checks that the size of the cache is bounded.
+TEST_F(FlatCfgOptionTest, cacheSize) {
+    CfgOptionList cfgs;
+    for (size_t i = 0; i < FlatCfgOption::MAX_CACHE_SIZE; ++i) {
+        cfgs.push_back(CfgOptionPtr(new CfgOption()));
+    }
+    for (auto cfg = cfgs.begin(); cfg != cfgs.end(); ++cfg) {
+        FlatCfgOption::create(cfg, std::next(cfg));
+    }
+    EXPECT_EQ(FlatCfgOption::MAX_CACHE_SIZE, FlatCfgOption::getCacheSize());
+    FlatCfgOption::create(cfgs.begin(), std::next(cfgs.begin(), 2));
+    EXPECT_EQ(1, FlatCfgOption::getCacheSize());
+}
+
+// Checks that the flattened options created by concurrent threads are
+// all published in the cache.
+TEST_F(FlatCfgOptionTest, concurrentCreate) {
+    add(cfgs_[0], 100, "first");
+    CfgOptionList cfgs;
+    for (size_t i = 0; i < 64; ++i) {
+        cfgs.push_back(CfgOptionPtr(new CfgOption()));
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+        threads.push_back(std::thread([&cfgs]() {
+            for (auto cfg = cfgs.begin(); cfg != cfgs.end(); ++cfg) {
+                FlatCfgOption::create(cfg, std::next(cfg));
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(cfgs.size(), FlatCfgOption::getCacheSize());
+
+    // The cached flattened options are returned.
+    ConstFlatCfgOptionPtr flat = FlatCfgOption::create(cfgs.begin(),
+                                                       std::next(cfgs.begin()));
+    EXPECT_EQ(flat, FlatCfgOption::create(cfgs.begin(), std::next(cfgs.begin())));
+    EXPECT_EQ(cfgs.size(), FlatCfgOption::getCacheSize());
+}
+
+} // end of anonymous namespace
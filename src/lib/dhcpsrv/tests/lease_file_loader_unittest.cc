@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -70,10 +70,12 @@ public:
         // Both Lease4Storage and Lease6Storage use index 0 to retrieve the
         // lease using an IP address.
         const SearchIndex& idx = storage.template get<0>();
-        typename SearchIndex::iterator lease = idx.find(IOAddress(address));
-        // Lease found. Return it.
+        typedef typename LeaseStorage::value_type EntryType;
+        typename SearchIndex::iterator lease =
+            idx.find(EntryType::addressKey(IOAddress(address)));
+        // Lease found. Materialize it.
         if (lease != idx.end()) {
-            return (*lease);
+            return (lease->toLease());
         }
         // No lease found.
         return (LeasePtrType());
@@ -877,4 +879,106 @@ TEST_F(LeaseFileLoaderTest, sanityChecker6PD) {
                   prefix_len);
 }
 
+// This test verifies that a DHCPv4 lease file parsed by chunks gives the
+// same leases and statistics as a sequential load, whether the storage
+// is built from the merged leases or updated.
+TEST_F(LeaseFileLoaderTest, loadChunks4) {
+    // Many entries for a few addresses, with updates, releases and
+    // invalid entries spread over the chunks.
+    std::ostringstream os;
+    os << v4_hdr_;
+    for (int i = 0; i < 300; ++i) {
+        os << "192.0.2." << (i % 37) << ",";
+        // Some entries have neither hardware address nor client id.
+        if (i % 29 != 0) {
+            os << "06:07:08:09:0a:" << std::hex << (i % 200) << std::dec;
+        }
+        // Some entries release the lease.
+        os << ",," << (i % 11 == 0 ? 0 : 200) << "," << (1000 + i)
+           << ",8,1,1,host" << i << ".example.com,0,\n";
+    }
+    io_.writeFile(os.str());
+
+    CSVLeaseFile4 seq_lf(filename_);
+    Lease4Storage seq_storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(seq_lf, seq_storage, 0));
+    ASSERT_FALSE(seq_storage.empty());
+
+    for (size_t chunk_size : { 64, 200, 1000 }) {
+        SCOPED_TRACE(chunk_size);
+
+        // An empty storage is built from the merged leases.
+        CSVLeaseFile4 lf(filename_);
+        Lease4Storage storage;
+        ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(lf, storage, 0, true, 4,
+                                                      chunk_size));
+        checkStats(lf, seq_lf.getReads(), seq_lf.getReadLeases(),
+                   seq_lf.getReadErrs(), 0, 0, 0);
+        ASSERT_EQ(seq_storage.size(), storage.size());
+        auto seq_it = seq_storage.begin();
+        for (auto it = storage.begin(); it != storage.end(); ++it, ++seq_it) {
+            EXPECT_TRUE(*seq_it->toLease() == *it->toLease())
+                << it->toLease()->toText();
+        }
+
+        // A storage holding leases is updated.
+        Lease4Storage updated;
+        HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06")));
+        Lease4Ptr lease(new Lease4(IOAddress("192.0.2.200"), hwaddr,
+                                   0, 0, 100, 0, 8));
+        updated.insert(Lease4Entry(*lease));
+        ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(lf, updated, 0, true, 4,
+                                                      chunk_size));
+        EXPECT_EQ(seq_storage.size() + 1, updated.size());
+        EXPECT_TRUE(getLease<Lease4Ptr>("192.0.2.200", updated));
+        for (auto it = seq_storage.begin(); it != seq_storage.end(); ++it) {
+            Lease4Ptr expected = it->toLease();
+            Lease4Ptr loaded = getLease<Lease4Ptr>(expected->addr_.toText(),
+                                                   updated);
+            ASSERT_TRUE(loaded);
+            EXPECT_TRUE(*expected == *loaded);
+        }
+    }
+}
+
+// This test verifies that a DHCPv6 lease file parsed by chunks gives the
+// same leases as a sequential load, and that the maximum number of errors
+// is enforced.
+TEST_F(LeaseFileLoaderTest, loadChunks6) {
+    std::ostringstream os;
+    os << v6_hdr_;
+    for (int i = 0; i < 200; ++i) {
+        os << "2001:db8:1::" << std::hex << (i % 23) << std::dec
+           << ",00:01:02:03:04:05:06:0a:0b:0c:0d:0e:" << std::hex << (i % 100)
+           << std::dec << "," << (i % 13 == 0 ? 0 : 200) << "," << (1000 + i)
+           << ",8,100,0,7,0,1,1,host.example.com,,0,\n";
+    }
+    // A few invalid entries.
+    for (int i = 0; i < 3; ++i) {
+        os << "2001:db8:1::1,,200,200,8,100,0,7,0,1,1,,\n";
+    }
+    io_.writeFile(os.str());
+
+    CSVLeaseFile6 seq_lf(filename_);
+    Lease6Storage seq_storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease6>(seq_lf, seq_storage, 0));
+
+    CSVLeaseFile6 lf(filename_);
+    Lease6Storage storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease6>(lf, storage, 0, true, 3, 100));
+    checkStats(lf, seq_lf.getReads(), seq_lf.getReadLeases(),
+               seq_lf.getReadErrs(), 0, 0, 0);
+    ASSERT_EQ(seq_storage.size(), storage.size());
+    auto seq_it = seq_storage.begin();
+    for (auto it = storage.begin(); it != storage.end(); ++it, ++seq_it) {
+        EXPECT_TRUE(*seq_it->toLease() == *it->toLease())
+            << it->toLease()->toText();
+    }
+
+    // Exceeding the maximum number of errors fails the load.
+    Lease6Storage failed;
+    EXPECT_THROW(LeaseFileLoader::load<Lease6>(lf, failed, 2, true, 3, 100),
+                 util::CSVFileError);
+}
+
 } // end of anonymous namespace
@@ -0,0 +1,230 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/memfile_lease_entry.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+
+#include <boost/tuple/tuple.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Returns a vector of consecutive bytes.
+///
+/// @param size Number of bytes.
+/// @param first Value of the first byte.
+std::vector<uint8_t>
+makeBytes(size_t size, uint8_t first = 1) {
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(first + i);
+    }
+    return (bytes);
+}
+
+/// @brief Returns a DHCPv4 lease with all the fields set.
+///
+/// @param address The address of the lease.
+/// @param client_id_len Length of the client identifier.
+Lease4Ptr
+makeLease4(const std::string& address, size_t client_id_len = 7) {
+    HWAddrPtr hwaddr(new HWAddr(makeBytes(6), HTYPE_ETHER));
+    hwaddr->source_ = HWAddr::HWADDR_SOURCE_RAW;
+    ClientIdPtr client_id(new ClientId(makeBytes(client_id_len, 10)));
+    Lease4Ptr lease(new Lease4(IOAddress(address), hwaddr, client_id,
+                               3600, 1000, 5, true, false,
+                               "host.example.org"));
+    lease->state_ = Lease::STATE_DECLINED;
+    lease->setContext(Element::fromJSON("{ \"foo\": 1 }"));
+    return (lease);
+}
+
+/// @brief Returns a DHCPv6 lease with all the fields set.
+///
+/// @param address The address of the lease.
+/// @param duid_len Length of the DUID.
+Lease6Ptr
+makeLease6(const std::string& address, size_t duid_len = 14) {
+    DuidPtr duid(new DUID(makeBytes(duid_len, 20)));
+    HWAddrPtr hwaddr(new HWAddr(makeBytes(6), HTYPE_ETHER));
+    Lease6Ptr lease(new Lease6(Lease::TYPE_PD, IOAddress(address), duid, 77,
+                               1800, 3600, 8, false, true, "", hwaddr, 56));
+    lease->cltt_ = 2000;
+    lease->old_cltt_ = 2000;
+    return (lease);
+}
+
+// Checks that the references order the bytes as vectors.
+TEST(BytesRefTest, order) {
+    std::vector<std::vector<uint8_t> > values = {
+        {}, { 0 }, { 1 }, { 1, 0 }, { 1, 2 }, { 2 }, { 255, 0 }
+    };
+    for (auto first : values) {
+        for (auto second : values) {
+            EXPECT_EQ(first < second, BytesRef(first) < BytesRef(second));
+            EXPECT_EQ(first == second, BytesRef(first) == BytesRef(second));
+        }
+    }
+    EXPECT_EQ(values[4], BytesRef(values[4]).toVector());
+}
+
+// Checks the short and the long compact byte strings.
+TEST(CompactBytesTest, storage) {
+    std::vector<uint8_t> short_bytes = makeBytes(4);
+    std::vector<uint8_t> long_bytes = makeBytes(40);
+
+    CompactBytes<8> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(0, empty.size());
+
+    CompactBytes<8> short_string(&short_bytes[0], short_bytes.size());
+    CompactBytes<8> long_string(&long_bytes[0], long_bytes.size());
+    EXPECT_EQ(short_bytes, short_string.ref().toVector());
+    EXPECT_EQ(long_bytes, long_string.ref().toVector());
+
+    // Copies do not share the allocated bytes.
+    CompactBytes<8> copy(long_string);
+    EXPECT_NE(long_string.data(), copy.data());
+    EXPECT_EQ(long_bytes, copy.ref().toVector());
+    copy = short_string;
+    EXPECT_EQ(short_bytes, copy.ref().toVector());
+    copy = long_string;
+    EXPECT_EQ(long_bytes, copy.ref().toVector());
+
+    // Moves take the allocated bytes.
+    const uint8_t* data = copy.data();
+    CompactBytes<8> moved(std::move(copy));
+    EXPECT_EQ(data, moved.data());
+    EXPECT_TRUE(copy.empty());
+    moved = std::move(short_string);
+    EXPECT_EQ(short_bytes, moved.ref().toVector());
+}
+
+// Checks that the equal strings share their value.
+TEST(InternedStringTest, share) {
+    size_t pool_size = InternedString::getPoolSize();
+    {
+        InternedString empty("");
+        EXPECT_EQ("", empty.get());
+        EXPECT_EQ(pool_size, InternedString::getPoolSize());
+
+        InternedString first(std::string("host.example.org"));
+        InternedString second(std::string("host.example.org"));
+        InternedString other(std::string("other.example.org"));
+        EXPECT_EQ("host.example.org", first.get());
+        EXPECT_EQ(&first.get(), &second.get());
+        EXPECT_NE(&first.get(), &other.get());
+        EXPECT_EQ(pool_size + 2, InternedString::getPoolSize());
+
+        InternedString copy(first);
+        first = InternedString();
+        second = InternedString();
+        EXPECT_EQ("host.example.org", copy.get());
+        EXPECT_EQ(pool_size + 2, InternedString::getPoolSize());
+    }
+    // The values are released with their last string.
+    EXPECT_EQ(pool_size, InternedString::getPoolSize());
+}
+
+// Checks that a DHCPv4 lease is materialized from its entry.
+TEST(Lease4EntryTest, toLease) {
+    Lease4Ptr lease = makeLease4("192.0.2.3");
+    Lease4Entry entry(*lease);
+    EXPECT_EQ(lease->addr_, entry.getAddress());
+    EXPECT_EQ(lease->getHWAddrVector(), entry.getHWAddrKey().toVector());
+    EXPECT_EQ(lease->getClientIdVector(), entry.getClientIdKey().toVector());
+    EXPECT_EQ(lease->getExpirationTime(), entry.getExpirationTime());
+
+    Lease4Ptr materialized = entry.toLease();
+    ASSERT_TRUE(materialized);
+    EXPECT_TRUE(*lease == *materialized);
+    EXPECT_EQ(HWAddr::HWADDR_SOURCE_RAW, materialized->hwaddr_->source_);
+
+    // The materialized lease does not share the identifiers.
+    EXPECT_NE(lease->hwaddr_, materialized->hwaddr_);
+    EXPECT_NE(lease->client_id_, materialized->client_id_);
+
+    // Long client identifiers and missing identifiers.
+    lease = makeLease4("192.0.2.4", 100);
+    lease->hwaddr_.reset();
+    materialized = Lease4Entry(*lease).toLease();
+    EXPECT_TRUE(*lease == *materialized);
+    EXPECT_FALSE(materialized->hwaddr_);
+    lease->client_id_.reset();
+    materialized = Lease4Entry(*lease).toLease();
+    EXPECT_FALSE(materialized->client_id_);
+    EXPECT_TRUE(Lease4Entry(*lease).getClientIdKey().toVector().empty());
+}
+
+// Checks that a DHCPv6 lease is materialized from its entry.
+TEST(Lease6EntryTest, toLease) {
+    Lease6Ptr lease = makeLease6("2001:db8:1::");
+    Lease6Entry entry(*lease);
+    EXPECT_EQ(lease->addr_, entry.getAddress());
+    EXPECT_EQ(lease->getDuidVector(), entry.getDuidKey().toVector());
+
+    Lease6Ptr materialized = entry.toLease();
+    ASSERT_TRUE(materialized);
+    EXPECT_TRUE(*lease == *materialized);
+    ASSERT_TRUE(materialized->hwaddr_);
+    EXPECT_TRUE(*lease->hwaddr_ == *materialized->hwaddr_);
+
+    lease = makeLease6("2001:db8:1::1", 100);
+    EXPECT_TRUE(*lease == *Lease6Entry(*lease).toLease());
+
+    EXPECT_THROW(Lease6Entry::addressKey(IOAddress("192.0.2.1")), BadValue);
+}
+
+// Checks the lookups in the storage of DHCPv4 leases.
+TEST(Lease4EntryTest, storage) {
+    Lease4Storage storage;
+    storage.insert(Lease4Entry(*makeLease4("192.0.2.10")));
+    storage.insert(Lease4Entry(*makeLease4("192.0.2.2")));
+    Lease4Ptr other = makeLease4("192.0.2.5");
+    other->hwaddr_.reset(new HWAddr(makeBytes(6, 50), HTYPE_ETHER));
+    storage.insert(Lease4Entry(*other));
+
+    // The leases are ordered by address as integers.
+    std::vector<IOAddress> addresses;
+    for (auto entry = storage.begin(); entry != storage.end(); ++entry) {
+        addresses.push_back(entry->getAddress());
+    }
+    ASSERT_EQ(3, addresses.size());
+    EXPECT_EQ("192.0.2.2", addresses[0].toText());
+    EXPECT_EQ("192.0.2.5", addresses[1].toText());
+    EXPECT_EQ("192.0.2.10", addresses[2].toText());
+
+    // The identifiers are searched by vector.
+    const Lease4StorageHWAddressSubnetIdIndex& hwaddr_idx =
+        storage.get<HWAddressSubnetIdIndexTag>();
+    auto range = hwaddr_idx.equal_range(boost::make_tuple(other->hwaddr_->hwaddr_));
+    ASSERT_EQ(1, std::distance(range.first, range.second));
+    EXPECT_EQ(other->addr_, range.first->getAddress());
+    const Lease4StorageClientIdSubnetIdIndex& client_id_idx =
+        storage.get<ClientIdSubnetIdIndexTag>();
+    EXPECT_EQ(3, client_id_idx.count(boost::make_tuple(other->getClientIdVector(),
+                                                       other->subnet_id_)));
+    const Lease4StorageHostnameIndex& hostname_idx =
+        storage.get<HostnameIndexTag>();
+    EXPECT_EQ(3, hostname_idx.count("host.example.org"));
+}
+
+} // end of anonymous namespace
@@ -10,6 +10,7 @@
 #include <asiolink/io_address.h>
 #include <dhcp/duid.h>
 #include <dhcp/iface_mgr.h>
+#include <dhcpsrv/binary_lease_file.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
@@ -26,11 +27,13 @@
 #include <boost/bind.hpp>
 #include <gtest/gtest.h>
 
+#include <csignal>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <queue>
 #include <sstream>
+#include <sys/resource.h>
 #include <unistd.h>
 
 using namespace std;
@@ -389,6 +392,34 @@ TEST_F(MemfileLeaseMgrTest, constructor) {
     pmap["persist"] = "true";
     pmap["max-row-errors"] = "-1";
     EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    // The durability must be a known policy.
+    pmap["lfc-interval"] = "0";
+    pmap["max-row-errors"] = "5";
+    pmap["durability"] = "group-commit";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    pmap["durability"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    // The lfc-format must be csv or binary.
+    pmap.erase("durability");
+    pmap["lfc-format"] = "binary";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    pmap["lfc-format"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    // The lfc-mode must be external or in-process.
+    pmap["lfc-format"] = "csv";
+    pmap["lfc-mode"] = "in-process";
+    pmap["lfc-write-rate"] = "1000";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    pmap["lfc-mode"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    // The lfc-write-rate must be an integer.
+    pmap["lfc-mode"] = "external";
+    pmap["lfc-write-rate"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
 }
 
 /// @brief Checks if there is no lease manager NoLeaseManager is thrown.
@@ -457,6 +488,79 @@ TEST_F(MemfileLeaseMgrTest, persistLeases) {
     EXPECT_FALSE(lease_mgr->persistLeases(Memfile_LeaseMgr::V6));
 }
 
+/// @brief Checks that the lease changes are written to the lease file by the
+/// journal before they return.
+TEST_F(MemfileLeaseMgrTest, durability) {
+    LeaseFileIO io4(getLeaseFilePath("leasefile4_1.csv"));
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["lfc-interval"] = "0";
+    pmap["name"] = getLeaseFilePath("leasefile4_1.csv");
+    pmap["durability"] = "group-commit";
+    boost::scoped_ptr<Memfile_LeaseMgr> lease_mgr(new Memfile_LeaseMgr(pmap));
+
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.1"), hwaddr, ClientIdPtr(),
+                               3600, time(NULL), 1));
+    ASSERT_TRUE(lease_mgr->addLease(lease));
+    EXPECT_NE(std::string::npos, io4.readFile().find("192.0.2.1,"));
+
+    lease->hostname_ = "host.example.org";
+    ASSERT_NO_THROW(lease_mgr->updateLease4(lease));
+    EXPECT_NE(std::string::npos, io4.readFile().find("host.example.org"));
+
+    ASSERT_TRUE(lease_mgr->deleteLease(lease));
+    EXPECT_NE(std::string::npos, io4.readFile().find("192.0.2.1,01:01:01:01:01:01,,0,"));
+}
+
+/// @brief Checks that the lease changes which could not be written to the
+/// lease file by the journal are undone in memory.
+TEST_F(MemfileLeaseMgrTest, durabilityRollback) {
+    LeaseFileIO io4(getLeaseFilePath("leasefile4_1.csv"));
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["lfc-interval"] = "0";
+    pmap["name"] = getLeaseFilePath("leasefile4_1.csv");
+    pmap["durability"] = "group-commit";
+    boost::scoped_ptr<Memfile_LeaseMgr> lease_mgr(new Memfile_LeaseMgr(pmap));
+
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.1"), hwaddr, ClientIdPtr(),
+                               3600, time(NULL), 1));
+    ASSERT_TRUE(lease_mgr->addLease(lease));
+
+    // Limit the size of the files so as the following writes fail.
+    struct rlimit limit;
+    ASSERT_EQ(0, getrlimit(RLIMIT_FSIZE, &limit));
+    struct rlimit small_limit = limit;
+    small_limit.rlim_cur = io4.readFile().size();
+    void (*handler)(int) = signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &small_limit));
+
+    Lease4Ptr new_lease(new Lease4(IOAddress("192.0.2.2"), hwaddr,
+                                   ClientIdPtr(), 3600, time(NULL), 1));
+    EXPECT_THROW(lease_mgr->addLease(new_lease), FileJournalError);
+    Lease4Ptr updated_lease(new Lease4(*lease));
+    updated_lease->hostname_ = "host.example.org";
+    EXPECT_THROW(lease_mgr->updateLease4(updated_lease), FileJournalError);
+    EXPECT_THROW(lease_mgr->deleteLease(lease), FileJournalError);
+
+    ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &limit));
+    signal(SIGXFSZ, handler);
+
+    // The memory is consistent with the lease file.
+    EXPECT_FALSE(lease_mgr->getLease4(IOAddress("192.0.2.2")));
+    Lease4Ptr returned = lease_mgr->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(returned);
+    EXPECT_TRUE(returned->hostname_.empty());
+
+    // The next change is written.
+    ASSERT_TRUE(lease_mgr->addLease(new_lease));
+    EXPECT_NE(std::string::npos, io4.readFile().find("192.0.2.2,"));
+}
+
 /// @brief Check if it is possible to schedule the timer to perform the Lease
 /// File Cleanup periodically.
 TEST_F(MemfileLeaseMgrTest, lfcTimer) {
@@ -825,6 +929,184 @@ TEST_F(MemfileLeaseMgrTest, leaseFileCopy) {
     ASSERT_FALSE(input_file.exists());
 }
 
+/// @brief This test checks that the in-process lease file cleanup writes
+/// the leases held in memory and replaces the lease files as kea-lfc does.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcess4) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state,user_context\n";
+
+    std::string current_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1,{ \"foo\": true }\n"
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1,\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "192.0.2.3,03:03:03:03:03:03,,200,200,8,1,1,,1,\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1,{ \"bar\": true }\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile4_0.csv.2"));
+    previous_file.writeFile(previous_file_contents);
+
+    // The kea-lfc program is not used.
+    setenv("KEA_LFC_EXECUTABLE", "foobar", 1);
+
+    // Create the backend.
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-mode"] = "in-process";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    // Run the lease file cleanup.
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+
+    // The current lease file has been rotated.
+    ASSERT_TRUE(current_file.exists());
+    EXPECT_EQ(new_file_contents, current_file.readFile());
+
+    // Wait for the cleanup thread to complete.
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    // The leases are written to the previous file in the order of the
+    // addresses, once each.
+    std::string result_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1,\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1,{ \"bar\": true }\n";
+    EXPECT_EQ(result_file_contents, previous_file.readFile());
+
+    // The other files of the cleanup have been removed.
+    LeaseFileIO input_file(getLeaseFilePath("leasefile4_0.csv.1"), false);
+    EXPECT_FALSE(input_file.exists());
+    LeaseFileIO output_file(getLeaseFilePath("leasefile4_0.csv.output"), false);
+    EXPECT_FALSE(output_file.exists());
+    LeaseFileIO finish_file(getLeaseFilePath("leasefile4_0.csv.completed"), false);
+    EXPECT_FALSE(finish_file.exists());
+
+    // Check if we can still write to the lease file.
+    std::vector<uint8_t> hwaddr_vec(6);
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+    Lease4Ptr new_lease(new Lease4(IOAddress("192.0.2.45"), hwaddr,
+                                   static_cast<const uint8_t*>(0), 0,
+                                   100, 0, 1));
+    ASSERT_NO_THROW(lease_mgr->addLease(new_lease));
+
+    std::string updated_file_contents = new_file_contents +
+        "192.0.2.45,00:00:00:00:00:00,,100,100,1,0,0,,0,\n";
+    EXPECT_EQ(updated_file_contents, current_file.readFile());
+}
+
+/// @brief This test checks that the in-process lease file cleanup writes
+/// the leases in the binary format and that they are loaded back.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcess6Binary) {
+    std::string new_file_contents =
+        "address,duid,valid_lifetime,expire,subnet_id,"
+        "pref_lifetime,lease_type,iaid,prefix_len,fqdn_fwd,"
+        "fqdn_rev,hostname,hwaddr,state,user_context\n";
+
+    std::string current_file_contents = new_file_contents +
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,200,"
+        "8,100,0,7,0,1,1,,,1,\n"
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,800,"
+        "8,100,0,7,0,1,1,host.example.org,,1,{ \"foo\": true }\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile6_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string input_file_contents = new_file_contents +
+        "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,800,"
+        "8,100,0,7,0,1,1,,,1,\n";
+    LeaseFileIO input_file(getLeaseFilePath("leasefile6_0.csv.1"));
+    input_file.writeFile(input_file_contents);
+
+    // Create the backend.
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "6";
+    pmap["name"] = getLeaseFilePath("leasefile6_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-mode"] = "in-process";
+    pmap["lfc-format"] = "binary";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    // The copy file exists so the current file is not rotated, but the
+    // leases it holds are written as well.
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    EXPECT_EQ(current_file_contents, current_file.readFile());
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    std::string previous_name = getLeaseFilePath("leasefile6_0.csv.2");
+    EXPECT_TRUE(BinaryLeaseFile::isBinary(previous_name));
+    EXPECT_FALSE(input_file.exists());
+
+    // Load the leases from the files left by the cleanup.
+    current_file.writeFile(new_file_contents);
+    lease_mgr.reset();
+    lease_mgr.reset(new NakedMemfileLeaseMgr(pmap));
+
+    Lease6Ptr lease = lease_mgr->getLease6(Lease::TYPE_NA,
+                                           IOAddress("2001:db8:1::1"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(600, lease->cltt_);
+    EXPECT_EQ("host.example.org", lease->hostname_);
+    ASSERT_TRUE(lease->getContext());
+    EXPECT_EQ("{ \"foo\": true }", lease->getContext()->str());
+    EXPECT_TRUE(lease_mgr->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::2")));
+}
+
+/// @brief This test checks that the in-process lease file cleanup stops
+/// when the backend is destroyed, leaving the lease files to be loaded.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcessStop) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state,user_context\n";
+
+    std::string current_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1,\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1,\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile4_0.csv.2"));
+    previous_file.writeFile(previous_file_contents);
+
+    // Create the backend writing one lease per second, so the cleanup
+    // pauses after it has written the two leases.
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-mode"] = "in-process";
+    pmap["lfc-write-rate"] = "1";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    EXPECT_TRUE(lease_mgr->isLFCRunning());
+
+    // Destroying the backend interrupts the cleanup.
+    Stopwatch stopwatch;
+    lease_mgr.reset();
+    EXPECT_GT(1000, stopwatch.getTotalMilliseconds());
+
+    // The output is discarded and the rotated lease file is kept.
+    LeaseFileIO output_file(getLeaseFilePath("leasefile4_0.csv.output"), false);
+    EXPECT_FALSE(output_file.exists());
+    LeaseFileIO input_file(getLeaseFilePath("leasefile4_0.csv.1"), false);
+    EXPECT_EQ(current_file_contents, input_file.readFile());
+    EXPECT_EQ(previous_file_contents, previous_file.readFile());
+
+    // The leases are loaded from these files.
+    pmap["lfc-interval"] = "0";
+    lease_mgr.reset(new NakedMemfileLeaseMgr(pmap));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.3")));
+}
+
 /// @brief Checks that adding/getting/deleting a Lease6 object works.
 TEST_F(MemfileLeaseMgrTest, addGetDelete6) {
     startBackend(V6);
@@ -1544,6 +1826,41 @@ TEST_F(MemfileLeaseMgrTest, load4CompletedFile) {
     EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.1")));
 }
 
+/// @brief This test checks that the backend loads the leases of a previous
+/// file written by the LFC in the binary format.
+TEST_F(MemfileLeaseMgrTest, load4BinaryFile) {
+    const uint8_t hwaddr[] = { 2, 2, 2, 2, 2, 2 };
+    {
+        BinaryLeaseFile4 lf(getLeaseFilePath("leasefile4_0.csv.2"));
+        lf.recreate();
+        Lease4 lease2(IOAddress("192.0.2.2"),
+                      HWAddrPtr(new HWAddr(hwaddr, sizeof(hwaddr), HTYPE_ETHER)),
+                      NULL, 0, 200, 0, 8);
+        lf.append(lease2);
+        Lease4 lease11(IOAddress("192.0.2.11"),
+                       HWAddrPtr(new HWAddr(hwaddr, sizeof(hwaddr), HTYPE_ETHER)),
+                       NULL, 0, 200, 0, 8);
+        lf.append(lease11);
+    }
+
+    LeaseFileIO io1(getLeaseFilePath("leasefile4_0.csv.1"));
+    io1.writeFile("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                  "fqdn_fwd,fqdn_rev,hostname,state,user_context\n"
+                  "192.0.2.11,bb:bb:bb:bb:bb:bb,,200,400,8,1,1,,1,\n");
+
+    startBackend(V4);
+
+    // This lease only exists in the binary file.
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.2.2"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(0, lease->cltt_);
+
+    // This lease was updated by the second file.
+    lease = lmptr_->getLease4(IOAddress("192.0.2.11"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(200, lease->cltt_);
+}
+
 /// @brief This test checks that backend constructor refuses to load leases from the
 /// lease files if the LFC is in progress.
 TEST_F(MemfileLeaseMgrTest, load4LFCInProgress) {
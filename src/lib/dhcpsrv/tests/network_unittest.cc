@@ -36,6 +36,7 @@ public:
     /// @param parent Pointer to the instance of the parent network.
     void setParent(TestNetworkPtr parent) {
         parent_network_ = boost::dynamic_pointer_cast<Network>(parent);
+        propertiesChanged();
     }
 };
 
@@ -182,6 +183,7 @@ TEST_F(NetworkTest, inheritanceSupport4) {
     globals_->set("hostname-char-set", Element::create("gc"));
     globals_->set("hostname-char-replacement", Element::create("gr"));
     globals_->set("store-extended-info", Element::create(true));
+    globals_->set("allocator", Element::create("hashed"));
 
     // For each parameter for which inheritance is supported run
     // the test that checks if the values are inherited properly.
@@ -324,6 +326,12 @@ TEST_F(NetworkTest, inheritanceSupport4) {
                                              &Network4::setStoreExtendedInfo,
                                              false, true);
     }
+    {
+        SCOPED_TRACE("allocator");
+        testNetworkInheritance<TestNetwork4>(&Network4::getAllocatorType,
+                                             &Network4::setAllocatorType,
+                                             "iterative", "hashed");
+    }
 }
 
 // This test verifies that the inheritance is supported for DHCPv6
@@ -548,4 +556,54 @@ TEST_F(NetworkTest, getSiaddrNeverFail) {
     EXPECT_NO_THROW(net4_child->getSiaddr());
 }
 
+// Test that the inherited parameters are cached until they are modified.
+TEST_F(NetworkTest, cacheProperties) {
+    boost::shared_ptr<TestNetwork4> net_parent(new TestNetwork4());
+    boost::shared_ptr<TestNetwork4> net_child(new TestNetwork4());
+    net_child->setParent(net_parent);
+    net_child->setFetchGlobalsFn(getFetchGlobalsFn());
+    net_parent->setFetchGlobalsFn(getFetchGlobalsFn());
+
+    globals_->set("valid-lifetime", Element::create(80));
+    globals_->set("reservation-mode", Element::create("disabled"));
+    globals_->set("match-client-id", Element::create(false));
+    net_parent->setT1(Triplet<uint32_t>(20));
+    net_child->setT1(Triplet<uint32_t>(10));
+    net_parent->setT2(Triplet<uint32_t>(40));
+    EXPECT_FALSE(net_child->hasCachedProperties());
+
+    net_parent->cacheProperties();
+    net_child->cacheProperties();
+    EXPECT_TRUE(net_parent->hasCachedProperties());
+    EXPECT_TRUE(net_child->hasCachedProperties());
+    EXPECT_EQ(80, net_child->getValid().get());
+    EXPECT_EQ(10, net_child->getT1().get());
+    EXPECT_EQ(40, net_child->getT2().get());
+    EXPECT_EQ(Network::HR_DISABLED, net_child->getHostReservationMode().get());
+    EXPECT_FALSE(net_child->getMatchClientId().get());
+
+    // The cached values are returned even if the callback now returns
+    // other global values.
+    globals_->set("valid-lifetime", Element::create(90));
+    EXPECT_EQ(80, net_child->getValid().get());
+
+    // The other inheritance modes don't use the cache.
+    EXPECT_EQ(90, net_child->getValid(Network::Inheritance::GLOBAL).get());
+    EXPECT_TRUE(net_child->getValid(Network::Inheritance::NONE).unspecified());
+
+    // Invalidating the cached values of a network doesn't invalidate
+    // the values cached by the other networks: the child network now
+    // gets the value cached by its parent.
+    net_child->propertiesChanged();
+    EXPECT_FALSE(net_child->hasCachedProperties());
+    EXPECT_TRUE(net_parent->hasCachedProperties());
+    EXPECT_EQ(80, net_child->getValid().get());
+
+    // Modifying a network invalidates its cached values.
+    net_child->cacheProperties();
+    net_child->setT2(Triplet<uint32_t>(50));
+    EXPECT_FALSE(net_child->hasCachedProperties());
+    EXPECT_EQ(50, net_child->getT2().get());
+}
+
 }
@@ -0,0 +1,82 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/pool_free_bitmap.h>
+#include <exceptions/exceptions.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+// Checks that a new bitmap has all addresses free.
+TEST(PoolFreeBitmapTest, constructor) {
+    PoolFreeBitmap bitmap(100);
+    EXPECT_EQ(100, bitmap.getCapacity());
+    EXPECT_EQ(100, bitmap.getFreeCount());
+    for (uint64_t i = 0; i < 100; ++i) {
+        EXPECT_FALSE(bitmap.isUsed(i));
+    }
+    EXPECT_THROW(bitmap.isUsed(100), OutOfRange);
+}
+
+// Checks that addresses can be marked as used and free.
+TEST(PoolFreeBitmapTest, setUsedFree) {
+    PoolFreeBitmap bitmap(130);
+
+    bitmap.setUsed(0);
+    bitmap.setUsed(64);
+    bitmap.setUsed(129);
+    EXPECT_EQ(127, bitmap.getFreeCount());
+    EXPECT_TRUE(bitmap.isUsed(0));
+    EXPECT_TRUE(bitmap.isUsed(64));
+    EXPECT_TRUE(bitmap.isUsed(129));
+    EXPECT_FALSE(bitmap.isUsed(1));
+
+    // Marking twice does not change the count.
+    bitmap.setUsed(64);
+    EXPECT_EQ(127, bitmap.getFreeCount());
+
+    bitmap.setFree(64);
+    bitmap.setFree(64);
+    EXPECT_EQ(128, bitmap.getFreeCount());
+    EXPECT_FALSE(bitmap.isUsed(64));
+
+    EXPECT_THROW(bitmap.setUsed(130), OutOfRange);
+    EXPECT_THROW(bitmap.setFree(130), OutOfRange);
+}
+
+// Checks that a free address is found at or after the start, wrapping
+// around the end of the pool.
+TEST(PoolFreeBitmapTest, findFree) {
+    PoolFreeBitmap bitmap(200);
+    for (uint64_t i = 0; i < 200; ++i) {
+        bitmap.setUsed(i);
+    }
+    EXPECT_EQ(0, bitmap.getFreeCount());
+    EXPECT_THROW(bitmap.findFree(0), InvalidOperation);
+
+    bitmap.setFree(10);
+    bitmap.setFree(150);
+    EXPECT_EQ(10, bitmap.findFree(0));
+    EXPECT_EQ(10, bitmap.findFree(10));
+    EXPECT_EQ(150, bitmap.findFree(11));
+    EXPECT_EQ(150, bitmap.findFree(150));
+    // The padding bits of the last word are never returned.
+    EXPECT_EQ(10, bitmap.findFree(151));
+    EXPECT_EQ(10, bitmap.findFree(199));
+    EXPECT_THROW(bitmap.findFree(200), OutOfRange);
+
+    // Only the start word has a free bit, before the start.
+    bitmap.setUsed(150);
+    EXPECT_EQ(10, bitmap.findFree(20));
+}
+
+}
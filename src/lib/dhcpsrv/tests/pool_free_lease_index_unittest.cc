@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/pool_free_lease_index.h>
+#include <exceptions/exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+// Checks that a new index has all addresses free in one interval.
+TEST(PoolFreeLeaseIndexTest, constructor) {
+    PoolFreeLeaseIndex index(100);
+    EXPECT_EQ(100, index.getCapacity());
+    EXPECT_EQ(100, index.getFreeCount());
+    EXPECT_EQ(1, index.getIntervalCount());
+    EXPECT_TRUE(index.isFree(0));
+    EXPECT_TRUE(index.isFree(99));
+    EXPECT_THROW(index.isFree(100), OutOfRange);
+
+    // A huge pool takes no more space.
+    PoolFreeLeaseIndex huge(std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(1, huge.getIntervalCount());
+    EXPECT_TRUE(huge.isFree(std::numeric_limits<uint64_t>::max() - 1));
+}
+
+// Checks that addresses can be marked as used and free with the
+// intervals split and merged.
+TEST(PoolFreeLeaseIndexTest, setUsedFree) {
+    PoolFreeLeaseIndex index(10);
+
+    index.setUsed(5);
+    EXPECT_FALSE(index.isFree(5));
+    EXPECT_EQ(9, index.getFreeCount());
+    EXPECT_EQ(2, index.getIntervalCount());
+
+    index.setUsed(0);
+    index.setUsed(9);
+    EXPECT_EQ(7, index.getFreeCount());
+    EXPECT_EQ(2, index.getIntervalCount());
+
+    // Marking twice does not change the count.
+    index.setUsed(9);
+    EXPECT_EQ(7, index.getFreeCount());
+
+    index.setUsed(6);
+    index.setFree(5);
+    EXPECT_EQ(7, index.getFreeCount());
+    EXPECT_EQ(2, index.getIntervalCount());
+    EXPECT_TRUE(index.isFree(5));
+
+    // Freeing 6 merges the two intervals.
+    index.setFree(6);
+    index.setFree(6);
+    EXPECT_EQ(8, index.getFreeCount());
+    EXPECT_EQ(1, index.getIntervalCount());
+
+    index.setFree(0);
+    index.setFree(9);
+    EXPECT_EQ(10, index.getFreeCount());
+    EXPECT_EQ(1, index.getIntervalCount());
+
+    EXPECT_THROW(index.setUsed(10), OutOfRange);
+    EXPECT_THROW(index.setFree(10), OutOfRange);
+}
+
+// Checks that the free address at or after a position is found.
+TEST(PoolFreeLeaseIndexTest, findFree) {
+    PoolFreeLeaseIndex index(6);
+    index.setUsed(2);
+    index.setUsed(3);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(index.findFree(0, offset));
+    EXPECT_EQ(0, offset);
+    ASSERT_TRUE(index.findFree(1, offset));
+    EXPECT_EQ(1, offset);
+    ASSERT_TRUE(index.findFree(2, offset));
+    EXPECT_EQ(4, offset);
+    ASSERT_TRUE(index.findFree(5, offset));
+    EXPECT_EQ(5, offset);
+
+    // Nothing is found beyond the last free address or the pool.
+    index.setUsed(5);
+    EXPECT_FALSE(index.findFree(5, offset));
+    EXPECT_FALSE(index.findFree(6, offset));
+
+    // The pool is exhausted.
+    index.setUsed(0);
+    index.setUsed(1);
+    index.setUsed(4);
+    EXPECT_EQ(0, index.getFreeCount());
+    EXPECT_EQ(0, index.getIntervalCount());
+    EXPECT_FALSE(index.findFree(0, offset));
+}
+
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/prefix_trie.h>
+#include <exceptions/exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Returns the values of the prefixes including an address.
+///
+/// @param trie The trie.
+/// @param address The address.
+std::vector<size_t> match(const PrefixTrie& trie, const std::string& address) {
+    std::vector<size_t> values;
+    trie.match(IOAddress(address), values);
+    return (values);
+}
+
+// Checks that an empty trie matches nothing.
+TEST(PrefixTrieTest, empty) {
+    PrefixTrie trie;
+    EXPECT_EQ(0, trie.size());
+    EXPECT_TRUE(match(trie, "192.0.2.1").empty());
+    EXPECT_TRUE(match(trie, "2001:db8::1").empty());
+}
+
+// Checks that IPv4 prefixes are matched from the shortest to the longest.
+TEST(PrefixTrieTest, match4) {
+    PrefixTrie trie;
+    trie.insert(IOAddress("192.0.2.0"), 24, 0);
+    trie.insert(IOAddress("192.0.2.128"), 25, 1);
+    trie.insert(IOAddress("192.0.0.0"), 16, 2);
+    trie.insert(IOAddress("10.0.0.0"), 8, 3);
+    trie.insert(IOAddress("192.0.2.0"), 24, 4);
+    trie.insert(IOAddress("192.0.3.7"), 32, 5);
+    EXPECT_EQ(6, trie.size());
+
+    EXPECT_EQ(std::vector<size_t>({ 2, 0, 4 }), match(trie, "192.0.2.1"));
+    EXPECT_EQ(std::vector<size_t>({ 2, 0, 4, 1 }), match(trie, "192.0.2.200"));
+    EXPECT_EQ(std::vector<size_t>({ 2, 5 }), match(trie, "192.0.3.7"));
+    EXPECT_EQ(std::vector<size_t>({ 2 }), match(trie, "192.0.3.8"));
+    EXPECT_EQ(std::vector<size_t>({ 3 }), match(trie, "10.1.2.3"));
+    EXPECT_TRUE(match(trie, "192.1.0.1").empty());
+
+    // Another family matches nothing.
+    EXPECT_TRUE(match(trie, "2001:db8::1").empty());
+}
+
+// Checks the default route and the host bits.
+TEST(PrefixTrieTest, defaultRoute) {
+    PrefixTrie trie;
+    // The bits past the prefix length are ignored.
+    trie.insert(IOAddress("192.0.2.77"), 24, 0);
+    trie.insert(IOAddress("0.0.0.0"), 0, 1);
+    EXPECT_EQ(std::vector<size_t>({ 1, 0 }), match(trie, "192.0.2.1"));
+    EXPECT_EQ(std::vector<size_t>({ 1 }), match(trie, "203.0.113.1"));
+}
+
+// Checks that IPv6 prefixes are matched.
+TEST(PrefixTrieTest, match6) {
+    PrefixTrie trie;
+    trie.insert(IOAddress("2001:db8:1::"), 64, 0);
+    trie.insert(IOAddress("2001:db8::"), 32, 1);
+    trie.insert(IOAddress("2001:db8:1::"), 48, 2);
+    trie.insert(IOAddress("2001:db8:1::1"), 128, 3);
+    EXPECT_EQ(std::vector<size_t>({ 1, 2, 0, 3 }), match(trie, "2001:db8:1::1"));
+    EXPECT_EQ(std::vector<size_t>({ 1, 2, 0 }), match(trie, "2001:db8:1::2"));
+    EXPECT_EQ(std::vector<size_t>({ 1, 2 }), match(trie, "2001:db8:1:1::1"));
+    EXPECT_EQ(std::vector<size_t>({ 1 }), match(trie, "2001:db8:2::1"));
+    EXPECT_TRUE(match(trie, "2001:db9::1").empty());
+}
+
+// Checks that invalid prefixes are rejected.
+TEST(PrefixTrieTest, invalid) {
+    PrefixTrie trie;
+    EXPECT_THROW(trie.insert(IOAddress("192.0.2.0"), 33, 0), BadValue);
+    trie.insert(IOAddress("192.0.2.0"), 24, 0);
+    EXPECT_THROW(trie.insert(IOAddress("2001:db8::"), 32, 1), BadValue);
+    EXPECT_EQ(1, trie.size());
+}
+
+} // end of anonymous namespace
@@ -659,6 +659,32 @@ TEST(SharedNetwork4Test, delAll) {
     ASSERT_EQ(0, network->getAllSubnets()->size());
 }
 
+// This test verifies that modifying a shared network invalidates the
+// parameters cached by its subnets.
+TEST(SharedNetwork4Test, cacheProperties) {
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("10.0.0.0"), 8, 10, 20, 30,
+                                   SubnetID(1)));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.0"), 24, 10, 20, 30,
+                                   SubnetID(2)));
+
+    SharedNetwork4Ptr network(new SharedNetwork4("frog"));
+    ASSERT_NO_THROW(network->add(subnet1));
+    network->setStoreExtendedInfo(true);
+
+    network->cacheProperties();
+    subnet1->cacheProperties();
+    subnet2->cacheProperties();
+    ASSERT_TRUE(subnet1->hasCachedProperties());
+    EXPECT_TRUE(subnet1->getStoreExtendedInfo().get());
+
+    // Only the subnets of the shared network are invalidated.
+    network->setStoreExtendedInfo(false);
+    EXPECT_FALSE(network->hasCachedProperties());
+    EXPECT_FALSE(subnet1->hasCachedProperties());
+    EXPECT_TRUE(subnet2->hasCachedProperties());
+    EXPECT_FALSE(subnet1->getStoreExtendedInfo().get());
+}
+
 // This test verifies that the SharedNetwork6 factory function creates a
 // valid shared network instance.
 TEST(SharedNetwork6Test, create) {
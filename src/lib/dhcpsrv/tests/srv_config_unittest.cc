@@ -1571,4 +1571,44 @@ TEST_F(SrvConfigTest, multiThreadingSettings) {
     EXPECT_TRUE(isEquivalent(param, conf.getDHCPMultiThreading()));
 }
 
+// Verifies that the classes nothing depends on are found.
+TEST_F(SrvConfigTest, updateUsedClientClasses) {
+    SrvConfig conf(32);
+    ClientClassDictionaryPtr dictionary = conf.getClientClassDictionary();
+    const char* names[] = { "network", "subnet", "pool", "required",
+                            "DROP", "other" };
+    for (auto name : names) {
+        ASSERT_NO_THROW(dictionary->addClass(name, ExpressionPtr(), "", false,
+                                             false, CfgOptionPtr()));
+    }
+
+    SharedNetwork4Ptr network(new SharedNetwork4("frog"));
+    network->allowClientClass("network");
+    conf.getCfgSharedNetworks4()->add(network);
+
+    Triplet<uint32_t> def_triplet;
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24,
+                                  def_triplet, def_triplet, 4000, 1));
+    subnet->allowClientClass("subnet");
+    PoolPtr pool(new Pool4(IOAddress("192.0.2.10"), IOAddress("192.0.2.20")));
+    pool->allowClientClass("pool");
+    pool->requireClientClass("required");
+    subnet->addPool(pool);
+    conf.getCfgSubnets4()->add(subnet);
+
+    conf.updateUsedClientClasses();
+    EXPECT_TRUE(dictionary->findClass("network")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("subnet")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("pool")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("required")->getUsed());
+    EXPECT_TRUE(dictionary->findClass("DROP")->getUsed());
+    EXPECT_FALSE(dictionary->findClass("other")->getUsed());
+
+    // Hook libraries can depend on any class.
+    dictionary->findClass("other")->setUsed(true);
+    conf.getHooksConfig().add("libfoo.so", ConstElementPtr());
+    conf.updateUsedClientClasses();
+    EXPECT_TRUE(dictionary->findClass("other")->getUsed());
+}
+
 } // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -640,6 +640,59 @@ TEST(Subnet4Test, inRangeinPool) {
     EXPECT_TRUE(subnet->inPool(Lease::TYPE_V4, IOAddress("192.2.3.4"), three_classes));
 }
 
+// This test checks that the pools are kept sorted and found when many
+// small pools are added in any order.
+TEST(Subnet4Test, inPoolManyPools) {
+    Subnet4Ptr subnet(new Subnet4(IOAddress("10.0.0.0"), 8, 1, 2, 3));
+
+    // Add 256 pools of 4 addresses every 8 addresses, odd ones first.
+    for (unsigned i = 1; i < 512; i += 2) {
+        unsigned index = i % 256;
+        IOAddress first(IOAddress("10.0.0.0").toUint32() + 8 * index);
+        IOAddress last(first.toUint32() + 3);
+        Pool4Ptr pool(new Pool4(first, last));
+        if (index == 100) {
+            pool->allowClientClass("foo");
+        }
+        ASSERT_NO_THROW(subnet->addPool(pool));
+    }
+
+    // The pools are sorted.
+    const PoolCollection& pools = subnet->getPools(Lease::TYPE_V4);
+    ASSERT_EQ(256, pools.size());
+    for (unsigned i = 0; i < pools.size(); ++i) {
+        EXPECT_EQ(IOAddress("10.0.0.0").toUint32() + 8 * i,
+                  pools[i]->getFirstAddress().toUint32());
+    }
+
+    // Check the first, last and gap addresses of a few pools.
+    for (unsigned index : { 0, 1, 100, 255 }) {
+        uint32_t first = IOAddress("10.0.0.0").toUint32() + 8 * index;
+        EXPECT_TRUE(subnet->inPool(Lease::TYPE_V4, IOAddress(first)));
+        EXPECT_TRUE(subnet->inPool(Lease::TYPE_V4, IOAddress(first + 3)));
+        EXPECT_FALSE(subnet->inPool(Lease::TYPE_V4, IOAddress(first + 4)));
+        EXPECT_FALSE(subnet->inPool(Lease::TYPE_V4, IOAddress(first + 7)));
+        EXPECT_EQ(pools[index],
+                  subnet->getPool(Lease::TYPE_V4, IOAddress(first + 2), false));
+        EXPECT_FALSE(subnet->getPool(Lease::TYPE_V4, IOAddress(first + 5), false));
+    }
+
+    // Only the pool including the address is checked for the classes.
+    isc::dhcp::ClientClasses no_class;
+    EXPECT_FALSE(subnet->inPool(Lease::TYPE_V4, IOAddress("10.0.3.33"), no_class));
+    EXPECT_TRUE(subnet->inPool(Lease::TYPE_V4, IOAddress("10.0.3.41"), no_class));
+    EXPECT_FALSE(subnet->getPool(Lease::TYPE_V4, no_class, IOAddress("10.0.3.33")));
+    isc::dhcp::ClientClasses foo_class;
+    foo_class.insert("foo");
+    EXPECT_TRUE(subnet->inPool(Lease::TYPE_V4, IOAddress("10.0.3.33"), foo_class));
+    EXPECT_EQ(pools[100],
+              subnet->getPool(Lease::TYPE_V4, foo_class, IOAddress("10.0.3.33")));
+
+    // Outside of the pools.
+    EXPECT_FALSE(subnet->inPool(Lease::TYPE_V4, IOAddress("10.0.8.0")));
+    EXPECT_FALSE(subnet->inPool(Lease::TYPE_V4, IOAddress("10.255.0.0")));
+}
+
 // This test checks if the toText() method returns text representation
 TEST(Subnet4Test, toText) {
     Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3));
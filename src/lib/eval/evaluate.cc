@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,15 +7,100 @@
 #include <config.h>
 
 #include <eval/evaluate.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <boost/noncopyable.hpp>
+#include <utility>
+
+namespace {
+
+using namespace isc::dhcp;
+
+/// @brief Provides the value stack of an evaluation.
+///
+/// The evaluations of a thread share a stack so its storage is allocated
+/// once instead of for each evaluation. An evaluation nested in another
+/// one, e.g. from a hook, gets a stack of its own.
+class EvalValueStack : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Takes the stack of the thread when it is not in use.
+    EvalValueStack() : owner_(!busy_) {
+        busy_ = true;
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Empties the stack of the thread and releases it.
+    ~EvalValueStack() {
+        if (owner_) {
+            while (!shared_.empty()) {
+                shared_.pop();
+            }
+            busy_ = false;
+        }
+    }
+
+    /// @brief Returns the stack.
+    ValueStack& get() {
+        return (owner_ ? shared_ : local_);
+    }
+
+private:
+
+    /// @brief True when the stack of the thread is used.
+    bool owner_;
+
+    /// @brief The stack of a nested evaluation.
+    ValueStack local_;
+
+    /// @brief True when the stack of the thread is in use.
+    static thread_local bool busy_;
+
+    /// @brief The stack of the thread.
+    static thread_local ValueStack shared_;
+};
+
+thread_local bool EvalValueStack::busy_ = false;
+thread_local ValueStack EvalValueStack::shared_;
+
+/// @brief Evaluates a token.
+///
+/// The value of a token extracting data from the packet is taken from
+/// or stored in the extraction cache of the packet when it is enabled.
+///
+/// @param token the token.
+/// @param pkt the packet.
+/// @param values the stack of values.
+void
+evaluateToken(Token& token, Pkt& pkt, ValueStack& values) {
+    const std::string& key = token.getCacheKey();
+    if (key.empty() || !pkt.isExtractionCache()) {
+        token.evaluate(pkt, values);
+        return;
+    }
+    const std::string* cached = pkt.getCachedExtraction(key);
+    if (cached) {
+        values.push(*cached);
+        return;
+    }
+    token.evaluate(pkt, values);
+    pkt.cacheExtraction(key, values.top());
+}
+
+}
 
 namespace isc {
 namespace dhcp {
 
 bool evaluateBool(const Expression& expr, Pkt& pkt) {
-    ValueStack values;
-    for (Expression::const_iterator it = expr.begin();
-         it != expr.end(); ++it) {
-        (*it)->evaluate(pkt, values);
+    EvalValueStack stack;
+    ValueStack& values = stack.get();
+    for (size_t i = 0; i < expr.size(); ++i) {
+        evaluateToken(*expr[i], pkt, values);
+        i += expr[i]->getSkip(values);
     }
     if (values.size() != 1) {
         isc_throw(EvalBadStack, "Incorrect stack order. Expected exactly "
@@ -26,9 +111,11 @@ bool evaluateBool(const Expression& expr, Pkt& pkt) {
 
 std::string
 evaluateString(const Expression& expr, Pkt& pkt) {
-    ValueStack values;
-    for (auto it = expr.begin(); it != expr.end(); ++it) {
-        (*it)->evaluate(pkt, values);
+    EvalValueStack stack;
+    ValueStack& values = stack.get();
+    for (size_t i = 0; i < expr.size(); ++i) {
+        evaluateToken(*expr[i], pkt, values);
+        i += expr[i]->getSkip(values);
     }
     if (values.size() != 1) {
         isc_throw(EvalBadStack, "Incorrect stack order. Expected exactly "
@@ -37,6 +124,73 @@ evaluateString(const Expression& expr, Pkt& pkt) {
     return (values.top());
 }
 
+void
+optimizeExpression(Expression& expr) {
+    // The pure tokens don't read the packet but one is required.
+    Pkt4 pkt(DHCPDISCOVER, 0);
+
+    // For each value on the stack: the index of the first token computing
+    // it in the optimized expression and whether it is constant.
+    std::vector<std::pair<size_t, bool> > operands;
+    Expression optimized;
+    optimized.reserve(expr.size());
+    for (auto token : expr) {
+        unsigned count = token->getArgCount();
+        if (count > operands.size()) {
+            // Let the evaluation report the bad stack.
+            return;
+        }
+        size_t start = optimized.size();
+        size_t last_start = start;
+        bool constant = token->isPure();
+        for (unsigned i = 0; i < count; ++i) {
+            start = operands.back().first;
+            if (i == 0) {
+                last_start = start;
+            }
+            constant = constant && operands.back().second;
+            operands.pop_back();
+        }
+
+        // Short-circuit a logical operator which is not folded: when
+        // the first operand decides the result the second one is skipped.
+        if (!constant && (count == 2)) {
+            std::string value;
+            if (boost::dynamic_pointer_cast<TokenAnd>(token)) {
+                value = "false";
+            } else if (boost::dynamic_pointer_cast<TokenOr>(token)) {
+                value = "true";
+            }
+            if (!value.empty()) {
+                size_t skip = optimized.size() - last_start + 1;
+                optimized.insert(optimized.begin() + last_start,
+                                TokenPtr(new TokenBranch(value, skip)));
+            }
+        }
+        optimized.push_back(token);
+
+        // Fold a constant operator with its operands.
+        if (constant && (optimized.size() - start > 1)) {
+            try {
+                ValueStack values;
+                for (size_t i = start; i < optimized.size(); ++i) {
+                    optimized[i]->evaluate(pkt, values);
+                }
+                if (values.size() == 1) {
+                    optimized.resize(start);
+                    optimized.push_back(TokenPtr(new TokenString(
+                                                     values.top())));
+                } else {
+                    constant = false;
+                }
+            } catch (const std::exception&) {
+                constant = false;
+            }
+        }
+        operands.push_back(std::make_pair(start, constant));
+    }
+    expr.swap(optimized);
+}
 
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -23,11 +23,34 @@ namespace dhcp {
 ///        stack at the end of the evaluation
 /// @throw EvalTypeError if the value at the top of the stack at the
 ///        end of the evaluation is not "false" or "true"
+///
+/// When the extraction cache of the packet is enabled (see
+/// @c Pkt::setExtractionCache) the values extracted from the packet are
+/// shared with the other expressions evaluated for the packet.
 bool evaluateBool(const Expression& expr, Pkt& pkt);
 
 
 std::string evaluateString(const Expression& expr, Pkt& pkt);
 
+/// @brief Optimizes a RPN expression for the evaluation
+///
+/// The expression remains a vector of tokens evaluated one after the
+/// other on a stack of strings: this function only rewrites the vector.
+///
+/// Called once when the expression is configured, it replaces the
+/// constant sub-expressions, i.e. built from literals and pure operators
+/// (see @c Token::isPure), by their value so they are not evaluated for
+/// every packet. For instance substring('foobar', 0, 3) == 'foo' becomes
+/// 'true'. A sub-expression which fails to evaluate is kept so the error
+/// is still reported at evaluation time.
+///
+/// It also makes the logical and and or operators short-circuit by
+/// inserting a @c TokenBranch after their first operand: the second
+/// operand is then not evaluated when the first one decides the result.
+///
+/// @param expr the RPN expression, modified in place
+void optimizeExpression(Expression& expr);
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -325,6 +325,23 @@ public:
         }
 
         EXPECT_EQ(exp_result, result) << " for expression " << expr;
+
+        // The optimized expression gives the same result.
+        Expression optimized(eval.expression);
+        ASSERT_NO_THROW(optimizeExpression(optimized));
+        result = !exp_result;
+        switch (u) {
+        case Option::V4:
+            ASSERT_NO_THROW(result = evaluateBool(optimized, *pkt4_))
+                << " for optimized expression " << expr;
+            break;
+        case Option::V6:
+            ASSERT_NO_THROW(result = evaluateBool(optimized, *pkt6_))
+                << " for optimized expression " << expr;
+            break;
+        }
+
+        EXPECT_EQ(exp_result, result) << " for optimized expression " << expr;
     }
 
     /// @brief Checks if expression can be parsed and evaluated to string
@@ -358,6 +375,39 @@ public:
         }
 
         EXPECT_EQ(exp_result, result) << " for expression " << expr;
+
+        // The optimized expression gives the same result.
+        Expression optimized(eval.expression);
+        ASSERT_NO_THROW(optimizeExpression(optimized));
+        result.clear();
+        switch (u) {
+        case Option::V4:
+            ASSERT_NO_THROW(result = evaluateString(optimized, *pkt4_))
+                << " for optimized expression " << expr;
+            break;
+        case Option::V6:
+            ASSERT_NO_THROW(result = evaluateString(optimized, *pkt6_))
+                << " for optimized expression " << expr;
+            break;
+        }
+
+        EXPECT_EQ(exp_result, result) << " for optimized expression " << expr;
+    }
+
+    /// @brief Checks the size of a optimized expression.
+    ///
+    /// @param expr expression to be parsed and optimized
+    /// @param exp_size expected number of tokens after the optimization
+    /// @param type type of the expression
+    void testOptimizedSize(const std::string& expr, size_t exp_size,
+                          EvalContext::ParserType type = EvalContext::PARSER_BOOL) {
+        EvalContext eval(Option::V4);
+        ASSERT_NO_THROW(eval.parseString(expr, type))
+            << " while parsing expression " << expr;
+        ASSERT_NO_THROW(optimizeExpression(eval.expression))
+            << " while optimizing expression " << expr;
+        EXPECT_EQ(exp_size, eval.expression.size())
+            << " for expression " << expr;
     }
 
     /// @brief Checks that specified expression throws expected exception.
@@ -512,4 +562,143 @@ TEST_F(ExpressionsTest, evaluateString) {
     testExpressionString(Option::V4, "hexstring(0xf01234,'..')", "f0..12..34");
 }
 
+// Checks that the constant sub-expressions are folded by the optimization.
+TEST_F(ExpressionsTest, optimizeExpression) {
+    // Fully constant expressions become one string.
+    testOptimizedSize("'foo' == 'foo'", 1);
+    testOptimizedSize("substring('foobar', 0, 3) == 'foo'", 1);
+    testOptimizedSize("not ('a' == 'b') and ('c' == 'c')", 1);
+    testOptimizedSize("concat('foo', 'bar')", 1, EvalContext::PARSER_STRING);
+    testOptimizedSize("hexstring(0x1234, ':')", 1, EvalContext::PARSER_STRING);
+    testOptimizedSize("ifelse('a' == 'a', 'foo', 'bar')", 1,
+                     EvalContext::PARSER_STRING);
+
+    // Only the constant operands of an operator reading the packet are folded.
+    testOptimizedSize("option[100].text == concat('hund', 'red4')", 3);
+    testOptimizedSize("substring(option[100].text, 0, 3) == 'hun'", 6);
+    testOptimizedSize("option[100].exists and ('a' == 'a')", 4);
+
+    // Packet and class tokens are kept.
+    testOptimizedSize("pkt4.msgtype == 1", 3);
+    testOptimizedSize("member('foo')", 1);
+    testOptimizedSize("not member('foo')", 2);
+
+    // The optimized expressions give the same results.
+    testExpression(Option::V4, "substring('foobar', 0, 3) == 'foo'", true);
+    testExpression(Option::V4, "option[100].text == concat('hund', 'red4')",
+                   true);
+    testExpression(Option::V6, "option[100].text == concat('hund', 'red4')",
+                   false);
+    testExpressionString(Option::V4, "concat(option[100].text, "
+                         "hexstring(0x1234, ':'))", "hundred412:34");
+}
+
+// Checks that a malformed expression is left to the evaluation.
+TEST_F(EvaluateTest, optimizeBadStack) {
+    TokenPtr foo(new TokenString("foo"));
+    TokenPtr eq(new TokenEqual());
+    e_.push_back(foo);
+    e_.push_back(eq);
+    ASSERT_NO_THROW(optimizeExpression(e_));
+    ASSERT_EQ(2, e_.size());
+    EXPECT_THROW(evaluateBool(e_, *pkt4_), EvalBadStack);
+
+    // Two values at the end are folded but still reported.
+    e_.clear();
+    e_.push_back(foo);
+    e_.push_back(foo);
+    e_.push_back(eq);
+    e_.push_back(foo);
+    ASSERT_NO_THROW(optimizeExpression(e_));
+    EXPECT_EQ(2, e_.size());
+    EXPECT_THROW(evaluateBool(e_, *pkt4_), EvalBadStack);
+}
+
+// Checks that the optimized logical operators short-circuit.
+TEST_F(ExpressionsTest, optimizeShortCircuit) {
+    EvalContext eval(Option::V4);
+    ASSERT_NO_THROW(eval.parseString("option[100].exists and "
+                                     "(option[101].exists or "
+                                     "option[102].exists)"));
+    ASSERT_EQ(5, eval.expression.size());
+    ASSERT_NO_THROW(optimizeExpression(eval.expression));
+
+    // option[100].exists, branch, option[101].exists, branch,
+    // option[102].exists, or, and
+    ASSERT_EQ(7, eval.expression.size());
+    boost::shared_ptr<TokenBranch> branch =
+        boost::dynamic_pointer_cast<TokenBranch>(eval.expression[1]);
+    ASSERT_TRUE(branch);
+    EXPECT_EQ("false", branch->getValue());
+    EXPECT_EQ(5, branch->getSkipCount());
+    branch = boost::dynamic_pointer_cast<TokenBranch>(eval.expression[3]);
+    ASSERT_TRUE(branch);
+    EXPECT_EQ("true", branch->getValue());
+    EXPECT_EQ(2, branch->getSkipCount());
+
+    // All the combinations give the same result as the strict evaluation.
+    testExpression(Option::V4, "option[100].exists and option[101].exists",
+                   false);
+    testExpression(Option::V4, "option[101].exists and option[100].exists",
+                   false);
+    testExpression(Option::V4, "option[100].exists and option[100].exists",
+                   true);
+    testExpression(Option::V4, "option[100].exists or option[101].exists",
+                   true);
+    testExpression(Option::V4, "option[101].exists or option[100].exists",
+                   true);
+    testExpression(Option::V4, "option[101].exists or option[101].exists",
+                   false);
+    testExpression(Option::V4, "option[101].exists or "
+                   "(option[100].exists and not option[102].exists)", true);
+}
+
+// Checks that the second operand is not evaluated when the first one
+// decides the result.
+TEST_F(EvaluateTest, shortCircuit) {
+    // option[101].exists is false so the second operand which is not a
+    // boolean is skipped.
+    e_.push_back(TokenPtr(new TokenOption(101, TokenOption::EXISTS)));
+    e_.push_back(TokenPtr(new TokenBranch("false", 2)));
+    e_.push_back(TokenPtr(new TokenString("foo")));
+    e_.push_back(TokenPtr(new TokenAnd()));
+    ASSERT_NO_THROW(result_ = evaluateBool(e_, *pkt4_));
+    EXPECT_FALSE(result_);
+
+    // option[100].exists is true so the second operand is evaluated.
+    e_[0].reset(new TokenOption(100, TokenOption::EXISTS));
+    EXPECT_THROW(evaluateBool(e_, *pkt4_), EvalTypeError);
+}
+
+
+// This checks that the extracted values are shared through the
+// extraction cache of the packet.
+TEST_F(EvaluateTest, extractionCache) {
+    e_.push_back(TokenPtr(new TokenOption(100, TokenOption::TEXTUAL)));
+    Expression e2;
+    e2.push_back(TokenPtr(new TokenOption(100, TokenOption::TEXTUAL)));
+    Expression e3;
+    e3.push_back(TokenPtr(new TokenOption(100, TokenOption::HEXADECIMAL)));
+
+    // The identical tokens of distinct expressions have the same key.
+    EXPECT_EQ(e_[0]->getCacheKey(), e2[0]->getCacheKey());
+    EXPECT_NE(e_[0]->getCacheKey(), e3[0]->getCacheKey());
+    EXPECT_TRUE(TokenString("foo").getCacheKey().empty());
+
+    {
+        ScopedEnableExtractionCache cache(*pkt4_);
+        EXPECT_EQ("hundred4", evaluateString(e_, *pkt4_));
+
+        // Replace the option: the cached value is used by the identical
+        // extraction of another expression, not by a different one.
+        pkt4_->delOption(100);
+        pkt4_->addOption(OptionPtr(new OptionString(Option::V4, 100, "other")));
+        EXPECT_EQ("hundred4", evaluateString(e2, *pkt4_));
+        EXPECT_EQ("other", evaluateString(e3, *pkt4_));
+    }
+
+    // Without the cache the option is extracted again.
+    EXPECT_EQ("other", evaluateString(e2, *pkt4_));
+}
+
 };
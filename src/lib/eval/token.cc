@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -30,6 +30,26 @@ using namespace std;
 
 using isc::util::encode::toHex;
 
+namespace {
+
+/// @brief Returns the suffix of the cache key for a representation type.
+///
+/// @param rep_type the representation type.
+/// @return the suffix, e.g. ".hex".
+string
+representationKey(const TokenOption::RepresentationType& rep_type) {
+    switch (rep_type) {
+    case TokenOption::TEXTUAL:
+        return (".text");
+    case TokenOption::HEXADECIMAL:
+        return (".hex");
+    default:
+        return (".exists");
+    }
+}
+
+} // end of anonymous namespace
+
 void
 TokenString::evaluate(Pkt& /*pkt*/, ValueStack& values) {
     // Literals only push, nothing to pop
@@ -103,6 +123,13 @@ TokenIpAddress::evaluate(Pkt& /*pkt*/, ValueStack& values) {
         .arg(toHex(value_));
 }
 
+TokenOption::TokenOption(const uint16_t option_code,
+                         const RepresentationType& rep_type)
+    : option_code_(option_code), representation_type_(rep_type) {
+    cache_key_ = "option[" + to_string(option_code_) + "]" +
+        representationKey(representation_type_);
+}
+
 OptionPtr
 TokenOption::getOption(Pkt& pkt) {
     return (pkt.getOption(option_code_));
@@ -159,6 +186,8 @@ TokenOption::pushFailure(ValueStack& values) {
 TokenRelay4Option::TokenRelay4Option(const uint16_t option_code,
                                      const RepresentationType& rep_type)
     :TokenOption(option_code, rep_type) {
+    cache_key_ = "relay4[" + to_string(option_code_) + "]" +
+        representationKey(representation_type_);
 }
 
 OptionPtr TokenRelay4Option::getOption(Pkt& pkt) {
@@ -173,6 +202,15 @@ OptionPtr TokenRelay4Option::getOption(Pkt& pkt) {
     return (rai->getOption(option_code_));
 }
 
+TokenRelay6Option::TokenRelay6Option(const int8_t nest_level,
+                                     const uint16_t option_code,
+                                     const RepresentationType& rep_type)
+    :TokenOption(option_code, rep_type), nest_level_(nest_level) {
+    cache_key_ = "relay6[" + to_string(static_cast<int>(nest_level_)) +
+        "].option[" + to_string(option_code_) + "]" +
+        representationKey(representation_type_);
+}
+
 OptionPtr TokenRelay6Option::getOption(Pkt& pkt) {
 
     try {
@@ -209,6 +247,11 @@ OptionPtr TokenRelay6Option::getOption(Pkt& pkt) {
 
 }
 
+TokenPkt::TokenPkt(const MetadataType type)
+    : type_(type) {
+    cache_key_ = "pkt." + to_string(type_);
+}
+
 void
 TokenPkt::evaluate(Pkt& pkt, ValueStack& values) {
 
@@ -261,6 +304,11 @@ TokenPkt::evaluate(Pkt& pkt, ValueStack& values) {
         .arg(print_hex ? toHex(value) : value);
 }
 
+TokenPkt4::TokenPkt4(const FieldType type)
+    : type_(type) {
+    cache_key_ = "pkt4." + to_string(type_);
+}
+
 void
 TokenPkt4::evaluate(Pkt& pkt, ValueStack& values) {
 
@@ -347,6 +395,11 @@ TokenPkt4::evaluate(Pkt& pkt, ValueStack& values) {
         .arg(toHex(value));
 }
 
+TokenPkt6::TokenPkt6(const FieldType type)
+    : type_(type) {
+    cache_key_ = "pkt6." + to_string(type_);
+}
+
 void
 TokenPkt6::evaluate(Pkt& pkt, ValueStack& values) {
 
@@ -388,6 +441,13 @@ TokenPkt6::evaluate(Pkt& pkt, ValueStack& values) {
         .arg(toHex(value));
 }
 
+TokenRelay6Field::TokenRelay6Field(const int8_t nest_level,
+                                   const FieldType type)
+    : nest_level_(nest_level), type_(type) {
+    cache_key_ = "relay6[" + to_string(static_cast<int>(nest_level_)) +
+        "]." + to_string(type_);
+}
+
 void
 TokenRelay6Field::evaluate(Pkt& pkt, ValueStack& values) {
 
@@ -743,6 +803,11 @@ TokenOr::evaluate(Pkt& /*pkt*/, ValueStack& values) {
         .arg('\'' + values.top() + '\'');
 }
 
+void
+TokenBranch::evaluate(Pkt& /*pkt*/, ValueStack& /*values*/) {
+    // The skip is done by the evaluation functions.
+}
+
 void
 TokenMember::evaluate(Pkt& pkt, ValueStack& values) {
     if (pkt.inClass(client_class_)) {
@@ -762,6 +827,7 @@ TokenVendor::TokenVendor(Option::Universe u, uint32_t vendor_id, RepresentationT
     :TokenOption(option_code, repr), universe_(u), vendor_id_(vendor_id),
      field_(option_code ? SUBOPTION : EXISTS)
 {
+    setCacheKey("vendor");
 }
 
 TokenVendor::TokenVendor(Option::Universe u, uint32_t vendor_id, FieldType field)
@@ -771,6 +837,13 @@ TokenVendor::TokenVendor(Option::Universe u, uint32_t vendor_id, FieldType field
     if (field_ == EXISTS) {
         representation_type_ = TokenOption::EXISTS;
     }
+    setCacheKey("vendor");
+}
+
+void TokenVendor::setCacheKey(const std::string& name) {
+    cache_key_ = name + "[" + to_string(universe_) + "." +
+        to_string(vendor_id_) + "]." + to_string(field_) + "." +
+        to_string(option_code_) + representationKey(representation_type_);
 }
 
 uint32_t TokenVendor::getVendorId() const {
@@ -875,6 +948,7 @@ OptionPtr TokenVendor::getOption(Pkt& pkt) {
 TokenVendorClass::TokenVendorClass(Option::Universe u, uint32_t vendor_id,
                                    RepresentationType repr)
     :TokenVendor(u, vendor_id, repr, 0), index_(0) {
+    setCacheKey("vendor-class");
 }
 
 TokenVendorClass::TokenVendorClass(Option::Universe u, uint32_t vendor_id,
@@ -882,6 +956,12 @@ TokenVendorClass::TokenVendorClass(Option::Universe u, uint32_t vendor_id,
     :TokenVendor(u, vendor_id, TokenOption::HEXADECIMAL, 0), index_(index)
 {
     field_ = field;
+    setCacheKey("vendor-class");
+}
+
+void TokenVendorClass::setCacheKey(const std::string& name) {
+    TokenVendor::setCacheKey(name);
+    cache_key_ += "[" + to_string(index_) + "]";
 }
 
 uint16_t TokenVendorClass::getDataIndex() const {
@@ -986,6 +1066,15 @@ TokenInteger::TokenInteger(const uint32_t value)
 
 }
 
+TokenSubOption::TokenSubOption(const uint16_t option_code,
+                               const uint16_t sub_option_code,
+                               const RepresentationType& rep_type)
+    : TokenOption(option_code, rep_type), sub_option_code_(sub_option_code) {
+    cache_key_ = "option[" + to_string(option_code_) + "].option[" +
+        to_string(sub_option_code_) + "]" +
+        representationKey(representation_type_);
+}
+
 OptionPtr
 TokenSubOption::getSubOption(const OptionPtr& parent) {
     if (!parent) {
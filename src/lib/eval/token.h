@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <exceptions/exceptions.h>
 #include <dhcp/pkt.h>
 #include <stack>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -30,7 +31,10 @@ typedef std::vector<TokenPtr> Expression;
 typedef boost::shared_ptr<Expression> ExpressionPtr;
 
 /// Evaluated values are stored as a stack of strings
-typedef std::stack<std::string> ValueStack;
+///
+/// The stack is backed by a vector so its storage can be reused by
+/// successive evaluations.
+typedef std::stack<std::string, std::vector<std::string> > ValueStack;
 
 /// @brief EvalBadStack is thrown when more or less parameters are on the
 ///        stack than expected.
@@ -80,6 +84,38 @@ public:
     /// @brief Virtual destructor
     virtual ~Token() {}
 
+    /// @brief Returns the number of values the token pops from the stack.
+    ///
+    /// Used by @c optimizeExpression to find the operands of the token.
+    ///
+    /// @return 0 by default, i.e. for tokens only pushing a value.
+    virtual unsigned getArgCount() const {
+        return (0);
+    }
+
+    /// @brief Returns true if the value pushed by the token depends only on
+    /// the values it pops.
+    ///
+    /// Such a token with constant operands is evaluated once by
+    /// @c optimizeExpression instead of for each packet.
+    ///
+    /// @return false by default, i.e. for tokens reading the packet.
+    virtual bool isPure() const {
+        return (false);
+    }
+
+    /// @brief Returns the number of following tokens to skip.
+    ///
+    /// Called by the evaluation functions after @c evaluate, it allows
+    /// to jump over tokens (see @c TokenBranch).
+    ///
+    /// @param values stack of values after the evaluation of the token
+    /// @return 0 by default, i.e. the next token is evaluated.
+    virtual size_t getSkip(const ValueStack& values) const {
+        static_cast<void>(values);
+        return (0);
+    }
+
     /// @brief Coverts a (string) value to a boolean
     ///
     /// Only "true" and "false" are expected.
@@ -97,6 +133,24 @@ public:
                       "\"false\" or \"true\", got \"" << value << "\"");
         }
     }
+
+    /// @brief Returns the key of the value extracted by the token.
+    ///
+    /// Tokens extracting a value from the packet return a key identifying
+    /// the extraction so the evaluation functions share the value between
+    /// the identical tokens of the expressions evaluated for a packet (see
+    /// @c isc::dhcp::Pkt::setExtractionCache). A class deriving from such
+    /// a token and changing what it extracts must set its own key.
+    ///
+    /// @return an empty string when the value is not cached.
+    const std::string& getCacheKey() const {
+        return (cache_key_);
+    }
+
+protected:
+
+    /// @brief Key of the extracted value, empty when it is not cached.
+    std::string cache_key_;
 };
 
 /// The order where Token subtypes are declared should be:
@@ -126,6 +180,11 @@ public:
     /// @param values (represented string will be pushed here)
     void evaluate(Pkt& pkt, ValueStack& values);
 
+    /// @brief A constant is pure.
+    virtual bool isPure() const {
+        return (true);
+    }
+
 protected:
     std::string value_; ///< Constant value
 };
@@ -151,6 +210,11 @@ public:
     /// @param values (represented string will be pushed here)
     void evaluate(Pkt& pkt, ValueStack& values);
 
+    /// @brief A constant is pure.
+    virtual bool isPure() const {
+        return (true);
+    }
+
 protected:
     std::string value_; ///< Constant value
 };
@@ -202,6 +266,11 @@ public:
     /// @param values (represented IP address will be pushed here)
     void evaluate(Pkt& pkt, ValueStack& values);
 
+    /// @brief A constant is pure.
+    virtual bool isPure() const {
+        return (true);
+    }
+
 protected:
     ///< Constant value (empty string if the IP address cannot be converted)
     std::string value_;
@@ -239,8 +308,7 @@ public:
     ///
     /// @param option_code code of the option to be represented.
     /// @param rep_type Token representation type.
-    TokenOption(const uint16_t option_code, const RepresentationType& rep_type)
-        : option_code_(option_code), representation_type_(rep_type) {}
+    TokenOption(const uint16_t option_code, const RepresentationType& rep_type);
 
     /// @brief Evaluates the values of the option
     ///
@@ -348,8 +416,7 @@ public:
     /// @param option_code code of the option.
     /// @param rep_type Token representation type.
     TokenRelay6Option(const int8_t nest_level, const uint16_t option_code,
-                      const RepresentationType& rep_type)
-        :TokenOption(option_code, rep_type), nest_level_(nest_level) {}
+                      const RepresentationType& rep_type);
 
     /// @brief Returns nest-level
     ///
@@ -392,9 +459,10 @@ public:
         LEN    ///< length (4 octets)
     };
 
-    /// @brief Constructor (does nothing)
-    TokenPkt(const MetadataType type)
-        : type_(type) {}
+    /// @brief Constructor
+    ///
+    /// @param type the metadata to extract.
+    TokenPkt(const MetadataType type);
 
     /// @brief Gets a value from the specified packet.
     ///
@@ -447,9 +515,10 @@ public:
         TRANSID, ///< transaction-id (xid)
     };
 
-    /// @brief Constructor (does nothing)
-    TokenPkt4(const FieldType type)
-        : type_(type) {}
+    /// @brief Constructor
+    ///
+    /// @param type the field to extract.
+    TokenPkt4(const FieldType type);
 
     /// @brief Gets a value from the specified packet.
     ///
@@ -493,9 +562,10 @@ public:
         TRANSID  ///< transaction id (integer but manipulated as a string)
     };
 
-    /// @brief Constructor (does nothing)
-    TokenPkt6(const FieldType type)
-        : type_(type) {}
+    /// @brief Constructor
+    ///
+    /// @param type the field to extract.
+    TokenPkt6(const FieldType type);
 
     /// @brief Gets a value of the specified packet.
     ///
@@ -550,8 +620,7 @@ public:
     ///
     /// @param nest_level the nesting level for which relay to examine.
     /// @param type which field to extract.
-    TokenRelay6Field(const int8_t nest_level, const FieldType type)
-      : nest_level_(nest_level), type_(type) {}
+    TokenRelay6Field(const int8_t nest_level, const FieldType type);
 
     /// @brief Extracts the specified field from the requested relay
     ///
@@ -611,6 +680,16 @@ public:
     /// @param values - stack of values (2 arguments will be popped, 1 result
     ///        will be pushed)
     void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of operands: two.
+    virtual unsigned getArgCount() const {
+        return (2);
+    }
+
+    /// @brief The packet is not used: pure.
+    virtual bool isPure() const {
+        return (true);
+    }
 };
 
 /// @brief Token that represents the substring operator (returns a portion
@@ -668,6 +747,16 @@ public:
     /// @param values - stack of values (3 arguments will be popped, 1 result
     ///        will be pushed)
     void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of operands: three.
+    virtual unsigned getArgCount() const {
+        return (3);
+    }
+
+    /// @brief The packet is not used: pure.
+    virtual bool isPure() const {
+        return (true);
+    }
 };
 
 /// @brief Token that represents concat operator (concatenates two other tokens)
@@ -691,6 +780,16 @@ public:
     /// @param values - stack of values (2 arguments will be popped, 1 result
     ///        will be pushed)
     void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of operands: two.
+    virtual unsigned getArgCount() const {
+        return (2);
+    }
+
+    /// @brief The packet is not used: pure.
+    virtual bool isPure() const {
+        return (true);
+    }
 };
 
 /// @brief Token that represents an alternative
@@ -722,6 +821,16 @@ public:
     /// @param pkt (unused)
     /// @param values - stack of values (two items are removed)
     void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of operands: three.
+    virtual unsigned getArgCount() const {
+        return (3);
+    }
+
+    /// @brief The packet is not used: pure.
+    virtual bool isPure() const {
+        return (true);
+    }
 };
 
 /// @brief Token that converts to hexadecimal string
@@ -761,6 +870,16 @@ public:
     /// @param values - stack of values (2 arguments will be popped, 1 result
     ///        will be pushed)
     void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of operands: two.
+    virtual unsigned getArgCount() const {
+        return (2);
+    }
+
+    /// @brief The packet is not used: pure.
+    virtual bool isPure() const {
+        return (true);
+    }
 };
 
 /// @brief Token that represents logical negation operator
@@ -786,6 +905,16 @@ public:
     /// @param pkt (unused)
     /// @param values - stack of values (logical top value negated)
     void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of operands: one.
+    virtual unsigned getArgCount() const {
+        return (1);
+    }
+
+    /// @brief The packet is not used: pure.
+    virtual bool isPure() const {
+        return (true);
+    }
 };
 
 /// @brief Token that represents logical and operator
@@ -811,6 +940,16 @@ public:
     /// @param values - stack of values (2 arguments will be popped, 1 result
     ///        will be pushed)
     void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of operands: two.
+    virtual unsigned getArgCount() const {
+        return (2);
+    }
+
+    /// @brief The packet is not used: pure.
+    virtual bool isPure() const {
+        return (true);
+    }
 };
 
 /// @brief Token that represents logical or operator
@@ -836,6 +975,77 @@ public:
     /// @param values - stack of values (2 arguments will be popped, 1 result
     ///        will be pushed)
     void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of operands: two.
+    virtual unsigned getArgCount() const {
+        return (2);
+    }
+
+    /// @brief The packet is not used: pure.
+    virtual bool isPure() const {
+        return (true);
+    }
+};
+
+/// @brief Token that short-circuits a logical operator
+///
+/// It is inserted by @c optimizeExpression between the two operands of
+/// a logical and or or operator: when the first operand is the value
+/// deciding the result ("false" for and, "true" for or) the second
+/// operand and the operator are skipped, leaving the first operand as
+/// the result on the stack.
+///
+/// Its evaluation does nothing so an expression evaluated token after
+/// token without skipping gives the same result.
+class TokenBranch : public Token {
+public:
+    /// @brief Constructor
+    ///
+    /// @param value the value deciding the result ("false" or "true")
+    /// @param skip the number of tokens of the second operand and the
+    ///        operator
+    TokenBranch(const std::string& value, size_t skip)
+        : value_(value), skip_(skip) {
+    }
+
+    /// @brief Token evaluation (does nothing)
+    ///
+    /// @param pkt (unused)
+    /// @param values (unused)
+    void evaluate(Pkt& pkt, ValueStack& values);
+
+    /// @brief Returns the number of tokens to skip.
+    ///
+    /// @param values stack of values with the first operand at the top
+    /// @return the number given to the constructor when the first operand
+    ///         is the value deciding the result, 0 otherwise.
+    virtual size_t getSkip(const ValueStack& values) const {
+        if (!values.empty() && (values.top() == value_)) {
+            return (skip_);
+        }
+        return (0);
+    }
+
+    /// @brief Returns the value deciding the result
+    ///
+    /// This method is used in testing.
+    const std::string& getValue() const {
+        return (value_);
+    }
+
+    /// @brief Returns the number of tokens to skip
+    ///
+    /// This method is used in testing.
+    size_t getSkipCount() const {
+        return (skip_);
+    }
+
+protected:
+    /// @brief The value deciding the result
+    std::string value_;
+
+    /// @brief The number of tokens to skip
+    size_t skip_;
 };
 
 /// @brief Token that represents client class membership
@@ -968,6 +1178,11 @@ protected:
     /// @return suboption of the vendor option (if exists)
     virtual OptionPtr getOption(Pkt& pkt);
 
+    /// @brief Sets the cache key from the parameters of the token.
+    ///
+    /// @param name the name of the token in the key.
+    void setCacheKey(const std::string& name);
+
     /// @brief Universe (V4 or V6)
     ///
     /// We need to remember it, because depending on the universe, the code needs
@@ -1053,6 +1268,13 @@ protected:
     /// @param values - the evaluated value will be pushed here.
     void evaluate(Pkt& pkt, ValueStack& values);
 
+    /// @brief Sets the cache key from the parameters of the token.
+    ///
+    /// Appends the data chunk index to the key of @c TokenVendor.
+    ///
+    /// @param name the name of the token in the key.
+    void setCacheKey(const std::string& name);
+
     /// @brief Data chunk index.
     uint16_t index_;
 };
@@ -1083,8 +1305,7 @@ public:
     /// @param rep_type Token representation type.
     TokenSubOption(const uint16_t option_code,
                    const uint16_t sub_option_code,
-                   const RepresentationType& rep_type)
-        : TokenOption(option_code, rep_type), sub_option_code_(sub_option_code) {}
+                   const RepresentationType& rep_type);
 
     /// @brief This is a method for evaluating a packet.
     ///
@@ -11,15 +11,49 @@
 #include <cc/data.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/date_time/c_local_time_adjustor.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <utility>
 
 using namespace std;
 using namespace isc::data;
 using namespace boost::posix_time;
 
+namespace {
+
+/// @brief Returns the current local time.
+///
+/// microsec_clock::local_time() converts the time with localtime_r() at
+/// each call. The offset from UTC to local time is cached and refreshed
+/// once per minute, so a timestamp costs a clock reading and an addition.
+ptime
+getTimestamp() {
+    static const ptime epoch(boost::gregorian::date(1970, 1, 1));
+    static std::atomic<int64_t> offset(0);
+    static std::atomic<int64_t> refresh(0);
+
+    int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    if (now >= refresh.load(std::memory_order_relaxed)) {
+        ptime utc = epoch + microseconds(now);
+        ptime local =
+            boost::date_time::c_local_adjustor<ptime>::utc_to_local(utc);
+        offset.store((local - utc).total_microseconds(),
+                     std::memory_order_relaxed);
+        refresh.store(now + 60000000, std::memory_order_relaxed);
+    }
+    return (epoch + microseconds(now + offset.load(std::memory_order_relaxed)));
+}
+
+} // end of anonymous namespace
+
 namespace isc {
 namespace stats {
 
+const uint32_t Observation::MAX_RESERVED_SAMPLES;
+
 std::pair<bool, uint32_t>
 Observation::default_max_sample_count_ = std::make_pair(true, 20);
 
@@ -194,28 +228,37 @@ void Observation::setValueInternal(SampleType value, StorageType& storage,
                   << typeToText(type_));
     }
 
-    if (storage.empty()) {
-        storage.push_back(make_pair(value, microsec_clock::local_time()));
+    // Keep the samples ordered if the clock goes back.
+    ptime now = getTimestamp();
+    if (!storage.empty() && (now < storage.front().second)) {
+        now = storage.front().second;
+    }
+
+    if (max_sample_count_.first) {
+        // if max_sample_count_ is set to true make room for the new
+        // sample by removing the oldest ones, so the storage does not
+        // grow beyond the limit
+        while (!storage.empty() &&
+               (storage.size() >= max_sample_count_.second)) {
+            storage.pop_back();
+        }
+        if (storage.size() == storage.capacity()) {
+            // growing the storage by doubling up to the limit
+            size_t limit = std::max(max_sample_count_.second, 1U);
+            size_t capacity = (storage.empty() ? 1 : 2 * storage.size());
+            storage.reserve(std::min(capacity, limit));
+        }
+        storage.push_front(make_pair(value, now));
     } else {
-        // Storing of more than one sample
-        storage.push_front(make_pair(value, microsec_clock::local_time()));
-
-        if (max_sample_count_.first) {
-            // if max_sample_count_ is set to true
-            // and size of storage is equal to max_sample_count_
-            if (storage.size() > max_sample_count_.second) {
-                storage.pop_back(); // removing the last element
-            }
-        } else {
-            StatsDuration range_of_storage =
+        storage.push_front(make_pair(value, now));
+        StatsDuration range_of_storage =
+            storage.front().second - storage.back().second;
+        // removing samples until the range_of_storage
+        // stops exceeding the duration limit
+        while (range_of_storage > max_sample_age_.second) {
+            storage.pop_back();
+            range_of_storage =
                 storage.front().second - storage.back().second;
-            // removing samples until the range_of_storage
-            // stops exceeding the duration limit
-            while (range_of_storage > max_sample_age_.second) {
-                storage.pop_back();
-                range_of_storage =
-                    storage.front().second - storage.back().second;
-            }
         }
     }
 }
@@ -250,7 +293,7 @@ SampleType Observation::getValueInternal(Storage& storage, Type exp_type) const
         // still be there.
         isc_throw(Unexpected, "Observation storage container empty");
     }
-    return (*storage.begin());
+    return (storage.front());
 }
 
 std::list<IntegerSample> Observation::getIntegers() const {
@@ -284,7 +327,7 @@ std::list<SampleType> Observation::getValuesInternal(Storage& storage,
         // still be there.
         isc_throw(Unexpected, "Observation storage container empty");
     }
-    return (storage);
+    return (storage.toList());
 }
 
 template<typename StorageType>
@@ -332,6 +375,11 @@ void Observation::setMaxSampleCountInternal(StorageType& storage,
         // deleting elements which are exceeding the max_samples limit
         storage.pop_back();
     }
+
+    // preallocating the storage
+    storage.reserve(std::max(storage.size(),
+                             static_cast<size_t>(std::min(max_samples,
+                                                          MAX_RESERVED_SAMPLES))));
 }
 
 void Observation::setMaxSampleAgeDefault(const StatsDuration& duration) {
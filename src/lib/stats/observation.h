@@ -9,6 +9,7 @@
 
 #include <cc/data.h>
 #include <exceptions/exceptions.h>
+#include <stats/sample_ring.h>
 #include <boost/shared_ptr.hpp>
 #include <boost/date_time/time_duration.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
@@ -67,6 +68,9 @@ typedef std::pair<std::string, boost::posix_time::ptime> StringSample;
 /// @ref getJSON, which is generic and can be used for all types.
 ///
 /// Since Kea 1.6 multiple samples are stored for the same observation.
+/// They are kept in a circular buffer (@ref SampleRing) which is sized
+/// by the sample count limit, and timestamped from a cached local time
+/// offset so recording a sample neither allocates nor converts the time.
 class Observation {
 public:
 
@@ -299,7 +303,7 @@ private:
     /// This method returns size of observed storage.
     /// It is used by public methods to return size of
     /// available storages.
-    /// @tparam Storage type of storage (e.g. list<IntegerSample>)
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
     /// @param storage storage which size will be returned
     /// @param exp_type expected observation type (used for sanity checking)
     /// @return size of storage
@@ -313,7 +317,7 @@ private:
     /// available storages.
     ///
     /// @tparam SampleType type of sample (e.g. IntegerSample)
-    /// @tparam StorageType type of storage (e.g. list<IntegerSample>)
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
     /// @param value observation to be recorded
     /// @param storage observation will be stored here
     /// @param exp_type expected observation type (used for sanity checking)
@@ -325,7 +329,7 @@ private:
     /// @brief Returns a sample (internal version)
     ///
     /// @tparam SampleType type of sample (e.g. IntegerSample)
-    /// @tparam StorageType type of storage (e.g. list<IntegerSample>)
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
     /// @param observation storage
     /// @param exp_type expected observation type (used for sanity checking)
     /// @throw InvalidStatType if observation type mismatches
@@ -336,7 +340,7 @@ private:
     /// @brief Returns samples (internal version)
     ///
     /// @tparam SampleType type of samples (e.g. IntegerSample)
-    /// @tparam Storage type of storage (e.g. list<IntegerSample>)
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
     /// @param observation storage
     /// @param exp_type expected observation type (used for sanity checking)
     /// @throw InvalidStatType if observation type mismatches
@@ -347,7 +351,7 @@ private:
 
     /// @brief Determines maximum age of samples.
     ///
-    /// @tparam Storage type of storage (e.g. list<IntegerSample>)
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
     /// @param storage storage on which limit will be set
     /// @param duration determines maximum age of samples
     /// @param exp_type expected observation type (used for sanity checking)
@@ -357,7 +361,7 @@ private:
 
     /// @brief Determines how many samples of a given statistic should be kept.
     ///
-    /// @tparam Storage type of storage (e.g. list<IntegerSample>)
+    /// @tparam Storage type of storage (e.g. SampleRing<IntegerSample>)
     /// @param storage storage on which limit will be set
     /// @param max_samples determines maximum number of samples
     /// @param exp_type expected observation type (used for sanity checking)
@@ -365,6 +369,11 @@ private:
     void setMaxSampleCountInternal(StorageType& storage,
                                    uint32_t max_samples, Type exp_type);
 
+    /// @brief Maximum number of samples reserved by @ref setMaxSampleCount
+    ///
+    /// Larger count limits are reached by growing the storage.
+    static const uint32_t MAX_RESERVED_SAMPLES = 1024;
+
     /// @brief Observation (statistic) name
     std::string name_;
 
@@ -409,16 +418,16 @@ private:
     /// @{
 
     /// @brief Storage for integer samples
-    std::list<IntegerSample> integer_samples_;
+    SampleRing<IntegerSample> integer_samples_;
 
     /// @brief Storage for floating point samples
-    std::list<FloatSample> float_samples_;
+    SampleRing<FloatSample> float_samples_;
 
     /// @brief Storage for time duration samples
-    std::list<DurationSample> duration_samples_;
+    SampleRing<DurationSample> duration_samples_;
 
     /// @brief Storage for string samples
-    std::list<StringSample> string_samples_;
+    SampleRing<StringSample> string_samples_;
     /// @}
 };
 
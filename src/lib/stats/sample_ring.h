@@ -0,0 +1,147 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <exceptions/exceptions.h>
+
+#include <list>
+#include <vector>
+
+namespace isc {
+namespace stats {
+
+/// @brief Storage of the samples of an observation
+///
+/// The samples are kept in a contiguous circular buffer, the most recent
+/// sample first. Adding a sample does not allocate unless the buffer is
+/// full, and removing the oldest sample only moves an index. A full buffer
+/// grows by doubling; the owner can instead size it with @ref reserve,
+/// e.g. to the sample count limit of the observation.
+///
+/// @tparam SampleType type of the samples (e.g. IntegerSample)
+template<typename SampleType>
+class SampleRing {
+public:
+
+    /// @brief Constructor
+    ///
+    /// The storage is initially empty without capacity.
+    SampleRing() : head_(0), size_(0) {
+    }
+
+    /// @brief Returns the number of samples
+    size_t size() const {
+        return (size_);
+    }
+
+    /// @brief Checks if there is no sample
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+    /// @brief Returns the number of samples which can be stored without
+    /// allocating
+    size_t capacity() const {
+        return (buffer_.size());
+    }
+
+    /// @brief Sets the capacity
+    ///
+    /// @param capacity the new capacity
+    /// @throw isc::InvalidParameter if the capacity is smaller than the
+    /// number of samples
+    void reserve(size_t capacity) {
+        if (capacity < size_) {
+            isc_throw(InvalidParameter, "can't reserve " << capacity
+                      << " samples for " << size_ << " samples");
+        }
+        if (capacity == buffer_.size()) {
+            return;
+        }
+        std::vector<SampleType> buffer(capacity);
+        for (size_t i = 0; i < size_; ++i) {
+            buffer[i] = at(i);
+        }
+        buffer_.swap(buffer);
+        head_ = 0;
+    }
+
+    /// @brief Returns a sample
+    ///
+    /// @param i the age rank of the sample, 0 for the most recent
+    /// @return the sample
+    const SampleType& at(size_t i) const {
+        return (buffer_[(head_ + i) % buffer_.size()]);
+    }
+
+    /// @brief Returns the most recent sample
+    const SampleType& front() const {
+        return (buffer_[head_]);
+    }
+
+    /// @brief Returns the oldest sample
+    const SampleType& back() const {
+        return (at(size_ - 1));
+    }
+
+    /// @brief Adds a sample as the most recent one
+    ///
+    /// @param sample the sample
+    void push_front(const SampleType& sample) {
+        if (size_ == buffer_.size()) {
+            reserve(size_ > 0 ? 2 * size_ : 1);
+        }
+        head_ = (head_ + buffer_.size() - 1) % buffer_.size();
+        buffer_[head_] = sample;
+        ++size_;
+    }
+
+    /// @brief Removes the oldest sample
+    void pop_back() {
+        if (size_ > 0) {
+            // Release resources held by the sample, e.g. a string.
+            buffer_[(head_ + size_ - 1) % buffer_.size()] = SampleType();
+            --size_;
+        }
+    }
+
+    /// @brief Removes all samples
+    ///
+    /// The capacity is kept.
+    void clear() {
+        while (size_ > 0) {
+            pop_back();
+        }
+        head_ = 0;
+    }
+
+    /// @brief Returns the samples as a list, the most recent first
+    std::list<SampleType> toList() const {
+        std::list<SampleType> samples;
+        for (size_t i = 0; i < size_; ++i) {
+            samples.push_back(at(i));
+        }
+        return (samples);
+    }
+
+private:
+
+    /// @brief The circular buffer
+    std::vector<SampleType> buffer_;
+
+    /// @brief The position of the most recent sample
+    size_t head_;
+
+    /// @brief The number of samples
+    size_t size_;
+};
+
+}  // namespace stats
+}  // namespace isc
+
+#endif // SAMPLE_RING_H
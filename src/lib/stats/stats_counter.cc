@@ -0,0 +1,46 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/stats_counter.h>
+
+#include <functional>
+#include <thread>
+
+using namespace std;
+
+namespace isc {
+namespace stats {
+
+StatsCounter::StatsCounter(const string& name) : name_(name) {
+}
+
+size_t
+StatsCounter::getCell() {
+    return (hash<thread::id>()(this_thread::get_id()) % CELLS);
+}
+
+int64_t
+StatsCounter::getPending() const {
+    int64_t pending = 0;
+    for (size_t i = 0; i < CELLS; ++i) {
+        pending += cells_[i].value_.load(memory_order_relaxed);
+    }
+    return (pending);
+}
+
+int64_t
+StatsCounter::take() {
+    int64_t pending = 0;
+    for (size_t i = 0; i < CELLS; ++i) {
+        pending += cells_[i].value_.exchange(0, memory_order_relaxed);
+    }
+    return (pending);
+}
+
+}  // namespace stats
+}  // namespace isc
@@ -0,0 +1,102 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef STATS_COUNTER_H
+#define STATS_COUNTER_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <string>
+#include <stdint.h>
+
+namespace isc {
+namespace stats {
+
+/// @brief Handle of an integer statistic for the hot path
+///
+/// Bumping a statistic with @ref StatsMgr::addValue takes the global
+/// mutex of the statistics manager, looks the statistic up by its name
+/// and timestamps a new sample. A counter is a handle of an integer
+/// statistic, obtained once with @ref StatsMgr::getCounter, which only
+/// accumulates the increments: @ref add is a relaxed atomic addition
+/// without lock, string hashing or clock reading.
+///
+/// The accumulated increments are spread over a few cells, each on its
+/// own cache line, so threads seldom write to the same cache line. They
+/// are folded into the statistic as one sample when the statistics
+/// manager reports, resets or removes statistics (e.g. when the
+/// statistic-get command is received).
+class StatsCounter : public boost::noncopyable {
+public:
+
+    /// @brief Number of cells of the accumulated increments
+    static const size_t CELLS = 16;
+
+    /// @brief Constructor
+    ///
+    /// @param name name of the statistic
+    explicit StatsCounter(const std::string& name);
+
+    /// @brief Returns the name of the statistic
+    const std::string& getName() const {
+        return (name_);
+    }
+
+    /// @brief Adds a value to the statistic
+    ///
+    /// Thread safe and lock free.
+    ///
+    /// @param value integer value to be added
+    void add(int64_t value = 1) {
+        cells_[getCell()].value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /// @brief Returns the accumulated increments not yet folded into
+    /// the statistic
+    int64_t getPending() const;
+
+    /// @brief Takes the accumulated increments
+    ///
+    /// Used by the statistics manager to fold the increments into the
+    /// statistic: they are reset to zero.
+    ///
+    /// @return the accumulated increments
+    int64_t take();
+
+private:
+
+    /// @brief Returns the cell of the current thread
+    static size_t getCell();
+
+    /// @brief A cell padded to a cache line
+    struct Cell {
+        /// @brief Constructor
+        Cell() : value_(0) {
+        }
+
+        /// @brief The accumulated increments
+        std::atomic<int64_t> value_;
+
+        /// @brief The padding
+        char pad_[64 - sizeof(std::atomic<int64_t>)];
+    };
+
+    /// @brief The name of the statistic
+    const std::string name_;
+
+    /// @brief The cells
+    Cell cells_[CELLS];
+};
+
+/// @brief Pointer to a statistic counter
+typedef boost::shared_ptr<StatsCounter> StatsCounterPtr;
+
+}  // namespace stats
+}  // namespace isc
+
+#endif // STATS_COUNTER_H
@@ -37,8 +37,10 @@ void
 StatsMgr::setValue(const string& name, const int64_t value) {
     if (MultiThreadingMgr::instance().getMode()) {
         lock_guard<mutex> lock(*mutex_);
+        flushCountersInternal();
         setValueInternal(name, value);
     } else {
+        flushCountersInternal();
         setValueInternal(name, value);
     }
 }
@@ -117,8 +119,10 @@ ObservationPtr
 StatsMgr::getObservation(const string& name) const {
     if (MultiThreadingMgr::instance().getMode()) {
         lock_guard<mutex> lock(*mutex_);
+        flushCountersInternal();
         return (getObservationInternal(name));
     } else {
+        flushCountersInternal();
         return (getObservationInternal(name));
     }
 }
@@ -130,6 +134,60 @@ StatsMgr::getObservationInternal(const string& name) const {
     return (global_->get(name));
 }
 
+StatsCounterPtr
+StatsMgr::getCounter(const string& name) {
+    if (MultiThreadingMgr::instance().getMode()) {
+        lock_guard<mutex> lock(*mutex_);
+        return (getCounterInternal(name));
+    } else {
+        return (getCounterInternal(name));
+    }
+}
+
+StatsCounterPtr
+StatsMgr::getCounterInternal(const string& name) {
+    StatsCounterPtr& counter = counters_[name];
+    if (!counter) {
+        counter.reset(new StatsCounter(name));
+    }
+    return (counter);
+}
+
+void
+StatsMgr::flushCountersInternal() const {
+    for (auto const& it : counters_) {
+        int64_t pending = it.second->take();
+        if (pending == 0) {
+            continue;
+        }
+        ObservationPtr stat = global_->get(it.first);
+        if (!stat) {
+            global_->add(boost::make_shared<Observation>(it.first, pending));
+            continue;
+        }
+        try {
+            stat->addValue(pending);
+        } catch (const InvalidStatType&) {
+            // The statistic was set to another type: drop the increments
+            // as addValue() would have refused them.
+        }
+    }
+}
+
+void
+StatsMgr::discardCountersInternal(const string& name) const {
+    if (name.empty()) {
+        for (auto const& it : counters_) {
+            it.second->take();
+        }
+        return;
+    }
+    auto it = counters_.find(name);
+    if (it != counters_.end()) {
+        it->second->take();
+    }
+}
+
 void
 StatsMgr::addObservation(const ObservationPtr& stat) {
     if (MultiThreadingMgr::instance().getMode()) {
@@ -177,6 +235,7 @@ StatsMgr::setMaxSampleAge(const string& name, const StatsDuration& duration) {
 bool
 StatsMgr::setMaxSampleAgeInternal(const string& name,
                                   const StatsDuration& duration) {
+    flushCountersInternal();
     ObservationPtr obs = getObservationInternal(name);
     if (obs) {
         obs->setMaxSampleAge(duration);
@@ -198,6 +257,7 @@ StatsMgr::setMaxSampleCount(const string& name, uint32_t max_samples) {
 bool
 StatsMgr::setMaxSampleCountInternal(const string& name,
                                     uint32_t max_samples) {
+    flushCountersInternal();
     ObservationPtr obs = getObservationInternal(name);
     if (obs) {
         obs->setMaxSampleCount(max_samples);
@@ -218,6 +278,7 @@ StatsMgr::setMaxSampleAgeAll(const StatsDuration& duration) {
 
 void
 StatsMgr::setMaxSampleAgeAllInternal(const StatsDuration& duration) {
+    flushCountersInternal();
     global_->setMaxSampleAgeAll(duration);
 }
 
@@ -233,6 +294,7 @@ StatsMgr::setMaxSampleCountAll(uint32_t max_samples) {
 
 void
 StatsMgr::setMaxSampleCountAllInternal(uint32_t max_samples) {
+    flushCountersInternal();
     global_->setMaxSampleCountAll(max_samples);
 }
 
@@ -308,6 +370,7 @@ StatsMgr::reset(const string& name) {
 
 bool
 StatsMgr::resetInternal(const string& name) {
+    discardCountersInternal(name);
     ObservationPtr obs = getObservationInternal(name);
     if (obs) {
         obs->reset();
@@ -328,6 +391,7 @@ StatsMgr::del(const string& name) {
 
 bool
 StatsMgr::delInternal(const string& name) {
+    discardCountersInternal(name);
     return (global_->del(name));
 }
 
@@ -343,6 +407,7 @@ StatsMgr::removeAll() {
 
 void
 StatsMgr::removeAllInternal() {
+    discardCountersInternal();
     global_->clear();
 }
 
@@ -358,6 +423,7 @@ StatsMgr::get(const string& name) const {
 
 ConstElementPtr
 StatsMgr::getInternal(const string& name) const {
+    flushCountersInternal();
     ElementPtr map = Element::createMap(); // a map
     ObservationPtr obs = getObservationInternal(name);
     if (obs) {
@@ -378,6 +444,7 @@ StatsMgr::getAll() const {
 
 ConstElementPtr
 StatsMgr::getAllInternal() const {
+    flushCountersInternal();
     return (global_->getAll());
 }
 
@@ -393,6 +460,7 @@ StatsMgr::resetAll() {
 
 void
 StatsMgr::resetAllInternal() {
+    discardCountersInternal();
     global_->resetAll();
 }
 
@@ -408,6 +476,7 @@ StatsMgr::getSize(const string& name) const {
 
 size_t
 StatsMgr::getSizeInternal(const string& name) const {
+    flushCountersInternal();
     ObservationPtr obs = getObservationInternal(name);
     if (obs) {
         return (obs->getSize());
@@ -427,6 +496,7 @@ StatsMgr::count() const {
 
 size_t
 StatsMgr::countInternal() const {
+    flushCountersInternal();
     return (global_->size());
 }
 
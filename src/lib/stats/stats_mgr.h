@@ -9,6 +9,7 @@
 
 #include <stats/observation.h>
 #include <stats/context.h>
+#include <stats/stats_counter.h>
 #include <boost/noncopyable.hpp>
 #include <boost/scoped_ptr.hpp>
 
@@ -128,6 +129,19 @@ public:
     /// @throw InvalidStatType if statistic is not a string
     void addValue(const std::string& name, const std::string& value);
 
+    /// @brief Returns the counter of an integer statistic.
+    ///
+    /// The counter is a handle which adds to the statistic without lock
+    /// (see @ref StatsCounter). It is meant to be obtained once, e.g. at
+    /// startup, and kept by the code bumping the statistic in the packet
+    /// processing path. The same counter is returned for the same name.
+    /// The statistic itself is created by the first increment and the
+    /// counter remains valid when the statistic is removed.
+    ///
+    /// @param name name of the statistic
+    /// @return the counter of the statistic
+    StatsCounterPtr getCounter(const std::string& name);
+
     /// @brief Determines maximum age of samples.
     ///
     /// Specifies that statistic name should be stored not as a single value,
@@ -526,6 +540,36 @@ private:
 
     /// @private
 
+    /// @brief Returns the counter of an integer statistic.
+    ///
+    /// Should be called in a thread safe context.
+    ///
+    /// @param name name of the statistic
+    /// @return the counter of the statistic
+    StatsCounterPtr getCounterInternal(const std::string& name);
+
+    /// @private
+
+    /// @brief Folds the increments accumulated by counters into statistics.
+    ///
+    /// Each statistic with pending increments gets one new sample. This is
+    /// called by methods reporting or changing the statistics so the
+    /// increments are seen in order with other observations.
+    /// Should be called in a thread safe context.
+    void flushCountersInternal() const;
+
+    /// @private
+
+    /// @brief Discards the increments accumulated by counters.
+    ///
+    /// Called when statistics are reset or removed.
+    /// Should be called in a thread safe context.
+    ///
+    /// @param name name of the statistic, all statistics when empty
+    void discardCountersInternal(const std::string& name = "") const;
+
+    /// @private
+
     /// @brief Adds a new observation.
     ///
     /// That's an utility method used by public @ref setValue() and
@@ -775,6 +819,9 @@ private:
     /// @brief This is a global context. All statistics will initially be stored here.
     StatContextPtr global_;
 
+    /// @brief Counters of integer statistics, by statistic name.
+    std::map<std::string, StatsCounterPtr> counters_;
+
     /// @brief The mutex used to protect internal state.
     const boost::scoped_ptr<std::mutex> mutex_;
 };
@@ -499,6 +499,32 @@ TEST_F(ObservationTest, timers) {
     EXPECT_TRUE(sample.second <= after);
 }
 
+// Test checks that many samples are kept in order within the count limit.
+TEST_F(ObservationTest, manySamples) {
+    a.setMaxSampleCount(50);
+    for (int64_t i = 0; i < 1000; ++i) {
+        a.setValue(i);
+    }
+    ASSERT_EQ(50, a.getSize());
+
+    // Samples are listed most recent first with ordered timestamps.
+    std::list<IntegerSample> samples = a.getIntegers();
+    int64_t expected = 999;
+    ptime previous = samples.front().second;
+    for (auto const& sample : samples) {
+        EXPECT_EQ(expected--, sample.first);
+        EXPECT_TRUE(sample.second <= previous);
+        previous = sample.second;
+    }
+
+    // Lowering the limit keeps the most recent samples.
+    a.setMaxSampleCount(3);
+    a.setValue(static_cast<int64_t>(1000));
+    ASSERT_EQ(3, a.getSize());
+    EXPECT_EQ(1000, a.getIntegers().front().first);
+    EXPECT_EQ(998, a.getIntegers().back().first);
+}
+
 // Checks whether an integer statistic can generate proper JSON structures.
 // See https://gitlab.isc.org/isc-projects/kea/wikis/designs/Stats-design
 /// for details.
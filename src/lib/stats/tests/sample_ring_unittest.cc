@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/sample_ring.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace isc;
+using namespace isc::stats;
+
+namespace {
+
+// Checks that samples are stored most recent first and the buffer grows.
+TEST(SampleRingTest, pushPop) {
+    SampleRing<int> ring;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(0, ring.capacity());
+
+    for (int i = 0; i < 5; ++i) {
+        ring.push_front(i);
+    }
+    EXPECT_EQ(5, ring.size());
+    EXPECT_EQ(8, ring.capacity());
+    EXPECT_EQ(4, ring.front());
+    EXPECT_EQ(0, ring.back());
+    for (size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(4 - i, ring.at(i));
+    }
+
+    ring.pop_back();
+    ring.pop_back();
+    EXPECT_EQ(3, ring.size());
+    EXPECT_EQ(2, ring.back());
+
+    std::list<int> samples = ring.toList();
+    ASSERT_EQ(3, samples.size());
+    EXPECT_EQ(4, samples.front());
+    EXPECT_EQ(2, samples.back());
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(8, ring.capacity());
+}
+
+// Checks that a reserved buffer used as a fixed size window does not grow.
+TEST(SampleRingTest, window) {
+    SampleRing<std::string> ring;
+    ring.reserve(3);
+    for (int i = 0; i < 10; ++i) {
+        if (ring.size() == 3) {
+            ring.pop_back();
+        }
+        ring.push_front(std::string(1, 'a' + i));
+    }
+    EXPECT_EQ(3, ring.capacity());
+    EXPECT_EQ("j", ring.at(0));
+    EXPECT_EQ("i", ring.at(1));
+    EXPECT_EQ("h", ring.at(2));
+
+    // The samples are kept when the buffer is resized.
+    ring.reserve(5);
+    EXPECT_EQ(5, ring.capacity());
+    EXPECT_EQ("j", ring.front());
+    EXPECT_EQ("h", ring.back());
+    EXPECT_THROW(ring.reserve(2), InvalidParameter);
+}
+
+}
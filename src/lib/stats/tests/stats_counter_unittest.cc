@@ -0,0 +1,52 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/stats_counter.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace isc::stats;
+
+namespace {
+
+// Checks that increments are accumulated and taken.
+TEST(StatsCounterTest, addTake) {
+    StatsCounter counter("alpha");
+    EXPECT_EQ("alpha", counter.getName());
+    EXPECT_EQ(0, counter.getPending());
+
+    counter.add();
+    counter.add(10);
+    counter.add(-3);
+    EXPECT_EQ(8, counter.getPending());
+
+    EXPECT_EQ(8, counter.take());
+    EXPECT_EQ(0, counter.getPending());
+    EXPECT_EQ(0, counter.take());
+}
+
+// Checks that increments from different threads are all accounted.
+TEST(StatsCounterTest, threads) {
+    StatsCounter counter("alpha");
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.push_back(std::thread([&counter]() {
+            for (int j = 0; j < 100000; ++j) {
+                counter.add();
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(400000, counter.take());
+}
+
+}
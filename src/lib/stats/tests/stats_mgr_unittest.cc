@@ -17,6 +17,8 @@
 
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 using namespace isc;
 using namespace isc::data;
@@ -515,6 +517,105 @@ TEST_F(StatsMgrTest, removeAll) {
     EXPECT_FALSE(StatsMgr::instance().getObservation("delta"));
 }
 
+// This test checks that counters are folded into statistics when these
+// are reported.
+TEST_F(StatsMgrTest, counter) {
+    StatsCounterPtr counter = StatsMgr::instance().getCounter("alpha");
+    ASSERT_TRUE(counter);
+    EXPECT_EQ("alpha", counter->getName());
+
+    // The same counter is returned for the same name.
+    EXPECT_EQ(counter, StatsMgr::instance().getCounter("alpha"));
+
+    // The statistic is created by the first increment when reported.
+    EXPECT_FALSE(StatsMgr::instance().getObservation("alpha"));
+    counter->add();
+    counter->add(2);
+    EXPECT_EQ(3, counter->getPending());
+    ASSERT_TRUE(StatsMgr::instance().getObservation("alpha"));
+    EXPECT_EQ(0, counter->getPending());
+    EXPECT_EQ(3,
+              StatsMgr::instance().getObservation("alpha")->getInteger().first);
+
+    // Counters and addValue() can be mixed. One sample is added for
+    // the increments of the counter.
+    StatsMgr::instance().setMaxSampleCount("alpha", 10);
+    StatsMgr::instance().addValue("alpha", static_cast<int64_t>(10));
+    counter->add(5);
+    counter->add(5);
+    EXPECT_EQ(3, StatsMgr::instance().getSize("alpha"));
+    EXPECT_EQ(23,
+              StatsMgr::instance().getObservation("alpha")->getInteger().first);
+
+    // Setting the statistic takes the pending increments first.
+    counter->add(7);
+    StatsMgr::instance().setValue("alpha", static_cast<int64_t>(100));
+    EXPECT_EQ(100,
+              StatsMgr::instance().getObservation("alpha")->getInteger().first);
+
+    // Increments of a statistic of another type are dropped.
+    EXPECT_TRUE(StatsMgr::instance().del("alpha"));
+    StatsMgr::instance().setValue("alpha", "Lorem ipsum");
+    counter->add();
+    EXPECT_NO_THROW(StatsMgr::instance().get("alpha"));
+    EXPECT_EQ("Lorem ipsum",
+              StatsMgr::instance().getObservation("alpha")->getString().first);
+}
+
+// This test checks that pending increments are discarded when statistics
+// are reset or removed, and that counters remain usable.
+TEST_F(StatsMgrTest, counterResetRemove) {
+    StatsCounterPtr alpha = StatsMgr::instance().getCounter("alpha");
+    StatsCounterPtr beta = StatsMgr::instance().getCounter("beta");
+    alpha->add(5);
+    beta->add(6);
+    EXPECT_EQ(2, StatsMgr::instance().count());
+
+    alpha->add(5);
+    EXPECT_TRUE(StatsMgr::instance().reset("alpha"));
+    EXPECT_EQ(0,
+              StatsMgr::instance().getObservation("alpha")->getInteger().first);
+
+    alpha->add(1);
+    beta->add(1);
+    StatsMgr::instance().resetAll();
+    EXPECT_EQ(0,
+              StatsMgr::instance().getObservation("alpha")->getInteger().first);
+    EXPECT_EQ(0,
+              StatsMgr::instance().getObservation("beta")->getInteger().first);
+
+    beta->add(1);
+    EXPECT_TRUE(StatsMgr::instance().del("beta"));
+    EXPECT_FALSE(StatsMgr::instance().getObservation("beta"));
+
+    alpha->add(1);
+    StatsMgr::instance().removeAll();
+    EXPECT_EQ(0, StatsMgr::instance().count());
+
+    // The statistic is created again by a new increment.
+    alpha->add(2);
+    EXPECT_EQ(2,
+              StatsMgr::instance().getObservation("alpha")->getInteger().first);
+}
+
+// This test checks that a counter can be bumped from many threads.
+TEST_F(StatsMgrTest, counterThreads) {
+    StatsCounterPtr counter = StatsMgr::instance().getCounter("alpha");
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.push_back(std::thread([counter]() {
+            for (int j = 0; j < 10000; ++j) {
+                counter->add();
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(80000,
+              StatsMgr::instance().getObservation("alpha")->getInteger().first);
+}
+
 // This is a performance benchmark that checks how long does it take
 // to increment a single statistic million times.
 //
@@ -537,6 +638,27 @@ TEST_F(StatsMgrTest, DISABLED_performanceSingleAdd) {
               << isc::util::durationToText(dur) << std::endl;
 }
 
+// This is a performance benchmark that checks how long does it take
+// to increment a single statistic million times using a counter.
+TEST_F(StatsMgrTest, DISABLED_performanceSingleCounterAdd) {
+    StatsMgr::instance().removeAll();
+
+    uint32_t cycles = 1000000;
+
+    StatsCounterPtr counter = StatsMgr::instance().getCounter("metric1");
+    ptime before = microsec_clock::local_time();
+    for (uint32_t i = 0; i < cycles; ++i) {
+        counter->add();
+    }
+    StatsMgr::instance().getObservation("metric1");
+    ptime after = microsec_clock::local_time();
+
+    time_duration dur = after - before;
+
+    std::cout << "Incrementing a single counter " << cycles << " times took: "
+              << isc::util::durationToText(dur) << std::endl;
+}
+
 // This is a performance benchmark that checks how long does it take
 // to set absolute value of a single statistic million times.
 //
@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -447,6 +447,24 @@ public:
     /// constructing a new one. Note it must keep current content.
     void clear() { size_ = 0; }
 
+    /// \brief Ensure the buffer can hold a given length of data.
+    ///
+    /// Writing up to this length afterwards does not allocate memory.
+    ///
+    /// \param len The length of data in bytes.
+    void reserve(size_t len) {
+        ensureAllocated(len);
+    }
+
+    /// \brief Swap the content and the memory with another buffer.
+    ///
+    /// \param other The other buffer.
+    void swap(OutputBuffer& other) {
+        std::swap(buffer_, other.buffer_);
+        std::swap(size_, other.size_);
+        std::swap(allocated_, other.allocated_);
+    }
+
     /// \brief Wipe buffer content.
     ///
     /// This method is the destructive alternative to clear().
@@ -12,6 +12,7 @@
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <limits>
 
 namespace isc {
 namespace util {
@@ -111,8 +112,11 @@ CSVRow::checkIndex(const size_t at) const {
     }
 }
 
+const uint64_t CSVFile::READ_CHUNK_SIZE;
+
 CSVFile::CSVFile(const std::string& filename)
-    : filename_(filename), fs_(), cols_(0), read_msg_() {
+    : filename_(filename), fs_(), cols_(0), read_msg_(), journal_(),
+      read_pos_(0), read_end_(std::numeric_limits<uint64_t>::max()) {
 }
 
 CSVFile::~CSVFile() {
@@ -123,6 +127,9 @@ void
 CSVFile::close() {
     // It is allowed to close multiple times. If file has been already closed,
     // this is no-op.
+    if (journal_) {
+        journal_->close();
+    }
     if (fs_) {
         fs_->close();
         fs_.reset();
@@ -141,6 +148,20 @@ void
 CSVFile::flush() const {
     checkStreamStatusAndReset("flush");
     fs_->flush();
+    if (journal_) {
+        journal_->flush();
+    }
+}
+
+void
+CSVFile::setJournal(const FileJournalPtr& journal) {
+    if (journal_) {
+        journal_->close();
+    }
+    journal_ = journal;
+    if (journal_ && fs_ && fs_->is_open()) {
+        journal_->open(filename_);
+    }
 }
 
 void
@@ -173,6 +194,12 @@ CSVFile::append(const CSVRow& row) const {
                   " columns in the CSV file '" << getColumnCount() << "'");
     }
 
+    // The journal writes the row in the background.
+    if (journal_) {
+        journal_->append(row.render() + "\n");
+        return;
+    }
+
     /// @todo Apparently, seekp and seekg are interchangeable. A call to seekp
     /// results in moving the input pointer too. This is ok for now. It means
     /// that when the append() is called, the read pointer is moved to the EOF.
@@ -269,9 +296,16 @@ CSVFile::next(CSVRow& row, const bool skip_validation) {
         return (false);
     }
 
+    // Behave as at the end of file after the read range.
+    if (read_pos_ >= read_end_) {
+        row = EMPTY_ROW();
+        return (true);
+    }
+
     // Get exactly one line of the file.
     std::string line;
     std::getline(*fs_, line);
+    read_pos_ += line.size() + 1;
     // If we got empty line because we reached the end of file
     // return an empty row.
     if (line.empty() && fs_->eof()) {
@@ -292,6 +326,20 @@ CSVFile::next(CSVRow& row, const bool skip_validation) {
     return (skip_validation ? true : validate(row));
 }
 
+void
+CSVFile::setReadRange(const uint64_t begin, const uint64_t end) {
+    checkStreamStatusAndReset("set read range");
+    if (begin > read_pos_) {
+        // Skip the rest of the row beginning before the range, which
+        // belongs to the previous range.
+        fs_->seekg(static_cast<std::streamoff>(begin - 1));
+        std::string skipped;
+        std::getline(*fs_, skipped);
+        read_pos_ = begin + skipped.size();
+    }
+    read_end_ = end;
+}
+
 void
 CSVFile::open(const bool seek_to_end) {
     // If file doesn't exist or is empty, we have to create our own file.
@@ -301,6 +349,8 @@ CSVFile::open(const bool seek_to_end) {
     } else {
         // Try to open existing file, holding some data.
         fs_.reset(new std::fstream(filename_.c_str()));
+        read_pos_ = 0;
+        read_end_ = std::numeric_limits<uint64_t>::max();
 
         // Catch exceptions so as we can close the file if error occurs.
         try {
@@ -353,6 +403,10 @@ CSVFile::open(const bool seek_to_end) {
                 fs_->clear();
             }
 
+            if (journal_) {
+                journal_->open(filename_);
+            }
+
         } catch (const std::exception&) {
             close();
             throw;
@@ -372,6 +426,8 @@ CSVFile::recreate() {
     // Close any dangling files.
     close();
     fs_.reset(new std::fstream(filename_.c_str(), std::fstream::out));
+    read_pos_ = 0;
+    read_end_ = std::numeric_limits<uint64_t>::max();
     if (!fs_->is_open()) {
         close();
         isc_throw(CSVFileError, "unable to open '" << filename_ << "'");
@@ -384,6 +440,10 @@ CSVFile::recreate() {
         }
         *fs_ << header << std::endl;
 
+        if (journal_) {
+            journal_->open(filename_);
+        }
+
     } catch (const std::exception& ex) {
         close();
         isc_throw(CSVFileError, ex.what());
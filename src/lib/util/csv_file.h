@@ -8,9 +8,11 @@
 #define CSV_FILE_H
 
 #include <exceptions/exceptions.h>
+#include <util/file_journal.h>
 #include <boost/lexical_cast.hpp>
 #include <boost/shared_ptr.hpp>
 #include <fstream>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -351,6 +353,10 @@ std::ostream& operator<<(std::ostream& os, const CSVRow& row);
 /// immediately written into it. The header consists of the column names
 /// specified with the @c addColumn function. The subsequent rows are written
 /// into this file by calling @c append.
+///
+/// When a journal is attached with @c setJournal, the appended rows are
+/// queued to the journal, which writes them to the file in the background.
+/// The journal follows the file when it is closed, opened or recreated.
 class CSVFile {
 public:
 
@@ -379,6 +385,7 @@ public:
     ///
     /// @throw CSVFileError When error occurred during IO operation or if the
     /// size of the row doesn't match the number of columns.
+    /// @throw FileJournalError When the journal failed.
     void append(const CSVRow& row) const;
 
     /// @brief Closes the CSV file.
@@ -393,6 +400,9 @@ public:
     bool exists() const;
 
     /// @brief Flushes a file.
+    ///
+    /// When a journal is attached, waits until the rows queued to it are
+    /// written.
     void flush() const;
 
     /// @brief Returns the number of columns in the file.
@@ -483,6 +493,44 @@ public:
         read_msg_ = read_msg;
     }
 
+    /// @brief Attaches a journal writing the appended rows.
+    ///
+    /// If the file is open, the journal is opened on it.
+    ///
+    /// @param journal The journal or null to write the rows directly.
+    void setJournal(const FileJournalPtr& journal);
+
+    /// @brief Returns the journal writing the appended rows.
+    FileJournalPtr getJournal() const {
+        return (journal_);
+    }
+
+    /// @brief Default size of the ranges the file is split into to be
+    /// read concurrently, in bytes.
+    static const uint64_t READ_CHUNK_SIZE = 1 << 20;
+
+    /// @brief Returns the size of the file.
+    ///
+    /// The read ranges (see @c setReadRange) are expressed in bytes.
+    uint64_t getReadSize() const {
+        return (static_cast<uint64_t>(size()));
+    }
+
+    /// @brief Restricts the reading to the rows beginning in a range of
+    /// the file.
+    ///
+    /// The next row read is the first row beginning at or after the
+    /// beginning of the range, and the end of file is returned instead of
+    /// the first row beginning at or after its end. The header is never
+    /// returned. This lets several objects read the parts of a file
+    /// concurrently: each row belongs to exactly one of the adjacent
+    /// ranges.
+    ///
+    /// @param begin Offset of the beginning of the range.
+    /// @param end Offset of the end of the range.
+    /// @throw CSVFileError if the file is not open.
+    void setReadRange(const uint64_t begin, const uint64_t end);
+
     /// @brief Represents empty row.
     static CSVRow EMPTY_ROW() {
         static CSVRow row(0);
@@ -563,6 +611,15 @@ private:
 
     /// @brief Holds last error during row reading or validation.
     std::string read_msg_;
+
+    /// @brief Journal writing the appended rows, if any.
+    FileJournalPtr journal_;
+
+    /// @brief Offset of the next row read.
+    uint64_t read_pos_;
+
+    /// @brief Offset of the end of the read range.
+    uint64_t read_end_;
 };
 
 } // namespace isc::util
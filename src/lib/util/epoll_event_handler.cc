@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#if defined (OS_LINUX)
+
+#include <exceptions/exceptions.h>
+#include <util/epoll_event_handler.h>
+
+#include <algorithm>
+#include <climits>
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace isc {
+namespace util {
+
+const size_t EpollEventHandler::MAX_EVENTS;
+
+EpollEventHandler::EpollEventHandler()
+    : FDEventHandler(TYPE_EPOLL), epoll_fd_(-1) {
+    open();
+}
+
+EpollEventHandler::~EpollEventHandler() {
+    close(epoll_fd_);
+}
+
+void
+EpollEventHandler::open() {
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0) {
+        isc_throw(Unexpected, "failed to create epoll instance: "
+                  << strerror(errno));
+    }
+}
+
+void
+EpollEventHandler::add(int fd) {
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if ((epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0) &&
+        (errno != EEXIST)) {
+        isc_throw(BadValue, "failed to register file descriptor " << fd
+                  << " for epoll: " << strerror(errno));
+    }
+}
+
+int
+EpollEventHandler::waitEvent(uint32_t timeout_sec, uint32_t timeout_usec,
+                             bool use_timeout) {
+    ready_fds_.clear();
+
+    int timeout = -1;
+    if (use_timeout) {
+        uint64_t timeout_ms = static_cast<uint64_t>(timeout_sec) * 1000 +
+            (timeout_usec + 999) / 1000;
+        timeout = static_cast<int>(std::min(timeout_ms,
+                                            static_cast<uint64_t>(INT_MAX)));
+    }
+
+    struct epoll_event events[MAX_EVENTS];
+
+    // zero out the errno to be safe
+    errno = 0;
+
+    int result = epoll_wait(epoll_fd_, events, MAX_EVENTS, timeout);
+    for (int i = 0; i < result; ++i) {
+        ready_fds_.push_back(events[i].data.fd);
+    }
+    return (result);
+}
+
+bool
+EpollEventHandler::readReady(int fd) const {
+    return (std::find(ready_fds_.begin(), ready_fds_.end(), fd) !=
+            ready_fds_.end());
+}
+
+void
+EpollEventHandler::clear() {
+    ready_fds_.clear();
+    close(epoll_fd_);
+    epoll_fd_ = -1;
+    open();
+}
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // OS_LINUX
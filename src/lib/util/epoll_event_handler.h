@@ -0,0 +1,78 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef EPOLL_EVENT_HANDLER_H
+#define EPOLL_EVENT_HANDLER_H
+
+#include <util/fd_event_handler.h>
+
+namespace isc {
+namespace util {
+
+/// @brief File descriptor event handler class using epoll().
+///
+/// Available on Linux only. The file descriptors are registered in the
+/// kernel, so the cost of a wait does not depend on their number and
+/// there is no FD_SETSIZE limit. A closed file descriptor is silently
+/// unregistered by the kernel.
+class EpollEventHandler : public FDEventHandler {
+public:
+
+    /// @brief Maximum number of events returned by a waitEvent call.
+    static const size_t MAX_EVENTS = 64;
+
+    /// @brief Constructor.
+    ///
+    /// @throw isc::Unexpected if the epoll instance can't be created.
+    EpollEventHandler();
+
+    /// @brief Destructor.
+    virtual ~EpollEventHandler();
+
+    /// @brief Registers a file descriptor.
+    ///
+    /// @param fd The file descriptor.
+    /// @throw isc::BadValue if the file descriptor can't be registered,
+    /// e.g. because it is not open.
+    virtual void add(int fd);
+
+    /// @brief Waits for events on the registered file descriptors.
+    ///
+    /// The timeout is rounded up to a millisecond.
+    ///
+    /// @param timeout_sec The timeout in seconds.
+    /// @param timeout_usec The fractional part of the timeout in
+    /// microseconds.
+    /// @param use_timeout Wait indefinitely when false.
+    /// @return The epoll_wait() result.
+    virtual int waitEvent(uint32_t timeout_sec, uint32_t timeout_usec = 0,
+                          bool use_timeout = true);
+
+    /// @brief Checks if a file descriptor is ready to read.
+    ///
+    /// @param fd The file descriptor.
+    /// @return True if the file descriptor was found ready by the last
+    /// waitEvent call.
+    virtual bool readReady(int fd) const;
+
+    /// @brief Unregisters all file descriptors.
+    ///
+    /// @throw isc::Unexpected if the epoll instance can't be created.
+    virtual void clear();
+
+private:
+
+    /// @brief Creates the epoll instance.
+    void open();
+
+    /// @brief The epoll instance.
+    int epoll_fd_;
+};
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // EPOLL_EVENT_HANDLER_H
@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <util/epoll_event_handler.h>
+#include <util/fd_event_handler.h>
+#include <util/select_event_handler.h>
+
+namespace isc {
+namespace util {
+
+FDEventHandlerPtr
+createFDEventHandler() {
+#if defined (OS_LINUX)
+    return (FDEventHandlerPtr(new EpollEventHandler()));
+#else
+    return (FDEventHandlerPtr(new SelectEventHandler()));
+#endif
+}
+
+} // namespace isc::util
+} // namespace isc
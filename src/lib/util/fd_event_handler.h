@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef FD_EVENT_HANDLER_H
+#define FD_EVENT_HANDLER_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace util {
+
+/// @brief File descriptor event handler class
+///
+/// Waits for the registered file descriptors to become ready to read,
+/// like a select() call, but the file descriptors are registered once
+/// and kept across the calls to @ref waitEvent. The implementations
+/// differ by the system call they use.
+class FDEventHandler : public boost::noncopyable {
+public:
+
+    /// @brief Type of the event handler.
+    enum HandlerType {
+        TYPE_SELECT = 0,  ///< select() based.
+        TYPE_EPOLL = 1    ///< epoll() based, Linux only.
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param type The type of the event handler.
+    explicit FDEventHandler(HandlerType type) : type_(type) {
+    }
+
+    /// @brief Destructor.
+    virtual ~FDEventHandler() {
+    }
+
+    /// @brief Returns the type of the event handler.
+    HandlerType type() const {
+        return (type_);
+    }
+
+    /// @brief Registers a file descriptor.
+    ///
+    /// Registering a file descriptor twice has no effect.
+    ///
+    /// @param fd The file descriptor.
+    /// @throw isc::BadValue if the file descriptor can't be registered.
+    virtual void add(int fd) = 0;
+
+    /// @brief Waits for events on the registered file descriptors.
+    ///
+    /// @param timeout_sec The timeout in seconds.
+    /// @param timeout_usec The fractional part of the timeout in
+    /// microseconds.
+    /// @param use_timeout Wait indefinitely when false.
+    /// @return -1 on error (errno is set), 0 if no event occurred before
+    /// the timeout, the number of ready file descriptors otherwise.
+    virtual int waitEvent(uint32_t timeout_sec, uint32_t timeout_usec = 0,
+                          bool use_timeout = true) = 0;
+
+    /// @brief Checks if a file descriptor is ready to read.
+    ///
+    /// @param fd The file descriptor.
+    /// @return True if the file descriptor was found ready by the last
+    /// @ref waitEvent call.
+    virtual bool readReady(int fd) const = 0;
+
+    /// @brief Returns the file descriptors found ready by the last
+    /// @ref waitEvent call.
+    const std::vector<int>& getReadyFds() const {
+        return (ready_fds_);
+    }
+
+    /// @brief Unregisters all file descriptors.
+    virtual void clear() = 0;
+
+protected:
+
+    /// @brief The file descriptors found ready by the last waitEvent call.
+    std::vector<int> ready_fds_;
+
+private:
+
+    /// @brief The type of the event handler.
+    HandlerType type_;
+};
+
+/// @brief Shared pointer to an event handler.
+typedef boost::shared_ptr<FDEventHandler> FDEventHandlerPtr;
+
+/// @brief Creates the event handler suited to the system.
+///
+/// @return An epoll() based handler on Linux, a select() based handler
+/// otherwise.
+FDEventHandlerPtr createFDEventHandler();
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // FD_EVENT_HANDLER_H
@@ -0,0 +1,337 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <util/file_journal.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+/// @brief Synchronizes the data of a file to the disk.
+///
+/// @param fd The file descriptor.
+/// @return 0 on success, -1 on error.
+int
+syncFile(int fd) {
+#ifdef __APPLE__
+    return (fsync(fd));
+#else
+    return (fdatasync(fd));
+#endif
+}
+
+}
+
+namespace isc {
+namespace util {
+
+FileJournal::FileJournal(const Durability& durability,
+                         const long sync_interval)
+    : durability_(durability), sync_interval_(sync_interval), fd_(-1),
+      appended_(0), dequeued_(0), written_(0), synced_(0), writing_(false),
+      next_sync_(std::chrono::steady_clock::now()), write_count_(0),
+      sync_count_(0), stop_(false) {
+    thread_ = std::thread(&FileJournal::run, this);
+}
+
+FileJournal::~FileJournal() {
+    close();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    thread_.join();
+}
+
+void
+FileJournal::open(const std::string& filename) {
+    close();
+    int fd = ::open(filename.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC,
+                    S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        isc_throw(FileJournalError, "unable to open '" << filename
+                  << "': " << strerror(errno));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    fd_ = fd;
+    filename_ = filename;
+    // A new file clears a previous error.
+    error_.clear();
+    next_sync_ = std::chrono::steady_clock::now() + sync_interval_;
+}
+
+void
+FileJournal::close() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (fd_ < 0) {
+        return;
+    }
+    flushInternal(lock, durability_ != DURABILITY_NONE);
+    ::close(fd_);
+    fd_ = -1;
+}
+
+bool
+FileJournal::isOpen() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (fd_ >= 0);
+}
+
+uint64_t
+FileJournal::append(const std::string& text) {
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (fd_ < 0) {
+            isc_throw(FileJournalError, "attempt to append to a closed journal");
+        }
+        queue_.append(text);
+        sequence = ++appended_;
+    }
+    work_cv_.notify_one();
+    return (sequence);
+}
+
+uint64_t
+FileJournal::getSequence() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (appended_);
+}
+
+void
+FileJournal::wait(const uint64_t sequence) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (durability_ != DURABILITY_NONE) {
+        const uint64_t& safe = (durability_ == DURABILITY_PERIODIC ?
+                                written_ : synced_);
+        done_cv_.wait(lock, [this, &safe, sequence]() {
+            return ((safe >= sequence) || getLostError(sequence));
+        });
+    }
+    // The records following a lost one may have been written since, so
+    // the lost records are checked first.
+    const std::string* error = getLostError(sequence);
+    if (error) {
+        isc_throw(FileJournalError, *error);
+    }
+}
+
+void
+FileJournal::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (fd_ >= 0) {
+        flushInternal(lock, durability_ != DURABILITY_NONE);
+    }
+    if (!error_.empty()) {
+        // Report the error once.
+        std::string error;
+        error.swap(error_);
+        isc_throw(FileJournalError, error);
+    }
+}
+
+uint64_t
+FileJournal::getWriteCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (write_count_);
+}
+
+uint64_t
+FileJournal::getSyncCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (sync_count_);
+}
+
+FileJournal::Durability
+FileJournal::durabilityFromText(const std::string& text) {
+    if (text == "none") {
+        return (DURABILITY_NONE);
+    } else if (text == "periodic") {
+        return (DURABILITY_PERIODIC);
+    } else if (text == "group-commit") {
+        return (DURABILITY_GROUP_COMMIT);
+    }
+    isc_throw(BadValue, "invalid durability policy '" << text
+              << "', expected none, periodic or group-commit");
+}
+
+std::string
+FileJournal::durabilityToText(const Durability& durability) {
+    switch (durability) {
+    case DURABILITY_NONE:
+        return ("none");
+    case DURABILITY_PERIODIC:
+        return ("periodic");
+    default:
+        ;
+    }
+    return ("group-commit");
+}
+
+void
+FileJournal::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        bool sync_pending = ((durability_ == DURABILITY_PERIODIC) &&
+                             (fd_ >= 0) && (synced_ < written_));
+        if (queue_.empty() && !stop_) {
+            if (sync_pending) {
+                work_cv_.wait_until(lock, next_sync_);
+            } else {
+                work_cv_.wait(lock);
+            }
+        }
+
+        if (!queue_.empty()) {
+            const uint64_t first = dequeued_ + 1;
+            const uint64_t sequence = appended_;
+            dequeued_ = sequence;
+            if (fd_ < 0) {
+                // The records can't be written any more.
+                queue_.clear();
+                fail(first, sequence, "attempt to write to a closed journal");
+                done_cv_.notify_all();
+                continue;
+            }
+            // Take all the queued records.
+            std::string batch;
+            batch.swap(queue_);
+            const int fd = fd_;
+            const bool sync = (durability_ == DURABILITY_GROUP_COMMIT);
+            writing_ = true;
+            lock.unlock();
+            std::string error = writeAll(fd, batch);
+            if (error.empty() && sync && (syncFile(fd) != 0)) {
+                error = strerror(errno);
+            }
+            lock.lock();
+            writing_ = false;
+            ++write_count_;
+            if (error.empty()) {
+                written_ = sequence;
+                if (sync) {
+                    synced_ = sequence;
+                    ++sync_count_;
+                }
+            } else {
+                fail(first, sequence,
+                     "failed to write to '" + filename_ + "': " + error);
+            }
+            done_cv_.notify_all();
+        }
+
+        if ((durability_ == DURABILITY_PERIODIC) && (fd_ >= 0) &&
+            (synced_ < written_) &&
+            (std::chrono::steady_clock::now() >= next_sync_)) {
+            const uint64_t sequence = written_;
+            const int fd = fd_;
+            writing_ = true;
+            lock.unlock();
+            int result = syncFile(fd);
+            std::string error = (result == 0 ? "" : strerror(errno));
+            lock.lock();
+            writing_ = false;
+            if (error.empty()) {
+                synced_ = sequence;
+                ++sync_count_;
+            } else {
+                // The records were written so they are not lost: the
+                // synchronization is retried at the next interval.
+                error_ = "failed to synchronize '" + filename_ + "': " + error;
+            }
+            next_sync_ = std::chrono::steady_clock::now() + sync_interval_;
+            done_cv_.notify_all();
+        }
+
+        if (stop_ && queue_.empty()) {
+            return;
+        }
+    }
+}
+
+void
+FileJournal::flushInternal(std::unique_lock<std::mutex>& lock, bool sync) {
+    // Let the writer thread finish its batch.
+    done_cv_.wait(lock, [this]() { return (!writing_); });
+    if (!queue_.empty()) {
+        const uint64_t first = dequeued_ + 1;
+        dequeued_ = appended_;
+        std::string error = writeAll(fd_, queue_);
+        queue_.clear();
+        ++write_count_;
+        if (!error.empty()) {
+            fail(first, appended_,
+                 "failed to write to '" + filename_ + "': " + error);
+            done_cv_.notify_all();
+            return;
+        }
+    }
+    written_ = appended_;
+    if (sync && (synced_ < written_)) {
+        if (syncFile(fd_) != 0) {
+            std::string error = "failed to synchronize '" + filename_ +
+                "': " + strerror(errno);
+            if (durability_ == DURABILITY_GROUP_COMMIT) {
+                fail(synced_ + 1, written_, error);
+            } else {
+                error_ = error;
+            }
+        } else {
+            synced_ = written_;
+            ++sync_count_;
+        }
+    }
+    done_cv_.notify_all();
+}
+
+std::string
+FileJournal::writeAll(int fd, const std::string& data) {
+    const char* ptr = data.data();
+    size_t left = data.size();
+    while (left > 0) {
+        ssize_t count = ::write(fd, ptr, left);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return (strerror(errno));
+        }
+        ptr += count;
+        left -= static_cast<size_t>(count);
+    }
+    return ("");
+}
+
+void
+FileJournal::fail(const uint64_t first, const uint64_t last,
+                  const std::string& error) {
+    error_ = error;
+    if (!lost_.empty() && (lost_.back().last_ + 1 == first)) {
+        lost_.back().last_ = last;
+        lost_.back().error_ = error;
+    } else {
+        lost_.push_back(LostRecords{first, last, error});
+    }
+}
+
+const std::string*
+FileJournal::getLostError(const uint64_t sequence) const {
+    for (auto it = lost_.rbegin(); it != lost_.rend(); ++it) {
+        if ((sequence >= it->first_) && (sequence <= it->last_)) {
+            return (&it->error_);
+        }
+    }
+    return (0);
+}
+
+} // end of isc::util namespace
+} // end of isc namespace
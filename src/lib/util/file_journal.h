@@ -0,0 +1,269 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef FILE_JOURNAL_H
+#define FILE_JOURNAL_H
+
+#include <exceptions/exceptions.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace isc {
+namespace util {
+
+/// @brief Exception thrown when the journal failed to write to its file.
+class FileJournalError : public Exception {
+public:
+    FileJournalError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
+/// @brief Write-behind journal appending text to a file.
+///
+/// The text appended by many threads is queued and written by a dedicated
+/// writer thread, which takes all the queued text in one write, so the
+/// appending threads do not wait for the disk and the records written at
+/// the same time are grouped in one system call.
+///
+/// Each appended record gets a sequence number. A thread which must not
+/// proceed until its record is safe, e.g. a server which acknowledges a
+/// lease to a client, waits for its sequence number according to the
+/// durability policy:
+/// - @c DURABILITY_NONE: records are not waited for; they reach the file
+///   shortly after they are appended.
+/// - @c DURABILITY_PERIODIC: records are waited for until they are
+///   written to the file; the file is synchronized to the disk
+///   periodically.
+/// - @c DURABILITY_GROUP_COMMIT: records are waited for until they are
+///   synchronized to the disk. All the records queued while the previous
+///   synchronization was in progress are synchronized together.
+///
+/// When a write fails, the error is reported by the waits for the records
+/// of the failed batch and once by the next flush. The following records
+/// are written as usual.
+class FileJournal : public boost::noncopyable {
+public:
+
+    /// @brief Durability policies.
+    enum Durability {
+        DURABILITY_NONE,
+        DURABILITY_PERIODIC,
+        DURABILITY_GROUP_COMMIT
+    };
+
+    /// @brief Constructor.
+    ///
+    /// Starts the writer thread. The journal has no file until
+    /// @c open is called.
+    ///
+    /// @param durability The durability policy.
+    /// @param sync_interval Interval between the synchronizations of the
+    /// periodic policy, in milliseconds.
+    explicit FileJournal(const Durability& durability,
+                         const long sync_interval = 1000);
+
+    /// @brief Destructor.
+    ///
+    /// Writes the queued records, closes the file and stops the writer
+    /// thread.
+    ~FileJournal();
+
+    /// @brief Opens the file the records are appended to.
+    ///
+    /// The current file, if any, is closed first.
+    ///
+    /// @param filename The name of the file.
+    /// @throw FileJournalError if the file can't be opened.
+    void open(const std::string& filename);
+
+    /// @brief Writes the queued records and closes the file.
+    ///
+    /// The file is synchronized to the disk unless the policy is
+    /// @c DURABILITY_NONE. It is allowed to close the journal several
+    /// times.
+    void close();
+
+    /// @brief Checks if the journal has a file.
+    bool isOpen() const;
+
+    /// @brief Queues a record.
+    ///
+    /// @param text The record, including its line terminator.
+    /// @return The sequence number of the record.
+    /// @throw FileJournalError if the journal has no file.
+    uint64_t append(const std::string& text);
+
+    /// @brief Returns the sequence number of the last appended record.
+    uint64_t getSequence() const;
+
+    /// @brief Waits until a record is safe according to the policy.
+    ///
+    /// With the @c DURABILITY_NONE policy, it does not wait and only
+    /// reports a failure already known.
+    ///
+    /// @param sequence The sequence number of the record.
+    /// @throw FileJournalError if the record could not be written or
+    /// synchronized.
+    void wait(const uint64_t sequence);
+
+    /// @brief Waits until all the records are written and synchronized.
+    ///
+    /// The records are synchronized to the disk unless the policy is
+    /// @c DURABILITY_NONE.
+    ///
+    /// @throw FileJournalError if a write or a synchronization failed
+    /// since the previous flush. The error is reported once.
+    void flush();
+
+    /// @brief Returns the durability policy.
+    Durability getDurability() const {
+        return (durability_);
+    }
+
+    /// @brief Returns the number of writes of the writer thread.
+    uint64_t getWriteCount() const;
+
+    /// @brief Returns the number of synchronizations to the disk.
+    uint64_t getSyncCount() const;
+
+    /// @brief Converts the name of a durability policy.
+    ///
+    /// @param text "none", "periodic" or "group-commit".
+    /// @return The durability policy.
+    /// @throw BadValue if the name is unknown.
+    static Durability durabilityFromText(const std::string& text);
+
+    /// @brief Returns the name of a durability policy.
+    ///
+    /// @param durability The durability policy.
+    static std::string durabilityToText(const Durability& durability);
+
+private:
+
+    /// @brief Body of the writer thread.
+    void run();
+
+    /// @brief Writes the queued records and synchronizes the file.
+    ///
+    /// Must be called with the mutex locked and the writer idle.
+    ///
+    /// @param lock The lock of the mutex.
+    /// @param sync Synchronize the file to the disk.
+    void flushInternal(std::unique_lock<std::mutex>& lock, bool sync);
+
+    /// @brief Writes a buffer to the file.
+    ///
+    /// @param fd The file descriptor.
+    /// @param data The buffer.
+    /// @return An empty string or the error.
+    static std::string writeAll(int fd, const std::string& data);
+
+    /// @brief Records the failure of a batch.
+    ///
+    /// Must be called with the mutex locked.
+    ///
+    /// @param first The sequence number of the first record of the batch.
+    /// @param last The sequence number of the last record of the batch.
+    /// @param error The error.
+    void fail(const uint64_t first, const uint64_t last,
+              const std::string& error);
+
+    /// @brief Returns the error of a record which was not written.
+    ///
+    /// Must be called with the mutex locked.
+    ///
+    /// @param sequence The sequence number of the record.
+    /// @return The error or null when the record was not lost.
+    const std::string* getLostError(const uint64_t sequence) const;
+
+    /// @brief Sequence numbers of the records of failed batches.
+    struct LostRecords {
+        /// @brief The first lost record.
+        uint64_t first_;
+
+        /// @brief The last lost record.
+        uint64_t last_;
+
+        /// @brief The error.
+        std::string error_;
+    };
+
+    /// @brief The durability policy.
+    const Durability durability_;
+
+    /// @brief Interval between the periodic synchronizations.
+    const std::chrono::milliseconds sync_interval_;
+
+    /// @brief Protects the members below.
+    mutable std::mutex mutex_;
+
+    /// @brief Signals the writer thread that there is work.
+    std::condition_variable work_cv_;
+
+    /// @brief Signals the waiting threads that records were written or
+    /// synchronized.
+    std::condition_variable done_cv_;
+
+    /// @brief The name of the file.
+    std::string filename_;
+
+    /// @brief The file descriptor or -1.
+    int fd_;
+
+    /// @brief The queued records.
+    std::string queue_;
+
+    /// @brief Sequence number of the last appended record.
+    uint64_t appended_;
+
+    /// @brief Sequence number of the last record taken from the queue.
+    uint64_t dequeued_;
+
+    /// @brief Sequence number of the last written record.
+    uint64_t written_;
+
+    /// @brief Sequence number of the last synchronized record.
+    uint64_t synced_;
+
+    /// @brief Is the writer thread writing a batch?
+    bool writing_;
+
+    /// @brief Time of the next periodic synchronization.
+    std::chrono::steady_clock::time_point next_sync_;
+
+    /// @brief Number of writes.
+    uint64_t write_count_;
+
+    /// @brief Number of synchronizations.
+    uint64_t sync_count_;
+
+    /// @brief The error not reported by a flush yet, if any.
+    std::string error_;
+
+    /// @brief The lost records. Adjacent failed batches are merged.
+    std::vector<LostRecords> lost_;
+
+    /// @brief Stops the writer thread.
+    bool stop_;
+
+    /// @brief The writer thread.
+    std::thread thread_;
+};
+
+/// @brief Pointer to a journal.
+typedef boost::shared_ptr<FileJournal> FileJournalPtr;
+
+} // end of isc::util namespace
+} // end of isc namespace
+
+#endif // FILE_JOURNAL_H
@@ -0,0 +1,447 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef FLAT_MULTIMAP_H
+#define FLAT_MULTIMAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace isc {
+namespace util {
+
+/// @brief Sorted associative container with equivalent keys stored in
+/// a contiguous array.
+///
+/// This is a drop-in replacement of @c std::multimap for small
+/// collections which are mostly built once and then looked up or
+/// iterated over: the elements are kept sorted by key in a single
+/// array, equivalent keys in insertion order, so a lookup is a binary
+/// search over contiguous memory and the whole collection costs one
+/// allocation instead of one per element.
+///
+/// Unlike with @c std::multimap, an insertion or an erasure invalidates
+/// the iterators and references to the elements at and after the
+/// position, and an insertion which grows the array invalidates all of
+/// them. The erase methods return the iterator to the next element so
+/// the usual erasure loops remain valid.
+///
+/// @tparam Key Type of the keys.
+/// @tparam T Type of the mapped values, which must be nothrow move
+/// constructible.
+/// @tparam Compare Ordering of the keys.
+template<typename Key, typename T, typename Compare = std::less<Key> >
+class FlatMultimap {
+public:
+
+    /// @brief Type of the keys.
+    typedef Key key_type;
+
+    /// @brief Type of the mapped values.
+    typedef T mapped_type;
+
+    /// @brief Type of the elements, as in @c std::multimap.
+    typedef std::pair<const Key, T> value_type;
+
+    /// @brief Type of the sizes.
+    typedef size_t size_type;
+
+    /// @brief Ordering of the keys.
+    typedef Compare key_compare;
+
+    /// @brief Reference to an element.
+    typedef value_type& reference;
+
+    /// @brief Constant reference to an element.
+    typedef const value_type& const_reference;
+
+    /// @brief Iterator over the elements.
+    typedef value_type* iterator;
+
+    /// @brief Constant iterator over the elements.
+    typedef const value_type* const_iterator;
+
+    /// @brief Reverse iterator over the elements.
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+
+    /// @brief Constant reverse iterator over the elements.
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /// @brief Constructor of an empty container.
+    FlatMultimap()
+        : data_(0), size_(0), capacity_(0) {
+    }
+
+    /// @brief Constructor from a range of elements.
+    ///
+    /// @param first Beginning of the range.
+    /// @param last End of the range.
+    template<typename InputIterator>
+    FlatMultimap(InputIterator first, InputIterator last)
+        : data_(0), size_(0), capacity_(0) {
+        insert(first, last);
+    }
+
+    /// @brief Copy constructor.
+    ///
+    /// @param other The container to copy.
+    FlatMultimap(const FlatMultimap& other)
+        : data_(0), size_(0), capacity_(0) {
+        reserve(other.size_);
+        for (const_iterator it = other.begin(); it != other.end(); ++it) {
+            new (data_ + size_) value_type(*it);
+            ++size_;
+        }
+    }
+
+    /// @brief Move constructor.
+    ///
+    /// @param other The container to move, left empty.
+    FlatMultimap(FlatMultimap&& other) noexcept
+        : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+        other.data_ = 0;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    /// @brief Destructor.
+    ~FlatMultimap() {
+        clear();
+        ::operator delete(data_);
+    }
+
+    /// @brief Assignment operator.
+    ///
+    /// @param other The container to copy or to move.
+    FlatMultimap& operator=(FlatMultimap other) {
+        swap(other);
+        return (*this);
+    }
+
+    /// @brief Swaps the content with another container.
+    ///
+    /// @param other The other container.
+    void swap(FlatMultimap& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    /// @name Iterators.
+    //@{
+    iterator begin() {
+        return (data_);
+    }
+
+    const_iterator begin() const {
+        return (data_);
+    }
+
+    const_iterator cbegin() const {
+        return (data_);
+    }
+
+    iterator end() {
+        return (data_ + size_);
+    }
+
+    const_iterator end() const {
+        return (data_ + size_);
+    }
+
+    const_iterator cend() const {
+        return (data_ + size_);
+    }
+
+    reverse_iterator rbegin() {
+        return (reverse_iterator(end()));
+    }
+
+    const_reverse_iterator rbegin() const {
+        return (const_reverse_iterator(end()));
+    }
+
+    reverse_iterator rend() {
+        return (reverse_iterator(begin()));
+    }
+
+    const_reverse_iterator rend() const {
+        return (const_reverse_iterator(begin()));
+    }
+    //@}
+
+    /// @brief Returns the number of elements.
+    size_type size() const {
+        return (size_);
+    }
+
+    /// @brief Checks if the container is empty.
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+    /// @brief Returns the number of elements the container can hold
+    /// without growing.
+    size_type capacity() const {
+        return (capacity_);
+    }
+
+    /// @brief Grows the array to hold a number of elements.
+    ///
+    /// @param capacity The number of elements.
+    void reserve(size_type capacity) {
+        if (capacity > capacity_) {
+            reallocate(capacity, size_);
+        }
+    }
+
+    /// @brief Removes all elements, keeping the array.
+    void clear() {
+        destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    /// @brief Inserts an element after the elements with an equivalent
+    /// key.
+    ///
+    /// @param value The element, or a pair convertible to it.
+    /// @return Iterator to the inserted element.
+    template<typename P, typename = typename std::enable_if<
+                             std::is_constructible<value_type, P&&>::value>::type>
+    iterator insert(P&& value) {
+        value_type tmp(std::forward<P>(value));
+        return (insertAt(upper_bound(tmp.first), std::move(tmp)));
+    }
+
+    /// @brief Inserts an element after the elements with an equivalent
+    /// key.
+    ///
+    /// The hint is used when it is the right position, which makes the
+    /// insertion of sorted elements at the end cheap.
+    ///
+    /// @param hint Position suggested for the element.
+    /// @param value The element, or a pair convertible to it.
+    /// @return Iterator to the inserted element.
+    template<typename P, typename = typename std::enable_if<
+                             std::is_constructible<value_type, P&&>::value>::type>
+    iterator insert(const_iterator hint, P&& value) {
+        value_type tmp(std::forward<P>(value));
+        const_iterator pos = hint;
+        if (((pos != begin()) && comp_(tmp.first, (pos - 1)->first)) ||
+            ((pos != end()) && !comp_(tmp.first, pos->first))) {
+            pos = upper_bound(tmp.first);
+        }
+        return (insertAt(pos, std::move(tmp)));
+    }
+
+    /// @brief Inserts a range of elements.
+    ///
+    /// @param first Beginning of the range.
+    /// @param last End of the range.
+    template<typename InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            insert(end(), *first);
+        }
+    }
+
+    /// @brief Erases an element.
+    ///
+    /// @param pos Iterator to the element.
+    /// @return Iterator to the element following the erased one.
+    iterator erase(const_iterator pos) {
+        return (erase(pos, pos + 1));
+    }
+
+    /// @brief Erases a range of elements.
+    ///
+    /// @param first Beginning of the range.
+    /// @param last End of the range.
+    /// @return Iterator to the element following the erased ones.
+    iterator erase(const_iterator first, const_iterator last) {
+        iterator dst = data_ + (first - data_);
+        iterator src = data_ + (last - data_);
+        if (dst == src) {
+            return (dst);
+        }
+        // The keys are constant so the elements are moved by destroying
+        // and constructing them in place.
+        iterator out = dst;
+        for (; src != end(); ++src, ++out) {
+            out->~value_type();
+            new (out) value_type(std::move(*src));
+        }
+        destroy(out, end());
+        size_ = out - data_;
+        return (dst);
+    }
+
+    /// @brief Erases the elements with a key.
+    ///
+    /// @param key The key.
+    /// @return The number of erased elements.
+    size_type erase(const key_type& key) {
+        std::pair<iterator, iterator> range = equal_range(key);
+        size_type count = range.second - range.first;
+        erase(range.first, range.second);
+        return (count);
+    }
+
+    /// @name Lookups.
+    //@{
+    iterator find(const key_type& key) {
+        iterator it = lower_bound(key);
+        return (((it != end()) && !comp_(key, it->first)) ? it : end());
+    }
+
+    const_iterator find(const key_type& key) const {
+        const_iterator it = lower_bound(key);
+        return (((it != end()) && !comp_(key, it->first)) ? it : end());
+    }
+
+    size_type count(const key_type& key) const {
+        return (upper_bound(key) - lower_bound(key));
+    }
+
+    iterator lower_bound(const key_type& key) {
+        return (std::lower_bound(begin(), end(), key, KeyLess(comp_)));
+    }
+
+    const_iterator lower_bound(const key_type& key) const {
+        return (std::lower_bound(begin(), end(), key, KeyLess(comp_)));
+    }
+
+    iterator upper_bound(const key_type& key) {
+        return (std::upper_bound(begin(), end(), key, KeyLess(comp_)));
+    }
+
+    const_iterator upper_bound(const key_type& key) const {
+        return (std::upper_bound(begin(), end(), key, KeyLess(comp_)));
+    }
+
+    std::pair<iterator, iterator> equal_range(const key_type& key) {
+        return (std::make_pair(lower_bound(key), upper_bound(key)));
+    }
+
+    std::pair<const_iterator, const_iterator>
+    equal_range(const key_type& key) const {
+        return (std::make_pair(lower_bound(key), upper_bound(key)));
+    }
+    //@}
+
+    /// @brief Compares the elements of two containers.
+    ///
+    /// @param other The other container.
+    bool operator==(const FlatMultimap& other) const {
+        return ((size_ == other.size_) &&
+                std::equal(begin(), end(), other.begin()));
+    }
+
+    /// @brief Compares the elements of two containers.
+    ///
+    /// @param other The other container.
+    bool operator!=(const FlatMultimap& other) const {
+        return (!(*this == other));
+    }
+
+private:
+
+    /// @brief Comparison of the elements with the keys.
+    struct KeyLess {
+        /// @brief Constructor.
+        ///
+        /// @param comp Ordering of the keys.
+        explicit KeyLess(const Compare& comp) : comp_(comp) {
+        }
+
+        bool operator()(const value_type& value, const key_type& key) const {
+            return (comp_(value.first, key));
+        }
+
+        bool operator()(const key_type& key, const value_type& value) const {
+            return (comp_(key, value.first));
+        }
+
+        /// @brief Ordering of the keys.
+        const Compare& comp_;
+    };
+
+    /// @brief Inserts an element at a position.
+    ///
+    /// @param pos The position.
+    /// @param value The element.
+    /// @return Iterator to the inserted element.
+    iterator insertAt(const_iterator pos, value_type&& value) {
+        size_type index = pos - data_;
+        if (size_ == capacity_) {
+            // Grow leaving the slot of the new element uninitialized.
+            reallocate(capacity_ ? 2 * capacity_ : INITIAL_CAPACITY, index);
+        } else if (index < size_) {
+            iterator last = data_ + size_;
+            new (last) value_type(std::move(*(last - 1)));
+            for (iterator it = last - 1; it != data_ + index; --it) {
+                it->~value_type();
+                new (it) value_type(std::move(*(it - 1)));
+            }
+            data_[index].~value_type();
+        }
+        new (data_ + index) value_type(std::move(value));
+        ++size_;
+        return (data_ + index);
+    }
+
+    /// @brief Moves the elements to a new array.
+    ///
+    /// @param capacity The capacity of the new array.
+    /// @param gap Index of a slot left uninitialized in the new array,
+    /// equal to the size for none.
+    void reallocate(size_type capacity, size_type gap) {
+        value_type* data =
+            static_cast<value_type*>(::operator new(capacity * sizeof(value_type)));
+        for (size_type i = 0; i < size_; ++i) {
+            new (data + i + (i < gap ? 0 : 1)) value_type(std::move(data_[i]));
+            data_[i].~value_type();
+        }
+        ::operator delete(data_);
+        data_ = data;
+        capacity_ = capacity;
+    }
+
+    /// @brief Destroys a range of elements.
+    ///
+    /// @param first Beginning of the range.
+    /// @param last End of the range.
+    static void destroy(iterator first, iterator last) {
+        for (; first != last; ++first) {
+            first->~value_type();
+        }
+    }
+
+    /// @brief Capacity of the array at the first insertion.
+    static const size_type INITIAL_CAPACITY = 4;
+
+    /// @brief The array of elements.
+    value_type* data_;
+
+    /// @brief The number of elements.
+    size_type size_;
+
+    /// @brief The number of elements the array can hold.
+    size_type capacity_;
+
+    /// @brief Ordering of the keys.
+    Compare comp_;
+};
+
+} // end of namespace isc::util
+} // end of namespace isc
+
+#endif // FLAT_MULTIMAP_H
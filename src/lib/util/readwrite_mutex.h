@@ -0,0 +1,183 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef READWRITE_MUTEX_H
+#define READWRITE_MUTEX_H
+
+/// @file readwrite_mutex.h
+///
+/// Standard implementation of read-write mutexes with writer preference
+/// using C++11 mutex and condition variable.
+/// As we need only the RAII guard implementation this code avoids
+/// to provide the shared_mutex (C++17) interface.
+
+#include <boost/noncopyable.hpp>
+
+#include <climits>
+#include <condition_variable>
+#include <mutex>
+
+namespace isc {
+namespace util {
+
+/// @brief Read-write mutex.
+///
+/// The implementation follows the "Two-Gate" design. A writer entering
+/// the first gate blocks new readers, then waits at the second gate for
+/// the readers already inside to leave. This gives writers preference
+/// so a steady flow of readers can not starve them.
+class ReadWriteMutex : public boost::noncopyable {
+public:
+
+    /// @brief Constants.
+    ///
+    /// The write entered flag (higher bit so 2^31).
+    static const unsigned WRITE_ENTERED =
+        1U << (sizeof(unsigned) * CHAR_BIT - 1);
+
+    /// @brief The maximum number of readers (flag complement so 2^31 - 1).
+    static const unsigned MAX_READERS = ~WRITE_ENTERED;
+
+    /// @brief Constructor.
+    ReadWriteMutex() : state_(0) {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// @note: do not check that the state is 0 as there is nothing useful
+    /// to do if it is not.
+    virtual ~ReadWriteMutex() {
+        std::lock_guard<std::mutex> lk(mutex_);
+    }
+
+    /// @brief Lock write.
+    void writeLock() {
+        std::unique_lock<std::mutex> lk(mutex_);
+        // Wait until the write entered flag can be set.
+        gate1_.wait(lk, [this]() { return (!writeEntered()); });
+        state_ |= WRITE_ENTERED;
+        // Wait until there are no more readers.
+        gate2_.wait(lk, [this]() { return (readers() == 0); });
+    }
+
+    /// @brief Unlock write.
+    ///
+    /// @note: do not check that WRITE_ENTERED was set.
+    void writeUnlock() {
+        std::lock_guard<std::mutex> lk(mutex_);
+        state_ = 0;
+        // Wake-up waiting threads when exiting the guard.
+        gate1_.notify_all();
+    }
+
+    /// @brief Lock read.
+    void readLock() {
+        std::unique_lock<std::mutex> lk(mutex_);
+        // Wait if there is a writer or if readers overflow.
+        gate1_.wait(lk, [this]() { return (state_ < MAX_READERS); });
+        ++state_;
+    }
+
+    /// @brief Unlock read.
+    ///
+    /// @note: do not check that there is a least one reader.
+    void readUnlock() {
+        std::lock_guard<std::mutex> lk(mutex_);
+        unsigned prev = state_--;
+        if (writeEntered()) {
+            if (readers() == 0) {
+                // Last reader: wake up a waiting writer.
+                gate2_.notify_one();
+            }
+        } else {
+            if (prev == MAX_READERS) {
+                // Reader overflow: wake up one waiting reader.
+                gate1_.notify_one();
+            }
+        }
+    }
+
+private:
+
+    /// @brief Check if the write entered flag is set.
+    ///
+    /// @return true if a writer has entered the first gate.
+    bool writeEntered() const {
+        return (state_ & WRITE_ENTERED);
+    }
+
+    /// @brief Get the number of readers.
+    ///
+    /// @return The number of readers holding the lock.
+    unsigned readers() const {
+        return (state_ & MAX_READERS);
+    }
+
+    /// @brief The mutex.
+    std::mutex mutex_;
+
+    /// @brief First gate where both readers and writers wait.
+    std::condition_variable gate1_;
+
+    /// @brief Second gate where a writer waits for readers to leave.
+    std::condition_variable gate2_;
+
+    /// @brief The state: the write entered flag and the number of readers.
+    unsigned state_;
+};
+
+/// @brief Read mutex RAII handler.
+///
+/// Acquires the lock as a reader in the constructor and releases it in
+/// the destructor. Several readers can hold the lock at the same time.
+class ReadLockGuard : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param rw_mutex The read mutex.
+    ReadLockGuard(ReadWriteMutex& rw_mutex) : rw_mutex_(rw_mutex) {
+        rw_mutex_.readLock();
+    }
+
+    /// @brief Destructor.
+    virtual ~ReadLockGuard() {
+        rw_mutex_.readUnlock();
+    }
+
+private:
+    /// @brief The read write mutex.
+    ReadWriteMutex& rw_mutex_;
+};
+
+/// @brief Write mutex RAII handler.
+///
+/// Acquires the lock as a writer in the constructor and releases it in
+/// the destructor. A writer has an exclusive access.
+class WriteLockGuard : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param rw_mutex The write mutex.
+    WriteLockGuard(ReadWriteMutex& rw_mutex) : rw_mutex_(rw_mutex) {
+        rw_mutex_.writeLock();
+    }
+
+    /// @brief Destructor.
+    virtual ~WriteLockGuard() {
+        rw_mutex_.writeUnlock();
+    }
+
+private:
+    /// @brief The read write mutex.
+    ReadWriteMutex& rw_mutex_;
+};
+
+}  // namespace util
+}  // namespace isc
+
+#endif // READWRITE_MUTEX_H
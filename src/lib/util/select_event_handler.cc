@@ -0,0 +1,85 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <util/select_event_handler.h>
+
+#include <errno.h>
+#include <string.h>
+
+namespace isc {
+namespace util {
+
+SelectEventHandler::SelectEventHandler()
+    : FDEventHandler(TYPE_SELECT), max_fd_(0) {
+    FD_ZERO(&read_fd_set_);
+    FD_ZERO(&ready_fd_set_);
+}
+
+void
+SelectEventHandler::add(int fd) {
+    if ((fd < 0) || (fd >= FD_SETSIZE)) {
+        isc_throw(BadValue, "invalid file descriptor " << fd
+                  << " for select()");
+    }
+    if (FD_ISSET(fd, &read_fd_set_)) {
+        return;
+    }
+    FD_SET(fd, &read_fd_set_);
+    fds_.push_back(fd);
+    if (max_fd_ < fd) {
+        max_fd_ = fd;
+    }
+}
+
+int
+SelectEventHandler::waitEvent(uint32_t timeout_sec, uint32_t timeout_usec,
+                              bool use_timeout) {
+    ready_fds_.clear();
+    memcpy(&ready_fd_set_, &read_fd_set_, sizeof(fd_set));
+
+    struct timeval select_timeout;
+    select_timeout.tv_sec = timeout_sec;
+    select_timeout.tv_usec = timeout_usec;
+
+    // zero out the errno to be safe
+    errno = 0;
+
+    int result = select(max_fd_ + 1, &ready_fd_set_, 0, 0,
+                        use_timeout ? &select_timeout : 0);
+    if (result <= 0) {
+        FD_ZERO(&ready_fd_set_);
+        return (result);
+    }
+    for (auto fd : fds_) {
+        if (FD_ISSET(fd, &ready_fd_set_)) {
+            ready_fds_.push_back(fd);
+        }
+    }
+    return (result);
+}
+
+bool
+SelectEventHandler::readReady(int fd) const {
+    if ((fd < 0) || (fd >= FD_SETSIZE)) {
+        return (false);
+    }
+    return (FD_ISSET(fd, &ready_fd_set_));
+}
+
+void
+SelectEventHandler::clear() {
+    fds_.clear();
+    ready_fds_.clear();
+    max_fd_ = 0;
+    FD_ZERO(&read_fd_set_);
+    FD_ZERO(&ready_fd_set_);
+}
+
+} // namespace isc::util
+} // namespace isc
@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SELECT_EVENT_HANDLER_H
+#define SELECT_EVENT_HANDLER_H
+
+#include <util/fd_event_handler.h>
+
+#include <sys/select.h>
+
+namespace isc {
+namespace util {
+
+/// @brief File descriptor event handler class using select().
+///
+/// The file descriptors must be lower than FD_SETSIZE.
+class SelectEventHandler : public FDEventHandler {
+public:
+
+    /// @brief Constructor.
+    SelectEventHandler();
+
+    /// @brief Registers a file descriptor.
+    ///
+    /// @param fd The file descriptor.
+    /// @throw isc::BadValue if the file descriptor is negative or not
+    /// lower than FD_SETSIZE.
+    virtual void add(int fd);
+
+    /// @brief Waits for events on the registered file descriptors.
+    ///
+    /// @param timeout_sec The timeout in seconds.
+    /// @param timeout_usec The fractional part of the timeout in
+    /// microseconds.
+    /// @param use_timeout Wait indefinitely when false.
+    /// @return The select() result.
+    virtual int waitEvent(uint32_t timeout_sec, uint32_t timeout_usec = 0,
+                          bool use_timeout = true);
+
+    /// @brief Checks if a file descriptor is ready to read.
+    ///
+    /// @param fd The file descriptor.
+    /// @return True if the file descriptor was found ready by the last
+    /// waitEvent call.
+    virtual bool readReady(int fd) const;
+
+    /// @brief Unregisters all file descriptors.
+    virtual void clear();
+
+private:
+
+    /// @brief The registered file descriptors.
+    std::vector<int> fds_;
+
+    /// @brief The highest registered file descriptor.
+    int max_fd_;
+
+    /// @brief The set of the registered file descriptors.
+    fd_set read_fd_set_;
+
+    /// @brief The set of the file descriptors found ready.
+    fd_set ready_fd_set_;
+};
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // SELECT_EVENT_HANDLER_H
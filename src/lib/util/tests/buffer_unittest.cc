@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2020 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -294,6 +294,30 @@ TEST_F(BufferTest, outputBufferZeroSize) {
     });
 }
 
+// Check that reserve() preallocates and swap() exchanges the memory
+TEST_F(BufferTest, outputBufferReserveSwap) {
+    obuffer.reserve(100);
+    size_t capacity = obuffer.getCapacity();
+    EXPECT_LE(100, capacity);
+    EXPECT_EQ(0, obuffer.getLength());
+    const void* data = obuffer.getData();
+    for (int i = 0; i < 100; ++i) {
+        obuffer.writeUint8(i);
+    }
+    // No reallocation happened.
+    EXPECT_EQ(data, obuffer.getData());
+    EXPECT_EQ(capacity, obuffer.getCapacity());
+
+    OutputBuffer other(0);
+    other.writeUint8(1);
+    obuffer.swap(other);
+    EXPECT_EQ(1, obuffer.getLength());
+    EXPECT_EQ(1, obuffer[0]);
+    EXPECT_EQ(100, other.getLength());
+    EXPECT_EQ(data, other.getData());
+    EXPECT_EQ(capacity, other.getCapacity());
+}
+
 TEST_F(BufferTest, inputBufferReadVectorAll) {
     std::vector<uint8_t> vec;
 
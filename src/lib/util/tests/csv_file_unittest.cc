@@ -11,6 +11,7 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace {
 
@@ -579,4 +580,84 @@ TEST_F(CSVFileTest, exists) {
     EXPECT_FALSE(csv->exists());
 }
 
+// This test checks that the rows are appended through the journal and that
+// the journal follows the file when it is recreated.
+TEST_F(CSVFileTest, journal) {
+    boost::scoped_ptr<CSVFile> csv(new CSVFile(testfile_));
+    csv->addColumn("animal");
+    csv->addColumn("age");
+    FileJournalPtr journal(new FileJournal(FileJournal::DURABILITY_GROUP_COMMIT));
+    csv->setJournal(journal);
+    EXPECT_FALSE(journal->isOpen());
+    ASSERT_NO_THROW(csv->recreate());
+    EXPECT_TRUE(journal->isOpen());
+
+    CSVRow row(2);
+    row.writeAt(0, "dog");
+    row.writeAt(1, 3);
+    ASSERT_NO_THROW(csv->append(row));
+    journal->wait(journal->getSequence());
+    EXPECT_EQ("animal,age\n"
+              "dog,3\n",
+              readFile());
+
+    // Rows of the wrong size are still rejected.
+    CSVRow bad_row(3);
+    EXPECT_THROW(csv->append(bad_row), CSVFileError);
+
+    // Recreating the file reopens the journal on the new file.
+    ASSERT_NO_THROW(csv->recreate());
+    row.writeAt(0, "cat");
+    ASSERT_NO_THROW(csv->append(row));
+    ASSERT_NO_THROW(csv->flush());
+    EXPECT_EQ("animal,age\n"
+              "cat,3\n",
+              readFile());
+
+    // Closing the file closes the journal.
+    csv->close();
+    EXPECT_FALSE(journal->isOpen());
+}
+
+// This test checks that the rows of adjacent read ranges are read once.
+TEST_F(CSVFileTest, readRange) {
+    writeFile("animal,age,color\n"
+              "cat,10,white\n"
+              "lion,15,yellow\n"
+              "dog,3,black\n");
+
+    CSVFile csv(testfile_);
+    ASSERT_NO_THROW(csv.open());
+    const uint64_t size = csv.getReadSize();
+    ASSERT_EQ(57, size);
+
+    // Split the file at every offset: each row must be read by exactly
+    // one of the two ranges and the header never.
+    for (uint64_t split = 0; split <= size; ++split) {
+        SCOPED_TRACE(split);
+        std::vector<std::string> animals;
+        for (int range = 0; range < 2; ++range) {
+            CSVFile part(testfile_);
+            ASSERT_NO_THROW(part.open());
+            if (range == 0) {
+                ASSERT_NO_THROW(part.setReadRange(0, split));
+            } else {
+                ASSERT_NO_THROW(part.setReadRange(split, size));
+            }
+            CSVRow row;
+            while (part.next(row) && (row != CSVFile::EMPTY_ROW())) {
+                animals.push_back(row.readAt(0));
+            }
+        }
+        ASSERT_EQ(3, animals.size());
+        EXPECT_EQ("cat", animals[0]);
+        EXPECT_EQ("lion", animals[1]);
+        EXPECT_EQ("dog", animals[2]);
+    }
+
+    // The range can't be set on a closed file.
+    csv.close();
+    EXPECT_THROW(csv.setReadRange(0, size), CSVFileError);
+}
+
 } // end of anonymous namespace
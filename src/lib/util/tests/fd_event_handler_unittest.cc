@@ -0,0 +1,118 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <util/epoll_event_handler.h>
+#include <util/select_event_handler.h>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Test fixture class for the event handlers.
+class FDEventHandlerTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Opens two pipes.
+    FDEventHandlerTest() {
+        EXPECT_EQ(0, pipe(pipe1_));
+        EXPECT_EQ(0, pipe(pipe2_));
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Closes the pipes.
+    ~FDEventHandlerTest() {
+        close(pipe1_[0]);
+        close(pipe1_[1]);
+        close(pipe2_[0]);
+        close(pipe2_[1]);
+    }
+
+    /// @brief Checks the readiness reported by a handler.
+    ///
+    /// @param handler The handler to test.
+    void testReady(FDEventHandler& handler) {
+        // Timeout with nothing to read.
+        handler.add(pipe1_[0]);
+        handler.add(pipe2_[0]);
+        // Registering twice is harmless.
+        handler.add(pipe1_[0]);
+        EXPECT_EQ(0, handler.waitEvent(0, 1000));
+        EXPECT_FALSE(handler.readReady(pipe1_[0]));
+        EXPECT_TRUE(handler.getReadyFds().empty());
+
+        // Only the pipe with data is ready.
+        ASSERT_EQ(1, write(pipe2_[1], "x", 1));
+        EXPECT_EQ(1, handler.waitEvent(1));
+        EXPECT_FALSE(handler.readReady(pipe1_[0]));
+        EXPECT_TRUE(handler.readReady(pipe2_[0]));
+        ASSERT_EQ(1, handler.getReadyFds().size());
+        EXPECT_EQ(pipe2_[0], handler.getReadyFds()[0]);
+
+        // The registrations are kept: both pipes are ready.
+        ASSERT_EQ(1, write(pipe1_[1], "x", 1));
+        EXPECT_EQ(2, handler.waitEvent(0, 0, false));
+        EXPECT_TRUE(handler.readReady(pipe1_[0]));
+        EXPECT_TRUE(handler.readReady(pipe2_[0]));
+
+        // Not after clear.
+        handler.clear();
+        handler.add(pipe1_[0]);
+        EXPECT_EQ(1, handler.waitEvent(1));
+        EXPECT_TRUE(handler.readReady(pipe1_[0]));
+        EXPECT_FALSE(handler.readReady(pipe2_[0]));
+    }
+
+    /// @brief The first pipe.
+    int pipe1_[2];
+
+    /// @brief The second pipe.
+    int pipe2_[2];
+};
+
+// Verifies the select() based handler.
+TEST_F(FDEventHandlerTest, select) {
+    SelectEventHandler handler;
+    EXPECT_EQ(FDEventHandler::TYPE_SELECT, handler.type());
+    testReady(handler);
+
+    // The limits of select() are enforced.
+    EXPECT_THROW(handler.add(-1), BadValue);
+    EXPECT_THROW(handler.add(FD_SETSIZE), BadValue);
+}
+
+#if defined (OS_LINUX)
+
+// Verifies the epoll() based handler.
+TEST_F(FDEventHandlerTest, epoll) {
+    EpollEventHandler handler;
+    EXPECT_EQ(FDEventHandler::TYPE_EPOLL, handler.type());
+    testReady(handler);
+
+    // A file descriptor which is not open can't be registered.
+    EXPECT_THROW(handler.add(-1), BadValue);
+}
+
+// Verifies that the default handler is the epoll() based one.
+TEST_F(FDEventHandlerTest, create) {
+    FDEventHandlerPtr handler = createFDEventHandler();
+    ASSERT_TRUE(handler);
+    EXPECT_EQ(FDEventHandler::TYPE_EPOLL, handler->type());
+}
+
+#endif
+
+} // end of anonymous namespace
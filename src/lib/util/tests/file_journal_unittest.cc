@@ -0,0 +1,226 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <util/file_journal.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <csignal>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/resource.h>
+
+namespace {
+
+using namespace isc;
+using namespace isc::util;
+
+/// @brief Test fixture class for the journal.
+class FileJournalTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the file left by a previous test.
+    FileJournalTest()
+        : testfile_(TEST_DATA_BUILDDIR "/test-journal.csv") {
+        static_cast<void>(remove(testfile_.c_str()));
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the test file.
+    virtual ~FileJournalTest() {
+        static_cast<void>(remove(testfile_.c_str()));
+    }
+
+    /// @brief Reads the test file.
+    ///
+    /// @return Contents of the file.
+    std::string readFile() const {
+        std::ifstream fs(testfile_.c_str());
+        return (std::string((std::istreambuf_iterator<char>(fs)),
+                            std::istreambuf_iterator<char>()));
+    }
+
+    /// @brief Appends records from several threads and waits for them.
+    ///
+    /// @param journal The journal.
+    /// @param threads Number of threads.
+    /// @param records Number of records per thread.
+    void appendConcurrently(FileJournal& journal, size_t threads,
+                            size_t records) {
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.push_back(std::thread([&journal, t, records]() {
+                for (size_t r = 0; r < records; ++r) {
+                    std::ostringstream s;
+                    s << t << "," << r << "\n";
+                    journal.wait(journal.append(s.str()));
+                }
+            }));
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /// @brief Path to the test file.
+    std::string testfile_;
+};
+
+// Checks the names of the durability policies.
+TEST_F(FileJournalTest, durabilityFromText) {
+    EXPECT_EQ(FileJournal::DURABILITY_NONE,
+              FileJournal::durabilityFromText("none"));
+    EXPECT_EQ(FileJournal::DURABILITY_PERIODIC,
+              FileJournal::durabilityFromText("periodic"));
+    EXPECT_EQ(FileJournal::DURABILITY_GROUP_COMMIT,
+              FileJournal::durabilityFromText("group-commit"));
+    EXPECT_THROW(FileJournal::durabilityFromText("always"), BadValue);
+
+    EXPECT_EQ("none",
+              FileJournal::durabilityToText(FileJournal::DURABILITY_NONE));
+    EXPECT_EQ("periodic",
+              FileJournal::durabilityToText(FileJournal::DURABILITY_PERIODIC));
+    EXPECT_EQ("group-commit",
+              FileJournal::durabilityToText(FileJournal::DURABILITY_GROUP_COMMIT));
+}
+
+// Checks that the records can't be appended to a closed journal.
+TEST_F(FileJournalTest, closed) {
+    FileJournal journal(FileJournal::DURABILITY_NONE);
+    EXPECT_FALSE(journal.isOpen());
+    EXPECT_THROW(journal.append("foo\n"), FileJournalError);
+    EXPECT_THROW(journal.open("/no-such-dir/journal"), FileJournalError);
+    EXPECT_NO_THROW(journal.close());
+}
+
+// Checks that a waited record is written with the group commit policy.
+TEST_F(FileJournalTest, groupCommit) {
+    FileJournal journal(FileJournal::DURABILITY_GROUP_COMMIT);
+    ASSERT_NO_THROW(journal.open(testfile_));
+    EXPECT_TRUE(journal.isOpen());
+
+    uint64_t sequence = journal.append("foo,1\n");
+    EXPECT_EQ(1, sequence);
+    ASSERT_NO_THROW(journal.wait(sequence));
+    EXPECT_EQ("foo,1\n", readFile());
+    EXPECT_LE(1, journal.getSyncCount());
+
+    sequence = journal.append("bar,2\n");
+    EXPECT_EQ(2, sequence);
+    ASSERT_NO_THROW(journal.wait(sequence));
+    EXPECT_EQ("foo,1\nbar,2\n", readFile());
+}
+
+// Checks that the records of concurrent threads are written in batches
+// and that no record is lost.
+TEST_F(FileJournalTest, batches) {
+    FileJournal journal(FileJournal::DURABILITY_GROUP_COMMIT);
+    ASSERT_NO_THROW(journal.open(testfile_));
+    appendConcurrently(journal, 8, 100);
+    EXPECT_EQ(800, journal.getSequence());
+    EXPECT_GE(800, journal.getWriteCount());
+    EXPECT_GE(journal.getWriteCount(), journal.getSyncCount());
+
+    std::istringstream contents(readFile());
+    std::string line;
+    size_t count = 0;
+    std::vector<size_t> next(8, 0);
+    while (std::getline(contents, line)) {
+        size_t thread;
+        size_t record;
+        char comma;
+        std::istringstream s(line);
+        s >> thread >> comma >> record;
+        ASSERT_GT(8, thread);
+        // The records of a thread are in order.
+        EXPECT_EQ(next[thread], record);
+        next[thread] = record + 1;
+        ++count;
+    }
+    EXPECT_EQ(800, count);
+}
+
+// Checks that the periodic policy waits for the write and synchronizes
+// later.
+TEST_F(FileJournalTest, periodic) {
+    FileJournal journal(FileJournal::DURABILITY_PERIODIC, 10);
+    ASSERT_NO_THROW(journal.open(testfile_));
+    appendConcurrently(journal, 4, 10);
+    std::string contents = readFile();
+    EXPECT_EQ(40, std::count(contents.begin(), contents.end(), '\n'));
+
+    // Closing synchronizes the file.
+    ASSERT_NO_THROW(journal.close());
+    EXPECT_LE(1, journal.getSyncCount());
+}
+
+// Checks that the records are written without waiting with the none
+// policy and that closing writes the queued records.
+TEST_F(FileJournalTest, none) {
+    FileJournal journal(FileJournal::DURABILITY_NONE);
+    ASSERT_NO_THROW(journal.open(testfile_));
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_NO_THROW(journal.wait(journal.append("foo\n")));
+    }
+    ASSERT_NO_THROW(journal.close());
+    EXPECT_FALSE(journal.isOpen());
+    std::string contents = readFile();
+    EXPECT_EQ(100, std::count(contents.begin(), contents.end(), '\n'));
+    EXPECT_EQ(0, journal.getSyncCount());
+}
+
+// Checks that the journal can be closed and reopened on a new file.
+TEST_F(FileJournalTest, reopen) {
+    FileJournal journal(FileJournal::DURABILITY_GROUP_COMMIT);
+    ASSERT_NO_THROW(journal.open(testfile_));
+    journal.append("foo\n");
+    ASSERT_NO_THROW(journal.close());
+    EXPECT_EQ("foo\n", readFile());
+
+    static_cast<void>(remove(testfile_.c_str()));
+    ASSERT_NO_THROW(journal.open(testfile_));
+    journal.append("bar\n");
+    ASSERT_NO_THROW(journal.flush());
+    EXPECT_EQ("bar\n", readFile());
+}
+
+// Checks that a failed write is reported by the waits for its records
+// and once by a flush, and that the following records are written.
+TEST_F(FileJournalTest, writeAfterFailure) {
+    FileJournal journal(FileJournal::DURABILITY_GROUP_COMMIT);
+    ASSERT_NO_THROW(journal.open(testfile_));
+    uint64_t sequence = journal.append("foo\n");
+    ASSERT_NO_THROW(journal.wait(sequence));
+
+    // Limit the size of the files so as the next write fails.
+    struct rlimit limit;
+    ASSERT_EQ(0, getrlimit(RLIMIT_FSIZE, &limit));
+    struct rlimit small_limit = limit;
+    small_limit.rlim_cur = 4;
+    void (*handler)(int) = signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &small_limit));
+    uint64_t failed = journal.append("bar\n");
+    EXPECT_THROW(journal.wait(failed), FileJournalError);
+    ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &limit));
+    signal(SIGXFSZ, handler);
+
+    EXPECT_THROW(journal.flush(), FileJournalError);
+    EXPECT_NO_THROW(journal.flush());
+
+    // The next record is written while the failed one remains lost.
+    sequence = journal.append("baz\n");
+    EXPECT_NO_THROW(journal.wait(sequence));
+    EXPECT_THROW(journal.wait(failed), FileJournalError);
+    EXPECT_EQ("foo\nbaz\n", readFile());
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,211 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <util/flat_multimap.h>
+
+#include <boost/shared_ptr.hpp>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace isc::util;
+
+namespace {
+
+/// @brief Container used in the tests.
+typedef FlatMultimap<unsigned int, std::string> Container;
+
+/// @brief Returns the content of a container as a vector.
+///
+/// @param container The container.
+template<typename ContainerType>
+std::vector<std::pair<unsigned int, std::string> >
+content(const ContainerType& container) {
+    std::vector<std::pair<unsigned int, std::string> > result;
+    for (auto it = container.begin(); it != container.end(); ++it) {
+        result.push_back(std::make_pair(it->first, it->second));
+    }
+    return (result);
+}
+
+// Checks that an empty container has no elements.
+TEST(FlatMultimapTest, empty) {
+    Container container;
+    EXPECT_TRUE(container.empty());
+    EXPECT_EQ(0, container.size());
+    EXPECT_EQ(0, container.capacity());
+    EXPECT_TRUE(container.begin() == container.end());
+    EXPECT_TRUE(container.rbegin() == container.rend());
+    EXPECT_TRUE(container.find(1) == container.end());
+    EXPECT_EQ(0, container.count(1));
+    EXPECT_EQ(0, container.erase(1));
+}
+
+// Checks that the elements are ordered as in a multimap.
+TEST(FlatMultimapTest, insert) {
+    Container container;
+    std::multimap<unsigned int, std::string> reference;
+    const std::vector<std::pair<unsigned int, std::string> > values = {
+        { 5, "a" }, { 1, "b" }, { 5, "c" }, { 3, "d" }, { 9, "e" },
+        { 1, "f" }, { 0, "g" }, { 5, "h" }, { 7, "i" }, { 3, "j" }
+    };
+    for (auto value : values) {
+        Container::iterator it = container.insert(value);
+        EXPECT_EQ(value.first, it->first);
+        EXPECT_EQ(value.second, it->second);
+        reference.insert(value);
+    }
+    EXPECT_EQ(values.size(), container.size());
+    EXPECT_LE(values.size(), container.capacity());
+    EXPECT_EQ(content(reference), content(container));
+
+    // The reverse iterators walk backwards.
+    auto rit = reference.rbegin();
+    for (auto it = container.rbegin(); it != container.rend(); ++it, ++rit) {
+        EXPECT_EQ(rit->second, it->second);
+    }
+}
+
+// Checks the insertion with a hint.
+TEST(FlatMultimapTest, insertHint) {
+    Container container;
+    // A right hint.
+    container.insert(container.end(), std::make_pair(1, "a"));
+    container.insert(container.end(), std::make_pair(2, "b"));
+    container.insert(container.end(), std::make_pair(2, "c"));
+    // A wrong hint.
+    container.insert(container.begin(), std::make_pair(2, "d"));
+    container.insert(container.end(), std::make_pair(0, "e"));
+    std::vector<std::pair<unsigned int, std::string> > expected = {
+        { 0, "e" }, { 1, "a" }, { 2, "b" }, { 2, "c" }, { 2, "d" }
+    };
+    EXPECT_EQ(expected, content(container));
+}
+
+// Checks the lookups.
+TEST(FlatMultimapTest, lookup) {
+    Container container;
+    container.insert(std::make_pair(1, "a"));
+    container.insert(std::make_pair(3, "b"));
+    container.insert(std::make_pair(3, "c"));
+    container.insert(std::make_pair(5, "d"));
+
+    const Container& const_container = container;
+    ASSERT_TRUE(const_container.find(3) != const_container.end());
+    EXPECT_EQ("b", const_container.find(3)->second);
+    EXPECT_TRUE(container.find(2) == container.end());
+    EXPECT_TRUE(container.find(6) == container.end());
+    EXPECT_EQ(2, container.count(3));
+    EXPECT_EQ(1, container.count(5));
+    EXPECT_EQ(0, container.count(4));
+
+    auto range = const_container.equal_range(3);
+    ASSERT_EQ(2, std::distance(range.first, range.second));
+    EXPECT_EQ("b", range.first->second);
+    EXPECT_EQ("c", (range.first + 1)->second);
+    range = const_container.equal_range(4);
+    EXPECT_TRUE(range.first == range.second);
+    EXPECT_EQ("d", range.first->second);
+
+    // The values can be modified through the iterators.
+    container.find(5)->second = "e";
+    EXPECT_EQ("e", container.rbegin()->second);
+}
+
+// Checks the erasures.
+TEST(FlatMultimapTest, erase) {
+    Container container;
+    for (unsigned int i = 0; i < 10; ++i) {
+        container.insert(std::make_pair(i % 5, std::to_string(i)));
+    }
+    EXPECT_EQ(2, container.erase(3));
+    EXPECT_EQ(0, container.count(3));
+    EXPECT_EQ(8, container.size());
+
+    // Erasing an element returns the next one.
+    Container::iterator it = container.erase(container.find(1));
+    EXPECT_EQ(1, it->first);
+    EXPECT_EQ("6", it->second);
+
+    // The usual erasure loop.
+    for (it = container.begin(); it != container.end(); ) {
+        if (it->first == 0) {
+            it = container.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    std::vector<std::pair<unsigned int, std::string> > expected = {
+        { 1, "6" }, { 2, "2" }, { 2, "7" }, { 4, "4" }, { 4, "9" }
+    };
+    EXPECT_EQ(expected, content(container));
+
+    // Erasing a range.
+    it = container.erase(container.begin() + 1, container.begin() + 3);
+    EXPECT_EQ(4, it->first);
+    EXPECT_EQ(3, container.size());
+    it = container.erase(container.begin(), container.end());
+    EXPECT_TRUE(it == container.end());
+    EXPECT_TRUE(container.empty());
+
+    // The array is kept.
+    EXPECT_LE(10, container.capacity());
+}
+
+// Checks the copies, the moves and the comparisons.
+TEST(FlatMultimapTest, copy) {
+    Container container;
+    container.insert(std::make_pair(2, "a"));
+    container.insert(std::make_pair(1, "b"));
+
+    Container copy(container);
+    EXPECT_TRUE(copy == container);
+    copy.insert(std::make_pair(3, "c"));
+    EXPECT_TRUE(copy != container);
+    EXPECT_EQ(2, container.size());
+
+    Container range(copy.equal_range(1).first, copy.end());
+    EXPECT_EQ(copy, range);
+
+    Container moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(3, moved.size());
+
+    copy = container;
+    EXPECT_EQ(container, copy);
+    copy = std::move(moved);
+    EXPECT_EQ(3, copy.size());
+
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+    copy.swap(container);
+    EXPECT_EQ(2, copy.size());
+    EXPECT_TRUE(container.empty());
+}
+
+// Checks that the mapped values are destroyed.
+TEST(FlatMultimapTest, destroy) {
+    boost::shared_ptr<int> value(new int(1));
+    {
+        FlatMultimap<unsigned int, boost::shared_ptr<int> > container;
+        for (unsigned int i = 0; i < 20; ++i) {
+            container.insert(std::make_pair(20 - i, value));
+        }
+        EXPECT_EQ(21, value.use_count());
+        container.erase(10);
+        EXPECT_EQ(20, value.use_count());
+        FlatMultimap<unsigned int, boost::shared_ptr<int> > copy(container);
+        EXPECT_EQ(39, value.use_count());
+    }
+    EXPECT_EQ(1, value.use_count());
+}
+
+} // end of anonymous namespace
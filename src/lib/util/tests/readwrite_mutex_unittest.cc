@@ -0,0 +1,114 @@
+// Copyright (C) 2020 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <util/readwrite_mutex.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace isc::util;
+using namespace std;
+
+namespace {
+
+/// @brief Verifies that several readers can hold the lock together.
+TEST(ReadWriteMutexTest, readers) {
+    ReadWriteMutex rw_mutex;
+    atomic<unsigned> inside(0);
+    atomic<unsigned> max_inside(0);
+    vector<thread> threads;
+    for (unsigned i = 0; i < 4; ++i) {
+        threads.push_back(thread([&]() {
+            ReadLockGuard lock(rw_mutex);
+            unsigned cur = ++inside;
+            unsigned prev = max_inside;
+            while ((cur > prev) && !max_inside.compare_exchange_weak(prev, cur)) {
+            }
+            // Stay long enough for the other readers to come in.
+            this_thread::sleep_for(chrono::milliseconds(100));
+            --inside;
+        }));
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    EXPECT_GT(max_inside, 1);
+    EXPECT_EQ(0, inside);
+}
+
+/// @brief Verifies that a writer has an exclusive access.
+TEST(ReadWriteMutexTest, writers) {
+    ReadWriteMutex rw_mutex;
+    atomic<unsigned> readers(0);
+    atomic<unsigned> writers(0);
+    atomic<bool> failed(false);
+    uint64_t counter = 0;
+    vector<thread> threads;
+    for (unsigned i = 0; i < 4; ++i) {
+        threads.push_back(thread([&]() {
+            for (unsigned j = 0; j < 1000; ++j) {
+                WriteLockGuard lock(rw_mutex);
+                if ((++writers != 1) || (readers != 0)) {
+                    failed = true;
+                }
+                ++counter;
+                --writers;
+            }
+        }));
+        threads.push_back(thread([&]() {
+            for (unsigned j = 0; j < 1000; ++j) {
+                ReadLockGuard lock(rw_mutex);
+                ++readers;
+                if (writers != 0) {
+                    failed = true;
+                }
+                --readers;
+            }
+        }));
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    EXPECT_FALSE(failed);
+    EXPECT_EQ(4000, counter);
+}
+
+/// @brief Verifies that a waiting writer blocks new readers.
+TEST(ReadWriteMutexTest, writerPreference) {
+    ReadWriteMutex rw_mutex;
+    atomic<bool> writer_done(false);
+    atomic<bool> reader_saw_writer(false);
+
+    // Take a first read lock so the writer has to wait.
+    rw_mutex.readLock();
+    thread writer([&]() {
+        WriteLockGuard lock(rw_mutex);
+        writer_done = true;
+    });
+    // Give some time to the writer to enter the first gate.
+    this_thread::sleep_for(chrono::milliseconds(100));
+    thread reader([&]() {
+        ReadLockGuard lock(rw_mutex);
+        reader_saw_writer = writer_done.load();
+    });
+    // Give some time to the reader to block.
+    this_thread::sleep_for(chrono::milliseconds(100));
+    EXPECT_FALSE(writer_done);
+    rw_mutex.readUnlock();
+    writer.join();
+    reader.join();
+    EXPECT_TRUE(writer_done);
+    // The second reader was blocked until the writer was done.
+    EXPECT_TRUE(reader_saw_writer);
+}
+
+}